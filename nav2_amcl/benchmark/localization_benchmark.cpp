@@ -0,0 +1,218 @@
+// Copyright (c) 2023 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+
+#include "nav2_amcl/map/map.hpp"
+#include "nav2_amcl/motion_model/differential_motion_model.hpp"
+#include "nav2_amcl/particle_workers.hpp"
+#include "nav2_amcl/pf/pf.hpp"
+#include "nav2_amcl/sensors/laser/laser.hpp"
+
+// Benchmarks the particle filter pipeline without ROS transport: the
+// laser sensor models through pf_update_sensor, the differential motion
+// update, and the resampling pass, each swept across particle count and
+// map size over deterministic canned fixtures, reporting per-update
+// latency.
+
+namespace
+{
+
+constexpr int kMaxBeams = 60;
+constexpr double kRangeMax = 12.0;
+
+// Build a bordered map with deterministically scattered obstacles
+map_t * makeMapFixture(int size)
+{
+  map_t * map = map_alloc();
+  map->scale = 0.05;
+  map->size_x = size;
+  map->size_y = size;
+  map->cells = static_cast<map_cell_t *>(calloc(size * size, sizeof(map_cell_t)));
+
+  srand(42);
+  for (int j = 0; j < size; j++) {
+    for (int i = 0; i < size; i++) {
+      map_cell_t & cell = map->cells[MAP_INDEX(map, i, j)];
+      if (i == 0 || j == 0 || i == size - 1 || j == size - 1) {
+        cell.occ_state = +1;
+      } else {
+        cell.occ_state = (rand() % 500 == 0) ? +1 : -1;
+      }
+    }
+  }
+  return map;
+}
+
+// Generate a scan fixture by ray casting from the map center
+void makeScanFixture(map_t * map, nav2_amcl::LaserData & ldata, int beam_count)
+{
+  ldata.range_max = kRangeMax;
+  ldata.resizeRanges(beam_count);
+  for (int i = 0; i < beam_count; i++) {
+    const double bearing = -M_PI + (2 * M_PI * i) / beam_count;
+    ldata.ranges[i][0] = map_calc_range(map, 0.0, 0.0, bearing, kRangeMax);
+    ldata.ranges[i][1] = bearing;
+  }
+}
+
+pf_vector_t uniformPose(void * arg)
+{
+  map_t * map = static_cast<map_t *>(arg);
+  pf_vector_t pose;
+  const double half_x = map->size_x * map->scale / 2;
+  const double half_y = map->size_y * map->scale / 2;
+  pose.v[0] = (drand48() - 0.5) * 2 * half_x;
+  pose.v[1] = (drand48() - 0.5) * 2 * half_y;
+  pose.v[2] = (drand48() - 0.5) * 2 * M_PI;
+  return pose;
+}
+
+// Spread particles around the scan pose
+pf_t * makeFilterFixture(int particle_count)
+{
+  pf_t * pf = pf_alloc(
+    particle_count, particle_count, 0.001, 0.1,
+    reinterpret_cast<pf_init_model_fn_t>(uniformPose));
+
+  pf_vector_t mean = pf_vector_zero();
+  pf_matrix_t cov = pf_matrix_zero();
+  cov.m[0][0] = 0.25;
+  cov.m[1][1] = 0.25;
+  cov.m[2][2] = 0.1;
+  pf_init(pf, mean, cov);
+  return pf;
+}
+
+void BM_LikelihoodFieldSensorUpdate(benchmark::State & state)
+{
+  const int particle_count = state.range(0);
+  const int map_size = state.range(1);
+  nav2_amcl::ParticleWorkers::instance().setThreadCount(state.range(2));
+
+  map_t * map = makeMapFixture(map_size);
+  pf_t * pf = makeFilterFixture(particle_count);
+  nav2_amcl::LikelihoodFieldModel laser(0.5, 0.5, 0.2, 2.0, kMaxBeams, map);
+  nav2_amcl::LaserData ldata;
+  ldata.laser = &laser;
+  makeScanFixture(map, ldata, 180);
+
+  for (auto _ : state) {
+    laser.sensorUpdate(pf, &ldata);
+  }
+
+  pf_free(pf);
+  map_free(map);
+  nav2_amcl::ParticleWorkers::instance().setThreadCount(1);
+}
+
+void BM_BeamSensorUpdate(benchmark::State & state)
+{
+  const int particle_count = state.range(0);
+  const int map_size = state.range(1);
+  nav2_amcl::ParticleWorkers::instance().setThreadCount(state.range(2));
+
+  map_t * map = makeMapFixture(map_size);
+  pf_t * pf = makeFilterFixture(particle_count);
+  nav2_amcl::BeamModel laser(0.5, 0.05, 0.05, 0.5, 0.2, 0.1, 0.0, kMaxBeams, map);
+  nav2_amcl::LaserData ldata;
+  ldata.laser = &laser;
+  makeScanFixture(map, ldata, 180);
+
+  for (auto _ : state) {
+    laser.sensorUpdate(pf, &ldata);
+  }
+
+  pf_free(pf);
+  map_free(map);
+  nav2_amcl::ParticleWorkers::instance().setThreadCount(1);
+}
+
+void BM_MotionUpdate(benchmark::State & state)
+{
+  const int particle_count = state.range(0);
+
+  map_t * map = makeMapFixture(400);
+  pf_t * pf = makeFilterFixture(particle_count);
+  nav2_amcl::DifferentialMotionModel motion;
+  motion.initialize(0.2, 0.2, 0.2, 0.2, 0.2);
+
+  pf_vector_t pose = pf_vector_zero();
+  pf_vector_t delta = pf_vector_zero();
+  delta.v[0] = 0.05;
+  delta.v[2] = 0.02;
+
+  for (auto _ : state) {
+    pose.v[0] += delta.v[0];
+    motion.odometryUpdate(pf, pose, delta);
+  }
+
+  pf_free(pf);
+  map_free(map);
+}
+
+void BM_Resample(benchmark::State & state)
+{
+  const int particle_count = state.range(0);
+
+  map_t * map = makeMapFixture(400);
+  pf_t * pf = makeFilterFixture(particle_count);
+  nav2_amcl::LikelihoodFieldModel laser(0.5, 0.5, 0.2, 2.0, kMaxBeams, map);
+  nav2_amcl::LaserData ldata;
+  ldata.laser = &laser;
+  makeScanFixture(map, ldata, 180);
+
+  for (auto _ : state) {
+    // Weight the set so the resampler has a realistic distribution
+    laser.sensorUpdate(pf, &ldata);
+    pf_update_resample(pf, map);
+  }
+
+  pf_free(pf);
+  map_free(map);
+}
+
+}  // namespace
+
+BENCHMARK(BM_LikelihoodFieldSensorUpdate)
+->Args({500, 400, 1})
+->Args({2000, 400, 1})
+->Args({10000, 400, 1})
+->Args({10000, 400, 4})
+->Args({10000, 2000, 1})
+->Args({10000, 2000, 4})
+->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_BeamSensorUpdate)
+->Args({500, 400, 1})
+->Args({2000, 400, 1})
+->Args({10000, 400, 1})
+->Args({10000, 400, 4})
+->Args({10000, 2000, 1})
+->Args({10000, 2000, 4})
+->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_MotionUpdate)
+->Arg(500)->Arg(2000)->Arg(10000)
+->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_Resample)
+->Arg(500)->Arg(2000)->Arg(10000)
+->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
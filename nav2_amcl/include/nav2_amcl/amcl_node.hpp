@@ -24,7 +24,9 @@
 #include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -163,6 +165,18 @@ protected:
   bool sent_first_transform_{false};
   bool latest_tf_valid_{false};
   tf2::Transform latest_tf_;
+  /// Guards latest_tf_ and latest_tf_valid_ between the laser callback
+  /// and the TF publish thread
+  std::mutex latest_tf_mutex_;
+  /*
+   * @brief Re-stamp and broadcast the latest map->odom estimate at a fixed
+   * rate, so TF stays fresh while a filter update is still running. The
+   * laser callback remains the only writer of the estimate (latest wins);
+   * consumers compose it with live odometry for extrapolation.
+   */
+  void tfPublishLoop();
+  std::thread tf_publish_thread_;
+  std::atomic<bool> tf_publish_thread_running_{false};
 
   // Message filters
   /*
@@ -282,6 +296,22 @@ protected:
   std::map<std::string, int> frame_to_laser_;
   rclcpp::Time last_laser_received_ts_;
 
+  /*
+   * @struct ScanGeometry
+   * @brief Per-scanner beam bearings in the base frame, recomputed only
+   * when the scan geometry changes rather than on every callback
+   */
+  struct ScanGeometry
+  {
+    float angle_min;
+    float angle_increment;
+    int range_count{-1};
+    std::vector<double> bearings;
+  };
+  std::vector<ScanGeometry> scan_geometries_;
+  // Per-scanner scan buffers, reused across callbacks
+  std::vector<std::unique_ptr<nav2_amcl::LaserData>> laser_data_;
+
   /*
    * @brief Check if sufficient time has elapsed to get an update
    */
@@ -350,6 +380,9 @@ protected:
    * @brief Get ROS parameters for node
    */
   void initParameters();
+  bool adaptive_population_;
+  bool adaptive_scan_decimation_;
+  double adaptive_scan_spread_;
   double alpha1_;
   double alpha2_;
   double alpha3_;
@@ -360,6 +393,7 @@ protected:
   double beam_skip_error_threshold_;
   double beam_skip_threshold_;
   bool do_beamskip_;
+  std::string distance_map_cache_dir_;
   std::string global_frame_id_;
   double lambda_short_;
   double laser_likelihood_max_dist_;
@@ -370,15 +404,18 @@ protected:
   int max_particles_;
   int min_particles_;
   std::string odom_frame_id_;
+  int particle_filter_threads_;
   double pf_err_;
   double pf_z_;
   double alpha_fast_;
   double alpha_slow_;
   int resample_interval_;
   std::string robot_model_type_;
+  bool selective_resampling_;
   tf2::Duration save_pose_period_;
   double sigma_hit_;
   bool tf_broadcast_;
+  double tf_broadcast_rate_;
   tf2::Duration transform_tolerance_;
   double a_thresh_;
   double d_thresh_;
@@ -36,6 +36,7 @@ extern "C" {
 
 // Forward declarations
 struct _rtk_fig_t;
+struct _map_range_cache_t;
 
 
 // Limits
@@ -75,6 +76,9 @@ typedef struct
   // Max distance at which we care about obstacles, for constructing
   // likelihood field
   double max_occ_dist;
+
+  // Shared ray-cast cache for the beam model (see map_range.c)
+  struct _map_range_cache_t * range_cache;
 } map_t;
 
 
@@ -91,6 +95,10 @@ void map_free(map_t * map);
 // Update the cspace distances
 void map_update_cspace(map_t * map, double max_occ_dist);
 
+// Set the directory where computed cspace distances are persisted and
+// reloaded for unchanged maps; empty or NULL disables the cache
+void map_set_cspace_cache_dir(const char * dir);
+
 
 /**************************************************************************
  * Range functions
@@ -99,6 +107,14 @@ void map_update_cspace(map_t * map, double max_occ_dist);
 // Extract a single range reading from the map
 double map_calc_range(map_t * map, double ox, double oy, double oa, double max_range);
 
+// Prepare the shared ray-cast cache for lookups at the given max range,
+// allocating or resetting it as needed.  Must be called before issuing
+// concurrent map_calc_range queries; without it every query is traced.
+void map_range_cache_prepare(map_t * map, double max_range);
+
+// Destroy the ray-cast cache, if any
+void map_range_cache_free(map_t * map);
+
 
 /**************************************************************************
  * GUI/diagnostic functions
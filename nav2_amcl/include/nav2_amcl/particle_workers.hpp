@@ -0,0 +1,196 @@
+// Copyright (c) 2023 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_AMCL__PARTICLE_WORKERS_HPP_
+#define NAV2_AMCL__PARTICLE_WORKERS_HPP_
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nav2_amcl
+{
+
+/*
+ * @class ParticleWorkers
+ * @brief Persistent pool of threads sharding particle index ranges across
+ * cores for motion sampling, beam weighting and the weight reduction. Each
+ * thread is handed one contiguous range of particles per update; the calling
+ * thread processes the first range itself, so a pool sized to one thread
+ * degenerates to a plain function call with no synchronization.
+ */
+class ParticleWorkers
+{
+public:
+  /*
+   * @brief Get the process-wide pool shared by the sensor and motion models
+   */
+  static ParticleWorkers & instance()
+  {
+    static ParticleWorkers workers;
+    return workers;
+  }
+
+  /*
+   * @brief ParticleWorkers destructor, stops the workers
+   */
+  ~ParticleWorkers()
+  {
+    shutdown();
+  }
+
+  /*
+   * @brief Set the number of threads sharding the particles, respawning workers
+   * @param thread_count Threads to use, including the calling thread
+   */
+  void setThreadCount(int thread_count)
+  {
+    thread_count = std::max(1, thread_count);
+    if (thread_count == thread_count_) {
+      return;
+    }
+
+    shutdown();
+    thread_count_ = thread_count;
+    active_ = true;
+    for (int i = 1; i < thread_count_; i++) {
+      // hand the worker the current cycle so respawned workers do not
+      // mistake a past task for a fresh one
+      workers_.push_back(std::thread(&ParticleWorkers::workerThread, this, i, cycle_));
+    }
+  }
+
+  /*
+   * @brief Get the number of threads sharding the particles
+   * @return Thread count, including the calling thread
+   */
+  int getThreadCount() const
+  {
+    return thread_count_;
+  }
+
+  /*
+   * @brief Stop and join the worker threads
+   */
+  void shutdown()
+  {
+    {
+      std::unique_lock<std::mutex> guard(mutex_);
+      active_ = false;
+    }
+    start_cond_.notify_all();
+    for (auto & worker : workers_) {
+      if (worker.joinable()) {
+        worker.join();
+      }
+    }
+    workers_.clear();
+    thread_count_ = 1;
+  }
+
+  /*
+   * @brief Run a function over particle indices [0, total), sharded across
+   * the pool's threads, returning once every range has completed
+   * @param total Number of particles to shard
+   * @param fn Function called per shard with its [begin, end) range and
+   * shard index, the latter for per-shard partial sums and random streams
+   */
+  void forEachRange(int total, const std::function<void(int, int, int)> & fn)
+  {
+    if (thread_count_ <= 1 || total < 2 * thread_count_) {
+      fn(0, total, 0);
+      return;
+    }
+
+    {
+      std::unique_lock<std::mutex> guard(mutex_);
+      task_ = &fn;
+      total_ = total;
+      pending_ = thread_count_ - 1;
+      cycle_++;
+    }
+    start_cond_.notify_all();
+
+    runRange(0);
+
+    std::unique_lock<std::mutex> guard(mutex_);
+    done_cond_.wait(guard, [this]() {return pending_ == 0;});
+    task_ = nullptr;
+  }
+
+protected:
+  /*
+   * @brief ParticleWorkers constructor, private to the singleton accessor
+   */
+  ParticleWorkers() = default;
+
+  /*
+   * @brief Run one thread's range of the current task
+   * @param shard_id Which thread's range to run
+   */
+  void runRange(int shard_id)
+  {
+    const int range_size = (total_ + thread_count_ - 1) / thread_count_;
+    const int begin = shard_id * range_size;
+    const int end = std::min(total_, begin + range_size);
+    if (begin < end) {
+      (*task_)(begin, end, shard_id);
+    }
+  }
+
+  /*
+   * @brief Worker thread body, waiting for tasks until shutdown
+   * @param shard_id Which range of each task this worker runs
+   * @param last_cycle The task cycle current when the worker was spawned
+   */
+  void workerThread(int shard_id, unsigned int last_cycle)
+  {
+    while (true) {
+      {
+        std::unique_lock<std::mutex> guard(mutex_);
+        start_cond_.wait(guard, [&]() {return !active_ || cycle_ != last_cycle;});
+        if (!active_) {
+          return;
+        }
+        last_cycle = cycle_;
+      }
+
+      runRange(shard_id);
+
+      {
+        std::unique_lock<std::mutex> guard(mutex_);
+        pending_--;
+      }
+      done_cond_.notify_one();
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable start_cond_, done_cond_;
+
+  const std::function<void(int, int, int)> * task_{nullptr};
+  int thread_count_{1};
+  int total_{0};
+  int pending_{0};
+  unsigned int cycle_{0};
+  bool active_{false};
+};
+
+}  // namespace nav2_amcl
+
+#endif  // NAV2_AMCL__PARTICLE_WORKERS_HPP_
@@ -29,7 +29,7 @@
 #define NAV2_AMCL__PF__PF_HPP_
 
 #include "nav2_amcl/pf/pf_vector.hpp"
-#include "nav2_amcl/pf/pf_kdtree.hpp"
+#include "nav2_amcl/pf/pf_histogram.hpp"
 
 #ifdef __cplusplus
 extern "C" {
@@ -93,8 +93,8 @@ typedef struct _pf_sample_set_t
   int sample_count;
   pf_sample_t * samples;
 
-  // A kdtree encoding the histogram
-  pf_kdtree_t * kdtree;
+  // A flat histogram over the discretized pose space
+  pf_histogram_t * histogram;
 
   // Clusters
   int cluster_count, cluster_max_count;
@@ -133,6 +133,15 @@ typedef struct _pf_t
   double dist_threshold;  // distance threshold in each axis over which the pf is considered to not
                           // be converged
   int converged;
+
+  // When set, resampling is skipped while the effective sample size is
+  // above half the sample count
+  int selective_resampling;
+
+  // When set, the population is resized between resampling passes from
+  // the KLD bound over the occupied bins, within [min_samples,
+  // max_samples]
+  int adaptive_population;
 } pf_t;
 
 
@@ -160,6 +169,9 @@ void pf_update_sensor(pf_t * pf, pf_sensor_model_fn_t sensor_fn, void * sensor_d
 // Resample the distribution
 void pf_update_resample(pf_t * pf, void * random_pose_data);
 
+// Resize the population toward the KLD bound between resampling passes
+void pf_update_population(pf_t * pf);
+
 // Compute the CEP statistics (mean and variance).
 // void pf_get_cep_stats(pf_t * pf, pf_vector_t * mean, double * var);
 
@@ -176,7 +188,7 @@ void pf_cluster_stats(pf_t * pf, pf_sample_set_t * set);
 // Display the sample set
 void pf_draw_samples(pf_t * pf, struct _rtk_fig_t * fig, int max_samples);
 
-// Draw the histogram (kdtree)
+// Draw the histogram
 void pf_draw_hist(pf_t * pf, struct _rtk_fig_t * fig);
 
 // Draw the CEP statistics
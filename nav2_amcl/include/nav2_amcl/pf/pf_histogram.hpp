@@ -0,0 +1,90 @@
+// Copyright (c) 2023 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**************************************************************************
+ * Desc: Flat open-addressing histogram over the discretized pose space,
+ * replacing the pointer-chasing kd tree for KLD support counting and
+ * cluster statistics. All storage is preallocated; inserting, counting
+ * occupied bins and clustering are allocation-free.
+ *************************************************************************/
+
+#ifndef NAV2_AMCL__PF__PF_HISTOGRAM_HPP_
+#define NAV2_AMCL__PF__PF_HISTOGRAM_HPP_
+
+#include "nav2_amcl/pf/pf_vector.hpp"
+
+#ifdef INCLUDE_RTKGUI
+#include <rtk.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A flat pose histogram with open addressing
+typedef struct
+{
+  // Cell size
+  double size[3];
+
+  // Number of slots (power of two) and probe mask
+  int capacity, mask;
+
+  // The number of occupied bins (the KLD support size)
+  int bin_count;
+
+  // Per-slot discretized keys, accumulated weights and cluster labels
+  int (*keys)[3];
+  double * values;
+  int * clusters;
+
+  // Per-slot union-find parents for in-place clustering
+  int * parents;
+
+  // Per-slot occupancy flags, cleared in one pass between updates
+  unsigned char * used;
+} pf_histogram_t;
+
+
+// Create a histogram able to hold at least max_size bins
+extern pf_histogram_t * pf_histogram_alloc(int max_size);
+
+// Destroy a histogram
+extern void pf_histogram_free(pf_histogram_t * self);
+
+// Clear all bins from the histogram
+extern void pf_histogram_clear(pf_histogram_t * self);
+
+// Accumulate a pose into its bin
+extern void pf_histogram_insert(pf_histogram_t * self, pf_vector_t pose, double value);
+
+// Label the connected components of occupied bins
+extern void pf_histogram_cluster(pf_histogram_t * self);
+
+// Determine the cluster label for the given pose
+extern int pf_histogram_get_cluster(pf_histogram_t * self, pf_vector_t pose);
+
+
+#ifdef INCLUDE_RTKGUI
+
+// Draw the occupied bins
+extern void pf_histogram_draw(pf_histogram_t * self, rtk_fig_t * fig);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // NAV2_AMCL__PF__PF_HISTOGRAM_HPP_
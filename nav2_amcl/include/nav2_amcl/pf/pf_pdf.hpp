@@ -69,11 +69,16 @@ void pf_pdf_gaussian_free(pf_pdf_gaussian_t * pdf);
 // double pf_pdf_gaussian_value(pf_pdf_gaussian_t *pdf, pf_vector_t z);
 
 // Draw randomly from a zero-mean Gaussian distribution, with standard
-// deviation sigma.
-// We use the polar form of the Box-Muller transformation, explained here:
-//   http://www.taygeta.com/random/gaussian.html
+// deviation sigma, using the ziggurat method of Marsaglia & Tsang.
 double pf_ran_gaussian(double sigma);
 
+// Reentrant variant of pf_ran_gaussian drawing from a caller-owned erand48
+// state, for sampling from several threads without sharing the global stream.
+double pf_ran_gaussian_r(double sigma, unsigned short xsubi[3]);
+
+// Batched variant of pf_ran_gaussian_r, filling samples[0..n-1] in one pass.
+void pf_ran_gaussian_fill_r(double sigma, double * samples, int n, unsigned short xsubi[3]);
+
 // Generate a sample from the pdf.
 pf_vector_t pf_pdf_gaussian_sample(pf_pdf_gaussian_t * pdf);
 
@@ -32,6 +32,18 @@ static void srand48(long int seedval)// NOLINT
 {
   srand(seedval);
 }
+
+static long int lrand48(void)// NOLINT
+{
+  return rand();// NOLINT
+}
+
+// No per-state stream without erand48; fall back to the global one.
+static double erand48(unsigned short xsubi[3])// NOLINT
+{
+  (void)xsubi;
+  return drand48();
+}
 #endif
 
 #ifdef __cplusplus
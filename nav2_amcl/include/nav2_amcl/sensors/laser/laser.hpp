@@ -18,6 +18,8 @@
 #ifndef NAV2_AMCL__SENSORS__LASER__LASER_HPP_
 #define NAV2_AMCL__SENSORS__LASER__LASER_HPP_
 
+#include <vector>
+
 #include "nav2_amcl/map/map.hpp"
 #include "nav2_amcl/pf/pf.hpp"
 #include "nav2_amcl/pf/pf_pdf.hpp"
@@ -99,10 +101,28 @@ public:
    */
   virtual ~LaserData() {delete[] ranges;}
 
+  /*
+   * @brief Size the ranges buffer for a scan, reusing the allocation
+   * across scans and growing it only when a larger scan arrives
+   * @param count Number of readings the buffer must hold
+   */
+  void resizeRanges(int count)
+  {
+    if (count > range_capacity_) {
+      delete[] ranges;
+      ranges = new double[count][2];
+      range_capacity_ = count;
+    }
+    range_count = count;
+  }
+
 public:
   int range_count;
   double range_max;
   double(*ranges)[2];
+
+private:
+  int range_capacity_{0};
 };
 
 /*
@@ -165,6 +185,18 @@ private:
    * @return if it was succesful
    */
   static double sensorFunction(LaserData * data, pf_sample_set_t * set);
+
+  /*
+   * @brief Rebuild the per-cell beam probability table if the max range changed
+   * @param range_max Max range of the scan being scored
+   */
+  void updateCellProbTable(double range_max);
+
+  // Per-cell (z_hit * exp(-occ_dist^2 / denom) + z_rand / range_max)^3 terms,
+  // precomputed so scoring reduces to an endpoint projection and one lookup
+  std::vector<float> cell_prob_table_;
+  double cell_prob_range_max_{0.0};
+  float off_map_prob_{0.0f};
 };
 
 /*
@@ -23,6 +23,7 @@
 #include "nav2_amcl/amcl_node.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <utility>
@@ -31,8 +32,10 @@
 #include "message_filters/subscriber.h"
 #include "nav2_amcl/angleutils.hpp"
 #include "nav2_util/geometry_utils.hpp"
+#include "nav2_amcl/particle_workers.hpp"
 #include "nav2_amcl/pf/pf.hpp"
 #include "nav2_util/string_utils.hpp"
+#include "nav2_util/trace.hpp"
 #include "nav2_amcl/sensors/laser/laser.hpp"
 #include "rclcpp/node_options.hpp"
 #include "tf2/convert.h"
@@ -60,6 +63,16 @@ AmclNode::AmclNode(const rclcpp::NodeOptions & options)
 {
   RCLCPP_INFO(get_logger(), "Creating");
 
+  add_parameter(
+    "adaptive_scan_decimation", rclcpp::ParameterValue(false),
+    "Decimate scans while the particle spread is low, so beam processing cost"
+    " tracks localization uncertainty rather than sensor rate");
+
+  add_parameter(
+    "adaptive_scan_spread", rclcpp::ParameterValue(0.5),
+    "Particle spread (meters) at or above which the full beam budget is kept",
+    "Below it beams scale down linearly, to a quarter of max_beams");
+
   add_parameter(
     "alpha1", rclcpp::ParameterValue(0.2),
     "This is the alpha1 parameter", "These are additional constraints for alpha1");
@@ -89,6 +102,11 @@ AmclNode::AmclNode(const rclcpp::NodeOptions & options)
   add_parameter("beam_skip_threshold", rclcpp::ParameterValue(0.3));
   add_parameter("do_beamskip", rclcpp::ParameterValue(false));
 
+  add_parameter(
+    "distance_map_cache_dir", rclcpp::ParameterValue(std::string("")),
+    "Directory where the likelihood field distance map is persisted and reloaded"
+    " for unchanged maps, skipping its recomputation on restart; empty disables caching");
+
   add_parameter(
     "global_frame_id", rclcpp::ParameterValue(std::string("map")),
     "The name of the coordinate frame published by the localization system");
@@ -153,6 +171,11 @@ AmclNode::AmclNode(const rclcpp::NodeOptions & options)
     "odom_frame_id", rclcpp::ParameterValue(std::string("odom")),
     "Which frame to use for odometry");
 
+  add_parameter(
+    "particle_filter_threads", rclcpp::ParameterValue(1),
+    "Number of threads sharding particle ranges for motion sampling and sensor"
+    " weighting, including the update thread itself, so large filters scale with cores");
+
   add_parameter("pf_err", rclcpp::ParameterValue(0.05));
   add_parameter("pf_z", rclcpp::ParameterValue(0.99));
 
@@ -174,6 +197,17 @@ AmclNode::AmclNode(const rclcpp::NodeOptions & options)
 
   add_parameter("robot_model_type", rclcpp::ParameterValue("nav2_amcl::DifferentialMotionModel"));
 
+  add_parameter(
+    "selective_resampling", rclcpp::ParameterValue(false),
+    "Resample only when the effective sample size has dropped below half the particle count,"
+    " avoiding the variance a resampling pass introduces while the weights are still healthy");
+
+  add_parameter(
+    "adaptive_population", rclcpp::ParameterValue(false),
+    "Resize the particle set between resampling passes from the KLD bound over the occupied"
+    " bins, within [min_particles, max_particles], so a well-converged filter tracks with few"
+    " particles and the population grows back when the estimate spreads out");
+
   add_parameter(
     "save_pose_rate", rclcpp::ParameterValue(0.5),
     "Maximum rate (Hz) at which to store the last estimated pose and covariance to the parameter "
@@ -188,6 +222,12 @@ AmclNode::AmclNode(const rclcpp::NodeOptions & options)
     "Set this to false to prevent amcl from publishing the transform between the global frame and "
     "the odometry frame");
 
+  add_parameter(
+    "tf_broadcast_rate", rclcpp::ParameterValue(50.0),
+    "Rate (Hz) at which a dedicated thread re-stamps and re-broadcasts the latest map to odom "
+    "estimate, keeping the transform fresh even while a long filter update is running",
+    "0.0 to only broadcast from the laser callback as updates complete");
+
   add_parameter(
     "transform_tolerance", rclcpp::ParameterValue(1.0),
     "Time with which to post-date the transform that is published, to indicate that this transform "
@@ -294,6 +334,11 @@ AmclNode::on_activate(const rclcpp_lifecycle::State & /*state*/)
   // create bond connection
   createBond();
 
+  if (tf_broadcast_ && tf_broadcast_rate_ > 0.0) {
+    tf_publish_thread_running_ = true;
+    tf_publish_thread_ = std::thread(&AmclNode::tfPublishLoop, this);
+  }
+
   return nav2_util::CallbackReturn::SUCCESS;
 }
 
@@ -304,6 +349,11 @@ AmclNode::on_deactivate(const rclcpp_lifecycle::State & /*state*/)
 
   active_ = false;
 
+  tf_publish_thread_running_ = false;
+  if (tf_publish_thread_.joinable()) {
+    tf_publish_thread_.join();
+  }
+
   // Lifecycle publishers must be explicitly deactivated
   pose_pub_->on_deactivate();
   particle_cloud_pub_->on_deactivate();
@@ -359,10 +409,13 @@ AmclNode::on_cleanup(const rclcpp_lifecycle::State & /*state*/)
   // Particle Filter
   pf_free(pf_);
   pf_ = nullptr;
+  ParticleWorkers::instance().shutdown();
 
   // Laser Scan
   lasers_.clear();
   lasers_update_.clear();
+  scan_geometries_.clear();
+  laser_data_.clear();
   frame_to_laser_.clear();
   force_update_ = true;
 
@@ -639,6 +692,10 @@ AmclNode::laserReceived(sensor_msgs::msg::LaserScan::ConstSharedPtr laser_scan)
     return;
   }
 
+  NAV2_TRACE(
+    "amcl", "laser_received_begin",
+    rclcpp::Time(laser_scan->header.stamp).nanoseconds());
+
   std::string laser_scan_frame_id = nav2_util::strip_leading_slash(laser_scan->header.frame_id);
   last_laser_received_ts_ = now();
   int laser_index = -1;
@@ -700,6 +757,11 @@ AmclNode::laserReceived(sensor_msgs::msg::LaserScan::ConstSharedPtr laser_scan)
     if (!(++resample_count_ % resample_interval_)) {
       pf_update_resample(pf_, reinterpret_cast<void *>(map_));
       resampled = true;
+    } else {
+      // Between resampling passes, let the population track the KLD
+      // bound so steady-state tracking runs with fewer particles.
+      // No-op unless adaptive_population is enabled.
+      pf_update_population(pf_);
     }
 
     pf_sample_set_t * set = pf_->sets + pf_->current_set;
@@ -737,6 +799,10 @@ AmclNode::laserReceived(sensor_msgs::msg::LaserScan::ConstSharedPtr laser_scan)
       sendMapToOdomTransform(transform_expiration);
     }
   }
+
+  NAV2_TRACE(
+    "amcl", "laser_received_end",
+    rclcpp::Time(laser_scan->header.stamp).nanoseconds());
 }
 
 bool AmclNode::addNewScanner(
@@ -747,6 +813,8 @@ bool AmclNode::addNewScanner(
 {
   lasers_.push_back(createLaserObject());
   lasers_update_.push_back(true);
+  scan_geometries_.push_back(ScanGeometry());
+  laser_data_.push_back(std::make_unique<nav2_amcl::LaserData>());
   laser_index = frame_to_laser_.size();
 
   geometry_msgs::msg::PoseStamped ident;
@@ -793,39 +861,54 @@ bool AmclNode::updateFilter(
   const sensor_msgs::msg::LaserScan::ConstSharedPtr & laser_scan,
   const pf_vector_t & pose)
 {
-  nav2_amcl::LaserData ldata;
+  nav2_amcl::LaserData & ldata = *laser_data_[laser_index];
   ldata.laser = lasers_[laser_index];
-  ldata.range_count = laser_scan->ranges.size();
+  int range_count = laser_scan->ranges.size();
   // To account for lasers that are mounted upside-down, we determine the
-  // min, max, and increment angles of the laser in the base frame.
-  //
-  // Construct min and max angles of laser, in the base_link frame.
-  // Here we set the roll pich yaw of the lasers.  We assume roll and pich are zero.
-  geometry_msgs::msg::QuaternionStamped min_q, inc_q;
-  min_q.header.stamp = laser_scan->header.stamp;
-  min_q.header.frame_id = nav2_util::strip_leading_slash(laser_scan->header.frame_id);
-  min_q.quaternion = orientationAroundZAxis(laser_scan->angle_min);
-
-  inc_q.header = min_q.header;
-  inc_q.quaternion = orientationAroundZAxis(laser_scan->angle_min + laser_scan->angle_increment);
-  try {
-    tf_buffer_->transform(min_q, min_q, base_frame_id_);
-    tf_buffer_->transform(inc_q, inc_q, base_frame_id_);
-  } catch (tf2::TransformException & e) {
-    RCLCPP_WARN(
-      get_logger(), "Unable to transform min/max laser angles into base frame: %s",
-      e.what());
-    return false;
-  }
-  double angle_min = tf2::getYaw(min_q.quaternion);
-  double angle_increment = tf2::getYaw(inc_q.quaternion) - angle_min;
+  // min, max, and increment angles of the laser in the base frame. The
+  // resulting bearing table is kept per scanner and recomputed only when
+  // the scan geometry changes, not on every callback.
+  ScanGeometry & geometry = scan_geometries_[laser_index];
+  if (geometry.range_count != range_count ||
+    geometry.angle_min != laser_scan->angle_min ||
+    geometry.angle_increment != laser_scan->angle_increment)
+  {
+    // Construct min and max angles of laser, in the base_link frame.
+    // Here we set the roll pich yaw of the lasers.  We assume roll and pich are zero.
+    geometry_msgs::msg::QuaternionStamped min_q, inc_q;
+    min_q.header.stamp = laser_scan->header.stamp;
+    min_q.header.frame_id = nav2_util::strip_leading_slash(laser_scan->header.frame_id);
+    min_q.quaternion = orientationAroundZAxis(laser_scan->angle_min);
+
+    inc_q.header = min_q.header;
+    inc_q.quaternion = orientationAroundZAxis(laser_scan->angle_min + laser_scan->angle_increment);
+    try {
+      tf_buffer_->transform(min_q, min_q, base_frame_id_);
+      tf_buffer_->transform(inc_q, inc_q, base_frame_id_);
+    } catch (tf2::TransformException & e) {
+      RCLCPP_WARN(
+        get_logger(), "Unable to transform min/max laser angles into base frame: %s",
+        e.what());
+      return false;
+    }
+    double angle_min = tf2::getYaw(min_q.quaternion);
+    double angle_increment = tf2::getYaw(inc_q.quaternion) - angle_min;
 
-  // wrapping angle to [-pi .. pi]
-  angle_increment = fmod(angle_increment + 5 * M_PI, 2 * M_PI) - M_PI;
+    // wrapping angle to [-pi .. pi]
+    angle_increment = fmod(angle_increment + 5 * M_PI, 2 * M_PI) - M_PI;
 
-  RCLCPP_DEBUG(
-    get_logger(), "Laser %d angles in base frame: min: %.3f inc: %.3f", laser_index, angle_min,
-    angle_increment);
+    RCLCPP_DEBUG(
+      get_logger(), "Laser %d angles in base frame: min: %.3f inc: %.3f", laser_index, angle_min,
+      angle_increment);
+
+    geometry.angle_min = laser_scan->angle_min;
+    geometry.angle_increment = laser_scan->angle_increment;
+    geometry.range_count = range_count;
+    geometry.bearings.resize(range_count);
+    for (int i = 0; i < range_count; i++) {
+      geometry.bearings[i] = angle_min + (i * angle_increment);
+    }
+  }
 
   // Check the validity of range_max, must > 0.0
   if (laser_scan->range_max <= 0.0) {
@@ -849,19 +932,29 @@ bool AmclNode::updateFilter(
     range_min = laser_scan->range_min;
   }
 
-  // The LaserData destructor will free this memory
-  ldata.ranges = new double[ldata.range_count][2];
-  for (int i = 0; i < ldata.range_count; i++) {
+  // Optionally decimate the scan while the particle spread is low, so the
+  // number of beams processed tracks localization uncertainty
+  int decimation = 1;
+  if (adaptive_scan_decimation_ && adaptive_scan_spread_ > 0.0) {
+    pf_sample_set_t * set = pf_->sets + pf_->current_set;
+    const double spread = sqrt(fabs(set->cov.m[0][0]) + fabs(set->cov.m[1][1]));
+    const double fraction = std::clamp(spread / adaptive_scan_spread_, 0.25, 1.0);
+    const int target = std::max(2, static_cast<int>(max_beams_ * fraction));
+    decimation = std::max(1, range_count / target);
+  }
+
+  // The buffer is reused across scans, growing only when needed
+  ldata.resizeRanges((range_count + decimation - 1) / decimation);
+  for (int i = 0, j = 0; i < range_count; i += decimation, j++) {
     // amcl doesn't (yet) have a concept of min range.  So we'll map short
     // readings to max range.
     if (laser_scan->ranges[i] <= range_min) {
-      ldata.ranges[i][0] = ldata.range_max;
+      ldata.ranges[j][0] = ldata.range_max;
     } else {
-      ldata.ranges[i][0] = laser_scan->ranges[i];
+      ldata.ranges[j][0] = laser_scan->ranges[i];
     }
-    // Compute bearing
-    ldata.ranges[i][1] = angle_min +
-      (i * angle_increment);
+    // Bearing from the per-scanner table
+    ldata.ranges[j][1] = geometry.bearings[i];
   }
   lasers_[laser_index]->sensorUpdate(pf_, reinterpret_cast<nav2_amcl::LaserData *>(&ldata));
   lasers_update_[laser_index] = false;
@@ -1017,6 +1110,7 @@ AmclNode::calculateMaptoOdomTransform(
     return;
   }
 
+  std::lock_guard<std::mutex> lock(latest_tf_mutex_);
   tf2::impl::Converter<true, false>::convert(odom_to_map.pose, latest_tf_);
   latest_tf_valid_ = true;
 }
@@ -1026,14 +1120,46 @@ AmclNode::sendMapToOdomTransform(const tf2::TimePoint & transform_expiration)
 {
   // AMCL will update transform only when it has knowledge about robot's initial position
   if (!initial_pose_is_known_) {return;}
+  tf2::Transform latest_tf;
+  {
+    std::lock_guard<std::mutex> lock(latest_tf_mutex_);
+    latest_tf = latest_tf_;
+  }
   geometry_msgs::msg::TransformStamped tmp_tf_stamped;
   tmp_tf_stamped.header.frame_id = global_frame_id_;
   tmp_tf_stamped.header.stamp = tf2_ros::toMsg(transform_expiration);
   tmp_tf_stamped.child_frame_id = odom_frame_id_;
-  tf2::impl::Converter<false, true>::convert(latest_tf_.inverse(), tmp_tf_stamped.transform);
+  tf2::impl::Converter<false, true>::convert(latest_tf.inverse(), tmp_tf_stamped.transform);
   tf_broadcaster_->sendTransform(tmp_tf_stamped);
 }
 
+void
+AmclNode::tfPublishLoop()
+{
+  // Latest-wins slot: the laser callback only updates latest_tf_, while this
+  // thread re-stamps and re-broadcasts it at a fixed rate. Consumers compose
+  // the slowly varying map->odom correction with live odometry, so the
+  // transform tree stays fresh even when a filter update (e.g. during global
+  // relocalization) takes longer than the scan period.
+  const auto period = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::duration<double>(1.0 / tf_broadcast_rate_));
+  while (tf_publish_thread_running_ && rclcpp::ok()) {
+    std::this_thread::sleep_for(period);
+    {
+      std::lock_guard<std::mutex> lock(latest_tf_mutex_);
+      if (!latest_tf_valid_) {
+        continue;
+      }
+    }
+    if (!sent_first_transform_) {
+      continue;
+    }
+    tf2::TimePoint transform_expiration =
+      tf2_ros::fromMsg(now()) + transform_tolerance_;
+    sendMapToOdomTransform(transform_expiration);
+  }
+}
+
 nav2_amcl::Laser *
 AmclNode::createLaserObject()
 {
@@ -1063,6 +1189,9 @@ AmclNode::initParameters()
   double save_pose_rate;
   double tmp_tol;
 
+  get_parameter("adaptive_population", adaptive_population_);
+  get_parameter("adaptive_scan_decimation", adaptive_scan_decimation_);
+  get_parameter("adaptive_scan_spread", adaptive_scan_spread_);
   get_parameter("alpha1", alpha1_);
   get_parameter("alpha2", alpha2_);
   get_parameter("alpha3", alpha3_);
@@ -1073,6 +1202,7 @@ AmclNode::initParameters()
   get_parameter("beam_skip_error_threshold", beam_skip_error_threshold_);
   get_parameter("beam_skip_threshold", beam_skip_threshold_);
   get_parameter("do_beamskip", do_beamskip_);
+  get_parameter("distance_map_cache_dir", distance_map_cache_dir_);
   get_parameter("global_frame_id", global_frame_id_);
   get_parameter("lambda_short", lambda_short_);
   get_parameter("laser_likelihood_max_dist", laser_likelihood_max_dist_);
@@ -1088,15 +1218,18 @@ AmclNode::initParameters()
   get_parameter("max_particles", max_particles_);
   get_parameter("min_particles", min_particles_);
   get_parameter("odom_frame_id", odom_frame_id_);
+  get_parameter("particle_filter_threads", particle_filter_threads_);
   get_parameter("pf_err", pf_err_);
   get_parameter("pf_z", pf_z_);
   get_parameter("recovery_alpha_fast", alpha_fast_);
   get_parameter("recovery_alpha_slow", alpha_slow_);
   get_parameter("resample_interval", resample_interval_);
   get_parameter("robot_model_type", robot_model_type_);
+  get_parameter("selective_resampling", selective_resampling_);
   get_parameter("save_pose_rate", save_pose_rate);
   get_parameter("sigma_hit", sigma_hit_);
   get_parameter("tf_broadcast", tf_broadcast_);
+  get_parameter("tf_broadcast_rate", tf_broadcast_rate_);
   get_parameter("transform_tolerance", tmp_tol);
   get_parameter("update_min_a", a_thresh_);
   get_parameter("update_min_d", d_thresh_);
@@ -1147,6 +1280,13 @@ AmclNode::initParameters()
     max_particles_ = min_particles_;
   }
 
+  if (tf_broadcast_rate_ < 0) {
+    RCLCPP_WARN(
+      get_logger(), "You've set tf_broadcast_rate to be negative,"
+      " periodic transform re-broadcasting will be disabled.");
+    tf_broadcast_rate_ = 0.0;
+  }
+
   if (resample_interval_ <= 0) {
     RCLCPP_WARN(
       get_logger(), "You've set resample_interval to be zero or negative,"
@@ -1157,6 +1297,9 @@ AmclNode::initParameters()
   if (always_reset_initial_pose_) {
     initial_pose_is_known_ = false;
   }
+
+  ParticleWorkers::instance().setThreadCount(particle_filter_threads_);
+  map_set_cspace_cache_dir(distance_map_cache_dir_.c_str());
 }
 
 /**
@@ -1185,7 +1328,9 @@ AmclNode::dynamicParametersCallback(
     const auto & param_name = parameter.get_name();
 
     if (param_type == ParameterType::PARAMETER_DOUBLE) {
-      if (param_name == "alpha1") {
+      if (param_name == "adaptive_scan_spread") {
+        adaptive_scan_spread_ = parameter.as_double();
+      } else if (param_name == "alpha1") {
         alpha1_ = parameter.as_double();
         // alpha restricted to be non-negative
         if (alpha1_ < 0.0) {
@@ -1298,6 +1443,9 @@ AmclNode::dynamicParametersCallback(
     } else if (param_type == ParameterType::PARAMETER_STRING) {
       if (param_name == "base_frame_id") {
         base_frame_id_ = parameter.as_string();
+      } else if (param_name == "distance_map_cache_dir") {
+        distance_map_cache_dir_ = parameter.as_string();
+        map_set_cspace_cache_dir(distance_map_cache_dir_.c_str());
       } else if (param_name == "global_frame_id") {
         global_frame_id_ = parameter.as_string();
       } else if (param_name == "map_topic") {
@@ -1317,7 +1465,14 @@ AmclNode::dynamicParametersCallback(
         reinit_odom = true;
       }
     } else if (param_type == ParameterType::PARAMETER_BOOL) {
-      if (param_name == "do_beamskip") {
+      if (param_name == "adaptive_population") {
+        adaptive_population_ = parameter.as_bool();
+        if (pf_ != NULL) {
+          pf_->adaptive_population = adaptive_population_ ? 1 : 0;
+        }
+      } else if (param_name == "adaptive_scan_decimation") {
+        adaptive_scan_decimation_ = parameter.as_bool();
+      } else if (param_name == "do_beamskip") {
         do_beamskip_ = parameter.as_bool();
         reinit_laser = true;
       } else if (param_name == "tf_broadcast") {
@@ -1326,6 +1481,11 @@ AmclNode::dynamicParametersCallback(
         set_initial_pose_ = parameter.as_bool();
       } else if (param_name == "first_map_only") {
         first_map_only_ = parameter.as_bool();
+      } else if (param_name == "selective_resampling") {
+        selective_resampling_ = parameter.as_bool();
+        if (pf_ != NULL) {
+          pf_->selective_resampling = selective_resampling_ ? 1 : 0;
+        }
       }
     } else if (param_type == ParameterType::PARAMETER_INTEGER) {
       if (param_name == "max_beams") {
@@ -1339,6 +1499,9 @@ AmclNode::dynamicParametersCallback(
         reinit_pf = true;
       } else if (param_name == "resample_interval") {
         resample_interval_ = parameter.as_int();
+      } else if (param_name == "particle_filter_threads") {
+        particle_filter_threads_ = parameter.as_int();
+        ParticleWorkers::instance().setThreadCount(particle_filter_threads_);
       }
     }
   }
@@ -1375,6 +1538,8 @@ AmclNode::dynamicParametersCallback(
   if (reinit_laser) {
     lasers_.clear();
     lasers_update_.clear();
+    scan_geometries_.clear();
+    laser_data_.clear();
     frame_to_laser_.clear();
     laser_scan_connection_.disconnect();
     laser_scan_filter_.reset();
@@ -1463,6 +1628,8 @@ AmclNode::freeMapDependentMemory()
   // map, #5202.
   lasers_.clear();
   lasers_update_.clear();
+  scan_geometries_.clear();
+  laser_data_.clear();
   frame_to_laser_.clear();
 }
 
@@ -1617,6 +1784,8 @@ AmclNode::initParticleFilter()
     (pf_init_model_fn_t)AmclNode::uniformPoseGenerator);
   pf_->pop_err = pf_err_;
   pf_->pop_z = pf_z_;
+  pf_->selective_resampling = selective_resampling_ ? 1 : 0;
+  pf_->adaptive_population = adaptive_population_ ? 1 : 0;
 
   // Initialize the filter
   pf_vector_t pf_init_pose_mean = pf_vector_zero();
@@ -49,6 +49,9 @@ map_t * map_alloc(void)
   // Allocate storage for main map
   map->cells = (map_cell_t *) NULL;
 
+  // The ray-cast cache is built lazily by the beam model
+  map->range_cache = NULL;
+
   return map;
 }
 
@@ -56,6 +59,7 @@ map_t * map_alloc(void)
 // Destroy a map
 void map_free(map_t * map)
 {
+  map_range_cache_free(map);
   free(map->cells);
   free(map);
 }
@@ -19,9 +19,17 @@
  *
  */
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
 #include <cstring>
 #include <queue>
+#include <string>
 #include "nav2_amcl/map/map.hpp"
 
 /*
@@ -144,6 +152,138 @@ void enqueue(
   marked[MAP_INDEX(map, i, j)] = 1;
 }
 
+// Directory holding persisted distance maps; empty disables the cache
+static std::string cache_dir;
+
+/*
+ * @brief Header of a persisted distance map, validated before the
+ * distances are trusted
+ */
+struct CspaceCacheHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  int32_t size_x, size_y;
+  double scale;
+  double max_occ_dist;
+  uint64_t occ_hash;
+};
+
+static const uint32_t cspace_cache_magic = 0x4c434d41;  // "AMCL"
+static const uint32_t cspace_cache_version = 1;
+
+/*
+ * @brief Hash the occupancy states so a cached distance map is only
+ * reused for the exact grid it was computed from
+ */
+static uint64_t map_occ_hash(map_t * map)
+{
+  // FNV-1a over the occupancy states
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (int i = 0; i < map->size_x * map->size_y; i++) {
+    hash ^= (uint64_t)(uint8_t)map->cells[i].occ_state;
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+/*
+ * @brief Path of the cache file for the given occupancy hash
+ */
+static std::string map_cspace_cache_path(uint64_t occ_hash)
+{
+  char name[64];
+  snprintf(name, sizeof(name), "/cspace_%016llx.bin", (unsigned long long)occ_hash);
+  return cache_dir + name;
+}
+
+/*
+ * @brief Fill the cell distances from a persisted distance map
+ * @return true if a valid cache entry was loaded
+ */
+static bool map_load_cspace_cache(map_t * map, double max_occ_dist, uint64_t occ_hash)
+{
+  int fd = open(map_cspace_cache_path(occ_hash).c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+
+  size_t expected_size = sizeof(CspaceCacheHeader) +
+    sizeof(float) * map->size_x * map->size_y;
+  struct stat sb;
+  if (fstat(fd, &sb) != 0 || (size_t)sb.st_size != expected_size) {
+    close(fd);
+    return false;
+  }
+
+  void * addr = mmap(NULL, expected_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    return false;
+  }
+
+  const CspaceCacheHeader * header = (const CspaceCacheHeader *)addr;
+  bool valid = header->magic == cspace_cache_magic &&
+    header->version == cspace_cache_version &&
+    header->size_x == map->size_x &&
+    header->size_y == map->size_y &&
+    header->scale == map->scale &&
+    header->max_occ_dist == max_occ_dist &&
+    header->occ_hash == occ_hash;
+
+  if (valid) {
+    const float * distances = (const float *)(header + 1);
+    for (int i = 0; i < map->size_x * map->size_y; i++) {
+      map->cells[i].occ_dist = distances[i];
+    }
+  }
+
+  munmap(addr, expected_size);
+  return valid;
+}
+
+/*
+ * @brief Persist the computed cell distances, written to a temporary
+ * file and renamed so readers never see a partial entry
+ */
+static void map_save_cspace_cache(map_t * map, double max_occ_dist, uint64_t occ_hash)
+{
+  std::string path = map_cspace_cache_path(occ_hash);
+  std::string tmp_path = path + ".tmp";
+  FILE * file = fopen(tmp_path.c_str(), "wb");
+  if (!file) {
+    return;
+  }
+
+  CspaceCacheHeader header;
+  memset(&header, 0, sizeof(header));
+  header.magic = cspace_cache_magic;
+  header.version = cspace_cache_version;
+  header.size_x = map->size_x;
+  header.size_y = map->size_y;
+  header.scale = map->scale;
+  header.max_occ_dist = max_occ_dist;
+  header.occ_hash = occ_hash;
+
+  bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+  for (int i = 0; ok && i < map->size_x * map->size_y; i++) {
+    ok = fwrite(&map->cells[i].occ_dist, sizeof(float), 1, file) == 1;
+  }
+
+  if (fclose(file) != 0 || !ok || rename(tmp_path.c_str(), path.c_str()) != 0) {
+    unlink(tmp_path.c_str());
+  }
+}
+
+/*
+ * @brief Set the directory holding persisted distance maps
+ * @param dir Directory path, or empty/NULL to disable the cache
+ */
+void map_set_cspace_cache_dir(const char * dir)
+{
+  cache_dir = dir ? dir : "";
+}
+
 /*
  * @brief Update the cspace distance values
  * @param map Map to update
@@ -154,11 +294,21 @@ void map_update_cspace(map_t * map, double max_occ_dist)
   unsigned char * marked;
   std::priority_queue<CellData> Q;
 
+  map->max_occ_dist = max_occ_dist;
+
+  // Reuse a persisted distance map rather than re-running the propagation
+  // when this exact grid has been seen before
+  uint64_t occ_hash = 0;
+  if (!cache_dir.empty()) {
+    occ_hash = map_occ_hash(map);
+    if (map_load_cspace_cache(map, max_occ_dist, occ_hash)) {
+      return;
+    }
+  }
+
   marked = new unsigned char[map->size_x * map->size_y];
   memset(marked, 0, sizeof(unsigned char) * map->size_x * map->size_y);
 
-  map->max_occ_dist = max_occ_dist;
-
   CachedDistanceMap * cdm = get_distance_map(map->scale, map->max_occ_dist);
 
   // Enqueue all the obstacle cells
@@ -209,4 +359,8 @@ void map_update_cspace(map_t * map, double max_occ_dist)
   }
 
   delete[] marked;
+
+  if (!cache_dir.empty()) {
+    map_save_cspace_cache(map, max_occ_dist, occ_hash);
+  }
 }
@@ -26,15 +26,127 @@
 **************************************************************************/
 
 #include <math.h>
+#include <stdatomic.h>
+#include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
 
 #include "nav2_amcl/map/map.hpp"
 
+// Number of bearing bins in the ray-cast cache
+#define MAP_RANGE_CACHE_ANGLES 2048
+
+// Number of direct-mapped cache slots (power of two)
+#define MAP_RANGE_CACHE_SLOTS (1 << 20)
+
+// A direct-mapped cache of traced ranges, keyed by the origin cell and a
+// discretized bearing so all particles in the same bin share one trace.
+// Each slot packs the range bits with a key fingerprint into a single
+// word, read and written relaxed, so concurrent sensor shards never see
+// a range paired with the wrong key.
+typedef struct _map_range_cache_t
+{
+  double max_range;
+  _Atomic uint64_t * slots;
+} map_range_cache_t;
+
+// Trace a single ray through the map (the uncached path)
+static double map_trace_range(map_t * map, double ox, double oy, double oa, double max_range);
+
+
+// Prepare the shared ray-cast cache for lookups at the given max range
+void map_range_cache_prepare(map_t * map, double max_range)
+{
+  map_range_cache_t * cache;
+
+  if (map->range_cache == NULL) {
+    cache = calloc(1, sizeof(map_range_cache_t));
+    cache->slots = calloc(MAP_RANGE_CACHE_SLOTS, sizeof(cache->slots[0]));
+    cache->max_range = max_range;
+    map->range_cache = cache;
+    return;
+  }
+
+  // Cached ranges were traced against the old max range; start over
+  cache = map->range_cache;
+  if (cache->max_range != max_range) {
+    memset(cache->slots, 0, MAP_RANGE_CACHE_SLOTS * sizeof(cache->slots[0]));
+    cache->max_range = max_range;
+  }
+}
+
+
+// Destroy the ray-cast cache, if any
+void map_range_cache_free(map_t * map)
+{
+  if (map->range_cache) {
+    free(map->range_cache->slots);
+    free(map->range_cache);
+    map->range_cache = NULL;
+  }
+}
+
+
 // Extract a single range reading from the map.  Unknown cells and/or
 // out-of-bound cells are treated as occupied, which makes it easy to
 // use Stage bitmap files.
 double map_calc_range(map_t * map, double ox, double oy, double oa, double max_range)
+{
+  map_range_cache_t * cache;
+  int ci, cj, bin;
+  uint64_t key, mix, word;
+  uint32_t fingerprint, slot;
+  float range;
+  double a;
+
+  cache = map->range_cache;
+  ci = MAP_GXWX(map, ox);
+  cj = MAP_GYWY(map, oy);
+  if (cache == NULL || cache->max_range != max_range || !MAP_VALID(map, ci, cj)) {
+    return map_trace_range(map, ox, oy, oa, max_range);
+  }
+
+  a = fmod(oa, 2 * M_PI);
+  if (a < 0) {
+    a += 2 * M_PI;
+  }
+  bin = (int)(a * (MAP_RANGE_CACHE_ANGLES / (2 * M_PI)));
+  if (bin >= MAP_RANGE_CACHE_ANGLES) {
+    bin = MAP_RANGE_CACHE_ANGLES - 1;
+  }
+
+  key = (uint64_t)MAP_INDEX(map, ci, cj) * MAP_RANGE_CACHE_ANGLES + bin;
+  mix = key * 0x9e3779b97f4a7c15ull;
+  slot = (uint32_t)(mix >> 32) & (MAP_RANGE_CACHE_SLOTS - 1);
+  fingerprint = (uint32_t)mix;
+  if (fingerprint == 0) {
+    fingerprint = 1;
+  }
+
+  word = atomic_load_explicit(cache->slots + slot, memory_order_relaxed);
+  if ((uint32_t)word == fingerprint) {
+    uint32_t bits = (uint32_t)(word >> 32);
+    memcpy(&range, &bits, sizeof(range));
+    return range;
+  }
+
+  // Miss: trace from the cell center at the bin center angle so every
+  // pose falling in this bin shares the result
+  range = (float)map_trace_range(
+    map, MAP_WXGX(map, ci), MAP_WYGY(map, cj),
+    (bin + 0.5) * (2 * M_PI / MAP_RANGE_CACHE_ANGLES), max_range);
+
+  uint32_t bits;
+  memcpy(&bits, &range, sizeof(bits));
+  word = ((uint64_t)bits << 32) | fingerprint;
+  atomic_store_explicit(cache->slots + slot, word, memory_order_relaxed);
+
+  return range;
+}
+
+
+// Trace a single ray through the map (the uncached path)
+double map_trace_range(map_t * map, double ox, double oy, double oa, double max_range)
 {
   // Bresenham raytracing
   int x0, x1, y0, y1;
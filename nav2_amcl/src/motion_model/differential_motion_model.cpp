@@ -19,11 +19,15 @@
  *
  */
 
+#include <array>
 #include <cmath>
+#include <vector>
 
 #include "nav2_amcl/angleutils.hpp"
 #include "nav2_amcl/motion_model/differential_motion_model.hpp"
+#include "nav2_amcl/particle_workers.hpp"
 #include "nav2_amcl/pf/pf_pdf.hpp"
+#include "nav2_amcl/portable_utils.hpp"
 
 namespace nav2_amcl
 {
@@ -53,7 +57,6 @@ DifferentialMotionModel::odometryUpdate(
 
   // Implement sample_motion_odometry (Prob Rob p 136)
   double delta_rot1, delta_trans, delta_rot2;
-  double delta_rot1_hat, delta_trans_hat, delta_rot2_hat;
   double delta_rot1_noise, delta_rot2_noise;
 
   // Avoid computing a bearing from two poses that are extremely near each
@@ -83,36 +86,57 @@ DifferentialMotionModel::odometryUpdate(
     fabs(angleutils::angle_diff(delta_rot2, 0.0)),
     fabs(angleutils::angle_diff(delta_rot2, M_PI)));
 
-  for (int i = 0; i < set->sample_count; i++) {
-    pf_sample_t * sample = set->samples + i;
-
-    // Sample pose differences
-    delta_rot1_hat = angleutils::angle_diff(
-      delta_rot1,
-      pf_ran_gaussian(
-        sqrt(
-          alpha1_ * delta_rot1_noise * delta_rot1_noise +
-          alpha2_ * delta_trans * delta_trans)));
-    delta_trans_hat = delta_trans -
-      pf_ran_gaussian(
-      sqrt(
-        alpha3_ * delta_trans * delta_trans +
-        alpha4_ * delta_rot1_noise * delta_rot1_noise +
-        alpha4_ * delta_rot2_noise * delta_rot2_noise));
-    delta_rot2_hat = angleutils::angle_diff(
-      delta_rot2,
-      pf_ran_gaussian(
-        sqrt(
-          alpha1_ * delta_rot2_noise * delta_rot2_noise +
-          alpha2_ * delta_trans * delta_trans)));
-
-    // Apply sampled update to particle pose
-    sample->pose.v[0] += delta_trans_hat *
-      cos(sample->pose.v[2] + delta_rot1_hat);
-    sample->pose.v[1] += delta_trans_hat *
-      sin(sample->pose.v[2] + delta_rot1_hat);
-    sample->pose.v[2] += delta_rot1_hat + delta_rot2_hat;
+  // The noise deviations are the same for every particle of the update
+  double rot1_hat_stddev = sqrt(
+    alpha1_ * delta_rot1_noise * delta_rot1_noise +
+    alpha2_ * delta_trans * delta_trans);
+  double trans_hat_stddev = sqrt(
+    alpha3_ * delta_trans * delta_trans +
+    alpha4_ * delta_rot1_noise * delta_rot1_noise +
+    alpha4_ * delta_rot2_noise * delta_rot2_noise);
+  double rot2_hat_stddev = sqrt(
+    alpha1_ * delta_rot2_noise * delta_rot2_noise +
+    alpha2_ * delta_trans * delta_trans);
+
+  // Sample the new poses, ranges of particles sharded across threads with a
+  // reentrant random stream per shard so sampling stays race free
+  ParticleWorkers & workers = ParticleWorkers::instance();
+  std::vector<std::array<unsigned short, 3>> streams(workers.getThreadCount());
+  for (auto & stream : streams) {
+    stream[0] = static_cast<unsigned short>(lrand48());
+    stream[1] = static_cast<unsigned short>(lrand48());
+    stream[2] = static_cast<unsigned short>(lrand48());
   }
+
+  workers.forEachRange(
+    set->sample_count,
+    [&](int begin, int end, int shard) {
+      unsigned short * xsubi = streams[shard].data();
+      double delta_rot1_hat, delta_trans_hat, delta_rot2_hat;
+
+      // Draw the noise for the whole particle range in batched passes
+      const int count = end - begin;
+      std::vector<double> rot1_noise(count), trans_noise(count), rot2_noise(count);
+      pf_ran_gaussian_fill_r(rot1_hat_stddev, rot1_noise.data(), count, xsubi);
+      pf_ran_gaussian_fill_r(trans_hat_stddev, trans_noise.data(), count, xsubi);
+      pf_ran_gaussian_fill_r(rot2_hat_stddev, rot2_noise.data(), count, xsubi);
+
+      for (int i = begin; i < end; i++) {
+        pf_sample_t * sample = set->samples + i;
+
+        // Sample pose differences
+        delta_rot1_hat = angleutils::angle_diff(delta_rot1, rot1_noise[i - begin]);
+        delta_trans_hat = delta_trans - trans_noise[i - begin];
+        delta_rot2_hat = angleutils::angle_diff(delta_rot2, rot2_noise[i - begin]);
+
+        // Apply sampled update to particle pose
+        sample->pose.v[0] += delta_trans_hat *
+          cos(sample->pose.v[2] + delta_rot1_hat);
+        sample->pose.v[1] += delta_trans_hat *
+          sin(sample->pose.v[2] + delta_rot1_hat);
+        sample->pose.v[2] += delta_rot1_hat + delta_rot2_hat;
+      }
+    });
 }
 
 }  // namespace nav2_amcl
@@ -19,12 +19,16 @@
  *
  */
 
+#include <array>
 #include <cmath>
+#include <vector>
 
 #include "nav2_amcl/angleutils.hpp"
 #include "nav2_amcl/motion_model/omni_motion_model.hpp"
+#include "nav2_amcl/particle_workers.hpp"
 #include "nav2_amcl/pf/pf_pdf.hpp"
 #include "nav2_amcl/pf/pf_vector.hpp"
+#include "nav2_amcl/portable_utils.hpp"
 
 namespace nav2_amcl
 {
@@ -52,8 +56,7 @@ OmniMotionModel::odometryUpdate(
   set = pf->sets + pf->current_set;
   pf_vector_t old_pose = pf_vector_sub(pose, delta);
 
-  double delta_trans, delta_rot, delta_bearing;
-  double delta_trans_hat, delta_rot_hat, delta_strafe_hat;
+  double delta_trans, delta_rot;
 
   delta_trans = sqrt(
     delta.v[0] * delta.v[0] +
@@ -71,26 +74,51 @@ OmniMotionModel::odometryUpdate(
     alpha4_ * (delta_rot * delta_rot) +
     alpha5_ * (delta_trans * delta_trans) );
 
-  for (int i = 0; i < set->sample_count; i++) {
-    pf_sample_t * sample = set->samples + i;
-
-    delta_bearing = angleutils::angle_diff(
-      atan2(delta.v[1], delta.v[0]),
-      old_pose.v[2]) + sample->pose.v[2];
-    double cs_bearing = cos(delta_bearing);
-    double sn_bearing = sin(delta_bearing);
-
-    // Sample pose differences
-    delta_trans_hat = delta_trans + pf_ran_gaussian(trans_hat_stddev);
-    delta_rot_hat = delta_rot + pf_ran_gaussian(rot_hat_stddev);
-    delta_strafe_hat = 0 + pf_ran_gaussian(strafe_hat_stddev);
-    // Apply sampled update to particle pose
-    sample->pose.v[0] += (delta_trans_hat * cs_bearing +
-      delta_strafe_hat * sn_bearing);
-    sample->pose.v[1] += (delta_trans_hat * sn_bearing -
-      delta_strafe_hat * cs_bearing);
-    sample->pose.v[2] += delta_rot_hat;
+  // Sample the new poses, ranges of particles sharded across threads with a
+  // reentrant random stream per shard so sampling stays race free
+  ParticleWorkers & workers = ParticleWorkers::instance();
+  std::vector<std::array<unsigned short, 3>> streams(workers.getThreadCount());
+  for (auto & stream : streams) {
+    stream[0] = static_cast<unsigned short>(lrand48());
+    stream[1] = static_cast<unsigned short>(lrand48());
+    stream[2] = static_cast<unsigned short>(lrand48());
   }
+
+  workers.forEachRange(
+    set->sample_count,
+    [&](int begin, int end, int shard) {
+      unsigned short * xsubi = streams[shard].data();
+      double delta_bearing;
+      double delta_trans_hat, delta_rot_hat, delta_strafe_hat;
+
+      // Draw the noise for the whole particle range in batched passes
+      const int count = end - begin;
+      std::vector<double> trans_noise(count), rot_noise(count), strafe_noise(count);
+      pf_ran_gaussian_fill_r(trans_hat_stddev, trans_noise.data(), count, xsubi);
+      pf_ran_gaussian_fill_r(rot_hat_stddev, rot_noise.data(), count, xsubi);
+      pf_ran_gaussian_fill_r(strafe_hat_stddev, strafe_noise.data(), count, xsubi);
+
+      for (int i = begin; i < end; i++) {
+        pf_sample_t * sample = set->samples + i;
+
+        delta_bearing = angleutils::angle_diff(
+          atan2(delta.v[1], delta.v[0]),
+          old_pose.v[2]) + sample->pose.v[2];
+        double cs_bearing = cos(delta_bearing);
+        double sn_bearing = sin(delta_bearing);
+
+        // Sample pose differences
+        delta_trans_hat = delta_trans + trans_noise[i - begin];
+        delta_rot_hat = delta_rot + rot_noise[i - begin];
+        delta_strafe_hat = 0 + strafe_noise[i - begin];
+        // Apply sampled update to particle pose
+        sample->pose.v[0] += (delta_trans_hat * cs_bearing +
+          delta_strafe_hat * sn_bearing);
+        sample->pose.v[1] += (delta_trans_hat * sn_bearing -
+          delta_strafe_hat * cs_bearing);
+        sample->pose.v[2] += delta_rot_hat;
+      }
+    });
 }
 
 }  // namespace nav2_amcl
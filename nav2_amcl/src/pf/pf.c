@@ -33,7 +33,7 @@
 
 #include "nav2_amcl/pf/pf.hpp"
 #include "nav2_amcl/pf/pf_pdf.hpp"
-#include "nav2_amcl/pf/pf_kdtree.hpp"
+#include "nav2_amcl/pf/pf_histogram.hpp"
 
 #include "nav2_amcl/portable_utils.hpp"
 
@@ -71,6 +71,8 @@ pf_t * pf_alloc(
   pf->pop_err = 0.01;
   pf->pop_z = 3;
   pf->dist_threshold = 0.5;
+  pf->selective_resampling = 0;
+  pf->adaptive_population = 0;
 
   pf->current_set = 0;
   for (j = 0; j < 2; j++) {
@@ -88,7 +90,7 @@ pf_t * pf_alloc(
     }
 
     // HACK: is 3 times max_samples enough?
-    set->kdtree = pf_kdtree_alloc(3 * max_samples);
+    set->histogram = pf_histogram_alloc(3 * max_samples);
 
     set->cluster_count = 0;
     set->cluster_max_count = max_samples;
@@ -117,7 +119,7 @@ void pf_free(pf_t * pf)
 
   for (i = 0; i < 2; i++) {
     free(pf->sets[i].clusters);
-    pf_kdtree_free(pf->sets[i].kdtree);
+    pf_histogram_free(pf->sets[i].histogram);
     free(pf->sets[i].samples);
   }
   free(pf);
@@ -133,8 +135,8 @@ void pf_init(pf_t * pf, pf_vector_t mean, pf_matrix_t cov)
 
   set = pf->sets + pf->current_set;
 
-  // Create the kd tree for adaptive sampling
-  pf_kdtree_clear(set->kdtree);
+  // Reset the histogram for adaptive sampling
+  pf_histogram_clear(set->histogram);
 
   set->sample_count = pf->max_samples;
 
@@ -147,7 +149,7 @@ void pf_init(pf_t * pf, pf_vector_t mean, pf_matrix_t cov)
     sample->pose = pf_pdf_gaussian_sample(pdf);
 
     // Add sample to histogram
-    pf_kdtree_insert(set->kdtree, sample->pose, sample->weight);
+    pf_histogram_insert(set->histogram, sample->pose, sample->weight);
   }
 
   pf->w_slow = pf->w_fast = 0.0;
@@ -171,8 +173,8 @@ void pf_init_model(pf_t * pf, pf_init_model_fn_t init_fn, void * init_data)
 
   set = pf->sets + pf->current_set;
 
-  // Create the kd tree for adaptive sampling
-  pf_kdtree_clear(set->kdtree);
+  // Reset the histogram for adaptive sampling
+  pf_histogram_clear(set->histogram);
 
   set->sample_count = pf->max_samples;
 
@@ -183,7 +185,7 @@ void pf_init_model(pf_t * pf, pf_init_model_fn_t init_fn, void * init_data)
     sample->pose = (*init_fn)(init_data);
 
     // Add sample to histogram
-    pf_kdtree_insert(set->kdtree, sample->pose, sample->weight);
+    pf_histogram_insert(set->histogram, sample->pose, sample->weight);
   }
 
   pf->w_slow = pf->w_fast = 0.0;
@@ -292,32 +294,49 @@ void pf_update_sensor(pf_t * pf, pf_sensor_model_fn_t sensor_fn, void * sensor_d
 // Resample the distribution
 void pf_update_resample(pf_t * pf, void * random_pose_data)
 {
-  int i;
+  int i, m;
+  int target_count;
   double total;
   pf_sample_set_t * set_a, * set_b;
   pf_sample_t * sample_a, * sample_b;
 
-  // double r,c,U;
-  // int m;
-  // double count_inv;
-  double * c;
-
+  double r, cum, step;
+  double total_a;
   double w_diff;
 
   set_a = pf->sets + pf->current_set;
   set_b = pf->sets + (pf->current_set + 1) % 2;
 
-  // Build up cumulative probability table for resampling.
-  // TODO(?): Replace this with a more efficient procedure
-  // (e.g., http://www.network-theory.co.uk/docs/gslref/GeneralDiscreteDistributions.html)
-  c = (double *)malloc(sizeof(double) * (set_a->sample_count + 1));
-  c[0] = 0.0;
+  // Skip resampling while the effective sample size is still high; the
+  // variance resampling introduces is only worth paying once the weights
+  // have degenerated
+  if (pf->selective_resampling) {
+    double sum_sq = 0.0;
+    total_a = 0.0;
+    for (i = 0; i < set_a->sample_count; i++) {
+      total_a += set_a->samples[i].weight;
+      sum_sq += set_a->samples[i].weight * set_a->samples[i].weight;
+    }
+    if (sum_sq > 0.0 &&
+      (total_a * total_a) / sum_sq > 0.5 * set_a->sample_count)
+    {
+      return;
+    }
+  }
+
+  // Determine the sample count from the KLD bound over the bins the
+  // current samples occupy, so the systematic pass below knows how many
+  // samples to draw up front
+  pf_histogram_clear(set_b->histogram);
+  total_a = 0.0;
   for (i = 0; i < set_a->sample_count; i++) {
-    c[i + 1] = c[i] + set_a->samples[i].weight;
+    total_a += set_a->samples[i].weight;
+    pf_histogram_insert(set_b->histogram, set_a->samples[i].pose, set_a->samples[i].weight);
   }
+  target_count = pf_resample_limit(pf, set_b->histogram->bin_count);
 
-  // Create the kd tree for adaptive sampling
-  pf_kdtree_clear(set_b->kdtree);
+  // Reset the histogram for adaptive sampling
+  pf_histogram_clear(set_b->histogram);
 
   // Draw samples from set a to create set b.
   total = 0;
@@ -329,60 +348,26 @@ void pf_update_resample(pf_t * pf, void * random_pose_data)
   }
   // printf("w_diff: %9.6f\n", w_diff);
 
-  // Can't (easily) combine low-variance sampler with KLD adaptive
-  // sampling, so we'll take the more traditional route.
-  /*
-  // Low-variance resampler, taken from Probabilistic Robotics, p110
-  count_inv = 1.0/set_a->sample_count;
-  r = drand48() * count_inv;
-  c = set_a->samples[0].weight;
+  // Systematic (low-variance) resampler, taken from Probabilistic
+  // Robotics, p110: a single random offset and evenly spaced pointers
+  // sweep the cumulative weights once, O(n) overall
+  step = total_a / target_count;
+  r = drand48() * step;
+  cum = set_a->samples[0].weight;
   i = 0;
-  m = 0;
-  */
-  while (set_b->sample_count < pf->max_samples) {
+
+  for (m = 0; m < target_count; m++) {
     sample_b = set_b->samples + set_b->sample_count++;
 
     if (drand48() < w_diff) {
       sample_b->pose = (pf->random_pose_fn)(random_pose_data);
     } else {
-      // Can't (easily) combine low-variance sampler with KLD adaptive
-      // sampling, so we'll take the more traditional route.
-      /*
-      // Low-variance resampler, taken from Probabilistic Robotics, p110
-      U = r + m * count_inv;
-      while(U>c)
-      {
+      while (r + m * step > cum && i < set_a->sample_count - 1) {
         i++;
-        // Handle wrap-around by resetting counters and picking a new random
-        // number
-        if(i >= set_a->sample_count)
-        {
-          r = drand48() * count_inv;
-          c = set_a->samples[0].weight;
-          i = 0;
-          m = 0;
-          U = r + m * count_inv;
-          continue;
-        }
-        c += set_a->samples[i].weight;
+        cum += set_a->samples[i].weight;
       }
-      m++;
-      */
-
-      // Naive discrete event sampler
-      double r;
-      r = drand48();
-      for (i = 0; i < set_a->sample_count; i++) {
-        if ((c[i] <= r) && (r < c[i + 1])) {
-          break;
-        }
-      }
-      assert(i < set_a->sample_count);
-
       sample_a = set_a->samples + i;
 
-      assert(sample_a->weight > 0);
-
       // Add sample to list
       sample_b->pose = sample_a->pose;
     }
@@ -391,12 +376,7 @@ void pf_update_resample(pf_t * pf, void * random_pose_data)
     total += sample_b->weight;
 
     // Add sample to histogram
-    pf_kdtree_insert(set_b->kdtree, sample_b->pose, sample_b->weight);
-
-    // See if we have enough samples yet
-    if (set_b->sample_count > pf_resample_limit(pf, set_b->kdtree->leaf_count)) {
-      break;
-    }
+    pf_histogram_insert(set_b->histogram, sample_b->pose, sample_b->weight);
   }
 
   // Reset averages, to avoid spiraling off into complete randomness.
@@ -419,8 +399,107 @@ void pf_update_resample(pf_t * pf, void * random_pose_data)
   pf->current_set = (pf->current_set + 1) % 2;
 
   pf_update_converged(pf);
+}
+
+
+// Resize the population between resampling passes.  The KLD bound that
+// pf_update_resample applies only when it runs is evaluated against the
+// bins the current samples occupy; when the bound sits well below the
+// current population and the weights are still healthy, a systematic
+// pass shrinks the set, and when the occupied bins spread out again the
+// set grows back toward the bound.
+void pf_update_population(pf_t * pf)
+{
+  int i, m;
+  int target_count;
+  double total, sum_sq, ess;
+  double r, cum, step;
+  pf_sample_set_t * set_a, * set_b;
+  pf_sample_t * sample_a, * sample_b;
+
+  if (!pf->adaptive_population) {
+    return;
+  }
+
+  set_a = pf->sets + pf->current_set;
+  set_b = pf->sets + (pf->current_set + 1) % 2;
+
+  if (set_a->sample_count < 2) {
+    return;
+  }
+
+  total = 0.0;
+  sum_sq = 0.0;
+  for (i = 0; i < set_a->sample_count; i++) {
+    total += set_a->samples[i].weight;
+    sum_sq += set_a->samples[i].weight * set_a->samples[i].weight;
+  }
+  if (total <= 0.0 || sum_sq <= 0.0) {
+    return;
+  }
+  ess = (total * total) / sum_sq;
 
-  free(c);
+  // Required count from the KLD bound over the occupied bins
+  pf_histogram_clear(set_b->histogram);
+  for (i = 0; i < set_a->sample_count; i++) {
+    pf_histogram_insert(set_b->histogram, set_a->samples[i].pose, set_a->samples[i].weight);
+  }
+  target_count = pf_resample_limit(pf, set_b->histogram->bin_count);
+
+  // Keep full coverage until the filter has converged, so a recovery
+  // injection at the next resample has particles to work with
+  if (!pf->converged) {
+    target_count = pf->max_samples;
+  }
+
+  // Hysteresis: the resize is itself a resampling pass, so only pay for
+  // it when the population is meaningfully off target.  Shrinking also
+  // requires a healthy effective sample size, since dropping particles
+  // from a degenerate set discards what diversity is left.
+  if (target_count >= set_a->sample_count) {
+    if (target_count < 1.25 * set_a->sample_count) {
+      return;
+    }
+  } else {
+    if (target_count > 0.8 * set_a->sample_count ||
+      ess < 0.5 * set_a->sample_count)
+    {
+      return;
+    }
+  }
+
+  // Systematic pass as in pf_update_resample, without the random-pose
+  // injection; growing simply lands several pointers on a sample
+  pf_histogram_clear(set_b->histogram);
+  set_b->sample_count = 0;
+
+  step = total / target_count;
+  r = drand48() * step;
+  cum = set_a->samples[0].weight;
+  i = 0;
+
+  for (m = 0; m < target_count; m++) {
+    sample_b = set_b->samples + set_b->sample_count++;
+
+    while (r + m * step > cum && i < set_a->sample_count - 1) {
+      i++;
+      cum += set_a->samples[i].weight;
+    }
+    sample_a = set_a->samples + i;
+
+    sample_b->pose = sample_a->pose;
+    sample_b->weight = 1.0 / target_count;
+
+    pf_histogram_insert(set_b->histogram, sample_b->pose, sample_b->weight);
+  }
+
+  // Re-compute cluster statistics
+  pf_cluster_stats(pf, set_b);
+
+  // Use the newly created sample set
+  pf->current_set = (pf->current_set + 1) % 2;
+
+  pf_update_converged(pf);
 }
 
 
@@ -466,7 +545,7 @@ void pf_cluster_stats(pf_t * pf, pf_sample_set_t * set)
   double weight;
 
   // Cluster the samples
-  pf_kdtree_cluster(set->kdtree);
+  pf_histogram_cluster(set->histogram);
 
   // Initialize cluster stats
   set->cluster_count = 0;
@@ -507,7 +586,7 @@ void pf_cluster_stats(pf_t * pf, pf_sample_set_t * set)
     // printf("%d %f %f %f\n", i, sample->pose.v[0], sample->pose.v[1], sample->pose.v[2]);
 
     // Get the cluster label for this sample
-    cidx = pf_kdtree_get_cluster(set->kdtree, sample->pose);
+    cidx = pf_histogram_get_cluster(set->histogram, sample->pose);
     assert(cidx >= 0);
     if (cidx >= set->cluster_max_count) {
       continue;
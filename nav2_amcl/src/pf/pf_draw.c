@@ -37,7 +37,7 @@
 
 #include "nav2_amcl/pf/pf.hpp"
 #include "nav2_amcl/pf/pf_pdf.hpp"
-#include "nav2_amcl/pf/pf_kdtree.hpp"
+#include "nav2_amcl/pf/pf_histogram.hpp"
 
 // Draw the statistics
 void pf_draw_statistics(pf_t * pf, rtk_fig_t * fig);
@@ -70,7 +70,7 @@ void pf_draw_samples(pf_t * pf, rtk_fig_t * fig, int max_samples)
 }
 
 
-// Draw the hitogram (kd tree)
+// Draw the histogram
 void pf_draw_hist(pf_t * pf, rtk_fig_t * fig)
 {
   pf_sample_set_t * set;
@@ -78,7 +78,7 @@ void pf_draw_hist(pf_t * pf, rtk_fig_t * fig)
   set = pf->sets + pf->current_set;
 
   rtk_fig_color(fig, 0.0, 0.0, 1.0);
-  pf_kdtree_draw(set->kdtree, fig);
+  pf_histogram_draw(set->histogram, fig);
 }
 
 
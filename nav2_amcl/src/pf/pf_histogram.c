@@ -0,0 +1,271 @@
+// Copyright (c) 2023 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**************************************************************************
+ * Desc: Flat open-addressing histogram over the discretized pose space.
+ * Keeps the (x, y, theta) discretization of the kd tree it replaces, but
+ * stores bins in a preallocated slot array probed linearly, with in-place
+ * union-find for the connected-component cluster labels.
+ *************************************************************************/
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nav2_amcl/pf/pf_vector.hpp"
+#include "nav2_amcl/pf/pf_histogram.hpp"
+
+
+// Compute the discretized key of a pose
+static void pf_histogram_key(pf_histogram_t * self, pf_vector_t pose, int key[3]);
+
+// Find the slot holding a key, or the empty slot where it belongs
+static int pf_histogram_find_slot(pf_histogram_t * self, int key[3]);
+
+// Find the union-find root of a slot, compressing the path
+static int pf_histogram_find_root(pf_histogram_t * self, int slot);
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Create a histogram
+pf_histogram_t * pf_histogram_alloc(int max_size)
+{
+  pf_histogram_t * self;
+
+  self = calloc(1, sizeof(pf_histogram_t));
+
+  self->size[0] = 0.50;
+  self->size[1] = 0.50;
+  self->size[2] = (10 * M_PI / 180);
+
+  // Size to a power of two at most half full so probe chains stay short
+  self->capacity = 2;
+  while (self->capacity < 2 * max_size) {
+    self->capacity *= 2;
+  }
+  self->mask = self->capacity - 1;
+
+  self->keys = calloc(self->capacity, sizeof(self->keys[0]));
+  self->values = calloc(self->capacity, sizeof(self->values[0]));
+  self->clusters = calloc(self->capacity, sizeof(self->clusters[0]));
+  self->parents = calloc(self->capacity, sizeof(self->parents[0]));
+  self->used = calloc(self->capacity, sizeof(self->used[0]));
+
+  self->bin_count = 0;
+
+  return self;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Destroy a histogram
+void pf_histogram_free(pf_histogram_t * self)
+{
+  free(self->keys);
+  free(self->values);
+  free(self->clusters);
+  free(self->parents);
+  free(self->used);
+  free(self);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Clear all bins from the histogram
+void pf_histogram_clear(pf_histogram_t * self)
+{
+  memset(self->used, 0, self->capacity * sizeof(self->used[0]));
+  self->bin_count = 0;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Accumulate a pose into its bin
+void pf_histogram_insert(pf_histogram_t * self, pf_vector_t pose, double value)
+{
+  int key[3];
+  int slot;
+
+  pf_histogram_key(self, pose, key);
+  slot = pf_histogram_find_slot(self, key);
+
+  if (self->used[slot]) {
+    self->values[slot] += value;
+    return;
+  }
+
+  assert(self->bin_count < self->capacity);
+  self->used[slot] = 1;
+  self->keys[slot][0] = key[0];
+  self->keys[slot][1] = key[1];
+  self->keys[slot][2] = key[2];
+  self->values[slot] = value;
+  self->bin_count += 1;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Label the connected components of occupied bins
+void pf_histogram_cluster(pf_histogram_t * self)
+{
+  int slot, i, nslot;
+  int root, nroot;
+  int nkey[3];
+  int cluster_count;
+
+  // Each occupied bin starts as its own component
+  for (slot = 0; slot < self->capacity; slot++) {
+    self->parents[slot] = slot;
+    self->clusters[slot] = -1;
+  }
+
+  // Union each bin with its occupied neighbors in the 3x3x3 block
+  for (slot = 0; slot < self->capacity; slot++) {
+    if (!self->used[slot]) {
+      continue;
+    }
+
+    for (i = 0; i < 3 * 3 * 3; i++) {
+      nkey[0] = self->keys[slot][0] + (i / 9) - 1;
+      nkey[1] = self->keys[slot][1] + ((i % 9) / 3) - 1;
+      nkey[2] = self->keys[slot][2] + ((i % 9) % 3) - 1;
+
+      nslot = pf_histogram_find_slot(self, nkey);
+      if (!self->used[nslot]) {
+        continue;
+      }
+
+      root = pf_histogram_find_root(self, slot);
+      nroot = pf_histogram_find_root(self, nslot);
+      if (root != nroot) {
+        self->parents[nroot] = root;
+      }
+    }
+  }
+
+  // Assign dense labels to the component roots
+  cluster_count = 0;
+  for (slot = 0; slot < self->capacity; slot++) {
+    if (!self->used[slot]) {
+      continue;
+    }
+
+    root = pf_histogram_find_root(self, slot);
+    if (self->clusters[root] < 0) {
+      self->clusters[root] = cluster_count++;
+    }
+    self->clusters[slot] = self->clusters[root];
+  }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Determine the cluster label for the given pose
+int pf_histogram_get_cluster(pf_histogram_t * self, pf_vector_t pose)
+{
+  int key[3];
+  int slot;
+
+  pf_histogram_key(self, pose, key);
+  slot = pf_histogram_find_slot(self, key);
+  if (!self->used[slot]) {
+    return -1;
+  }
+  return self->clusters[slot];
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Compute the discretized key of a pose
+void pf_histogram_key(pf_histogram_t * self, pf_vector_t pose, int key[3])
+{
+  key[0] = floor(pose.v[0] / self->size[0]);
+  key[1] = floor(pose.v[1] / self->size[1]);
+  key[2] = floor(pose.v[2] / self->size[2]);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Find the slot holding a key, or the empty slot where it belongs
+int pf_histogram_find_slot(pf_histogram_t * self, int key[3])
+{
+  unsigned int hash;
+  int slot;
+
+  // Mix the key dimensions so neighboring bins spread over the table
+  hash = (unsigned int)key[0] * 73856093u;
+  hash ^= (unsigned int)key[1] * 19349663u;
+  hash ^= (unsigned int)key[2] * 83492791u;
+
+  slot = (int)(hash & (unsigned int)self->mask);
+  while (self->used[slot] &&
+    (self->keys[slot][0] != key[0] ||
+    self->keys[slot][1] != key[1] ||
+    self->keys[slot][2] != key[2]))
+  {
+    slot = (slot + 1) & self->mask;
+  }
+
+  return slot;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Find the union-find root of a slot, compressing the path
+int pf_histogram_find_root(pf_histogram_t * self, int slot)
+{
+  int root, next;
+
+  root = slot;
+  while (self->parents[root] != root) {
+    root = self->parents[root];
+  }
+
+  while (self->parents[slot] != root) {
+    next = self->parents[slot];
+    self->parents[slot] = root;
+    slot = next;
+  }
+
+  return root;
+}
+
+
+#ifdef INCLUDE_RTKGUI
+
+////////////////////////////////////////////////////////////////////////////////
+// Draw the occupied bins
+void pf_histogram_draw(pf_histogram_t * self, rtk_fig_t * fig)
+{
+  int slot;
+  double ox, oy;
+  char text[64];
+
+  for (slot = 0; slot < self->capacity; slot++) {
+    if (!self->used[slot]) {
+      continue;
+    }
+
+    ox = (self->keys[slot][0] + 0.5) * self->size[0];
+    oy = (self->keys[slot][1] + 0.5) * self->size[1];
+
+    rtk_fig_rectangle(fig, ox, oy, 0.0, self->size[0], self->size[1], 0);
+
+    snprintf(text, sizeof(text), "%d", self->clusters[slot]);
+    rtk_fig_text(fig, ox, oy, 0.0, text);
+  }
+}
+
+#endif
@@ -27,6 +27,7 @@
 
 #include <assert.h>
 #include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 // #include <gsl/gsl_rng.h>
@@ -39,6 +40,97 @@
 // Random number generator seed value
 static unsigned int pf_pdf_seed;
 
+/**************************************************************************
+ * Ziggurat gaussian sampler (Marsaglia & Tsang, 2000), 128 layers.
+ * Most draws are a single 32-bit integer draw, a table compare and one
+ * multiply, replacing the polar method's rejection loop with two uniform
+ * draws, a log and a sqrt per sample.
+ *************************************************************************/
+
+static uint32_t zig_kn[128];
+static double zig_wn[128];
+static double zig_fn[128];
+static int zig_initialized = 0;
+
+// Build the layer tables. Deterministic and idempotent; called once from
+// the main thread in pf_pdf_gaussian_alloc() before any sampling threads
+// exist, the lazy checks below only cover standalone use of the samplers.
+static void pf_ran_ziggurat_init(void)
+{
+  const double m1 = 2147483648.0;
+  double dn = 3.442619855899;
+  double tn = dn;
+  const double vn = 9.91256303526217e-3;
+  double q;
+  int i;
+
+  q = vn / exp(-0.5 * dn * dn);
+  zig_kn[0] = (uint32_t)((dn / q) * m1);
+  zig_kn[1] = 0;
+
+  zig_wn[0] = q / m1;
+  zig_wn[127] = dn / m1;
+
+  zig_fn[0] = 1.0;
+  zig_fn[127] = exp(-0.5 * dn * dn);
+
+  for (i = 126; i >= 1; i--) {
+    dn = sqrt(-2.0 * log(vn / dn + exp(-0.5 * dn * dn)));
+    zig_kn[i + 1] = (uint32_t)((dn / tn) * m1);
+    tn = dn;
+    zig_fn[i] = exp(-0.5 * dn * dn);
+    zig_wn[i] = dn / m1;
+  }
+
+  zig_initialized = 1;
+}
+
+// Uniform sources: the global drand48 stream when xsubi is NULL, the
+// caller-owned reentrant stream otherwise
+static int32_t pf_ran_int32(unsigned short * xsubi)
+{
+  return xsubi ? (int32_t)jrand48(xsubi) : (int32_t)mrand48();
+}
+
+static double pf_ran_uniform(unsigned short * xsubi)
+{
+  return xsubi ? erand48(xsubi) : drand48();
+}
+
+// Draw one unit normal sample with the ziggurat method
+static double pf_ran_gaussian_ziggurat(unsigned short * xsubi)
+{
+  const double r = 3.442619855899;
+
+  for (;; ) {
+    const int32_t hz = pf_ran_int32(xsubi);
+    const uint32_t iz = (uint32_t)hz & 127u;
+    const uint32_t az = hz < 0 ? (uint32_t)(-(int64_t)hz) : (uint32_t)hz;
+
+    if (az < zig_kn[iz]) {
+      return hz * zig_wn[iz];
+    }
+
+    if (iz == 0u) {
+      // Sample from the tail beyond +/- r
+      double x, y;
+      do {
+        x = -log(1.0 - pf_ran_uniform(xsubi)) / r;
+        y = -log(1.0 - pf_ran_uniform(xsubi));
+      } while (y + y < x * x);
+      return hz > 0 ? r + x : -(r + x);
+    }
+
+    // Sample from the wedge between the layer rectangle and the pdf
+    const double x = hz * zig_wn[iz];
+    if (zig_fn[iz] + pf_ran_uniform(xsubi) * (zig_fn[iz - 1] - zig_fn[iz]) <
+      exp(-0.5 * x * x))
+    {
+      return x;
+    }
+  }
+}
+
 
 /**************************************************************************
  * Gaussian
@@ -67,6 +159,9 @@ pf_pdf_gaussian_t * pf_pdf_gaussian_alloc(pf_vector_t x, pf_matrix_t cx)
   // pdf->rng = gsl_rng_alloc(gsl_rng_taus);
   // gsl_rng_set(pdf->rng, ++pf_pdf_seed);
   srand48(++pf_pdf_seed);
+  if (!zig_initialized) {
+    pf_ran_ziggurat_init();
+  }
 
   return pdf;
 }
@@ -126,24 +221,35 @@ pf_vector_t pf_pdf_gaussian_sample(pf_pdf_gaussian_t * pdf)
 }
 
 // Draw randomly from a zero-mean Gaussian distribution, with standard
-// deviation sigma.
-// We use the polar form of the Box-Muller transformation, explained here:
-//   http://www.taygeta.com/random/gaussian.html
+// deviation sigma, using the ziggurat method on the global drand48 stream.
 double pf_ran_gaussian(double sigma)
 {
-  double x1, x2, w, r;
-
-  do {
-    do {
-      r = drand48();
-    } while (r == 0.0);
-    x1 = 2.0 * r - 1.0;
-    do {
-      r = drand48();
-    } while (r == 0.0);
-    x2 = 2.0 * r - 1.0;
-    w = x1 * x1 + x2 * x2;
-  } while (w > 1.0 || w == 0.0);
-
-  return sigma * x2 * sqrt(-2.0 * log(w) / w);
+  if (!zig_initialized) {
+    pf_ran_ziggurat_init();
+  }
+  return sigma * pf_ran_gaussian_ziggurat(NULL);
+}
+
+// Reentrant variant of the above drawing from a caller-owned erand48 state,
+// for sampling from several threads without sharing the global stream.
+double pf_ran_gaussian_r(double sigma, unsigned short xsubi[3])
+{
+  if (!zig_initialized) {
+    pf_ran_ziggurat_init();
+  }
+  return sigma * pf_ran_gaussian_ziggurat(xsubi);
+}
+
+// Batched variant filling n zero-mean samples in one pass, amortizing the
+// call overhead when motion updates draw noise for whole particle ranges.
+void pf_ran_gaussian_fill_r(double sigma, double * samples, int n, unsigned short xsubi[3])
+{
+  int i;
+
+  if (!zig_initialized) {
+    pf_ran_ziggurat_init();
+  }
+  for (i = 0; i < n; i++) {
+    samples[i] = sigma * pf_ran_gaussian_ziggurat(xsubi);
+  }
 }
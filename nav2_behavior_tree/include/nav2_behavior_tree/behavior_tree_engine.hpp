@@ -16,6 +16,7 @@
 #ifndef NAV2_BEHAVIOR_TREE__BEHAVIOR_TREE_ENGINE_HPP_
 #define NAV2_BEHAVIOR_TREE__BEHAVIOR_TREE_ENGINE_HPP_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -24,6 +25,8 @@
 #include "behaviortree_cpp/bt_factory.h"
 #include "behaviortree_cpp/xml_parsing.h"
 
+#include "nav2_behavior_tree/bt_profiler.hpp"
+#include "nav2_behavior_tree/bt_state_streamer.hpp"
 #include "rclcpp/rclcpp.hpp"
 
 namespace nav2_behavior_tree
@@ -97,6 +100,15 @@ protected:
 
   // Clock
   rclcpp::Clock::SharedPtr clock_;
+
+  // Always-on per-node tick profiler, dumped via a Trigger service
+  std::unique_ptr<BtProfiler> profiler_;
+
+  // Binary status-change stream, idle unless somebody subscribes
+  std::unique_ptr<BtStateStreamer> state_streamer_;
+
+  // Ticks issued by this engine, the correlation id of the tick tracepoints
+  uint64_t tick_count_{0};
 };
 
 }  // namespace nav2_behavior_tree
@@ -18,6 +18,8 @@
 #include <memory>
 #include <string>
 #include <chrono>
+#include <mutex>
+#include <unordered_map>
 
 #include "behaviortree_cpp/action_node.h"
 #include "nav2_util/node_utils.hpp"
@@ -298,6 +300,9 @@ public:
     }
 
     goal_handle_.reset();
+    // The completion callbacks above have consumed the result; drop our
+    // reference so large payloads (full paths) do not outlive the cycle
+    result_.result.reset();
     return status;
   }
 
@@ -436,6 +441,59 @@ protected:
     return false;
   }
 
+  /**
+   * @brief getInput for goal fields that persist across ticks. The port is
+   * converted and copied only when its backing blackboard entry has changed
+   * since the last successful read (tracked by the entry's sequence id), so
+   * unchanged large inputs such as pose arrays are not rebuilt on every
+   * replanning cycle.
+   * @param key Name of the input port
+   * @param dest Persistent destination, left untouched when the port value
+   * is unchanged
+   * @return bool True if dest holds a current value for the port
+   */
+  template<typename T>
+  bool getInputCached(const std::string & key, T & dest)
+  {
+    const auto port_it = config().input_ports.find(key);
+    if (port_it == config().input_ports.end()) {
+      return getInput(key, dest);
+    }
+
+    const auto remapped = BT::TreeNode::getRemappedKey(key, port_it->second);
+    if (!remapped) {
+      // Static string: convert it once, it cannot change between ticks
+      if (cached_input_seq_.count(key) > 0) {
+        return true;
+      }
+      if (!getInput(key, dest)) {
+        return false;
+      }
+      cached_input_seq_[key] = 0;
+      return true;
+    }
+
+    const auto entry = config().blackboard->getEntry(std::string(*remapped));
+    if (!entry) {
+      return getInput(key, dest);
+    }
+
+    uint64_t sequence_id;
+    {
+      std::scoped_lock lock(entry->entry_mutex);
+      sequence_id = entry->sequence_id;
+    }
+    const auto cache_it = cached_input_seq_.find(key);
+    if (cache_it != cached_input_seq_.end() && cache_it->second == sequence_id) {
+      return true;
+    }
+    if (!getInput(key, dest)) {
+      return false;
+    }
+    cached_input_seq_[key] = sequence_id;
+    return true;
+  }
+
   /**
    * @brief Function to increment recovery count on blackboard if this node wraps a recovery
    */
@@ -482,6 +540,9 @@ protected:
 
   // Can be set in on_tick or on_wait_for_result to indicate if a goal should be sent.
   bool should_send_goal_;
+
+  // Last-seen blackboard sequence id per input port, for getInputCached()
+  std::unordered_map<std::string, uint64_t> cached_input_seq_;
 };
 
 }  // namespace nav2_behavior_tree
@@ -19,6 +19,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "geometry_msgs/msg/pose_stamped.hpp"
@@ -206,6 +207,12 @@ protected:
    */
   void cleanErrorCodes();
 
+  /**
+   * @brief Halt the active tree and park it in the registry so a later goal
+   * using the same XML file can swap it back in without reparsing
+   */
+  void parkCurrentTree();
+
   // Action name
   std::string action_name_;
 
@@ -215,6 +222,11 @@ protected:
   // Behavior Tree to be executed when goal is received
   BT::Tree tree_;
 
+  // Previously instantiated trees, kept warm so switching the active BT
+  // between goals is a registry swap instead of a reparse of the XML file.
+  // All of them share blackboard_, so no rewiring is needed on a swap.
+  std::unordered_map<std::string, BT::Tree> tree_registry_;
+
   // The blackboard shared by all of the nodes in the tree
   BT::Blackboard::Ptr blackboard_;
 
@@ -69,6 +69,9 @@ BtActionServer<ActionT>::BtActionServer(
   if (!node->has_parameter("always_reload_bt_xml")) {
     node->declare_parameter("always_reload_bt_xml", false);
   }
+  if (!node->has_parameter("preload_bt_xml_filenames")) {
+    node->declare_parameter("preload_bt_xml_filenames", std::vector<std::string>());
+  }
   if (!node->has_parameter("wait_for_service_timeout")) {
     node->declare_parameter("wait_for_service_timeout", 1000);
   }
@@ -188,6 +191,19 @@ bool BtActionServer<ActionT>::on_configure()
     "wait_for_service_timeout",
     wait_for_service_timeout_);
 
+  // Parse any trees the user listed up front, so switching to them at goal
+  // accept time is a registry swap rather than a file read and XML parse.
+  // Pointless when every load is forced to reparse, so skip it then.
+  if (!always_reload_bt_xml_) {
+    const auto preload_bt_xml_filenames =
+      node->get_parameter("preload_bt_xml_filenames").as_string_array();
+    for (const auto & filename : preload_bt_xml_filenames) {
+      if (!loadBehaviorTree(filename)) {
+        RCLCPP_WARN(logger_, "Failed to preload behavior tree: %s", filename.c_str());
+      }
+    }
+  }
+
   return true;
 }
 
@@ -219,6 +235,10 @@ bool BtActionServer<ActionT>::on_cleanup()
   current_bt_xml_filename_.clear();
   blackboard_.reset();
   bt_->haltAllActions(tree_);
+  for (auto & [filename, tree] : tree_registry_) {
+    bt_->haltAllActions(tree);
+  }
+  tree_registry_.clear();
   bt_.reset();
   return true;
 }
@@ -235,6 +255,20 @@ bool BtActionServer<ActionT>::loadBehaviorTree(const std::string & bt_xml_filena
     return true;
   }
 
+  // A tree instantiated for this file earlier can simply be swapped back in
+  if (!always_reload_bt_xml_) {
+    auto cached = tree_registry_.find(filename);
+    if (cached != tree_registry_.end()) {
+      parkCurrentTree();
+      tree_ = std::move(cached->second);
+      tree_registry_.erase(cached);
+      topic_logger_ = std::make_unique<RosTopicLogger>(client_node_, tree_);
+      current_bt_xml_filename_ = filename;
+      RCLCPP_DEBUG(logger_, "Swapped in precompiled BT for: %s", filename.c_str());
+      return true;
+    }
+  }
+
   // Read the input BT XML from the specified file into a string
   std::ifstream xml_file(filename);
 
@@ -243,10 +277,12 @@ bool BtActionServer<ActionT>::loadBehaviorTree(const std::string & bt_xml_filena
     return false;
   }
 
-  // Create the Behavior Tree from the XML input
+  // Create the Behavior Tree from the XML input, keeping the previous tree
+  // in place until the new one has been built successfully
+  BT::Tree new_tree;
   try {
-    tree_ = bt_->createTreeFromFile(filename, blackboard_);
-    for (auto & subtree : tree_.subtrees) {
+    new_tree = bt_->createTreeFromFile(filename, blackboard_);
+    for (auto & subtree : new_tree.subtrees) {
       auto & blackboard = subtree->blackboard;
       blackboard->set("node", client_node_);
       blackboard->set<std::chrono::milliseconds>("server_timeout", default_server_timeout_);
@@ -260,12 +296,25 @@ bool BtActionServer<ActionT>::loadBehaviorTree(const std::string & bt_xml_filena
     return false;
   }
 
+  parkCurrentTree();
+  tree_ = std::move(new_tree);
   topic_logger_ = std::make_unique<RosTopicLogger>(client_node_, tree_);
 
   current_bt_xml_filename_ = filename;
   return true;
 }
 
+template<class ActionT>
+void BtActionServer<ActionT>::parkCurrentTree()
+{
+  // With forced reloads there is no point keeping old instances around
+  if (always_reload_bt_xml_ || current_bt_xml_filename_.empty()) {
+    return;
+  }
+  tree_.haltTree();
+  tree_registry_[current_bt_xml_filename_] = std::move(tree_);
+}
+
 template<class ActionT>
 void BtActionServer<ActionT>::executeCallback()
 {
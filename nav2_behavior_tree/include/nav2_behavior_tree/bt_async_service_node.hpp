@@ -0,0 +1,89 @@
+// Copyright (c) 2024 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_BEHAVIOR_TREE__BT_ASYNC_SERVICE_NODE_HPP_
+#define NAV2_BEHAVIOR_TREE__BT_ASYNC_SERVICE_NODE_HPP_
+
+#include <chrono>
+#include <string>
+
+#include "nav2_behavior_tree/bt_service_node.hpp"
+
+namespace nav2_behavior_tree
+{
+
+/**
+ * @brief A service based BT node that never blocks the tick loop
+ *
+ * BtServiceNode spins waiting on the service future for up to half the tick
+ * period, stalling the whole tree while a slow server responds. This variant
+ * issues the request, returns RUNNING immediately and completes on a later
+ * tick once the stored future is ready, so a service call only ever costs
+ * the tree a non-blocking poll per tick. server_timeout still bounds how
+ * long the node reports RUNNING before failing.
+ * @tparam ServiceT Type of service
+ */
+template<class ServiceT>
+class BtAsyncServiceNode : public BtServiceNode<ServiceT>
+{
+public:
+  /**
+   * @brief A nav2_behavior_tree::BtAsyncServiceNode constructor
+   * @param service_node_name BT node name
+   * @param conf BT node configuration
+   * @param service_name Optional service name this node creates a client for instead of from input port
+   */
+  BtAsyncServiceNode(
+    const std::string & service_node_name,
+    const BT::NodeConfiguration & conf,
+    const std::string & service_name = "")
+  : BtServiceNode<ServiceT>(service_node_name, conf, service_name)
+  {
+  }
+
+  BtAsyncServiceNode() = delete;
+
+  /**
+   * @brief Poll the future without blocking and decide the status of BT
+   * @return BT::NodeStatus SUCCESS if the response arrived, RUNNING while
+   * waiting within server_timeout, FAILURE afterwards
+   */
+  BT::NodeStatus check_future() override
+  {
+    // pump any completed callbacks for this node's group without waiting
+    this->callback_group_executor_.spin_some();
+
+    if (this->future_result_.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+      this->request_sent_ = false;
+      return this->on_completion(this->future_result_.get());
+    }
+
+    auto elapsed =
+      (this->node_->now() - this->sent_time_).template to_chrono<std::chrono::milliseconds>();
+    if (elapsed < this->server_timeout_) {
+      this->on_wait_for_result();
+      return BT::NodeStatus::RUNNING;
+    }
+
+    RCLCPP_WARN(
+      this->node_->get_logger(),
+      "Node timed out while executing service call to %s.", this->service_name_.c_str());
+    this->request_sent_ = false;
+    return BT::NodeStatus::FAILURE;
+  }
+};
+
+}  // namespace nav2_behavior_tree
+
+#endif  // NAV2_BEHAVIOR_TREE__BT_ASYNC_SERVICE_NODE_HPP_
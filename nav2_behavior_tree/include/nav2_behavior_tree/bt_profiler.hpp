@@ -0,0 +1,167 @@
+// Copyright (c) 2024 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_BEHAVIOR_TREE__BT_PROFILER_HPP_
+#define NAV2_BEHAVIOR_TREE__BT_PROFILER_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "behaviortree_cpp/behavior_tree.h"
+#include "rclcpp/rclcpp.hpp"
+#include "std_srvs/srv/trigger.hpp"
+
+namespace nav2_behavior_tree
+{
+
+/**
+ * @class nav2_behavior_tree::BtProfiler
+ * @brief Lightweight always-on profiler for behavior tree ticks
+ *
+ * Records the duration of every node tick into small per-node ring buffers
+ * using the tick monitor callback, so attributing tick budget overruns to a
+ * node costs one clock read and a few stores per tick rather than the full
+ * Groot monitoring stack. The accumulated statistics can be dumped through
+ * a Trigger service as a report of the slowest nodes.
+ */
+class BtProfiler
+{
+public:
+  /// Number of most recent tick durations retained per node
+  static constexpr size_t kRingSize = 128;
+  /// Number of nodes listed in a dump, ordered by worst recorded tick
+  static constexpr size_t kTopN = 10;
+
+  /**
+   * @brief A constructor for nav2_behavior_tree::BtProfiler
+   * @param ros_node Node used to expose the dump service
+   * @param service_name Name of the Trigger service dumping the statistics
+   */
+  BtProfiler(
+    const rclcpp::Node::SharedPtr & ros_node,
+    const std::string & service_name = "behavior_tree_profile")
+  {
+    dump_service_ = ros_node->create_service<std_srvs::srv::Trigger>(
+      service_name,
+      [this](
+        const std::shared_ptr<std_srvs::srv::Trigger::Request>,
+        std::shared_ptr<std_srvs::srv::Trigger::Response> response) {
+        response->message = report();
+        response->success = true;
+      });
+  }
+
+  /**
+   * @brief Install the tick monitor callback on every node of a tree
+   *
+   * Statistics of a previously attached tree are dropped, since node UIDs
+   * are only unique within one tree.
+   * @param tree BT to profile
+   */
+  void attach(BT::Tree & tree)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (tree.rootNode() == attached_root_) {
+      return;
+    }
+    stats_.clear();
+    attached_root_ = tree.rootNode();
+    for (const auto & subtree : tree.subtrees) {
+      for (const auto & node : subtree->nodes) {
+        stats_[node->UID()].name = node->name();
+        node->setTickMonitorCallback(
+          [this](BT::TreeNode & tree_node, BT::NodeStatus, std::chrono::microseconds duration) {
+            record(tree_node.UID(), duration.count());
+          });
+      }
+    }
+  }
+
+  /**
+   * @brief Render the current statistics, worst recorded tick first
+   * @return Human readable top-N report
+   */
+  std::string report()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<const NodeStats *> ordered;
+    ordered.reserve(stats_.size());
+    for (const auto & entry : stats_) {
+      if (entry.second.count > 0) {
+        ordered.push_back(&entry.second);
+      }
+    }
+    std::sort(
+      ordered.begin(), ordered.end(),
+      [](const NodeStats * a, const NodeStats * b) {return a->max_us > b->max_us;});
+
+    std::ostringstream out;
+    out << "node ticks max_us mean_us recent_mean_us\n";
+    for (size_t i = 0; i < ordered.size() && i < kTopN; ++i) {
+      const NodeStats & s = *ordered[i];
+      const size_t recent = std::min<uint64_t>(s.count, kRingSize);
+      uint64_t recent_total = 0;
+      for (size_t j = 0; j < recent; ++j) {
+        recent_total += s.ring[j];
+      }
+      out << s.name << " " << s.count << " " << s.max_us << " " <<
+        s.total_us / s.count << " " << (recent ? recent_total / recent : 0) << "\n";
+    }
+    return out.str();
+  }
+
+protected:
+  /**
+   * @brief Per-node accumulated tick statistics
+   */
+  struct NodeStats
+  {
+    std::string name;
+    std::array<uint32_t, kRingSize> ring;
+    uint64_t count{0};
+    uint64_t total_us{0};
+    uint64_t max_us{0};
+  };
+
+  /**
+   * @brief Store one tick duration for a node
+   * @param uid UID of the ticked node
+   * @param duration_us Tick duration in microseconds
+   */
+  void record(uint16_t uid, uint64_t duration_us)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    NodeStats & s = stats_[uid];
+    s.ring[s.count % kRingSize] = static_cast<uint32_t>(duration_us);
+    s.count++;
+    s.total_us += duration_us;
+    s.max_us = std::max(s.max_us, duration_us);
+  }
+
+  std::mutex mutex_;
+  std::map<uint16_t, NodeStats> stats_;
+  BT::TreeNode * attached_root_{nullptr};
+  rclcpp::Service<std_srvs::srv::Trigger>::SharedPtr dump_service_;
+};
+
+}  // namespace nav2_behavior_tree
+
+#endif  // NAV2_BEHAVIOR_TREE__BT_PROFILER_HPP_
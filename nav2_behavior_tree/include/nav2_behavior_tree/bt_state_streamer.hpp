@@ -0,0 +1,172 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_BEHAVIOR_TREE__BT_STATE_STREAMER_HPP_
+#define NAV2_BEHAVIOR_TREE__BT_STATE_STREAMER_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "behaviortree_cpp/behavior_tree.h"
+#include "rclcpp/rclcpp.hpp"
+#include "std_msgs/msg/string.hpp"
+#include "std_msgs/msg/u_int8_multi_array.hpp"
+
+namespace nav2_behavior_tree
+{
+
+/**
+ * @class nav2_behavior_tree::BtStateStreamer
+ * @brief Minimal binary stream of behavior tree status changes
+ *
+ * Streams the status transitions of each tick as one small binary message
+ * instead of running the Groot monitoring stack: an event costs eight bytes
+ * and a few stores, and nothing at all is recorded or published while no
+ * subscriber is connected. A latched description message maps node UIDs to
+ * names so the stream is self describing.
+ *
+ * Stream message layout (little endian):
+ *   bytes 0..7  steady clock stamp of the first event, in nanoseconds
+ *   then, per event:
+ *     uint16 node UID
+ *     uint8  previous status, uint8 current status (BT::NodeStatus values)
+ *     uint32 offset from the first event, in microseconds
+ */
+class BtStateStreamer
+{
+public:
+  /**
+   * @brief A constructor for nav2_behavior_tree::BtStateStreamer
+   * @param ros_node Node used to create the stream publishers
+   * @param topic_name Stream topic; the UID to name mapping is latched on
+   * <topic_name>_description
+   */
+  explicit BtStateStreamer(
+    const rclcpp::Node::SharedPtr & ros_node,
+    const std::string & topic_name = "behavior_tree_stream")
+  {
+    stream_pub_ = ros_node->create_publisher<std_msgs::msg::UInt8MultiArray>(
+      topic_name, rclcpp::QoS(10));
+    description_pub_ = ros_node->create_publisher<std_msgs::msg::String>(
+      topic_name + "_description",
+      rclcpp::QoS(rclcpp::KeepLast(1)).transient_local().reliable());
+  }
+
+  /**
+   * @brief Subscribe to the status changes of every node of a tree
+   *
+   * Re-attaching the currently attached tree is a no-op; attaching another
+   * tree replaces the previous subscriptions and republishes the latched
+   * UID to name mapping.
+   * @param tree BT to stream
+   */
+  void attach(BT::Tree & tree)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (tree.rootNode() == attached_root_) {
+      return;
+    }
+    attached_root_ = tree.rootNode();
+    subscribers_.clear();
+    buffer_.clear();
+
+    std::ostringstream description;
+    for (const auto & subtree : tree.subtrees) {
+      for (const auto & node : subtree->nodes) {
+        description << node->UID() << " " << node->name() << "\n";
+        subscribers_.push_back(
+          node->subscribeToStatusChange(
+            [this](
+              BT::TimePoint timestamp, const BT::TreeNode & tree_node,
+              BT::NodeStatus prev_status, BT::NodeStatus status) {
+              record(timestamp, tree_node.UID(), prev_status, status);
+            }));
+      }
+    }
+
+    std_msgs::msg::String description_msg;
+    description_msg.data = description.str();
+    description_pub_->publish(description_msg);
+  }
+
+  /**
+   * @brief Publish the events recorded since the last flush, if any
+   *
+   * Called once per tick. Also re-evaluates whether a subscriber is
+   * connected, so recording stays disabled entirely on idle fleets.
+   */
+  void flush()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!buffer_.empty()) {
+      auto msg = std::make_unique<std_msgs::msg::UInt8MultiArray>();
+      msg->data.swap(buffer_);
+      stream_pub_->publish(std::move(msg));
+    }
+    active_ = stream_pub_->get_subscription_count() > 0;
+  }
+
+protected:
+  /**
+   * @brief Append one status change to the tick's delta buffer
+   */
+  void record(
+    BT::TimePoint timestamp, uint16_t uid,
+    BT::NodeStatus prev_status, BT::NodeStatus status)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!active_) {
+      return;
+    }
+    const int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      timestamp.time_since_epoch()).count();
+    if (buffer_.empty()) {
+      base_ns_ = ns;
+      appendIntegral(static_cast<uint64_t>(ns));
+    }
+    appendIntegral(uid);
+    buffer_.push_back(static_cast<uint8_t>(prev_status));
+    buffer_.push_back(static_cast<uint8_t>(status));
+    appendIntegral(static_cast<uint32_t>((ns - base_ns_) / 1000));
+  }
+
+  /**
+   * @brief Append an unsigned integral value to the buffer, little endian
+   */
+  template<typename T>
+  void appendIntegral(T value)
+  {
+    for (size_t i = 0; i < sizeof(T); ++i) {
+      buffer_.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+  }
+
+  std::mutex mutex_;
+  std::vector<uint8_t> buffer_;
+  int64_t base_ns_{0};
+  bool active_{false};
+  BT::TreeNode * attached_root_{nullptr};
+  std::vector<BT::TreeNode::StatusChangeSubscriber> subscribers_;
+  rclcpp::Publisher<std_msgs::msg::UInt8MultiArray>::SharedPtr stream_pub_;
+  rclcpp::Publisher<std_msgs::msg::String>::SharedPtr description_pub_;
+};
+
+}  // namespace nav2_behavior_tree
+
+#endif  // NAV2_BEHAVIOR_TREE__BT_STATE_STREAMER_HPP_
@@ -15,6 +15,7 @@
 #ifndef NAV2_BEHAVIOR_TREE__BT_UTILS_HPP_
 #define NAV2_BEHAVIOR_TREE__BT_UTILS_HPP_
 
+#include <memory>
 #include <string>
 #include <set>
 
@@ -24,6 +25,22 @@
 #include "geometry_msgs/msg/point.hpp"
 #include "geometry_msgs/msg/quaternion.hpp"
 #include "geometry_msgs/msg/pose_stamped.hpp"
+#include "nav_msgs/msg/path.hpp"
+
+namespace nav2_behavior_tree
+{
+
+/**
+ * @brief Shared immutable path handed between BT nodes on the blackboard
+ *
+ * Paths can hold thousands of poses and are replanned continuously, so
+ * nodes exchange them by const shared pointer rather than by value. A node
+ * that alters a path allocates a new one (copy-on-write); the pointed-to
+ * path is never mutated in place.
+ */
+using PathPtr = std::shared_ptr<const nav_msgs::msg::Path>;
+
+}  // namespace nav2_behavior_tree
 
 namespace BT
 {
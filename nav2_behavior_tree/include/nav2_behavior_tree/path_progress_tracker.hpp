@@ -0,0 +1,239 @@
+// Copyright (c) 2024 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_BEHAVIOR_TREE__PATH_PROGRESS_TRACKER_HPP_
+#define NAV2_BEHAVIOR_TREE__PATH_PROGRESS_TRACKER_HPP_
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "behaviortree_cpp/blackboard.h"
+#include "geometry_msgs/msg/pose_stamped.hpp"
+#include "nav_msgs/msg/path.hpp"
+#include "nav2_util/geometry_utils.hpp"
+#include "tf2/LinearMath/Quaternion.h"
+#include "tf2/convert.h"
+
+namespace nav2_behavior_tree
+{
+
+/**
+ * @class nav2_behavior_tree::PathProgressTracker
+ * @brief Shared incremental progress state along a path or goal list
+ *
+ * Path-following BT nodes each need the path pose or via-point the robot is
+ * currently closest to, and rediscovering it from scratch costs a scan of the
+ * whole path on every tick. One tracker instance shared on the blackboard
+ * keeps a monotonic closest index per path version instead, so every node
+ * ticking the same path resumes the search from the previous result and only
+ * walks a bounded forward window. A changed path or goal list, detected by a
+ * constant-time identity check on the header and end poses, resets the
+ * progress. All accesses happen from the tree tick thread.
+ */
+class PathProgressTracker
+{
+public:
+  /// Blackboard key under which the shared tracker instance is stored
+  static constexpr const char * kBlackboardKey = "path_progress_tracker";
+
+  /**
+   * @brief Fetch the tracker shared on a blackboard, creating it if absent
+   * @param blackboard Blackboard of the tree being ticked
+   * @return The shared tracker instance
+   */
+  static std::shared_ptr<PathProgressTracker> getShared(const BT::Blackboard::Ptr & blackboard)
+  {
+    std::shared_ptr<PathProgressTracker> tracker;
+    if (!blackboard->get(kBlackboardKey, tracker) || !tracker) {
+      tracker = std::make_shared<PathProgressTracker>();
+      blackboard->set(kBlackboardKey, tracker);
+    }
+    return tracker;
+  }
+
+  /**
+   * @brief Find the index of the path pose closest to the robot
+   *
+   * Searches forward from the last result while the path is unchanged, over
+   * at most max_search_dist of integrated path length; a different path
+   * restarts the search from the beginning. Matches the semantics of a
+   * min_by scan bounded by first_after_integrated_distance.
+   * @param path Path to search
+   * @param robot_pose Robot pose in the path frame
+   * @param angular_distance_weight Weight of angular distance relative to spatial distance
+   * @param max_search_dist Maximum integrated distance to search forward
+   * @return Index of the closest pose within the window
+   */
+  size_t closestIndex(
+    const nav_msgs::msg::Path & path,
+    const geometry_msgs::msg::PoseStamped & robot_pose,
+    double angular_distance_weight,
+    double max_search_dist)
+  {
+    if (!samePath(path)) {
+      rememberPath(path);
+      closest_index_ = 0;
+    }
+
+    const auto & poses = path.poses;
+    double lowest = std::numeric_limits<double>::infinity();
+    size_t lowest_index = closest_index_;
+    double integrated = 0.0;
+    for (size_t i = closest_index_; i < poses.size(); ++i) {
+      if (i > closest_index_) {
+        integrated += nav2_util::geometry_utils::euclidean_distance(
+          poses[i - 1].pose, poses[i].pose);
+        if (integrated > max_search_dist) {
+          break;
+        }
+      }
+      const double distance = poseDistance(robot_pose, poses[i], angular_distance_weight);
+      if (distance <= lowest) {
+        lowest = distance;
+        lowest_index = i;
+      }
+    }
+
+    closest_index_ = lowest_index;
+    return lowest_index;
+  }
+
+  /**
+   * @brief Find the index of the first via-point not yet achieved
+   *
+   * Monotonic while the goal list is unchanged and never passes the last
+   * goal, so repeated calls only check goals near the robot.
+   * @param goals Remaining via-points
+   * @param robot_pose Robot pose in the goals frame
+   * @param achieved_radius Distance to a goal for it to count as passed
+   * @return Index of the first goal further away than achieved_radius
+   */
+  size_t firstActiveGoal(
+    const std::vector<geometry_msgs::msg::PoseStamped> & goals,
+    const geometry_msgs::msg::PoseStamped & robot_pose,
+    double achieved_radius)
+  {
+    if (!sameGoals(goals)) {
+      rememberGoals(goals);
+      first_active_goal_ = 0;
+    }
+
+    while (first_active_goal_ + 1 < goals.size() &&
+      nav2_util::geometry_utils::euclidean_distance(
+        goals[first_active_goal_].pose, robot_pose.pose) <= achieved_radius)
+    {
+      ++first_active_goal_;
+    }
+    return first_active_goal_;
+  }
+
+  /**
+   * @brief A custom pose distance method which takes angular distance into account
+   * in addition to spatial distance (to improve picking a correct pose near cusps and loops)
+   * @param pose1 Distance is computed between this pose and pose2
+   * @param pose2 Distance is computed between this pose and pose1
+   * @param angular_distance_weight Weight of angular distance relative to spatial distance
+   * (1.0 means that 1 radian of angular distance corresponds to 1 meter of spatial distance)
+   */
+  static double poseDistance(
+    const geometry_msgs::msg::PoseStamped & pose1,
+    const geometry_msgs::msg::PoseStamped & pose2,
+    const double angular_distance_weight)
+  {
+    double dx = pose1.pose.position.x - pose2.pose.position.x;
+    double dy = pose1.pose.position.y - pose2.pose.position.y;
+    // taking angular distance into account in addition to spatial distance
+    // (to improve picking a correct pose near cusps and loops)
+    tf2::Quaternion q1;
+    tf2::convert(pose1.pose.orientation, q1);
+    tf2::Quaternion q2;
+    tf2::convert(pose2.pose.orientation, q2);
+    double da = angular_distance_weight * std::abs(q1.angleShortestPath(q2));
+    return std::sqrt(dx * dx + dy * dy + da * da);
+  }
+
+protected:
+  /**
+   * @brief Constant-time check whether a path matches the tracked version
+   * @param path Path to compare against the remembered identity
+   * @return True if header, size and end poses all match
+   */
+  bool samePath(const nav_msgs::msg::Path & path) const
+  {
+    return path.poses.size() == path_size_ &&
+           path.header.stamp == path_stamp_ &&
+           path.header.frame_id == path_frame_ &&
+           (path_size_ == 0 ||
+           (path.poses.front().pose == path_front_ && path.poses.back().pose == path_back_));
+  }
+
+  /**
+   * @brief Remember the identity of a new path version
+   * @param path Path to track
+   */
+  void rememberPath(const nav_msgs::msg::Path & path)
+  {
+    path_size_ = path.poses.size();
+    path_stamp_ = path.header.stamp;
+    path_frame_ = path.header.frame_id;
+    if (path_size_ > 0) {
+      path_front_ = path.poses.front().pose;
+      path_back_ = path.poses.back().pose;
+    }
+  }
+
+  /**
+   * @brief Constant-time check whether a goal list matches the tracked version
+   * @param goals Goal list to compare against the remembered identity
+   * @return True if size and end goals all match
+   */
+  bool sameGoals(const std::vector<geometry_msgs::msg::PoseStamped> & goals) const
+  {
+    return goals.size() == goals_size_ &&
+           (goals_size_ == 0 ||
+           (goals.front() == goals_front_ && goals.back() == goals_back_));
+  }
+
+  /**
+   * @brief Remember the identity of a new goal list version
+   * @param goals Goal list to track
+   */
+  void rememberGoals(const std::vector<geometry_msgs::msg::PoseStamped> & goals)
+  {
+    goals_size_ = goals.size();
+    if (goals_size_ > 0) {
+      goals_front_ = goals.front();
+      goals_back_ = goals.back();
+    }
+  }
+
+  size_t path_size_{0};
+  builtin_interfaces::msg::Time path_stamp_;
+  std::string path_frame_;
+  geometry_msgs::msg::Pose path_front_;
+  geometry_msgs::msg::Pose path_back_;
+  size_t closest_index_{0};
+
+  size_t goals_size_{0};
+  geometry_msgs::msg::PoseStamped goals_front_;
+  geometry_msgs::msg::PoseStamped goals_back_;
+  size_t first_active_goal_{0};
+};
+
+}  // namespace nav2_behavior_tree
+
+#endif  // NAV2_BEHAVIOR_TREE__PATH_PROGRESS_TRACKER_HPP_
@@ -17,7 +17,7 @@
 
 #include <string>
 
-#include "nav2_behavior_tree/bt_service_node.hpp"
+#include "nav2_behavior_tree/bt_async_service_node.hpp"
 #include "nav2_msgs/srv/clear_entire_costmap.hpp"
 #include "nav2_msgs/srv/clear_costmap_around_robot.hpp"
 #include "nav2_msgs/srv/clear_costmap_except_region.hpp"
@@ -26,9 +26,9 @@ namespace nav2_behavior_tree
 {
 
 /**
- * @brief A nav2_behavior_tree::BtServiceNode class that wraps nav2_msgs::srv::ClearEntireCostmap
+ * @brief A nav2_behavior_tree::BtAsyncServiceNode class that wraps nav2_msgs::srv::ClearEntireCostmap
  */
-class ClearEntireCostmapService : public BtServiceNode<nav2_msgs::srv::ClearEntireCostmap>
+class ClearEntireCostmapService : public BtAsyncServiceNode<nav2_msgs::srv::ClearEntireCostmap>
 {
 public:
   /**
@@ -48,11 +48,11 @@ public:
 };
 
 /**
- * @brief A nav2_behavior_tree::BtServiceNode class that
+ * @brief A nav2_behavior_tree::BtAsyncServiceNode class that
  * wraps nav2_msgs::srv::ClearCostmapExceptRegion
  */
 class ClearCostmapExceptRegionService
-  : public BtServiceNode<nav2_msgs::srv::ClearCostmapExceptRegion>
+  : public BtAsyncServiceNode<nav2_msgs::srv::ClearCostmapExceptRegion>
 {
 public:
   /**
@@ -86,10 +86,10 @@ public:
 };
 
 /**
- * @brief A nav2_behavior_tree::BtServiceNode class that
+ * @brief A nav2_behavior_tree::BtAsyncServiceNode class that
  * wraps nav2_msgs::srv::ClearCostmapAroundRobot
  */
-class ClearCostmapAroundRobotService : public BtServiceNode<nav2_msgs::srv::ClearCostmapAroundRobot>
+class ClearCostmapAroundRobotService : public BtAsyncServiceNode<nav2_msgs::srv::ClearCostmapAroundRobot>
 {
 public:
   /**
@@ -20,6 +20,7 @@
 
 #include "nav2_msgs/action/follow_path.hpp"
 #include "nav2_behavior_tree/bt_action_node.hpp"
+#include "nav2_behavior_tree/bt_utils.hpp"
 
 namespace nav2_behavior_tree
 {
@@ -80,7 +81,7 @@ public:
   {
     return providedBasicPorts(
       {
-        BT::InputPort<nav_msgs::msg::Path>("path", "Path to follow"),
+        BT::InputPort<PathPtr>("path", "Path to follow"),
         BT::InputPort<std::string>("controller_id", ""),
         BT::InputPort<std::string>("goal_checker_id", ""),
         BT::InputPort<std::string>("progress_checker_id", ""),
@@ -88,6 +89,11 @@ public:
           "error_code_id", "The follow path error code"),
       });
   }
+
+private:
+  // Path currently carried by the goal, kept to detect replans by pointer
+  // identity instead of comparing whole messages
+  PathPtr current_path_;
 };
 
 }  // namespace nav2_behavior_tree
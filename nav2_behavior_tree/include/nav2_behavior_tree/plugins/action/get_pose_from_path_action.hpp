@@ -23,7 +23,8 @@
 #include "nav2_util/geometry_utils.hpp"
 #include "nav2_util/robot_utils.hpp"
 #include "behaviortree_cpp/action_node.h"
-#include "nav_msgs/msg/path.h"
+
+#include "nav2_behavior_tree/bt_utils.hpp"
 
 namespace nav2_behavior_tree
 {
@@ -39,7 +40,7 @@ public:
   static BT::PortsList providedPorts()
   {
     return {
-      BT::InputPort<nav_msgs::msg::Path>("path", "Path to extract pose from"),
+      BT::InputPort<PathPtr>("path", "Path to extract pose from"),
       BT::OutputPort<geometry_msgs::msg::PoseStamped>("pose", "Stamped Extracted Pose"),
       BT::InputPort<int>("index", 0, "Index of pose to extract from. -1 is end of list"),
     };
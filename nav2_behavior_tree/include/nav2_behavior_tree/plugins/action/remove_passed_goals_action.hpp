@@ -24,6 +24,8 @@
 #include "nav2_util/robot_utils.hpp"
 #include "behaviortree_cpp/action_node.h"
 
+#include "nav2_behavior_tree/path_progress_tracker.hpp"
+
 namespace nav2_behavior_tree
 {
 
@@ -61,6 +63,7 @@ private:
   std::shared_ptr<tf2_ros::Buffer> tf_;
   std::string robot_base_frame_;
   bool initialized_;
+  std::shared_ptr<PathProgressTracker> path_progress_;
 };
 
 }  // namespace nav2_behavior_tree
@@ -21,6 +21,7 @@
 #include "nav2_msgs/action/smooth_path.hpp"
 #include "nav_msgs/msg/path.h"
 #include "nav2_behavior_tree/bt_action_node.hpp"
+#include "nav2_behavior_tree/bt_utils.hpp"
 
 namespace nav2_behavior_tree
 {
@@ -73,13 +74,13 @@ public:
   {
     return providedBasicPorts(
       {
-        BT::InputPort<nav_msgs::msg::Path>("unsmoothed_path", "Path to be smoothed"),
+        BT::InputPort<PathPtr>("unsmoothed_path", "Path to be smoothed"),
         BT::InputPort<double>("max_smoothing_duration", 3.0, "Maximum smoothing duration"),
         BT::InputPort<bool>(
           "check_for_collisions", false,
           "If true collision check will be performed after smoothing"),
         BT::InputPort<std::string>("smoother_id", ""),
-        BT::OutputPort<nav_msgs::msg::Path>(
+        BT::OutputPort<PathPtr>(
           "smoothed_path",
           "Path smoothed by SmootherServer node"),
         BT::OutputPort<double>("smoothing_duration", "Time taken to smooth path"),
@@ -23,6 +23,8 @@
 
 #include "behaviortree_cpp/action_node.h"
 
+#include "nav2_behavior_tree/bt_utils.hpp"
+
 namespace nav2_behavior_tree
 {
 
@@ -48,8 +50,8 @@ public:
   static BT::PortsList providedPorts()
   {
     return {
-      BT::InputPort<nav_msgs::msg::Path>("input_path", "Original Path"),
-      BT::OutputPort<nav_msgs::msg::Path>("output_path", "Path truncated to a certain distance"),
+      BT::InputPort<PathPtr>("input_path", "Original Path"),
+      BT::OutputPort<PathPtr>("output_path", "Path truncated to a certain distance"),
       BT::InputPort<double>("distance", 1.0, "distance"),
     };
   }
@@ -25,6 +25,9 @@
 #include "behaviortree_cpp/action_node.h"
 #include "tf2_ros/buffer.h"
 
+#include "nav2_behavior_tree/bt_utils.hpp"
+#include "nav2_behavior_tree/path_progress_tracker.hpp"
+
 namespace nav2_behavior_tree
 {
 
@@ -50,8 +53,8 @@ public:
   static BT::PortsList providedPorts()
   {
     return {
-      BT::InputPort<nav_msgs::msg::Path>("input_path", "Original Path"),
-      BT::OutputPort<nav_msgs::msg::Path>(
+      BT::InputPort<PathPtr>("input_path", "Original Path"),
+      BT::OutputPort<PathPtr>(
         "output_path", "Path truncated to a certain distance around robot"),
       BT::InputPort<double>(
         "distance_forward", 8.0,
@@ -100,23 +103,10 @@ private:
    */
   bool getRobotPose(std::string path_frame_id, geometry_msgs::msg::PoseStamped & pose);
 
-  /**
-   * @brief A custom pose distance method which takes angular distance into account
-   * in addition to spatial distance (to improve picking a correct pose near cusps and loops)
-   * @param pose1 Distance is computed between this pose and pose2
-   * @param pose2 Distance is computed between this pose and pose1
-   * @param angular_distance_weight Weight of angular distance relative to spatial distance
-   * (1.0 means that 1 radian of angular distance corresponds to 1 meter of spatial distance)
-   */
-  static double poseDistance(
-    const geometry_msgs::msg::PoseStamped & pose1,
-    const geometry_msgs::msg::PoseStamped & pose2,
-    const double angular_distance_weight);
-
   std::shared_ptr<tf2_ros::Buffer> tf_buffer_;
 
-  nav_msgs::msg::Path path_;
-  nav_msgs::msg::Path::_poses_type::iterator closest_pose_detection_begin_;
+  PathPtr path_;
+  std::shared_ptr<PathProgressTracker> path_progress_;
 };
 
 }  // namespace nav2_behavior_tree
@@ -20,6 +20,7 @@
 
 #include "rclcpp/rclcpp.hpp"
 #include "behaviortree_cpp/condition_node.h"
+#include "nav2_behavior_tree/bt_utils.hpp"
 #include "geometry_msgs/msg/pose_stamped.hpp"
 #include "nav2_msgs/srv/is_path_valid.hpp"
 
@@ -62,7 +63,7 @@ public:
   static BT::PortsList providedPorts()
   {
     return {
-      BT::InputPort<nav_msgs::msg::Path>("path", "Path to Check"),
+      BT::InputPort<PathPtr>("path", "Path to Check"),
       BT::InputPort<std::chrono::milliseconds>("server_timeout")
     };
   }
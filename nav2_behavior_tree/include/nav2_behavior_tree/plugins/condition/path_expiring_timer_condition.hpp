@@ -19,6 +19,7 @@
 
 #include "rclcpp/rclcpp.hpp"
 #include "behaviortree_cpp/condition_node.h"
+#include "nav2_behavior_tree/bt_utils.hpp"
 #include "nav_msgs/msg/path.hpp"
 
 namespace nav2_behavior_tree
@@ -56,14 +57,14 @@ public:
   {
     return {
       BT::InputPort<double>("seconds", 1.0, "Seconds"),
-      BT::InputPort<nav_msgs::msg::Path>("path")
+      BT::InputPort<PathPtr>("path")
     };
   }
 
 private:
   rclcpp::Node::SharedPtr node_;
   rclcpp::Time start_;
-  nav_msgs::msg::Path prev_path_;
+  PathPtr prev_path_;
   double period_;
   bool first_time_;
 };
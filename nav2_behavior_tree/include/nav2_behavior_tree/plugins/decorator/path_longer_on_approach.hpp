@@ -22,6 +22,7 @@
 #include "geometry_msgs/msg/pose_stamped.hpp"
 #include "nav_msgs/msg/path.hpp"
 #include "behaviortree_cpp/decorator_node.h"
+#include "nav2_behavior_tree/bt_utils.hpp"
 #include "rclcpp/rclcpp.hpp"
 
 namespace nav2_behavior_tree
@@ -50,7 +51,7 @@ public:
   static BT::PortsList providedPorts()
   {
     return {
-      BT::InputPort<nav_msgs::msg::Path>("path", "Planned Path"),
+      BT::InputPort<PathPtr>("path", "Planned Path"),
       BT::InputPort<double>(
         "prox_len", 3.0,
         "Proximity length (m) for the path to be longer on approach"),
@@ -74,8 +75,8 @@ private:
    * @return whether the path is updated for the current goal
    */
   bool isPathUpdated(
-    nav_msgs::msg::Path & new_path,
-    nav_msgs::msg::Path & old_path);
+    const PathPtr & new_path,
+    const PathPtr & old_path);
 
   /**
    * @brief Checks if the robot is in the goal proximity
@@ -84,7 +85,7 @@ private:
    * @return whether the robot is in the goal proximity
    */
   bool isRobotInGoalProximity(
-    nav_msgs::msg::Path & old_path,
+    const PathPtr & old_path,
     double & prox_leng);
 
   /**
@@ -95,13 +96,13 @@ private:
    * @return whether the new path is longer
    */
   bool isNewPathLonger(
-    nav_msgs::msg::Path & new_path,
-    nav_msgs::msg::Path & old_path,
+    const PathPtr & new_path,
+    const PathPtr & old_path,
     double & length_factor);
 
 private:
-  nav_msgs::msg::Path new_path_;
-  nav_msgs::msg::Path old_path_;
+  PathPtr new_path_;
+  PathPtr old_path_;
   double prox_len_ = std::numeric_limits<double>::max();
   double length_factor_ = std::numeric_limits<double>::max();
   rclcpp::Node::SharedPtr node_;
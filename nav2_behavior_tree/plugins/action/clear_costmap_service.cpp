@@ -23,7 +23,7 @@ namespace nav2_behavior_tree
 ClearEntireCostmapService::ClearEntireCostmapService(
   const std::string & service_node_name,
   const BT::NodeConfiguration & conf)
-: BtServiceNode<nav2_msgs::srv::ClearEntireCostmap>(service_node_name, conf)
+: BtAsyncServiceNode<nav2_msgs::srv::ClearEntireCostmap>(service_node_name, conf)
 {
 }
 
@@ -35,7 +35,7 @@ void ClearEntireCostmapService::on_tick()
 ClearCostmapExceptRegionService::ClearCostmapExceptRegionService(
   const std::string & service_node_name,
   const BT::NodeConfiguration & conf)
-: BtServiceNode<nav2_msgs::srv::ClearCostmapExceptRegion>(service_node_name, conf)
+: BtAsyncServiceNode<nav2_msgs::srv::ClearCostmapExceptRegion>(service_node_name, conf)
 {
 }
 
@@ -48,7 +48,7 @@ void ClearCostmapExceptRegionService::on_tick()
 ClearCostmapAroundRobotService::ClearCostmapAroundRobotService(
   const std::string & service_node_name,
   const BT::NodeConfiguration & conf)
-: BtServiceNode<nav2_msgs::srv::ClearCostmapAroundRobot>(service_node_name, conf)
+: BtAsyncServiceNode<nav2_msgs::srv::ClearCostmapAroundRobot>(service_node_name, conf)
 {
 }
 
@@ -31,16 +31,17 @@ ComputePathThroughPosesAction::ComputePathThroughPosesAction(
 
 void ComputePathThroughPosesAction::on_tick()
 {
-  getInput("goals", goal_.goals);
-  getInput("planner_id", goal_.planner_id);
-  if (getInput("start", goal_.start)) {
+  getInputCached("goals", goal_.goals);
+  getInputCached("planner_id", goal_.planner_id);
+  if (getInputCached("start", goal_.start)) {
     goal_.use_start = true;
   }
 }
 
 BT::NodeStatus ComputePathThroughPosesAction::on_success()
 {
-  setOutput("path", result_.result->path);
+  // hand the freshly planned path over by pointer; consumers never mutate it
+  setOutput("path", std::make_shared<const nav_msgs::msg::Path>(std::move(result_.result->path)));
   // Set empty error code, action was successful
   setOutput("error_code_id", ActionResult::NONE);
   return BT::NodeStatus::SUCCESS;
@@ -48,16 +49,14 @@ BT::NodeStatus ComputePathThroughPosesAction::on_success()
 
 BT::NodeStatus ComputePathThroughPosesAction::on_aborted()
 {
-  nav_msgs::msg::Path empty_path;
-  setOutput("path", empty_path);
+  setOutput("path", std::make_shared<const nav_msgs::msg::Path>());
   setOutput("error_code_id", result_.result->error_code);
   return BT::NodeStatus::FAILURE;
 }
 
 BT::NodeStatus ComputePathThroughPosesAction::on_cancelled()
 {
-  nav_msgs::msg::Path empty_path;
-  setOutput("path", empty_path);
+  setOutput("path", std::make_shared<const nav_msgs::msg::Path>());
   // Set empty error code, action was cancelled
   setOutput("error_code_id", ActionResult::NONE);
   return BT::NodeStatus::SUCCESS;
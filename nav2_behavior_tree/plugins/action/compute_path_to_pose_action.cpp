@@ -30,16 +30,17 @@ ComputePathToPoseAction::ComputePathToPoseAction(
 
 void ComputePathToPoseAction::on_tick()
 {
-  getInput("goal", goal_.goal);
-  getInput("planner_id", goal_.planner_id);
-  if (getInput("start", goal_.start)) {
+  getInputCached("goal", goal_.goal);
+  getInputCached("planner_id", goal_.planner_id);
+  if (getInputCached("start", goal_.start)) {
     goal_.use_start = true;
   }
 }
 
 BT::NodeStatus ComputePathToPoseAction::on_success()
 {
-  setOutput("path", result_.result->path);
+  // hand the freshly planned path over by pointer; consumers never mutate it
+  setOutput("path", std::make_shared<const nav_msgs::msg::Path>(std::move(result_.result->path)));
   // Set empty error code, action was successful
   setOutput("error_code_id", ActionResult::NONE);
   return BT::NodeStatus::SUCCESS;
@@ -47,16 +48,14 @@ BT::NodeStatus ComputePathToPoseAction::on_success()
 
 BT::NodeStatus ComputePathToPoseAction::on_aborted()
 {
-  nav_msgs::msg::Path empty_path;
-  setOutput("path", empty_path);
+  setOutput("path", std::make_shared<const nav_msgs::msg::Path>());
   setOutput("error_code_id", result_.result->error_code);
   return BT::NodeStatus::FAILURE;
 }
 
 BT::NodeStatus ComputePathToPoseAction::on_cancelled()
 {
-  nav_msgs::msg::Path empty_path;
-  setOutput("path", empty_path);
+  setOutput("path", std::make_shared<const nav_msgs::msg::Path>());
   // Set empty error code, action was cancelled
   setOutput("error_code_id", ActionResult::NONE);
   return BT::NodeStatus::SUCCESS;
@@ -64,8 +63,7 @@ BT::NodeStatus ComputePathToPoseAction::on_cancelled()
 
 void ComputePathToPoseAction::halt()
 {
-  nav_msgs::msg::Path empty_path;
-  setOutput("path", empty_path);
+  setOutput("path", std::make_shared<const nav_msgs::msg::Path>());
   BtActionNode::halt();
 }
 
@@ -30,7 +30,11 @@ FollowPathAction::FollowPathAction(
 
 void FollowPathAction::on_tick()
 {
-  getInput("path", goal_.path);
+  getInput("path", current_path_);
+  if (current_path_) {
+    // the action goal owns its own copy; the shared path stays untouched
+    goal_.path = *current_path_;
+  }
   getInput("controller_id", goal_.controller_id);
   getInput("goal_checker_id", goal_.goal_checker_id);
   getInput("progress_checker_id", goal_.progress_checker_id);
@@ -58,14 +62,15 @@ BT::NodeStatus FollowPathAction::on_cancelled()
 void FollowPathAction::on_wait_for_result(
   std::shared_ptr<const Action::Feedback>/*feedback*/)
 {
-  // Grab the new path
-  nav_msgs::msg::Path new_path;
+  // Grab the new path; a replan always allocates a fresh path object,
+  // so pointer identity is enough to detect it
+  PathPtr new_path;
   getInput("path", new_path);
 
-  // Check if it is not same with the current one
-  if (goal_.path != new_path) {
+  if (new_path && new_path != current_path_) {
     // the action server on the next loop iteration
-    goal_.path = new_path;
+    current_path_ = new_path;
+    goal_.path = *new_path;
     goal_updated_ = true;
   }
 
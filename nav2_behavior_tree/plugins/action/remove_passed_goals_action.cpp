@@ -43,6 +43,9 @@ void RemovePassedGoals::initialize()
 
   robot_base_frame_ = BT::deconflictPortAndParamFrame<std::string>(
     node, "robot_base_frame", this);
+
+  path_progress_ = PathProgressTracker::getShared(config().blackboard);
+  initialized_ = true;
 }
 
 inline BT::NodeStatus RemovePassedGoals::tick()
@@ -61,8 +64,6 @@ inline BT::NodeStatus RemovePassedGoals::tick()
     return BT::NodeStatus::SUCCESS;
   }
 
-  using namespace nav2_util::geometry_utils;  // NOLINT
-
   geometry_msgs::msg::PoseStamped current_pose;
   if (!nav2_util::getCurrentPose(
       current_pose, *tf_, goal_poses[0].header.frame_id, robot_base_frame_,
@@ -71,15 +72,12 @@ inline BT::NodeStatus RemovePassedGoals::tick()
     return BT::NodeStatus::FAILURE;
   }
 
-  double dist_to_goal;
-  while (goal_poses.size() > 1) {
-    dist_to_goal = euclidean_distance(goal_poses[0].pose, current_pose.pose);
-
-    if (dist_to_goal > viapoint_achieved_radius_) {
-      break;
-    }
-
-    goal_poses.erase(goal_poses.begin());
+  // resume from the progress shared with the other path nodes rather than
+  // rechecking every goal, and drop all passed goals in one erase
+  size_t first_active = path_progress_->firstActiveGoal(
+    goal_poses, current_pose, viapoint_achieved_radius_);
+  if (first_active > 0) {
+    goal_poses.erase(goal_poses.begin(), goal_poses.begin() + first_active);
   }
 
   setOutput("output_goals", goal_poses);
@@ -31,7 +31,11 @@ SmoothPathAction::SmoothPathAction(
 
 void SmoothPathAction::on_tick()
 {
-  getInput("unsmoothed_path", goal_.path);
+  PathPtr path;
+  getInput("unsmoothed_path", path);
+  if (path) {
+    goal_.path = *path;
+  }
   getInput("smoother_id", goal_.smoother_id);
   double max_smoothing_duration;
   getInput("max_smoothing_duration", max_smoothing_duration);
@@ -41,7 +45,9 @@ void SmoothPathAction::on_tick()
 
 BT::NodeStatus SmoothPathAction::on_success()
 {
-  setOutput("smoothed_path", result_.result->path);
+  setOutput(
+    "smoothed_path",
+    std::make_shared<const nav_msgs::msg::Path>(std::move(result_.result->path)));
   setOutput("smoothing_duration", rclcpp::Duration(result_.result->smoothing_duration).seconds());
   setOutput("was_completed", result_.result->was_completed);
   // Set empty error code, action was successful
@@ -40,15 +40,19 @@ inline BT::NodeStatus TruncatePath::tick()
   setStatus(BT::NodeStatus::RUNNING);
   getInput("distance", distance_);
 
-  nav_msgs::msg::Path input_path;
+  PathPtr path_ptr;
 
-  getInput("input_path", input_path);
+  getInput("input_path", path_ptr);
 
-  if (input_path.poses.empty()) {
-    setOutput("output_path", input_path);
+  if (!path_ptr || path_ptr->poses.empty()) {
+    setOutput(
+      "output_path", path_ptr ? path_ptr : std::make_shared<const nav_msgs::msg::Path>());
     return BT::NodeStatus::SUCCESS;
   }
 
+  // copy-on-write: truncation mutates, so work on a fresh path
+  nav_msgs::msg::Path input_path = *path_ptr;
+
   geometry_msgs::msg::PoseStamped final_pose = input_path.poses.back();
 
   double distance_to_goal = nav2_util::geometry_utils::euclidean_distance(
@@ -75,7 +79,8 @@ inline BT::NodeStatus TruncatePath::tick()
   input_path.poses.back().pose.orientation = nav2_util::geometry_utils::orientationAroundZAxis(
     final_angle);
 
-  setOutput("output_path", input_path);
+  setOutput(
+    "output_path", std::make_shared<const nav_msgs::msg::Path>(std::move(input_path)));
 
   return BT::NodeStatus::SUCCESS;
 }
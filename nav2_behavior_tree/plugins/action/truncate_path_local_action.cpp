@@ -24,7 +24,6 @@
 #include "nav2_util/robot_utils.hpp"
 #include "nav_msgs/msg/path.hpp"
 #include "rclcpp/rclcpp.hpp"
-#include "tf2/LinearMath/Quaternion.h"
 #include "tf2_ros/buffer.h"
 #include "tf2_ros/create_timer_ros.h"
 
@@ -41,6 +40,7 @@ TruncatePathLocal::TruncatePathLocal(
   tf_buffer_ =
     config().blackboard->template get<std::shared_ptr<tf2_ros::Buffer>>(
     "tf_buffer");
+  path_progress_ = PathProgressTracker::getShared(config().blackboard);
 }
 
 inline BT::NodeStatus TruncatePathLocal::tick()
@@ -58,53 +58,51 @@ inline BT::NodeStatus TruncatePathLocal::tick()
   getInput("max_robot_pose_search_dist", max_robot_pose_search_dist);
 
   bool path_pruning = std::isfinite(max_robot_pose_search_dist);
-  nav_msgs::msg::Path new_path;
-  getInput("input_path", new_path);
-  if (!path_pruning || new_path != path_) {
-    path_ = new_path;
-    closest_pose_detection_begin_ = path_.poses.begin();
+  getInput("input_path", path_);
+
+  if (!path_) {
+    path_ = std::make_shared<const nav_msgs::msg::Path>();
   }
 
-  if (!getRobotPose(path_.header.frame_id, pose)) {
+  if (!getRobotPose(path_->header.frame_id, pose)) {
     return BT::NodeStatus::FAILURE;
   }
 
-  if (path_.poses.empty()) {
+  if (path_->poses.empty()) {
     setOutput("output_path", path_);
     return BT::NodeStatus::SUCCESS;
   }
 
-  auto closest_pose_detection_end = path_.poses.end();
-  if (path_pruning) {
-    closest_pose_detection_end = nav2_util::geometry_utils::first_after_integrated_distance(
-      closest_pose_detection_begin_, path_.poses.end(), max_robot_pose_search_dist);
-  }
-
   // find the closest pose on the path
-  auto current_pose = nav2_util::geometry_utils::min_by(
-    closest_pose_detection_begin_, closest_pose_detection_end,
-    [&pose, angular_distance_weight](const geometry_msgs::msg::PoseStamped & ps) {
-      return poseDistance(pose, ps, angular_distance_weight);
-    });
-
+  nav_msgs::msg::Path::_poses_type::const_iterator current_pose;
   if (path_pruning) {
-    closest_pose_detection_begin_ = current_pose;
+    // resume the search from the progress shared with the other path nodes
+    current_pose = path_->poses.begin() + path_progress_->closestIndex(
+      *path_, pose, angular_distance_weight, max_robot_pose_search_dist);
+  } else {
+    current_pose = nav2_util::geometry_utils::min_by(
+      path_->poses.begin(), path_->poses.end(),
+      [&pose, angular_distance_weight](const geometry_msgs::msg::PoseStamped & ps) {
+        return PathProgressTracker::poseDistance(pose, ps, angular_distance_weight);
+      });
   }
 
   // expand forwards to extract desired length
   auto forward_pose_it = nav2_util::geometry_utils::first_after_integrated_distance(
-    current_pose, path_.poses.end(), distance_forward);
+    current_pose, path_->poses.end(), distance_forward);
 
   // expand backwards to extract desired length
   // Note: current_pose + 1 is used because reverse iterator points to a cell before it
   auto backward_pose_it = nav2_util::geometry_utils::first_after_integrated_distance(
-    std::reverse_iterator(current_pose + 1), path_.poses.rend(), distance_backward);
+    std::reverse_iterator(current_pose + 1), path_->poses.rend(), distance_backward);
 
+  // copy-on-write: the truncated window is a fresh path
   nav_msgs::msg::Path output_path;
-  output_path.header = path_.header;
+  output_path.header = path_->header;
   output_path.poses = std::vector<geometry_msgs::msg::PoseStamped>(
     backward_pose_it.base(), forward_pose_it);
-  setOutput("output_path", output_path);
+  setOutput(
+    "output_path", std::make_shared<const nav_msgs::msg::Path>(std::move(output_path)));
 
   return BT::NodeStatus::SUCCESS;
 }
@@ -134,24 +132,6 @@ inline bool TruncatePathLocal::getRobotPose(
   return true;
 }
 
-double
-TruncatePathLocal::poseDistance(
-  const geometry_msgs::msg::PoseStamped & pose1,
-  const geometry_msgs::msg::PoseStamped & pose2,
-  const double angular_distance_weight)
-{
-  double dx = pose1.pose.position.x - pose2.pose.position.x;
-  double dy = pose1.pose.position.y - pose2.pose.position.y;
-  // taking angular distance into account in addition to spatial distance
-  // (to improve picking a correct pose near cusps and loops)
-  tf2::Quaternion q1;
-  tf2::convert(pose1.pose.orientation, q1);
-  tf2::Quaternion q2;
-  tf2::convert(pose2.pose.orientation, q2);
-  double da = angular_distance_weight * std::abs(q1.angleShortestPath(q2));
-  return std::sqrt(dx * dx + dy * dy + da * da);
-}
-
 }  // namespace nav2_behavior_tree
 
 #include "behaviortree_cpp/bt_factory.h"
@@ -44,12 +44,15 @@ BT::NodeStatus IsPathValidCondition::tick()
     initialize();
   }
 
-  nav_msgs::msg::Path path;
+  PathPtr path;
   getInput("path", path);
 
   auto request = std::make_shared<nav2_msgs::srv::IsPathValid::Request>();
 
-  request->path = path;
+  if (path) {
+    // the service request owns its own copy; the shared path stays untouched
+    request->path = *path;
+  }
   auto result = client_->async_send_request(request);
 
   if (rclcpp::spin_until_future_complete(node_, result, server_timeout_) ==
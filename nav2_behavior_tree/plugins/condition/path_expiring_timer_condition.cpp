@@ -42,8 +42,9 @@ BT::NodeStatus PathExpiringTimerCondition::tick()
     return BT::NodeStatus::FAILURE;
   }
 
-  // Grab the new path
-  nav_msgs::msg::Path path;
+  // Grab the new path; a replan always allocates a fresh path object,
+  // so pointer identity is enough to detect it
+  PathPtr path;
   getInput("path", path);
 
   // Reset timer if the path has been updated
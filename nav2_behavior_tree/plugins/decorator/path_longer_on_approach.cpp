@@ -28,32 +28,35 @@ PathLongerOnApproach::PathLongerOnApproach(
 : BT::DecoratorNode(name, conf)
 {
   node_ = config().blackboard->get<rclcpp::Node::SharedPtr>("node");
+  old_path_ = std::make_shared<const nav_msgs::msg::Path>();
 }
 
 bool PathLongerOnApproach::isPathUpdated(
-  nav_msgs::msg::Path & new_path,
-  nav_msgs::msg::Path & old_path)
+  const PathPtr & new_path,
+  const PathPtr & old_path)
 {
-  return new_path != old_path && old_path.poses.size() != 0 &&
-         new_path.poses.size() != 0 &&
-         old_path.poses.back().pose == new_path.poses.back().pose;
+  // a replan always allocates a fresh path object, so pointer identity is
+  // enough to detect an update
+  return new_path != old_path && old_path->poses.size() != 0 &&
+         new_path->poses.size() != 0 &&
+         old_path->poses.back().pose == new_path->poses.back().pose;
 }
 
 bool PathLongerOnApproach::isRobotInGoalProximity(
-  nav_msgs::msg::Path & old_path,
+  const PathPtr & old_path,
   double & prox_leng)
 {
-  return nav2_util::geometry_utils::calculate_path_length(old_path, 0) < prox_leng;
+  return nav2_util::geometry_utils::calculate_path_length(*old_path, 0) < prox_leng;
 }
 
 bool PathLongerOnApproach::isNewPathLonger(
-  nav_msgs::msg::Path & new_path,
-  nav_msgs::msg::Path & old_path,
+  const PathPtr & new_path,
+  const PathPtr & old_path,
   double & length_factor)
 {
-  return nav2_util::geometry_utils::calculate_path_length(new_path, 0) >
+  return nav2_util::geometry_utils::calculate_path_length(*new_path, 0) >
          length_factor * nav2_util::geometry_utils::calculate_path_length(
-    old_path, 0);
+    *old_path, 0);
 }
 
 inline BT::NodeStatus PathLongerOnApproach::tick()
@@ -62,9 +65,13 @@ inline BT::NodeStatus PathLongerOnApproach::tick()
   getInput("prox_len", prox_len_);
   getInput("length_factor", length_factor_);
 
+  if (!new_path_) {
+    new_path_ = std::make_shared<const nav_msgs::msg::Path>();
+  }
+
   if (first_time_ == false) {
-    if (old_path_.poses.empty() || new_path_.poses.empty() ||
-      old_path_.poses.back() != new_path_.poses.back())
+    if (old_path_->poses.empty() || new_path_->poses.empty() ||
+      old_path_->poses.back() != new_path_->poses.back())
     {
       first_time_ = true;
     }
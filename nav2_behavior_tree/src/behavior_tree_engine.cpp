@@ -21,6 +21,7 @@
 
 #include "rclcpp/rclcpp.hpp"
 #include "behaviortree_cpp/utils/shared_library.h"
+#include "nav2_util/trace.hpp"
 
 namespace nav2_behavior_tree
 {
@@ -36,6 +37,9 @@ BehaviorTreeEngine::BehaviorTreeEngine(
   // clock for throttled debug log
   clock_ = node->get_clock();
 
+  profiler_ = std::make_unique<BtProfiler>(node);
+  state_streamer_ = std::make_unique<BtStateStreamer>(node);
+
   // FIXME: the next two line are needed for back-compatibility with BT.CPP 3.8.x
   // Note that the can be removed, once we migrate from BT.CPP 4.5.x to 4.6+
   BT::ReactiveSequence::EnableException(false);
@@ -52,6 +56,10 @@ BehaviorTreeEngine::run(
   rclcpp::WallRate loopRate(loopTimeout);
   BT::NodeStatus result = BT::NodeStatus::RUNNING;
 
+  // no-op if this tree is already being profiled
+  profiler_->attach(*tree);
+  state_streamer_->attach(*tree);
+
   // Loop until something happens with ROS or the node completes
   try {
     while (rclcpp::ok() && result == BT::NodeStatus::RUNNING) {
@@ -60,7 +68,13 @@ BehaviorTreeEngine::run(
         return BtStatus::CANCELED;
       }
 
+      tick_count_++;
+      NAV2_TRACE("behavior_tree", "tick_begin", tick_count_);
       result = tree->tickOnce();
+      NAV2_TRACE("behavior_tree", "tick_end", tick_count_);
+
+      // ship this tick's status-change deltas, if anybody listens
+      state_streamer_->flush();
 
       onLoop();
 
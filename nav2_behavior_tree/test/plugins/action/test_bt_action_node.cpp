@@ -151,6 +151,11 @@ public:
     return BT::NodeStatus::SUCCESS;
   }
 
+  bool readOrderCached(int & order)
+  {
+    return getInputCached("order", order);
+  }
+
   static BT::PortsList providedPorts()
   {
     return providedBasicPorts({BT::InputPort<int>("order", "Fibonacci order")});
@@ -482,6 +487,42 @@ TEST_F(BTActionNodeTestFixture, test_server_cancel)
   EXPECT_EQ(ticks, 7);
 }
 
+TEST_F(BTActionNodeTestFixture, test_input_caching)
+{
+  // create tree with the order port remapped to a blackboard entry
+  std::string xml_txt =
+    R"(
+      <root BTCPP_format="4">
+        <BehaviorTree ID="MainTree">
+            <Fibonacci order="{order}" />
+        </BehaviorTree>
+      </root>)";
+
+  config_->blackboard->set<std::chrono::milliseconds>("server_timeout", 20ms);
+  config_->blackboard->set<std::chrono::milliseconds>("bt_loop_duration", 10ms);
+  config_->blackboard->set("order", 3);
+
+  tree_ = std::make_shared<BT::Tree>(factory_->createTreeFromText(xml_txt, config_->blackboard));
+
+  auto * fibonacci = dynamic_cast<FibonacciAction *>(tree_->rootNode());
+  ASSERT_NE(fibonacci, nullptr);
+
+  // the first read converts the entry
+  int order = 0;
+  EXPECT_TRUE(fibonacci->readOrderCached(order));
+  EXPECT_EQ(order, 3);
+
+  // while the entry is unchanged, the destination is not rewritten
+  order = -1;
+  EXPECT_TRUE(fibonacci->readOrderCached(order));
+  EXPECT_EQ(order, -1);
+
+  // a new write to the blackboard is picked up again
+  config_->blackboard->set("order", 5);
+  EXPECT_TRUE(fibonacci->readOrderCached(order));
+  EXPECT_EQ(order, 5);
+}
+
 int main(int argc, char ** argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
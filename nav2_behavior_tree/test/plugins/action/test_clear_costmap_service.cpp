@@ -14,6 +14,7 @@
 // limitations under the License.
 
 #include <gtest/gtest.h>
+#include <chrono>
 #include <memory>
 #include <set>
 #include <string>
@@ -108,7 +109,13 @@ TEST_F(ClearEntireCostmapServiceTestFixture, test_tick)
 
   tree_ = std::make_shared<BT::Tree>(factory_->createTreeFromText(xml_txt, config_->blackboard));
   EXPECT_EQ(config_->blackboard->get<int>("number_recoveries"), 0);
-  EXPECT_EQ(tree_->rootNode()->executeTick(), BT::NodeStatus::SUCCESS);
+  // the node is asynchronous, so it returns RUNNING until the response arrives
+  BT::NodeStatus status = tree_->rootNode()->executeTick();
+  while (status == BT::NodeStatus::RUNNING) {
+    rclcpp::sleep_for(std::chrono::milliseconds(1));
+    status = tree_->rootNode()->executeTick();
+  }
+  EXPECT_EQ(status, BT::NodeStatus::SUCCESS);
   EXPECT_EQ(config_->blackboard->get<int>("number_recoveries"), 1);
 }
 
@@ -203,7 +210,13 @@ TEST_F(ClearCostmapExceptRegionServiceTestFixture, test_tick)
 
   tree_ = std::make_shared<BT::Tree>(factory_->createTreeFromText(xml_txt, config_->blackboard));
   EXPECT_EQ(config_->blackboard->get<int>("number_recoveries"), 0);
-  EXPECT_EQ(tree_->rootNode()->executeTick(), BT::NodeStatus::SUCCESS);
+  // the node is asynchronous, so it returns RUNNING until the response arrives
+  BT::NodeStatus status = tree_->rootNode()->executeTick();
+  while (status == BT::NodeStatus::RUNNING) {
+    rclcpp::sleep_for(std::chrono::milliseconds(1));
+    status = tree_->rootNode()->executeTick();
+  }
+  EXPECT_EQ(status, BT::NodeStatus::SUCCESS);
   EXPECT_EQ(config_->blackboard->get<int>("number_recoveries"), 1);
 }
 //******************************************
@@ -298,7 +311,13 @@ TEST_F(ClearCostmapAroundRobotServiceTestFixture, test_tick)
 
   tree_ = std::make_shared<BT::Tree>(factory_->createTreeFromText(xml_txt, config_->blackboard));
   EXPECT_EQ(config_->blackboard->get<int>("number_recoveries"), 0);
-  EXPECT_EQ(tree_->rootNode()->executeTick(), BT::NodeStatus::SUCCESS);
+  // the node is asynchronous, so it returns RUNNING until the response arrives
+  BT::NodeStatus status = tree_->rootNode()->executeTick();
+  while (status == BT::NodeStatus::RUNNING) {
+    rclcpp::sleep_for(std::chrono::milliseconds(1));
+    status = tree_->rootNode()->executeTick();
+  }
+  EXPECT_EQ(status, BT::NodeStatus::SUCCESS);
   EXPECT_EQ(config_->blackboard->get<int>("number_recoveries"), 1);
 }
 
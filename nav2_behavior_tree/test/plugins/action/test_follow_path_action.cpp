@@ -130,7 +130,7 @@ TEST_F(FollowPathActionTestFixture, test_tick)
   nav_msgs::msg::Path path;
   path.poses.resize(1);
   path.poses[0].pose.position.x = 1.0;
-  config_->blackboard->set("path", path);
+  config_->blackboard->set("path", std::make_shared<const nav_msgs::msg::Path>(path));
 
   // tick until node succeeds
   while (tree_->rootNode()->status() != BT::NodeStatus::SUCCESS) {
@@ -150,7 +150,7 @@ TEST_F(FollowPathActionTestFixture, test_tick)
 
   // set new goal
   path.poses[0].pose.position.x = -2.5;
-  config_->blackboard->set("path", path);
+  config_->blackboard->set("path", std::make_shared<const nav_msgs::msg::Path>(path));
 
   while (tree_->rootNode()->status() != BT::NodeStatus::SUCCESS) {
     tree_->rootNode()->executeTick();
@@ -103,7 +103,7 @@ TEST_F(GetPoseFromPathTestFixture, test_tick)
   goals[1].pose.position.x = 2.0;
   path.poses = goals;
   path.header.frame_id = "test_frame_1";
-  config_->blackboard->set("path", path);
+  config_->blackboard->set("path", std::make_shared<const nav_msgs::msg::Path>(path));
 
   config_->blackboard->set("index", 0);
 
@@ -146,7 +146,7 @@ TEST_F(SmoothPathActionTestFixture, test_tick)
   pose.pose.position.x = -2.5;
   pose.pose.orientation.x = 1.0;
   path.poses.push_back(pose);
-  config_->blackboard->set("unsmoothed_path", path);
+  config_->blackboard->set("unsmoothed_path", std::make_shared<const nav_msgs::msg::Path>(path));
 
   while (tree_->rootNode()->status() != BT::NodeStatus::SUCCESS) {
     tree_->rootNode()->executeTick();
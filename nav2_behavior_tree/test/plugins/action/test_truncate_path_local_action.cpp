@@ -128,7 +128,7 @@ TEST_F(TruncatePathLocalTestFixture, test_tick)
   nav_msgs::msg::Path path = createLoopCrossingTestPath();
   EXPECT_EQ(path.poses.size(), 12u);
 
-  config_->blackboard->set("path", path);
+  config_->blackboard->set("path", std::make_shared<const nav_msgs::msg::Path>(path));
 
   // tick until node succeeds
   while (tree_->rootNode()->status() != BT::NodeStatus::SUCCESS &&
@@ -137,17 +137,17 @@ TEST_F(TruncatePathLocalTestFixture, test_tick)
     tree_->rootNode()->executeTick();
   }
 
-  nav_msgs::msg::Path truncated_path;
+  nav2_behavior_tree::PathPtr truncated_path;
   EXPECT_TRUE(config_->blackboard->get("truncated_path", truncated_path));
 
   EXPECT_EQ(tree_->rootNode()->status(), BT::NodeStatus::SUCCESS);
-  EXPECT_NE(path, truncated_path);
-  ASSERT_GE(truncated_path.poses.size(), 1u);
-  EXPECT_EQ(truncated_path.poses.size(), 3u);
-  EXPECT_EQ(truncated_path.poses.front().pose.position.x, -0.5);
-  EXPECT_EQ(truncated_path.poses.front().pose.position.y, 0.0);
-  EXPECT_EQ(truncated_path.poses.back().pose.position.x, 1.5);
-  EXPECT_EQ(truncated_path.poses.back().pose.position.y, 0.0);
+  EXPECT_NE(path, *truncated_path);
+  ASSERT_GE(truncated_path->poses.size(), 1u);
+  EXPECT_EQ(truncated_path->poses.size(), 3u);
+  EXPECT_EQ(truncated_path->poses.front().pose.position.x, -0.5);
+  EXPECT_EQ(truncated_path->poses.front().pose.position.y, 0.0);
+  EXPECT_EQ(truncated_path->poses.back().pose.position.x, 1.5);
+  EXPECT_EQ(truncated_path->poses.back().pose.position.y, 0.0);
 
   /////////////////////////////////////////
   // should match the first loop crossing
@@ -163,13 +163,13 @@ TEST_F(TruncatePathLocalTestFixture, test_tick)
   EXPECT_TRUE(config_->blackboard->get("truncated_path", truncated_path));
 
   EXPECT_EQ(tree_->rootNode()->status(), BT::NodeStatus::SUCCESS);
-  EXPECT_NE(path, truncated_path);
-  ASSERT_GE(truncated_path.poses.size(), 1u);
-  EXPECT_EQ(truncated_path.poses.size(), 2u);
-  EXPECT_EQ(truncated_path.poses.front().pose.position.x, -0.3);
-  EXPECT_EQ(truncated_path.poses.front().pose.position.y, 0.0);
-  EXPECT_EQ(truncated_path.poses.back().pose.position.x, -0.5);
-  EXPECT_EQ(truncated_path.poses.back().pose.position.y, 1.0);
+  EXPECT_NE(path, *truncated_path);
+  ASSERT_GE(truncated_path->poses.size(), 1u);
+  EXPECT_EQ(truncated_path->poses.size(), 2u);
+  EXPECT_EQ(truncated_path->poses.front().pose.position.x, -0.3);
+  EXPECT_EQ(truncated_path->poses.front().pose.position.y, 0.0);
+  EXPECT_EQ(truncated_path->poses.back().pose.position.x, -0.5);
+  EXPECT_EQ(truncated_path->poses.back().pose.position.y, 1.0);
 
   /////////////////////////////////////////
   // should match the last loop crossing
@@ -185,13 +185,13 @@ TEST_F(TruncatePathLocalTestFixture, test_tick)
   EXPECT_TRUE(config_->blackboard->get("truncated_path", truncated_path));
 
   EXPECT_EQ(tree_->rootNode()->status(), BT::NodeStatus::SUCCESS);
-  EXPECT_NE(path, truncated_path);
-  ASSERT_GE(truncated_path.poses.size(), 1u);
-  EXPECT_EQ(truncated_path.poses.size(), 2u);
-  EXPECT_EQ(truncated_path.poses.front().pose.position.x, 0.3);
-  EXPECT_EQ(truncated_path.poses.front().pose.position.y, 0.0);
-  EXPECT_EQ(truncated_path.poses.back().pose.position.x, 0.3);
-  EXPECT_EQ(truncated_path.poses.back().pose.position.y, -1.0);
+  EXPECT_NE(path, *truncated_path);
+  ASSERT_GE(truncated_path->poses.size(), 1u);
+  EXPECT_EQ(truncated_path->poses.size(), 2u);
+  EXPECT_EQ(truncated_path->poses.front().pose.position.x, 0.3);
+  EXPECT_EQ(truncated_path->poses.front().pose.position.y, 0.0);
+  EXPECT_EQ(truncated_path->poses.back().pose.position.x, 0.3);
+  EXPECT_EQ(truncated_path->poses.back().pose.position.y, -1.0);
 
   SUCCEED();
 }
@@ -224,7 +224,7 @@ TEST_F(TruncatePathLocalTestFixture, test_success_on_empty_path)
   path.header.stamp = node_->now();
   path.header.frame_id = "map";
 
-  config_->blackboard->set("path", path);
+  config_->blackboard->set("path", std::make_shared<const nav_msgs::msg::Path>(path));
 
   // tick until node succeeds
   while (tree_->rootNode()->status() != BT::NodeStatus::SUCCESS &&
@@ -232,11 +232,11 @@ TEST_F(TruncatePathLocalTestFixture, test_success_on_empty_path)
   {
     tree_->rootNode()->executeTick();
   }
-  nav_msgs::msg::Path truncated_path;
+  nav2_behavior_tree::PathPtr truncated_path;
   EXPECT_TRUE(config_->blackboard->get("truncated_path", truncated_path));
 
   EXPECT_EQ(tree_->rootNode()->status(), BT::NodeStatus::SUCCESS);
-  EXPECT_EQ(path, truncated_path);
+  EXPECT_EQ(path, *truncated_path);
   SUCCEED();
 }
 
@@ -267,7 +267,7 @@ TEST_F(TruncatePathLocalTestFixture, test_failure_on_no_pose)
   path.header.stamp = node_->now();
   path.header.frame_id = "map";
 
-  config_->blackboard->set("path", path);
+  config_->blackboard->set("path", std::make_shared<const nav_msgs::msg::Path>(path));
 
   // tick until node succeeds
   while (tree_->rootNode()->status() != BT::NodeStatus::SUCCESS &&
@@ -275,7 +275,7 @@ TEST_F(TruncatePathLocalTestFixture, test_failure_on_no_pose)
   {
     tree_->rootNode()->executeTick();
   }
-  nav_msgs::msg::Path truncated_path;
+  nav2_behavior_tree::PathPtr truncated_path;
   EXPECT_TRUE(config_->blackboard->get("truncated_path", truncated_path));
 
   EXPECT_EQ(tree_->rootNode()->status(), BT::NodeStatus::FAILURE);
@@ -308,7 +308,7 @@ TEST_F(TruncatePathLocalTestFixture, test_failure_on_invalid_robot_frame)
   nav_msgs::msg::Path path = createLoopCrossingTestPath();
   EXPECT_EQ(path.poses.size(), 12u);
 
-  config_->blackboard->set("path", path);
+  config_->blackboard->set("path", std::make_shared<const nav_msgs::msg::Path>(path));
 
   // tick until node succeeds
   while (tree_->rootNode()->status() != BT::NodeStatus::SUCCESS &&
@@ -316,7 +316,7 @@ TEST_F(TruncatePathLocalTestFixture, test_failure_on_invalid_robot_frame)
   {
     tree_->rootNode()->executeTick();
   }
-  nav_msgs::msg::Path truncated_path;
+  nav2_behavior_tree::PathPtr truncated_path;
   EXPECT_TRUE(config_->blackboard->get("truncated_path", truncated_path));
 
   EXPECT_EQ(tree_->rootNode()->status(), BT::NodeStatus::FAILURE);
@@ -348,9 +348,9 @@ TEST_F(TruncatePathLocalTestFixture, test_path_pruning)
 
   // create path and set it on blackboard
   nav_msgs::msg::Path path = createLoopCrossingTestPath();
-  nav_msgs::msg::Path truncated_path;
+  nav2_behavior_tree::PathPtr truncated_path;
 
-  config_->blackboard->set("path", path);
+  config_->blackboard->set("path", std::make_shared<const nav_msgs::msg::Path>(path));
 
   /////////////////////////////////////////
   // should match the first loop crossing
@@ -365,13 +365,13 @@ TEST_F(TruncatePathLocalTestFixture, test_path_pruning)
   EXPECT_TRUE(config_->blackboard->get("truncated_path", truncated_path));
 
   EXPECT_EQ(tree_->rootNode()->status(), BT::NodeStatus::SUCCESS);
-  EXPECT_NE(path, truncated_path);
-  ASSERT_GE(truncated_path.poses.size(), 1u);
-  EXPECT_EQ(truncated_path.poses.size(), 2u);
-  EXPECT_EQ(truncated_path.poses.front().pose.position.x, -0.3);
-  EXPECT_EQ(truncated_path.poses.front().pose.position.y, 0.0);
-  EXPECT_EQ(truncated_path.poses.back().pose.position.x, -0.5);
-  EXPECT_EQ(truncated_path.poses.back().pose.position.y, 1.0);
+  EXPECT_NE(path, *truncated_path);
+  ASSERT_GE(truncated_path->poses.size(), 1u);
+  EXPECT_EQ(truncated_path->poses.size(), 2u);
+  EXPECT_EQ(truncated_path->poses.front().pose.position.x, -0.3);
+  EXPECT_EQ(truncated_path->poses.front().pose.position.y, 0.0);
+  EXPECT_EQ(truncated_path->poses.back().pose.position.x, -0.5);
+  EXPECT_EQ(truncated_path->poses.back().pose.position.y, 1.0);
 
   /////////////////////////////////////////
   // move along the path to leave the first loop crossing behind
@@ -398,13 +398,13 @@ TEST_F(TruncatePathLocalTestFixture, test_path_pruning)
   EXPECT_TRUE(config_->blackboard->get("truncated_path", truncated_path));
 
   EXPECT_EQ(tree_->rootNode()->status(), BT::NodeStatus::SUCCESS);
-  EXPECT_NE(path, truncated_path);
-  ASSERT_GE(truncated_path.poses.size(), 1u);
-  EXPECT_EQ(truncated_path.poses.size(), 3u);
-  EXPECT_EQ(truncated_path.poses.front().pose.position.x, -0.5);
-  EXPECT_EQ(truncated_path.poses.front().pose.position.y, 0.0);
-  EXPECT_EQ(truncated_path.poses.back().pose.position.x, 1.5);
-  EXPECT_EQ(truncated_path.poses.back().pose.position.y, 0.0);
+  EXPECT_NE(path, *truncated_path);
+  ASSERT_GE(truncated_path->poses.size(), 1u);
+  EXPECT_EQ(truncated_path->poses.size(), 3u);
+  EXPECT_EQ(truncated_path->poses.front().pose.position.x, -0.5);
+  EXPECT_EQ(truncated_path->poses.front().pose.position.y, 0.0);
+  EXPECT_EQ(truncated_path->poses.back().pose.position.x, 1.5);
+  EXPECT_EQ(truncated_path->poses.back().pose.position.y, 0.0);
 
   /////////////////////////////////////////
   // move along the path to leave the second loop crossing behind
@@ -431,13 +431,13 @@ TEST_F(TruncatePathLocalTestFixture, test_path_pruning)
   EXPECT_TRUE(config_->blackboard->get("truncated_path", truncated_path));
 
   EXPECT_EQ(tree_->rootNode()->status(), BT::NodeStatus::SUCCESS);
-  EXPECT_NE(path, truncated_path);
-  ASSERT_GE(truncated_path.poses.size(), 1u);
-  EXPECT_EQ(truncated_path.poses.size(), 2u);
-  EXPECT_EQ(truncated_path.poses.front().pose.position.x, 0.3);
-  EXPECT_EQ(truncated_path.poses.front().pose.position.y, 0.0);
-  EXPECT_EQ(truncated_path.poses.back().pose.position.x, 0.3);
-  EXPECT_EQ(truncated_path.poses.back().pose.position.y, -1.0);
+  EXPECT_NE(path, *truncated_path);
+  ASSERT_GE(truncated_path->poses.size(), 1u);
+  EXPECT_EQ(truncated_path->poses.size(), 2u);
+  EXPECT_EQ(truncated_path->poses.front().pose.position.x, 0.3);
+  EXPECT_EQ(truncated_path->poses.front().pose.position.y, 0.0);
+  EXPECT_EQ(truncated_path->poses.back().pose.position.x, 0.3);
+  EXPECT_EQ(truncated_path->poses.back().pose.position.y, -1.0);
 
   SUCCEED();
 }
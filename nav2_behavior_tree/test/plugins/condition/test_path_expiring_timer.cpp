@@ -83,7 +83,7 @@ TEST_F(PathExpiringTimerConditionTestFixture, test_behavior)
   pose.pose.position.x = 1.0;
   path.poses.push_back(pose);
 
-  config_->blackboard->set("path", path);
+  config_->blackboard->set("path", std::make_shared<const nav_msgs::msg::Path>(path));
   EXPECT_EQ(bt_node_->executeTick(), BT::NodeStatus::FAILURE);
   rclcpp::sleep_for(1500ms);
   EXPECT_EQ(bt_node_->executeTick(), BT::NodeStatus::SUCCESS);
@@ -106,7 +106,7 @@ TEST_F(PathLongerOnApproachTestFixture, test_tick)
     // Assuming distance between waypoints to be 1.5m
     new_path.poses[i].pose.position.x = 1.5 * i;
   }
-  config_->blackboard->set("path", new_path);
+  config_->blackboard->set("path", std::make_shared<const nav_msgs::msg::Path>(new_path));
 
   tree_->rootNode()->executeTick();
   EXPECT_EQ(tree_->rootNode()->status(), BT::NodeStatus::SUCCESS);
@@ -132,7 +132,7 @@ TEST_F(PathLongerOnApproachTestFixture, test_tick)
     // Assuming distance between waypoints to be 3.0m
     old_path.poses[i - 1].pose.position.x = 3.0 * i;
   }
-  config_->blackboard->set("path", old_path);
+  config_->blackboard->set("path", std::make_shared<const nav_msgs::msg::Path>(old_path));
   tree_->rootNode()->executeTick();
 
   // set new path on blackboard
@@ -141,7 +141,7 @@ TEST_F(PathLongerOnApproachTestFixture, test_tick)
     // Assuming distance between waypoints to be 1.5m
     new_path.poses[i].pose.position.x = 1.5 * i;
   }
-  config_->blackboard->set("path", new_path);
+  config_->blackboard->set("path", std::make_shared<const nav_msgs::msg::Path>(new_path));
   tree_->rootNode()->executeTick();
 
   EXPECT_EQ(tree_->rootNode()->status(), BT::NodeStatus::FAILURE);
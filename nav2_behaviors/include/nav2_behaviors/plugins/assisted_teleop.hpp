@@ -18,6 +18,7 @@
 #include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "geometry_msgs/msg/twist.hpp"
 #include "std_msgs/msg/empty.hpp"
@@ -98,6 +99,10 @@ protected:
   geometry_msgs::msg::TwistStamped teleop_twist_;
   bool preempt_teleop_{false};
 
+  // Reused buffers for the projected collision horizon, filled each cycle
+  std::vector<geometry_msgs::msg::Pose2D> projected_poses_;
+  std::vector<double> projection_times_;
+
   // subscribers
   std::unique_ptr<nav2_util::TwistSubscriber> vel_sub_;
   rclcpp::Subscription<std_msgs::msg::Empty>::SharedPtr preempt_teleop_sub_;
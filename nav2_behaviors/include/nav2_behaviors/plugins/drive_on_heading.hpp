@@ -16,7 +16,9 @@
 #ifndef NAV2_BEHAVIORS__PLUGINS__DRIVE_ON_HEADING_HPP_
 #define NAV2_BEHAVIORS__PLUGINS__DRIVE_ON_HEADING_HPP_
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <memory>
 #include <utility>
 
@@ -76,6 +78,7 @@ public:
     command_x_ = command->target.x;
     command_speed_ = command->speed;
     command_time_allowance_ = command->time_allowance;
+    clearance_valid_ = false;
 
     end_time_ = this->clock_->now() + command_time_allowance_;
 
@@ -126,25 +129,24 @@ public:
       return ResultStatus{Status::SUCCEEDED, ActionT::Result::NONE};
     }
 
-    auto cmd_vel = std::make_unique<geometry_msgs::msg::TwistStamped>();
-    cmd_vel->header.stamp = this->clock_->now();
-    cmd_vel->header.frame_id = this->robot_base_frame_;
-    cmd_vel->twist.linear.y = 0.0;
-    cmd_vel->twist.angular.z = 0.0;
-    cmd_vel->twist.linear.x = command_speed_;
+    this->cmd_vel_.header.stamp = this->clock_->now();
+    this->cmd_vel_.header.frame_id = this->robot_base_frame_;
+    this->cmd_vel_.twist.linear.y = 0.0;
+    this->cmd_vel_.twist.angular.z = 0.0;
+    this->cmd_vel_.twist.linear.x = command_speed_;
 
     geometry_msgs::msg::Pose2D pose2d;
     pose2d.x = current_pose.pose.position.x;
     pose2d.y = current_pose.pose.position.y;
     pose2d.theta = tf2::getYaw(current_pose.pose.orientation);
 
-    if (!isCollisionFree(distance, cmd_vel->twist, pose2d)) {
+    if (!isCollisionFree(distance, this->cmd_vel_.twist, pose2d)) {
       this->stopRobot();
       RCLCPP_WARN(this->logger_, "Collision Ahead - Exiting DriveOnHeading");
       return ResultStatus{Status::FAILED, ActionT::Result::COLLISION_AHEAD};
     }
 
-    this->vel_pub_->publish(std::move(cmd_vel));
+    this->vel_pub_->publish(this->cmd_vel_);
 
     return ResultStatus{Status::RUNNING, ActionT::Result::NONE};
   }
@@ -176,21 +178,76 @@ protected:
     geometry_msgs::msg::Pose2D init_pose = pose2d;
     bool fetch_data = true;
 
-    while (cycle_count < max_cycle_count) {
+    // Largest position change the loop below would check before breaking out
+    double needed_span = 0.0;
+    for (int i = 0; i < max_cycle_count; i++) {
+      const double change = abs(cmd_vel.linear.x) * (i / this->cycle_frequency_);
+      if (diff_dist - change <= 0.) {
+        break;
+      }
+      needed_span = change;
+    }
+
+    // Reuse the clearance from a previous cycle when no new costmap has
+    // arrived, the robot is still on the cleared line, and the segment to
+    // simulate lies within the segment already verified collision free
+    const unsigned int update_count = this->local_collision_checker_->getCostmapUpdateCount();
+    const double motion_sign = cmd_vel.linear.x < 0.0 ? -1.0 : 1.0;
+    if (clearance_valid_ && update_count == cleared_update_count_) {
+      const double ux = motion_sign * cos(cleared_theta_);
+      const double uy = motion_sign * sin(cleared_theta_);
+      const double dx = pose2d.x - cleared_x_;
+      const double dy = pose2d.y - cleared_y_;
+      const double progress = dx * ux + dy * uy;
+      const double lateral = abs(dx * uy - dy * ux);
+      const double dyaw = abs(atan2(
+          sin(pose2d.theta - cleared_theta_), cos(pose2d.theta - cleared_theta_)));
+      if (progress >= 0.0 && lateral < kClearancePositionTolerance &&
+        dyaw < kClearanceYawTolerance && progress + needed_span <= cleared_span_)
+      {
+        return true;
+      }
+    }
+
+    // Simulate beyond this cycle's horizon up to the full remaining command,
+    // so later cycles can reuse the cleared segment while the costmap is
+    // unchanged. A collision beyond the horizon only limits the cached
+    // segment; it does not abort the behavior any earlier than before.
+    // capped at twice the horizon so a re-simulation never costs much more
+    // than two uncached cycles did
+    const double dist_per_cycle = abs(cmd_vel.linear.x) / this->cycle_frequency_;
+    int ext_cycle_count = max_cycle_count;
+    if (dist_per_cycle > 0.0) {
+      ext_cycle_count = std::clamp(
+        static_cast<int>(std::ceil(diff_dist / dist_per_cycle)) + 1,
+        max_cycle_count, 2 * max_cycle_count);
+    }
+
+    double cleared_span = -1.0;
+    while (cycle_count < ext_cycle_count) {
       sim_position_change = cmd_vel.linear.x * (cycle_count / this->cycle_frequency_);
       pose2d.x = init_pose.x + sim_position_change * cos(init_pose.theta);
       pose2d.y = init_pose.y + sim_position_change * sin(init_pose.theta);
+      const bool in_horizon = cycle_count < max_cycle_count &&
+        diff_dist - abs(sim_position_change) > 0.;
       cycle_count++;
 
-      if (diff_dist - abs(sim_position_change) <= 0.) {
-        break;
-      }
-
       if (!this->local_collision_checker_->isCollisionFree(pose2d, fetch_data)) {
-        return false;
+        if (in_horizon) {
+          return false;
+        }
+        break;
       }
       fetch_data = false;
+      cleared_span = abs(sim_position_change);
     }
+
+    clearance_valid_ = true;
+    cleared_update_count_ = update_count;
+    cleared_span_ = cleared_span;
+    cleared_x_ = init_pose.x;
+    cleared_y_ = init_pose.y;
+    cleared_theta_ = init_pose.theta;
     return true;
   }
 
@@ -218,6 +275,20 @@ protected:
   rclcpp::Duration command_time_allowance_{0, 0};
   rclcpp::Time end_time_;
   double simulate_ahead_time_;
+
+  // Cached clearance of the simulated segment, reused between cycles until
+  // a new costmap arrives, the robot leaves the cleared line, or the
+  // segment to simulate extends past the already-cleared one
+  bool clearance_valid_{false};
+  unsigned int cleared_update_count_{0};
+  double cleared_span_{0.0};
+  double cleared_x_{0.0};
+  double cleared_y_{0.0};
+  double cleared_theta_{0.0};
+
+  // Maximum drift from the cleared line before the cache is discarded
+  static constexpr double kClearancePositionTolerance = 0.05;
+  static constexpr double kClearanceYawTolerance = 0.05;
 };
 
 }  // namespace nav2_behaviors
@@ -94,6 +94,20 @@ protected:
   double simulate_ahead_time_;
   rclcpp::Duration command_time_allowance_{0, 0};
   rclcpp::Time end_time_;
+
+  // Cached clearance of the simulated rotation sweep, reused between cycles
+  // until a new costmap arrives, the robot drifts, or the poses to simulate
+  // leave the already-cleared sweep
+  bool clearance_valid_{false};
+  unsigned int cleared_update_count_{0};
+  double cleared_dir_{0.0};
+  double cleared_rel_yaw_{0.0};
+  double cleared_span_{0.0};
+  double cleared_x_{0.0};
+  double cleared_y_{0.0};
+
+  // Maximum position drift before a cached sweep clearance is discarded
+  static constexpr double kClearancePositionTolerance = 0.05;
 };
 
 }  // namespace nav2_behaviors
@@ -29,6 +29,7 @@
 #include "tf2_ros/transform_listener.h"
 #include "tf2_ros/create_timer_ros.h"
 #include "geometry_msgs/msg/twist.hpp"
+#include "geometry_msgs/msg/twist_stamped.hpp"
 #include "nav2_util/robot_utils.hpp"
 #include "nav2_util/twist_publisher.hpp"
 #include "nav2_util/simple_action_server.hpp"
@@ -187,6 +188,10 @@ protected:
 
   std::string behavior_name_;
   std::unique_ptr<nav2_util::TwistPublisher> vel_pub_;
+  // Commanded velocity reused across cycles: behaviors fill it in place and
+  // publish it by const reference, so steady-state execution constructs no
+  // message and rclcpp can loan from the middleware where supported
+  geometry_msgs::msg::TwistStamped cmd_vel_;
   std::shared_ptr<ActionServer> action_server_;
   std::shared_ptr<nav2_costmap_2d::CostmapTopicCollisionChecker> local_collision_checker_;
   std::shared_ptr<nav2_costmap_2d::CostmapTopicCollisionChecker> global_collision_checker_;
@@ -290,14 +295,13 @@ protected:
   // Stop the robot with a commanded velocity
   void stopRobot()
   {
-    auto cmd_vel = std::make_unique<geometry_msgs::msg::TwistStamped>();
-    cmd_vel->header.frame_id = robot_base_frame_;
-    cmd_vel->header.stamp = clock_->now();
-    cmd_vel->twist.linear.x = 0.0;
-    cmd_vel->twist.linear.y = 0.0;
-    cmd_vel->twist.angular.z = 0.0;
-
-    vel_pub_->publish(std::move(cmd_vel));
+    cmd_vel_.header.frame_id = robot_base_frame_;
+    cmd_vel_.header.stamp = clock_->now();
+    cmd_vel_.twist.linear.x = 0.0;
+    cmd_vel_.twist.linear.y = 0.0;
+    cmd_vel_.twist.angular.z = 0.0;
+
+    vel_pub_->publish(cmd_vel_);
   }
 };
 
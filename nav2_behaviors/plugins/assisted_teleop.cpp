@@ -13,8 +13,10 @@
 // limitations under the License.
 
 #include <utility>
+#include <vector>
 
 #include "nav2_behaviors/plugins/assisted_teleop.hpp"
+#include "nav2_costmap_2d/cost_values.hpp"
 #include "nav2_util/node_utils.hpp"
 
 namespace nav2_behaviors
@@ -53,9 +55,8 @@ void AssistedTeleop::onConfigure()
   vel_sub_ = std::make_unique<nav2_util::TwistSubscriber>(
     node,
     cmd_vel_teleop, rclcpp::SystemDefaultsQoS(),
-    [&](geometry_msgs::msg::Twist::SharedPtr msg) {
-      teleop_twist_.twist = *msg;
-    }, [&](geometry_msgs::msg::TwistStamped::SharedPtr msg) {
+    nav2_util::adapt_unstamped,
+    [&](geometry_msgs::msg::TwistStamped::SharedPtr msg) {
       teleop_twist_ = *msg;
     });
 
@@ -118,38 +119,63 @@ ResultStatus AssistedTeleop::onCycleUpdate()
   projected_pose.y = current_pose.pose.position.y;
   projected_pose.theta = tf2::getYaw(current_pose.pose.orientation);
 
-  auto scaled_twist = std::make_unique<geometry_msgs::msg::TwistStamped>(teleop_twist_);
-  for (double time = simulation_time_step_; time < projection_time_;
-    time += simulation_time_step_)
-  {
-    projected_pose = projectPose(projected_pose, teleop_twist_.twist, simulation_time_step_);
-
-    if (!local_collision_checker_->isCollisionFree(projected_pose)) {
-      if (time == simulation_time_step_) {
-        RCLCPP_DEBUG_STREAM_THROTTLE(
-          logger_,
-          *clock_,
-          1000,
-          behavior_name_.c_str() << " collided on first time step, setting velocity to zero");
-        scaled_twist->twist.linear.x = 0.0f;
-        scaled_twist->twist.linear.y = 0.0f;
-        scaled_twist->twist.angular.z = 0.0f;
-        break;
-      } else {
-        RCLCPP_DEBUG_STREAM_THROTTLE(
-          logger_,
-          *clock_,
-          1000,
-          behavior_name_.c_str() << " collision approaching in " << time << " seconds");
-        double scale_factor = time / projection_time_;
-        scaled_twist->twist.linear.x *= scale_factor;
-        scaled_twist->twist.linear.y *= scale_factor;
-        scaled_twist->twist.angular.z *= scale_factor;
-        break;
+  cmd_vel_ = teleop_twist_;
+
+  // Nothing to project for a zero command, it cannot be scaled down further
+  const geometry_msgs::msg::Twist & twist = teleop_twist_.twist;
+  if (twist.linear.x != 0.0 || twist.linear.y != 0.0 || twist.angular.z != 0.0) {
+    // Integrate the whole projection horizon up front, then sweep the
+    // collision checks with a single costmap and footprint fetch instead of
+    // re-fetching both on every simulated step
+    projected_poses_.clear();
+    projection_times_.clear();
+    for (double time = simulation_time_step_; time < projection_time_;
+      time += simulation_time_step_)
+    {
+      projected_pose = projectPose(projected_pose, twist, simulation_time_step_);
+      projected_poses_.push_back(projected_pose);
+      projection_times_.push_back(time);
+    }
+
+    std::vector<double> pose_costs;
+    try {
+      pose_costs = local_collision_checker_->scorePoses(projected_poses_);
+    } catch (const std::exception & e) {
+      // Treated below like a first-step collision, as the per-pose check did
+      RCLCPP_ERROR(logger_, "%s", e.what());
+    }
+
+    for (unsigned int i = 0; i != projected_poses_.size(); i++) {
+      if (i >= pose_costs.size() ||
+        pose_costs[i] >= nav2_costmap_2d::LETHAL_OBSTACLE)
+      {
+        const double time = projection_times_[i];
+        if (time == simulation_time_step_) {
+          RCLCPP_DEBUG_STREAM_THROTTLE(
+            logger_,
+            *clock_,
+            1000,
+            behavior_name_.c_str() << " collided on first time step, setting velocity to zero");
+          cmd_vel_.twist.linear.x = 0.0f;
+          cmd_vel_.twist.linear.y = 0.0f;
+          cmd_vel_.twist.angular.z = 0.0f;
+          break;
+        } else {
+          RCLCPP_DEBUG_STREAM_THROTTLE(
+            logger_,
+            *clock_,
+            1000,
+            behavior_name_.c_str() << " collision approaching in " << time << " seconds");
+          double scale_factor = time / projection_time_;
+          cmd_vel_.twist.linear.x *= scale_factor;
+          cmd_vel_.twist.linear.y *= scale_factor;
+          cmd_vel_.twist.angular.z *= scale_factor;
+          break;
+        }
       }
     }
   }
-  vel_pub_->publish(std::move(scaled_twist));
+  vel_pub_->publish(cmd_vel_);
 
   return ResultStatus{Status::RUNNING, AssistedTeleopActionResult::NONE};
 }
@@ -30,6 +30,7 @@ ResultStatus BackUp::onRun(const std::shared_ptr<const BackUpAction::Goal> comma
   command_x_ = -std::fabs(command->target.x);
   command_speed_ = -std::fabs(command->speed);
   command_time_allowance_ = command->time_allowance;
+  clearance_valid_ = false;
 
   end_time_ = this->clock_->now() + command_time_allowance_;
 
@@ -92,6 +92,7 @@ ResultStatus Spin::onRun(const std::shared_ptr<const SpinActionGoal> command)
 
   command_time_allowance_ = command->time_allowance;
   end_time_ = this->clock_->now() + command_time_allowance_;
+  clearance_valid_ = false;
 
   return ResultStatus{Status::SUCCEEDED, SpinActionResult::NONE};
 }
@@ -138,23 +139,24 @@ ResultStatus Spin::onCycleUpdate()
   double vel = sqrt(2 * rotational_acc_lim_ * remaining_yaw);
   vel = std::min(std::max(vel, min_rotational_vel_), max_rotational_vel_);
 
-  auto cmd_vel = std::make_unique<geometry_msgs::msg::TwistStamped>();
-  cmd_vel->header.frame_id = robot_base_frame_;
-  cmd_vel->header.stamp = clock_->now();
-  cmd_vel->twist.angular.z = copysign(vel, cmd_yaw_);
+  cmd_vel_.header.frame_id = robot_base_frame_;
+  cmd_vel_.header.stamp = clock_->now();
+  cmd_vel_.twist.linear.x = 0.0;
+  cmd_vel_.twist.linear.y = 0.0;
+  cmd_vel_.twist.angular.z = copysign(vel, cmd_yaw_);
 
   geometry_msgs::msg::Pose2D pose2d;
   pose2d.x = current_pose.pose.position.x;
   pose2d.y = current_pose.pose.position.y;
   pose2d.theta = tf2::getYaw(current_pose.pose.orientation);
 
-  if (!isCollisionFree(relative_yaw_, cmd_vel->twist, pose2d)) {
+  if (!isCollisionFree(relative_yaw_, cmd_vel_.twist, pose2d)) {
     stopRobot();
     RCLCPP_WARN(logger_, "Collision Ahead - Exiting Spin");
     return ResultStatus{Status::FAILED, SpinActionResult::COLLISION_AHEAD};
   }
 
-  vel_pub_->publish(std::move(cmd_vel));
+  vel_pub_->publish(cmd_vel_);
 
   return ResultStatus{Status::RUNNING, SpinActionResult::NONE};
 }
@@ -171,20 +173,71 @@ bool Spin::isCollisionFree(
   geometry_msgs::msg::Pose2D init_pose = pose2d;
   bool fetch_data = true;
 
-  while (cycle_count < max_cycle_count) {
+  // Largest yaw change the loop below would check before breaking out
+  double needed_span = 0.0;
+  for (int i = 0; i < max_cycle_count; i++) {
+    const double change = abs(cmd_vel.angular.z) * (i / cycle_frequency_);
+    if (abs(relative_yaw) - change <= 0.) {
+      break;
+    }
+    needed_span = change;
+  }
+
+  // Reuse the clearance from a previous cycle when no new costmap has
+  // arrived, the robot has not drifted, and the sweep to simulate lies
+  // within the sweep already verified collision free
+  const unsigned int update_count = local_collision_checker_->getCostmapUpdateCount();
+  const double dir = cmd_vel.angular.z < 0.0 ? -1.0 : 1.0;
+  const double progress = dir * (relative_yaw - cleared_rel_yaw_);
+  if (clearance_valid_ &&
+    update_count == cleared_update_count_ &&
+    dir == cleared_dir_ &&
+    hypot(pose2d.x - cleared_x_, pose2d.y - cleared_y_) < kClearancePositionTolerance &&
+    progress >= 0.0 && progress + needed_span <= cleared_span_)
+  {
+    return true;
+  }
+
+  // Simulate beyond this cycle's horizon up to the full commanded rotation,
+  // so later cycles can reuse the cleared sweep while the costmap is
+  // unchanged. A collision beyond the horizon only limits the cached sweep;
+  // it does not abort the behavior any earlier than before.
+  // capped at twice the horizon so a re-simulation never costs much more
+  // than two uncached cycles did
+  const double full_span = abs(cmd_yaw_);
+  const double yaw_per_cycle = abs(cmd_vel.angular.z) / cycle_frequency_;
+  int ext_cycle_count = max_cycle_count;
+  if (yaw_per_cycle > 0.0) {
+    ext_cycle_count = std::clamp(
+      static_cast<int>(std::ceil(full_span / yaw_per_cycle)) + 1,
+      max_cycle_count, 2 * max_cycle_count);
+  }
+
+  double cleared_span = -1.0;
+  while (cycle_count < ext_cycle_count) {
     sim_position_change = cmd_vel.angular.z * (cycle_count / cycle_frequency_);
     pose2d.theta = init_pose.theta + sim_position_change;
+    const bool in_horizon = cycle_count < max_cycle_count &&
+      abs(relative_yaw) - abs(sim_position_change) > 0.;
     cycle_count++;
 
-    if (abs(relative_yaw) - abs(sim_position_change) <= 0.) {
-      break;
-    }
-
     if (!local_collision_checker_->isCollisionFree(pose2d, fetch_data)) {
-      return false;
+      if (in_horizon) {
+        return false;
+      }
+      break;
     }
     fetch_data = false;
+    cleared_span = abs(sim_position_change);
   }
+
+  clearance_valid_ = true;
+  cleared_update_count_ = update_count;
+  cleared_dir_ = dir;
+  cleared_rel_yaw_ = relative_yaw;
+  cleared_span_ = cleared_span;
+  cleared_x_ = init_pose.x;
+  cleared_y_ = init_pose.y;
   return true;
 }
 
@@ -46,6 +46,7 @@ def generate_launch_description():
     params_file = LaunchConfiguration('params_file')
     autostart = LaunchConfiguration('autostart')
     use_composition = LaunchConfiguration('use_composition')
+    use_intra_process_comms = LaunchConfiguration('use_intra_process_comms')
     use_respawn = LaunchConfiguration('use_respawn')
     log_level = LaunchConfiguration('log_level')
 
@@ -123,6 +124,15 @@ def generate_launch_description():
         description='Whether to use composed bringup',
     )
 
+    declare_use_intra_process_comms_cmd = DeclareLaunchArgument(
+        'use_intra_process_comms',
+        default_value='True',
+        description='Pass costmaps, paths and scans between the composed nodes over'
+        ' intra-process buffers instead of serializing them through the middleware,'
+        ' and allow the middleware to loan message memory to publishers.'
+        ' Applied when composition is enabled.',
+    )
+
     declare_use_respawn_cmd = DeclareLaunchArgument(
         'use_respawn',
         default_value='False',
@@ -137,6 +147,14 @@ def generate_launch_description():
     bringup_cmd_group = GroupAction(
         [
             PushROSNamespace(condition=IfCondition(use_namespace), namespace=namespace),
+            # Messages that never leave the container are delivered by
+            # pointer; for those that do, loaning lets fixed-size messages
+            # be written directly into middleware shared memory
+            SetEnvironmentVariable(
+                condition=IfCondition(use_intra_process_comms),
+                name='ROS_DISABLE_LOANED_MESSAGES',
+                value='0',
+            ),
             Node(
                 condition=IfCondition(use_composition),
                 name='nav2_container',
@@ -172,6 +190,7 @@ def generate_launch_description():
                     'autostart': autostart,
                     'params_file': params_file,
                     'use_composition': use_composition,
+                    'use_intra_process_comms': use_intra_process_comms,
                     'use_respawn': use_respawn,
                     'container_name': 'nav2_container',
                 }.items(),
@@ -186,6 +205,7 @@ def generate_launch_description():
                     'autostart': autostart,
                     'params_file': params_file,
                     'use_composition': use_composition,
+                    'use_intra_process_comms': use_intra_process_comms,
                     'use_respawn': use_respawn,
                     'container_name': 'nav2_container',
                 }.items(),
@@ -208,6 +228,7 @@ def generate_launch_description():
     ld.add_action(declare_params_file_cmd)
     ld.add_action(declare_autostart_cmd)
     ld.add_action(declare_use_composition_cmd)
+    ld.add_action(declare_use_intra_process_comms_cmd)
     ld.add_action(declare_use_respawn_cmd)
     ld.add_action(declare_log_level_cmd)
 
@@ -25,7 +25,7 @@ from launch.substitutions import LaunchConfiguration, PythonExpression
 from launch.substitutions import NotEqualsSubstitution
 from launch_ros.actions import LoadComposableNodes, SetParameter
 from launch_ros.actions import Node
-from launch_ros.descriptions import ComposableNode, ParameterFile
+from launch_ros.descriptions import ComposableNode, ParameterFile, ParameterValue
 from nav2_common.launch import RewrittenYaml
 
 
@@ -39,6 +39,7 @@ def generate_launch_description():
     autostart = LaunchConfiguration('autostart')
     params_file = LaunchConfiguration('params_file')
     use_composition = LaunchConfiguration('use_composition')
+    use_intra_process_comms = LaunchConfiguration('use_intra_process_comms')
     container_name = LaunchConfiguration('container_name')
     container_name_full = (namespace, '/', container_name)
     use_respawn = LaunchConfiguration('use_respawn')
@@ -100,6 +101,14 @@ def generate_launch_description():
         description='Use composed bringup if True',
     )
 
+    declare_use_intra_process_comms_cmd = DeclareLaunchArgument(
+        'use_intra_process_comms',
+        default_value='True',
+        description='Deliver the map and scans to in-process subscribers over'
+        ' intra-process buffers instead of serializing them through the middleware.'
+        ' Applied when composition is enabled.',
+    )
+
     declare_container_name_cmd = DeclareLaunchArgument(
         'container_name',
         default_value='nav2_container',
@@ -174,6 +183,13 @@ def generate_launch_description():
     # yaml configuration file. They are separated since the conditions
     # currently only work on the LoadComposableNodes commands and not on the
     # ComposableNode node function itself
+    # Applied to every component in the container; in-process subscribers
+    # then receive a shared pointer to the published message instead of a
+    # serialized copy going through the middleware
+    component_extra_arguments = [
+        {'use_intra_process_comms': ParameterValue(use_intra_process_comms, value_type=bool)}
+    ]
+
     load_composable_nodes = GroupAction(
         condition=IfCondition(use_composition),
         actions=[
@@ -190,6 +206,7 @@ def generate_launch_description():
                         name='map_server',
                         parameters=[configured_params],
                         remappings=remappings,
+                        extra_arguments=component_extra_arguments,
                     ),
                 ],
             ),
@@ -208,6 +225,7 @@ def generate_launch_description():
                             {'yaml_filename': map_yaml_file},
                         ],
                         remappings=remappings,
+                        extra_arguments=component_extra_arguments,
                     ),
                 ],
             ),
@@ -220,6 +238,7 @@ def generate_launch_description():
                         name='amcl',
                         parameters=[configured_params],
                         remappings=remappings,
+                        extra_arguments=component_extra_arguments,
                     ),
                     ComposableNode(
                         package='nav2_lifecycle_manager',
@@ -228,6 +247,7 @@ def generate_launch_description():
                         parameters=[
                             {'autostart': autostart, 'node_names': lifecycle_nodes}
                         ],
+                        extra_arguments=component_extra_arguments,
                     ),
                 ],
             ),
@@ -247,6 +267,7 @@ def generate_launch_description():
     ld.add_action(declare_params_file_cmd)
     ld.add_action(declare_autostart_cmd)
     ld.add_action(declare_use_composition_cmd)
+    ld.add_action(declare_use_intra_process_comms_cmd)
     ld.add_action(declare_container_name_cmd)
     ld.add_action(declare_use_respawn_cmd)
     ld.add_action(declare_log_level_cmd)
@@ -22,7 +22,7 @@ from launch.conditions import IfCondition
 from launch.substitutions import LaunchConfiguration, PythonExpression
 from launch_ros.actions import LoadComposableNodes, SetParameter
 from launch_ros.actions import Node
-from launch_ros.descriptions import ComposableNode, ParameterFile
+from launch_ros.descriptions import ComposableNode, ParameterFile, ParameterValue
 from nav2_common.launch import RewrittenYaml
 
 
@@ -35,6 +35,7 @@ def generate_launch_description():
     autostart = LaunchConfiguration('autostart')
     params_file = LaunchConfiguration('params_file')
     use_composition = LaunchConfiguration('use_composition')
+    use_intra_process_comms = LaunchConfiguration('use_intra_process_comms')
     container_name = LaunchConfiguration('container_name')
     container_name_full = (namespace, '/', container_name)
     use_respawn = LaunchConfiguration('use_respawn')
@@ -105,6 +106,14 @@ def generate_launch_description():
         description='Use composed bringup if True',
     )
 
+    declare_use_intra_process_comms_cmd = DeclareLaunchArgument(
+        'use_intra_process_comms',
+        default_value='True',
+        description='Pass costmaps, paths and scans between composed nodes over'
+        ' intra-process buffers instead of serializing them through the middleware.'
+        ' Applied when composition is enabled.',
+    )
+
     declare_container_name_cmd = DeclareLaunchArgument(
         'container_name',
         default_value='nav2_container',
@@ -235,6 +244,13 @@ def generate_launch_description():
         ],
     )
 
+    # Applied to every component in the container; in-process subscribers
+    # then receive a shared pointer to the published message instead of a
+    # serialized copy going through the middleware
+    component_extra_arguments = [
+        {'use_intra_process_comms': ParameterValue(use_intra_process_comms, value_type=bool)}
+    ]
+
     load_composable_nodes = GroupAction(
         condition=IfCondition(use_composition),
         actions=[
@@ -248,6 +264,7 @@ def generate_launch_description():
                         name='controller_server',
                         parameters=[configured_params],
                         remappings=remappings + [('cmd_vel', 'cmd_vel_nav')],
+                        extra_arguments=component_extra_arguments,
                     ),
                     ComposableNode(
                         package='nav2_smoother',
@@ -255,6 +272,7 @@ def generate_launch_description():
                         name='smoother_server',
                         parameters=[configured_params],
                         remappings=remappings,
+                        extra_arguments=component_extra_arguments,
                     ),
                     ComposableNode(
                         package='nav2_planner',
@@ -262,6 +280,7 @@ def generate_launch_description():
                         name='planner_server',
                         parameters=[configured_params],
                         remappings=remappings,
+                        extra_arguments=component_extra_arguments,
                     ),
                     ComposableNode(
                         package='nav2_behaviors',
@@ -269,6 +288,7 @@ def generate_launch_description():
                         name='behavior_server',
                         parameters=[configured_params],
                         remappings=remappings + [('cmd_vel', 'cmd_vel_nav')],
+                        extra_arguments=component_extra_arguments,
                     ),
                     ComposableNode(
                         package='nav2_bt_navigator',
@@ -276,6 +296,7 @@ def generate_launch_description():
                         name='bt_navigator',
                         parameters=[configured_params],
                         remappings=remappings,
+                        extra_arguments=component_extra_arguments,
                     ),
                     ComposableNode(
                         package='nav2_waypoint_follower',
@@ -283,6 +304,7 @@ def generate_launch_description():
                         name='waypoint_follower',
                         parameters=[configured_params],
                         remappings=remappings,
+                        extra_arguments=component_extra_arguments,
                     ),
                     ComposableNode(
                         package='nav2_velocity_smoother',
@@ -291,6 +313,7 @@ def generate_launch_description():
                         parameters=[configured_params],
                         remappings=remappings
                         + [('cmd_vel', 'cmd_vel_nav')],
+                        extra_arguments=component_extra_arguments,
                     ),
                     ComposableNode(
                         package='nav2_collision_monitor',
@@ -298,6 +321,7 @@ def generate_launch_description():
                         name='collision_monitor',
                         parameters=[configured_params],
                         remappings=remappings,
+                        extra_arguments=component_extra_arguments,
                     ),
                     ComposableNode(
                         package='opennav_docking',
@@ -305,6 +329,7 @@ def generate_launch_description():
                         name='docking_server',
                         parameters=[configured_params],
                         remappings=remappings,
+                        extra_arguments=component_extra_arguments,
                     ),
                     ComposableNode(
                         package='nav2_lifecycle_manager',
@@ -313,6 +338,7 @@ def generate_launch_description():
                         parameters=[
                             {'autostart': autostart, 'node_names': lifecycle_nodes}
                         ],
+                        extra_arguments=component_extra_arguments,
                     ),
                 ],
             ),
@@ -331,6 +357,7 @@ def generate_launch_description():
     ld.add_action(declare_params_file_cmd)
     ld.add_action(declare_autostart_cmd)
     ld.add_action(declare_use_composition_cmd)
+    ld.add_action(declare_use_intra_process_comms_cmd)
     ld.add_action(declare_container_name_cmd)
     ld.add_action(declare_use_respawn_cmd)
     ld.add_action(declare_log_level_cmd)
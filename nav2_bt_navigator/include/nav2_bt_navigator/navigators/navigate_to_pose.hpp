@@ -26,6 +26,7 @@
 #include "nav2_util/geometry_utils.hpp"
 #include "nav2_util/robot_utils.hpp"
 #include "nav_msgs/msg/path.hpp"
+#include "nav2_behavior_tree/bt_utils.hpp"
 #include "nav2_util/odometry_utils.hpp"
 
 namespace nav2_bt_navigator
@@ -130,6 +131,19 @@ protected:
 
   // Odometry smoother object
   std::shared_ptr<nav2_util::OdomSmoother> odom_smoother_;
+
+  // Time interval between published feedback messages; zero publishes
+  // feedback on every behavior tree iteration
+  rclcpp::Duration feedback_period_{0, 0};
+  rclcpp::Time last_feedback_time_;
+
+  // Path whose length was integrated last, with the cumulative length of
+  // the path up to each of its poses; recomputed once per path version
+  nav2_behavior_tree::PathPtr last_path_;
+  std::vector<double> path_cumulative_lengths_;
+  // Closest pose found on the last feedback iteration, the next search
+  // resumes from here instead of rescanning the path from its start
+  size_t last_closest_idx_{0};
 };
 
 }  // namespace nav2_bt_navigator
@@ -17,6 +17,7 @@
 #include <set>
 #include <memory>
 #include <limits>
+#include "nav2_behavior_tree/bt_utils.hpp"
 #include "nav2_bt_navigator/navigators/navigate_through_poses.hpp"
 
 namespace nav2_bt_navigator
@@ -121,12 +122,16 @@ NavigateThroughPosesNavigator::onLoop()
   }
 
   try {
-    // Get current path points
-    nav_msgs::msg::Path current_path;
-    if (!blackboard->get(path_blackboard_id_, current_path) || current_path.poses.size() == 0u) {
+    // Get current path points; the path is shared on the blackboard by
+    // pointer, so no poses are copied here
+    nav2_behavior_tree::PathPtr current_path_ptr;
+    if (!blackboard->get(path_blackboard_id_, current_path_ptr) || !current_path_ptr ||
+      current_path_ptr->poses.size() == 0u)
+    {
       // If no path set yet or not meaningful, can't compute ETA or dist remaining yet.
       throw std::exception();
     }
+    const nav_msgs::msg::Path & current_path = *current_path_ptr;
 
     // Find the closest pose to current pose on global path
     auto find_closest_pose_idx =
@@ -16,6 +16,7 @@
 #include <string>
 #include <memory>
 #include <limits>
+#include "nav2_behavior_tree/bt_utils.hpp"
 #include "nav2_bt_navigator/navigators/navigate_to_pose.hpp"
 
 namespace nav2_bt_navigator
@@ -41,6 +42,13 @@ NavigateToPoseNavigator::configure(
 
   path_blackboard_id_ = node->get_parameter("path_blackboard_id").as_string();
 
+  if (!node->has_parameter("feedback_period")) {
+    node->declare_parameter("feedback_period", 0.0);
+  }
+
+  feedback_period_ = rclcpp::Duration::from_seconds(
+    node->get_parameter("feedback_period").as_double());
+
   // Odometry smoother object for getting current speed
   odom_smoother_ = odom_smoother;
 
@@ -107,6 +115,16 @@ NavigateToPoseNavigator::goalCompleted(
 void
 NavigateToPoseNavigator::onLoop()
 {
+  // The behavior tree may iterate at up to 100 Hz: when a feedback period is
+  // configured, the feedback computation only runs at that decoupled rate
+  if (feedback_period_.nanoseconds() > 0) {
+    const rclcpp::Time now = clock_->now();
+    if (now - last_feedback_time_ < feedback_period_) {
+      return;
+    }
+    last_feedback_time_ = now;
+  }
+
   // action server feedback (pose, duration of task,
   // number of recoveries, and distance remaining to goal)
   auto feedback_msg = std::make_shared<ActionT::Feedback>();
@@ -124,32 +142,58 @@ NavigateToPoseNavigator::onLoop()
   auto blackboard = bt_action_server_->getBlackboard();
 
   try {
-    // Get current path points
-    nav_msgs::msg::Path current_path;
-    if (!blackboard->get(path_blackboard_id_, current_path) || current_path.poses.size() == 0u) {
+    // Get current path points; the path is shared on the blackboard by
+    // pointer, so no poses are copied here
+    nav2_behavior_tree::PathPtr current_path_ptr;
+    if (!blackboard->get(path_blackboard_id_, current_path_ptr) || !current_path_ptr ||
+      current_path_ptr->poses.size() == 0u)
+    {
       // If no path set yet or not meaningful, can't compute ETA or dist remaining yet.
       throw std::exception();
     }
+    const nav_msgs::msg::Path & current_path = *current_path_ptr;
+
+    // Integrate the path length once per path version, so the per-iteration
+    // work does not rescan the whole remaining path
+    if (current_path_ptr != last_path_) {
+      path_cumulative_lengths_.clear();
+      path_cumulative_lengths_.reserve(current_path.poses.size());
+      path_cumulative_lengths_.push_back(0.0);
+      double length = 0.0;
+      for (size_t idx = 1; idx < current_path.poses.size(); ++idx) {
+        length += nav2_util::geometry_utils::euclidean_distance(
+          current_path.poses[idx - 1], current_path.poses[idx]);
+        path_cumulative_lengths_.push_back(length);
+      }
+      last_path_ = current_path_ptr;
+      last_closest_idx_ = 0;
+    }
+
+    // Find the closest pose to current pose on global path. The robot only
+    // progresses along the path between replans, so the search resumes from
+    // the previously found pose and stops once the distance has clearly
+    // started to grow again
+    size_t closest_pose_idx = last_closest_idx_;
+    double curr_min_dist = nav2_util::geometry_utils::euclidean_distance(
+      current_pose, current_path.poses[closest_pose_idx]);
+    constexpr double search_margin = 2.0;
+    for (size_t curr_idx = last_closest_idx_ + 1; curr_idx < current_path.poses.size();
+      ++curr_idx)
+    {
+      double curr_dist = nav2_util::geometry_utils::euclidean_distance(
+        current_pose, current_path.poses[curr_idx]);
+      if (curr_dist < curr_min_dist) {
+        curr_min_dist = curr_dist;
+        closest_pose_idx = curr_idx;
+      } else if (curr_dist > curr_min_dist + search_margin) {
+        break;
+      }
+    }
+    last_closest_idx_ = closest_pose_idx;
 
-    // Find the closest pose to current pose on global path
-    auto find_closest_pose_idx =
-      [&current_pose, &current_path]() {
-        size_t closest_pose_idx = 0;
-        double curr_min_dist = std::numeric_limits<double>::max();
-        for (size_t curr_idx = 0; curr_idx < current_path.poses.size(); ++curr_idx) {
-          double curr_dist = nav2_util::geometry_utils::euclidean_distance(
-            current_pose, current_path.poses[curr_idx]);
-          if (curr_dist < curr_min_dist) {
-            curr_min_dist = curr_dist;
-            closest_pose_idx = curr_idx;
-          }
-        }
-        return closest_pose_idx;
-      };
-
-    // Calculate distance on the path
+    // Distance remaining falls out of the integrated lengths directly
     double distance_remaining =
-      nav2_util::geometry_utils::calculate_path_length(current_path, find_closest_pose_idx());
+      path_cumulative_lengths_.back() - path_cumulative_lengths_[closest_pose_idx];
 
     // Default value for time remaining
     rclcpp::Duration estimated_time_remaining = rclcpp::Duration::from_seconds(0.0);
@@ -243,6 +287,10 @@ NavigateToPoseNavigator::initializeGoalPose(ActionT::Goal::ConstSharedPtr goal)
 
   // Reset state for new action feedback
   start_time_ = clock_->now();
+  last_feedback_time_ = start_time_ - feedback_period_;
+  last_path_.reset();
+  path_cumulative_lengths_.clear();
+  last_closest_idx_ = 0;
   auto blackboard = bt_action_server_->getBlackboard();
   blackboard->set("number_recoveries", 0);  // NOLINT
 
@@ -68,6 +68,14 @@ public:
    */
   int getPointsInside(const std::vector<Point> & points) const override;
 
+  /**
+   * @brief Gets number of points inside circle over all sources' spans
+   * @param spans Per-source point arrays to be checked
+   * @return Number of points inside circle. If there are no points,
+   * returns zero value.
+   */
+  int getPointsInside(const PointSpans & spans) const override;
+
   /**
    * @brief Returns true if circle radius is set.
    * Otherwise, prints a warning and returns false.
@@ -30,6 +30,19 @@ namespace nav2_collision_monitor
  */
 void transformPoints(const Pose & pose, std::vector<Point> & points);
 
+/**
+ * @brief Out-of-place version of the transformation above: reads the source
+ * points and writes their coordinates in the new frame into a separate array.
+ * Per-step movement simulation transforms the same source points repeatedly,
+ * and this version saves it from re-copying them on every step. The kernel is
+ * a single branch-free pass over the coordinates, open to vectorization.
+ * @param pose Origin of the new frame
+ * @param points_in Array of points whose coordinates will be transformed
+ * @param points_out Output array of transformed points, resized to points_in
+ */
+void transformPoints(
+  const Pose & pose, const std::vector<Point> & points_in, std::vector<Point> & points_out);
+
 /**
  * @brief Linearly projects pose towards to velocity direction on dt time interval.
  * Turns the velocity on twist angle for dt time interval.
@@ -15,9 +15,11 @@
 #ifndef NAV2_COLLISION_MONITOR__POINTCLOUD_HPP_
 #define NAV2_COLLISION_MONITOR__POINTCLOUD_HPP_
 
+#include <array>
 #include <memory>
 #include <vector>
 #include <string>
+#include <unordered_set>
 
 #include "sensor_msgs/msg/point_cloud2.hpp"
 
@@ -75,6 +77,13 @@ public:
     const rclcpp::Time & curr_time,
     std::vector<Point> & data);
 
+  /**
+   * @brief Obtains the conversion key of the source, extended with the
+   * pointcloud-specific conversion parameters
+   * @return Conversion key of the source
+   */
+  std::string getConversionKey() const override;
+
 protected:
   /**
    * @brief Getting sensor-specific ROS-parameters
@@ -88,6 +97,15 @@ protected:
    */
   void dataCallback(sensor_msgs::msg::PointCloud2::ConstSharedPtr msg);
 
+  /**
+   * @brief Reduce the cloud to one representative point per occupied voxel
+   * of a fixed-size grid, in the source frame. Computed once per message
+   * so dense depth-camera clouds shrink to a few thousand points before
+   * the per-cycle transform and polygon containment tests.
+   * @param msg Cloud to reduce into voxel_points_
+   */
+  void voxelReduce(const sensor_msgs::msg::PointCloud2 & msg);
+
   // ----- Variables -----
 
   /// @brief PointCloud data subscriber
@@ -96,8 +114,16 @@ protected:
   // Minimum and maximum height of PointCloud projected to 2D space
   double min_height_, max_height_;
 
+  /// @brief Voxel edge length for pre-reduction, 0.0 to pass the raw cloud
+  double voxel_size_;
+
   /// @brief Latest data obtained from pointcloud
   sensor_msgs::msg::PointCloud2::ConstSharedPtr data_;
+
+  /// @brief One representative point per occupied voxel of the latest cloud
+  std::vector<std::array<float, 3>> voxel_points_;
+  /// @brief Occupied voxel keys, persistent to reuse its buckets per message
+  std::unordered_set<uint64_t> voxel_keys_;
 };  // class PointCloud
 
 }  // namespace nav2_collision_monitor
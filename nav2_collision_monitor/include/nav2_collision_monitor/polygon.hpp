@@ -141,10 +141,19 @@ public:
    * @brief Gets number of points inside given polygon
    * @param points Input array of points to be checked
    * @return Number of points inside polygon. If there are no points,
-   * returns zero value.
+   * returns zero value. Counting stops early once min_points is reached:
+   * all callers only compare the result against min_points.
    */
   virtual int getPointsInside(const std::vector<Point> & points) const;
 
+  /**
+   * @brief Gets number of points inside given polygon over all sources' spans.
+   * Spans are iterated in-place: no concatenation of source points is made.
+   * @param spans Per-source point arrays to be checked
+   * @return Number of points inside polygon, saturated at min_points
+   */
+  virtual int getPointsInside(const PointSpans & spans) const;
+
   /**
    * @brief Obtains estimated (simulated) time before a collision.
    * Applicable for APPROACH model.
@@ -157,6 +166,18 @@ public:
     const std::vector<Point> & collision_points,
     const Velocity & velocity) const;
 
+  /**
+   * @brief Obtains estimated (simulated) time before a collision
+   * over all sources' spans. Applicable for APPROACH model.
+   * @param collision_spans Per-source arrays of 2D obstacle points
+   * @param velocity Simulated robot velocity
+   * @return Estimated time before a collision. If there is no collision,
+   * return value will be negative.
+   */
+  double getCollisionTime(
+    const PointSpans & collision_spans,
+    const Velocity & velocity) const;
+
   /**
    * @brief Publishes polygon message into a its own topic
    */
@@ -227,6 +248,48 @@ protected:
    */
   bool isPointInside(const Point & point) const;
 
+  /**
+   * @brief Precomputed polygon data for the batched containment kernel:
+   * per-edge tables and an axis-aligned bounding box.
+   * Horizontal edges are dropped at build time: they never toggle
+   * the crossing parity.
+   */
+  struct EdgeTable
+  {
+    /// @brief X coordinate of edge start vertex
+    std::vector<double> xi;
+    /// @brief Y coordinate of edge start vertex
+    std::vector<double> yi;
+    /// @brief Y coordinate of edge end vertex
+    std::vector<double> yj;
+    /// @brief Edge inverted slope: (xj - xi) / (yj - yi)
+    std::vector<double> inv_dy;
+    /// @brief Polygon bounding box, for fast rejection of faraway points
+    double min_x, min_y, max_x, max_y;
+  };
+
+  /**
+   * @brief Builds the edge tables and the bounding box for given polygon vertices
+   * @param poly Input polygon points (vertices)
+   * @param table Output tables to fill
+   */
+  void buildEdgeTable(const std::vector<Point> & poly, EdgeTable & table) const;
+
+  /**
+   * @brief Adds the number of given points falling inside the polygon
+   * to an already accumulated count, stopping once min_points is reached
+   * @param points Input array of points to be checked
+   * @param num_start Count of points inside accumulated over previous spans
+   * @return Updated count of points inside, saturated at min_points
+   */
+  int addPointsInside(const std::vector<Point> & points, const int num_start) const;
+
+  /**
+   * @brief Rebuilds the precomputed edge tables used by getPointsInside().
+   * Must be called after every update of poly_ vertices.
+   */
+  void updateEdgeTable();
+
   /**
    * @brief Extracts Polygon points from a string with of the form [[x1,y1],[x2,y2],[x3,y3]...]
    * @param poly_string Input String containing the verteceis of the polygon
@@ -288,6 +351,9 @@ protected:
 
   /// @brief Polygon points (vertices) in a base_frame_id_
   std::vector<Point> poly_;
+  /// @brief Precomputed edge tables for the batched ray crossings test
+  /// in getPointsInside(), rebuilt by updateEdgeTable() on poly_ updates
+  EdgeTable edge_table_;
 };  // class Polygon
 
 }  // namespace nav2_collision_monitor
@@ -76,6 +76,13 @@ public:
     const rclcpp::Time & curr_time,
     std::vector<Point> & data);
 
+  /**
+   * @brief Obtains the conversion key of the source, extended with the
+   * polygon-specific conversion parameters
+   * @return Conversion key of the source
+   */
+  std::string getConversionKey() const override;
+
   /**
    * @brief Converts a PolygonInstanceStamped to a std::vector<Point>
    * @param polygon Input Polygon to be converted
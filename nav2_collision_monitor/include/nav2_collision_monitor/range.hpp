@@ -75,6 +75,13 @@ public:
     const rclcpp::Time & curr_time,
     std::vector<Point> & data);
 
+  /**
+   * @brief Obtains the conversion key of the source, extended with the
+   * range-specific conversion parameters
+   * @return Conversion key of the source
+   */
+  std::string getConversionKey() const override;
+
 protected:
   /**
    * @brief Getting sensor-specific ROS-parameters
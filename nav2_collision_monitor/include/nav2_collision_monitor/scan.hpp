@@ -82,6 +82,14 @@ protected:
    */
   void dataCallback(sensor_msgs::msg::LaserScan::ConstSharedPtr msg);
 
+  /**
+   * @brief Rebuild the per-beam cos/sin tables if the scan geometry
+   * (beam count, start angle or increment) changed since the last message.
+   * The geometry is fixed for a given scanner, so in steady state the
+   * tables are computed once and conversion runs without trig calls.
+   */
+  void updateTrigTables();
+
   // ----- Variables -----
 
   /// @brief Laser scanner data subscriber
@@ -89,6 +97,11 @@ protected:
 
   /// @brief Latest data obtained from laser scanner
   sensor_msgs::msg::LaserScan::ConstSharedPtr data_;
+
+  /// @brief Per-beam direction cosines/sines for the current scan geometry
+  std::vector<float> cos_table_, sin_table_;
+  /// @brief Scan geometry the tables were computed for
+  float table_angle_min_, table_angle_increment_;
 };  // class Scan
 
 }  // namespace nav2_collision_monitor
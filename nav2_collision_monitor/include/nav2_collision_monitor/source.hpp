@@ -75,6 +75,25 @@ public:
     const rclcpp::Time & curr_time,
     std::vector<Point> & data) = 0;
 
+  /**
+   * @brief Refreshes the source points for the current processing cycle.
+   * The points are written into an internal buffer whose capacity is reused
+   * between cycles, so no per-cycle reallocation or concatenation is required.
+   * Repeat refreshes over unchanged data, e.g. from several nodes sharing the
+   * source within one container, reuse the previously converted points as
+   * long as they are within the transform tolerance of the requested time.
+   * @param curr_time Current node time for data interpolation
+   * @return false if an invalid source should block the robot
+   */
+  bool refreshPoints(const rclcpp::Time & curr_time);
+
+  /**
+   * @brief Obtains the points produced by the latest refreshPoints() call.
+   * The returned reference stays stable until the next refreshPoints() call.
+   * @return Source points in base_frame_id_ coordinate system
+   */
+  const std::vector<Point> & getPoints() const;
+
   /**
    * @brief Obtains source enabled state
    * @return Whether source is enabled
@@ -93,6 +112,15 @@ public:
    */
   rclcpp::Duration getSourceTimeout() const;
 
+  /**
+   * @brief Obtains a key identifying the conversion pipeline of the source:
+   * its concrete type, input topic and every parameter involved in producing
+   * the points. Sources with equal keys produce identical points and may be
+   * shared between nodes through the SourceRegistry.
+   * @return Conversion key of the source
+   */
+  virtual std::string getConversionKey() const;
+
 protected:
   /**
    * @brief Source configuration routine.
@@ -150,6 +178,8 @@ protected:
   // Basic parameters
   /// @brief Name of data source
   std::string source_name_;
+  /// @brief Name of the input topic the source subscribes to
+  std::string source_topic_;
 
   // Global variables
   /// @brief TF buffer
@@ -167,6 +197,16 @@ protected:
   bool base_shift_correction_;
   /// @brief Whether source is enabled
   bool enabled_;
+  /// @brief Points refreshed by the latest refreshPoints() call
+  std::vector<Point> points_;
+  /// @brief Incremented by the data callbacks whenever new data arrives
+  uint64_t data_revision_{0};
+  /// @brief Data revision converted by the latest refreshPoints() call
+  uint64_t converted_revision_{0};
+  /// @brief Node time of the latest conversion
+  rclcpp::Time last_refresh_time_{0, 0, RCL_ROS_TIME};
+  /// @brief Whether the latest conversion succeeded
+  bool last_refresh_ok_{false};
 };  // class Source
 
 }  // namespace nav2_collision_monitor
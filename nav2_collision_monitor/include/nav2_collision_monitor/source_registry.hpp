@@ -0,0 +1,60 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_COLLISION_MONITOR__SOURCE_REGISTRY_HPP_
+#define NAV2_COLLISION_MONITOR__SOURCE_REGISTRY_HPP_
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "nav2_collision_monitor/source.hpp"
+
+namespace nav2_collision_monitor
+{
+
+/**
+ * @brief Process-wide registry of data sources. Nodes composed into one
+ * container (e.g. Collision Monitor together with Collision Detector) obtain
+ * their sources through the registry, so equivalent sources share a single
+ * subscription and conversion pipeline instead of duplicating both.
+ */
+class SourceRegistry
+{
+public:
+  /**
+   * @brief Returns a registered live source equivalent to the candidate, or
+   * registers the candidate and returns it when there is none.
+   * Sources are equivalent when their conversion keys match: the same source
+   * type, input topic and conversion parameters. A shared source keeps the
+   * configuration of the node that registered it first; dynamic parameter
+   * updates on the other nodes do not apply to it.
+   * The registry holds weak references only, so a source is dropped as soon
+   * as no node uses it anymore.
+   * @param candidate Newly configured source of the calling node
+   * @return Source to be used by the calling node
+   */
+  static std::shared_ptr<Source> getOrRegister(const std::shared_ptr<Source> & candidate);
+
+private:
+  /// @brief Protects the registry during nodes configuration
+  static std::mutex mutex_;
+  /// @brief Registered sources by their conversion key
+  static std::unordered_map<std::string, std::weak_ptr<Source>> sources_;
+};  // class SourceRegistry
+
+}  // namespace nav2_collision_monitor
+
+#endif  // NAV2_COLLISION_MONITOR__SOURCE_REGISTRY_HPP_
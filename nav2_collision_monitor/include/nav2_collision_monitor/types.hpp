@@ -16,6 +16,7 @@
 #define NAV2_COLLISION_MONITOR__TYPES_HPP_
 
 #include <string>
+#include <vector>
 
 namespace nav2_collision_monitor
 {
@@ -53,6 +54,11 @@ struct Point
   double y;  // y-coordinate of point
 };
 
+/// @brief Non-owning list of per-source point arrays.
+/// Allows polygons to iterate over all sources' points without
+/// concatenating them into a single array each processing cycle.
+using PointSpans = std::vector<const std::vector<Point> *>;
+
 /// @brief 2D Pose
 struct Pose
 {
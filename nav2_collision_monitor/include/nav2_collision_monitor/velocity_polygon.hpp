@@ -92,6 +92,19 @@ protected:
     double direction_start_angle_;
   };
 
+  /**
+    * @brief Precompiled per-sub-polygon data: containment edge tables and
+    * visualization points, built once so that switching velocity bins
+    * at runtime is a plain swap without any per-cycle recomputation
+    */
+  struct SubPolygonTable
+  {
+    /// @brief Edge tables and bounding box for the containment kernel
+    EdgeTable edge_table_;
+    /// @brief Visualization polygon points
+    std::vector<geometry_msgs::msg::Point32> vis_points_;
+  };
+
   /**
    * @brief Check if the velocities and direction is in expected range.
    * @param cmd_vel_in Robot twist command input
@@ -100,6 +113,12 @@ protected:
    */
   bool isInRange(const Velocity & cmd_vel_in, const SubPolygonParameter & sub_polygon_param);
 
+  /**
+   * @brief Precompiles the containment and visualization tables
+   * for every sub-polygon. To be called once all sub-polygons are obtained.
+   */
+  void buildSubPolygonTables();
+
   // Clock
   rclcpp::Clock::SharedPtr clock_;
 
@@ -108,6 +127,10 @@ protected:
   bool holonomic_;
   /// @brief Vector to store the parameters of the sub-polygon
   std::vector<SubPolygonParameter> sub_polygons_;
+  /// @brief Precompiled tables, one per sub-polygon
+  std::vector<SubPolygonTable> sub_polygon_tables_;
+  /// @brief Index of the sub-polygon currently swapped in, or -1 if none yet
+  int active_sub_polygon_{-1};
 };  // class VelocityPolygon
 
 }  // namespace nav2_collision_monitor
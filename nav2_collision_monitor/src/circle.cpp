@@ -70,6 +70,15 @@ int Circle::getPointsInside(const std::vector<Point> & points) const
   return num;
 }
 
+int Circle::getPointsInside(const PointSpans & spans) const
+{
+  int num = 0;
+  for (const std::vector<Point> * points : spans) {
+    num += getPointsInside(*points);
+  }
+  return num;
+}
+
 bool Circle::isShapeSet()
 {
   if (radius_squared_ == -1.0) {
@@ -23,6 +23,8 @@
 
 #include "nav2_util/node_utils.hpp"
 
+#include "nav2_collision_monitor/source_registry.hpp"
+
 using namespace std::chrono_literals;
 
 namespace nav2_collision_monitor
@@ -270,7 +272,7 @@ bool CollisionDetector::configureSources(
 
         s->configure();
 
-        sources_.push_back(s);
+        sources_.push_back(SourceRegistry::getOrRegister(s));
       } else if (source_type == "pointcloud") {
         std::shared_ptr<PointCloud> p = std::make_shared<PointCloud>(
           node, source_name, tf_buffer_, base_frame_id, odom_frame_id,
@@ -278,7 +280,7 @@ bool CollisionDetector::configureSources(
 
         p->configure();
 
-        sources_.push_back(p);
+        sources_.push_back(SourceRegistry::getOrRegister(p));
       } else if (source_type == "range") {
         std::shared_ptr<Range> r = std::make_shared<Range>(
           node, source_name, tf_buffer_, base_frame_id, odom_frame_id,
@@ -286,14 +288,14 @@ bool CollisionDetector::configureSources(
 
         r->configure();
 
-        sources_.push_back(r);
+        sources_.push_back(SourceRegistry::getOrRegister(r));
       } else if (source_type == "polygon") {
         std::shared_ptr<PolygonSource> ps = std::make_shared<PolygonSource>(
           node, source_name, tf_buffer_, base_frame_id, odom_frame_id,
           transform_tolerance, source_timeout, base_shift_correction);
         ps->configure();
 
-        sources_.push_back(ps);
+        sources_.push_back(SourceRegistry::getOrRegister(ps));
       } else {  // Error if something else
         RCLCPP_ERROR(
           get_logger(),
@@ -315,25 +317,30 @@ void CollisionDetector::process()
   // Current timestamp for all inner routines prolongation
   rclcpp::Time curr_time = this->now();
 
-  // Points array collected from different data sources in a robot base frame
-  std::vector<Point> collision_points;
+  // Per-source points spans in a robot base frame.
+  // Spans reference the sources' internal buffers: no concatenation copy is made.
+  PointSpans collision_spans;
+  collision_spans.reserve(sources_.size());
 
   std::unique_ptr<nav2_msgs::msg::CollisionDetectorState> state_msg =
     std::make_unique<nav2_msgs::msg::CollisionDetectorState>();
 
-  // Fill collision_points array from different data sources
+  // Refresh and aggregate points spans from different data sources
   for (std::shared_ptr<Source> source : sources_) {
     if (source->getEnabled()) {
-      if (!source->getData(curr_time, collision_points) &&
-        source->getSourceTimeout().seconds() != 0.0)
-      {
-        RCLCPP_WARN(
-          get_logger(),
-          "Invalid source %s detected."
-          " Either due to data not published yet, or to lack of new data received within the"
-          " sensor timeout, or if impossible to transform data to base frame",
-          source->getSourceName().c_str());
+      if (!source->refreshPoints(curr_time)) {
+        if (source->getSourceTimeout().seconds() != 0.0) {
+          RCLCPP_WARN(
+            get_logger(),
+            "Invalid source %s detected."
+            " Either due to data not published yet, or to lack of new data received within the"
+            " sensor timeout, or if impossible to transform data to base frame",
+            source->getSourceName().c_str());
+        }
+        // Leave the stale source span out for this cycle
+        continue;
       }
+      collision_spans.push_back(&source->getPoints());
     }
   }
 
@@ -354,12 +361,14 @@ void CollisionDetector::process()
     marker.lifetime = rclcpp::Duration(0, 0);
     marker.frame_locked = true;
 
-    for (const auto & point : collision_points) {
-      geometry_msgs::msg::Point p;
-      p.x = point.x;
-      p.y = point.y;
-      p.z = 0.0;
-      marker.points.push_back(p);
+    for (const std::vector<Point> * points : collision_spans) {
+      for (const auto & point : *points) {
+        geometry_msgs::msg::Point p;
+        p.x = point.x;
+        p.y = point.y;
+        p.z = 0.0;
+        marker.points.push_back(p);
+      }
     }
     marker_array->markers.push_back(marker);
     collision_points_marker_pub_->publish(std::move(marker_array));
@@ -372,7 +381,7 @@ void CollisionDetector::process()
     state_msg->polygons.push_back(polygon->getName());
     state_msg->detections.push_back(
       polygon->getPointsInside(
-        collision_points) >= polygon->getMinPoints());
+        collision_spans) >= polygon->getMinPoints());
   }
 
   state_pub_->publish(std::move(state_msg));
@@ -24,6 +24,7 @@
 #include "nav2_util/robot_utils.hpp"
 
 #include "nav2_collision_monitor/kinematics.hpp"
+#include "nav2_collision_monitor/source_registry.hpp"
 
 namespace nav2_collision_monitor
 {
@@ -67,7 +68,7 @@ CollisionMonitor::on_configure(const rclcpp_lifecycle::State & /*state*/)
     shared_from_this(),
     cmd_vel_in_topic,
     1,
-    std::bind(&CollisionMonitor::cmdVelInCallbackUnstamped, this, std::placeholders::_1),
+    nav2_util::adapt_unstamped,
     std::bind(&CollisionMonitor::cmdVelInCallbackStamped, this, std::placeholders::_1));
 
   auto node = shared_from_this();
@@ -194,13 +195,6 @@ void CollisionMonitor::cmdVelInCallbackStamped(geometry_msgs::msg::TwistStamped:
   process({msg->twist.linear.x, msg->twist.linear.y, msg->twist.angular.z}, msg->header);
 }
 
-void CollisionMonitor::cmdVelInCallbackUnstamped(geometry_msgs::msg::Twist::SharedPtr msg)
-{
-  auto twist_stamped = std::make_shared<geometry_msgs::msg::TwistStamped>();
-  twist_stamped->twist = *msg;
-  cmdVelInCallbackStamped(twist_stamped);
-}
-
 void CollisionMonitor::publishVelocity(
   const Action & robot_action, const std_msgs::msg::Header & header)
 {
@@ -361,7 +355,7 @@ bool CollisionMonitor::configureSources(
 
         s->configure();
 
-        sources_.push_back(s);
+        sources_.push_back(SourceRegistry::getOrRegister(s));
       } else if (source_type == "pointcloud") {
         std::shared_ptr<PointCloud> p = std::make_shared<PointCloud>(
           node, source_name, tf_buffer_, base_frame_id, odom_frame_id,
@@ -369,7 +363,7 @@ bool CollisionMonitor::configureSources(
 
         p->configure();
 
-        sources_.push_back(p);
+        sources_.push_back(SourceRegistry::getOrRegister(p));
       } else if (source_type == "range") {
         std::shared_ptr<Range> r = std::make_shared<Range>(
           node, source_name, tf_buffer_, base_frame_id, odom_frame_id,
@@ -377,14 +371,14 @@ bool CollisionMonitor::configureSources(
 
         r->configure();
 
-        sources_.push_back(r);
+        sources_.push_back(SourceRegistry::getOrRegister(r));
       } else if (source_type == "polygon") {
         std::shared_ptr<PolygonSource> ps = std::make_shared<PolygonSource>(
           node, source_name, tf_buffer_, base_frame_id, odom_frame_id,
           transform_tolerance, source_timeout, base_shift_correction);
         ps->configure();
 
-        sources_.push_back(ps);
+        sources_.push_back(SourceRegistry::getOrRegister(ps));
       } else {  // Error if something else
         RCLCPP_ERROR(
           get_logger(),
@@ -411,28 +405,34 @@ void CollisionMonitor::process(const Velocity & cmd_vel_in, const std_msgs::msg:
     return;
   }
 
-  // Points array collected from different data sources in a robot base frame
-  std::vector<Point> collision_points;
+  // Per-source points spans in a robot base frame.
+  // Spans reference the sources' internal buffers: no concatenation copy is made.
+  PointSpans collision_spans;
+  collision_spans.reserve(sources_.size());
 
   // By default - there is no action
   Action robot_action{DO_NOTHING, cmd_vel_in, ""};
   // Polygon causing robot action (if any)
   std::shared_ptr<Polygon> action_polygon;
 
-  // Fill collision_points array from different data sources
+  // Refresh and aggregate points spans from different data sources
   for (std::shared_ptr<Source> source : sources_) {
     if (source->getEnabled()) {
-      if (!source->getData(curr_time, collision_points) &&
-        source->getSourceTimeout().seconds() != 0.0)
-      {
-        action_polygon = nullptr;
-        robot_action.polygon_name = "invalid source";
-        robot_action.action_type = STOP;
-        robot_action.req_vel.x = 0.0;
-        robot_action.req_vel.y = 0.0;
-        robot_action.req_vel.tw = 0.0;
-        break;
+      if (!source->refreshPoints(curr_time)) {
+        if (source->getSourceTimeout().seconds() != 0.0) {
+          action_polygon = nullptr;
+          robot_action.polygon_name = "invalid source";
+          robot_action.action_type = STOP;
+          robot_action.req_vel.x = 0.0;
+          robot_action.req_vel.y = 0.0;
+          robot_action.req_vel.tw = 0.0;
+          break;
+        }
+        // Stale source with zero timeout does not block the robot:
+        // leave its span out for this cycle
+        continue;
       }
+      collision_spans.push_back(&source->getPoints());
     }
   }
 
@@ -453,12 +453,14 @@ void CollisionMonitor::process(const Velocity & cmd_vel_in, const std_msgs::msg:
     marker.lifetime = rclcpp::Duration(0, 0);
     marker.frame_locked = true;
 
-    for (const auto & point : collision_points) {
-      geometry_msgs::msg::Point p;
-      p.x = point.x;
-      p.y = point.y;
-      p.z = 0.0;
-      marker.points.push_back(p);
+    for (const std::vector<Point> * points : collision_spans) {
+      for (const auto & point : *points) {
+        geometry_msgs::msg::Point p;
+        p.x = point.x;
+        p.y = point.y;
+        p.z = 0.0;
+        marker.points.push_back(p);
+      }
     }
     marker_array->markers.push_back(marker);
     collision_points_marker_pub_->publish(std::move(marker_array));
@@ -479,12 +481,12 @@ void CollisionMonitor::process(const Velocity & cmd_vel_in, const std_msgs::msg:
     const ActionType at = polygon->getActionType();
     if (at == STOP || at == SLOWDOWN || at == LIMIT) {
       // Process STOP/SLOWDOWN for the selected polygon
-      if (processStopSlowdownLimit(polygon, collision_points, cmd_vel_in, robot_action)) {
+      if (processStopSlowdownLimit(polygon, collision_spans, cmd_vel_in, robot_action)) {
         action_polygon = polygon;
       }
     } else if (at == APPROACH) {
       // Process APPROACH for the selected polygon
-      if (processApproach(polygon, collision_points, cmd_vel_in, robot_action)) {
+      if (processApproach(polygon, collision_spans, cmd_vel_in, robot_action)) {
         action_polygon = polygon;
       }
     }
@@ -506,7 +508,7 @@ void CollisionMonitor::process(const Velocity & cmd_vel_in, const std_msgs::msg:
 
 bool CollisionMonitor::processStopSlowdownLimit(
   const std::shared_ptr<Polygon> polygon,
-  const std::vector<Point> & collision_points,
+  const PointSpans & collision_spans,
   const Velocity & velocity,
   Action & robot_action) const
 {
@@ -514,7 +516,7 @@ bool CollisionMonitor::processStopSlowdownLimit(
     return false;
   }
 
-  if (polygon->getPointsInside(collision_points) >= polygon->getMinPoints()) {
+  if (polygon->getPointsInside(collision_spans) >= polygon->getMinPoints()) {
     if (polygon->getActionType() == STOP) {
       // Setting up zero velocity for STOP model
       robot_action.polygon_name = polygon->getName();
@@ -561,7 +563,7 @@ bool CollisionMonitor::processStopSlowdownLimit(
 
 bool CollisionMonitor::processApproach(
   const std::shared_ptr<Polygon> polygon,
-  const std::vector<Point> & collision_points,
+  const PointSpans & collision_spans,
   const Velocity & velocity,
   Action & robot_action) const
 {
@@ -570,7 +572,7 @@ bool CollisionMonitor::processApproach(
   }
 
   // Obtain time before a collision
-  const double collision_time = polygon->getCollisionTime(collision_points, velocity);
+  const double collision_time = polygon->getCollisionTime(collision_spans, velocity);
   if (collision_time >= 0.0) {
     // If collision will occurr, reduce robot speed
     const double change_ratio = collision_time / polygon->getTimeBeforeCollision();
@@ -41,6 +41,23 @@ void transformPoints(const Pose & pose, std::vector<Point> & points)
   }
 }
 
+void transformPoints(
+  const Pose & pose, const std::vector<Point> & points_in, std::vector<Point> & points_out)
+{
+  const double cos_theta = std::cos(pose.theta);
+  const double sin_theta = std::sin(pose.theta);
+
+  points_out.resize(points_in.size());
+  // Same transformation as above, split into loads from the source points
+  // and stores into the output array so the whole step is one pass
+  for (std::size_t i = 0; i < points_in.size(); i++) {
+    const double mul_x = points_in[i].x - pose.x;
+    const double mul_y = points_in[i].y - pose.y;
+    points_out[i].x = mul_x * cos_theta + mul_y * sin_theta;
+    points_out[i].y = -mul_x * sin_theta + mul_y * cos_theta;
+  }
+}
+
 void projectState(const double & dt, Pose & pose, Velocity & velocity)
 {
   const double theta = velocity.tw * dt;
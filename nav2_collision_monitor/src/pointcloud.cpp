@@ -14,7 +14,9 @@
 
 #include "nav2_collision_monitor/pointcloud.hpp"
 
+#include <cmath>
 #include <functional>
+#include <string>
 
 #include "sensor_msgs/point_cloud2_iterator.hpp"
 #include "tf2/transform_datatypes.h"
@@ -84,6 +86,18 @@ bool PointCloud::getData(
     return false;
   }
 
+  if (voxel_size_ > 0.0) {
+    // Voxel representatives were extracted once in the data callback;
+    // only they need the per-cycle transform and height filter
+    for (const std::array<float, 3> & point : voxel_points_) {
+      tf2::Vector3 p_v3_b = tf_transform * tf2::Vector3(point[0], point[1], point[2]);
+      if (p_v3_b.z() >= min_height_ && p_v3_b.z() <= max_height_) {
+        data.push_back({p_v3_b.x(), p_v3_b.y()});
+      }
+    }
+    return true;
+  }
+
   sensor_msgs::PointCloud2ConstIterator<float> iter_x(*data_, "x");
   sensor_msgs::PointCloud2ConstIterator<float> iter_y(*data_, "y");
   sensor_msgs::PointCloud2ConstIterator<float> iter_z(*data_, "z");
@@ -102,6 +116,36 @@ bool PointCloud::getData(
   return true;
 }
 
+void PointCloud::voxelReduce(const sensor_msgs::msg::PointCloud2 & msg)
+{
+  voxel_points_.clear();
+  voxel_keys_.clear();
+
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(msg, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(msg, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(msg, "z");
+
+  const float inv_size = 1.0f / static_cast<float>(voxel_size_);
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    if (!std::isfinite(*iter_x) || !std::isfinite(*iter_y) || !std::isfinite(*iter_z)) {
+      continue;
+    }
+    // 21 bits per axis, biased to keep negative coordinates distinct
+    const uint64_t ix = static_cast<uint64_t>(
+      static_cast<int64_t>(std::floor(*iter_x * inv_size)) + (1 << 20)) & 0x1FFFFF;
+    const uint64_t iy = static_cast<uint64_t>(
+      static_cast<int64_t>(std::floor(*iter_y * inv_size)) + (1 << 20)) & 0x1FFFFF;
+    const uint64_t iz = static_cast<uint64_t>(
+      static_cast<int64_t>(std::floor(*iter_z * inv_size)) + (1 << 20)) & 0x1FFFFF;
+    const uint64_t key = (ix << 42) | (iy << 21) | iz;
+
+    // first point seen in a voxel represents it
+    if (voxel_keys_.insert(key).second) {
+      voxel_points_.push_back({*iter_x, *iter_y, *iter_z});
+    }
+  }
+}
+
 void PointCloud::getParameters(std::string & source_topic)
 {
   auto node = node_.lock();
@@ -117,11 +161,26 @@ void PointCloud::getParameters(std::string & source_topic)
   nav2_util::declare_parameter_if_not_declared(
     node, source_name_ + ".max_height", rclcpp::ParameterValue(0.5));
   max_height_ = node->get_parameter(source_name_ + ".max_height").as_double();
+  // Voxel edge length for down-sampling dense clouds before containment
+  // testing; 0.0 (default) passes every point through unchanged
+  nav2_util::declare_parameter_if_not_declared(
+    node, source_name_ + ".voxel_size", rclcpp::ParameterValue(0.0));
+  voxel_size_ = node->get_parameter(source_name_ + ".voxel_size").as_double();
 }
 
 void PointCloud::dataCallback(sensor_msgs::msg::PointCloud2::ConstSharedPtr msg)
 {
+  if (voxel_size_ > 0.0) {
+    voxelReduce(*msg);
+  }
   data_ = msg;
+  data_revision_++;
+}
+
+std::string PointCloud::getConversionKey() const
+{
+  return Source::getConversionKey() + "\n" + std::to_string(min_height_) + "\n" +
+    std::to_string(max_height_) + "\n" + std::to_string(voxel_size_);
 }
 
 }  // namespace nav2_collision_monitor
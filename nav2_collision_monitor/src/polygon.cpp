@@ -14,7 +14,9 @@
 
 #include "nav2_collision_monitor/polygon.hpp"
 
+#include <algorithm>
 #include <exception>
+#include <limits>
 #include <utility>
 
 #include "geometry_msgs/msg/point.hpp"
@@ -191,6 +193,7 @@ void Polygon::updatePolygon(const Velocity & /*cmd_vel_in*/)
       p_s.y = footprint_vec[i].y;
       polygon_.polygon.points[i] = p_s;
     }
+    updateEdgeTable();
   } else if (!polygon_.header.frame_id.empty() && polygon_.header.frame_id != base_frame_id_) {
     // Polygon is published in another frame: correct poly_ vertices to the latest frame state
     std::size_t new_size = polygon_.polygon.points.size();
@@ -215,15 +218,81 @@ void Polygon::updatePolygon(const Velocity & /*cmd_vel_in*/)
       // Fill poly_ array
       poly_[i] = {p_v3_b.x(), p_v3_b.y()};
     }
+    updateEdgeTable();
   }
 }
 
 int Polygon::getPointsInside(const std::vector<Point> & points) const
+{
+  return addPointsInside(points, 0);
+}
+
+int Polygon::getPointsInside(const PointSpans & spans) const
 {
   int num = 0;
-  for (const Point & point : points) {
-    if (isPointInside(point)) {
-      num++;
+  for (const std::vector<Point> * points : spans) {
+    num = addPointsInside(*points, num);
+    if (num >= min_points_) {
+      break;
+    }
+  }
+  return num;
+}
+
+int Polygon::addPointsInside(const std::vector<Point> & points, const int num_start) const
+{
+  // Batched version of the ray crossings test from isPointInside().
+  // Edge tables are precomputed once per shape update in updateEdgeTable(),
+  // and points are tested in small blocks with a branch-free inner loop,
+  // so that the compiler can vectorize it across the points of a block.
+  const std::size_t edges_num = edge_table_.inv_dy.size();
+  if (edges_num == 0) {
+    return num_start;
+  }
+
+  constexpr std::size_t batch_size = 8;
+  double px[batch_size], py[batch_size];
+  unsigned char inside[batch_size];
+
+  int num = num_start;
+  const std::size_t points_num = points.size();
+  for (std::size_t begin = 0; begin < points_num; begin += batch_size) {
+    const std::size_t n = std::min(batch_size, points_num - begin);
+    bool any_in_bounds = false;
+    for (std::size_t k = 0; k < n; k++) {
+      px[k] = points[begin + k].x;
+      py[k] = points[begin + k].y;
+      // Points outside the polygon bounding box are guaranteed to be outside
+      const bool in_bounds =
+        px[k] >= edge_table_.min_x && px[k] <= edge_table_.max_x &&
+        py[k] >= edge_table_.min_y && py[k] <= edge_table_.max_y;
+      inside[k] = 0;
+      any_in_bounds |= in_bounds;
+    }
+    if (!any_in_bounds) {
+      continue;
+    }
+
+    for (std::size_t e = 0; e < edges_num; e++) {
+      const double xi = edge_table_.xi[e];
+      const double yi = edge_table_.yi[e];
+      const double yj = edge_table_.yj[e];
+      const double inv_dy = edge_table_.inv_dy[e];
+      for (std::size_t k = 0; k < n; k++) {
+        // Same straddle condition as in isPointInside(), written branch-free
+        const bool straddles = (py[k] <= yi) != (py[k] <= yj);
+        const double x_inter = xi + (py[k] - yi) * inv_dy;
+        inside[k] ^= static_cast<unsigned char>(straddles & (x_inter > px[k]));
+      }
+    }
+
+    for (std::size_t k = 0; k < n; k++) {
+      num += inside[k];
+    }
+    // All callers compare the number of points against min_points_ only,
+    // so there is no need to keep counting once the action is triggered
+    if (num >= min_points_) {
+      return num;
     }
   }
   return num;
@@ -237,22 +306,24 @@ double Polygon::getCollisionTime(
   Pose pose = {0.0, 0.0, 0.0};
   Velocity vel = velocity;
 
-  // Array of points transformed to the frame concerned with pose on each simulation step
-  std::vector<Point> points_transformed = collision_points;
-
   // Check static polygon
-  if (getPointsInside(points_transformed) >= min_points_) {
+  if (getPointsInside(collision_points) >= min_points_) {
     return 0.0;
   }
 
+  // Array of points transformed to the frame concerned with pose on each simulation step.
+  // Its capacity is reused between the steps.
+  std::vector<Point> points_transformed;
+  points_transformed.reserve(collision_points.size());
+
   // Robot movement simulation
   for (double time = 0.0; time <= time_before_collision_; time += simulation_time_step_) {
     // Shift the robot pose towards to the vel during simulation_time_step_ time interval
     // NOTE: vel is changing during the simulation
     projectState(simulation_time_step_, pose, vel);
     // Transform collision_points to the frame concerned with current robot pose
-    points_transformed = collision_points;
-    transformPoints(pose, points_transformed);
+    // in one pass, without re-copying them first
+    transformPoints(pose, collision_points, points_transformed);
     // If the collision occurred on this stage, return the actual time before a collision
     // as if robot was moved with given velocity
     if (getPointsInside(points_transformed) >= min_points_) {
@@ -264,6 +335,25 @@ double Polygon::getCollisionTime(
   return -1.0;
 }
 
+double Polygon::getCollisionTime(
+  const PointSpans & collision_spans,
+  const Velocity & velocity) const
+{
+  // Movement simulation shifts the points on every step, so here one
+  // working copy of all spans is unavoidable
+  std::size_t points_num = 0;
+  for (const std::vector<Point> * points : collision_spans) {
+    points_num += points->size();
+  }
+  std::vector<Point> collision_points;
+  collision_points.reserve(points_num);
+  for (const std::vector<Point> * points : collision_spans) {
+    collision_points.insert(collision_points.end(), points->begin(), points->end());
+  }
+
+  return getCollisionTime(collision_points, velocity);
+}
+
 void Polygon::publish()
 {
   if (!visualize_) {
@@ -426,6 +516,7 @@ bool Polygon::getParameters(
       node->get_parameter(polygon_name_ + ".points").as_string();
 
     use_dynamic_sub = !getPolygonFromString(poly_string, poly_);
+    updateEdgeTable();
   } catch (const rclcpp::exceptions::ParameterUninitializedException &) {
     RCLCPP_INFO(
       logger_,
@@ -503,6 +594,7 @@ void Polygon::updatePolygon(geometry_msgs::msg::PolygonStamped::ConstSharedPtr m
     // Fill poly_ array
     poly_[i] = {p_v3_b.x(), p_v3_b.y()};
   }
+  updateEdgeTable();
 
   // Store incoming polygon for further (possible) poly_ vertices corrections
   // from PolygonStamped frame -> to base frame
@@ -570,6 +662,46 @@ inline bool Polygon::isPointInside(const Point & point) const
   return res;
 }
 
+void Polygon::updateEdgeTable()
+{
+  buildEdgeTable(poly_, edge_table_);
+}
+
+void Polygon::buildEdgeTable(const std::vector<Point> & poly, EdgeTable & table) const
+{
+  const std::size_t poly_size = poly.size();
+  table.xi.clear();
+  table.yi.clear();
+  table.yj.clear();
+  table.inv_dy.clear();
+  table.xi.reserve(poly_size);
+  table.yi.reserve(poly_size);
+  table.yj.reserve(poly_size);
+  table.inv_dy.reserve(poly_size);
+
+  table.min_x = table.min_y = std::numeric_limits<double>::max();
+  table.max_x = table.max_y = std::numeric_limits<double>::lowest();
+  for (const Point & p : poly) {
+    table.min_x = std::min(table.min_x, p.x);
+    table.min_y = std::min(table.min_y, p.y);
+    table.max_x = std::max(table.max_x, p.x);
+    table.max_y = std::max(table.max_y, p.y);
+  }
+
+  // Starting from the edge where the last point of polygon is connected to the first
+  std::size_t i = poly_size > 0 ? poly_size - 1 : 0;
+  for (std::size_t j = 0; j < poly_size; i = j++) {
+    // Edges parallel to X+ ray never change the crossings parity: leave them out
+    if (poly[i].y == poly[j].y) {
+      continue;
+    }
+    table.xi.push_back(poly[i].x);
+    table.yi.push_back(poly[i].y);
+    table.yj.push_back(poly[j].y);
+    table.inv_dy.push_back((poly[j].x - poly[i].x) / (poly[j].y - poly[i].y));
+  }
+}
+
 bool Polygon::getPolygonFromString(
   std::string & poly_string,
   std::vector<Point> & polygon)
@@ -16,6 +16,7 @@
 
 #include <cmath>
 #include <functional>
+#include <string>
 
 #include "geometry_msgs/msg/polygon_stamped.hpp"
 #include "tf2/transform_datatypes.h"
@@ -173,6 +174,8 @@ void PolygonSource::dataCallback(geometry_msgs::msg::PolygonInstanceStamped::Con
   }
   auto curr_time = node->now();
 
+  data_revision_++;
+
   // check if older similar polygon exists already and replace it with the new one
   for (auto & polygon_stamped : data_) {
     if (msg->polygon.id == polygon_stamped.polygon.id) {
@@ -183,4 +186,9 @@ void PolygonSource::dataCallback(geometry_msgs::msg::PolygonInstanceStamped::Con
   data_.push_back(*msg);
 }
 
+std::string PolygonSource::getConversionKey() const
+{
+  return Source::getConversionKey() + "\n" + std::to_string(sampling_distance_);
+}
+
 }  // namespace nav2_collision_monitor
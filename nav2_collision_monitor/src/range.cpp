@@ -17,6 +17,7 @@
 #include <math.h>
 #include <cmath>
 #include <functional>
+#include <string>
 
 #include "tf2/transform_datatypes.h"
 
@@ -145,6 +146,12 @@ void Range::getParameters(std::string & source_topic)
 void Range::dataCallback(sensor_msgs::msg::Range::ConstSharedPtr msg)
 {
   data_ = msg;
+  data_revision_++;
+}
+
+std::string Range::getConversionKey() const
+{
+  return Source::getConversionKey() + "\n" + std::to_string(obstacles_angle_);
 }
 
 }  // namespace nav2_collision_monitor
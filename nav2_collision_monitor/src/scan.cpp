@@ -36,7 +36,7 @@ Scan::Scan(
 : Source(
     node, source_name, tf_buffer, base_frame_id, global_frame_id,
     transform_tolerance, source_timeout, base_shift_correction),
-  data_(nullptr)
+  data_(nullptr), table_angle_min_(0.0), table_angle_increment_(0.0)
 {
   RCLCPP_INFO(logger_, "[%s]: Creating Scan", source_name_.c_str());
 }
@@ -85,27 +85,49 @@ bool Scan::getData(
   }
 
   // Calculate poses and refill data array
-  float angle = data_->angle_min;
+  updateTrigTables();
+  data.reserve(data.size() + data_->ranges.size());
   for (size_t i = 0; i < data_->ranges.size(); i++) {
     if (data_->ranges[i] >= data_->range_min && data_->ranges[i] <= data_->range_max) {
       // Transform point coordinates from source frame -> to base frame
       tf2::Vector3 p_v3_s(
-        data_->ranges[i] * std::cos(angle),
-        data_->ranges[i] * std::sin(angle),
+        data_->ranges[i] * cos_table_[i],
+        data_->ranges[i] * sin_table_[i],
         0.0);
       tf2::Vector3 p_v3_b = tf_transform * p_v3_s;
 
       // Refill data array
       data.push_back({p_v3_b.x(), p_v3_b.y()});
     }
-    angle += data_->angle_increment;
   }
   return true;
 }
 
+void Scan::updateTrigTables()
+{
+  if (cos_table_.size() == data_->ranges.size() &&
+    table_angle_min_ == data_->angle_min &&
+    table_angle_increment_ == data_->angle_increment)
+  {
+    return;
+  }
+
+  cos_table_.resize(data_->ranges.size());
+  sin_table_.resize(data_->ranges.size());
+  float angle = data_->angle_min;
+  for (size_t i = 0; i < data_->ranges.size(); i++) {
+    cos_table_[i] = std::cos(angle);
+    sin_table_[i] = std::sin(angle);
+    angle += data_->angle_increment;
+  }
+  table_angle_min_ = data_->angle_min;
+  table_angle_increment_ = data_->angle_increment;
+}
+
 void Scan::dataCallback(sensor_msgs::msg::LaserScan::ConstSharedPtr msg)
 {
   data_ = msg;
+  data_revision_++;
 }
 
 }  // namespace nav2_collision_monitor
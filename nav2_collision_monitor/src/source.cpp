@@ -15,6 +15,8 @@
 #include "nav2_collision_monitor/source.hpp"
 
 #include <exception>
+#include <string>
+#include <typeinfo>
 
 #include "geometry_msgs/msg/transform_stamped.hpp"
 
@@ -66,6 +68,7 @@ void Source::getCommonParameters(std::string & source_topic)
     node, source_name_ + ".topic",
     rclcpp::ParameterValue("scan"));  // Set deafult topic for laser scanner
   source_topic = node->get_parameter(source_name_ + ".topic").as_string();
+  source_topic_ = source_topic;
 
   nav2_util::declare_parameter_if_not_declared(
     node, source_name_ + ".enabled", rclcpp::ParameterValue(true));
@@ -97,6 +100,31 @@ bool Source::sourceValid(
   return true;
 }
 
+bool Source::refreshPoints(const rclcpp::Time & curr_time)
+{
+  // When the source is shared between composed nodes, or polled faster than
+  // the sensor publishes, repeat refreshes over the same data reuse the
+  // previously converted points: within the transform tolerance the points
+  // are no staler than the conversion itself is allowed to be
+  if (last_refresh_ok_ && converted_revision_ == data_revision_ &&
+    curr_time >= last_refresh_time_ &&
+    curr_time - last_refresh_time_ <= rclcpp::Duration(transform_tolerance_))
+  {
+    return true;
+  }
+
+  converted_revision_ = data_revision_;
+  last_refresh_time_ = curr_time;
+  points_.clear();
+  last_refresh_ok_ = getData(curr_time, points_);
+  return last_refresh_ok_;
+}
+
+const std::vector<Point> & Source::getPoints() const
+{
+  return points_;
+}
+
 bool Source::getEnabled() const
 {
   return enabled_;
@@ -112,6 +140,17 @@ rclcpp::Duration Source::getSourceTimeout() const
   return source_timeout_;
 }
 
+std::string Source::getConversionKey() const
+{
+  // Sources producing identical points have to agree on the message type,
+  // the input topic and every parameter the conversion depends on
+  return std::string(typeid(*this).name()) + "\n" + source_topic_ + "\n" +
+    base_frame_id_ + "\n" + global_frame_id_ + "\n" +
+    std::to_string(tf2::durationToSec(transform_tolerance_)) + "\n" +
+    std::to_string(source_timeout_.nanoseconds()) + "\n" +
+    (base_shift_correction_ ? "1" : "0");
+}
+
 rcl_interfaces::msg::SetParametersResult
 Source::dynamicParametersCallback(
   std::vector<rclcpp::Parameter> parameters)
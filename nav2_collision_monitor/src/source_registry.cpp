@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_collision_monitor/source_registry.hpp"
+
+#include "rclcpp/rclcpp.hpp"
+
+namespace nav2_collision_monitor
+{
+
+std::mutex SourceRegistry::mutex_;
+std::unordered_map<std::string, std::weak_ptr<Source>> SourceRegistry::sources_;
+
+std::shared_ptr<Source> SourceRegistry::getOrRegister(
+  const std::shared_ptr<Source> & candidate)
+{
+  const std::string key = candidate->getConversionKey();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = sources_.find(key);
+  if (it != sources_.end()) {
+    if (std::shared_ptr<Source> existing = it->second.lock()) {
+      RCLCPP_INFO(
+        rclcpp::get_logger("collision_monitor"),
+        "[%s]: Sharing the conversion pipeline of equivalent source %s",
+        candidate->getSourceName().c_str(), existing->getSourceName().c_str());
+      return existing;
+    }
+  }
+
+  sources_[key] = candidate;
+  return candidate;
+}
+
+}  // namespace nav2_collision_monitor
@@ -135,24 +135,42 @@ bool VelocityPolygon::getParameters(
       ex.what());
     return false;
   }
+
+  buildSubPolygonTables();
+
   return true;
 }
 
+void VelocityPolygon::buildSubPolygonTables()
+{
+  sub_polygon_tables_.resize(sub_polygons_.size());
+  for (std::size_t i = 0; i < sub_polygons_.size(); i++) {
+    SubPolygonTable & table = sub_polygon_tables_[i];
+    buildEdgeTable(sub_polygons_[i].poly_, table.edge_table_);
+
+    table.vis_points_.clear();
+    table.vis_points_.reserve(sub_polygons_[i].poly_.size());
+    for (const Point & p : sub_polygons_[i].poly_) {
+      geometry_msgs::msg::Point32 p_s;
+      p_s.x = p.x;
+      p_s.y = p.y;
+      // p_s.z will remain 0.0
+      table.vis_points_.push_back(p_s);
+    }
+  }
+  active_sub_polygon_ = -1;
+}
+
 void VelocityPolygon::updatePolygon(const Velocity & cmd_vel_in)
 {
-  for (auto & sub_polygon : sub_polygons_) {
-    if (isInRange(cmd_vel_in, sub_polygon)) {
-      // Set the polygon that is within the speed range
-      poly_ = sub_polygon.poly_;
-
-      // Update visualization polygon
-      polygon_.polygon.points.clear();
-      for (const Point & p : poly_) {
-        geometry_msgs::msg::Point32 p_s;
-        p_s.x = p.x;
-        p_s.y = p.y;
-        // p_s.z will remain 0.0
-        polygon_.polygon.points.push_back(p_s);
+  for (std::size_t i = 0; i < sub_polygons_.size(); i++) {
+    if (isInRange(cmd_vel_in, sub_polygons_[i])) {
+      if (static_cast<int>(i) != active_sub_polygon_) {
+        // Swap in the tables precompiled for the selected velocity bin
+        active_sub_polygon_ = static_cast<int>(i);
+        poly_ = sub_polygons_[i].poly_;
+        edge_table_ = sub_polygon_tables_[i].edge_table_;
+        polygon_.polygon.points = sub_polygon_tables_[i].vis_points_;
       }
       return;
     }
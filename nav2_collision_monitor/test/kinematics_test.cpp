@@ -64,6 +64,29 @@ TEST(KinematicsTest, testTransformPoints)
   EXPECT_NEAR(points[1].y, new_point_distance * std::sin(new_point_angle), EPSILON);
 }
 
+TEST(KinematicsTest, testTransformPointsOutOfPlace)
+{
+  const nav2_collision_monitor::Pose tf{2.0, 1.0, M_PI / 6.0};
+  std::vector<nav2_collision_monitor::Point> points;
+  points.push_back({3.0, 2.0});
+  points.push_back({0.0, 0.0});
+  points.push_back({-1.0, 4.0});
+
+  // The out-of-place transformation should leave the source points intact
+  // and produce exactly what the in-place one does
+  std::vector<nav2_collision_monitor::Point> points_transformed;
+  nav2_collision_monitor::transformPoints(tf, points, points_transformed);
+  ASSERT_EQ(points_transformed.size(), points.size());
+  EXPECT_NEAR(points[0].x, 3.0, EPSILON);
+  EXPECT_NEAR(points[2].y, 4.0, EPSILON);
+
+  nav2_collision_monitor::transformPoints(tf, points);
+  for (size_t i = 0; i < points.size(); i++) {
+    EXPECT_NEAR(points_transformed[i].x, points[i].x, EPSILON);
+    EXPECT_NEAR(points_transformed[i].y, points[i].y, EPSILON);
+  }
+}
+
 TEST(KinematicsTest, testProjectState)
 {
   //     Y                                Y
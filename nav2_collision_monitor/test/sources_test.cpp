@@ -39,6 +39,7 @@
 #include "nav2_collision_monitor/pointcloud.hpp"
 #include "nav2_collision_monitor/range.hpp"
 #include "nav2_collision_monitor/polygon_source.hpp"
+#include "nav2_collision_monitor/source_registry.hpp"
 
 using namespace std::chrono_literals;
 
@@ -741,6 +742,33 @@ TEST_F(Tester, testIgnoreTimeShift)
   checkPolygon(data);
 }
 
+TEST_F(Tester, testSourceRegistry)
+{
+  createSources();
+
+  // The first registration returns the candidate itself
+  EXPECT_EQ(nav2_collision_monitor::SourceRegistry::getOrRegister(scan_), scan_);
+
+  // An equivalent scan gets the already registered conversion pipeline
+  std::shared_ptr<ScanWrapper> twin = std::make_shared<ScanWrapper>(
+    test_node_, SCAN_NAME, tf_buffer_,
+    BASE_FRAME_ID, GLOBAL_FRAME_ID,
+    TRANSFORM_TOLERANCE, DATA_TIMEOUT, true);
+  twin->configure();
+  EXPECT_EQ(nav2_collision_monitor::SourceRegistry::getOrRegister(twin), scan_);
+
+  // A scan differing in a conversion parameter is registered on its own
+  std::shared_ptr<ScanWrapper> shifted = std::make_shared<ScanWrapper>(
+    test_node_, SCAN_NAME, tf_buffer_,
+    BASE_FRAME_ID, GLOBAL_FRAME_ID,
+    TRANSFORM_TOLERANCE, DATA_TIMEOUT, false);
+  shifted->configure();
+  EXPECT_EQ(nav2_collision_monitor::SourceRegistry::getOrRegister(shifted), shifted);
+
+  // Sources of different types never share a pipeline
+  EXPECT_EQ(nav2_collision_monitor::SourceRegistry::getOrRegister(pointcloud_), pointcloud_);
+}
+
 int main(int argc, char ** argv)
 {
   // Initialize the system
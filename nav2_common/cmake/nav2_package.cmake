@@ -41,6 +41,11 @@ macro(nav2_package)
     add_compile_options("$<$<COMPILE_LANGUAGE:CXX>:-Wnon-virtual-dtor>")
   endif()
 
+  option(NAV2_TRACING_ENABLED "Compile in the Nav2 tracepoints" FALSE)
+  if(NAV2_TRACING_ENABLED)
+    add_compile_definitions(NAV2_TRACING_ENABLED)
+  endif()
+
   option(COVERAGE_ENABLED "Enable code coverage" FALSE)
   if(COVERAGE_ENABLED)
     add_compile_options(--coverage)
@@ -182,6 +182,15 @@ struct OptimizerParams
     nav2_util::declare_parameter_if_not_declared(
       node, local_name + "debug_optimizer", rclcpp::ParameterValue(false));
     node->get_parameter(local_name + "debug_optimizer", debug);
+    nav2_util::declare_parameter_if_not_declared(
+      node, local_name + "num_threads", rclcpp::ParameterValue(1));
+    node->get_parameter(local_name + "num_threads", num_threads);
+    if (num_threads < 1) {
+      RCLCPP_ERROR(
+        rclcpp::get_logger("constrained_smoother"),
+        "num_threads must be at least 1");
+      throw std::runtime_error("Invalid parameter: num_threads");
+    }
   }
 
   const std::map<std::string, ceres::LinearSolverType> solver_types = {
@@ -191,6 +200,7 @@ struct OptimizerParams
   bool debug;
   std::string linear_solver_type;
   int max_iterations;  // Ceres default: 50
+  int num_threads{1};  // Ceres default: 1
 
   double param_tol;  // Ceres default: 1e-8
   double fn_tol;  // Ceres default: 1e-6
@@ -64,6 +64,7 @@ public:
     options_.linear_solver_type = params.solver_types.at(params.linear_solver_type);
 
     options_.max_num_iterations = params.max_iterations;
+    options_.num_threads = params.num_threads;
 
     options_.function_tolerance = params.fn_tol;
     options_.gradient_tolerance = params.gradient_tol;
@@ -100,10 +101,18 @@ public:
 
     options_.max_solver_time_in_seconds = params.max_time;
 
+    // Round the scratch buffer capacity up to the next path length bucket so
+    // that consecutive requests of similar length reuse the allocations
+    // instead of growing them from scratch every time
+    size_t bucket_size = 64;
+    while (bucket_size < path.size()) {
+      bucket_size *= 2;
+    }
+    path_optim_.reserve(bucket_size);
+    optimized_.reserve(bucket_size);
+
     ceres::Problem problem;
-    std::vector<Eigen::Vector3d> path_optim;
-    std::vector<bool> optimized;
-    if (buildProblem(path, costmap, params, problem, path_optim, optimized)) {
+    if (buildProblem(path, costmap, params, problem, path_optim_, optimized_)) {
       // solve the problem
       ceres::Solver::Summary summary;
       ceres::Solve(options_, &problem, &summary);
@@ -117,7 +126,7 @@ public:
       RCLCPP_INFO(rclcpp::get_logger("smoother_server"), "Path too short to optimize");
     }
 
-    upsampleAndPopulate(path_optim, optimized, start_dir, end_dir, params, path);
+    upsampleAndPopulate(path_optim_, optimized_, start_dir, end_dir, params, path);
 
     return true;
   }
@@ -141,17 +150,28 @@ private:
     std::vector<Eigen::Vector3d> & path_optim,
     std::vector<bool> & optimized)
   {
-    // Create costmap grid
-    costmap_grid_ = std::make_shared<ceres::Grid2D<u_char>>(
-      costmap->getCharMap(), 0, costmap->getSizeInCellsY(), 0, costmap->getSizeInCellsX());
-    auto costmap_interpolator = std::make_shared<ceres::BiCubicInterpolator<ceres::Grid2D<u_char>>>(
-      *costmap_grid_);
+    // Create costmap grid, reusing the wrapper from the previous request if
+    // the costmap buffer is unchanged (Grid2D reads the live char map, so the
+    // cell contents need no rebuild)
+    if (!costmap_interpolator_ || costmap->getCharMap() != costmap_cells_ ||
+      costmap->getSizeInCellsX() != costmap_size_x_ ||
+      costmap->getSizeInCellsY() != costmap_size_y_)
+    {
+      costmap_cells_ = costmap->getCharMap();
+      costmap_size_x_ = costmap->getSizeInCellsX();
+      costmap_size_y_ = costmap->getSizeInCellsY();
+      costmap_grid_ = std::make_shared<ceres::Grid2D<u_char>>(
+        costmap_cells_, 0, costmap_size_y_, 0, costmap_size_x_);
+      costmap_interpolator_ =
+        std::make_shared<ceres::BiCubicInterpolator<ceres::Grid2D<u_char>>>(*costmap_grid_);
+    }
+    auto costmap_interpolator = costmap_interpolator_;
 
     // Create residual blocks
     const double cusp_half_length = params.cusp_zone_length / 2;
     ceres::LossFunction * loss_function = NULL;
     path_optim = path;
-    optimized = std::vector<bool>(path.size());
+    optimized.assign(path.size(), false);
     optimized[0] = true;
     int prelast_i = -1;
     int last_i = 0;
@@ -395,6 +415,13 @@ private:
   bool debug_;
   ceres::Solver::Options options_;
   std::shared_ptr<ceres::Grid2D<u_char>> costmap_grid_;
+  std::shared_ptr<ceres::BiCubicInterpolator<ceres::Grid2D<u_char>>> costmap_interpolator_;
+  const u_char * costmap_cells_{nullptr};
+  unsigned int costmap_size_x_{0};
+  unsigned int costmap_size_y_{0};
+  // Scratch buffers reused across requests, reserved in path length buckets
+  std::vector<Eigen::Vector3d> path_optim_;
+  std::vector<bool> optimized_;
 };
 
 }  // namespace nav2_constrained_smoother
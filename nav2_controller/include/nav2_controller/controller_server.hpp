@@ -115,6 +115,9 @@ protected:
   // Our action server implements the FollowPath action
   std::unique_ptr<ActionServer> action_server_;
 
+  // Preallocated feedback message, reused every control cycle
+  std::shared_ptr<Action::Feedback> feedback_;
+
   /**
    * @brief FollowPath action server callback. Handles action server updates and
    * spins server until goal is reached
@@ -160,8 +163,12 @@ protected:
   void setPlannerPath(const nav_msgs::msg::Path & path);
   /**
    * @brief Calculates velocity and publishes to "cmd_vel" topic
+   * @param pose Current robot pose, sampled once per control cycle
+   * @param twist Current thresholded odometry twist, sampled once per control cycle
    */
-  void computeAndPublishVelocity();
+  void computeAndPublishVelocity(
+    const geometry_msgs::msg::PoseStamped & pose,
+    const nav_2d_msgs::msg::Twist2D & twist);
   /**
    * @brief Calls setPlannerPath method with an updated path received from
    * action server
@@ -178,9 +185,13 @@ protected:
   void publishZeroVelocity();
   /**
    * @brief Checks if goal is reached
+   * @param pose Current robot pose, sampled once per control cycle
+   * @param twist Current thresholded odometry twist, sampled once per control cycle
    * @return true or false
    */
-  bool isGoalReached();
+  bool isGoalReached(
+    const geometry_msgs::msg::PoseStamped & pose,
+    const nav_2d_msgs::msg::Twist2D & twist);
   /**
    * @brief Obtain current pose of the robot
    * @param pose To store current pose of the robot
@@ -53,13 +53,15 @@ protected:
    */
   void resetBaselinePose(const geometry_msgs::msg::Pose2D & pose);
 
-  static double pose_distance(
+  static double pose_distance_sq(
     const geometry_msgs::msg::Pose2D &,
     const geometry_msgs::msg::Pose2D &);
 
   rclcpp::Clock::SharedPtr clock_;
 
   double radius_;
+  // Cached squared radius_, compared against squared distances
+  double radius_sq_;
   rclcpp::Duration time_allowance_{0, 0};
 
   geometry_msgs::msg::Pose2D baseline_pose_;
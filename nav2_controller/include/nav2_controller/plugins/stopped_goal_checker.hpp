@@ -62,12 +62,25 @@ public:
   bool isGoalReached(
     const geometry_msgs::msg::Pose & query_pose, const geometry_msgs::msg::Pose & goal_pose,
     const geometry_msgs::msg::Twist & velocity) override;
+  bool isGoalReached(
+    const geometry_msgs::msg::Pose & query_pose, const geometry_msgs::msg::Pose & goal_pose,
+    const geometry_msgs::msg::Twist & velocity,
+    const nav2_core::PoseDelta & delta) override;
   bool getTolerances(
     geometry_msgs::msg::Pose & pose_tolerance,
     geometry_msgs::msg::Twist & vel_tolerance) override;
 
 protected:
+  /**
+   * @brief Check the velocity against the stopped thresholds
+   * @param velocity The robot's current velocity
+   * @return true if both rotation and translation are below their thresholds
+   */
+  bool isStopped(const geometry_msgs::msg::Twist & velocity) const;
+
   double rot_stopped_velocity_, trans_stopped_velocity_;
+  // Cached squares of the stopped velocity thresholds
+  double rot_stopped_velocity_sq_, trans_stopped_velocity_sq_;
   // Dynamic parameters handler
   rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr dyn_params_handler_;
   std::string plugin_name_;
@@ -117,6 +117,23 @@ bool SimpleGoalChecker::isGoalReached(
   return fabs(dyaw) < yaw_goal_tolerance_;
 }
 
+bool SimpleGoalChecker::isGoalReached(
+  const geometry_msgs::msg::Pose &, const geometry_msgs::msg::Pose &,
+  const geometry_msgs::msg::Twist &, const nav2_core::PoseDelta & delta)
+{
+  if (check_xy_) {
+    if (delta.xy_sq > xy_goal_tolerance_sq_) {
+      return false;
+    }
+    // We are within the window
+    // If we are stateful, change the state.
+    if (stateful_) {
+      check_xy_ = false;
+    }
+  }
+  return fabs(delta.yaw) < yaw_goal_tolerance_;
+}
+
 bool SimpleGoalChecker::getTolerances(
   geometry_msgs::msg::Pose & pose_tolerance,
   geometry_msgs::msg::Twist & vel_tolerance)
@@ -43,6 +43,7 @@ void SimpleProgressChecker::initialize(
     node, plugin_name + ".movement_time_allowance", rclcpp::ParameterValue(10.0));
   // Scale is set to 0 by default, so if it was not set otherwise, set to 0
   node->get_parameter_or(plugin_name + ".required_movement_radius", radius_, 0.5);
+  radius_sq_ = radius_ * radius_;
   double time_allowance_param = 0.0;
   node->get_parameter_or(plugin_name + ".movement_time_allowance", time_allowance_param, 10.0);
   time_allowance_ = rclcpp::Duration::from_seconds(time_allowance_param);
@@ -80,17 +81,17 @@ void SimpleProgressChecker::resetBaselinePose(const geometry_msgs::msg::Pose2D &
 
 bool SimpleProgressChecker::isRobotMovedEnough(const geometry_msgs::msg::Pose2D & pose)
 {
-  return pose_distance(pose, baseline_pose_) > radius_;
+  return pose_distance_sq(pose, baseline_pose_) > radius_sq_;
 }
 
-double SimpleProgressChecker::pose_distance(
+double SimpleProgressChecker::pose_distance_sq(
   const geometry_msgs::msg::Pose2D & pose1,
   const geometry_msgs::msg::Pose2D & pose2)
 {
   double dx = pose1.x - pose2.x;
   double dy = pose1.y - pose2.y;
 
-  return std::hypot(dx, dy);
+  return dx * dx + dy * dy;
 }
 
 rcl_interfaces::msg::SetParametersResult
@@ -104,6 +105,7 @@ SimpleProgressChecker::dynamicParametersCallback(std::vector<rclcpp::Parameter>
     if (type == ParameterType::PARAMETER_DOUBLE) {
       if (name == plugin_name_ + ".required_movement_radius") {
         radius_ = parameter.as_double();
+        radius_sq_ = radius_ * radius_;
       } else if (name == plugin_name_ + ".movement_time_allowance") {
         time_allowance_ = rclcpp::Duration::from_seconds(parameter.as_double());
       }
@@ -51,7 +51,8 @@ namespace nav2_controller
 {
 
 StoppedGoalChecker::StoppedGoalChecker()
-: SimpleGoalChecker(), rot_stopped_velocity_(0.25), trans_stopped_velocity_(0.25)
+: SimpleGoalChecker(), rot_stopped_velocity_(0.25), trans_stopped_velocity_(0.25),
+  rot_stopped_velocity_sq_(0.0625), trans_stopped_velocity_sq_(0.0625)
 {
 }
 
@@ -75,6 +76,9 @@ void StoppedGoalChecker::initialize(
   node->get_parameter(plugin_name + ".rot_stopped_velocity", rot_stopped_velocity_);
   node->get_parameter(plugin_name + ".trans_stopped_velocity", trans_stopped_velocity_);
 
+  rot_stopped_velocity_sq_ = rot_stopped_velocity_ * rot_stopped_velocity_;
+  trans_stopped_velocity_sq_ = trans_stopped_velocity_ * trans_stopped_velocity_;
+
   // Add callback for dynamic parameters
   dyn_params_handler_ = node->add_on_set_parameters_callback(
     std::bind(&StoppedGoalChecker::dynamicParametersCallback, this, _1));
@@ -89,8 +93,27 @@ bool StoppedGoalChecker::isGoalReached(
     return ret;
   }
 
-  return fabs(velocity.angular.z) <= rot_stopped_velocity_ &&
-         hypot(velocity.linear.x, velocity.linear.y) <= trans_stopped_velocity_;
+  return isStopped(velocity);
+}
+
+bool StoppedGoalChecker::isGoalReached(
+  const geometry_msgs::msg::Pose & query_pose, const geometry_msgs::msg::Pose & goal_pose,
+  const geometry_msgs::msg::Twist & velocity, const nav2_core::PoseDelta & delta)
+{
+  bool ret = SimpleGoalChecker::isGoalReached(query_pose, goal_pose, velocity, delta);
+  if (!ret) {
+    return ret;
+  }
+
+  return isStopped(velocity);
+}
+
+bool StoppedGoalChecker::isStopped(const geometry_msgs::msg::Twist & velocity) const
+{
+  // Squared comparisons against the cached squared thresholds avoid the hypot
+  return velocity.angular.z * velocity.angular.z <= rot_stopped_velocity_sq_ &&
+         velocity.linear.x * velocity.linear.x + velocity.linear.y * velocity.linear.y <=
+         trans_stopped_velocity_sq_;
 }
 
 bool StoppedGoalChecker::getTolerances(
@@ -125,8 +148,10 @@ StoppedGoalChecker::dynamicParametersCallback(std::vector<rclcpp::Parameter> par
     if (type == ParameterType::PARAMETER_DOUBLE) {
       if (name == plugin_name_ + ".rot_stopped_velocity") {
         rot_stopped_velocity_ = parameter.as_double();
+        rot_stopped_velocity_sq_ = rot_stopped_velocity_ * rot_stopped_velocity_;
       } else if (name == plugin_name_ + ".trans_stopped_velocity") {
         trans_stopped_velocity_ = parameter.as_double();
+        trans_stopped_velocity_sq_ = trans_stopped_velocity_ * trans_stopped_velocity_;
       }
     }
   }
@@ -35,6 +35,7 @@
 #include <memory>
 #include <string>
 
+#include "angles/angles.h"
 #include "gtest/gtest.h"
 #include "nav2_controller/plugins/simple_goal_checker.hpp"
 #include "nav2_controller/plugins/stopped_goal_checker.hpp"
@@ -74,6 +75,19 @@ void checkMacro(
         nav_2d_utils::pose2DToPose(pose0),
         nav_2d_utils::pose2DToPose(pose1), nav_2d_utils::twist2Dto3D(v)));
   }
+
+  // The precomputed-delta overload must agree with the two-pose overload
+  gc.reset();
+  nav2_core::PoseDelta delta;
+  delta.dx = x0 - x1;
+  delta.dy = y0 - y1;
+  delta.xy_sq = delta.dx * delta.dx + delta.dy * delta.dy;
+  delta.yaw = angles::shortest_angular_distance(theta0, theta1);
+  EXPECT_EQ(
+    gc.isGoalReached(
+      nav_2d_utils::pose2DToPose(pose0),
+      nav_2d_utils::pose2DToPose(pose1), nav_2d_utils::twist2Dto3D(v), delta),
+    expected_result);
 }
 
 void sameResult(
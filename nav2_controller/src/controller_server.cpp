@@ -19,13 +19,19 @@
 #include <utility>
 #include <limits>
 
+#include "angles/angles.h"
 #include "lifecycle_msgs/msg/state.hpp"
 #include "nav2_core/controller_exceptions.hpp"
 #include "nav_2d_utils/conversions.hpp"
 #include "nav_2d_utils/tf_help.hpp"
 #include "nav2_util/node_utils.hpp"
 #include "nav2_util/geometry_utils.hpp"
+#include "nav2_util/trace.hpp"
 #include "nav2_controller/controller_server.hpp"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#include "tf2/utils.h"
+#pragma GCC diagnostic pop
 
 using namespace std::chrono_literals;
 using rcl_interfaces::msg::ParameterType;
@@ -237,6 +243,8 @@ ControllerServer::on_configure(const rclcpp_lifecycle::State & /*state*/)
     return nav2_util::CallbackReturn::FAILURE;
   }
 
+  feedback_ = std::make_shared<Action::Feedback>();
+
   // Set subscribtion to the speed limiting topic
   speed_limit_sub_ = create_subscription<nav2_msgs::msg::SpeedLimit>(
     speed_limit_topic, rclcpp::QoS(10),
@@ -324,6 +332,7 @@ ControllerServer::on_cleanup(const rclcpp_lifecycle::State & /*state*/)
 
   // Release any allocated resources
   action_server_.reset();
+  feedback_.reset();
   odom_sub_.reset();
   costmap_thread_.reset();
   vel_publisher_.reset();
@@ -486,9 +495,18 @@ void ControllerServer::computeControl()
 
       updateGlobalPath();
 
-      computeAndPublishVelocity();
+      // sample the robot pose and odometry once per cycle; the velocity
+      // computation and the goal check share them instead of issuing
+      // duplicate TF and odometry queries
+      geometry_msgs::msg::PoseStamped pose;
+      if (!getRobotPose(pose)) {
+        throw nav2_core::ControllerTFError("Failed to obtain robot pose");
+      }
+      nav_2d_msgs::msg::Twist2D twist = getThresholdedTwist(odom_sub_->getTwist());
+
+      computeAndPublishVelocity(pose, twist);
 
-      if (isGoalReached()) {
+      if (isGoalReached(pose, twist)) {
         RCLCPP_INFO(get_logger(), "Reached the goal!");
         break;
       }
@@ -588,20 +606,20 @@ void ControllerServer::setPlannerPath(const nav_msgs::msg::Path & path)
   current_path_ = path;
 }
 
-void ControllerServer::computeAndPublishVelocity()
+void ControllerServer::computeAndPublishVelocity(
+  const geometry_msgs::msg::PoseStamped & pose,
+  const nav_2d_msgs::msg::Twist2D & twist)
 {
-  geometry_msgs::msg::PoseStamped pose;
+  NAV2_TRACE(
+    "controller", "compute_velocity_begin",
+    costmap_ros_->getLayeredCostmap()->getUpdateCount());
 
-  if (!getRobotPose(pose)) {
-    throw nav2_core::ControllerTFError("Failed to obtain robot pose");
-  }
-
-  if (!progress_checkers_[current_progress_checker_]->check(pose)) {
+  // the progress checker API takes a mutable pose, so hand it its own copy
+  geometry_msgs::msg::PoseStamped progress_pose = pose;
+  if (!progress_checkers_[current_progress_checker_]->check(progress_pose)) {
     throw nav2_core::FailedToMakeProgress("Failed to make progress");
   }
 
-  nav_2d_msgs::msg::Twist2D twist = getThresholdedTwist(odom_sub_->getTwist());
-
   geometry_msgs::msg::TwistStamped cmd_vel_2d;
 
   try {
@@ -636,8 +654,9 @@ void ControllerServer::computeAndPublishVelocity()
     }
   }
 
-  std::shared_ptr<Action::Feedback> feedback = std::make_shared<Action::Feedback>();
-  feedback->speed = std::hypot(cmd_vel_2d.twist.linear.x, cmd_vel_2d.twist.linear.y);
+  // reuse the preallocated feedback message; publish_feedback() copies it out
+  // immediately, so nothing retains the buffer between cycles
+  feedback_->speed = std::hypot(cmd_vel_2d.twist.linear.x, cmd_vel_2d.twist.linear.y);
 
   // Find the closest pose to current pose on global path
   nav_msgs::msg::Path & current_path = current_path_;
@@ -656,12 +675,16 @@ void ControllerServer::computeAndPublishVelocity()
       return closest_pose_idx;
     };
 
-  feedback->distance_to_goal =
+  feedback_->distance_to_goal =
     nav2_util::geometry_utils::calculate_path_length(current_path_, find_closest_pose_idx());
-  action_server_->publish_feedback(feedback);
+  action_server_->publish_feedback(feedback_);
 
   RCLCPP_DEBUG(get_logger(), "Publishing velocity at time %.2f", now().seconds());
   publishVelocity(cmd_vel_2d);
+
+  NAV2_TRACE(
+    "controller", "compute_velocity_end",
+    costmap_ros_->getLayeredCostmap()->getUpdateCount());
 }
 
 void ControllerServer::updateGlobalPath()
@@ -711,9 +734,9 @@ void ControllerServer::updateGlobalPath()
 
 void ControllerServer::publishVelocity(const geometry_msgs::msg::TwistStamped & velocity)
 {
-  auto cmd_vel = std::make_unique<geometry_msgs::msg::TwistStamped>(velocity);
   if (vel_publisher_->is_activated() && vel_publisher_->get_subscription_count() > 0) {
-    vel_publisher_->publish(std::move(cmd_vel));
+    // publishing by const reference avoids a heap allocation per control cycle
+    vel_publisher_->publish(velocity);
   }
 }
 
@@ -737,15 +760,10 @@ void ControllerServer::publishZeroVelocity()
   }
 }
 
-bool ControllerServer::isGoalReached()
+bool ControllerServer::isGoalReached(
+  const geometry_msgs::msg::PoseStamped & pose,
+  const nav_2d_msgs::msg::Twist2D & twist)
 {
-  geometry_msgs::msg::PoseStamped pose;
-
-  if (!getRobotPose(pose)) {
-    return false;
-  }
-
-  nav_2d_msgs::msg::Twist2D twist = getThresholdedTwist(odom_sub_->getTwist());
   geometry_msgs::msg::Twist velocity = nav_2d_utils::twist2Dto3D(twist);
 
   geometry_msgs::msg::PoseStamped transformed_end_pose;
@@ -754,9 +772,19 @@ bool ControllerServer::isGoalReached()
     costmap_ros_->getTfBuffer(), costmap_ros_->getGlobalFrameID(),
     end_pose_, transformed_end_pose, tolerance);
 
+  // Compute the relative state once and hand it to the checker, so stock
+  // checkers compare squared distances and extract the headings only here
+  nav2_core::PoseDelta delta;
+  delta.dx = pose.pose.position.x - transformed_end_pose.pose.position.x;
+  delta.dy = pose.pose.position.y - transformed_end_pose.pose.position.y;
+  delta.xy_sq = delta.dx * delta.dx + delta.dy * delta.dy;
+  delta.yaw = angles::shortest_angular_distance(
+    tf2::getYaw(pose.pose.orientation),
+    tf2::getYaw(transformed_end_pose.pose.orientation));
+
   return goal_checkers_[current_goal_checker_]->isGoalReached(
     pose.pose, transformed_end_pose.pose,
-    velocity);
+    velocity, delta);
 }
 
 bool ControllerServer::getRobotPose(geometry_msgs::msg::PoseStamped & pose)
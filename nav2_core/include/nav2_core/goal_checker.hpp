@@ -49,6 +49,24 @@
 namespace nav2_core
 {
 
+/**
+ * @struct PoseDelta
+ * @brief Relative state between a query pose and the goal, computed once per
+ * control cycle by the caller and shared across checker invocations
+ *
+ * Holding the squared planar distance lets checkers compare against
+ * precomputed squared tolerances without taking a square root, and the
+ * heading difference is extracted from the quaternions only once per cycle
+ * rather than once per checker.
+ */
+struct PoseDelta
+{
+  double dx{0.0};      ///< Query minus goal position, x
+  double dy{0.0};      ///< Query minus goal position, y
+  double xy_sq{0.0};   ///< Squared planar distance between the poses
+  double yaw{0.0};     ///< Shortest angular distance between the headings
+};
+
 /**
  * @class GoalChecker
  * @brief Function-object for checking whether a goal has been reached
@@ -87,6 +105,26 @@ public:
     const geometry_msgs::msg::Pose & query_pose, const geometry_msgs::msg::Pose & goal_pose,
     const geometry_msgs::msg::Twist & velocity) = 0;
 
+  /**
+   * @brief Check whether the goal should be considered reached, reusing a
+   * pose delta the caller already computed for this control cycle
+   *
+   * The base implementation ignores the delta and defers to the two-pose
+   * overload, so existing plugins need no changes; checkers that can run
+   * purely on the delta override this to avoid recomputing it.
+   * @param query_pose The pose to check
+   * @param goal_pose The pose to check against
+   * @param velocity The robot's current velocity
+   * @param delta Precomputed relative state between the two poses
+   * @return True if goal is reached
+   */
+  virtual bool isGoalReached(
+    const geometry_msgs::msg::Pose & query_pose, const geometry_msgs::msg::Pose & goal_pose,
+    const geometry_msgs::msg::Twist & velocity, const PoseDelta & /*delta*/)
+  {
+    return isGoalReached(query_pose, goal_pose, velocity);
+  }
+
   /**
    * @brief Get the maximum possible tolerances used for goal checking in the major types.
    * Any field without a valid entry is replaced with std::numeric_limits<double>::lowest()
@@ -0,0 +1,67 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_CORE__GOAL_SET_PLANNER_HPP_
+#define NAV2_CORE__GOAL_SET_PLANNER_HPP_
+
+#include <memory>
+#include <vector>
+#include <functional>
+#include "nav_msgs/msg/path.hpp"
+#include "geometry_msgs/msg/pose_stamped.hpp"
+
+namespace nav2_core
+{
+
+/**
+ * @class GoalSetPlanner
+ * @brief Optional capability interface for global planners that can plan to
+ * the cheapest of several candidate goals in a single search, rather than
+ * requiring one full search per candidate. The planner server detects
+ * support by dynamic_cast on the loaded GlobalPlanner plugin and falls back
+ * to sequential per-goal planning when a plugin does not implement it.
+ */
+class GoalSetPlanner
+{
+public:
+  using Ptr = std::shared_ptr<GoalSetPlanner>;
+
+  /**
+   * @brief Virtual destructor
+   */
+  virtual ~GoalSetPlanner() {}
+
+  /**
+   * @brief Method to create a plan to the cheapest of a set of candidate goals
+   * @param start The starting pose of the robot
+   * @param goals Candidate goal poses of the robot
+   * @param cancel_checker Function to check if the action has been canceled
+   * @param best_goal_index Set to the index of the candidate the path
+   * reaches, -1 if none was settled
+   * @param goal_costs Set to per-candidate planning costs in the planner's
+   * cost units: exact for the settled goal, an upper bound for candidates
+   * touched by the shared search, -1 for candidates not reached
+   * @return The sequence of poses to get from start to the cheapest goal
+   */
+  virtual nav_msgs::msg::Path createPlanToGoalSet(
+    const geometry_msgs::msg::PoseStamped & start,
+    const std::vector<geometry_msgs::msg::PoseStamped> & goals,
+    std::function<bool()> cancel_checker,
+    int & best_goal_index,
+    std::vector<float> & goal_costs) = 0;
+};
+
+}  // namespace nav2_core
+
+#endif  // NAV2_CORE__GOAL_SET_PLANNER_HPP_
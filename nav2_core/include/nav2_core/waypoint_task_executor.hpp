@@ -64,6 +64,16 @@ public:
    */
   virtual bool processAtWaypoint(
     const geometry_msgs::msg::PoseStamped & curr_pose, const int & curr_waypoint_index) = 0;
+
+  /**
+   * @brief Override this to return false when the task does not need to hold
+   * up navigation, letting the caller run processAtWaypoint on a background
+   * thread and continue to the next waypoint while it completes (e.g. tasks
+   * dominated by disk or network I/O). Such a task must tolerate being run
+   * concurrently with another instance of itself.
+   * @return true if navigation should wait for the task to finish
+   */
+  virtual bool isBlocking() {return true;}
 };
 }  // namespace nav2_core
 #endif  // NAV2_CORE__WAYPOINT_TASK_EXECUTOR_HPP_
@@ -0,0 +1,212 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nav2_costmap_2d/cost_values.hpp"
+#include "nav2_costmap_2d/costmap_2d.hpp"
+#include "nav2_costmap_2d/costmap_layer.hpp"
+#include "nav2_costmap_2d/denoise_layer.hpp"
+#include "nav2_costmap_2d/inflation_layer.hpp"
+#include "nav2_costmap_2d/layered_costmap.hpp"
+#include "nav2_util/lifecycle_node.hpp"
+#include "tf2_ros/buffer.h"
+
+#include "testing_helper.hpp"
+
+using namespace nav2_costmap_2d;  // NOLINT
+
+class RosLockGuard
+{
+public:
+  RosLockGuard() {rclcpp::init(0, nullptr);}
+  ~RosLockGuard() {rclcpp::shutdown();}
+};
+
+RosLockGuard g_rclcpp;
+
+// Expose the protected raytracing primitives for benchmarking
+class RaytraceCostmap : public Costmap2D
+{
+public:
+  using Costmap2D::Costmap2D;
+  using Costmap2D::raytraceLine;
+  using Costmap2D::raytraceLineFill;
+};
+
+// Minimal layer used to benchmark the protected combination kernels
+class MaxCombineLayer : public CostmapLayer
+{
+public:
+  MaxCombineLayer() {enabled_ = true;}
+  void updateBounds(double, double, double, double *, double *, double *, double *) override {}
+  void updateCosts(Costmap2D & master_grid, int min_i, int min_j, int max_i, int max_j) override
+  {
+    updateWithMax(master_grid, min_i, min_j, max_i, max_j);
+  }
+  void reset() override {}
+  bool isClearable() override {return false;}
+};
+
+// Endpoints of a simulated 360 beam scan from the map center to its edges
+std::vector<std::pair<unsigned int, unsigned int>> scanEndpoints(unsigned int size)
+{
+  std::vector<std::pair<unsigned int, unsigned int>> endpoints;
+  const double cx = size / 2.0;
+  const double cy = size / 2.0;
+  const double range = size / 2.0 - 1.0;
+  for (int beam = 0; beam < 360; ++beam) {
+    const double angle = beam * M_PI / 180.0;
+    endpoints.emplace_back(
+      static_cast<unsigned int>(cx + range * std::cos(angle)),
+      static_cast<unsigned int>(cy + range * std::sin(angle)));
+  }
+  return endpoints;
+}
+
+// Lethal wall segments plus scattered points, resembling an indoor map
+void paintObstacles(unsigned char * map, unsigned int size, double point_density)
+{
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<> dis(0.0, 1.0);
+  for (unsigned int j = 0; j < size; ++j) {
+    for (unsigned int i = 0; i < size; ++i) {
+      if (j % 25 == 0 && i % 50 < 35) {
+        map[j * size + i] = LETHAL_OBSTACLE;
+      } else if (dis(gen) < point_density) {
+        map[j * size + i] = LETHAL_OBSTACLE;
+      }
+    }
+  }
+}
+
+static void BM_RaytraceLine(benchmark::State & state)
+{
+  const unsigned int size = state.range(0);
+  RaytraceCostmap costmap(size, size, 0.05, 0.0, 0.0, FREE_SPACE);
+  const auto endpoints = scanEndpoints(size);
+
+  unsigned char * map = costmap.getCharMap();
+  struct MarkFree
+  {
+    unsigned char * map;
+    void operator()(unsigned int offset) {map[offset] = FREE_SPACE;}
+  };
+
+  for (auto _ : state) {
+    for (const auto & end : endpoints) {
+      costmap.raytraceLine(MarkFree{map}, size / 2, size / 2, end.first, end.second);
+    }
+  }
+  // Each beam visits roughly half the map size worth of cells
+  state.SetItemsProcessed(state.iterations() * endpoints.size() * (size / 2));
+}
+BENCHMARK(BM_RaytraceLine)->Arg(200)->Arg(1000)->Arg(4000);
+
+static void BM_RaytraceLineFill(benchmark::State & state)
+{
+  const unsigned int size = state.range(0);
+  RaytraceCostmap costmap(size, size, 0.05, 0.0, 0.0, FREE_SPACE);
+  const auto endpoints = scanEndpoints(size);
+
+  for (auto _ : state) {
+    for (const auto & end : endpoints) {
+      costmap.raytraceLineFill(FREE_SPACE, size / 2, size / 2, end.first, end.second);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * endpoints.size() * (size / 2));
+}
+BENCHMARK(BM_RaytraceLineFill)->Arg(200)->Arg(1000)->Arg(4000);
+
+static void BM_UpdateWithMax(benchmark::State & state)
+{
+  const unsigned int size = state.range(0);
+  MaxCombineLayer layer;
+  layer.resizeMap(size, size, 0.05, 0.0, 0.0);
+  paintObstacles(layer.getCharMap(), size, 0.05);
+  Costmap2D master(size, size, 0.05, 0.0, 0.0, FREE_SPACE);
+
+  for (auto _ : state) {
+    layer.updateCosts(master, 0, 0, size, size);
+  }
+  state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(BM_UpdateWithMax)->Arg(200)->Arg(1000)->Arg(4000);
+
+static void BM_InflationLayer(benchmark::State & state)
+{
+  const unsigned int size = state.range(0);
+  const bool vectorized = state.range(1) != 0;
+
+  auto node = nav2_util::LifecycleNode::make_shared("costmap_benchmark");
+  tf2_ros::Buffer tf(node->get_clock());
+  LayeredCostmap layers("frame", false, false);
+  layers.resizeMap(size, size, 0.05, 0.0, 0.0);
+
+  std::shared_ptr<InflationLayer> ilayer;
+  addInflationLayer(layers, tf, node, ilayer);
+  node->set_parameter(rclcpp::Parameter("inflation.inflation_radius", 0.55));
+  node->set_parameter(rclcpp::Parameter("inflation.vectorized_inflation", vectorized));
+  layers.updateMap(0.0, 0.0, 0.0);
+
+  Costmap2D * master = layers.getCostmap();
+  std::vector<unsigned char> pristine(static_cast<size_t>(size) * size, FREE_SPACE);
+  paintObstacles(pristine.data(), size, 0.002);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::memcpy(master->getCharMap(), pristine.data(), pristine.size());
+    state.ResumeTiming();
+    ilayer->updateCosts(*master, 0, 0, size, size);
+  }
+  state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(BM_InflationLayer)
+->Args({200, 0})->Args({1000, 0})->Args({4000, 0})
+->Args({200, 1})->Args({1000, 1})->Args({4000, 1});
+
+static void BM_DenoiseLayer(benchmark::State & state)
+{
+  const unsigned int size = state.range(0);
+
+  auto node = nav2_util::LifecycleNode::make_shared("costmap_benchmark");
+  tf2_ros::Buffer tf(node->get_clock());
+  LayeredCostmap layers("frame", false, false);
+  layers.resizeMap(size, size, 0.05, 0.0, 0.0);
+
+  auto dlayer = std::make_shared<DenoiseLayer>();
+  dlayer->initialize(&layers, "denoise", &tf, node, nullptr);
+
+  Costmap2D * master = layers.getCostmap();
+  std::vector<unsigned char> pristine(static_cast<size_t>(size) * size, FREE_SPACE);
+  paintObstacles(pristine.data(), size, 0.01);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::memcpy(master->getCharMap(), pristine.data(), pristine.size());
+    state.ResumeTiming();
+    dlayer->updateCosts(*master, 0, 0, size, size);
+  }
+  state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(BM_DenoiseLayer)->Arg(200)->Arg(1000)->Arg(4000);
+
+BENCHMARK_MAIN();
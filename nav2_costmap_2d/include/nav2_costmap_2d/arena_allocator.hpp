@@ -0,0 +1,175 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_COSTMAP_2D__ARENA_ALLOCATOR_HPP_
+#define NAV2_COSTMAP_2D__ARENA_ALLOCATOR_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace nav2_costmap_2d
+{
+
+/**
+ * @class Arena
+ * @brief A monotonic memory arena for per-cycle scratch containers.
+ *
+ * Memory is handed out by bumping an offset into a list of blocks and is
+ * never returned individually; reset() reclaims everything in one step while
+ * keeping the blocks for the next cycle. After the first few update cycles
+ * the arena reaches its high-water mark and steady-state cycles perform no
+ * heap allocations. The arena is not thread safe; each consumer (e.g. a
+ * costmap layer, which already serializes its updates with a mutex) should
+ * own its own instance.
+ */
+class Arena
+{
+public:
+  explicit Arena(std::size_t initial_block_size = 4096)
+  : initial_block_size_(initial_block_size)
+  {
+  }
+
+  /**
+   * @brief Get a pointer to bytes of storage suitably aligned for alignment.
+   * Only fundamental alignments are supported, matching operator new.
+   */
+  void * allocate(std::size_t bytes, std::size_t alignment)
+  {
+    while (true) {
+      if (current_block_ < blocks_.size()) {
+        Block & block = blocks_[current_block_];
+        const std::size_t aligned = (offset_ + alignment - 1) & ~(alignment - 1);
+        if (aligned + bytes <= block.size) {
+          offset_ = aligned + bytes;
+          return block.data.get() + aligned;
+        }
+        // Not enough room left in this block, move on to the next one
+        ++current_block_;
+        offset_ = 0;
+        continue;
+      }
+      std::size_t block_size =
+        blocks_.empty() ? initial_block_size_ : blocks_.back().size * 2;
+      block_size = std::max(block_size, bytes + alignment);
+      blocks_.push_back({std::unique_ptr<char[]>(new char[block_size]), block_size});
+    }
+  }
+
+  /**
+   * @brief Reclaim all allocations at once, keeping the blocks for reuse.
+   * No pointer handed out before the reset may be used afterwards.
+   */
+  void reset()
+  {
+    current_block_ = 0;
+    offset_ = 0;
+  }
+
+  /// @brief Total bytes held by the arena's blocks (the high-water mark)
+  std::size_t capacity() const
+  {
+    std::size_t total = 0;
+    for (const Block & block : blocks_) {
+      total += block.size;
+    }
+    return total;
+  }
+
+private:
+  struct Block
+  {
+    std::unique_ptr<char[]> data;
+    std::size_t size;
+  };
+
+  std::vector<Block> blocks_;
+  std::size_t current_block_{0};
+  std::size_t offset_{0};
+  std::size_t initial_block_size_;
+};
+
+/**
+ * @class ArenaAllocator
+ * @brief A std::allocator-compatible adapter over Arena so standard
+ * containers can draw their storage from a per-cycle arena.
+ *
+ * deallocate() is a no-op; storage is reclaimed in bulk by Arena::reset().
+ * A default constructed allocator has no arena and falls back to the global
+ * heap, which keeps default constructed containers usable.
+ */
+template<typename T>
+class ArenaAllocator
+{
+public:
+  using value_type = T;
+
+  ArenaAllocator() noexcept
+  : arena_(nullptr)
+  {
+  }
+
+  explicit ArenaAllocator(Arena * arena) noexcept
+  : arena_(arena)
+  {
+  }
+
+  template<typename U>
+  ArenaAllocator(const ArenaAllocator<U> & other) noexcept  // NOLINT
+  : arena_(other.arena())
+  {
+  }
+
+  T * allocate(std::size_t n)
+  {
+    if (arena_) {
+      return static_cast<T *>(arena_->allocate(n * sizeof(T), alignof(T)));
+    }
+    return static_cast<T *>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T * p, std::size_t /*n*/) noexcept
+  {
+    if (!arena_) {
+      ::operator delete(p);
+    }
+  }
+
+  Arena * arena() const noexcept
+  {
+    return arena_;
+  }
+
+private:
+  Arena * arena_;
+};
+
+template<typename T, typename U>
+bool operator==(const ArenaAllocator<T> & lhs, const ArenaAllocator<U> & rhs) noexcept
+{
+  return lhs.arena() == rhs.arena();
+}
+
+template<typename T, typename U>
+bool operator!=(const ArenaAllocator<T> & lhs, const ArenaAllocator<U> & rhs) noexcept
+{
+  return !(lhs == rhs);
+}
+
+}  // namespace nav2_costmap_2d
+
+#endif  // NAV2_COSTMAP_2D__ARENA_ALLOCATOR_HPP_
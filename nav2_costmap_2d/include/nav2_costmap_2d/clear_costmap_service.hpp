@@ -73,6 +73,11 @@ private:
   // Clearing parameters
   unsigned char reset_value_;
 
+  // When positive, cleared obstacle layers immediately re-mark buffered
+  // observations younger than this age (seconds), so recoveries do not
+  // leave the costmap blind until the next sensor update
+  double clearing_observation_cutoff_{0.0};
+
   // Server for clearing the costmap
   rclcpp::Service<nav2_msgs::srv::ClearCostmapExceptRegion>::SharedPtr clear_except_service_;
   /**
@@ -0,0 +1,138 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_COSTMAP_2D__COST_COMBINATION_KERNELS_HPP_
+#define NAV2_COSTMAP_2D__COST_COMBINATION_KERNELS_HPP_
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "nav2_costmap_2d/cost_values.hpp"
+
+namespace nav2_costmap_2d
+{
+
+/**
+ * Row kernels for the CostmapLayer::updateWith*() combination methods.
+ *
+ * Each kernel expresses one per-cell combination rule as a pure select
+ * over the master and layer values, so the row loop carries no
+ * data-dependent branches and an SSE2 path can process 16 cells per
+ * iteration. The kernel is chosen at compile time via combineRow<>().
+ */
+namespace kernels
+{
+
+#if defined(__SSE2__)
+/// @brief Per-lane select: mask ? a : b (mask lanes must be 0x00 or 0xFF)
+inline __m128i select(__m128i mask, __m128i a, __m128i b)
+{
+  return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+#endif
+
+/// @brief CombinationMethod::Max: maximum of both values, unknown master
+/// cells are overwritten, unknown layer cells leave the master unchanged
+struct MaxKernel
+{
+  static unsigned char combine(unsigned char master, unsigned char layer)
+  {
+    if (layer == NO_INFORMATION) {
+      return master;
+    }
+    if (master == NO_INFORMATION) {
+      return layer;
+    }
+    return master > layer ? master : layer;
+  }
+
+#if defined(__SSE2__)
+  static __m128i combine(__m128i master, __m128i layer)
+  {
+    const __m128i unknown = _mm_set1_epi8(static_cast<char>(NO_INFORMATION));
+    const __m128i max = _mm_max_epu8(master, layer);
+    const __m128i result = select(_mm_cmpeq_epi8(master, unknown), layer, max);
+    return select(_mm_cmpeq_epi8(layer, unknown), master, result);
+  }
+#endif
+};
+
+/// @brief CombinationMethod::MaxWithoutUnknownOverwrite: as Max, but an
+/// unknown master cell stays unknown. Since NO_INFORMATION is the largest
+/// cost, max() already preserves an unknown master, so only unknown layer
+/// cells need masking out.
+struct MaxWithoutUnknownOverwriteKernel
+{
+  static unsigned char combine(unsigned char master, unsigned char layer)
+  {
+    if (layer == NO_INFORMATION) {
+      return master;
+    }
+    return master > layer ? master : layer;
+  }
+
+#if defined(__SSE2__)
+  static __m128i combine(__m128i master, __m128i layer)
+  {
+    const __m128i unknown = _mm_set1_epi8(static_cast<char>(NO_INFORMATION));
+    return select(_mm_cmpeq_epi8(layer, unknown), master, _mm_max_epu8(master, layer));
+  }
+#endif
+};
+
+/// @brief CombinationMethod::Overwrite: every known layer value replaces
+/// the master value, unknown layer cells leave the master unchanged
+struct OverwriteKernel
+{
+  static unsigned char combine(unsigned char master, unsigned char layer)
+  {
+    return layer == NO_INFORMATION ? master : layer;
+  }
+
+#if defined(__SSE2__)
+  static __m128i combine(__m128i master, __m128i layer)
+  {
+    const __m128i unknown = _mm_set1_epi8(static_cast<char>(NO_INFORMATION));
+    return select(_mm_cmpeq_epi8(layer, unknown), master, layer);
+  }
+#endif
+};
+
+/**
+ * @brief Combine one row of layer cells into the master grid
+ * @param master Pointer to the first master cell of the row window
+ * @param layer Pointer to the first layer cell of the row window
+ * @param length Number of cells in the row window
+ */
+template<typename Kernel>
+inline void combineRow(unsigned char * master, const unsigned char * layer, unsigned int length)
+{
+  unsigned int i = 0;
+#if defined(__SSE2__)
+  for (; i + 16 <= length; i += 16) {
+    const __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i *>(master + i));
+    const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i *>(layer + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(master + i), Kernel::combine(m, l));
+  }
+#endif
+  for (; i < length; ++i) {
+    master[i] = Kernel::combine(master[i], layer[i]);
+  }
+}
+
+}  // namespace kernels
+}  // namespace nav2_costmap_2d
+
+#endif  // NAV2_COSTMAP_2D__COST_COMBINATION_KERNELS_HPP_
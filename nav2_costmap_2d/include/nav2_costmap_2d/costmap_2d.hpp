@@ -46,6 +46,7 @@
 #include <string>
 #include <vector>
 #include <queue>
+#include <memory>
 #include <mutex>
 #include "geometry_msgs/msg/point.hpp"
 #include "nav_msgs/msg/occupancy_grid.hpp"
@@ -83,7 +84,9 @@ public:
     double origin_x, double origin_y, unsigned char default_value = 0);
 
   /**
-   * @brief  Copy constructor for a costmap, creates a copy efficiently
+   * @brief  Copy constructor for a costmap. The grid is shared
+   * copy-on-write: the copy costs O(1) and the cells are only duplicated
+   * once either side mutates them
    * @param map The costmap to copy
    */
   Costmap2D(const Costmap2D & map);
@@ -95,7 +98,8 @@ public:
   explicit Costmap2D(const nav_msgs::msg::OccupancyGrid & map);
 
   /**
-   * @brief  Overloaded assignment operator
+   * @brief  Overloaded assignment operator, sharing the grid
+   * copy-on-write like the copy constructor
    * @param  map The costmap to copy
    * @return A reference to the map after the copy has finished
    */
@@ -237,11 +241,109 @@ public:
   }
 
   /**
-   * @brief  Will return a pointer to the underlying unsigned char array used as the costmap
+   * @brief  Will return a pointer to the underlying unsigned char array used as the costmap.
+   * The array is writable, so a grid shared copy-on-write with a copy of
+   * this costmap is detached first; use getRegionView() or getCost() for
+   * read-only access that leaves the sharing intact.
    * @return A pointer to the underlying unsigned char array storing cost values
    */
   unsigned char * getCharMap() const;
 
+  /**
+   * @class RegionView
+   * @brief A bounds-checked window onto the underlying cost grid
+   *
+   * The window bounds are validated once when the view is created by
+   * getRegionView(); cell access within it then inlines to pointer
+   * arithmetic on the raw array instead of paying the function call and
+   * index math of getCost() per cell.  The view borrows the grid
+   * storage, so it must not outlive the costmap or a resizeMap() on it,
+   * and the costmap mutex should be held while it is in use.
+   */
+  class RegionView
+  {
+  public:
+    /**
+     * @brief  Default constructor, makes an empty view containing no cells
+     */
+    RegionView()
+    : data_(nullptr), stride_(0), x0_(0), y0_(0), x1_(0), y1_(0)
+    {}
+
+    /// @brief  Lower x bound of the view in cells, inclusive
+    unsigned int x0() const {return x0_;}
+    /// @brief  Lower y bound of the view in cells, inclusive
+    unsigned int y0() const {return y0_;}
+    /// @brief  Upper x bound of the view in cells, exclusive
+    unsigned int x1() const {return x1_;}
+    /// @brief  Upper y bound of the view in cells, exclusive
+    unsigned int y1() const {return y1_;}
+    /// @brief  Offset between vertically adjacent cells, in cells
+    unsigned int stride() const {return stride_;}
+
+    /**
+     * @brief  Check whether absolute map coordinates lie within the view
+     * @param mx The x coordinate of the cell
+     * @param my The y coordinate of the cell
+     * @return True if (mx, my) may be passed to operator() and row()
+     */
+    inline bool contains(unsigned int mx, unsigned int my) const
+    {
+      return mx >= x0_ && mx < x1_ && my >= y0_ && my < y1_;
+    }
+
+    /**
+     * @brief  Get the cost of a cell, which must lie within the view
+     * @param mx The absolute x coordinate of the cell
+     * @param my The absolute y coordinate of the cell
+     * @return The cost of the cell
+     */
+    inline unsigned char operator()(unsigned int mx, unsigned int my) const
+    {
+      return data_[static_cast<size_t>(my) * stride_ + mx];
+    }
+
+    /**
+     * @brief  Get a raw pointer to the first cell (x0, my) of a row.
+     * Consecutive x cells are adjacent; rows are stride() cells apart.
+     * @param my The absolute y coordinate of the row, in [y0, y1)
+     * @return Pointer valid for the x1() - x0() cells of the row
+     */
+    inline const unsigned char * row(unsigned int my) const
+    {
+      return data_ + static_cast<size_t>(my) * stride_ + x0_;
+    }
+
+  private:
+    friend class Costmap2D;
+    RegionView(
+      const unsigned char * data, unsigned int stride,
+      unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1)
+    : data_(data), stride_(stride), x0_(x0), y0_(y0), x1_(x1), y1_(y1)
+    {}
+
+    const unsigned char * data_;
+    unsigned int stride_;
+    unsigned int x0_, y0_, x1_, y1_;
+  };
+
+  /**
+   * @brief  Get a view over a window of the costmap, clamped to the map bounds
+   * @param x0 Lower x bound of the window in cells, inclusive
+   * @param y0 Lower y bound of the window in cells, inclusive
+   * @param x1 Upper x bound of the window in cells, exclusive
+   * @param y1 Upper y bound of the window in cells, exclusive
+   * @return The view over the clamped window
+   */
+  RegionView getRegionView(
+    unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1) const;
+
+  /**
+   * @brief  Get a view over the full costmap
+   * @return The view over every cell of the map
+   */
+  RegionView getRegionView() const;
+
   /**
    * @brief  Accessor for the x size of the costmap in cells
    * @return The x size of the costmap
@@ -426,6 +528,15 @@ protected:
    */
   virtual void initMaps(unsigned int size_x, unsigned int size_y);
 
+  /**
+   * @brief  Give this costmap private ownership of its grid ahead of a
+   * mutation, duplicating the cells if they are currently shared
+   * copy-on-write with another costmap. No-op for an unshared grid.
+   * External synchronization on this costmap is the caller's, as for
+   * any mutation; the sharing bookkeeping itself is thread-safe
+   */
+  void detachBuffer() const;
+
   /**
    * @brief  Raytrace a line and apply some action at each step
    * @param  at The action to take... a functor
@@ -492,6 +603,67 @@ protected:
       at, abs_dy, abs_dx, error_x, offset_dy, offset_dx, offset, (unsigned int)(scale * abs_dy));
   }
 
+  /**
+   * @brief  Raytrace a line writing a fixed cost value, visiting exactly the
+   * same cells as raytraceLine() with a MarkCell action but filling entire
+   * Bresenham runs at once (memset for row-contiguous spans) instead of
+   * dispatching a functor per cell
+   * @param  value The cost value to write along the line
+   * @param  x0 The starting x coordinate
+   * @param  y0 The starting y coordinate
+   * @param  x1 The ending x coordinate
+   * @param  y1 The ending y coordinate
+   * @param  max_length The maximum desired length of the segment...
+   * allows you to not go all the way to the endpoint
+   * @param  min_length The minimum desired length of the segment
+   */
+  inline void raytraceLineFill(
+    unsigned char value, unsigned int x0, unsigned int y0, unsigned int x1,
+    unsigned int y1,
+    unsigned int max_length = UINT_MAX, unsigned int min_length = 0)
+  {
+    int dx_full = x1 - x0;
+    int dy_full = y1 - y0;
+
+    double dist = std::hypot(dx_full, dy_full);
+    if (dist < min_length) {
+      return;
+    }
+
+    unsigned int min_x0, min_y0;
+    if (dist > 0.0) {
+      min_x0 = (unsigned int)(x0 + dx_full / dist * min_length);
+      min_y0 = (unsigned int)(y0 + dy_full / dist * min_length);
+    } else {
+      min_x0 = x0;
+      min_y0 = y0;
+    }
+    unsigned int offset = min_y0 * size_x_ + min_x0;
+
+    int dx = x1 - min_x0;
+    int dy = y1 - min_y0;
+
+    unsigned int abs_dx = abs(dx);
+    unsigned int abs_dy = abs(dy);
+
+    int offset_dx = sign(dx);
+    int offset_dy = sign(dy) * size_x_;
+
+    double scale = (dist == 0.0) ? 1.0 : std::min(1.0, max_length / dist);
+    if (abs_dx >= abs_dy) {
+      int error_y = abs_dx / 2;
+      bresenham2DFill(
+        value, abs_dx, abs_dy, error_y, offset_dx, offset_dy, offset,
+        (unsigned int)(scale * abs_dx));
+      return;
+    }
+
+    int error_x = abs_dy / 2;
+    bresenham2DFill(
+      value, abs_dy, abs_dx, error_x, offset_dy, offset_dx, offset,
+      (unsigned int)(scale * abs_dy));
+  }
+
 private:
   /**
    * @brief  A 2D implementation of Bresenham's raytracing algorithm...
@@ -517,6 +689,46 @@ private:
     at(offset);
   }
 
+  /**
+   * @brief  Bresenham stepping that writes a fixed value per run of cells
+   * along the dominant axis instead of acting on each cell individually.
+   * Row-contiguous runs (offset_a of +/-1) are written with memset.
+   */
+  inline void bresenham2DFill(
+    unsigned char value, unsigned int abs_da, unsigned int abs_db, int error_b,
+    int offset_a,
+    int offset_b, unsigned int offset,
+    unsigned int max_length)
+  {
+    unsigned int end = std::min(max_length, abs_da);
+    unsigned int i = 0;
+    while (i <= end) {
+      // number of cells until the next sub-axis step (or the end of the line)
+      unsigned int run = end - i + 1;
+      if (abs_db > 0) {
+        run = std::min(run, (abs_da - (unsigned int)error_b + abs_db - 1) / abs_db);
+      }
+      if (offset_a == 1) {
+        memset(costmap_ + offset, value, run);
+      } else if (offset_a == -1) {
+        memset(costmap_ + offset - run + 1, value, run);
+      } else {
+        // column-major runs are strided by a full row, step them in place
+        unsigned int strided = offset;
+        for (unsigned int k = 0; k < run; ++k, strided += offset_a) {
+          costmap_[strided] = value;
+        }
+      }
+      i += run;
+      offset += offset_a * run;
+      error_b += run * abs_db;
+      if ((unsigned int)error_b >= abs_da) {
+        offset += offset_b;
+        error_b -= abs_da;
+      }
+    }
+  }
+
   /**
    * @brief get the sign of an int
    */
@@ -533,7 +745,13 @@ protected:
   double resolution_;
   double origin_x_;
   double origin_y_;
-  unsigned char * costmap_;
+  // The grid cells, shared copy-on-write between costmap copies;
+  // costmap_ is the raw view of costmap_buffer_ for hot-path access.
+  // Mutable so that read paths handing out writable pointers can detach.
+  // Direct writes through costmap_ assume the buffer is not shared and
+  // must be preceded by detachBuffer() or one of the public mutators
+  mutable std::shared_ptr<unsigned char[]> costmap_buffer_;
+  mutable unsigned char * costmap_;
   unsigned char default_value_;
 
   // *INDENT-OFF* Uncrustify doesn't handle indented public/private labels
@@ -52,7 +52,9 @@
 #include "nav2_costmap_2d/layered_costmap.hpp"
 #include "nav2_costmap_2d/layer.hpp"
 #include "nav2_util/lifecycle_node.hpp"
+#include "nav2_msgs/msg/costmap_timing.hpp"
 #include "nav2_msgs/srv/get_cost.hpp"
+#include "nav2_msgs/srv/get_costmap_timing.hpp"
 #include "pluginlib/class_loader.hpp"
 #include "tf2/convert.h"
 #include "tf2/LinearMath/Transform.h"
@@ -186,6 +188,18 @@ public:
    */
   void updateMap();
 
+  /**
+   * @brief Run one synchronous update restricted to the given world-coordinate
+   * window while the first full-map update is still outstanding.
+   *
+   * With lazy_activation enabled, on_activate() returns before the first
+   * update cycle has inflated the full map. A planner or controller that
+   * can't wait for that background pass can call this with the region it is
+   * about to touch; the rest of the dirty map is carried over and completed
+   * by the map update thread. A no-op once the first full update has run.
+   */
+  void updateMapRegion(double min_x, double min_y, double max_x, double max_y);
+
   /**
    * @brief Reset each individual layer
    */
@@ -204,6 +218,19 @@ public:
    */
   bool getRobotPose(geometry_msgs::msg::PoseStamped & global_pose);
 
+  /**
+   * @brief Get the robot pose that was resolved at the start of the current
+   * update cycle, without a new TF traversal
+   *
+   * The cached pose is refreshed once per map update, so it can be up to one
+   * update period old. Consumers that only need a map-rate pose (e.g. anything
+   * reasoning about the costmap contents, which are no fresher) can use this
+   * instead of getRobotPose() to avoid paying a TF lookup per call.
+   * @param global_pose Will be set to the cached pose of the robot
+   * @return True if a pose has been cached since updates (re)started
+   */
+  bool getCachedRobotPose(geometry_msgs::msg::PoseStamped & global_pose);
+
   /**
    * @brief Transform the input_pose in the global frame of the costmap
    * @param input_pose pose to be transformed
@@ -236,6 +263,19 @@ public:
     return layered_costmap_->getCostmap();
   }
 
+  /**
+   * @brief Get an immutable snapshot of the costmap as of the last completed
+   * update cycle, without taking the costmap lock.
+   *
+   * Unlike getCostmap(), the returned costmap is never mutated by the update
+   * thread, so planners and controllers can read it for as long as they hold
+   * the pointer without blocking (or being blocked by) layer updates. The
+   * snapshot is refreshed from a double buffer after every map update.
+   * @return The latest snapshot, or nullptr if no update cycle has completed
+   * since snapshots were first requested
+   */
+  std::shared_ptr<const Costmap2D> getCostmapSnapshot();
+
   /**
    * @brief  Returns the global frame of the costmap
    * @return The global frame of the costmap
@@ -350,10 +390,19 @@ public:
     const std::shared_ptr<nav2_msgs::srv::GetCost::Request> request,
     const std::shared_ptr<nav2_msgs::srv::GetCost::Response> response);
 
+  /** @brief Get the per-layer update timing statistics
+   * @param response the collected timing statistics
+  */
+  void getTimingCallback(
+    const std::shared_ptr<rmw_request_id_t>,
+    const std::shared_ptr<nav2_msgs::srv::GetCostmapTiming::Request> request,
+    const std::shared_ptr<nav2_msgs::srv::GetCostmapTiming::Response> response);
+
 protected:
   // Publishers and subscribers
   rclcpp_lifecycle::LifecyclePublisher<geometry_msgs::msg::PolygonStamped>::SharedPtr
     footprint_pub_;
+  rclcpp_lifecycle::LifecyclePublisher<nav2_msgs::msg::CostmapTiming>::SharedPtr timing_pub_;
   std::unique_ptr<Costmap2DPublisher> costmap_publisher_;
 
   std::vector<std::unique_ptr<Costmap2DPublisher>> layer_publishers_;
@@ -374,6 +423,26 @@ protected:
   std::string name_;
   std::string parent_namespace_;
 
+  /**
+   * @brief Refresh the lock-free costmap snapshot from the master costmap,
+   * called at the end of every map update cycle
+   */
+  void updateCostmapSnapshot();
+
+  // Lock-free snapshot state: the published snapshot is swapped atomically,
+  // the two buffers are reused alternately unless a reader still holds one.
+  // Snapshots are only produced once a consumer has asked for them.
+  std::shared_ptr<const Costmap2D> costmap_snapshot_;
+  std::shared_ptr<Costmap2D> snapshot_buffers_[2];
+  size_t snapshot_buffer_index_{0};
+  std::atomic<bool> snapshots_requested_{false};
+
+  // Robot pose resolved once at the start of each update cycle and reused by
+  // in-process consumers, so only one TF traversal is paid per cycle
+  std::mutex robot_pose_mutex_;
+  geometry_msgs::msg::PoseStamped cached_robot_pose_;
+  bool robot_pose_cached_{false};
+
   /**
    * @brief Function on timer for costmap update
    */
@@ -402,6 +471,8 @@ protected:
   int map_width_meters_{0};
   double origin_x_{0};
   double origin_y_{0};
+  int parallel_update_threads_{0};  ///< Worker threads for the layer bounds phase, 0 = sequential
+  bool timing_diagnostics_{false};  ///< Collect and expose per-layer update timing
   std::vector<std::string> default_plugins_;
   std::vector<std::string> default_types_;
   std::vector<std::string> plugin_names_;
@@ -413,6 +484,9 @@ protected:
   double robot_radius_;
   bool rolling_window_{false};          ///< Whether to use a rolling window version of the costmap
   bool track_unknown_space_{false};
+  /// Don't block activation on the first full-map update; it finishes on the
+  /// map update thread while regions can be pulled forward on demand
+  bool lazy_activation_{false};
   double transform_tolerance_{0};           ///< The timeout before transform errors
   double initial_transform_timeout_{0};   ///< The timeout before activation of the node errors
 
@@ -425,6 +499,7 @@ protected:
 
   // Services
   rclcpp::Service<nav2_msgs::srv::GetCost>::SharedPtr get_cost_service_;
+  rclcpp::Service<nav2_msgs::srv::GetCostmapTiming>::SharedPtr get_timing_service_;
   std::unique_ptr<ClearCostmapService> clear_costmap_service_;
 
   // Dynamic parameters handler
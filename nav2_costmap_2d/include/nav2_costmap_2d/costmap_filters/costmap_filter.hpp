@@ -48,6 +48,7 @@
 #include "geometry_msgs/msg/pose2_d.hpp"
 #include "std_srvs/srv/set_bool.hpp"
 #include "nav2_costmap_2d/layer.hpp"
+#include "nav2_util/occ_grid_shm.hpp"
 #include "nav_msgs/msg/occupancy_grid.hpp"
 
 namespace nav2_costmap_2d
@@ -209,7 +210,11 @@ protected:
     nav_msgs::msg::OccupancyGrid::ConstSharedPtr filter_mask,
     const unsigned int mx, const unsigned int my) const
   {
-    return filter_mask->data[my * filter_mask->info.width + mx];
+    const unsigned int index = my * filter_mask->info.width + mx;
+    if (shared_mask_) {
+      return shared_mask_->data()[index];
+    }
+    return filter_mask->data[index];
   }
 
   /**
@@ -223,6 +228,32 @@ protected:
     nav_msgs::msg::OccupancyGrid::ConstSharedPtr filter_mask,
     const unsigned int mx, const unsigned int & my) const;
 
+  /**
+   * @brief  Map a filter mask served through a POSIX shared-memory segment.
+   * On success the mapping is retained in shared_mask_ and mask data
+   * accessors read from it; on failure an error is logged so the caller
+   * can fall back to subscribing to the filter mask topic.
+   * @param  segment_name Name of the segment from the CostmapFilterInfo
+   * @return Metadata of the mapped mask (its data field is left empty),
+   * nullptr on failure
+   */
+  nav_msgs::msg::OccupancyGrid::SharedPtr mapSharedMask(const std::string & segment_name);
+
+  /**
+   * @brief  Get the cell data of the shared filter mask
+   * @return Cell data of the mapped segment, nullptr when the mask was
+   * received over the filter mask topic
+   */
+  const int8_t * sharedMaskData() const
+  {
+    return shared_mask_ ? shared_mask_->data() : nullptr;
+  }
+
+  /**
+   * @brief  Drop the shared filter mask mapping, if any
+   */
+  void releaseSharedMask() {shared_mask_.reset();}
+
   /**
    * @brief: Name of costmap filter info topic
    */
@@ -249,6 +280,11 @@ private:
    */
   geometry_msgs::msg::Pose2D latest_pose_;
 
+  /**
+   * @brief: Read-only mapping of the filter mask shared-memory segment
+   */
+  std::shared_ptr<nav2_util::SharedOccupancyGrid> shared_mask_;
+
   /**
    * @brief: Mutex for locking filter's resources
    */
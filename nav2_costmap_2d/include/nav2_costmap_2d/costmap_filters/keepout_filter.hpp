@@ -40,6 +40,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "nav2_costmap_2d/costmap_filters/costmap_filter.hpp"
 
@@ -96,10 +97,23 @@ private:
    */
   void maskCallback(const nav_msgs::msg::OccupancyGrid::SharedPtr msg);
 
+  /**
+   * @brief Converts the received mask into a flat array of costmap costs,
+   * so that process() reads costs directly instead of re-converting
+   * every cell on every cycle
+   */
+  void precompileMask();
+
   rclcpp::Subscription<nav2_msgs::msg::CostmapFilterInfo>::SharedPtr filter_info_sub_;
   rclcpp::Subscription<nav_msgs::msg::OccupancyGrid>::SharedPtr mask_sub_;
 
   nav_msgs::msg::OccupancyGrid::SharedPtr filter_mask_;
+  // Flat per-cell costmap costs of filter_mask_, precompiled in maskCallback().
+  // Left empty for a shared-memory mask, whose cells stay in the shared
+  // segment and are translated through cost_lut_ on access instead
+  std::vector<unsigned char> mask_costs_;
+  // Costmap costs for every possible OccupancyGrid value, matching getMaskCost()
+  unsigned char cost_lut_[256];
 
   std::string global_frame_;  // Frame of currnet layer (master_grid)
 };
@@ -108,6 +108,14 @@ private:
   double base_, multiplier_;
   bool percentage_;
   double speed_limit_, speed_limit_prev_;
+
+  // Last full evaluation, reused while the robot stays within a radius of
+  // it known to sample the same speed limit. Skips the pose transform and
+  // mask lookup on every cycle a stationary or slow robot does not need
+  // them, which is the common case at standstill.
+  bool cache_valid_;
+  double cached_pose_x_, cached_pose_y_;  // in the layer's global frame
+  double cache_slack_;  // movement radius within which the limit cannot change
 };
 
 }  // namespace nav2_costmap_2d
@@ -15,6 +15,9 @@
 #ifndef NAV2_COSTMAP_2D__COSTMAP_SUBSCRIBER_HPP_
 #define NAV2_COSTMAP_2D__COSTMAP_SUBSCRIBER_HPP_
 
+#include <atomic>
+#include <deque>
+#include <mutex>
 #include <string>
 #include <memory>
 
@@ -26,6 +29,25 @@
 
 namespace nav2_costmap_2d
 {
+
+/**
+ * @struct UpdatedRegion
+ * @brief Rectangle of costmap cells changed by received messages, stamped
+ * with the update epoch at which it was taken
+ *
+ * x0/y0 are inclusive and xn/yn exclusive cell bounds. When full is set the
+ * bounds are meaningless and the whole grid must be treated as changed.
+ */
+struct UpdatedRegion
+{
+  unsigned int epoch{0};
+  bool full{true};
+  unsigned int x0{0};
+  unsigned int y0{0};
+  unsigned int xn{0};
+  unsigned int yn{0};
+};
+
 /**
  * @class CostmapSubscriber
  * @brief Subscribes to the costmap via a ros topic
@@ -56,6 +78,25 @@ public:
    * @brief Get current costmap
    */
   std::shared_ptr<Costmap2D> getCostmap();
+  /**
+   * @brief Get the number of costmap and costmap update messages received,
+   * letting users detect whether new costmap data has arrived since a
+   * previous query without fetching the costmap itself
+   */
+  unsigned int getUpdateCount() const {return update_count_;}
+  /**
+   * @brief Get the union of the cell rectangles changed since a previous epoch
+   *
+   * Pass the epoch of the returned region back on the next call to only see
+   * what changed in between, so downstream caches can invalidate only the
+   * affected cells. A region with full set means the whole grid must be
+   * treated as changed (initial reception, map resize, or the bounded history
+   * of update windows no longer reaches back to since_epoch); otherwise the
+   * bounds cover every cell written since since_epoch and are empty
+   * (x0 == xn) when nothing changed.
+   * @param since_epoch Epoch returned by a previous call, or 0 for everything
+   */
+  UpdatedRegion getUpdatedRegion(unsigned int since_epoch);
   /**
    * @brief Callback for the costmap topic
    */
@@ -68,6 +109,7 @@ public:
 protected:
   bool isCostmapReceived() {return costmap_ != nullptr;}
   void processCurrentCostmapMsg();
+  void recordUpdatedRegion(const UpdatedRegion & region);
 
   bool haveCostmapParametersChanged();
   bool hasCostmapSizeChanged();
@@ -79,6 +121,13 @@ protected:
 
   std::shared_ptr<Costmap2D> costmap_;
   nav2_msgs::msg::Costmap::SharedPtr costmap_msg_;
+  std::atomic<unsigned int> update_count_{0};
+
+  // Bounded history of changed regions, one entry per message that touched
+  // the grid; the floor is the epoch of the newest discarded entry
+  std::deque<UpdatedRegion> updated_regions_;
+  unsigned int updated_region_floor_{0};
+  std::mutex updated_regions_mutex_;
 
   std::string topic_name_;
   std::mutex costmap_msg_mutex_;
@@ -75,6 +75,27 @@ public:
     const geometry_msgs::msg::Pose2D & pose,
     bool fetch_costmap_and_footprint = true);
 
+  /**
+   * @brief Returns the obstacle footprint score for a batch of poses with a
+   * single costmap and footprint fetch
+   *
+   * The footprint outline is precomputed into per-heading cell offset tables
+   * (rebuilt only when the footprint or map resolution changes), so each pose
+   * costs one offset-table sweep instead of a polygon rasterization. Poses
+   * off the grid score LETHAL_OBSTACLE.
+   * @param poses Poses to score, in the costmap's global frame
+   * @return the score of each pose, in the same order
+   * @throw CollisionCheckerException when the costmap or footprint are unavailable
+   */
+  std::vector<double> scorePoses(const std::vector<geometry_msgs::msg::Pose2D> & poses);
+
+  /**
+   * @brief Get the update count of the underlying costmap subscription,
+   * incremented every time new costmap data arrives. Lets users cache
+   * collision checking results until the costmap changes.
+   */
+  unsigned int getCostmapUpdateCount() const {return costmap_sub_.getUpdateCount();}
+
 protected:
   /**
    * @brief Get a footprint at a set pose
@@ -94,6 +115,9 @@ protected:
   FootprintCollisionChecker<std::shared_ptr<Costmap2D>> collision_checker_;
   rclcpp::Clock::SharedPtr clock_;
   Footprint footprint_;
+  // Footprint and resolution the offset kernel was last precomputed for
+  Footprint kernel_footprint_;
+  double kernel_resolution_{0.0};
 };
 
 }  // namespace nav2_costmap_2d
@@ -1057,6 +1057,112 @@ Image<Label> connectedComponents(
   return labels;
 }
 
+/**
+ * @brief Replace pixels of connected groups smaller than minimal_group_size with 0
+ *
+ * Semantically equivalent to labeling the image with connectedComponents and
+ * erasing the small groups, but works on run-length segments of each row:
+ * runs touching between adjacent rows are merged with a union-find, so the
+ * cost is proportional to the number of runs rather than the number of pixels
+ * and no labels image needs to be materialized.
+ * @tparam IsBg functor with signature bool (uint8_t)
+ * @param[in,out] image image to be denoised
+ * @param connectivity pixels connectivity type
+ * @param minimal_group_size the border value of group size. Groups of this and larger
+ * size will be kept
+ * @param is_background returns true if the passed pixel value is background
+ */
+template<class IsBg>
+void removeGroupsRunBased(
+  Image<uint8_t> & image, ConnectivityType connectivity,
+  size_t minimal_group_size, const IsBg & is_background)
+{
+  if (image.empty() || minimal_group_size <= 1) {
+    return;
+  }
+
+  struct Run
+  {
+    uint32_t begin;   // column of the first pixel of the run
+    uint32_t end;     // column after the last pixel of the run
+    uint32_t parent;  // index of the parent run in the union-find forest
+  };
+  std::vector<Run> runs;
+  // Index of the first run of each row in runs (plus a trailing sentinel)
+  std::vector<uint32_t> row_start(image.rows() + 1, 0);
+
+  // Extract the maximal horizontal segments of non-background pixels
+  for (size_t j = 0; j < image.rows(); ++j) {
+    const uint8_t * row = image.row(j);
+    const size_t columns = image.columns();
+    size_t i = 0;
+    while (i < columns) {
+      if (is_background(row[i])) {
+        ++i;
+        continue;
+      }
+      const size_t begin = i;
+      while (i < columns && !is_background(row[i])) {
+        ++i;
+      }
+      runs.push_back(
+        {static_cast<uint32_t>(begin), static_cast<uint32_t>(i),
+          static_cast<uint32_t>(runs.size())});
+    }
+    row_start[j + 1] = static_cast<uint32_t>(runs.size());
+  }
+
+  auto find = [&runs](uint32_t x) {
+      while (runs[x].parent != x) {
+        runs[x].parent = runs[runs[x].parent].parent;  // path halving
+        x = runs[x].parent;
+      }
+      return x;
+    };
+
+  // Link runs that touch between adjacent rows. For 8-way connectivity a
+  // diagonal contact also counts, which is equivalent to widening one of the
+  // runs by a single column on both sides before testing for overlap
+  const uint32_t reach = connectivity == ConnectivityType::Way8 ? 1 : 0;
+  for (size_t j = 1; j < image.rows(); ++j) {
+    uint32_t up = row_start[j - 1];
+    const uint32_t up_end = row_start[j];
+    uint32_t cur = row_start[j];
+    const uint32_t cur_end = row_start[j + 1];
+    while (up != up_end && cur != cur_end) {
+      if (runs[up].begin < runs[cur].end + reach && runs[cur].begin < runs[up].end + reach) {
+        const uint32_t a = find(up);
+        const uint32_t b = find(cur);
+        if (a != b) {
+          runs[b].parent = a;
+        }
+      }
+      // Advance the run that ends first; it cannot touch anything further
+      if (runs[up].end < runs[cur].end) {
+        ++up;
+      } else {
+        ++cur;
+      }
+    }
+  }
+
+  // Total the pixels of each group at its root
+  std::vector<size_t> group_size(runs.size(), 0);
+  for (uint32_t r = 0; r < runs.size(); ++r) {
+    group_size[find(r)] += runs[r].end - runs[r].begin;
+  }
+
+  // Erase the runs belonging to the small groups
+  for (size_t j = 0; j < image.rows(); ++j) {
+    uint8_t * row = image.row(j);
+    for (uint32_t r = row_start[j]; r != row_start[j + 1]; ++r) {
+      if (group_size[find(r)] < minimal_group_size) {
+        std::fill(row + runs[r].begin, row + runs[r].end, uint8_t(0));
+      }
+    }
+  }
+}
+
 }  // namespace nav2_costmap_2d
 
 #endif  // NAV2_COSTMAP_2D__DENOISE__IMAGE_PROCESSING_HPP_
@@ -120,8 +120,6 @@ private:
   ConnectivityType group_connectivity_type_{ConnectivityType::Way8};
   // Memory buffer for temporal image
   mutable MemoryBuffer buffer_;
-  // Implementing the removal of grouped noise
-  imgproc_impl::GroupsRemover groups_remover_;
   // Interpret NO_INFORMATION code as obstacle
   bool no_information_is_obstacle_{};
 };
@@ -47,6 +47,7 @@
 #include "geometry_msgs/msg/polygon_stamped.hpp"
 #include "geometry_msgs/msg/point.hpp"
 #include "geometry_msgs/msg/point32.hpp"
+#include "geometry_msgs/msg/pose2_d.hpp"
 #include "nav2_util/lifecycle_node.hpp"
 
 namespace nav2_costmap_2d
@@ -96,6 +97,37 @@ void transformFootprint(
   const std::vector<geometry_msgs::msg::Point> & footprint_spec,
   std::vector<geometry_msgs::msg::Point> & oriented_footprint);
 
+/**
+ * @brief  Variant taking a precomputed rotation, for callers that already
+ * have the cos/sin of the heading or reuse one heading across several calls
+ * @param  x The x position of the robot
+ * @param  y The y position of the robot
+ * @param  cos_th Cosine of the robot orientation
+ * @param  sin_th Sine of the robot orientation
+ * @param  footprint_spec Basic shape of the footprint
+ * @param  oriented_footprint Will be filled with the points in the oriented footprint of the robot
+*/
+void transformFootprint(
+  double x, double y, double cos_th, double sin_th,
+  const std::vector<geometry_msgs::msg::Point> & footprint_spec,
+  std::vector<geometry_msgs::msg::Point> & oriented_footprint);
+
+/**
+ * @brief  Build the oriented footprint at every pose of a sequence, such as a
+ * sampled trajectory, with one trig evaluation per pose
+ *
+ * The outer vector and its per-pose buffers are resized rather than rebuilt,
+ * so a caller that keeps the output vector across calls pays no allocations
+ * once it has grown to the trajectory size.
+ * @param  poses The poses to orient the footprint at
+ * @param  footprint_spec Basic shape of the footprint
+ * @param  oriented_footprints Will be filled with one oriented footprint per pose
+*/
+void transformFootprints(
+  const std::vector<geometry_msgs::msg::Pose2D> & poses,
+  const std::vector<geometry_msgs::msg::Point> & footprint_spec,
+  std::vector<std::vector<geometry_msgs::msg::Point>> & oriented_footprints);
+
 /**
  * @brief  Given a pose and base footprint, build the oriented footprint of the robot (PolygonStamped)
  * @param  x The x position of the robot
@@ -21,6 +21,7 @@
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <utility>
 
 #include "rclcpp/rclcpp.hpp"
 #include "geometry_msgs/msg/pose_stamped.hpp"
@@ -56,6 +57,27 @@ public:
    * @brief Find the footprint cost a a post with an unoriented footprint
    */
   double footprintCostAtPose(double x, double y, double theta, const Footprint & footprint);
+  /**
+   * @brief Precompute the footprint outline's cell offsets for a number of
+   * discretized headings, so footprintCostAtPoseCached() queries become
+   * offset table lookups instead of polygon rasterizations. Must be called
+   * again if the footprint or the costmap resolution changes.
+   * @param footprint unoriented footprint, in the robot frame
+   * @param num_headings number of discretized headings (e.g. 72 for 5 deg)
+   */
+  void precomputeFootprintOffsets(const Footprint & footprint, unsigned int num_headings);
+  /**
+   * @brief Find the footprint cost at a pose using the offsets precomputed
+   * for the nearest discretized heading. precomputeFootprintOffsets() must
+   * have been called beforehand. The footprint is placed on the cell
+   * containing (x, y), so poses within one cell share the same answer.
+   */
+  double footprintCostAtPoseCached(double x, double y, double theta);
+  /**
+   * @brief Batched footprintCostAtPoseCached over a set of poses
+   * @return the cost of each pose, in the same order
+   */
+  std::vector<double> footprintCostBatch(const std::vector<geometry_msgs::msg::Pose2D> & poses);
   /**
    * @brief Get the cost for a line segment
    */
@@ -82,6 +104,9 @@ public:
 
 protected:
   CostmapT costmap_;
+  /// @brief Swept outline cells relative to the robot cell, one set per
+  /// discretized heading (empty until precomputeFootprintOffsets is called)
+  std::vector<std::vector<std::pair<int, int>>> footprint_offsets_;
 };
 
 }  // namespace nav2_costmap_2d
@@ -38,13 +38,16 @@
 #ifndef NAV2_COSTMAP_2D__INFLATION_LAYER_HPP_
 #define NAV2_COSTMAP_2D__INFLATION_LAYER_HPP_
 
+#include <condition_variable>
 #include <map>
 #include <vector>
 #include <mutex>
 #include <memory>
 #include <string>
+#include <thread>
 
 #include "rclcpp/rclcpp.hpp"
+#include "nav2_costmap_2d/arena_allocator.hpp"
 #include "nav2_costmap_2d/layer.hpp"
 #include "nav2_costmap_2d/layered_costmap.hpp"
 #include "nav2_costmap_2d/costmap_2d_ros.hpp"
@@ -74,6 +77,52 @@ public:
   unsigned int src_x_, src_y_;
 };
 
+/**
+ * @struct InflationTables
+ * @brief Immutable distance/cost lookup tables used during inflation.
+ * Layers with identical resolution, radii and scaling factor share one
+ * instance process-wide, so running several costmaps in one process does
+ * not duplicate the tables or the work of computing them.
+ */
+struct InflationTables
+{
+  /// @brief Quarter-plane distances, indexed by dx * (r + 2) + dy
+  std::vector<double> distances;
+  /// @brief Quarter-plane costs with the same layout as distances
+  std::vector<unsigned char> costs;
+  /// @brief Dense (2r+1)x(2r+1) cost kernel for the vectorized path,
+  /// zero outside of the inflation radius
+  std::vector<unsigned char> kernel;
+};
+
+/**
+ * @struct InflationTableParams
+ * @brief The parameters a set of lookup tables is built from, captured as a
+ * value when a rebuild is requested so the worker thread never has to read
+ * layer members
+ */
+struct InflationTableParams
+{
+  double resolution{0.0};
+  double inflation_radius{0.0};
+  double cost_scaling_factor{0.0};
+  double inscribed_radius{0.0};
+  unsigned int cell_inflation_radius{0};
+  unsigned int cache_length{0};
+  unsigned int kernel_size{0};
+
+  friend bool operator==(const InflationTableParams & a, const InflationTableParams & b)
+  {
+    return a.resolution == b.resolution &&
+           a.inflation_radius == b.inflation_radius &&
+           a.cost_scaling_factor == b.cost_scaling_factor &&
+           a.inscribed_radius == b.inscribed_radius &&
+           a.cell_inflation_radius == b.cell_inflation_radius &&
+           a.cache_length == b.cache_length &&
+           a.kernel_size == b.kernel_size;
+  }
+};
+
 /**
  * @class InflationLayer
  * @brief Layer to convolve costmap by robot's radius or footprint to prevent
@@ -134,6 +183,13 @@ public:
    */
   bool isClearable() override {return false;}
 
+  /**
+   * @brief updateBounds() reads the window accumulated by the layers before
+   *        this one and expands it by the inflation radius, so it must run
+   *        after them
+   */
+  bool isBoundsCoupled() override {return true;}
+
   /**
    * @brief Reset this costmap
    */
@@ -162,6 +218,30 @@ public:
     return cost;
   }
 
+  /** @brief  Given a distance and table parameters, compute a cost.
+   * Static counterpart of computeCost() used by the table builder, which may
+   * run off-thread and so must not read layer members
+   * @param  distance The distance from an obstacle in cells
+   * @param  params The parameters the tables are being built from
+   * @return A cost value for the distance */
+  static inline unsigned char computeCost(double distance, const InflationTableParams & params)
+  {
+    unsigned char cost = 0;
+    if (distance == 0) {
+      cost = LETHAL_OBSTACLE;
+    } else if (distance * params.resolution <= params.inscribed_radius) {
+      cost = INSCRIBED_INFLATED_OBSTACLE;
+    } else {
+      // make sure cost falls off by Euclidean distance
+      double factor =
+        exp(
+        -1.0 * params.cost_scaling_factor *
+        (distance * params.resolution - params.inscribed_radius));
+      cost = static_cast<unsigned char>((INSCRIBED_INFLATED_OBSTACLE - 1) * factor);
+    }
+    return cost;
+  }
+
   static std::shared_ptr<nav2_costmap_2d::InflationLayer> getInflationLayer(
     std::shared_ptr<nav2_costmap_2d::Costmap2DROS> & costmap_ros,
     const std::string layer_name = "")
@@ -222,7 +302,7 @@ protected:
   {
     unsigned int dx = (mx > src_x) ? mx - src_x : src_x - mx;
     unsigned int dy = (my > src_y) ? my - src_y : src_y - my;
-    return cached_distances_[dx * cache_length_ + dy];
+    return tables_->distances[dx * cache_length_ + dy];
   }
 
   /**
@@ -239,7 +319,7 @@ protected:
   {
     unsigned int dx = (mx > src_x) ? mx - src_x : src_x - mx;
     unsigned int dy = (my > src_y) ? my - src_y : src_y - my;
-    return cached_costs_[dx * cache_length_ + dy];
+    return tables_->costs[dx * cache_length_ + dy];
   }
 
   /**
@@ -247,6 +327,44 @@ protected:
    */
   void computeCaches();
 
+  /**
+   * @brief Snapshot the parameters the lookup tables are built from
+   */
+  InflationTableParams currentTableParams() const;
+
+  /**
+   * @brief Build the lookup tables for the given parameters, used when no
+   * other layer in the process has an identical set to share
+   */
+  static std::shared_ptr<const InflationTables> buildTables(const InflationTableParams & params);
+
+  /**
+   * @brief Fetch tables for the given parameters from the process-wide
+   * cache, building them if no layer has an identical set to share
+   */
+  static std::shared_ptr<const InflationTables> lookupOrBuildTables(
+    const InflationTableParams & params);
+
+  /**
+   * @brief Queue an asynchronous lookup-table rebuild for the current
+   * parameters. Requests coalesce, only the most recent one is built, and
+   * inflation keeps using the existing tables until the replacement is
+   * adopted at the start of a cycle
+   */
+  void requestTableRebuild();
+
+  /**
+   * @brief Swap in tables finished by the worker, if any, discarding
+   * results that no longer match the current parameters. Must be called
+   * with the layer lock held
+   */
+  void adoptFreshTables();
+
+  /**
+   * @brief Worker thread body, builds queued table rebuilds
+   */
+  void tableWorkerLoop();
+
   /**
    * @brief Compute cached dsitances
    */
@@ -267,6 +385,38 @@ protected:
     unsigned int index, unsigned int mx, unsigned int my,
     unsigned int src_x, unsigned int src_y);
 
+  /**
+   * @brief Row-sweep inflation over the update window using the dense cost
+   * kernel, equivalent to the scalar BFS but expressed as per-row max
+   * operations that vectorize (SSE2 when available, auto-vectorized otherwise)
+   */
+  void updateCostsVectorized(
+    nav2_costmap_2d::Costmap2D & master_grid,
+    int min_i, int min_j, int max_i, int max_j,
+    int base_min_i, int base_min_j, int base_max_i, int base_max_j);
+
+  /**
+   * @brief Elementwise dst[k] = max(dst[k], src[k]) over a row of cells
+   */
+  static void rowMax(unsigned char * dst, const unsigned char * src, int n);
+
+  /**
+   * @brief Incremental inflation over a persistent overlay: only cells whose
+   * source state (lethal / inflate-around-unknown) changed since the last
+   * cycle are re-stamped or locally recomputed, then the overlay window is
+   * merged into the master grid. Steady-state cycles cost O(changes) plus
+   * the window merge instead of a full re-inflation.
+   */
+  void updateCostsIncremental(
+    nav2_costmap_2d::Costmap2D & master_grid,
+    int min_i, int min_j, int max_i, int max_j,
+    int base_min_i, int base_min_j, int base_max_i, int base_max_j);
+
+  /**
+   * @brief Apply the cost kernel centered on cell (i, j) to the overlay
+   */
+  void stampKernel(int i, int j, int size_x, int size_y);
+
   /**
    * @brief Callback executed when a parameter change is detected
    * @param event ParameterEvent message
@@ -276,22 +426,53 @@ protected:
 
   double inflation_radius_, inscribed_radius_, cost_scaling_factor_;
   bool inflate_unknown_, inflate_around_unknown_;
+  bool vectorized_inflation_;
+  bool incremental_inflation_;
   unsigned int cell_inflation_radius_;
-  unsigned int cached_cell_inflation_radius_;
-  std::vector<std::vector<CellData>> inflation_cells_;
+  // The distance bins draw their storage from cell_arena_, which is reset in
+  // one step at the start of every update cycle instead of freeing each bin
+  using CellDataVector = std::vector<CellData, ArenaAllocator<CellData>>;
+  Arena cell_arena_;
+  std::vector<CellDataVector> inflation_cells_;
 
   double resolution_;
 
   std::vector<bool> seen_;
 
-  std::vector<unsigned char> cached_costs_;
-  std::vector<double> cached_distances_;
+  // Lookup tables shared process-wide between layers with identical
+  // parameters (see the table cache in inflation_layer.cpp)
+  std::shared_ptr<const InflationTables> tables_;
+  unsigned int kernel_size_;
+  // Scratch window of inflated costs, sized to the current update window
+  std::vector<unsigned char> inflation_window_;
+  // Incremental mode state: the map-sized standalone inflation contribution
+  // and the per-cell source flags it was last computed from
+  std::vector<unsigned char> overlay_;
+  std::vector<unsigned char> source_bitmap_;
+  bool overlay_valid_;
+  double overlay_origin_x_, overlay_origin_y_;
   std::vector<std::vector<int>> distance_matrix_;
   unsigned int cache_length_;
   double last_min_x_, last_min_y_, last_max_x_, last_max_y_;
 
   // Indicates that the entire costmap should be reinflated next time around.
   bool need_reinflation_;
+
+  // Asynchronous lookup-table rebuild for footprint changes: requests are
+  // queued here, coalesced by the worker, and the finished tables are
+  // published into fresh_tables_ for updateBounds() to swap in. The first
+  // build stays synchronous so the layer never inflates without tables
+  InflationTableParams tables_params_;
+  std::thread table_worker_;
+  std::mutex table_worker_mutex_;
+  std::condition_variable table_worker_cv_;
+  bool table_rebuild_pending_{false};
+  bool table_worker_shutdown_{false};
+  bool footprint_tables_built_{false};
+  InflationTableParams table_rebuild_params_;
+  std::shared_ptr<const InflationTables> fresh_tables_;
+  InflationTableParams fresh_tables_params_;
+
   mutex_t * access_;
   // Dynamic parameters handler
   rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr dyn_params_handler_;
@@ -89,6 +89,16 @@ public:
    */
   virtual bool isClearable() = 0;
 
+  /**
+   * @brief If this layer's updateBounds() reads the bounds accumulated by
+   *        the layers before it rather than only growing its own dirty area,
+   *        e.g. inflation padding the window of the layers it inflates.
+   *        Such layers cannot run concurrently with their inputs, so when the
+   *        bounds phase runs on a thread pool they are updated sequentially
+   *        after the independent layers, on the merged bounds.
+   */
+  virtual bool isBoundsCoupled() {return false;}
+
   /**
    * @brief This is called by the LayeredCostmap to poll this plugin as to how
    *        much of the costmap it needs to update. Each layer can increase
@@ -0,0 +1,89 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_COSTMAP_2D__LAYER_UPDATE_THREAD_POOL_HPP_
+#define NAV2_COSTMAP_2D__LAYER_UPDATE_THREAD_POOL_HPP_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nav2_costmap_2d
+{
+
+/**
+ * @class LayerUpdateThreadPool
+ * @brief A small fixed-size worker pool used by LayeredCostmap to run the
+ * updateBounds() phase of independent layer plugins concurrently.
+ *
+ * The pool is deliberately minimal: tasks are submitted as a batch and
+ * execute() blocks until every task of the batch has completed, so callers
+ * keep the same synchronous semantics as the sequential update path.
+ * Exceptions thrown by a task are captured and rethrown on the calling
+ * thread after the batch has drained.
+ */
+class LayerUpdateThreadPool
+{
+public:
+  /**
+   * @brief Constructor, spins up the worker threads
+   * @param num_threads Number of worker threads to create, must be >= 1
+   */
+  explicit LayerUpdateThreadPool(unsigned int num_threads);
+
+  /**
+   * @brief Destructor, joins all worker threads
+   */
+  ~LayerUpdateThreadPool();
+
+  /**
+   * @brief Run a batch of tasks on the pool and wait for all of them
+   * @param tasks Tasks to execute; may also run on the calling thread
+   * @throw rethrows the first exception raised by any task
+   */
+  void execute(const std::vector<std::function<void()>> & tasks);
+
+  /**
+   * @brief Get the number of worker threads in the pool
+   */
+  unsigned int size() const {return static_cast<unsigned int>(workers_.size());}
+
+private:
+  /**
+   * @brief Worker thread body, pops and runs tasks until shutdown
+   */
+  void workerLoop();
+
+  /**
+   * @brief Pop and run one queued task, if any
+   * @return true if a task was executed
+   */
+  bool runOneTask(std::unique_lock<std::mutex> & lock);
+
+  std::vector<std::thread> workers_;
+  std::deque<std::function<void()>> queue_;
+  std::mutex mutex_;
+  std::condition_variable work_available_;
+  std::condition_variable batch_done_;
+  unsigned int in_flight_{0};
+  std::exception_ptr first_exception_;
+  bool shutdown_{false};
+};
+
+}  // namespace nav2_costmap_2d
+
+#endif  // NAV2_COSTMAP_2D__LAYER_UPDATE_THREAD_POOL_HPP_
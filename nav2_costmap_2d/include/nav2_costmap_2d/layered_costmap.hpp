@@ -38,12 +38,18 @@
 #ifndef NAV2_COSTMAP_2D__LAYERED_COSTMAP_HPP_
 #define NAV2_COSTMAP_2D__LAYERED_COSTMAP_HPP_
 
+#include <array>
+#include <chrono>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
+#include "nav2_msgs/msg/layer_timing.hpp"
 #include "nav2_costmap_2d/cost_values.hpp"
 #include "nav2_costmap_2d/layer.hpp"
+#include "nav2_costmap_2d/layer_update_thread_pool.hpp"
 #include "nav2_costmap_2d/costmap_2d.hpp"
 
 namespace nav2_costmap_2d
@@ -73,6 +79,53 @@ public:
    */
   void updateMap(double robot_x, double robot_y, double robot_yaw);
 
+  /**
+   * @brief Restrict the next updateMap() call to the given world-coordinate
+   * window.
+   *
+   * The plugins still run their updateBounds() phase normally, but costs are
+   * only recombined inside the intersection of the dirty bounds and this
+   * window. The part of the dirty area left out is carried over and merged
+   * into the bounds of the next unclamped update, so no dirty cells are ever
+   * dropped. Used to serve a small region on demand while a full-map update
+   * (e.g. the first one after activation) is still pending.
+   */
+  void clampNextUpdate(double min_x, double min_y, double max_x, double max_y);
+
+  /**
+   * @brief Enable or disable running the updateBounds() phase of the layer
+   * plugins on a thread pool.
+   *
+   * Each plugin instance only touches its own state during updateBounds(),
+   * so independent layers (e.g. obstacle and voxel raytracing) may run
+   * concurrently. The updateCosts() phase stays sequential in plugin order,
+   * which preserves the combination ordering layers rely on (e.g. inflation
+   * after the obstacle and static layers).
+   * @param num_threads Number of worker threads, 0 restores sequential updates
+   */
+  void setParallelUpdate(unsigned int num_threads);
+
+  /**
+   * @brief Enable or disable collection of per-layer update timing.
+   * When enabled, every updateBounds()/updateCosts() call is timed into a
+   * small per-layer ring buffer so slow cycles can be attributed to a
+   * specific layer. Disabling drops the collected statistics.
+   */
+  void setTimingEnabled(bool enabled);
+
+  /**
+   * @brief Whether per-layer timing collection is enabled
+   */
+  bool isTimingEnabled() const
+  {
+    return timing_enabled_;
+  }
+
+  /**
+   * @brief Get the per-layer timing statistics gathered so far
+   */
+  std::vector<nav2_msgs::msg::LayerTiming> getTimingStats() const;
+
   std::string getGlobalFrameID() const
   {
     return global_frame_;
@@ -174,6 +227,17 @@ public:
     *yn = byn_;
   }
 
+  /**
+   * @brief Get the monotonic count of completed map updates
+   *
+   * Together with getBounds(), lets consumers holding the costmap mutex
+   * detect whether (and where) the map changed since they last sampled it.
+   */
+  unsigned int getUpdateCount()
+  {
+    return update_count_;
+  }
+
   /**
    * @brief if the costmap is initialized
    */
@@ -212,6 +276,22 @@ public:
   bool isOutofBounds(double robot_x, double robot_y);
 
 private:
+  /// @brief Fixed-capacity ring of the most recent durations for one layer phase
+  struct TimingRing
+  {
+    std::array<double, 32> samples;
+    size_t next{0};
+    size_t count{0};
+    double last{0.0};
+  };
+
+  /**
+   * @brief Record the elapsed time since start for one layer phase
+   */
+  void recordTiming(
+    const std::string & layer_name, const char * phase,
+    const std::chrono::steady_clock::time_point & start);
+
   // primary_costmap_ is a bottom costmap used by plugins when costmap filters were enabled.
   // combined_costmap_ is a final costmap where all results produced by plugins and filters (if any)
   // to be merged.
@@ -226,9 +306,23 @@ private:
   double minx_, miny_, maxx_, maxy_;
   unsigned int bx0_, bxn_, by0_, byn_;
 
+  // One-shot clamp window for the next update and the dirty area carried
+  // over from clamped updates, both in world coordinates
+  bool clamp_next_update_{false};
+  double clamp_minx_{0.0}, clamp_miny_{0.0}, clamp_maxx_{0.0}, clamp_maxy_{0.0};
+  bool has_pending_bounds_{false};
+  double pending_minx_{0.0}, pending_miny_{0.0}, pending_maxx_{0.0}, pending_maxy_{0.0};
+  unsigned int update_count_;
+
   std::vector<std::shared_ptr<Layer>> plugins_;
   std::vector<std::shared_ptr<Layer>> filters_;
 
+  std::unique_ptr<LayerUpdateThreadPool> update_pool_;
+
+  bool timing_enabled_{false};
+  std::map<std::string, TimingRing> timing_rings_;  ///< keyed by "<layer>/<phase>"
+  mutable std::mutex timing_mutex_;
+
   bool initialized_;
   bool size_locked_;
   std::atomic<double> circumscribed_radius_, inscribed_radius_;
@@ -32,16 +32,22 @@
 #ifndef NAV2_COSTMAP_2D__OBSERVATION_HPP_
 #define NAV2_COSTMAP_2D__OBSERVATION_HPP_
 
+#include <memory>
+#include <utility>
+
 #include <geometry_msgs/msg/point.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
 
 namespace nav2_costmap_2d
 {
 
+class ObservationSpatialIndex;
+
 /**
  * @brief Stores an observation in terms of a point cloud and the origin of the source
- * @note Tried to make members and constructor arguments const but the compiler would not accept the default
- * assignment operator for vector insertion!
+ * @note The cloud is immutable once buffered and held by a shared pointer, so
+ * copying an observation (e.g. in ObservationBuffer::getObservations()) shares
+ * the cloud instead of deep copying it.
  */
 class Observation
 {
@@ -50,7 +56,8 @@ public:
    * @brief  Creates an empty observation
    */
   Observation()
-  : cloud_(new sensor_msgs::msg::PointCloud2()), obstacle_max_range_(0.0), obstacle_min_range_(0.0),
+  : cloud_(std::make_shared<sensor_msgs::msg::PointCloud2>()), obstacle_max_range_(0.0),
+    obstacle_min_range_(0.0),
     raytrace_max_range_(0.0),
     raytrace_min_range_(0.0)
   {
@@ -60,17 +67,17 @@ public:
    */
   virtual ~Observation()
   {
-    delete cloud_;
   }
 
   /**
-   * @brief  Copy assignment operator
+   * @brief  Copy assignment operator, shares the immutable cloud
    * @param obs The observation to copy
    */
   Observation & operator=(const Observation & obs)
   {
     origin_ = obs.origin_;
-    cloud_ = new sensor_msgs::msg::PointCloud2(*(obs.cloud_));
+    cloud_ = obs.cloud_;
+    spatial_index_ = obs.spatial_index_;
     obstacle_max_range_ = obs.obstacle_max_range_;
     obstacle_min_range_ = obs.obstacle_min_range_;
     raytrace_max_range_ = obs.raytrace_max_range_;
@@ -92,7 +99,28 @@ public:
     geometry_msgs::msg::Point & origin, const sensor_msgs::msg::PointCloud2 & cloud,
     double obstacle_max_range, double obstacle_min_range, double raytrace_max_range,
     double raytrace_min_range)
-  : origin_(origin), cloud_(new sensor_msgs::msg::PointCloud2(cloud)),
+  : origin_(origin), cloud_(std::make_shared<sensor_msgs::msg::PointCloud2>(cloud)),
+    obstacle_max_range_(obstacle_max_range), obstacle_min_range_(obstacle_min_range),
+    raytrace_max_range_(raytrace_max_range), raytrace_min_range_(
+      raytrace_min_range)
+  {
+  }
+
+  /**
+   * @brief  Creates an observation from an origin point and an already shared
+   * point cloud, without copying the cloud data
+   * @param origin The origin point of the observation
+   * @param cloud The shared point cloud of the observation
+   * @param obstacle_max_range The range out to which an observation should be able to insert obstacles
+   * @param obstacle_min_range The range from which an observation should be able to insert obstacles
+   * @param raytrace_max_range The range out to which an observation should be able to clear via raytracing
+   * @param raytrace_min_range The range from which an observation should be able to clear via raytracing
+   */
+  Observation(
+    geometry_msgs::msg::Point & origin, sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud,
+    double obstacle_max_range, double obstacle_min_range, double raytrace_max_range,
+    double raytrace_min_range)
+  : origin_(origin), cloud_(std::move(cloud)),
     obstacle_max_range_(obstacle_max_range), obstacle_min_range_(obstacle_min_range),
     raytrace_max_range_(raytrace_max_range), raytrace_min_range_(
       raytrace_min_range)
@@ -100,11 +128,11 @@ public:
   }
 
   /**
-   * @brief  Copy constructor
+   * @brief  Copy constructor, shares the immutable cloud
    * @param obs The observation to copy
    */
   Observation(const Observation & obs)
-  : origin_(obs.origin_), cloud_(new sensor_msgs::msg::PointCloud2(*(obs.cloud_))),
+  : origin_(obs.origin_), cloud_(obs.cloud_), spatial_index_(obs.spatial_index_),
     obstacle_max_range_(obs.obstacle_max_range_), obstacle_min_range_(obs.obstacle_min_range_),
     raytrace_max_range_(obs.raytrace_max_range_),
     raytrace_min_range_(obs.raytrace_min_range_)
@@ -120,14 +148,18 @@ public:
   Observation(
     const sensor_msgs::msg::PointCloud2 & cloud, double obstacle_max_range,
     double obstacle_min_range)
-  : cloud_(new sensor_msgs::msg::PointCloud2(cloud)), obstacle_max_range_(obstacle_max_range),
+  : cloud_(std::make_shared<sensor_msgs::msg::PointCloud2>(cloud)),
+    obstacle_max_range_(obstacle_max_range),
     obstacle_min_range_(obstacle_min_range),
     raytrace_max_range_(0.0), raytrace_min_range_(0.0)
   {
   }
 
   geometry_msgs::msg::Point origin_;
-  sensor_msgs::msg::PointCloud2 * cloud_;
+  sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud_;
+  /// @brief Coarse XY bucket index over the cloud, shared like the cloud
+  /// itself; may be null (e.g. for static observations added in tests)
+  std::shared_ptr<const ObservationSpatialIndex> spatial_index_;
   double obstacle_max_range_, obstacle_min_range_, raytrace_max_range_, raytrace_min_range_;
 };
 
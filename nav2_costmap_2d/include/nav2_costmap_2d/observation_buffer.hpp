@@ -37,9 +37,15 @@
 #ifndef NAV2_COSTMAP_2D__OBSERVATION_BUFFER_HPP_
 #define NAV2_COSTMAP_2D__OBSERVATION_BUFFER_HPP_
 
-#include <vector>
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <list>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "tf2_geometry_msgs/tf2_geometry_msgs.hpp"
 #include "rclcpp/time.hpp"
@@ -99,6 +105,14 @@ public:
    */
   void bufferCloud(const sensor_msgs::msg::PointCloud2 & cloud);
 
+  /**
+   * @brief  Buffers a shared PointCloud, sharing the message without copying
+   * point data when it is already in the global frame and entirely within the
+   * height bounds, transforming and filtering as usual otherwise
+   * @param  cloud The shared cloud to be buffered
+   */
+  void bufferCloud(const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud);
+
   /**
    * @brief  Pushes copies of all current observations onto the end of the vector passed in
    * @param  observations The vector to be filled
@@ -132,12 +146,51 @@ public:
    */
   void resetLastUpdated();
 
+  /**
+   * @brief  Start the asynchronous transform worker for this buffer
+   * Clouds handed to bufferCloudAsync() are queued and transformed on the
+   * worker thread, so a TF wait never blocks the sensor callback or the
+   * costmap update thread. Call at most once, before any bufferCloudAsync()
+   */
+  void enableAsyncTransform();
+
+  /**
+   * @brief  Queue a cloud for the asynchronous worker and return immediately
+   * Requires enableAsyncTransform() to have been called. The queue keeps the
+   * newest clouds and drops the oldest when the worker falls behind
+   * @param  cloud The shared cloud to be buffered
+   */
+  void bufferCloudAsync(const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud);
+
 private:
   /**
    * @brief  Removes any stale observations from the buffer list
+   * Only the timing-wheel slots that elapsed since the last purge are
+   * visited, so the cost per cycle is bounded by the number of expiring
+   * observations rather than the size of the buffer
    */
   void purgeStaleObservations();
 
+  /**
+   * @brief  Registers a freshly buffered observation with the timing wheel
+   * so that purgeStaleObservations() can expire it in O(1)
+   * @param  obs_it Iterator to the observation in observation_list_
+   */
+  void registerExpiry(const std::list<Observation>::iterator & obs_it);
+
+  /**
+   * @brief  Transform a cloud to the global frame and filter it by the height
+   * bounds, without touching the observation list
+   * @return false if the transform failed and the cloud should be discarded
+   */
+  bool transformAndFilterCloud(
+    const sensor_msgs::msg::PointCloud2 & cloud, Observation & observation);
+
+  /**
+   * @brief  Worker thread body, pops queued clouds and buffers them
+   */
+  void asyncWorkerLoop();
+
   rclcpp::Clock::SharedPtr clock_;
   rclcpp::Logger logger_{rclcpp::get_logger("nav2_costmap_2d")};
   tf2_ros::Buffer & tf2_buffer_;
@@ -152,6 +205,26 @@ private:
   std::recursive_mutex lock_;  ///< @brief A lock for accessing data in callbacks safely
   double obstacle_max_range_, obstacle_min_range_, raytrace_max_range_, raytrace_min_range_;
   tf2::Duration tf_tolerance_;
+
+  // Timing wheel for observation expiry: each buffered observation is filed
+  // into the slot its expiry time falls in, and a purge only drains the slots
+  // that elapsed since the previous purge. Unused when the keep time is zero,
+  // which keeps only the most recent observation
+  struct ExpiryEntry
+  {
+    rclcpp::Time expiry;
+    std::list<Observation>::iterator observation;
+  };
+  static constexpr size_t expiry_wheel_slots_ = 64;
+  std::array<std::vector<ExpiryEntry>, expiry_wheel_slots_> expiry_wheel_;
+  const int64_t expiry_slot_width_ns_;
+  rclcpp::Time expiry_cursor_time_;  ///< @brief Slots up to here have been drained
+
+  std::thread async_worker_;
+  std::mutex async_mutex_;
+  std::condition_variable async_cv_;
+  std::deque<sensor_msgs::msg::PointCloud2::ConstSharedPtr> async_queue_;
+  bool async_shutdown_{false};
 };
 }  // namespace nav2_costmap_2d
 #endif  // NAV2_COSTMAP_2D__OBSERVATION_BUFFER_HPP_
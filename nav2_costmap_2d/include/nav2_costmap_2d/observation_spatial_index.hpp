@@ -0,0 +1,107 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_COSTMAP_2D__OBSERVATION_SPATIAL_INDEX_HPP_
+#define NAV2_COSTMAP_2D__OBSERVATION_SPATIAL_INDEX_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+namespace nav2_costmap_2d
+{
+
+/**
+ * @class ObservationSpatialIndex
+ * @brief Coarse XY grid index over the points of one buffered observation.
+ *
+ * Built once when the observation cloud is buffered and immutable afterward,
+ * it buckets point indices into a coarse grid (CSR layout) so consumers can
+ * visit only the points falling inside a query region instead of iterating
+ * the whole cloud. Buckets are coarse on purpose: the query is a candidate
+ * filter and callers still apply their exact per-point checks.
+ */
+class ObservationSpatialIndex
+{
+public:
+  /**
+   * @brief Build the index over the XY extent of the given cloud
+   * @param cloud The observation cloud, already in the global frame
+   * @param bucket_size Bucket edge length in meters
+   */
+  explicit ObservationSpatialIndex(
+    const sensor_msgs::msg::PointCloud2 & cloud, double bucket_size = 2.0);
+
+  /**
+   * @brief Invoke action(point_index) for every point whose bucket
+   * intersects the given axis-aligned region
+   * @param min_x Minimum x bound of the region, in meters
+   * @param min_y Minimum y bound of the region, in meters
+   * @param max_x Maximum x bound of the region, in meters
+   * @param max_y Maximum y bound of the region, in meters
+   * @param action Callable taking the index of a candidate point
+   */
+  template<class ActionType>
+  void forEachInRegion(
+    double min_x, double min_y, double max_x, double max_y, ActionType action) const
+  {
+    if (point_indices_.empty()) {
+      return;
+    }
+
+    const int bx0 = std::max(0, bucketCoord(min_x, min_x_));
+    const int by0 = std::max(0, bucketCoord(min_y, min_y_));
+    const int bx1 = std::min(static_cast<int>(buckets_x_) - 1, bucketCoord(max_x, min_x_));
+    const int by1 = std::min(static_cast<int>(buckets_y_) - 1, bucketCoord(max_y, min_y_));
+
+    for (int by = by0; by <= by1; ++by) {
+      for (int bx = bx0; bx <= bx1; ++bx) {
+        const unsigned int bucket = by * buckets_x_ + bx;
+        for (uint32_t k = bucket_starts_[bucket]; k < bucket_starts_[bucket + 1]; ++k) {
+          action(point_indices_[k]);
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief The number of points covered by the index (non-finite points
+   * in the cloud carry no position and are left out)
+   */
+  size_t size() const
+  {
+    return point_indices_.size();
+  }
+
+private:
+  /**
+   * @brief Map a world coordinate to a bucket coordinate along one axis
+   */
+  int bucketCoord(double world, double origin) const
+  {
+    return static_cast<int>(std::floor((world - origin) / bucket_size_));
+  }
+
+  double bucket_size_;
+  double min_x_{0.0}, min_y_{0.0};
+  unsigned int buckets_x_{0}, buckets_y_{0};
+  std::vector<uint32_t> bucket_starts_;  ///< CSR offsets, buckets_x_ * buckets_y_ + 1 entries
+  std::vector<uint32_t> point_indices_;  ///< point indices grouped by bucket
+};
+
+}  // namespace nav2_costmap_2d
+
+#endif  // NAV2_COSTMAP_2D__OBSERVATION_SPATIAL_INDEX_HPP_
@@ -56,6 +56,7 @@
 #include "nav2_costmap_2d/costmap_layer.hpp"
 #include "nav2_costmap_2d/layered_costmap.hpp"
 #include "nav2_costmap_2d/observation_buffer.hpp"
+#include "nav2_costmap_2d/obstacle_track_store.hpp"
 #include "nav2_costmap_2d/footprint.hpp"
 
 namespace nav2_costmap_2d
@@ -143,6 +144,17 @@ public:
    */
   void resetBuffersLastUpdated();
 
+  /**
+   * @brief Re-apply buffered marking observations newer than the given age
+   * to this layer's costmap.
+   *
+   * Called after a clearing service wiped the layer so that cells backed by
+   * fresh sensor data are restored immediately, instead of leaving the
+   * costmap blind until the next full update cycle re-marks them.
+   * @param cutoff_age Maximum observation age, in seconds, to re-apply
+   */
+  virtual void remarkRecentObservations(double cutoff_age);
+
   /**
    * @brief  A callback to handle buffering LaserScan messages
    * @param message The message returned from a message notifier
@@ -214,6 +226,21 @@ protected:
     double * max_x,
     double * max_y);
 
+  /**
+   * @brief Process update costmap with raytracing the window bounds
+   *
+   * Variant taking the range limits squared, which are constant per
+   * observation and can be hoisted out of the beam loop. Comparing squared
+   * distances keeps the sqrt off the per-beam path entirely unless the
+   * endpoint actually overshoots the raytrace range and has to be scaled.
+   */
+  void updateRaytraceBounds(
+    double ox, double oy, double wx, double wy, double max_range,
+    double min_range_sq, double max_range_sq,
+    double * min_x, double * min_y,
+    double * max_x,
+    double * max_y);
+
   std::vector<geometry_msgs::msg::Point> transformed_footprint_;
   bool footprint_clearing_enabled_;
   /**
@@ -228,6 +255,9 @@ protected:
   std::string global_frame_;  ///< @brief The global frame for the costmap
   double min_obstacle_height_;  ///< @brief Max Obstacle Height
   double max_obstacle_height_;  ///< @brief Max Obstacle Height
+  /// @brief Resolve transforms on the observation buffers' worker threads
+  /// instead of synchronously inside the sensor callbacks
+  bool async_transform_processing_{false};
 
   /// @brief Used to project laser scans into point clouds
   laser_geometry::LaserProjection projector_;
@@ -250,6 +280,18 @@ protected:
   std::vector<nav2_costmap_2d::Observation> static_clearing_observations_;
   std::vector<nav2_costmap_2d::Observation> static_marking_observations_;
 
+  /// @brief Scratch vectors reused by updateBounds() so steady-state update
+  /// cycles gather observations without reallocating
+  std::vector<nav2_costmap_2d::Observation> cycle_marking_observations_;
+  std::vector<nav2_costmap_2d::Observation> cycle_clearing_observations_;
+
+  /// @brief Persistent obstacle tracks re-marked between sensor hits,
+  /// allocated when track_persistence_time > 0
+  std::unique_ptr<ObstacleTrackStore> track_store_;
+  double track_persistence_time_{0.0};
+  int track_min_observations_{0};
+  rclcpp::Time cycle_now_;
+
   bool rolling_window_;
   bool was_reset_;
   nav2_costmap_2d::CombinationMethod combination_method_;
@@ -0,0 +1,126 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_COSTMAP_2D__OBSTACLE_TRACK_STORE_HPP_
+#define NAV2_COSTMAP_2D__OBSTACLE_TRACK_STORE_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+
+#include "rclcpp/time.hpp"
+
+namespace nav2_costmap_2d
+{
+
+/**
+ * @class ObstacleTrackStore
+ * @brief Persistent, decaying record of repeatedly observed obstacle cells.
+ *
+ * Observation buffers forget points as soon as they age out, so obstacles
+ * that a sensor only hits intermittently (slow-moving vehicles, thin poles)
+ * flicker in and out of the costmap. The store clusters marked points into
+ * world-quantized cells; a cell that keeps being observed becomes a track
+ * and stays active for a persistence window after its last reinforcement,
+ * letting the layer keep it marked between hits. A single stray detection
+ * never becomes a track, so sensor noise does not leave ghosts behind, and
+ * tracks are erased outright once the window elapses.
+ *
+ * Keys are world-quantized, so rolling-window origin shifts do not move or
+ * invalidate tracks.
+ */
+class ObstacleTrackStore
+{
+public:
+  /**
+   * @brief Constructor
+   * @param cell_size Quantization of track positions, in meters; normally
+   * the costmap resolution
+   * @param persistence_time How long a track stays active after it was last
+   * observed, in seconds
+   * @param min_observations How many observations a cell needs before it is
+   * considered a track rather than a stray detection
+   */
+  ObstacleTrackStore(double cell_size, double persistence_time, unsigned int min_observations);
+
+  /**
+   * @brief Reinforce the track containing a marked world point
+   * @param wx X coordinate of the point, in meters
+   * @param wy Y coordinate of the point, in meters
+   * @param stamp Time the point was observed
+   */
+  void observe(double wx, double wy, const rclcpp::Time & stamp);
+
+  /**
+   * @brief Erase every track not observed within the persistence window
+   * @param now The current time
+   */
+  void prune(const rclcpp::Time & now);
+
+  /**
+   * @brief Invoke action(wx, wy) for the position of every active track:
+   * one reinforced past the observation threshold and observed within the
+   * persistence window
+   * @param now The current time
+   * @param action Callable taking the world x and y of the track, in meters
+   */
+  template<class ActionType>
+  void forEachActive(const rclcpp::Time & now, ActionType action) const
+  {
+    for (const auto & it : tracks_) {
+      const Track & track = it.second;
+      if (track.observations >= min_observations_ &&
+        (now - track.last_seen).seconds() <= persistence_time_)
+      {
+        action(track.wx, track.wy);
+      }
+    }
+  }
+
+  /** @brief Number of tracks held, active or not */
+  size_t size() const {return tracks_.size();}
+
+  /** @brief Drop all tracks, e.g. when the layer is reset */
+  void clear() {tracks_.clear();}
+
+private:
+  struct Track
+  {
+    double wx;
+    double wy;
+    rclcpp::Time last_seen;
+    unsigned int observations;
+  };
+
+  /** @brief Quantize a world position into a track key */
+  inline uint64_t keyOf(double wx, double wy) const
+  {
+    // 2^31 cell offset keeps the lattice indices positive for any
+    // plausible world coordinate
+    uint64_t kx = static_cast<uint64_t>(static_cast<int64_t>(
+        std::floor(wx / cell_size_)) + (1ll << 31));
+    uint64_t ky = static_cast<uint64_t>(static_cast<int64_t>(
+        std::floor(wy / cell_size_)) + (1ll << 31));
+    return (kx << 32) | (ky & 0xFFFFFFFFull);
+  }
+
+  double cell_size_;
+  double persistence_time_;
+  unsigned int min_observations_;
+  std::unordered_map<uint64_t, Track> tracks_;
+};
+
+}  // namespace nav2_costmap_2d
+
+#endif  // NAV2_COSTMAP_2D__OBSTACLE_TRACK_STORE_HPP_
@@ -162,9 +162,14 @@ protected:
    */
   inline double gamma(double theta);
   /**
-   * @brief Get the delta value for an angle, phi
+   * @brief Get the delta value for a distance, phi, from the precomputed
+   * table (linear interpolation, error well below one cost byte)
    */
   inline double delta(double phi);
+  /**
+   * @brief Precompute the delta() table for the current phi parameter
+   */
+  void buildDeltaTable();
   /**
    * @brief Apply the sensor model of the layer for range sensors
    */
@@ -177,9 +182,11 @@ protected:
 
   /**
    * @brief Update the cost in a cell with information
+   * @param cos_ot Cosine of the beam heading ot, hoisted out of the cell loop
+   * @param sin_ot Sine of the beam heading ot, hoisted out of the cell loop
    */
   inline void update_cell(
-    double ox, double oy, double ot,
+    double ox, double oy, double ot, double cos_ot, double sin_ot,
     double r, double nx, double ny, bool clear);
 
   /**
@@ -203,9 +210,16 @@ protected:
   std::list<sensor_msgs::msg::Range> range_msgs_buffer_;
 
   double max_angle_, phi_v_;
+  double cos_max_angle_;
   double inflate_cone_;
   std::string global_frame_;
 
+  // Precomputed delta() samples over [0, phi_v_ + delta_table_span_]; beyond
+  // the span the tanh has saturated and delta() is zero to within 1e-7
+  std::vector<double> delta_table_;
+  static constexpr double delta_table_step_ = 0.005;
+  static constexpr double delta_table_span_ = 4.0;
+
   double clear_threshold_, mark_threshold_;
   bool clear_on_max_reading_;
   bool was_reset_;
@@ -135,6 +135,15 @@ protected:
    */
   void processMap(const nav_msgs::msg::OccupancyGrid & new_map);
 
+  /**
+   * @brief Fold a republished map in by diffing it tile-by-tile against
+   * the stored raw grid, reprocessing and dirtying only the tiles that
+   * actually changed
+   * @return false when the map geometry changed and the full
+   * processMap() pass is required
+   */
+  bool processMapDiff(const nav_msgs::msg::OccupancyGrid & new_map);
+
   /**
    * @brief  Callback to update the costmap's map from the map_server
    * @param new_map The map to put into the costmap. The origin of the new
@@ -154,6 +163,13 @@ protected:
    */
   unsigned char interpretValue(unsigned char value);
 
+  /**
+   * @brief Make sure the tiles overlapping the given cell region of this
+   * layer have been translated from the buffered occupancy grid. Only used
+   * when tile_size is set, for lazily loading building-scale maps.
+   */
+  void ensureTilesLoaded(int min_i, int min_j, int max_i, int max_j);
+
   /**
    * @brief Callback executed when a parameter change is detected
    * @param event ParameterEvent message
@@ -198,6 +214,13 @@ protected:
   bool map_received_in_update_bounds_{false};
   tf2::Duration transform_tolerance_;
   nav_msgs::msg::OccupancyGrid::SharedPtr map_buffer_;
+  // Lazy tiled loading state: the untranslated occupancy grid and the set of
+  // tiles already interpreted into costmap_ (tile_size of 0 disables tiling)
+  int tile_size_{0};
+  nav_msgs::msg::OccupancyGrid::ConstSharedPtr raw_map_;
+  std::vector<uint8_t> tile_loaded_;
+  unsigned int tiles_x_{0};
+  unsigned int tiles_y_{0};
   // Dynamic parameters handler
   rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr dyn_params_handler_;
 };
@@ -38,11 +38,13 @@
 #ifndef NAV2_COSTMAP_2D__VOXEL_LAYER_HPP_
 #define NAV2_COSTMAP_2D__VOXEL_LAYER_HPP_
 
+#include <memory>
 #include <vector>
 #include "message_filters/subscriber.h"
 
 #include <rclcpp/rclcpp.hpp>
 #include <nav2_costmap_2d/layer.hpp>
+#include <nav2_costmap_2d/layer_update_thread_pool.hpp>
 #include <nav2_costmap_2d/layered_costmap.hpp>
 #include <nav2_costmap_2d/observation_buffer.hpp>
 #include <nav_msgs/msg/occupancy_grid.hpp>
@@ -127,6 +129,13 @@ public:
    */
   virtual bool isClearable() {return true;}
 
+  /**
+   * @brief Re-apply buffered marking observations newer than the given age
+   * through the voxel grid, restoring cleared cells backed by fresh data
+   * @param cutoff_age Maximum observation age, in seconds, to re-apply
+   */
+  virtual void remarkRecentObservations(double cutoff_age);
+
 protected:
   /**
    * @brief Reset internal maps
@@ -142,11 +151,66 @@ protected:
     double * max_x,
     double * max_y);
 
+  /**
+   * @brief Two-phase parallel version of raytraceFreespace: worker threads
+   * first accumulate the z-masks each beam would clear into per-thread mask
+   * grids, then the merged masks are applied to disjoint column bands with
+   * bulk bitmask operations. Produces the same voxel grid and costmap as the
+   * sequential path. Used when clearing_threads > 1.
+   */
+  void raytraceFreespaceParallel(
+    const nav2_costmap_2d::Observation & clearing_observation,
+    double sensor_x, double sensor_y, double sensor_z,
+    double * min_x, double * min_y,
+    double * max_x,
+    double * max_y);
+
+  /**
+   * @brief Grid-type-agnostic body of raytraceFreespaceParallel(), shared by
+   * the 32 and 64 bit column modes
+   */
+  template<typename GridT, typename MaskT>
+  void raytraceFreespaceParallelImpl(
+    GridT & grid, std::vector<std::vector<MaskT>> & clear_masks,
+    const nav2_costmap_2d::Observation & clearing_observation,
+    double sensor_x, double sensor_y, double sensor_z,
+    double * min_x, double * min_y,
+    double * max_x,
+    double * max_y);
+
+  /**
+   * @brief Number of z levels a column word holds in the current mode
+   */
+  inline unsigned int voxelBits() const
+  {
+    return voxel_grid64_ ?
+           nav2_voxel_grid::VoxelGrid64::max_z_levels :
+           nav2_voxel_grid::VoxelGrid::max_z_levels;
+  }
+
+  /**
+   * @brief Mark one voxel in whichever grid is active
+   * @return Whether the column crossed the mark threshold
+   */
+  inline bool markVoxelInMap(unsigned int mx, unsigned int my, unsigned int mz)
+  {
+    return voxel_grid64_ ?
+           voxel_grid64_->markVoxelInMap(mx, my, mz, mark_threshold_) :
+           voxel_grid_.markVoxelInMap(mx, my, mz, mark_threshold_);
+  }
+
   bool publish_voxel_;
   rclcpp_lifecycle::LifecyclePublisher<nav2_msgs::msg::VoxelGrid>::SharedPtr voxel_pub_;
   nav2_voxel_grid::VoxelGrid voxel_grid_;
+  /// @brief 64-bit column grid, allocated instead when z_voxels > 16
+  std::unique_ptr<nav2_voxel_grid::VoxelGrid64> voxel_grid64_;
   double z_resolution_, origin_z_;
   int unknown_threshold_, mark_threshold_, size_z_;
+  int clearing_threads_{0};
+  std::unique_ptr<LayerUpdateThreadPool> clearing_pool_;
+  /// @brief Per-worker clearing mask grids, reused between update cycles
+  std::vector<std::vector<uint32_t>> clear_masks_;
+  std::vector<std::vector<uint64_t>> clear_masks64_;
   rclcpp_lifecycle::LifecyclePublisher<sensor_msgs::msg::PointCloud2>::SharedPtr
     clearing_endpoints_pub_;
 
@@ -134,6 +134,24 @@ void BinaryFilter::filterInfoCallback(
   // Set topic name to receive filter mask from
   mask_topic_ = msg->filter_mask_topic;
 
+  // Prefer mapping the mask from shared memory when its publisher offers it:
+  // all filter-enabled costmaps on this host then share one physical copy
+  if (!msg->filter_mask_shm.empty()) {
+    RCLCPP_INFO(
+      logger_,
+      "BinaryFilter: Mapping filter mask from \"%s\" shared-memory segment...",
+      msg->filter_mask_shm.c_str());
+    nav_msgs::msg::OccupancyGrid::SharedPtr mask = mapSharedMask(msg->filter_mask_shm);
+    if (mask) {
+      filter_mask_ = mask;
+      return;
+    }
+    RCLCPP_WARN(
+      logger_,
+      "BinaryFilter: Falling back to \"%s\" topic for the filter mask",
+      mask_topic_.c_str());
+  }
+
   // Setting new filter mask subscriber
   RCLCPP_INFO(
     logger_,
@@ -161,6 +179,7 @@ void BinaryFilter::maskCallback(
     filter_mask_.reset();
   }
 
+  releaseSharedMask();
   filter_mask_ = msg;
 }
 
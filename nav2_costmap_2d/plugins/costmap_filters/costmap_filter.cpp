@@ -41,6 +41,9 @@
 #include "nav2_costmap_2d/costmap_filters/costmap_filter.hpp"
 
 #include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
 
 #include "tf2_geometry_msgs/tf2_geometry_msgs.hpp"
 #include "geometry_msgs/msg/point_stamped.hpp"
@@ -216,9 +219,7 @@ unsigned char CostmapFilter::getMaskCost(
   nav_msgs::msg::OccupancyGrid::ConstSharedPtr filter_mask,
   const unsigned int mx, const unsigned int & my) const
 {
-  const unsigned int index = my * filter_mask->info.width + mx;
-
-  const char data = filter_mask->data[index];
+  const int8_t data = getMaskData(filter_mask, mx, my);
   if (data == nav2_util::OCC_GRID_UNKNOWN) {
     return NO_INFORMATION;
   } else {
@@ -230,4 +231,19 @@ unsigned char CostmapFilter::getMaskCost(
   }
 }
 
+nav_msgs::msg::OccupancyGrid::SharedPtr CostmapFilter::mapSharedMask(
+  const std::string & segment_name)
+{
+  std::shared_ptr<nav2_util::SharedOccupancyGrid> mask;
+  try {
+    mask = std::make_shared<nav2_util::SharedOccupancyGrid>(segment_name);
+  } catch (const std::runtime_error & ex) {
+    RCLCPP_ERROR(logger_, "CostmapFilter: %s", ex.what());
+    return nullptr;
+  }
+
+  shared_mask_ = mask;
+  return std::make_shared<nav_msgs::msg::OccupancyGrid>(mask->grid());
+}
+
 }  // namespace nav2_costmap_2d
@@ -35,9 +35,12 @@
  * Author: Alexey Merzlyakov
  *********************************************************************/
 
+#include <cmath>
 #include <string>
 #include <memory>
 #include <algorithm>
+#include <vector>
+#include "nav2_util/occ_grid_values.hpp"
 #include "tf2/convert.h"
 #include "tf2_geometry_msgs/tf2_geometry_msgs.hpp"
 
@@ -51,6 +54,18 @@ KeepoutFilter::KeepoutFilter()
 : filter_info_sub_(nullptr), mask_sub_(nullptr), filter_mask_(nullptr),
   global_frame_("")
 {
+  for (int v = 0; v < 256; v++) {
+    const int8_t data = static_cast<int8_t>(v);
+    if (data == nav2_util::OCC_GRID_UNKNOWN) {
+      cost_lut_[v] = NO_INFORMATION;
+    } else {
+      cost_lut_[v] = static_cast<unsigned char>(
+        static_cast<int>(
+          std::round(
+            static_cast<double>(data) * (LETHAL_OBSTACLE - FREE_SPACE) /
+            (nav2_util::OCC_GRID_OCCUPIED - nav2_util::OCC_GRID_FREE))));
+    }
+  }
 }
 
 void KeepoutFilter::initializeFilter(
@@ -110,6 +125,26 @@ void KeepoutFilter::filterInfoCallback(
 
   mask_topic_ = msg->filter_mask_topic;
 
+  // Prefer mapping the mask from shared memory when its publisher offers it:
+  // all filter-enabled costmaps on this host then share one physical copy
+  if (!msg->filter_mask_shm.empty()) {
+    RCLCPP_INFO(
+      logger_,
+      "KeepoutFilter: Mapping filter mask from \"%s\" shared-memory segment...",
+      msg->filter_mask_shm.c_str());
+    nav_msgs::msg::OccupancyGrid::SharedPtr mask = mapSharedMask(msg->filter_mask_shm);
+    if (mask) {
+      filter_mask_ = mask;
+      mask_costs_.clear();
+      mask_costs_.shrink_to_fit();
+      return;
+    }
+    RCLCPP_WARN(
+      logger_,
+      "KeepoutFilter: Falling back to \"%s\" topic for the filter mask",
+      mask_topic_.c_str());
+  }
+
   // Setting new filter mask subscriber
   RCLCPP_INFO(
     logger_,
@@ -143,7 +178,17 @@ void KeepoutFilter::maskCallback(
   }
 
   // Store filter_mask_
+  releaseSharedMask();
   filter_mask_ = msg;
+  precompileMask();
+}
+
+void KeepoutFilter::precompileMask()
+{
+  mask_costs_.resize(filter_mask_->data.size());
+  for (size_t i = 0; i < mask_costs_.size(); i++) {
+    mask_costs_[i] = cost_lut_[static_cast<unsigned char>(filter_mask_->data[i])];
+  }
 }
 
 void KeepoutFilter::process(
@@ -251,42 +296,101 @@ void KeepoutFilter::process(
 
   unsigned int i, j;  // master_grid iterators
   unsigned int index;  // corresponding index of master_grid
-  double gl_wx, gl_wy;  // world coordinates in a global_frame_
-  double msk_wx, msk_wy;  // world coordinates in a mask_frame
-  unsigned int mx, my;  // filter_mask_ coordinates
   unsigned char data, old_data;  // master_grid element data
 
+  unsigned char * master_array = master_grid.getCharMap();
+  // A topic mask was precompiled into mask_costs_; the cells of a
+  // shared-memory mask stay in the shared segment and go through the LUT
+  const unsigned char * mask_array = mask_costs_.empty() ? nullptr : mask_costs_.data();
+  const int8_t * shared_array = sharedMaskData();
+  const unsigned int mask_size_x = filter_mask_->info.width;
+  const unsigned int mask_size_y = filter_mask_->info.height;
+  const double mask_origin_x = filter_mask_->info.origin.position.x;
+  const double mask_origin_y = filter_mask_->info.origin.position.y;
+  const double mask_resolution = filter_mask_->info.resolution;
+
+  // Applies the mask cost at (mx, my) to the master_grid cell at index
+  const auto update_cell =
+    [&](const unsigned int mx, const unsigned int my, const unsigned int idx) {
+      data = mask_array ? mask_array[my * mask_size_x + mx] :
+        cost_lut_[static_cast<unsigned char>(shared_array[my * mask_size_x + mx])];
+      // Update if mask_ data is valid and greater than existing master_grid's one
+      if (data == NO_INFORMATION) {
+        return;
+      }
+      old_data = master_array[idx];
+      if (data > old_data || old_data == NO_INFORMATION) {
+        master_array[idx] = data;
+      }
+    };
+
   // Main master_grid updating loop
   // Iterate in costmap window by master_grid indexes
-  unsigned char * master_array = master_grid.getCharMap();
-  for (i = mg_min_x_u; i < mg_max_x_u; i++) {
+  if (mask_frame != global_frame_) {
+    // Walk the precomposed master_grid -> mask affine transform
+    // incrementally along rows instead of transforming every cell
+    const double res = master_grid.getResolution();
+    const tf2::Vector3 col_step = tf2_transform.getBasis() * tf2::Vector3(res, 0.0, 0.0);
+    const tf2::Vector3 row_step = tf2_transform.getBasis() * tf2::Vector3(0.0, res, 0.0);
+    double wx0, wy0;  // world coordinates of the window corner in global_frame_
+    master_grid.mapToWorld(mg_min_x_u, mg_min_y_u, wx0, wy0);
+    const tf2::Vector3 base = tf2_transform * tf2::Vector3(wx0, wy0, 0.0);
+
     for (j = mg_min_y_u; j < mg_max_y_u; j++) {
-      index = master_grid.getIndex(i, j);
-      old_data = master_array[index];
-      // Calculating corresponding to (i, j) point at filter_mask_:
-      // Get world coordinates in global_frame_
-      master_grid.mapToWorld(i, j, gl_wx, gl_wy);
-      if (mask_frame != global_frame_) {
-        // Transform (i, j) point from global_frame_ to mask_frame
-        tf2::Vector3 point(gl_wx, gl_wy, 0);
-        point = tf2_transform * point;
-        msk_wx = point.x();
-        msk_wy = point.y();
-      } else {
-        // In this case master_grid and filter-mask are in the same frame
-        msk_wx = gl_wx;
-        msk_wy = gl_wy;
-      }
-      // Get mask coordinates corresponding to (i, j) point at filter_mask_
-      if (worldToMask(filter_mask_, msk_wx, msk_wy, mx, my)) {
-        data = getMaskCost(filter_mask_, mx, my);
-        // Update if mask_ data is valid and greater than existing master_grid's one
-        if (data == NO_INFORMATION) {
+      const double row_wx = base.x() + (j - mg_min_y_u) * row_step.x();
+      const double row_wy = base.y() + (j - mg_min_y_u) * row_step.y();
+      index = master_grid.getIndex(mg_min_x_u, j);
+      for (i = mg_min_x_u; i < mg_max_x_u; i++, index++) {
+        // World coordinates of the (i, j) cell in the mask_frame
+        const double msk_wx = row_wx + (i - mg_min_x_u) * col_step.x();
+        const double msk_wy = row_wy + (i - mg_min_x_u) * col_step.y();
+        if (msk_wx < mask_origin_x || msk_wy < mask_origin_y) {
           continue;
         }
-        if (data > old_data || old_data == NO_INFORMATION) {
-          master_array[index] = data;
+        const unsigned int mx =
+          static_cast<unsigned int>((msk_wx - mask_origin_x) / mask_resolution);
+        const unsigned int my =
+          static_cast<unsigned int>((msk_wy - mask_origin_y) / mask_resolution);
+        if (mx >= mask_size_x || my >= mask_size_y) {
+          continue;
+        }
+        update_cell(mx, my, index);
+      }
+    }
+  } else {
+    // The world-to-mask conversion is separable per axis in the same-frame
+    // case: precompute the column and row index mappings once instead of
+    // performing the two transforms per cell
+    std::vector<int> col_to_mx(mg_max_x_u - mg_min_x_u);
+    std::vector<int> row_to_my(mg_max_y_u - mg_min_y_u);
+    double wx, wy;  // world coordinates
+    for (i = mg_min_x_u; i < mg_max_x_u; i++) {
+      master_grid.mapToWorld(i, mg_min_y_u, wx, wy);
+      const unsigned int mx =
+        wx < mask_origin_x ? mask_size_x :
+        static_cast<unsigned int>((wx - mask_origin_x) / mask_resolution);
+      col_to_mx[i - mg_min_x_u] = mx < mask_size_x ? static_cast<int>(mx) : -1;
+    }
+    for (j = mg_min_y_u; j < mg_max_y_u; j++) {
+      master_grid.mapToWorld(mg_min_x_u, j, wx, wy);
+      const unsigned int my =
+        wy < mask_origin_y ? mask_size_y :
+        static_cast<unsigned int>((wy - mask_origin_y) / mask_resolution);
+      row_to_my[j - mg_min_y_u] = my < mask_size_y ? static_cast<int>(my) : -1;
+    }
+
+    for (j = mg_min_y_u; j < mg_max_y_u; j++) {
+      const int my = row_to_my[j - mg_min_y_u];
+      if (my < 0) {
+        continue;
+      }
+      index = master_grid.getIndex(mg_min_x_u, j);
+      for (i = mg_min_x_u; i < mg_max_x_u; i++, index++) {
+        const int mx = col_to_mx[i - mg_min_x_u];
+        if (mx < 0) {
+          continue;
         }
+        update_cell(mx, my, index);
       }
     }
   }
@@ -37,6 +37,7 @@
 
 #include "nav2_costmap_2d/costmap_filters/speed_filter.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
 #include <memory>
@@ -50,7 +51,8 @@ namespace nav2_costmap_2d
 SpeedFilter::SpeedFilter()
 : filter_info_sub_(nullptr), mask_sub_(nullptr),
   speed_limit_pub_(nullptr), filter_mask_(nullptr), global_frame_(""),
-  speed_limit_(NO_SPEED_LIMIT), speed_limit_prev_(NO_SPEED_LIMIT)
+  speed_limit_(NO_SPEED_LIMIT), speed_limit_prev_(NO_SPEED_LIMIT),
+  cache_valid_(false), cached_pose_x_(0.0), cached_pose_y_(0.0), cache_slack_(0.0)
 {
 }
 
@@ -139,8 +141,29 @@ void SpeedFilter::filterInfoCallback(
     return;
   }
 
+  // base_/multiplier_ changed: the cached limit no longer applies
+  cache_valid_ = false;
+
   mask_topic_ = msg->filter_mask_topic;
 
+  // Prefer mapping the mask from shared memory when its publisher offers it:
+  // all filter-enabled costmaps on this host then share one physical copy
+  if (!msg->filter_mask_shm.empty()) {
+    RCLCPP_INFO(
+      logger_,
+      "SpeedFilter: Mapping filter mask from \"%s\" shared-memory segment...",
+      msg->filter_mask_shm.c_str());
+    nav_msgs::msg::OccupancyGrid::SharedPtr mask = mapSharedMask(msg->filter_mask_shm);
+    if (mask) {
+      filter_mask_ = mask;
+      return;
+    }
+    RCLCPP_WARN(
+      logger_,
+      "SpeedFilter: Falling back to \"%s\" topic for the filter mask",
+      mask_topic_.c_str());
+  }
+
   // Setting new filter mask subscriber
   RCLCPP_INFO(
     logger_,
@@ -168,7 +191,9 @@ void SpeedFilter::maskCallback(
     filter_mask_.reset();
   }
 
+  releaseSharedMask();
   filter_mask_ = msg;
+  cache_valid_ = false;
 }
 
 void SpeedFilter::process(
@@ -186,6 +211,19 @@ void SpeedFilter::process(
     return;
   }
 
+  // While the robot stays within the slack radius of the last evaluation,
+  // the sampled limit cannot have changed: skip the transform chain and
+  // mask lookup entirely. At standstill this removes the filter from the
+  // costmap cycle.
+  if (cache_valid_) {
+    const double dx = pose.x - cached_pose_x_;
+    const double dy = pose.y - cached_pose_y_;
+    if (dx * dx + dy * dy < cache_slack_ * cache_slack_) {
+      return;
+    }
+  }
+  cache_valid_ = false;
+
   geometry_msgs::msg::Pose2D mask_pose;  // robot coordinates in mask frame
 
   // Transforming robot pose from current layer frame to mask frame
@@ -239,6 +277,45 @@ void SpeedFilter::process(
     }
   }
 
+  // Cache this evaluation with the movement radius within which it stays
+  // valid: the distance to the nearest boundary of the containing mask
+  // cell, extended by a full cell when the 3x3 neighborhood shares the
+  // same mask value (hysteresis for robots dithering on a cell edge).
+  // Movement is measured in the layer frame, which is rigid with respect
+  // to the mask frame between transform samples.
+  const double resolution = filter_mask_->info.resolution;
+  const double cell_min_x =
+    filter_mask_->info.origin.position.x + mask_robot_i * resolution;
+  const double cell_min_y =
+    filter_mask_->info.origin.position.y + mask_robot_j * resolution;
+  double slack = std::min(
+    std::min(mask_pose.x - cell_min_x, cell_min_x + resolution - mask_pose.x),
+    std::min(mask_pose.y - cell_min_y, cell_min_y + resolution - mask_pose.y));
+
+  bool uniform_neighborhood = true;
+  for (int dj = -1; dj <= 1 && uniform_neighborhood; ++dj) {
+    for (int di = -1; di <= 1; ++di) {
+      const int ni = static_cast<int>(mask_robot_i) + di;
+      const int nj = static_cast<int>(mask_robot_j) + dj;
+      if (ni < 0 || nj < 0 ||
+        ni >= static_cast<int>(filter_mask_->info.width) ||
+        nj >= static_cast<int>(filter_mask_->info.height) ||
+        getMaskData(filter_mask_, ni, nj) != speed_mask_data)
+      {
+        uniform_neighborhood = false;
+        break;
+      }
+    }
+  }
+  if (uniform_neighborhood) {
+    slack += resolution;
+  }
+
+  cached_pose_x_ = pose.x;
+  cached_pose_y_ = pose.y;
+  cache_slack_ = slack;
+  cache_valid_ = slack > 0.0;
+
   if (speed_limit_ != speed_limit_prev_) {
     if (speed_limit_ != NO_SPEED_LIMIT) {
       RCLCPP_DEBUG(logger_, "SpeedFilter: Speed limit is set to %f", speed_limit_);
@@ -265,6 +342,7 @@ void SpeedFilter::resetFilter()
 
   filter_info_sub_.reset();
   mask_sub_.reset();
+  cache_valid_ = false;
   if (speed_limit_pub_) {
     speed_limit_pub_->on_deactivate();
     speed_limit_pub_.reset();
@@ -19,6 +19,10 @@
 #include <algorithm>
 #include <memory>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "rclcpp/rclcpp.hpp"
 
 namespace nav2_costmap_2d
@@ -151,11 +155,105 @@ DenoiseLayer::denoise(Image<uint8_t> & image) const
 void
 DenoiseLayer::removeGroups(Image<uint8_t> & image) const
 {
-  groups_remover_.removeGroups(
-    image, buffer_, group_connectivity_type_, minimal_group_size_,
+  removeGroupsRunBased(
+    image, group_connectivity_type_, minimal_group_size_,
     [this](uint8_t pixel) {return isBackground(pixel);});
 }
 
+namespace
+{
+
+/**
+ * @brief Max over the 4 or 8-connected neighbors of every pixel of image
+ *
+ * Pixels outside the image borders are interpreted as FREE_SPACE. If
+ * remap_no_information is set, NO_INFORMATION input pixels are interpreted
+ * as FREE_SPACE as well (so a simple max still detects obstacles nearby).
+ * Row interiors are processed 16 pixels at a time when SSE2 is available;
+ * borders and the tail always go through the scalar path.
+ */
+void maxNeighbors(
+  const Image<uint8_t> & image, Image<uint8_t> & out,
+  ConnectivityType connectivity, bool remap_no_information)
+{
+  const size_t rows = image.rows();
+  const size_t columns = image.columns();
+  const bool eight = connectivity == ConnectivityType::Way8;
+
+  auto remap = [remap_no_information](uint8_t v) -> uint8_t {
+      return (remap_no_information && v == NO_INFORMATION) ? FREE_SPACE : v;
+    };
+
+  for (size_t j = 0; j < rows; ++j) {
+    const uint8_t * up = j > 0 ? image.row(j - 1) : nullptr;
+    const uint8_t * mid = image.row(j);
+    const uint8_t * down = j + 1 < rows ? image.row(j + 1) : nullptr;
+    uint8_t * dst = out.row(j);
+
+    auto scalar = [&](size_t i) {
+        uint8_t m = FREE_SPACE;
+        auto probe_row = [&](const uint8_t * row, bool take_center) {
+            if (!row) {
+              return;
+            }
+            if (take_center) {
+              m = std::max(m, remap(row[i]));
+            }
+            if (eight || !take_center) {
+              // the center row always contributes its side neighbors; the
+              // rows above and below do so only for 8-way connectivity
+              if (i > 0) {
+                m = std::max(m, remap(row[i - 1]));
+              }
+              if (i + 1 < columns) {
+                m = std::max(m, remap(row[i + 1]));
+              }
+            }
+          };
+        probe_row(up, true);
+        probe_row(mid, false);
+        probe_row(down, true);
+        dst[i] = m;
+      };
+
+    scalar(0);
+    size_t i = 1;
+#if defined(__SSE2__)
+    if (columns > 17) {
+      const __m128i no_info = _mm_set1_epi8(static_cast<char>(NO_INFORMATION));
+      auto load = [&](const uint8_t * p) {
+          __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+          if (remap_no_information) {
+            v = _mm_andnot_si128(_mm_cmpeq_epi8(v, no_info), v);
+          }
+          return v;
+        };
+      for (; i + 17 <= columns; i += 16) {
+        __m128i m = _mm_max_epu8(load(mid + i - 1), load(mid + i + 1));
+        if (up) {
+          m = _mm_max_epu8(m, load(up + i));
+          if (eight) {
+            m = _mm_max_epu8(m, _mm_max_epu8(load(up + i - 1), load(up + i + 1)));
+          }
+        }
+        if (down) {
+          m = _mm_max_epu8(m, load(down + i));
+          if (eight) {
+            m = _mm_max_epu8(m, _mm_max_epu8(load(down + i - 1), load(down + i + 1)));
+          }
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), m);
+      }
+    }
+#endif
+    for (; i < columns; ++i) {
+      scalar(i);
+    }
+  }
+}
+
+}  // namespace
+
 void
 DenoiseLayer::removeSinglePixels(Image<uint8_t> & image) const
 {
@@ -166,25 +264,7 @@ DenoiseLayer::removeSinglePixels(Image<uint8_t> & image) const
 
   // If NO_INFORMATION (=255) isn't obstacle, we can't use a simple max() to check
   // any obstacle nearby. In this case, we interpret NO_INFORMATION as an empty space.
-  if (!no_information_is_obstacle_) {
-    auto replace_to_free = [](uint8_t v) {
-        return v == NO_INFORMATION ? FREE_SPACE : v;
-      };
-    auto max = [&](const std::initializer_list<uint8_t> lst) {
-        std::array<uint8_t, 3> rbuf = {
-          replace_to_free(*lst.begin()),
-          replace_to_free(*(lst.begin() + 1)),
-          replace_to_free(*(lst.begin() + 2))
-        };
-        return *std::max_element(rbuf.begin(), rbuf.end());
-      };
-    dilate(image, max_neighbors_image, group_connectivity_type_, max);
-  } else {
-    auto max = [](const std::initializer_list<uint8_t> lst) {
-        return std::max(lst);
-      };
-    dilate(image, max_neighbors_image, group_connectivity_type_, max);
-  }
+  maxNeighbors(image, max_neighbors_image, group_connectivity_type_, !no_information_is_obstacle_);
 
   max_neighbors_image.convert(
     image, [this](uint8_t maxNeighbor, uint8_t & img) {
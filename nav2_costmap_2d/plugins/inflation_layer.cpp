@@ -37,12 +37,20 @@
  *********************************************************************/
 #include "nav2_costmap_2d/inflation_layer.hpp"
 
+#include <cstdlib>
 #include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
 #include <vector>
 #include <algorithm>
 #include <utility>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "nav2_costmap_2d/costmap_math.hpp"
 #include "nav2_costmap_2d/footprint.hpp"
 #include "pluginlib/class_list_macros.hpp"
@@ -58,15 +66,29 @@ using rcl_interfaces::msg::ParameterType;
 namespace nav2_costmap_2d
 {
 
+// Process-wide cache of inflation lookup tables. Several costmaps in one
+// process (global, local, collision checking) typically run with identical
+// inflation parameters, so their layers share one immutable set of tables.
+// Entries are weak: a table set is freed once its last user is gone.
+using InflationTablesKey = std::tuple<double, double, double, double>;
+static std::mutex g_inflation_tables_mutex;
+static std::map<InflationTablesKey,
+  std::weak_ptr<const InflationTables>> g_inflation_tables;
+
 InflationLayer::InflationLayer()
 : inflation_radius_(0),
   inscribed_radius_(0),
   cost_scaling_factor_(0),
   inflate_unknown_(false),
   inflate_around_unknown_(false),
+  vectorized_inflation_(false),
+  incremental_inflation_(false),
   cell_inflation_radius_(0),
-  cached_cell_inflation_radius_(0),
   resolution_(0),
+  kernel_size_(0),
+  overlay_valid_(false),
+  overlay_origin_x_(0),
+  overlay_origin_y_(0),
   cache_length_(0),
   last_min_x_(std::numeric_limits<double>::lowest()),
   last_min_y_(std::numeric_limits<double>::lowest()),
@@ -78,6 +100,14 @@ InflationLayer::InflationLayer()
 
 InflationLayer::~InflationLayer()
 {
+  if (table_worker_.joinable()) {
+    {
+      std::lock_guard<std::mutex> guard(table_worker_mutex_);
+      table_worker_shutdown_ = true;
+    }
+    table_worker_cv_.notify_all();
+    table_worker_.join();
+  }
   auto node = node_.lock();
   if (dyn_params_handler_ && node) {
     node->remove_on_set_parameters_callback(dyn_params_handler_.get());
@@ -94,6 +124,8 @@ InflationLayer::onInitialize()
   declareParameter("cost_scaling_factor", rclcpp::ParameterValue(10.0));
   declareParameter("inflate_unknown", rclcpp::ParameterValue(false));
   declareParameter("inflate_around_unknown", rclcpp::ParameterValue(false));
+  declareParameter("vectorized_inflation", rclcpp::ParameterValue(false));
+  declareParameter("incremental_inflation", rclcpp::ParameterValue(false));
 
   {
     auto node = node_.lock();
@@ -105,6 +137,8 @@ InflationLayer::onInitialize()
     node->get_parameter(name_ + "." + "cost_scaling_factor", cost_scaling_factor_);
     node->get_parameter(name_ + "." + "inflate_unknown", inflate_unknown_);
     node->get_parameter(name_ + "." + "inflate_around_unknown", inflate_around_unknown_);
+    node->get_parameter(name_ + "." + "vectorized_inflation", vectorized_inflation_);
+    node->get_parameter(name_ + "." + "incremental_inflation", incremental_inflation_);
 
     dyn_params_handler_ = node->add_on_set_parameters_callback(
       std::bind(
@@ -114,8 +148,8 @@ InflationLayer::onInitialize()
 
   current_ = true;
   seen_.clear();
-  cached_distances_.clear();
-  cached_costs_.clear();
+  tables_.reset();
+  footprint_tables_built_ = false;
   need_reinflation_ = false;
   cell_inflation_radius_ = cellDistance(inflation_radius_);
   matchSize();
@@ -138,6 +172,7 @@ InflationLayer::updateBounds(
   double * min_y, double * max_x, double * max_y)
 {
   std::lock_guard<Costmap2D::mutex_t> guard(*getMutex());
+  adoptFreshTables();
   if (need_reinflation_) {
     last_min_x_ = *min_x;
     last_min_y_ = *min_y;
@@ -171,8 +206,19 @@ InflationLayer::onFootprintChanged()
   std::lock_guard<Costmap2D::mutex_t> guard(*getMutex());
   inscribed_radius_ = layered_costmap_->getInscribedRadius();
   cell_inflation_radius_ = cellDistance(inflation_radius_);
-  computeCaches();
-  need_reinflation_ = true;
+
+  if (!footprint_tables_built_) {
+    // the very first footprint is built in place, the startup tables were
+    // computed before any footprint was known
+    computeCaches();
+    need_reinflation_ = true;
+    footprint_tables_built_ = true;
+  } else {
+    // later changes (e.g. padding adjustments while carrying a load) are
+    // rebuilt on the worker and swapped in at the start of a cycle, so
+    // updateMap() is never stalled behind the rebuild
+    requestTableRebuild();
+  }
 
   if (inflation_radius_ < inscribed_radius_) {
     RCLCPP_ERROR(
@@ -208,17 +254,13 @@ InflationLayer::updateCosts(
       !dist.empty(), "The inflation list must be empty at the beginning of inflation");
   }
 
+  // All bins released their arena storage at the end of the previous cycle,
+  // so the arena can be rewound and its blocks reused without a heap trip
+  cell_arena_.reset();
+
   unsigned char * master_array = master_grid.getCharMap();
   unsigned int size_x = master_grid.getSizeInCellsX(), size_y = master_grid.getSizeInCellsY();
 
-  if (seen_.size() != size_x * size_y) {
-    RCLCPP_WARN(
-      logger_, "InflationLayer::updateCosts(): seen_ vector size is wrong");
-    seen_ = std::vector<bool>(size_x * size_y, false);
-  }
-
-  std::fill(begin(seen_), end(seen_), false);
-
   // We need to include in the inflation cells outside the bounding
   // box min_i...max_j, by the amount cell_inflation_radius_.  Cells
   // up to that distance outside the box can still influence the costs
@@ -237,6 +279,30 @@ InflationLayer::updateCosts(
   max_i = std::min(static_cast<int>(size_x), max_i);
   max_j = std::min(static_cast<int>(size_y), max_j);
 
+  if (incremental_inflation_ && tables_) {
+    updateCostsIncremental(
+      master_grid, min_i, min_j, max_i, max_j,
+      base_min_i, base_min_j, base_max_i, base_max_j);
+    current_ = true;
+    return;
+  }
+
+  if (vectorized_inflation_ && tables_) {
+    updateCostsVectorized(
+      master_grid, min_i, min_j, max_i, max_j,
+      base_min_i, base_min_j, base_max_i, base_max_j);
+    current_ = true;
+    return;
+  }
+
+  if (seen_.size() != size_x * size_y) {
+    RCLCPP_WARN(
+      logger_, "InflationLayer::updateCosts(): seen_ vector size is wrong");
+    seen_ = std::vector<bool>(size_x * size_y, false);
+  }
+
+  std::fill(begin(seen_), end(seen_), false);
+
   // Inflation list; we append cells to visit in a list associated with
   // its distance to the nearest obstacle
   // We use a map<distance, list> to emulate the priority queue used before,
@@ -312,14 +378,216 @@ InflationLayer::updateCosts(
         enqueue(index + size_x, mx, my + 1, sx, sy);
       }
     }
-    // This level of inflation_cells_ is not needed anymore. We can free the memory
-    // Note that dist_bin.clear() is not enough, because it won't free the memory
-    dist_bin = std::vector<CellData>();
+    // This level of inflation_cells_ is not needed anymore. Swap in an empty
+    // vector so the bin drops its arena storage (clear() would keep stale
+    // pointers into memory the arena reclaims at the next reset)
+    CellDataVector(dist_bin.get_allocator()).swap(dist_bin);
   }
 
   current_ = true;
 }
 
+void
+InflationLayer::rowMax(unsigned char * dst, const unsigned char * src, int n)
+{
+  int i = 0;
+#if defined(__SSE2__)
+  for (; i + 16 <= n; i += 16) {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_max_epu8(a, b));
+  }
+#endif
+  for (; i < n; ++i) {
+    dst[i] = std::max(dst[i], src[i]);
+  }
+}
+
+void
+InflationLayer::updateCostsVectorized(
+  nav2_costmap_2d::Costmap2D & master_grid,
+  int min_i, int min_j, int max_i, int max_j,
+  int base_min_i, int base_min_j, int base_max_i, int base_max_j)
+{
+  const int r = static_cast<int>(cell_inflation_radius_);
+  const int k = static_cast<int>(kernel_size_);
+  const int win_w = base_max_i - base_min_i;
+  const int win_h = base_max_j - base_min_j;
+  if (win_w <= 0 || win_h <= 0) {
+    return;
+  }
+
+  unsigned char * master_array = master_grid.getCharMap();
+  const unsigned int size_x = master_grid.getSizeInCellsX();
+
+  // Accumulate inflated costs into a scratch window so the unknown-space
+  // combination rules can be applied in a single pass at the end. The cost at
+  // a cell is the max over all obstacle sources of the cached kernel cost,
+  // which equals the cost of the nearest source since costs fall off with
+  // distance.
+  inflation_window_.assign(static_cast<size_t>(win_w) * win_h, 0);
+
+  for (int j = min_j; j < max_j; j++) {
+    const unsigned char * row = master_array + static_cast<size_t>(j) * size_x;
+    for (int i = min_i; i < max_i; i++) {
+      const unsigned char cost = row[i];
+      if (cost == LETHAL_OBSTACLE || (inflate_around_unknown_ && cost == NO_INFORMATION)) {
+        const int y0 = std::max(j - r, base_min_j);
+        const int y1 = std::min(j + r, base_max_j - 1);
+        const int x0 = std::max(i - r, base_min_i);
+        const int x1 = std::min(i + r, base_max_i - 1);
+        for (int y = y0; y <= y1; ++y) {
+          const unsigned char * krow = &tables_->kernel[(y - j + r) * k + (x0 - i + r)];
+          unsigned char * wrow =
+            &inflation_window_[static_cast<size_t>(y - base_min_j) * win_w + (x0 - base_min_i)];
+          rowMax(wrow, krow, x1 - x0 + 1);
+        }
+      }
+    }
+  }
+
+  for (int j = base_min_j; j < base_max_j; ++j) {
+    const unsigned char * wrow = &inflation_window_[static_cast<size_t>(j - base_min_j) * win_w];
+    unsigned char * mrow = master_array + static_cast<size_t>(j) * size_x + base_min_i;
+    for (int i = 0; i < win_w; ++i) {
+      const unsigned char cost = wrow[i];
+      if (cost == 0) {
+        continue;
+      }
+      const unsigned char old_cost = mrow[i];
+      if (old_cost == NO_INFORMATION &&
+        (inflate_unknown_ ? (cost > FREE_SPACE) : (cost >= INSCRIBED_INFLATED_OBSTACLE)))
+      {
+        mrow[i] = cost;
+      } else {
+        mrow[i] = std::max(old_cost, cost);
+      }
+    }
+  }
+}
+
+void
+InflationLayer::stampKernel(int i, int j, int size_x, int size_y)
+{
+  const int r = static_cast<int>(cell_inflation_radius_);
+  const int k = static_cast<int>(kernel_size_);
+  const int y0 = std::max(j - r, 0);
+  const int y1 = std::min(j + r, size_y - 1);
+  const int x0 = std::max(i - r, 0);
+  const int x1 = std::min(i + r, size_x - 1);
+  for (int y = y0; y <= y1; ++y) {
+    rowMax(
+      &overlay_[static_cast<size_t>(y) * size_x + x0],
+      &tables_->kernel[(y - j + r) * k + (x0 - i + r)],
+      x1 - x0 + 1);
+  }
+}
+
+void
+InflationLayer::updateCostsIncremental(
+  nav2_costmap_2d::Costmap2D & master_grid,
+  int min_i, int min_j, int max_i, int max_j,
+  int base_min_i, int base_min_j, int base_max_i, int base_max_j)
+{
+  const int r = static_cast<int>(cell_inflation_radius_);
+  unsigned char * master_array = master_grid.getCharMap();
+  const int size_x = static_cast<int>(master_grid.getSizeInCellsX());
+  const int size_y = static_cast<int>(master_grid.getSizeInCellsY());
+
+  // A resize or an origin shift (rolling window) invalidates the cell
+  // indexing of the overlay, fall back to rebuilding it from this window.
+  // Incremental mode pays off on static-origin (e.g. global) costmaps.
+  if (!overlay_valid_ ||
+    overlay_.size() != static_cast<size_t>(size_x) * size_y ||
+    master_grid.getOriginX() != overlay_origin_x_ ||
+    master_grid.getOriginY() != overlay_origin_y_)
+  {
+    overlay_.assign(static_cast<size_t>(size_x) * size_y, 0);
+    source_bitmap_.assign(static_cast<size_t>(size_x) * size_y, 0);
+    overlay_origin_x_ = master_grid.getOriginX();
+    overlay_origin_y_ = master_grid.getOriginY();
+    overlay_valid_ = true;
+  }
+
+  // Diff the source cells (lethal, and unknown if inflating around unknown)
+  // in the expanded window against the state the overlay was built from
+  std::vector<std::pair<int, int>> added, removed;
+  for (int j = min_j; j < max_j; j++) {
+    const unsigned char * row = master_array + static_cast<size_t>(j) * size_x;
+    unsigned char * src_row = &source_bitmap_[static_cast<size_t>(j) * size_x];
+    for (int i = min_i; i < max_i; i++) {
+      const unsigned char cost = row[i];
+      const unsigned char is_source =
+        (cost == LETHAL_OBSTACLE || (inflate_around_unknown_ && cost == NO_INFORMATION)) ? 1 : 0;
+      if (is_source != src_row[i]) {
+        src_row[i] = is_source;
+        if (is_source) {
+          added.emplace_back(i, j);
+        } else {
+          removed.emplace_back(i, j);
+        }
+      }
+    }
+  }
+
+  if (!removed.empty()) {
+    // Every cell a removed source influenced lies within r of it: zero the
+    // overlay over the expanded bounding box of the removals and re-stamp it
+    // from the remaining sources in reach of that box
+    int rx0 = size_x, rx1 = -1, ry0 = size_y, ry1 = -1;
+    for (const auto & cell : removed) {
+      rx0 = std::min(rx0, cell.first);
+      rx1 = std::max(rx1, cell.first);
+      ry0 = std::min(ry0, cell.second);
+      ry1 = std::max(ry1, cell.second);
+    }
+    rx0 = std::max(rx0 - r, 0);
+    ry0 = std::max(ry0 - r, 0);
+    rx1 = std::min(rx1 + r, size_x - 1);
+    ry1 = std::min(ry1 + r, size_y - 1);
+    for (int y = ry0; y <= ry1; ++y) {
+      std::fill_n(&overlay_[static_cast<size_t>(y) * size_x + rx0], rx1 - rx0 + 1, 0);
+    }
+
+    const int sx0 = std::max(rx0 - r, 0);
+    const int sy0 = std::max(ry0 - r, 0);
+    const int sx1 = std::min(rx1 + r, size_x - 1);
+    const int sy1 = std::min(ry1 + r, size_y - 1);
+    for (int y = sy0; y <= sy1; ++y) {
+      const unsigned char * src_row = &source_bitmap_[static_cast<size_t>(y) * size_x];
+      for (int x = sx0; x <= sx1; ++x) {
+        if (src_row[x]) {
+          stampKernel(x, y, size_x, size_y);
+        }
+      }
+    }
+  }
+
+  for (const auto & cell : added) {
+    stampKernel(cell.first, cell.second, size_x, size_y);
+  }
+
+  // Merge the overlay into the freshly combined master window
+  for (int j = base_min_j; j < base_max_j; ++j) {
+    const unsigned char * orow = &overlay_[static_cast<size_t>(j) * size_x + base_min_i];
+    unsigned char * mrow = master_array + static_cast<size_t>(j) * size_x + base_min_i;
+    for (int i = 0; i < base_max_i - base_min_i; ++i) {
+      const unsigned char cost = orow[i];
+      if (cost == 0) {
+        continue;
+      }
+      const unsigned char old_cost = mrow[i];
+      if (old_cost == NO_INFORMATION &&
+        (inflate_unknown_ ? (cost > FREE_SPACE) : (cost >= INSCRIBED_INFLATED_OBSTACLE)))
+      {
+        mrow[i] = cost;
+      } else {
+        mrow[i] = std::max(old_cost, cost);
+      }
+    }
+  }
+}
+
 /**
  * @brief  Given an index of a cell in the costmap, place it into a list pending for obstacle inflation
  * @param  grid The costmap
@@ -362,30 +630,181 @@ InflationLayer::computeCaches()
   }
 
   cache_length_ = cell_inflation_radius_ + 2;
+  kernel_size_ = 2 * cell_inflation_radius_ + 1;
+
+  tables_params_ = currentTableParams();
+  tables_ = lookupOrBuildTables(tables_params_);
+
+  int max_dist = generateIntegerDistances();
+  inflation_cells_.clear();
+  inflation_cells_.resize(max_dist + 1, CellDataVector(ArenaAllocator<CellData>(&cell_arena_)));
+
+  // The overlay was stamped with the previous kernel, rebuild it lazily
+  overlay_valid_ = false;
+}
+
+InflationTableParams
+InflationLayer::currentTableParams() const
+{
+  InflationTableParams params;
+  params.resolution = resolution_;
+  params.inflation_radius = inflation_radius_;
+  params.cost_scaling_factor = cost_scaling_factor_;
+  params.inscribed_radius = inscribed_radius_;
+  params.cell_inflation_radius = cell_inflation_radius_;
+  params.cache_length = cache_length_;
+  params.kernel_size = kernel_size_;
+  return params;
+}
+
+std::shared_ptr<const InflationTables>
+InflationLayer::lookupOrBuildTables(const InflationTableParams & params)
+{
+  // Layers with identical parameters produce identical tables, so look them
+  // up in the process-wide cache before computing them from scratch
+  const InflationTablesKey key(
+    params.resolution, params.inflation_radius, params.cost_scaling_factor,
+    params.inscribed_radius);
+  std::lock_guard<std::mutex> cache_guard(g_inflation_tables_mutex);
+  auto it = g_inflation_tables.find(key);
+  auto tables = it != g_inflation_tables.end() ? it->second.lock() : nullptr;
+  if (!tables) {
+    tables = buildTables(params);
+    g_inflation_tables[key] = tables;
+  }
+  // Drop entries whose last user is gone
+  for (auto entry = g_inflation_tables.begin(); entry != g_inflation_tables.end(); ) {
+    entry = entry->second.expired() ? g_inflation_tables.erase(entry) : std::next(entry);
+  }
+  return tables;
+}
+
+std::shared_ptr<const InflationTables>
+InflationLayer::buildTables(const InflationTableParams & params)
+{
+  auto tables = std::make_shared<InflationTables>();
+  const unsigned int cache_length = params.cache_length;
+  const unsigned int kernel_size = params.kernel_size;
 
   // based on the inflation radius... compute distance and cost caches
-  if (cell_inflation_radius_ != cached_cell_inflation_radius_) {
-    cached_costs_.resize(cache_length_ * cache_length_);
-    cached_distances_.resize(cache_length_ * cache_length_);
+  tables->distances.resize(cache_length * cache_length);
+  tables->costs.resize(cache_length * cache_length);
+  for (unsigned int i = 0; i < cache_length; ++i) {
+    for (unsigned int j = 0; j < cache_length; ++j) {
+      tables->distances[i * cache_length + j] = hypot(i, j);
+      tables->costs[i * cache_length + j] =
+        computeCost(tables->distances[i * cache_length + j], params);
+    }
+  }
 
-    for (unsigned int i = 0; i < cache_length_; ++i) {
-      for (unsigned int j = 0; j < cache_length_; ++j) {
-        cached_distances_[i * cache_length_ + j] = hypot(i, j);
+  // Mirror the quarter-plane cost cache into a full dense kernel for the
+  // vectorized row-sweep path, zeroed outside of the inflation radius
+  const int r = static_cast<int>(params.cell_inflation_radius);
+  tables->kernel.assign(static_cast<size_t>(kernel_size) * kernel_size, 0);
+  for (int dy = -r; dy <= r; ++dy) {
+    for (int dx = -r; dx <= r; ++dx) {
+      const unsigned int adx = std::abs(dx);
+      const unsigned int ady = std::abs(dy);
+      if (tables->distances[adx * cache_length + ady] <= params.cell_inflation_radius) {
+        tables->kernel[(dy + r) * kernel_size + (dx + r)] =
+          tables->costs[adx * cache_length + ady];
       }
     }
+  }
+
+  return tables;
+}
 
-    cached_cell_inflation_radius_ = cell_inflation_radius_;
+void
+InflationLayer::requestTableRebuild()
+{
+  if (cell_inflation_radius_ == 0) {
+    return;
+  }
+
+  if (cell_inflation_radius_ != tables_params_.cell_inflation_radius) {
+    // the table geometry itself changed, the old tables cannot keep serving
+    // lookups in the meantime so this rebuild cannot be deferred
+    computeCaches();
+    need_reinflation_ = true;
+    return;
   }
 
-  for (unsigned int i = 0; i < cache_length_; ++i) {
-    for (unsigned int j = 0; j < cache_length_; ++j) {
-      cached_costs_[i * cache_length_ + j] = computeCost(cached_distances_[i * cache_length_ + j]);
+  const InflationTableParams params = currentTableParams();
+  if (params == tables_params_) {
+    // the footprint change round-tripped to the tables already in service
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(table_worker_mutex_);
+    table_rebuild_params_ = params;
+    table_rebuild_pending_ = true;
+    fresh_tables_.reset();
+    if (!table_worker_.joinable()) {
+      table_worker_ = std::thread(&InflationLayer::tableWorkerLoop, this);
     }
   }
+  table_worker_cv_.notify_one();
+}
 
-  int max_dist = generateIntegerDistances();
-  inflation_cells_.clear();
-  inflation_cells_.resize(max_dist + 1);
+void
+InflationLayer::tableWorkerLoop()
+{
+  while (true) {
+    InflationTableParams params;
+    {
+      std::unique_lock<std::mutex> guard(table_worker_mutex_);
+      table_worker_cv_.wait(
+        guard, [this] {return table_worker_shutdown_ || table_rebuild_pending_;});
+      if (table_worker_shutdown_) {
+        return;
+      }
+      params = table_rebuild_params_;
+      table_rebuild_pending_ = false;
+    }
+
+    // the build - the expensive part - happens without any lock the
+    // costmap thread might be waiting on
+    auto tables = lookupOrBuildTables(params);
+
+    {
+      std::lock_guard<std::mutex> guard(table_worker_mutex_);
+      // a request that arrived during the build supersedes this result
+      if (!table_rebuild_pending_) {
+        fresh_tables_ = std::move(tables);
+        fresh_tables_params_ = params;
+      }
+    }
+  }
+}
+
+void
+InflationLayer::adoptFreshTables()
+{
+  std::shared_ptr<const InflationTables> tables;
+  InflationTableParams params;
+  {
+    std::lock_guard<std::mutex> guard(table_worker_mutex_);
+    if (!fresh_tables_) {
+      return;
+    }
+    tables = std::move(fresh_tables_);
+    params = fresh_tables_params_;
+    fresh_tables_.reset();
+  }
+
+  // a synchronous recompute (parameter or size change) may have landed
+  // since the rebuild was requested, in which case this result is stale
+  if (!(params == currentTableParams())) {
+    return;
+  }
+
+  tables_ = std::move(tables);
+  tables_params_ = params;
+  need_reinflation_ = true;
+  // the overlay still reflects the old kernel
+  overlay_valid_ = false;
 }
 
 int
@@ -474,6 +893,17 @@ InflationLayer::dynamicParametersCallback(
       {
         inflate_around_unknown_ = parameter.as_bool();
         need_reinflation_ = true;
+      } else if (param_name == name_ + "." + "vectorized_inflation" && // NOLINT
+        vectorized_inflation_ != parameter.as_bool())
+      {
+        vectorized_inflation_ = parameter.as_bool();
+        need_reinflation_ = true;
+      } else if (param_name == name_ + "." + "incremental_inflation" && // NOLINT
+        incremental_inflation_ != parameter.as_bool())
+      {
+        incremental_inflation_ = parameter.as_bool();
+        overlay_valid_ = false;
+        need_reinflation_ = true;
       }
     }
   }
@@ -46,6 +46,7 @@
 #include "pluginlib/class_list_macros.hpp"
 #include "sensor_msgs/point_cloud2_iterator.hpp"
 #include "nav2_costmap_2d/costmap_math.hpp"
+#include "nav2_costmap_2d/observation_spatial_index.hpp"
 
 PLUGINLIB_EXPORT_CLASS(nav2_costmap_2d::ObstacleLayer, nav2_costmap_2d::Layer)
 
@@ -85,6 +86,9 @@ void ObstacleLayer::onInitialize()
   declareParameter("min_obstacle_height", rclcpp::ParameterValue(0.0));
   declareParameter("max_obstacle_height", rclcpp::ParameterValue(2.0));
   declareParameter("combination_method", rclcpp::ParameterValue(1));
+  declareParameter("async_transform_processing", rclcpp::ParameterValue(false));
+  declareParameter("track_persistence_time", rclcpp::ParameterValue(0.0));
+  declareParameter("track_min_observations", rclcpp::ParameterValue(3));
   declareParameter("observation_sources", rclcpp::ParameterValue(std::string("")));
 
   auto node = node_.lock();
@@ -96,6 +100,9 @@ void ObstacleLayer::onInitialize()
   node->get_parameter(name_ + "." + "footprint_clearing_enabled", footprint_clearing_enabled_);
   node->get_parameter(name_ + "." + "min_obstacle_height", min_obstacle_height_);
   node->get_parameter(name_ + "." + "max_obstacle_height", max_obstacle_height_);
+  node->get_parameter(name_ + "." + "async_transform_processing", async_transform_processing_);
+  node->get_parameter(name_ + "." + "track_persistence_time", track_persistence_time_);
+  node->get_parameter(name_ + "." + "track_min_observations", track_min_observations_);
   node->get_parameter("track_unknown_space", track_unknown_space);
   node->get_parameter("transform_tolerance", transform_tolerance);
   node->get_parameter(name_ + "." + "observation_sources", topics_string);
@@ -126,6 +133,12 @@ void ObstacleLayer::onInitialize()
   current_ = true;
   was_reset_ = false;
 
+  if (track_persistence_time_ > 0.0) {
+    track_store_ = std::make_unique<ObstacleTrackStore>(
+      resolution_, track_persistence_time_,
+      static_cast<unsigned int>(std::max(1, track_min_observations_)));
+  }
+
   global_frame_ = layered_costmap_->getGlobalFrameID();
 
   auto sub_opt = rclcpp::SubscriptionOptions();
@@ -208,6 +221,10 @@ void ObstacleLayer::onInitialize()
           global_frame_,
           sensor_frame, tf2::durationFromSec(transform_tolerance))));
 
+    if (async_transform_processing_) {
+      observation_buffers_.back()->enableAsyncTransform();
+    }
+
     // check if we'll add this buffer to our marking observation buffers
     if (marking) {
       marking_buffers_.push_back(observation_buffers_.back());
@@ -358,6 +375,13 @@ ObstacleLayer::laserScanCallback(
     return;
   }
 
+  // hand the cloud to the buffer worker so TF waits stay off this thread
+  if (async_transform_processing_) {
+    buffer->bufferCloudAsync(
+      std::make_shared<sensor_msgs::msg::PointCloud2>(std::move(cloud)));
+    return;
+  }
+
   // buffer the point cloud
   buffer->lock();
   buffer->bufferCloud(cloud);
@@ -401,6 +425,13 @@ ObstacleLayer::laserScanValidInfCallback(
     return;
   }
 
+  // hand the cloud to the buffer worker so TF waits stay off this thread
+  if (async_transform_processing_) {
+    buffer->bufferCloudAsync(
+      std::make_shared<sensor_msgs::msg::PointCloud2>(std::move(cloud)));
+    return;
+  }
+
   // buffer the point cloud
   buffer->lock();
   buffer->bufferCloud(cloud);
@@ -412,9 +443,15 @@ ObstacleLayer::pointCloud2Callback(
   sensor_msgs::msg::PointCloud2::ConstSharedPtr message,
   const std::shared_ptr<ObservationBuffer> & buffer)
 {
-  // buffer the point cloud
+  // hand the cloud to the buffer worker so TF waits stay off this thread
+  if (async_transform_processing_) {
+    buffer->bufferCloudAsync(message);
+    return;
+  }
+
+  // buffer the point cloud, sharing the message when no rewrite is needed
   buffer->lock();
-  buffer->bufferCloud(*message);
+  buffer->bufferCloud(message);
   buffer->unlock();
 }
 
@@ -433,7 +470,15 @@ ObstacleLayer::updateBounds(
   useExtraBounds(min_x, min_y, max_x, max_y);
 
   bool current = true;
-  std::vector<Observation> observations, clearing_observations;
+  std::vector<Observation> & observations = cycle_marking_observations_;
+  std::vector<Observation> & clearing_observations = cycle_clearing_observations_;
+  observations.clear();
+  clearing_observations.clear();
+
+  if (track_store_) {
+    cycle_now_ = clock_->now();
+    track_store_->prune(cycle_now_);
+  }
 
   // get the marking observations
   current = current && getMarkingObservations(observations);
@@ -464,52 +509,82 @@ ObstacleLayer::updateBounds(
     sensor_msgs::PointCloud2ConstIterator<float> iter_y(cloud, "y");
     sensor_msgs::PointCloud2ConstIterator<float> iter_z(cloud, "z");
 
-    for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
-      double px = *iter_x, py = *iter_y, pz = *iter_z;
+    auto mark_point = [&](double px, double py, double pz) {
+        // if the obstacle is too low, we won't add it
+        if (pz < min_obstacle_height_) {
+          RCLCPP_DEBUG(logger_, "The point is too low");
+          return;
+        }
 
-      // if the obstacle is too low, we won't add it
-      if (pz < min_obstacle_height_) {
-        RCLCPP_DEBUG(logger_, "The point is too low");
-        continue;
-      }
+        // if the obstacle is too high or too far away from the robot we won't add it
+        if (pz > max_obstacle_height_) {
+          RCLCPP_DEBUG(logger_, "The point is too high");
+          return;
+        }
 
-      // if the obstacle is too high or too far away from the robot we won't add it
-      if (pz > max_obstacle_height_) {
-        RCLCPP_DEBUG(logger_, "The point is too high");
-        continue;
-      }
+        // compute the squared distance from the hitpoint to the pointcloud's origin
+        double sq_dist =
+          (px -
+          obs.origin_.x) * (px - obs.origin_.x) + (py - obs.origin_.y) * (py - obs.origin_.y) +
+          (pz - obs.origin_.z) * (pz - obs.origin_.z);
 
-      // compute the squared distance from the hitpoint to the pointcloud's origin
-      double sq_dist =
-        (px -
-        obs.origin_.x) * (px - obs.origin_.x) + (py - obs.origin_.y) * (py - obs.origin_.y) +
-        (pz - obs.origin_.z) * (pz - obs.origin_.z);
+        // if the point is far enough away... we won't consider it
+        if (sq_dist >= sq_obstacle_max_range) {
+          RCLCPP_DEBUG(logger_, "The point is too far away");
+          return;
+        }
 
-      // if the point is far enough away... we won't consider it
-      if (sq_dist >= sq_obstacle_max_range) {
-        RCLCPP_DEBUG(logger_, "The point is too far away");
-        continue;
-      }
+        // if the point is too close, do not conisder it
+        if (sq_dist < sq_obstacle_min_range) {
+          RCLCPP_DEBUG(logger_, "The point is too close");
+          return;
+        }
 
-      // if the point is too close, do not conisder it
-      if (sq_dist < sq_obstacle_min_range) {
-        RCLCPP_DEBUG(logger_, "The point is too close");
-        continue;
-      }
+        // now we need to compute the map coordinates for the observation
+        unsigned int mx, my;
+        if (!worldToMap(px, py, mx, my)) {
+          RCLCPP_DEBUG(logger_, "Computing map coords failed");
+          return;
+        }
 
-      // now we need to compute the map coordinates for the observation
-      unsigned int mx, my;
-      if (!worldToMap(px, py, mx, my)) {
-        RCLCPP_DEBUG(logger_, "Computing map coords failed");
-        continue;
-      }
+        unsigned int index = getIndex(mx, my);
+        costmap_[index] = LETHAL_OBSTACLE;
+        touch(px, py, min_x, min_y, max_x, max_y);
 
-      unsigned int index = getIndex(mx, my);
-      costmap_[index] = LETHAL_OBSTACLE;
-      touch(px, py, min_x, min_y, max_x, max_y);
+        if (track_store_) {
+          track_store_->observe(px, py, cycle_now_);
+        }
+      };
+
+    if (obs.spatial_index_) {
+      // only visit points whose buckets intersect this layer's map area;
+      // points outside could never pass the worldToMap() check anyway
+      obs.spatial_index_->forEachInRegion(
+        origin_x_, origin_y_,
+        origin_x_ + getSizeInCellsX() * resolution_,
+        origin_y_ + getSizeInCellsY() * resolution_,
+        [&](uint32_t idx) {mark_point(iter_x[idx], iter_y[idx], iter_z[idx]);});
+    } else {
+      for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+        mark_point(*iter_x, *iter_y, *iter_z);
+      }
     }
   }
 
+  // re-mark established tracks after raytracing and marking, so obstacles
+  // the sensors only hit intermittently stay in the map between hits
+  // instead of flickering every time their observations age out
+  if (track_store_) {
+    track_store_->forEachActive(
+      cycle_now_, [&](double wx, double wy) {
+        unsigned int mx, my;
+        if (worldToMap(wx, wy, mx, my)) {
+          costmap_[getIndex(mx, my)] = LETHAL_OBSTACLE;
+          touch(wx, wy, min_x, min_y, max_x, max_y);
+        }
+      });
+  }
+
   updateFootprint(robot_x, robot_y, robot_yaw, min_x, min_y, max_x, max_y);
 }
 
@@ -622,6 +697,61 @@ ObstacleLayer::getClearingObservations(std::vector<Observation> & clearing_obser
   return current;
 }
 
+void
+ObstacleLayer::remarkRecentObservations(double cutoff_age)
+{
+  std::lock_guard<Costmap2D::mutex_t> guard(*getMutex());
+
+  std::vector<Observation> observations;
+  getMarkingObservations(observations);
+
+  const rclcpp::Time cutoff = clock_->now() - rclcpp::Duration::from_seconds(cutoff_age);
+
+  for (std::vector<Observation>::const_iterator it = observations.begin();
+    it != observations.end(); ++it)
+  {
+    const Observation & obs = *it;
+
+    if (rclcpp::Time(obs.cloud_->header.stamp) < cutoff) {
+      continue;
+    }
+
+    const sensor_msgs::msg::PointCloud2 & cloud = *(obs.cloud_);
+
+    double sq_obstacle_max_range = obs.obstacle_max_range_ * obs.obstacle_max_range_;
+    double sq_obstacle_min_range = obs.obstacle_min_range_ * obs.obstacle_min_range_;
+
+    sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud, "x");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_y(cloud, "y");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_z(cloud, "z");
+
+    for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+      double px = *iter_x, py = *iter_y, pz = *iter_z;
+
+      // apply the same filters the updateBounds() marking pass uses
+      if (pz < min_obstacle_height_ || pz > max_obstacle_height_) {
+        continue;
+      }
+
+      double sq_dist =
+        (px -
+        obs.origin_.x) * (px - obs.origin_.x) + (py - obs.origin_.y) * (py - obs.origin_.y) +
+        (pz - obs.origin_.z) * (pz - obs.origin_.z);
+
+      if (sq_dist >= sq_obstacle_max_range || sq_dist < sq_obstacle_min_range) {
+        continue;
+      }
+
+      unsigned int mx, my;
+      if (!worldToMap(px, py, mx, my)) {
+        continue;
+      }
+
+      costmap_[getIndex(mx, my)] = LETHAL_OBSTACLE;
+    }
+  }
+}
+
 void
 ObstacleLayer::raytraceFreespace(
   const Observation & clearing_observation, double * min_x,
@@ -654,6 +784,16 @@ ObstacleLayer::raytraceFreespace(
 
   touch(ox, oy, min_x, min_y, max_x, max_y);
 
+  // these are constant per observation, no need to recompute them per beam
+  const unsigned int cell_raytrace_max_range =
+    cellDistance(clearing_observation.raytrace_max_range_);
+  const unsigned int cell_raytrace_min_range =
+    cellDistance(clearing_observation.raytrace_min_range_);
+  const double raytrace_max_range = clearing_observation.raytrace_max_range_;
+  const double raytrace_min_range_sq =
+    clearing_observation.raytrace_min_range_ * clearing_observation.raytrace_min_range_;
+  const double raytrace_max_range_sq = raytrace_max_range * raytrace_max_range;
+
   // for each point in the cloud, we want to trace a line from the origin
   // and clear obstacles along it
   sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud, "x");
@@ -700,15 +840,14 @@ ObstacleLayer::raytraceFreespace(
       continue;
     }
 
-    unsigned int cell_raytrace_max_range = cellDistance(clearing_observation.raytrace_max_range_);
-    unsigned int cell_raytrace_min_range = cellDistance(clearing_observation.raytrace_min_range_);
-    MarkCell marker(costmap_, FREE_SPACE);
-    // and finally... we can execute our trace to clear obstacles along that line
-    raytraceLine(marker, x0, y0, x1, y1, cell_raytrace_max_range, cell_raytrace_min_range);
+    // and finally... we can execute our trace to clear obstacles along that
+    // line, filling whole Bresenham runs at a time
+    raytraceLineFill(
+      FREE_SPACE, x0, y0, x1, y1, cell_raytrace_max_range, cell_raytrace_min_range);
 
     updateRaytraceBounds(
-      ox, oy, wx, wy, clearing_observation.raytrace_max_range_,
-      clearing_observation.raytrace_min_range_, min_x, min_y, max_x,
+      ox, oy, wx, wy, raytrace_max_range,
+      raytrace_min_range_sq, raytrace_max_range_sq, min_x, min_y, max_x,
       max_y);
   }
 }
@@ -754,11 +893,34 @@ ObstacleLayer::updateRaytraceBounds(
   touch(ex, ey, min_x, min_y, max_x, max_y);
 }
 
+void
+ObstacleLayer::updateRaytraceBounds(
+  double ox, double oy, double wx, double wy, double max_range,
+  double min_range_sq, double max_range_sq,
+  double * min_x, double * min_y, double * max_x, double * max_y)
+{
+  double dx = wx - ox, dy = wy - oy;
+  double full_distance_sq = dx * dx + dy * dy;
+  if (full_distance_sq < min_range_sq) {
+    return;
+  }
+  if (full_distance_sq <= max_range_sq) {
+    // the endpoint is already within the raytrace range, touch it as-is
+    touch(wx, wy, min_x, min_y, max_x, max_y);
+    return;
+  }
+  double scale = max_range / sqrt(full_distance_sq);
+  touch(ox + dx * scale, oy + dy * scale, min_x, min_y, max_x, max_y);
+}
+
 void
 ObstacleLayer::reset()
 {
   resetMaps();
   resetBuffersLastUpdated();
+  if (track_store_) {
+    track_store_->clear();
+  }
   current_ = false;
   was_reset_ = true;
 }
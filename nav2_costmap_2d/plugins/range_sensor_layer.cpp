@@ -77,6 +77,7 @@ void RangeSensorLayer::onInitialize()
   node->get_parameter(name_ + "." + "enabled", enabled_);
   declareParameter("phi", rclcpp::ParameterValue(1.2));
   node->get_parameter(name_ + "." + "phi", phi_v_);
+  buildDeltaTable();
   declareParameter("inflate_cone", rclcpp::ParameterValue(1.0));
   node->get_parameter(name_ + "." + "inflate_cone", inflate_cone_);
   declareParameter("no_readings_timeout", rclcpp::ParameterValue(0.0));
@@ -172,9 +173,30 @@ double RangeSensorLayer::gamma(double theta)
   }
 }
 
+void RangeSensorLayer::buildDeltaTable()
+{
+  // sample 1 - (1 + tanh(2 * (phi - phi_v_))) / 2 once; past the span the
+  // tanh has saturated and the value is zero to within 1e-7
+  const unsigned int entries =
+    static_cast<unsigned int>((phi_v_ + delta_table_span_) / delta_table_step_) + 2;
+  delta_table_.resize(entries);
+  for (unsigned int i = 0; i < entries; ++i) {
+    double phi = i * delta_table_step_;
+    delta_table_[i] = 1 - (1 + tanh(2 * (phi - phi_v_))) / 2;
+  }
+}
+
 double RangeSensorLayer::delta(double phi)
 {
-  return 1 - (1 + tanh(2 * (phi - phi_v_))) / 2;
+  // interpolated table lookup; the sampling is fine enough that the error
+  // stays orders of magnitude below one cost byte
+  double pos = phi / delta_table_step_;
+  unsigned int i = static_cast<unsigned int>(pos);
+  if (phi < 0.0 || i + 1 >= delta_table_.size()) {
+    return phi < 0.0 ? 1.0 : 0.0;
+  }
+  double frac = pos - i;
+  return delta_table_[i] + frac * (delta_table_[i + 1] - delta_table_[i]);
 }
 
 void RangeSensorLayer::get_deltas(double angle, double * dx, double * dy)
@@ -287,6 +309,7 @@ void RangeSensorLayer::updateCostmap(
   bool clear_sensor_cone)
 {
   max_angle_ = range_message.field_of_view / 2;
+  cos_max_angle_ = cos(max_angle_);
 
   geometry_msgs::msg::PointStamped in, out;
   in.header.stamp = range_message.header.stamp;
@@ -315,6 +338,7 @@ void RangeSensorLayer::updateCostmap(
 
   // calculate target props
   double dx = tx - ox, dy = ty - oy, theta = atan2(dy, dx), d = sqrt(dx * dx + dy * dy);
+  double cos_theta = cos(theta), sin_theta = sin(theta);
 
   // Integer Bounds of Update
   int bx0, by0, bx1, by1;
@@ -389,7 +413,9 @@ void RangeSensorLayer::updateCostmap(
       if (update_xy_cell) {
         double wx, wy;
         mapToWorld(x, y, wx, wy);
-        update_cell(ox, oy, theta, range_message.range, wx, wy, clear_sensor_cone);
+        update_cell(
+          ox, oy, theta, cos_theta, sin_theta,
+          range_message.range, wx, wy, clear_sensor_cone);
       }
     }
   }
@@ -399,18 +425,36 @@ void RangeSensorLayer::updateCostmap(
 }
 
 void RangeSensorLayer::update_cell(
-  double ox, double oy, double ot, double r,
+  double ox, double oy, double ot, double cos_ot, double sin_ot, double r,
   double nx, double ny, bool clear)
 {
   unsigned int x, y;
   if (worldToMap(nx, ny, x, y)) {
     double dx = nx - ox, dy = ny - oy;
-    double theta = atan2(dy, dx) - ot;
-    theta = angles::normalize_angle(theta);
-    double phi = sqrt(dx * dx + dy * dy);
     double sensor = 0.0;
+    double phi, theta;
     if (!clear) {
+      // Cells past the outer edge of the arc or outside the cone get
+      // sensor = 0.5 from the model, which leaves the cost byte untouched:
+      // skip them before paying any transcendental math. The cone test
+      // compares cos(theta) = dot / phi against cos(max_angle_) using the
+      // beam direction hoisted by the caller.
+      double phi2 = dx * dx + dy * dy;
+      double outer = r + resolution_ * r;
+      if (phi2 >= outer * outer) {
+        return;
+      }
+      double dot = dx * cos_ot + dy * sin_ot;
+      phi = sqrt(phi2);
+      if (dot < phi * cos_max_angle_) {
+        return;
+      }
+      // angle between the cell and the beam axis, already normalized
+      theta = atan2(dy * cos_ot - dx * sin_ot, dot);
       sensor = sensor_model(r, phi, theta);
+    } else {
+      theta = angles::normalize_angle(atan2(dy, dx) - ot);
+      phi = sqrt(dx * dx + dy * dy);
     }
     double prior = to_prob(getCost(x, y));
     double prob_occ = sensor * prior;
@@ -40,6 +40,8 @@
 #include "nav2_costmap_2d/static_layer.hpp"
 
 #include <algorithm>
+#include <cstring>
+#include <memory>
 #include <string>
 
 #include "pluginlib/class_list_macros.hpp"
@@ -138,6 +140,7 @@ StaticLayer::getParameters()
   declareParameter("transform_tolerance", rclcpp::ParameterValue(0.0));
   declareParameter("map_topic", rclcpp::ParameterValue(""));
   declareParameter("footprint_clearing_enabled", rclcpp::ParameterValue(false));
+  declareParameter("tile_size", rclcpp::ParameterValue(0));
 
   auto node = node_.lock();
   if (!node) {
@@ -147,6 +150,7 @@ StaticLayer::getParameters()
   node->get_parameter(name_ + "." + "enabled", enabled_);
   node->get_parameter(name_ + "." + "subscribe_to_updates", subscribe_to_updates_);
   node->get_parameter(name_ + "." + "footprint_clearing_enabled", footprint_clearing_enabled_);
+  node->get_parameter(name_ + "." + "tile_size", tile_size_);
   std::string private_map_topic, global_map_topic;
   node->get_parameter(name_ + "." + "map_topic", private_map_topic);
   node->get_parameter("map_topic", global_map_topic);
@@ -226,18 +230,28 @@ StaticLayer::processMap(const nav_msgs::msg::OccupancyGrid & new_map)
       new_map.info.origin.position.x, new_map.info.origin.position.y);
   }
 
-  unsigned int index = 0;
-
   // we have a new map, update full size of map
   std::lock_guard<Costmap2D::mutex_t> guard(*getMutex());
 
-  // initialize the costmap with static data
-  for (unsigned int i = 0; i < size_y; ++i) {
-    for (unsigned int j = 0; j < size_x; ++j) {
-      unsigned char value = new_map.data[index];
-      costmap_[index] = interpretValue(value);
-      ++index;
+  if (tile_size_ > 0) {
+    // For building-scale maps, keep the raw grid around and translate it
+    // into costs tile by tile as update windows actually touch them
+    raw_map_ = std::make_shared<nav_msgs::msg::OccupancyGrid>(new_map);
+    tiles_x_ = (size_x + tile_size_ - 1) / tile_size_;
+    tiles_y_ = (size_y + tile_size_ - 1) / tile_size_;
+    tile_loaded_.assign(static_cast<size_t>(tiles_x_) * tiles_y_, 0);
+  } else {
+    // initialize the costmap with static data
+    unsigned int index = 0;
+    for (unsigned int i = 0; i < size_y; ++i) {
+      for (unsigned int j = 0; j < size_x; ++j) {
+        unsigned char value = new_map.data[index];
+        costmap_[index] = interpretValue(value);
+        ++index;
+      }
     }
+    // keep the raw grid around to diff the next republish against
+    raw_map_ = std::make_shared<nav_msgs::msg::OccupancyGrid>(new_map);
   }
 
   map_frame_ = new_map.header.frame_id;
@@ -250,6 +264,100 @@ StaticLayer::processMap(const nav_msgs::msg::OccupancyGrid & new_map)
   current_ = true;
 }
 
+bool
+StaticLayer::processMapDiff(const nav_msgs::msg::OccupancyGrid & new_map)
+{
+  // Only a map with identical geometry can be diffed against the stored
+  // raw grid; anything else takes the full processing path
+  if (!raw_map_ ||
+    new_map.info.width != size_x_ ||
+    new_map.info.height != size_y_ ||
+    new_map.info.resolution != resolution_ ||
+    new_map.info.origin.position.x != origin_x_ ||
+    new_map.info.origin.position.y != origin_y_ ||
+    new_map.header.frame_id != map_frame_ ||
+    new_map.data.size() != raw_map_->data.size())
+  {
+    return false;
+  }
+
+  const unsigned int tile =
+    tile_size_ > 0 ? static_cast<unsigned int>(tile_size_) : 64u;
+  const unsigned int tiles_x = (size_x_ + tile - 1) / tile;
+  const unsigned int tiles_y = (size_y_ + tile - 1) / tile;
+
+  // Bounding box of the changed tiles, in cells
+  unsigned int cx0 = size_x_, cy0 = size_y_;
+  unsigned int cx1 = 0, cy1 = 0;
+
+  for (unsigned int ty = 0; ty < tiles_y; ++ty) {
+    const unsigned int y_start = ty * tile;
+    const unsigned int y_end = std::min(y_start + tile, size_y_);
+    for (unsigned int tx = 0; tx < tiles_x; ++tx) {
+      const unsigned int x_start = tx * tile;
+      const unsigned int x_end = std::min(x_start + tile, size_x_);
+
+      bool tile_changed = false;
+      for (unsigned int y = y_start; y < y_end; ++y) {
+        const size_t offset = static_cast<size_t>(y) * size_x_ + x_start;
+        if (memcmp(&new_map.data[offset], &raw_map_->data[offset], x_end - x_start) != 0) {
+          tile_changed = true;
+          break;
+        }
+      }
+      if (!tile_changed) {
+        continue;
+      }
+
+      cx0 = std::min(cx0, x_start);
+      cy0 = std::min(cy0, y_start);
+      cx1 = std::max(cx1, x_end);
+      cy1 = std::max(cy1, y_end);
+
+      // Translate the changed cells now, unless this is a lazily loaded
+      // tile nobody has touched yet — then the new raw data is enough
+      if (tile_size_ <= 0 || tile_loaded_[ty * tiles_x_ + tx]) {
+        for (unsigned int y = y_start; y < y_end; ++y) {
+          unsigned int index = y * size_x_ + x_start;
+          for (unsigned int x = x_start; x < x_end; ++x, ++index) {
+            costmap_[index] = interpretValue(new_map.data[index]);
+          }
+        }
+      }
+    }
+  }
+
+  if (cx1 <= cx0) {
+    // identical republish, nothing to mark dirty
+    return true;
+  }
+
+  raw_map_ = std::make_shared<nav_msgs::msg::OccupancyGrid>(new_map);
+
+  if (layered_costmap_->isRolling()) {
+    // rolling costmaps recombine the moving window every cycle anyway
+    has_updated_data_ = true;
+    return true;
+  }
+
+  // Grow the dirty window over the changed tiles only
+  if (width_ == 0 || height_ == 0) {
+    x_ = cx0;
+    y_ = cy0;
+    width_ = cx1 - cx0;
+    height_ = cy1 - cy0;
+  } else {
+    const unsigned int x1 = std::max(x_ + width_, cx1);
+    const unsigned int y1 = std::max(y_ + height_, cy1);
+    x_ = std::min(x_, cx0);
+    y_ = std::min(y_, cy0);
+    width_ = x1 - x_;
+    height_ = y1 - y_;
+  }
+  has_updated_data_ = true;
+  return true;
+}
+
 void
 StaticLayer::matchSize()
 {
@@ -260,6 +368,48 @@ StaticLayer::matchSize()
     resizeMap(
       master->getSizeInCellsX(), master->getSizeInCellsY(), master->getResolution(),
       master->getOriginX(), master->getOriginY());
+    // resizing wiped the layer costmap, any lazily loaded tiles are gone
+    std::fill(tile_loaded_.begin(), tile_loaded_.end(), 0);
+  }
+}
+
+void
+StaticLayer::ensureTilesLoaded(int min_i, int min_j, int max_i, int max_j)
+{
+  if (!raw_map_ || tile_size_ <= 0) {
+    return;
+  }
+
+  min_i = std::max(0, min_i);
+  min_j = std::max(0, min_j);
+  max_i = std::min(static_cast<int>(size_x_), max_i);
+  max_j = std::min(static_cast<int>(size_y_), max_j);
+  if (max_i <= min_i || max_j <= min_j) {
+    return;
+  }
+
+  const unsigned int tx0 = min_i / tile_size_;
+  const unsigned int ty0 = min_j / tile_size_;
+  const unsigned int tx1 = (max_i - 1) / tile_size_;
+  const unsigned int ty1 = (max_j - 1) / tile_size_;
+
+  for (unsigned int ty = ty0; ty <= ty1; ++ty) {
+    for (unsigned int tx = tx0; tx <= tx1; ++tx) {
+      if (tile_loaded_[ty * tiles_x_ + tx]) {
+        continue;
+      }
+      const unsigned int x_start = tx * tile_size_;
+      const unsigned int y_start = ty * tile_size_;
+      const unsigned int x_end = std::min(x_start + tile_size_, size_x_);
+      const unsigned int y_end = std::min(y_start + tile_size_, size_y_);
+      for (unsigned int y = y_start; y < y_end; ++y) {
+        unsigned int index = y * size_x_ + x_start;
+        for (unsigned int x = x_start; x < x_end; ++x, ++index) {
+          costmap_[index] = interpretValue(raw_map_->data[index]);
+        }
+      }
+      tile_loaded_[ty * tiles_x_ + tx] = 1;
+    }
   }
 }
 
@@ -301,17 +451,16 @@ void
 StaticLayer::incomingUpdate(map_msgs::msg::OccupancyGridUpdate::ConstSharedPtr update)
 {
   std::lock_guard<Costmap2D::mutex_t> guard(*getMutex());
-  if (update->y < static_cast<int32_t>(y_) ||
-    y_ + height_ < update->y + update->height ||
-    update->x < static_cast<int32_t>(x_) ||
-    x_ + width_ < update->x + update->width)
+  if (update->x < 0 || update->y < 0 ||
+    static_cast<unsigned int>(update->x) + update->width > size_x_ ||
+    static_cast<unsigned int>(update->y) + update->height > size_y_)
   {
     RCLCPP_WARN(
       logger_,
       "StaticLayer: Map update ignored. Exceeds bounds of static layer.\n"
-      "Static layer origin: %d, %d   bounds: %d X %d\n"
+      "Static layer size: %d X %d\n"
       "Update origin: %d, %d   bounds: %d X %d",
-      x_, y_, width_, height_, update->x, update->y, update->width,
+      size_x_, size_y_, update->x, update->y, update->width,
       update->height);
     return;
   }
@@ -325,6 +474,11 @@ StaticLayer::incomingUpdate(map_msgs::msg::OccupancyGridUpdate::ConstSharedPtr u
     return;
   }
 
+  // updates write translated costs directly, so the tiles they touch must
+  // not be lazily overwritten from the stale raw map afterwards
+  ensureTilesLoaded(
+    update->x, update->y, update->x + update->width, update->y + update->height);
+
   unsigned int di = 0;
   for (unsigned int y = 0; y < update->height; y++) {
     unsigned int index_base = (update->y + y) * size_x_;
@@ -334,6 +488,25 @@ StaticLayer::incomingUpdate(map_msgs::msg::OccupancyGridUpdate::ConstSharedPtr u
     }
   }
 
+  // Mark just the updated window dirty, unioned in case several grid
+  // updates arrive between costmap update cycles
+  if (!layered_costmap_->isRolling()) {
+    const unsigned int ux = static_cast<unsigned int>(update->x);
+    const unsigned int uy = static_cast<unsigned int>(update->y);
+    if (width_ == 0 || height_ == 0) {
+      x_ = ux;
+      y_ = uy;
+      width_ = update->width;
+      height_ = update->height;
+    } else {
+      const unsigned int x1 = std::max(x_ + width_, ux + update->width);
+      const unsigned int y1 = std::max(y_ + height_, uy + update->height);
+      x_ = std::min(x_, ux);
+      y_ = std::min(y_, uy);
+      width_ = x1 - x_;
+      height_ = y1 - y_;
+    }
+  }
   has_updated_data_ = true;
 }
 
@@ -353,9 +526,13 @@ StaticLayer::updateBounds(
 
   std::lock_guard<Costmap2D::mutex_t> guard(*getMutex());
 
-  // If there is a new available map, load it.
+  // If there is a new available map, load it. A republish that kept its
+  // geometry is folded in by diffing, so near-identical refreshes only
+  // dirty the tiles that actually changed.
   if (map_buffer_) {
-    processMap(*map_buffer_);
+    if (!processMapDiff(*map_buffer_)) {
+      processMap(*map_buffer_);
+    }
     map_buffer_ = nullptr;
   }
 
@@ -369,16 +546,25 @@ StaticLayer::updateBounds(
 
   double wx, wy;
 
-  mapToWorld(x_, y_, wx, wy);
-  *min_x = std::min(wx, *min_x);
-  *min_y = std::min(wy, *min_y);
+  if (width_ > 0 && height_ > 0) {
+    mapToWorld(x_, y_, wx, wy);
+    *min_x = std::min(wx, *min_x);
+    *min_y = std::min(wy, *min_y);
 
-  mapToWorld(x_ + width_, y_ + height_, wx, wy);
-  *max_x = std::max(wx, *max_x);
-  *max_y = std::max(wy, *max_y);
+    mapToWorld(x_ + width_, y_ + height_, wx, wy);
+    *max_x = std::max(wx, *max_x);
+    *max_y = std::max(wy, *max_y);
+  }
 
   has_updated_data_ = false;
 
+  // The consumed window is no longer dirty; the next diffed republish
+  // or grid update re-marks just what it changes
+  if (!layered_costmap_->isRolling()) {
+    width_ = 0;
+    height_ = 0;
+  }
+
   updateFootprint(robot_x, robot_y, robot_yaw, min_x, min_y, max_x, max_y);
 }
 
@@ -423,6 +609,7 @@ StaticLayer::updateCosts(
 
   if (!layered_costmap_->isRolling()) {
     // if not rolling, the layered costmap (master_grid) has same coordinates as this layer
+    ensureTilesLoaded(min_i, min_j, max_i, max_j);
     if (!use_maximum_) {
       updateWithTrueOverwrite(master_grid, min_i, min_j, max_i, max_j);
     } else {
@@ -446,6 +633,25 @@ StaticLayer::updateCosts(
     tf2::Transform tf2_transform;
     tf2::fromMsg(transform.transform, tf2_transform);
 
+    if (raw_map_ && tile_size_ > 0) {
+      // load the tiles under the window's bounding box in this layer's frame
+      int lx0 = static_cast<int>(size_x_), ly0 = static_cast<int>(size_y_), lx1 = -1, ly1 = -1;
+      const int corners[4][2] =
+      {{min_i, min_j}, {max_i - 1, min_j}, {min_i, max_j - 1}, {max_i - 1, max_j - 1}};
+      for (const auto & corner : corners) {
+        layered_costmap_->getCostmap()->mapToWorld(corner[0], corner[1], wx, wy);
+        tf2::Vector3 p(wx, wy, 0);
+        p = tf2_transform * p;
+        int lx, ly;
+        worldToMapEnforceBounds(p.x(), p.y(), lx, ly);
+        lx0 = std::min(lx0, lx);
+        ly0 = std::min(ly0, ly);
+        lx1 = std::max(lx1, lx);
+        ly1 = std::max(ly1, ly);
+      }
+      ensureTilesLoaded(lx0, ly0, lx1 + 1, ly1 + 1);
+    }
+
     for (int i = min_i; i < max_i; ++i) {
       for (int j = min_j; j < max_j; ++j) {
         // Convert master_grid coordinates (i,j) into global_frame_(wx,wy) coordinates
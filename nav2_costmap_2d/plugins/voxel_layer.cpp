@@ -39,15 +39,17 @@
 #include "nav2_costmap_2d/voxel_layer.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <functional>
 #include <vector>
 #include <memory>
 #include <utility>
 
 #include "pluginlib/class_list_macros.hpp"
 #include "sensor_msgs/point_cloud2_iterator.hpp"
+#include "nav2_costmap_2d/observation_spatial_index.hpp"
 
-#define VOXEL_BITS 16
 PLUGINLIB_EXPORT_CLASS(nav2_costmap_2d::VoxelLayer, nav2_costmap_2d::Layer)
 
 using nav2_costmap_2d::NO_INFORMATION;
@@ -72,6 +74,7 @@ void VoxelLayer::onInitialize()
   declareParameter("mark_threshold", rclcpp::ParameterValue(0));
   declareParameter("combination_method", rclcpp::ParameterValue(1));
   declareParameter("publish_voxel_map", rclcpp::ParameterValue(false));
+  declareParameter("clearing_threads", rclcpp::ParameterValue(0));
 
   auto node = node_.lock();
   if (!node) {
@@ -87,6 +90,12 @@ void VoxelLayer::onInitialize()
   node->get_parameter(name_ + "." + "unknown_threshold", unknown_threshold_);
   node->get_parameter(name_ + "." + "mark_threshold", mark_threshold_);
   node->get_parameter(name_ + "." + "publish_voxel_map", publish_voxel_);
+  node->get_parameter(name_ + "." + "clearing_threads", clearing_threads_);
+
+  if (clearing_threads_ > 1) {
+    clearing_pool_ = std::make_unique<LayerUpdateThreadPool>(
+      static_cast<unsigned int>(clearing_threads_));
+  }
 
   int combination_method_param{};
   node->get_parameter(name_ + "." + "combination_method", combination_method_param);
@@ -94,6 +103,20 @@ void VoxelLayer::onInitialize()
 
   auto custom_qos = rclcpp::QoS(rclcpp::KeepLast(1)).transient_local().reliable();
 
+  // More than 16 z levels need 64-bit columns; keyed off the existing
+  // z_voxels parameter rather than a separate switch
+  if (size_z_ > static_cast<int>(nav2_voxel_grid::VoxelGrid::max_z_levels)) {
+    voxel_grid64_ = std::make_unique<nav2_voxel_grid::VoxelGrid64>(0, 0, 0);
+  }
+
+  if (publish_voxel_ && voxel_grid64_) {
+    RCLCPP_WARN(
+      logger_,
+      "publish_voxel_map is not supported with more than 16 z_voxels: "
+      "the VoxelGrid message carries 32-bit columns. Disabling publishing.");
+    publish_voxel_ = false;
+  }
+
   if (publish_voxel_) {
     voxel_pub_ = node->create_publisher<nav2_msgs::msg::VoxelGrid>(
       "voxel_grid", custom_qos);
@@ -104,7 +127,7 @@ void VoxelLayer::onInitialize()
     "clearing_endpoints", custom_qos);
   clearing_endpoints_pub_->on_activate();
 
-  unknown_threshold_ += (VOXEL_BITS - size_z_);
+  unknown_threshold_ += (voxelBits() - size_z_);
   matchSize();
 
   // Add callback for dynamic parameters
@@ -127,8 +150,13 @@ void VoxelLayer::matchSize()
 {
   std::lock_guard<Costmap2D::mutex_t> guard(*getMutex());
   ObstacleLayer::matchSize();
-  voxel_grid_.resize(size_x_, size_y_, size_z_);
-  assert(voxel_grid_.sizeX() == size_x_ && voxel_grid_.sizeY() == size_y_);
+  if (voxel_grid64_) {
+    voxel_grid64_->resize(size_x_, size_y_, size_z_);
+    assert(voxel_grid64_->sizeX() == size_x_ && voxel_grid64_->sizeY() == size_y_);
+  } else {
+    voxel_grid_.resize(size_x_, size_y_, size_z_);
+    assert(voxel_grid_.sizeX() == size_x_ && voxel_grid_.sizeY() == size_y_);
+  }
 }
 
 void VoxelLayer::reset()
@@ -145,7 +173,11 @@ void VoxelLayer::resetMaps()
   // resetMaps so this goes to the next layer down Costmap2DLayer which also
   // doesn't implement this, so it actually goes all the way to Costmap2D
   ObstacleLayer::resetMaps();
-  voxel_grid_.reset();
+  if (voxel_grid64_) {
+    voxel_grid64_->reset();
+  } else {
+    voxel_grid_.reset();
+  }
 }
 
 void VoxelLayer::updateBounds(
@@ -163,7 +195,10 @@ void VoxelLayer::updateBounds(
   useExtraBounds(min_x, min_y, max_x, max_y);
 
   bool current = true;
-  std::vector<Observation> observations, clearing_observations;
+  std::vector<Observation> & observations = cycle_marking_observations_;
+  std::vector<Observation> & clearing_observations = cycle_clearing_observations_;
+  observations.clear();
+  clearing_observations.clear();
 
   // get the marking observations
   current = getMarkingObservations(observations) && current;
@@ -194,45 +229,57 @@ void VoxelLayer::updateBounds(
     sensor_msgs::PointCloud2ConstIterator<float> iter_y(cloud, "y");
     sensor_msgs::PointCloud2ConstIterator<float> iter_z(cloud, "z");
 
-    for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
-      // if the obstacle is too high or too far away from the robot we won't add it
-      if (*iter_z > max_obstacle_height_) {
-        continue;
-      }
+    auto mark_point = [&](double px, double py, double pz) {
+        // if the obstacle is too high or too far away from the robot we won't add it
+        if (pz > max_obstacle_height_) {
+          return;
+        }
 
-      // compute the squared distance from the hitpoint to the pointcloud's origin
-      double sq_dist = (*iter_x - obs.origin_.x) * (*iter_x - obs.origin_.x) +
-        (*iter_y - obs.origin_.y) * (*iter_y - obs.origin_.y) +
-        (*iter_z - obs.origin_.z) * (*iter_z - obs.origin_.z);
+        // compute the squared distance from the hitpoint to the pointcloud's origin
+        double sq_dist = (px - obs.origin_.x) * (px - obs.origin_.x) +
+          (py - obs.origin_.y) * (py - obs.origin_.y) +
+          (pz - obs.origin_.z) * (pz - obs.origin_.z);
 
-      // if the point is far enough away... we won't consider it
-      if (sq_dist >= sq_obstacle_max_range) {
-        continue;
-      }
+        // if the point is far enough away... we won't consider it
+        if (sq_dist >= sq_obstacle_max_range) {
+          return;
+        }
 
-      // If the point is too close, do not consider it
-      if (sq_dist < sq_obstacle_min_range) {
-        continue;
-      }
+        // If the point is too close, do not consider it
+        if (sq_dist < sq_obstacle_min_range) {
+          return;
+        }
 
-      // now we need to compute the map coordinates for the observation
-      unsigned int mx, my, mz;
-      if (*iter_z < origin_z_) {
-        if (!worldToMap3D(*iter_x, *iter_y, origin_z_, mx, my, mz)) {
-          continue;
+        // now we need to compute the map coordinates for the observation
+        unsigned int mx, my, mz;
+        if (pz < origin_z_) {
+          if (!worldToMap3D(px, py, origin_z_, mx, my, mz)) {
+            return;
+          }
+        } else if (!worldToMap3D(px, py, pz, mx, my, mz)) {
+          return;
         }
-      } else if (!worldToMap3D(*iter_x, *iter_y, *iter_z, mx, my, mz)) {
-        continue;
-      }
 
-      // mark the cell in the voxel grid and check if we should also mark it in the costmap
-      if (voxel_grid_.markVoxelInMap(mx, my, mz, mark_threshold_)) {
-        unsigned int index = getIndex(mx, my);
+        // mark the cell in the voxel grid and check if we should also mark it in the costmap
+        if (markVoxelInMap(mx, my, mz)) {
+          unsigned int index = getIndex(mx, my);
 
-        costmap_[index] = LETHAL_OBSTACLE;
-        touch(
-          static_cast<double>(*iter_x), static_cast<double>(*iter_y),
-          min_x, min_y, max_x, max_y);
+          costmap_[index] = LETHAL_OBSTACLE;
+          touch(px, py, min_x, min_y, max_x, max_y);
+        }
+      };
+
+    if (obs.spatial_index_) {
+      // only visit points whose buckets intersect this layer's map area;
+      // points outside could never pass the worldToMap3D() check anyway
+      obs.spatial_index_->forEachInRegion(
+        origin_x_, origin_y_,
+        origin_x_ + getSizeInCellsX() * resolution_,
+        origin_y_ + getSizeInCellsY() * resolution_,
+        [&](uint32_t idx) {mark_point(iter_x[idx], iter_y[idx], iter_z[idx]);});
+    } else {
+      for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+        mark_point(*iter_x, *iter_y, *iter_z);
       }
     }
   }
@@ -262,6 +309,63 @@ void VoxelLayer::updateBounds(
   updateFootprint(robot_x, robot_y, robot_yaw, min_x, min_y, max_x, max_y);
 }
 
+void VoxelLayer::remarkRecentObservations(double cutoff_age)
+{
+  std::lock_guard<Costmap2D::mutex_t> guard(*getMutex());
+
+  std::vector<Observation> observations;
+  getMarkingObservations(observations);
+
+  const rclcpp::Time cutoff = clock_->now() - rclcpp::Duration::from_seconds(cutoff_age);
+
+  for (std::vector<Observation>::const_iterator it = observations.begin(); it != observations.end();
+    ++it)
+  {
+    const Observation & obs = *it;
+
+    if (rclcpp::Time(obs.cloud_->header.stamp) < cutoff) {
+      continue;
+    }
+
+    const sensor_msgs::msg::PointCloud2 & cloud = *(obs.cloud_);
+
+    double sq_obstacle_max_range = obs.obstacle_max_range_ * obs.obstacle_max_range_;
+    double sq_obstacle_min_range = obs.obstacle_min_range_ * obs.obstacle_min_range_;
+
+    sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud, "x");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_y(cloud, "y");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_z(cloud, "z");
+
+    for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+      // apply the same filters the updateBounds() marking pass uses
+      if (*iter_z > max_obstacle_height_) {
+        continue;
+      }
+
+      double sq_dist = (*iter_x - obs.origin_.x) * (*iter_x - obs.origin_.x) +
+        (*iter_y - obs.origin_.y) * (*iter_y - obs.origin_.y) +
+        (*iter_z - obs.origin_.z) * (*iter_z - obs.origin_.z);
+
+      if (sq_dist >= sq_obstacle_max_range || sq_dist < sq_obstacle_min_range) {
+        continue;
+      }
+
+      unsigned int mx, my, mz;
+      if (*iter_z < origin_z_) {
+        if (!worldToMap3D(*iter_x, *iter_y, origin_z_, mx, my, mz)) {
+          continue;
+        }
+      } else if (!worldToMap3D(*iter_x, *iter_y, *iter_z, mx, my, mz)) {
+        continue;
+      }
+
+      if (markVoxelInMap(mx, my, mz)) {
+        costmap_[getIndex(mx, my)] = LETHAL_OBSTACLE;
+      }
+    }
+  }
+}
+
 void VoxelLayer::raytraceFreespace(
   const Observation & clearing_observation, double * min_x,
   double * min_y,
@@ -303,6 +407,14 @@ void VoxelLayer::raytraceFreespace(
     publish_clearing_points = (node->count_subscribers("clearing_endpoints") > 0);
   }
 
+  // the parallel path doesn't assemble the clearing endpoint cloud, so fall
+  // through to the sequential one while anyone is subscribed to it
+  if (clearing_pool_ && !publish_clearing_points) {
+    raytraceFreespaceParallel(
+      clearing_observation, sensor_x, sensor_y, sensor_z, min_x, min_y, max_x, max_y);
+    return;
+  }
+
   clearing_endpoints_->data.clear();
   clearing_endpoints_->width = clearing_observation.cloud_->width;
   clearing_endpoints_->height = clearing_observation.cloud_->height;
@@ -324,6 +436,16 @@ void VoxelLayer::raytraceFreespace(
   double map_end_y = origin_y_ + getSizeInMetersY();
   double map_end_z = origin_z_ + getSizeInMetersZ();
 
+  // these are constant per observation, no need to recompute them per beam
+  const unsigned int cell_raytrace_max_range =
+    cellDistance(clearing_observation.raytrace_max_range_);
+  const unsigned int cell_raytrace_min_range =
+    cellDistance(clearing_observation.raytrace_min_range_);
+  const double raytrace_max_range = clearing_observation.raytrace_max_range_;
+  const double raytrace_min_range_sq =
+    clearing_observation.raytrace_min_range_ * clearing_observation.raytrace_min_range_;
+  const double raytrace_max_range_sq = raytrace_max_range * raytrace_max_range;
+
   sensor_msgs::PointCloud2ConstIterator<float> iter_x(*(clearing_observation.cloud_), "x");
   sensor_msgs::PointCloud2ConstIterator<float> iter_y(*(clearing_observation.cloud_), "y");
   sensor_msgs::PointCloud2ConstIterator<float> iter_z(*(clearing_observation.cloud_), "z");
@@ -377,20 +499,24 @@ void VoxelLayer::raytraceFreespace(
 
     double point_x, point_y, point_z;
     if (worldToMap3DFloat(wpx, wpy, wpz, point_x, point_y, point_z)) {
-      unsigned int cell_raytrace_max_range = cellDistance(clearing_observation.raytrace_max_range_);
-      unsigned int cell_raytrace_min_range = cellDistance(clearing_observation.raytrace_min_range_);
-
-
       // voxel_grid_.markVoxelLine(sensor_x, sensor_y, sensor_z, point_x, point_y, point_z);
-      voxel_grid_.clearVoxelLineInMap(
-        sensor_x, sensor_y, sensor_z, point_x, point_y, point_z,
-        costmap_,
-        unknown_threshold_, mark_threshold_, FREE_SPACE, NO_INFORMATION,
-        cell_raytrace_max_range, cell_raytrace_min_range);
+      if (voxel_grid64_) {
+        voxel_grid64_->clearVoxelLineInMap(
+          sensor_x, sensor_y, sensor_z, point_x, point_y, point_z,
+          costmap_,
+          unknown_threshold_, mark_threshold_, FREE_SPACE, NO_INFORMATION,
+          cell_raytrace_max_range, cell_raytrace_min_range);
+      } else {
+        voxel_grid_.clearVoxelLineInMap(
+          sensor_x, sensor_y, sensor_z, point_x, point_y, point_z,
+          costmap_,
+          unknown_threshold_, mark_threshold_, FREE_SPACE, NO_INFORMATION,
+          cell_raytrace_max_range, cell_raytrace_min_range);
+      }
 
       updateRaytraceBounds(
-        ox, oy, wpx, wpy, clearing_observation.raytrace_max_range_,
-        clearing_observation.raytrace_min_range_, min_x, min_y,
+        ox, oy, wpx, wpy, raytrace_max_range,
+        raytrace_min_range_sq, raytrace_max_range_sq, min_x, min_y,
         max_x,
         max_y);
 
@@ -414,6 +540,167 @@ void VoxelLayer::raytraceFreespace(
   }
 }
 
+void VoxelLayer::raytraceFreespaceParallel(
+  const Observation & clearing_observation, double sensor_x, double sensor_y, double sensor_z,
+  double * min_x, double * min_y, double * max_x, double * max_y)
+{
+  if (voxel_grid64_) {
+    raytraceFreespaceParallelImpl(
+      *voxel_grid64_, clear_masks64_, clearing_observation,
+      sensor_x, sensor_y, sensor_z, min_x, min_y, max_x, max_y);
+  } else {
+    raytraceFreespaceParallelImpl(
+      voxel_grid_, clear_masks_, clearing_observation,
+      sensor_x, sensor_y, sensor_z, min_x, min_y, max_x, max_y);
+  }
+}
+
+template<typename GridT, typename MaskT>
+void VoxelLayer::raytraceFreespaceParallelImpl(
+  GridT & grid, std::vector<std::vector<MaskT>> & clear_masks,
+  const Observation & clearing_observation, double sensor_x, double sensor_y, double sensor_z,
+  double * min_x, double * min_y, double * max_x, double * max_y)
+{
+  double ox = clearing_observation.origin_.x;
+  double oy = clearing_observation.origin_.y;
+  double oz = clearing_observation.origin_.z;
+
+  double map_end_x = origin_x_ + getSizeInMetersX();
+  double map_end_y = origin_y_ + getSizeInMetersY();
+  double map_end_z = origin_z_ + getSizeInMetersZ();
+
+  unsigned int cell_raytrace_max_range = cellDistance(clearing_observation.raytrace_max_range_);
+  unsigned int cell_raytrace_min_range = cellDistance(clearing_observation.raytrace_min_range_);
+  const double raytrace_max_range = clearing_observation.raytrace_max_range_;
+  const double raytrace_min_range_sq =
+    clearing_observation.raytrace_min_range_ * clearing_observation.raytrace_min_range_;
+  const double raytrace_max_range_sq = raytrace_max_range * raytrace_max_range;
+
+  // Phase 0: clamp each beam to the map volume on the calling thread, since
+  // the endpoints feed the sequential raytrace bounds update anyway. The
+  // expensive part - tracing - is deferred to the workers.
+  std::vector<std::array<double, 3>> endpoints;
+  endpoints.reserve(clearing_observation.cloud_->width * clearing_observation.cloud_->height);
+
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(*(clearing_observation.cloud_), "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(*(clearing_observation.cloud_), "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(*(clearing_observation.cloud_), "z");
+
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    double wpx = *iter_x;
+    double wpy = *iter_y;
+    double wpz = *iter_z;
+
+    double distance = dist(ox, oy, oz, wpx, wpy, wpz);
+    double scaling_fact = 1.0;
+    scaling_fact = std::max(std::min(scaling_fact, (distance - 2 * resolution_) / distance), 0.0);
+    wpx = scaling_fact * (wpx - ox) + ox;
+    wpy = scaling_fact * (wpy - oy) + oy;
+    wpz = scaling_fact * (wpz - oz) + oz;
+
+    double a = wpx - ox;
+    double b = wpy - oy;
+    double c = wpz - oz;
+    double t = 1.0;
+
+    // we can only raytrace to a maximum z height
+    if (wpz > map_end_z) {
+      // we know we want the vector's z value to be max_z
+      t = std::max(0.0, std::min(t, (map_end_z - 0.01 - oz) / c));
+    } else if (wpz < origin_z_) {
+      // and we can only raytrace down to the floor
+      // we know we want the vector's z value to be 0.0
+      t = std::min(t, (origin_z_ - oz) / c);
+    }
+
+    // the minimum value to raytrace from is the origin
+    if (wpx < origin_x_) {
+      t = std::min(t, (origin_x_ - ox) / a);
+    }
+    if (wpy < origin_y_) {
+      t = std::min(t, (origin_y_ - oy) / b);
+    }
+
+    // the maximum value to raytrace to is the end of the map
+    if (wpx > map_end_x) {
+      t = std::min(t, (map_end_x - ox) / a);
+    }
+    if (wpy > map_end_y) {
+      t = std::min(t, (map_end_y - oy) / b);
+    }
+
+    wpx = ox + a * t;
+    wpy = oy + b * t;
+    wpz = oz + c * t;
+
+    double point_x, point_y, point_z;
+    if (worldToMap3DFloat(wpx, wpy, wpz, point_x, point_y, point_z)) {
+      endpoints.push_back({point_x, point_y, point_z});
+
+      updateRaytraceBounds(
+        ox, oy, wpx, wpy, raytrace_max_range,
+        raytrace_min_range_sq, raytrace_max_range_sq, min_x, min_y,
+        max_x,
+        max_y);
+    }
+  }
+
+  if (endpoints.empty()) {
+    return;
+  }
+
+  // Phase 1: bin the beams across the workers, each of which ORs the z-masks
+  // its beams would clear into its own column-major mask grid
+  const unsigned int num_workers = clearing_pool_->size();
+  const unsigned int num_columns = size_x_ * size_y_;
+  clear_masks.resize(num_workers);
+
+  std::vector<std::function<void()>> tasks;
+  tasks.reserve(num_workers);
+  for (unsigned int w = 0; w < num_workers; ++w) {
+    const size_t begin = endpoints.size() * w / num_workers;
+    const size_t end = endpoints.size() * (w + 1) / num_workers;
+    tasks.push_back(
+      [this, w, begin, end, &endpoints, &grid, &clear_masks,
+        sensor_x, sensor_y, sensor_z,
+        num_columns, cell_raytrace_max_range, cell_raytrace_min_range]() {
+        clear_masks[w].assign(num_columns, 0);
+        for (size_t i = begin; i < end; ++i) {
+          grid.accumulateClearLine(
+            clear_masks[w].data(),
+            sensor_x, sensor_y, sensor_z,
+            endpoints[i][0], endpoints[i][1], endpoints[i][2],
+            cell_raytrace_max_range, cell_raytrace_min_range);
+        }
+      });
+  }
+  clearing_pool_->execute(tasks);
+
+  // Phase 2: merge the mask grids and clear the columns in disjoint bands,
+  // one band per worker, which makes the writes race-free
+  tasks.clear();
+  for (unsigned int w = 0; w < num_workers; ++w) {
+    const unsigned int begin = static_cast<unsigned int>(
+      static_cast<uint64_t>(num_columns) * w / num_workers);
+    const unsigned int end = static_cast<unsigned int>(
+      static_cast<uint64_t>(num_columns) * (w + 1) / num_workers);
+    tasks.push_back(
+      [this, begin, end, num_workers, &grid, &clear_masks]() {
+        MaskT * merged = clear_masks[0].data();
+        for (unsigned int other = 1; other < num_workers; ++other) {
+          const MaskT * masks = clear_masks[other].data();
+          for (unsigned int i = begin; i < end; ++i) {
+            merged[i] |= masks[i];
+          }
+        }
+        grid.applyClearMasks(
+          merged, begin, end, costmap_,
+          unknown_threshold_, mark_threshold_, FREE_SPACE, NO_INFORMATION);
+      });
+  }
+  clearing_pool_->execute(tasks);
+}
+
 void VoxelLayer::updateOrigin(double new_origin_x, double new_origin_y)
 {
   // project the new origin into the grid
@@ -443,18 +730,33 @@ void VoxelLayer::updateOrigin(double new_origin_x, double new_origin_y)
 
   // we need a map to store the obstacles in the window temporarily
   unsigned char * local_map = new unsigned char[cell_size_x * cell_size_y];
-  unsigned int * local_voxel_map = new unsigned int[cell_size_x * cell_size_y];
-  unsigned int * voxel_map = voxel_grid_.getData();
 
   // copy the local window in the costmap to the local map
   copyMapRegion(
     costmap_, lower_left_x, lower_left_y, size_x_, local_map, 0, 0, cell_size_x,
     cell_size_x,
     cell_size_y);
-  copyMapRegion(
-    voxel_map, lower_left_x, lower_left_y, size_x_, local_voxel_map, 0, 0, cell_size_x,
-    cell_size_x,
-    cell_size_y);
+
+  // same for the voxel columns, at whichever word width is active
+  unsigned int * local_voxel_map = nullptr;
+  unsigned int * voxel_map = nullptr;
+  uint64_t * local_voxel_map64 = nullptr;
+  uint64_t * voxel_map64 = nullptr;
+  if (voxel_grid64_) {
+    local_voxel_map64 = new uint64_t[cell_size_x * cell_size_y];
+    voxel_map64 = voxel_grid64_->getData();
+    copyMapRegion(
+      voxel_map64, lower_left_x, lower_left_y, size_x_, local_voxel_map64, 0, 0, cell_size_x,
+      cell_size_x,
+      cell_size_y);
+  } else {
+    local_voxel_map = new unsigned int[cell_size_x * cell_size_y];
+    voxel_map = voxel_grid_.getData();
+    copyMapRegion(
+      voxel_map, lower_left_x, lower_left_y, size_x_, local_voxel_map, 0, 0, cell_size_x,
+      cell_size_x,
+      cell_size_y);
+  }
 
   // we'll reset our maps to unknown space if appropriate
   resetMaps();
@@ -471,14 +773,22 @@ void VoxelLayer::updateOrigin(double new_origin_x, double new_origin_y)
   copyMapRegion(
     local_map, 0, 0, cell_size_x, costmap_, start_x, start_y, size_x_, cell_size_x,
     cell_size_y);
-  copyMapRegion(
-    local_voxel_map, 0, 0, cell_size_x, voxel_map, start_x, start_y, size_x_,
-    cell_size_x,
-    cell_size_y);
+  if (voxel_grid64_) {
+    copyMapRegion(
+      local_voxel_map64, 0, 0, cell_size_x, voxel_map64, start_x, start_y, size_x_,
+      cell_size_x,
+      cell_size_y);
+  } else {
+    copyMapRegion(
+      local_voxel_map, 0, 0, cell_size_x, voxel_map, start_x, start_y, size_x_,
+      cell_size_x,
+      cell_size_y);
+  }
 
   // make sure to clean up
   delete[] local_map;
   delete[] local_voxel_map;
+  delete[] local_voxel_map64;
 }
 
 /**
@@ -522,10 +832,21 @@ VoxelLayer::dynamicParametersCallback(
 
     } else if (param_type == ParameterType::PARAMETER_INTEGER) {
       if (param_name == name_ + "." + "z_voxels") {
+        // switching between 32 and 64 bit columns would need the grid and
+        // thresholds rebuilt; only same-width resizes are supported live
+        if ((parameter.as_int() >
+          static_cast<int>(nav2_voxel_grid::VoxelGrid::max_z_levels)) !=
+          static_cast<bool>(voxel_grid64_))
+        {
+          RCLCPP_WARN(
+            logger_, "z_voxels cannot cross 16 at runtime, as this changes "
+            "the voxel column width. Rejecting parameter update.");
+          continue;
+        }
         size_z_ = parameter.as_int();
         resize_map_needed = true;
       } else if (param_name == name_ + "." + "unknown_threshold") {
-        unknown_threshold_ = parameter.as_int() + (VOXEL_BITS - size_z_);
+        unknown_threshold_ = parameter.as_int() + (voxelBits() - size_z_);
       } else if (param_name == name_ + "." + "mark_threshold") {
         mark_threshold_ = parameter.as_int();
       } else if (param_name == name_ + "." + "combination_method") {
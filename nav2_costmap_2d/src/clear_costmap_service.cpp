@@ -19,6 +19,8 @@
 
 #include "nav2_costmap_2d/clear_costmap_service.hpp"
 #include "nav2_costmap_2d/costmap_2d_ros.hpp"
+#include "nav2_costmap_2d/obstacle_layer.hpp"
+#include "nav2_util/node_utils.hpp"
 
 namespace nav2_costmap_2d
 {
@@ -40,6 +42,10 @@ ClearCostmapService::ClearCostmapService(
   logger_ = node->get_logger();
   reset_value_ = costmap_.getCostmap()->getDefaultValue();
 
+  nav2_util::declare_parameter_if_not_declared(
+    node, "clearing_observation_cutoff", rclcpp::ParameterValue(0.0));
+  node->get_parameter("clearing_observation_cutoff", clearing_observation_cutoff_);
+
   clear_except_service_ = node->create_service<ClearExceptRegion>(
     "clear_except_" + costmap_.getName(),
     std::bind(
@@ -143,18 +149,42 @@ void ClearCostmapService::clearLayerRegion(
   double ox = costmap->getOriginX(), oy = costmap->getOriginY();
   double width = costmap->getSizeInMetersX(), height = costmap->getSizeInMetersY();
   costmap->addExtraBounds(ox, oy, ox + width, oy + height);
+
+  // restore cells supported by recent observations so the cleared layer
+  // does not stay blind until the next update cycle re-marks them
+  if (clearing_observation_cutoff_ > 0.0) {
+    if (auto obstacle_layer = std::dynamic_pointer_cast<ObstacleLayer>(costmap)) {
+      obstacle_layer->remarkRecentObservations(clearing_observation_cutoff_);
+    }
+  }
 }
 
 void ClearCostmapService::clearEntirely()
 {
   std::unique_lock<Costmap2D::mutex_t> lock(*(costmap_.getCostmap()->getMutex()));
   costmap_.resetLayers();
+
+  if (clearing_observation_cutoff_ <= 0.0) {
+    return;
+  }
+
+  // incremental mode: immediately re-mark observations fresher than the
+  // cutoff instead of waiting for the update loop to rebuild every layer
+  for (auto & layer : *costmap_.getLayeredCostmap()->getPlugins()) {
+    if (layer->isClearable()) {
+      if (auto obstacle_layer = std::dynamic_pointer_cast<ObstacleLayer>(layer)) {
+        obstacle_layer->remarkRecentObservations(clearing_observation_cutoff_);
+      }
+    }
+  }
 }
 
 bool ClearCostmapService::getPosition(double & x, double & y) const
 {
   geometry_msgs::msg::PoseStamped pose;
-  if (!costmap_.getRobotPose(pose)) {
+  // clearing around the robot works on map-rate data, so the pose cached by
+  // the update cycle is good enough and skips a TF lookup
+  if (!costmap_.getCachedRobotPose(pose) && !costmap_.getRobotPose(pose)) {
     return false;
   }
 
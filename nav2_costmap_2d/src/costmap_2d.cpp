@@ -72,7 +72,8 @@ Costmap2D::Costmap2D(const nav_msgs::msg::OccupancyGrid & map)
   origin_y_ = map.info.origin.position.y;
 
   // create the costmap
-  costmap_ = new unsigned char[size_x_ * size_y_];
+  costmap_buffer_ = std::shared_ptr<unsigned char[]>(new unsigned char[size_x_ * size_y_]);
+  costmap_ = costmap_buffer_.get();
 
   // fill the costmap with a data
   int8_t data;
@@ -94,17 +95,33 @@ void Costmap2D::deleteMaps()
 {
   // clean up data
   std::unique_lock<mutex_t> lock(*access_);
-  delete[] costmap_;
+  costmap_buffer_.reset();
   costmap_ = NULL;
 }
 
 void Costmap2D::initMaps(unsigned int size_x, unsigned int size_y)
 {
   std::unique_lock<mutex_t> lock(*access_);
-  delete[] costmap_;
   size_x_ = size_x;
   size_y_ = size_y;
-  costmap_ = new unsigned char[size_x * size_y];
+  costmap_buffer_ = std::shared_ptr<unsigned char[]>(new unsigned char[size_x * size_y]);
+  costmap_ = costmap_buffer_.get();
+}
+
+void Costmap2D::detachBuffer() const
+{
+  // The unshared case must stay cheap for per-cell mutators, so only
+  // take the lock once sharing is observed; the recursive mutex makes
+  // this safe from mutators that already hold it
+  if (costmap_buffer_.use_count() > 1) {
+    std::unique_lock<mutex_t> lock(*access_);
+    if (costmap_buffer_.use_count() > 1) {
+      std::shared_ptr<unsigned char[]> own(new unsigned char[size_x_ * size_y_]);
+      memcpy(own.get(), costmap_buffer_.get(), size_x_ * size_y_ * sizeof(unsigned char));
+      costmap_buffer_ = std::move(own);
+      costmap_ = costmap_buffer_.get();
+    }
+  }
 }
 
 void Costmap2D::resizeMap(
@@ -124,6 +141,7 @@ void Costmap2D::resizeMap(
 void Costmap2D::resetMaps()
 {
   std::unique_lock<mutex_t> lock(*access_);
+  detachBuffer();
   memset(costmap_, default_value_, size_x_ * size_y_ * sizeof(unsigned char));
 }
 
@@ -136,6 +154,7 @@ void Costmap2D::resetMapToValue(
   unsigned int x0, unsigned int y0, unsigned int xn, unsigned int yn, unsigned char value)
 {
   std::unique_lock<mutex_t> lock(*(access_));
+  detachBuffer();
   unsigned int len = xn - x0;
   for (unsigned int y = y0 * size_x_ + x0; y < yn * size_x_ + x0; y += size_x_) {
     memset(costmap_ + y, value, len * sizeof(unsigned char));
@@ -197,6 +216,7 @@ bool Costmap2D::copyWindow(
     return false;
   }
 
+  detachBuffer();
   copyMapRegion(
     source.costmap_, sx0, sy0, source.size_x_,
     costmap_, dx0, dy0, size_x_,
@@ -220,11 +240,10 @@ Costmap2D & Costmap2D::operator=(const Costmap2D & map)
   origin_x_ = map.origin_x_;
   origin_y_ = map.origin_y_;
 
-  // initialize our various maps
-  initMaps(size_x_, size_y_);
-
-  // copy the cost map
-  memcpy(costmap_, map.costmap_, size_x_ * size_y_ * sizeof(unsigned char));
+  // share the source grid copy-on-write; whichever side mutates first
+  // pays for the duplication then
+  costmap_buffer_ = map.costmap_buffer_;
+  costmap_ = map.costmap_;
 
   return *this;
 }
@@ -257,9 +276,26 @@ unsigned int Costmap2D::cellDistance(double world_dist)
 
 unsigned char * Costmap2D::getCharMap() const
 {
+  // the caller may write through the pointer, so stop sharing the grid
+  detachBuffer();
   return costmap_;
 }
 
+Costmap2D::RegionView Costmap2D::getRegionView(
+  unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1) const
+{
+  x1 = std::min(x1, size_x_);
+  y1 = std::min(y1, size_y_);
+  x0 = std::min(x0, x1);
+  y0 = std::min(y0, y1);
+  return RegionView(costmap_, size_x_, x0, y0, x1, y1);
+}
+
+Costmap2D::RegionView Costmap2D::getRegionView() const
+{
+  return RegionView(costmap_, size_x_, 0, 0, size_x_, size_y_);
+}
+
 unsigned char Costmap2D::getCost(unsigned int mx, unsigned int my) const
 {
   return costmap_[getIndex(mx, my)];
@@ -272,6 +308,7 @@ unsigned char Costmap2D::getCost(unsigned int undex) const
 
 void Costmap2D::setCost(unsigned int mx, unsigned int my, unsigned char cost)
 {
+  detachBuffer();
   costmap_[getIndex(mx, my)] = cost;
 }
 
@@ -363,36 +400,59 @@ void Costmap2D::updateOrigin(double new_origin_x, double new_origin_y)
   upper_right_x = std::min(std::max(cell_ox + size_x, 0), size_x);
   upper_right_y = std::min(std::max(cell_oy + size_y, 0), size_y);
 
-  unsigned int cell_size_x = upper_right_x - lower_left_x;
-  unsigned int cell_size_y = upper_right_y - lower_left_y;
+  int cell_size_x = upper_right_x - lower_left_x;
+  int cell_size_y = upper_right_y - lower_left_y;
 
-  // we need a map to store the obstacles in the window temporarily
-  unsigned char * local_map = new unsigned char[cell_size_x * cell_size_y];
+  // if nothing of the old window survives the shift, a reset is all we need
+  if (cell_size_x <= 0 || cell_size_y <= 0) {
+    resetMaps();
+    origin_x_ = new_grid_ox;
+    origin_y_ = new_grid_oy;
+    return;
+  }
 
-  // copy the local window in the costmap to the local map
-  copyMapRegion(
-    costmap_, lower_left_x, lower_left_y, size_x_, local_map, 0, 0, cell_size_x,
-    cell_size_x,
-    cell_size_y);
+  // compute the starting cell location the retained region moves to
+  int start_x = lower_left_x - cell_ox;
+  int start_y = lower_left_y - cell_oy;
 
-  // now we'll set the costmap to be completely unknown if we track unknown space
-  resetMaps();
+  detachBuffer();
+
+  // translate the retained region in place, one memmove per row, walking the
+  // rows in the direction that keeps destination rows from clobbering source
+  // rows that haven't moved yet. This makes the origin update allocation-free.
+  if (cell_oy >= 0) {
+    for (int i = 0; i < cell_size_y; ++i) {
+      memmove(
+        costmap_ + (start_y + i) * size_x + start_x,
+        costmap_ + (lower_left_y + i) * size_x + lower_left_x,
+        cell_size_x * sizeof(unsigned char));
+    }
+  } else {
+    for (int i = cell_size_y - 1; i >= 0; --i) {
+      memmove(
+        costmap_ + (start_y + i) * size_x + start_x,
+        costmap_ + (lower_left_y + i) * size_x + lower_left_x,
+        cell_size_x * sizeof(unsigned char));
+    }
+  }
+
+  // reset the vacated cells around the translated region: the row bands fully
+  // above and below it, then the column bands to either side of it
+  memset(costmap_, default_value_, start_y * size_x * sizeof(unsigned char));
+  memset(
+    costmap_ + (start_y + cell_size_y) * size_x, default_value_,
+    (size_y - start_y - cell_size_y) * size_x * sizeof(unsigned char));
+  for (int i = 0; i < cell_size_y; ++i) {
+    unsigned char * row = costmap_ + (start_y + i) * size_x;
+    memset(row, default_value_, start_x * sizeof(unsigned char));
+    memset(
+      row + start_x + cell_size_x, default_value_,
+      (size_x - start_x - cell_size_x) * sizeof(unsigned char));
+  }
 
   // update the origin with the appropriate world coordinates
   origin_x_ = new_grid_ox;
   origin_y_ = new_grid_oy;
-
-  // compute the starting cell location for copying data back in
-  int start_x = lower_left_x - cell_ox;
-  int start_y = lower_left_y - cell_oy;
-
-  // now we want to copy the overlapping information back into the map, but in its new location
-  copyMapRegion(
-    local_map, 0, 0, cell_size_x, costmap_, start_x, start_y, size_x_, cell_size_x,
-    cell_size_y);
-
-  // make sure to clean up
-  delete[] local_map;
 }
 
 bool Costmap2D::setConvexPolygonCost(
@@ -417,6 +477,7 @@ bool Costmap2D::setConvexPolygonCost(
   convexFillCells(map_polygon, polygon_cells);
 
   // set the cost of those cells
+  detachBuffer();
   for (unsigned int i = 0; i < polygon_cells.size(); ++i) {
     unsigned int index = getIndex(polygon_cells[i].x, polygon_cells[i].y);
     costmap_[index] = cost_value;
@@ -68,6 +68,14 @@ float g_colors_a[] = {0.0f, 0.5f, 1.0f};
 V_Cell g_marked;
 V_Cell g_unknown;
 
+// Cache of the last scanned grid and the clouds built from it, so unchanged
+// grids are republished without rescanning every voxel
+std::vector<uint32_t> g_last_data;
+double g_last_origin[3];
+sensor_msgs::msg::PointCloud2 g_marked_cloud;
+sensor_msgs::msg::PointCloud2 g_unknown_cloud;
+bool g_clouds_valid = false;
+
 rclcpp::Node::SharedPtr g_node;
 
 rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr pub_marked;
@@ -81,17 +89,17 @@ rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr pub_unknown;
  * @param g_cells contains the x, y, z values that needs to be added to the PointCloud2
  */
 void pointCloud2Helper(
-  std::unique_ptr<sensor_msgs::msg::PointCloud2> & cloud,
+  sensor_msgs::msg::PointCloud2 & cloud,
   uint32_t num_channels,
   std_msgs::msg::Header header,
   V_Cell & g_cells)
 {
-  cloud->header = header;
-  cloud->width = num_channels;
-  cloud->height = 1;
-  cloud->is_dense = true;
-  cloud->is_bigendian = false;
-  sensor_msgs::PointCloud2Modifier modifier(*cloud);
+  cloud.header = header;
+  cloud.width = num_channels;
+  cloud.height = 1;
+  cloud.is_dense = true;
+  cloud.is_bigendian = false;
+  sensor_msgs::PointCloud2Modifier modifier(cloud);
 
   modifier.setPointCloud2Fields(
     6, "x", 1, sensor_msgs::msg::PointField::FLOAT32,
@@ -101,13 +109,13 @@ void pointCloud2Helper(
     "g", 1, sensor_msgs::msg::PointField::UINT8,
     "b", 1, sensor_msgs::msg::PointField::UINT8);
 
-  sensor_msgs::PointCloud2Iterator<float> iter_x(*cloud, "x");
-  sensor_msgs::PointCloud2Iterator<float> iter_y(*cloud, "y");
-  sensor_msgs::PointCloud2Iterator<float> iter_z(*cloud, "z");
+  sensor_msgs::PointCloud2Iterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(cloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(cloud, "z");
 
-  sensor_msgs::PointCloud2Iterator<uint8_t> iter_r(*cloud, "r");
-  sensor_msgs::PointCloud2Iterator<uint8_t> iter_g(*cloud, "g");
-  sensor_msgs::PointCloud2Iterator<uint8_t> iter_b(*cloud, "b");
+  sensor_msgs::PointCloud2Iterator<uint8_t> iter_r(cloud, "r");
+  sensor_msgs::PointCloud2Iterator<uint8_t> iter_g(cloud, "g");
+  sensor_msgs::PointCloud2Iterator<uint8_t> iter_b(cloud, "b");
 
   for (uint32_t i = 0; i < num_channels; ++i) {
     Cell & c = g_cells[i];
@@ -130,6 +138,15 @@ void pointCloud2Helper(
 
 void voxelCallback(const nav2_msgs::msg::VoxelGrid::ConstSharedPtr grid)
 {
+  const bool marked_wanted = pub_marked->get_subscription_count() > 0;
+  const bool unknown_wanted = pub_unknown->get_subscription_count() > 0;
+  if (!marked_wanted && !unknown_wanted) {
+    // Nobody is listening: drop the grid without scanning it, and force a
+    // rebuild once a subscriber shows up again
+    g_clouds_valid = false;
+    return;
+  }
+
   if (grid->data.empty()) {
     RCLCPP_ERROR(g_node->get_logger(), "Received empty voxel grid");
     return;
@@ -152,6 +169,26 @@ void voxelCallback(const nav2_msgs::msg::VoxelGrid::ConstSharedPtr grid)
   const uint32_t y_size = grid->size_y;
   const uint32_t z_size = grid->size_z;
 
+  std_msgs::msg::Header pcl_header;
+  pcl_header.frame_id = frame_id;
+  pcl_header.stamp = stamp;
+
+  const bool grid_changed = !g_clouds_valid || grid->data != g_last_data ||
+    x_origin != g_last_origin[0] || y_origin != g_last_origin[1] ||
+    z_origin != g_last_origin[2];
+  if (!grid_changed) {
+    // Same grid as the last cycle: reuse the cached clouds, only restamped
+    g_marked_cloud.header = pcl_header;
+    g_unknown_cloud.header = pcl_header;
+    if (marked_wanted) {
+      pub_marked->publish(g_marked_cloud);
+    }
+    if (unknown_wanted) {
+      pub_unknown->publish(g_unknown_cloud);
+    }
+    return;
+  }
+
   g_marked.clear();
   g_unknown.clear();
   uint32_t num_marked = 0;
@@ -188,20 +225,19 @@ void voxelCallback(const nav2_msgs::msg::VoxelGrid::ConstSharedPtr grid)
     }
   }
 
-  std_msgs::msg::Header pcl_header;
-  pcl_header.frame_id = frame_id;
-  pcl_header.stamp = stamp;
+  pointCloud2Helper(g_marked_cloud, num_marked, pcl_header, g_marked);
+  pointCloud2Helper(g_unknown_cloud, num_unknown, pcl_header, g_unknown);
+  g_last_data = grid->data;
+  g_last_origin[0] = x_origin;
+  g_last_origin[1] = y_origin;
+  g_last_origin[2] = z_origin;
+  g_clouds_valid = true;
 
-  {
-    auto cloud = std::make_unique<sensor_msgs::msg::PointCloud2>();
-    pointCloud2Helper(cloud, num_marked, pcl_header, g_marked);
-    pub_marked->publish(std::move(cloud));
+  if (marked_wanted) {
+    pub_marked->publish(g_marked_cloud);
   }
-
-  {
-    auto cloud = std::make_unique<sensor_msgs::msg::PointCloud2>();
-    pointCloud2Helper(cloud, num_unknown, pcl_header, g_unknown);
-    pub_unknown->publish(std::move(cloud));
+  if (unknown_wanted) {
+    pub_unknown->publish(g_unknown_cloud);
   }
 
   timer.end();
@@ -62,11 +62,26 @@ float g_colors_b[] = {0.0f, 1.0f, 0.0f};
 float g_colors_a[] = {0.0f, 0.5f, 1.0f};
 
 V_Cell g_cells;
+
+// Cache of the last scanned grid and the marker built from it, so unchanged
+// grids are republished without rescanning every voxel
+std::vector<uint32_t> g_last_data;
+double g_last_origin[3];
+visualization_msgs::msg::Marker g_marker;
+bool g_marker_valid = false;
+
 rclcpp::Node::SharedPtr g_node;
 rclcpp::Publisher<visualization_msgs::msg::Marker>::SharedPtr pub;
 
 void voxelCallback(const nav2_msgs::msg::VoxelGrid::ConstSharedPtr grid)
 {
+  if (pub->get_subscription_count() == 0) {
+    // Nobody is listening: drop the grid without scanning it, and force a
+    // rebuild once a subscriber shows up again
+    g_marker_valid = false;
+    return;
+  }
+
   if (grid->data.empty()) {
     RCLCPP_ERROR(g_node->get_logger(), "Received voxel grid");
     return;
@@ -90,6 +105,17 @@ void voxelCallback(const nav2_msgs::msg::VoxelGrid::ConstSharedPtr grid)
   const uint32_t y_size = grid->size_y;
   const uint32_t z_size = grid->size_z;
 
+  if (g_marker_valid && grid->data == g_last_data &&
+    x_origin == g_last_origin[0] && y_origin == g_last_origin[1] &&
+    z_origin == g_last_origin[2])
+  {
+    // Same grid as the last cycle: reuse the cached marker, only restamped
+    g_marker.header.frame_id = frame_id;
+    g_marker.header.stamp = stamp;
+    pub->publish(g_marker);
+    return;
+  }
+
   g_cells.clear();
   uint32_t num_markers = 0;
   for (uint32_t y_grid = 0; y_grid < y_size; ++y_grid) {
@@ -113,31 +139,35 @@ void voxelCallback(const nav2_msgs::msg::VoxelGrid::ConstSharedPtr grid)
     }
   }
 
-  auto m = std::make_unique<visualization_msgs::msg::Marker>();
-  m->header.frame_id = frame_id;
-  m->header.stamp = stamp;
-  m->ns = g_node->get_namespace();
-  m->id = 0;
-  m->type = visualization_msgs::msg::Marker::CUBE_LIST;
-  m->action = visualization_msgs::msg::Marker::ADD;
-  m->pose.orientation.w = 1.0;
-  m->scale.x = x_res;
-  m->scale.y = y_res;
-  m->scale.z = z_res;
-  m->color.r = g_colors_r[nav2_voxel_grid::MARKED];
-  m->color.g = g_colors_g[nav2_voxel_grid::MARKED];
-  m->color.b = g_colors_b[nav2_voxel_grid::MARKED];
-  m->color.a = g_colors_a[nav2_voxel_grid::MARKED];
-  m->points.resize(num_markers);
+  g_marker.header.frame_id = frame_id;
+  g_marker.header.stamp = stamp;
+  g_marker.ns = g_node->get_namespace();
+  g_marker.id = 0;
+  g_marker.type = visualization_msgs::msg::Marker::CUBE_LIST;
+  g_marker.action = visualization_msgs::msg::Marker::ADD;
+  g_marker.pose.orientation.w = 1.0;
+  g_marker.scale.x = x_res;
+  g_marker.scale.y = y_res;
+  g_marker.scale.z = z_res;
+  g_marker.color.r = g_colors_r[nav2_voxel_grid::MARKED];
+  g_marker.color.g = g_colors_g[nav2_voxel_grid::MARKED];
+  g_marker.color.b = g_colors_b[nav2_voxel_grid::MARKED];
+  g_marker.color.a = g_colors_a[nav2_voxel_grid::MARKED];
+  g_marker.points.resize(num_markers);
   for (uint32_t i = 0; i < num_markers; ++i) {
     Cell & c = g_cells[i];
-    geometry_msgs::msg::Point & p = m->points[i];
+    geometry_msgs::msg::Point & p = g_marker.points[i];
     p.x = c.x;
     p.y = c.y;
     p.z = c.z;
   }
+  g_last_data = grid->data;
+  g_last_origin[0] = x_origin;
+  g_last_origin[1] = y_origin;
+  g_last_origin[2] = z_origin;
+  g_marker_valid = true;
 
-  pub->publish(std::move(m));
+  pub->publish(g_marker);
 
   timer.end();
   RCLCPP_INFO(
@@ -219,12 +219,46 @@ std::unique_ptr<nav2_msgs::msg::CostmapUpdate> Costmap2DPublisher::createCostmap
   msg->y = y0_;
   msg->size_x = xn_ - x0_;
   msg->size_y = yn_ - y0_;
-  msg->data.resize(msg->size_x * msg->size_y);
 
-  std::uint32_t i = 0;
-  for (std::uint32_t y = y0_; y < yn_; y++) {
+  const std::uint32_t raw_size = msg->size_x * msg->size_y;
+
+  // Try to run-length encode the window first: costmap windows are dominated
+  // by large uniform regions (free space, unknown), so the delta usually
+  // shrinks by orders of magnitude. If the encoding would not be smaller than
+  // the raw window, fall back to sending it raw.
+  msg->encoding = nav2_msgs::msg::CostmapUpdate::ENCODING_RLE;
+  msg->data.reserve(256);
+  std::uint32_t run_length = 0;
+  std::uint8_t run_value = 0;
+  for (std::uint32_t y = y0_; y < yn_ && msg->data.size() < raw_size; y++) {
     for (std::uint32_t x = x0_; x < xn_; x++) {
-      msg->data[i++] = costmap_->getCost(x, y);
+      const std::uint8_t cost = costmap_->getCost(x, y);
+      if (run_length > 0 && cost == run_value && run_length < 256) {
+        ++run_length;
+      } else {
+        if (run_length > 0) {
+          msg->data.push_back(static_cast<std::uint8_t>(run_length - 1));
+          msg->data.push_back(run_value);
+        }
+        run_value = cost;
+        run_length = 1;
+      }
+    }
+  }
+  if (run_length > 0) {
+    msg->data.push_back(static_cast<std::uint8_t>(run_length - 1));
+    msg->data.push_back(run_value);
+  }
+
+  if (msg->data.size() >= raw_size) {
+    msg->encoding = nav2_msgs::msg::CostmapUpdate::ENCODING_RAW;
+    msg->data.clear();
+    msg->data.resize(raw_size);
+    std::uint32_t i = 0;
+    for (std::uint32_t y = y0_; y < yn_; y++) {
+      for (std::uint32_t x = x0_; x < xn_; x++) {
+        msg->data[i++] = costmap_->getCost(x, y);
+      }
     }
   }
   return msg;
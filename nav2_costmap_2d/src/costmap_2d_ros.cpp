@@ -115,10 +115,13 @@ void Costmap2DROS::init()
   declare_parameter("global_frame", rclcpp::ParameterValue(std::string("map")));
   declare_parameter("height", rclcpp::ParameterValue(5));
   declare_parameter("width", rclcpp::ParameterValue(5));
+  declare_parameter("lazy_activation", rclcpp::ParameterValue(false));
   declare_parameter("lethal_cost_threshold", rclcpp::ParameterValue(100));
   declare_parameter("observation_sources", rclcpp::ParameterValue(std::string("")));
   declare_parameter("origin_x", rclcpp::ParameterValue(0.0));
   declare_parameter("origin_y", rclcpp::ParameterValue(0.0));
+  declare_parameter("parallel_update_threads", rclcpp::ParameterValue(0));
+  declare_parameter("timing_diagnostics", rclcpp::ParameterValue(false));
   declare_parameter("plugins", rclcpp::ParameterValue(default_plugins_));
   declare_parameter("filters", rclcpp::ParameterValue(std::vector<std::string>()));
   declare_parameter("publish_frequency", rclcpp::ParameterValue(1.0));
@@ -158,6 +161,10 @@ Costmap2DROS::on_configure(const rclcpp_lifecycle::State & /*state*/)
   layered_costmap_ = std::make_unique<LayeredCostmap>(
     global_frame_, rolling_window_, track_unknown_space_);
 
+  if (parallel_update_threads_ > 0) {
+    layered_costmap_->setParallelUpdate(static_cast<unsigned int>(parallel_update_threads_));
+  }
+
   if (!layered_costmap_->isSizeLocked()) {
     layered_costmap_->resizeMap(
       (unsigned int)(map_width_meters_ / resolution_),
@@ -259,6 +266,16 @@ Costmap2DROS::on_configure(const rclcpp_lifecycle::State & /*state*/)
   // Add cleaning service
   clear_costmap_service_ = std::make_unique<ClearCostmapService>(shared_from_this(), *this);
 
+  if (timing_diagnostics_) {
+    layered_costmap_->setTimingEnabled(true);
+    timing_pub_ = create_publisher<nav2_msgs::msg::CostmapTiming>(
+      "timing_diagnostics", rclcpp::SystemDefaultsQoS());
+    get_timing_service_ = create_service<nav2_msgs::srv::GetCostmapTiming>(
+      "get_timing_" + getName(),
+      std::bind(&Costmap2DROS::getTimingCallback, this, std::placeholders::_1,
+        std::placeholders::_2, std::placeholders::_3));
+  }
+
   executor_ = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
   executor_->add_callback_group(callback_group_, get_node_base_interface());
   executor_thread_ = std::make_unique<nav2_util::NodeThread>(executor_);
@@ -308,6 +325,9 @@ Costmap2DROS::on_activate(const rclcpp_lifecycle::State & /*state*/)
 
   // Activate publishers
   footprint_pub_->on_activate();
+  if (timing_pub_) {
+    timing_pub_->on_activate();
+  }
   costmap_publisher_->on_activate();
 
   for (auto & layer_pub : layer_publishers_) {
@@ -348,6 +368,9 @@ Costmap2DROS::on_deactivate(const rclcpp_lifecycle::State & /*state*/)
   }
 
   footprint_pub_->on_deactivate();
+  if (timing_pub_) {
+    timing_pub_->on_deactivate();
+  }
   costmap_publisher_->on_deactivate();
 
   for (auto & layer_pub : layer_publishers_) {
@@ -365,6 +388,8 @@ Costmap2DROS::on_cleanup(const rclcpp_lifecycle::State & /*state*/)
 
   costmap_publisher_.reset();
   clear_costmap_service_.reset();
+  get_timing_service_.reset();
+  timing_pub_.reset();
 
   layer_publishers_.clear();
 
@@ -397,8 +422,11 @@ Costmap2DROS::getParameters()
   get_parameter("footprint_padding", footprint_padding_);
   get_parameter("global_frame", global_frame_);
   get_parameter("height", map_height_meters_);
+  get_parameter("lazy_activation", lazy_activation_);
   get_parameter("origin_x", origin_x_);
   get_parameter("origin_y", origin_y_);
+  get_parameter("parallel_update_threads", parallel_update_threads_);
+  get_parameter("timing_diagnostics", timing_diagnostics_);
   get_parameter("publish_frequency", map_publish_frequency_);
   get_parameter("resolution", resolution_);
   get_parameter("robot_base_frame", robot_base_frame_);
@@ -488,7 +516,7 @@ void
 Costmap2DROS::getOrientedFootprint(std::vector<geometry_msgs::msg::Point> & oriented_footprint)
 {
   geometry_msgs::msg::PoseStamped global_pose;
-  if (!getRobotPose(global_pose)) {
+  if (!getCachedRobotPose(global_pose) && !getRobotPose(global_pose)) {
     return;
   }
 
@@ -526,6 +554,17 @@ Costmap2DROS::mapUpdateLoop(double frequency)
       timer.end();
 
       RCLCPP_DEBUG(get_logger(), "Map update time: %.9f", timer.elapsed_time_in_seconds());
+
+      if (timing_pub_ && timing_pub_->is_activated() &&
+        timing_pub_->get_subscription_count() > 0)
+      {
+        auto timing_msg = std::make_unique<nav2_msgs::msg::CostmapTiming>();
+        timing_msg->header.frame_id = global_frame_;
+        timing_msg->header.stamp = now();
+        timing_msg->layers = layered_costmap_->getTimingStats();
+        timing_pub_->publish(std::move(timing_msg));
+      }
+
       if (publish_cycle_ > rclcpp::Duration(0s) && layered_costmap_->isInitialized()) {
         unsigned int x0, y0, xn, yn;
         layered_costmap_->getBounds(&x0, &xn, &y0, &yn);
@@ -567,19 +606,60 @@ Costmap2DROS::mapUpdateLoop(double frequency)
   }
 }
 
+void
+Costmap2DROS::updateCostmapSnapshot()
+{
+  // Nobody asked for snapshots yet, don't pay for the copy
+  if (!snapshots_requested_.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  // Double buffering: alternate between two backing costmaps so that in the
+  // common case the copy reuses memory from two cycles ago. If a reader still
+  // holds that snapshot, it keeps its (consistent) copy and we allocate anew.
+  snapshot_buffer_index_ ^= 1;
+  auto & buffer = snapshot_buffers_[snapshot_buffer_index_];
+  if (!buffer || buffer.use_count() > 1) {
+    buffer = std::make_shared<Costmap2D>();
+  }
+
+  {
+    Costmap2D * costmap = layered_costmap_->getCostmap();
+    std::unique_lock<Costmap2D::mutex_t> lock(*(costmap->getMutex()));
+    *buffer = *costmap;
+  }
+
+  std::atomic_store(&costmap_snapshot_, std::shared_ptr<const Costmap2D>(buffer));
+}
+
+std::shared_ptr<const Costmap2D>
+Costmap2DROS::getCostmapSnapshot()
+{
+  snapshots_requested_.store(true, std::memory_order_relaxed);
+  return std::atomic_load(&costmap_snapshot_);
+}
+
 void
 Costmap2DROS::updateMap()
 {
   RCLCPP_DEBUG(get_logger(), "Updating map...");
 
   if (!stop_updates_) {
-    // get global pose
+    // get global pose, once per cycle: everything downstream, including the
+    // plugins via layered_costmap_->updateMap(x, y, yaw), works off this pose
     geometry_msgs::msg::PoseStamped pose;
     if (getRobotPose(pose)) {
+      {
+        std::scoped_lock<std::mutex> lock(robot_pose_mutex_);
+        cached_robot_pose_ = pose;
+        robot_pose_cached_ = true;
+      }
+
       const double & x = pose.pose.position.x;
       const double & y = pose.pose.position.y;
       const double yaw = tf2::getYaw(pose.pose.orientation);
       layered_costmap_->updateMap(x, y, yaw);
+      updateCostmapSnapshot();
 
       auto footprint = std::make_unique<geometry_msgs::msg::PolygonStamped>();
       footprint->header = pose.header;
@@ -592,6 +672,24 @@ Costmap2DROS::updateMap()
   }
 }
 
+void
+Costmap2DROS::updateMapRegion(double min_x, double min_y, double max_x, double max_y)
+{
+  // Only worth a synchronous pass while the first full update is outstanding;
+  // afterwards the regular update loop keeps the whole map fresh
+  if (initialized_) {
+    return;
+  }
+
+  std::scoped_lock<std::mutex> lock(_dynamic_parameter_mutex);
+  if (initialized_ || stopped_ || stop_updates_) {
+    return;
+  }
+
+  layered_costmap_->clampNextUpdate(min_x, min_y, max_x, max_y);
+  updateMap();
+}
+
 void
 Costmap2DROS::start()
 {
@@ -618,6 +716,13 @@ Costmap2DROS::start()
   }
   stop_updates_ = false;
 
+  if (lazy_activation_) {
+    // Don't hold up activation for the first full-map update; it completes
+    // on the map update thread, and callers that can't wait for it can pull
+    // their region forward through updateMapRegion() in the meantime
+    return;
+  }
+
   // block until the costmap is re-initialized.. meaning one update cycle has run
   rclcpp::Rate r(20.0);
   while (rclcpp::ok() && !initialized_) {
@@ -650,6 +755,10 @@ Costmap2DROS::stop()
   }
   initialized_ = false;
   stopped_ = true;
+
+  // don't serve the last cycle's pose while no cycles are running
+  std::scoped_lock<std::mutex> lock(robot_pose_mutex_);
+  robot_pose_cached_ = false;
 }
 
 void
@@ -657,6 +766,9 @@ Costmap2DROS::pause()
 {
   stop_updates_ = true;
   initialized_ = false;
+
+  std::scoped_lock<std::mutex> lock(robot_pose_mutex_);
+  robot_pose_cached_ = false;
 }
 
 void
@@ -700,6 +812,17 @@ Costmap2DROS::getRobotPose(geometry_msgs::msg::PoseStamped & global_pose)
     global_frame_, robot_base_frame_, transform_tolerance_);
 }
 
+bool
+Costmap2DROS::getCachedRobotPose(geometry_msgs::msg::PoseStamped & global_pose)
+{
+  std::scoped_lock<std::mutex> lock(robot_pose_mutex_);
+  if (!robot_pose_cached_) {
+    return false;
+  }
+  global_pose = cached_robot_pose_;
+  return true;
+}
+
 bool
 Costmap2DROS::transformPoseToGlobalFrame(
   const geometry_msgs::msg::PoseStamped & input_pose,
@@ -854,4 +977,14 @@ void Costmap2DROS::getCostCallback(
   }
 }
 
+void Costmap2DROS::getTimingCallback(
+  const std::shared_ptr<rmw_request_id_t>,
+  const std::shared_ptr<nav2_msgs::srv::GetCostmapTiming::Request>/*request*/,
+  const std::shared_ptr<nav2_msgs::srv::GetCostmapTiming::Response> response)
+{
+  response->timing.header.frame_id = global_frame_;
+  response->timing.header.stamp = now();
+  response->timing.layers = layered_costmap_->getTimingStats();
+}
+
 }  // namespace nav2_costmap_2d
@@ -37,8 +37,10 @@
  *********************************************************************/
 
 #include <nav2_costmap_2d/costmap_layer.hpp>
+#include <nav2_costmap_2d/cost_combination_kernels.hpp>
 #include <stdexcept>
 #include <algorithm>
+#include <cstring>
 
 namespace nav2_costmap_2d
 {
@@ -119,20 +121,13 @@ void CostmapLayer::updateWithMax(
   unsigned char * master_array = master_grid.getCharMap();
   unsigned int span = master_grid.getSizeInCellsX();
 
+  if (max_i <= min_i) {
+    return;
+  }
+
   for (int j = min_j; j < max_j; j++) {
     unsigned int it = j * span + min_i;
-    for (int i = min_i; i < max_i; i++) {
-      if (costmap_[it] == NO_INFORMATION) {
-        it++;
-        continue;
-      }
-
-      unsigned char old_cost = master_array[it];
-      if (old_cost == NO_INFORMATION || old_cost < costmap_[it]) {
-        master_array[it] = costmap_[it];
-      }
-      it++;
-    }
+    kernels::combineRow<kernels::MaxKernel>(master_array + it, costmap_ + it, max_i - min_i);
   }
 }
 
@@ -148,20 +143,14 @@ void CostmapLayer::updateWithMaxWithoutUnknownOverwrite(
   unsigned char * master_array = master_grid.getCharMap();
   unsigned int span = master_grid.getSizeInCellsX();
 
+  if (max_i <= min_i) {
+    return;
+  }
+
   for (int j = min_j; j < max_j; j++) {
     unsigned int it = j * span + min_i;
-    for (int i = min_i; i < max_i; i++) {
-      if (costmap_[it] == NO_INFORMATION) {
-        it++;
-        continue;
-      }
-
-      unsigned char old_cost = master_array[it];
-      if (old_cost != NO_INFORMATION && old_cost < costmap_[it]) {
-        master_array[it] = costmap_[it];
-      }
-      it++;
-    }
+    kernels::combineRow<kernels::MaxWithoutUnknownOverwriteKernel>(
+      master_array + it, costmap_ + it, max_i - min_i);
   }
 }
 
@@ -182,12 +171,13 @@ void CostmapLayer::updateWithTrueOverwrite(
   unsigned char * master = master_grid.getCharMap();
   unsigned int span = master_grid.getSizeInCellsX();
 
+  if (max_i <= min_i) {
+    return;
+  }
+
   for (int j = min_j; j < max_j; j++) {
     unsigned int it = span * j + min_i;
-    for (int i = min_i; i < max_i; i++) {
-      master[it] = costmap_[it];
-      it++;
-    }
+    std::memcpy(master + it, costmap_ + it, max_i - min_i);
   }
 }
 
@@ -201,14 +191,13 @@ void CostmapLayer::updateWithOverwrite(
   unsigned char * master = master_grid.getCharMap();
   unsigned int span = master_grid.getSizeInCellsX();
 
+  if (max_i <= min_i) {
+    return;
+  }
+
   for (int j = min_j; j < max_j; j++) {
     unsigned int it = span * j + min_i;
-    for (int i = min_i; i < max_i; i++) {
-      if (costmap_[it] != NO_INFORMATION) {
-        master[it] = costmap_[it];
-      }
-      it++;
-    }
+    kernels::combineRow<kernels::OverwriteKernel>(master + it, costmap_ + it, max_i - min_i);
   }
 }
 
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <string>
 #include <memory>
 #include <mutex>
@@ -22,6 +23,7 @@ namespace nav2_costmap_2d
 {
 
 constexpr int costmapUpdateQueueDepth = 10;
+constexpr size_t updatedRegionHistoryDepth = 20;
 
 CostmapSubscriber::CostmapSubscriber(
   const nav2_util::LifecycleNode::WeakPtr & parent,
@@ -68,8 +70,55 @@ std::shared_ptr<Costmap2D> CostmapSubscriber::getCostmap()
   return costmap_;
 }
 
+UpdatedRegion CostmapSubscriber::getUpdatedRegion(unsigned int since_epoch)
+{
+  std::lock_guard<std::mutex> lock(updated_regions_mutex_);
+  UpdatedRegion region;
+  region.epoch = update_count_;
+  region.full = false;
+  if (since_epoch < updated_region_floor_) {
+    // The history no longer reaches back that far
+    region.full = true;
+    return region;
+  }
+  bool merged = false;
+  for (const auto & entry : updated_regions_) {
+    if (entry.epoch <= since_epoch) {
+      continue;
+    }
+    if (entry.full) {
+      region.full = true;
+      return region;
+    }
+    if (!merged) {
+      region.x0 = entry.x0;
+      region.y0 = entry.y0;
+      region.xn = entry.xn;
+      region.yn = entry.yn;
+      merged = true;
+    } else {
+      region.x0 = std::min(region.x0, entry.x0);
+      region.y0 = std::min(region.y0, entry.y0);
+      region.xn = std::max(region.xn, entry.xn);
+      region.yn = std::max(region.yn, entry.yn);
+    }
+  }
+  return region;
+}
+
+void CostmapSubscriber::recordUpdatedRegion(const UpdatedRegion & region)
+{
+  std::lock_guard<std::mutex> lock(updated_regions_mutex_);
+  updated_regions_.push_back(region);
+  while (updated_regions_.size() > updatedRegionHistoryDepth) {
+    updated_region_floor_ = updated_regions_.front().epoch;
+    updated_regions_.pop_front();
+  }
+}
+
 void CostmapSubscriber::costmapCallback(const nav2_msgs::msg::Costmap::SharedPtr msg)
 {
+  recordUpdatedRegion({++update_count_, true, 0, 0, 0, 0});
   {
     std::lock_guard<std::mutex> lock(costmap_msg_mutex_);
     costmap_msg_ = msg;
@@ -87,6 +136,7 @@ void CostmapSubscriber::costmapCallback(const nav2_msgs::msg::Costmap::SharedPtr
 void CostmapSubscriber::costmapUpdateCallback(
   const nav2_msgs::msg::CostmapUpdate::SharedPtr update_msg)
 {
+  const unsigned int epoch = ++update_count_;
   if (isCostmapReceived()) {
     if (costmap_msg_) {
       processCurrentCostmapMsg();
@@ -106,15 +156,44 @@ void CostmapSubscriber::costmapUpdateCallback(
         update_msg->x, update_msg->y, update_msg->size_x, update_msg->size_y);
       return;
     }
+    // Recorded before applying so a partially applied update is still covered
+    recordUpdatedRegion(
+      {epoch, false, update_msg->x, update_msg->y,
+        update_msg->x + update_msg->size_x, update_msg->y + update_msg->size_y});
     unsigned char * master_array = costmap_->getCharMap();
-    // copy update msg row-wise
-    for (size_t y = 0; y < update_msg->size_y; ++y) {
-      auto starting_index_of_row_update_in_costmap = (y + update_msg->y) * map_cell_size_x +
-        update_msg->x;
-
-      std::copy_n(
-        update_msg->data.begin() + (y * update_msg->size_x),
-        update_msg->size_x, &master_array[starting_index_of_row_update_in_costmap]);
+    if (update_msg->encoding == nav2_msgs::msg::CostmapUpdate::ENCODING_RLE) {
+      // expand the run-length encoded window, runs continue across rows
+      size_t cell = 0;
+      const size_t window_size = static_cast<size_t>(update_msg->size_x) * update_msg->size_y;
+      for (size_t i = 0; i + 1 < update_msg->data.size(); i += 2) {
+        size_t run = static_cast<size_t>(update_msg->data[i]) + 1;
+        const unsigned char value = update_msg->data[i + 1];
+        if (cell + run > window_size) {
+          RCLCPP_WARN(logger_, "RLE update does not match its window size, dropping");
+          return;
+        }
+        while (run > 0) {
+          const size_t y = cell / update_msg->size_x;
+          const size_t x = cell % update_msg->size_x;
+          const size_t row_remainder = std::min(
+            run, static_cast<size_t>(update_msg->size_x) - x);
+          std::fill_n(
+            &master_array[(y + update_msg->y) * map_cell_size_x + update_msg->x + x],
+            row_remainder, value);
+          cell += row_remainder;
+          run -= row_remainder;
+        }
+      }
+    } else {
+      // copy update msg row-wise
+      for (size_t y = 0; y < update_msg->size_y; ++y) {
+        auto starting_index_of_row_update_in_costmap = (y + update_msg->y) * map_cell_size_x +
+          update_msg->x;
+
+        std::copy_n(
+          update_msg->data.begin() + (y * update_msg->size_x),
+          update_msg->size_x, &master_array[starting_index_of_row_update_in_costmap]);
+      }
     }
   } else {
     RCLCPP_WARN(logger_, "No costmap received.");
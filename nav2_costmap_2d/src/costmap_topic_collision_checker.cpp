@@ -32,6 +32,9 @@ using namespace std::chrono_literals;
 namespace nav2_costmap_2d
 {
 
+// Heading discretization of the precomputed footprint kernel (5 degree bins)
+static constexpr unsigned int kScorePosesHeadings = 72;
+
 CostmapTopicCollisionChecker::CostmapTopicCollisionChecker(
   CostmapSubscriber & costmap_sub,
   FootprintSubscriber & footprint_sub,
@@ -63,6 +66,33 @@ bool CostmapTopicCollisionChecker::isCollisionFree(
   }
 }
 
+std::vector<double> CostmapTopicCollisionChecker::scorePoses(
+  const std::vector<geometry_msgs::msg::Pose2D> & poses)
+{
+  std::shared_ptr<Costmap2D> costmap;
+  try {
+    costmap = costmap_sub_.getCostmap();
+  } catch (const std::runtime_error & e) {
+    throw CollisionCheckerException(e.what());
+  }
+  collision_checker_.setCostmap(costmap);
+
+  std_msgs::msg::Header header;
+  if (!footprint_sub_.getFootprintInRobotFrame(footprint_, header)) {
+    throw CollisionCheckerException("Current footprint not available.");
+  }
+
+  // Rebuild the offset kernel only when the footprint or the map resolution
+  // changed since the last batch
+  if (footprint_ != kernel_footprint_ || costmap->getResolution() != kernel_resolution_) {
+    collision_checker_.precomputeFootprintOffsets(footprint_, kScorePosesHeadings);
+    kernel_footprint_ = footprint_;
+    kernel_resolution_ = costmap->getResolution();
+  }
+
+  return collision_checker_.footprintCostBatch(poses);
+}
+
 double CostmapTopicCollisionChecker::scorePose(
   const geometry_msgs::msg::Pose2D & pose,
   bool fetch_costmap_and_footprint)
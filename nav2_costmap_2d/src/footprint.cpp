@@ -111,11 +111,17 @@ void transformFootprint(
   double x, double y, double theta,
   const std::vector<geometry_msgs::msg::Point> & footprint_spec,
   std::vector<geometry_msgs::msg::Point> & oriented_footprint)
+{
+  transformFootprint(x, y, cos(theta), sin(theta), footprint_spec, oriented_footprint);
+}
+
+void transformFootprint(
+  double x, double y, double cos_th, double sin_th,
+  const std::vector<geometry_msgs::msg::Point> & footprint_spec,
+  std::vector<geometry_msgs::msg::Point> & oriented_footprint)
 {
   // build the oriented footprint at a given location
   oriented_footprint.resize(footprint_spec.size());
-  double cos_th = cos(theta);
-  double sin_th = sin(theta);
   for (unsigned int i = 0; i < footprint_spec.size(); ++i) {
     double new_x = x + (footprint_spec[i].x * cos_th - footprint_spec[i].y * sin_th);
     double new_y = y + (footprint_spec[i].x * sin_th + footprint_spec[i].y * cos_th);
@@ -125,20 +131,35 @@ void transformFootprint(
   }
 }
 
+void transformFootprints(
+  const std::vector<geometry_msgs::msg::Pose2D> & poses,
+  const std::vector<geometry_msgs::msg::Point> & footprint_spec,
+  std::vector<std::vector<geometry_msgs::msg::Point>> & oriented_footprints)
+{
+  oriented_footprints.resize(poses.size());
+  for (unsigned int i = 0; i < poses.size(); ++i) {
+    const geometry_msgs::msg::Pose2D & pose = poses[i];
+    transformFootprint(
+      pose.x, pose.y, cos(pose.theta), sin(pose.theta),
+      footprint_spec, oriented_footprints[i]);
+  }
+}
+
 void transformFootprint(
   double x, double y, double theta,
   const std::vector<geometry_msgs::msg::Point> & footprint_spec,
   geometry_msgs::msg::PolygonStamped & oriented_footprint)
 {
-  // build the oriented footprint at a given location
-  oriented_footprint.polygon.points.clear();
+  // build the oriented footprint at a given location, reusing the point
+  // buffer when the caller keeps the message around
+  oriented_footprint.polygon.points.resize(footprint_spec.size());
   double cos_th = cos(theta);
   double sin_th = sin(theta);
   for (unsigned int i = 0; i < footprint_spec.size(); ++i) {
-    geometry_msgs::msg::Point32 new_pt;
+    geometry_msgs::msg::Point32 & new_pt = oriented_footprint.polygon.points[i];
     new_pt.x = x + (footprint_spec[i].x * cos_th - footprint_spec[i].y * sin_th);
     new_pt.y = y + (footprint_spec[i].x * sin_th + footprint_spec[i].y * cos_th);
-    oriented_footprint.polygon.points.push_back(new_pt);
+    new_pt.z = 0.0f;
   }
 }
 
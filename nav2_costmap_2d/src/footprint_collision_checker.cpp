@@ -90,8 +90,12 @@ double FootprintCollisionChecker<CostmapT>::lineCost(int x0, int x1, int y0, int
   double line_cost = 0.0;
   double point_cost = -1.0;
 
+  // Bounds were established by the worldToMap calls above; the view
+  // turns the per-cell lookups into pointer arithmetic
+  const Costmap2D::RegionView view = costmap_->getRegionView();
+
   for (nav2_util::LineIterator line(x0, y0, x1, y1); line.isValid(); line.advance()) {
-    point_cost = pointCost(line.getX(), line.getY());   // Score the current point
+    point_cost = static_cast<double>(view(line.getX(), line.getY()));   // Score the current point
 
     // if in collision, no need to continue
     if (point_cost == static_cast<double>(LETHAL_OBSTACLE)) {
@@ -143,6 +147,99 @@ double FootprintCollisionChecker<CostmapT>::footprintCostAtPose(
   return footprintCost(oriented_footprint);
 }
 
+template<typename CostmapT>
+void FootprintCollisionChecker<CostmapT>::precomputeFootprintOffsets(
+  const Footprint & footprint, unsigned int num_headings)
+{
+  const double resolution = costmap_->getResolution();
+  footprint_offsets_.clear();
+  footprint_offsets_.resize(num_headings);
+
+  for (unsigned int bin = 0; bin < num_headings; ++bin) {
+    const double theta = bin * 2.0 * M_PI / num_headings;
+    const double cos_th = cos(theta);
+    const double sin_th = sin(theta);
+
+    // Rotate the footprint and express its vertices as cell offsets from
+    // the robot cell, then rasterize the outline in offset space
+    std::vector<std::pair<int, int>> vertices;
+    vertices.reserve(footprint.size());
+    for (const auto & pt : footprint) {
+      const double ox = pt.x * cos_th - pt.y * sin_th;
+      const double oy = pt.x * sin_th + pt.y * cos_th;
+      vertices.emplace_back(
+        static_cast<int>(std::round(ox / resolution)),
+        static_cast<int>(std::round(oy / resolution)));
+    }
+
+    auto & cells = footprint_offsets_[bin];
+    for (unsigned int i = 0; i < vertices.size(); ++i) {
+      const auto & from = vertices[i];
+      const auto & to = vertices[(i + 1) % vertices.size()];
+      for (nav2_util::LineIterator line(from.first, from.second, to.first, to.second);
+        line.isValid(); line.advance())
+      {
+        cells.emplace_back(line.getX(), line.getY());
+      }
+    }
+
+    std::sort(cells.begin(), cells.end());
+    cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+  }
+}
+
+template<typename CostmapT>
+double FootprintCollisionChecker<CostmapT>::footprintCostAtPoseCached(
+  double x, double y, double theta)
+{
+  unsigned int cx, cy;
+  if (!worldToMap(x, y, cx, cy)) {
+    return static_cast<double>(LETHAL_OBSTACLE);
+  }
+
+  // pick the offsets precomputed for the nearest discretized heading
+  const unsigned int num_headings = footprint_offsets_.size();
+  double wrapped = std::fmod(theta, 2.0 * M_PI);
+  if (wrapped < 0.0) {
+    wrapped += 2.0 * M_PI;
+  }
+  const unsigned int bin =
+    static_cast<unsigned int>(std::round(wrapped * num_headings / (2.0 * M_PI))) % num_headings;
+
+  const Costmap2D::RegionView view = costmap_->getRegionView();
+  const int size_x = static_cast<int>(costmap_->getSizeInCellsX());
+  const int size_y = static_cast<int>(costmap_->getSizeInCellsY());
+  double footprint_cost = 0.0;
+  for (const auto & offset : footprint_offsets_[bin]) {
+    const int mx = static_cast<int>(cx) + offset.first;
+    const int my = static_cast<int>(cy) + offset.second;
+    if (mx < 0 || my < 0 || mx >= size_x || my >= size_y) {
+      return static_cast<double>(LETHAL_OBSTACLE);
+    }
+
+    footprint_cost = std::max(static_cast<double>(view(mx, my)), footprint_cost);
+
+    // if in collision, no need to continue
+    if (footprint_cost == static_cast<double>(LETHAL_OBSTACLE)) {
+      return footprint_cost;
+    }
+  }
+
+  return footprint_cost;
+}
+
+template<typename CostmapT>
+std::vector<double> FootprintCollisionChecker<CostmapT>::footprintCostBatch(
+  const std::vector<geometry_msgs::msg::Pose2D> & poses)
+{
+  std::vector<double> costs;
+  costs.reserve(poses.size());
+  for (const auto & pose : poses) {
+    costs.push_back(footprintCostAtPoseCached(pose.x, pose.y, pose.theta));
+  }
+  return costs;
+}
+
 // declare our valid template parameters
 template class FootprintCollisionChecker<std::shared_ptr<nav2_costmap_2d::Costmap2D>>;
 template class FootprintCollisionChecker<nav2_costmap_2d::Costmap2D *>;
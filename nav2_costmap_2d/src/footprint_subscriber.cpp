@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cmath>
 #include <string>
 #include <vector>
 #include <memory>
@@ -95,9 +96,14 @@ FootprintSubscriber::getFootprintInRobotFrame(
   double y = current_pose.pose.position.y;
   double theta = tf2::getYaw(current_pose.pose.orientation);
 
-  std::vector<geometry_msgs::msg::Point> temp;
-  transformFootprint(-x, -y, 0, footprint, temp);
-  transformFootprint(0, 0, -theta, temp, footprint);
+  // apply R(-theta) * (pt - p) in one pass by rotating the translation into
+  // the precomputed-rotation variant, instead of a translate then a rotate
+  double cos_th = cos(theta);
+  double sin_th = sin(theta);
+  std::vector<geometry_msgs::msg::Point> temp = footprint;
+  transformFootprint(
+    -(cos_th * x + sin_th * y), sin_th * x - cos_th * y,
+    cos_th, -sin_th, temp, footprint);
 
   footprint_header.frame_id = robot_base_frame_;
   footprint_header.stamp = current_pose.header.stamp;
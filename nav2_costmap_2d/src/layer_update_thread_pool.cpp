@@ -0,0 +1,109 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_costmap_2d/layer_update_thread_pool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace nav2_costmap_2d
+{
+
+LayerUpdateThreadPool::LayerUpdateThreadPool(unsigned int num_threads)
+{
+  num_threads = std::max(1u, num_threads);
+  workers_.reserve(num_threads);
+  for (unsigned int i = 0; i < num_threads; ++i) {
+    workers_.emplace_back(&LayerUpdateThreadPool::workerLoop, this);
+  }
+}
+
+LayerUpdateThreadPool::~LayerUpdateThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    shutdown_ = true;
+  }
+  work_available_.notify_all();
+  for (auto & worker : workers_) {
+    worker.join();
+  }
+}
+
+void LayerUpdateThreadPool::execute(const std::vector<std::function<void()>> & tasks)
+{
+  if (tasks.empty()) {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  first_exception_ = nullptr;
+  for (const auto & task : tasks) {
+    queue_.push_back(task);
+    ++in_flight_;
+  }
+  work_available_.notify_all();
+
+  // Help drain the batch from the calling thread rather than idling,
+  // then wait for any tasks still running on the workers.
+  while (runOneTask(lock)) {
+  }
+  batch_done_.wait(lock, [this]() {return in_flight_ == 0;});
+
+  if (first_exception_) {
+    std::exception_ptr e = first_exception_;
+    first_exception_ = nullptr;
+    std::rethrow_exception(e);
+  }
+}
+
+bool LayerUpdateThreadPool::runOneTask(std::unique_lock<std::mutex> & lock)
+{
+  if (queue_.empty()) {
+    return false;
+  }
+  std::function<void()> task = std::move(queue_.front());
+  queue_.pop_front();
+
+  lock.unlock();
+  std::exception_ptr exception;
+  try {
+    task();
+  } catch (...) {
+    exception = std::current_exception();
+  }
+  lock.lock();
+
+  if (exception && !first_exception_) {
+    first_exception_ = exception;
+  }
+  if (--in_flight_ == 0) {
+    batch_done_.notify_all();
+  }
+  return true;
+}
+
+void LayerUpdateThreadPool::workerLoop()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    work_available_.wait(lock, [this]() {return shutdown_ || !queue_.empty();});
+    if (shutdown_ && queue_.empty()) {
+      return;
+    }
+    runOneTask(lock);
+  }
+}
+
+}  // namespace nav2_costmap_2d
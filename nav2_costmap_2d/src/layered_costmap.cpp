@@ -38,13 +38,17 @@
 #include "nav2_costmap_2d/layered_costmap.hpp"
 
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstdio>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 #include <limits>
 
 #include "nav2_costmap_2d/footprint.hpp"
+#include "nav2_util/trace.hpp"
 
 
 using std::vector;
@@ -52,6 +56,9 @@ using std::vector;
 namespace nav2_costmap_2d
 {
 
+static constexpr char kUpdateBoundsPhase[] = "update_bounds";
+static constexpr char kUpdateCostsPhase[] = "update_costs";
+
 LayeredCostmap::LayeredCostmap(std::string global_frame, bool rolling_window, bool track_unknown)
 : primary_costmap_(), combined_costmap_(),
   global_frame_(global_frame),
@@ -65,6 +72,7 @@ LayeredCostmap::LayeredCostmap(std::string global_frame, bool rolling_window, bo
   bxn_(0),
   by0_(0),
   byn_(0),
+  update_count_(0),
   initialized_(false),
   size_locked_(false),
   circumscribed_radius_(1.0),
@@ -124,6 +132,69 @@ void LayeredCostmap::resizeMap(
   }
 }
 
+void LayeredCostmap::setParallelUpdate(unsigned int num_threads)
+{
+  std::unique_lock<Costmap2D::mutex_t> lock(*(combined_costmap_.getMutex()));
+  if (num_threads == 0) {
+    update_pool_.reset();
+  } else if (!update_pool_ || update_pool_->size() != num_threads) {
+    update_pool_ = std::make_unique<LayerUpdateThreadPool>(num_threads);
+  }
+}
+
+void LayeredCostmap::setTimingEnabled(bool enabled)
+{
+  std::lock_guard<std::mutex> guard(timing_mutex_);
+  timing_enabled_ = enabled;
+  if (!enabled) {
+    timing_rings_.clear();
+  }
+}
+
+void LayeredCostmap::recordTiming(
+  const std::string & layer_name, const char * phase,
+  const std::chrono::steady_clock::time_point & start)
+{
+  const double seconds =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::lock_guard<std::mutex> guard(timing_mutex_);
+  TimingRing & ring = timing_rings_[layer_name + "/" + phase];
+  ring.samples[ring.next] = seconds;
+  ring.next = (ring.next + 1) % ring.samples.size();
+  ring.count = std::min(ring.count + 1, ring.samples.size());
+  ring.last = seconds;
+}
+
+std::vector<nav2_msgs::msg::LayerTiming> LayeredCostmap::getTimingStats() const
+{
+  std::lock_guard<std::mutex> guard(timing_mutex_);
+  std::vector<nav2_msgs::msg::LayerTiming> stats;
+  stats.reserve(timing_rings_.size());
+
+  for (const auto & entry : timing_rings_) {
+    nav2_msgs::msg::LayerTiming timing;
+    const size_t split = entry.first.rfind('/');
+    timing.layer_name = entry.first.substr(0, split);
+    timing.phase = entry.first.substr(split + 1);
+
+    const TimingRing & ring = entry.second;
+    double sum = 0.0;
+    double max = 0.0;
+    for (size_t i = 0; i < ring.count; ++i) {
+      sum += ring.samples[i];
+      max = std::max(max, ring.samples[i]);
+    }
+    timing.last_time = ring.last;
+    timing.mean_time = ring.count > 0 ? sum / ring.count : 0.0;
+    timing.max_time = max;
+    timing.sample_count = ring.count;
+    stats.push_back(timing);
+  }
+
+  return stats;
+}
+
 bool LayeredCostmap::isOutofBounds(double robot_x, double robot_y)
 {
   unsigned int mx, my;
@@ -136,6 +207,8 @@ void LayeredCostmap::updateMap(double robot_x, double robot_y, double robot_yaw)
   // implement thread unsafe updateBounds() functions.
   std::unique_lock<Costmap2D::mutex_t> lock(*(combined_costmap_.getMutex()));
 
+  NAV2_TRACE("costmap", "update_map_begin", update_count_ + 1);
+
   // if we're using a rolling buffer costmap...
   // we need to update the origin using the robot's position
   if (rolling_window_) {
@@ -158,22 +231,104 @@ void LayeredCostmap::updateMap(double robot_x, double robot_y, double robot_yaw)
   minx_ = miny_ = std::numeric_limits<double>::max();
   maxx_ = maxy_ = std::numeric_limits<double>::lowest();
 
-  for (vector<std::shared_ptr<Layer>>::iterator plugin = plugins_.begin();
-    plugin != plugins_.end(); ++plugin)
-  {
-    double prev_minx = minx_;
-    double prev_miny = miny_;
-    double prev_maxx = maxx_;
-    double prev_maxy = maxy_;
-    (*plugin)->updateBounds(robot_x, robot_y, robot_yaw, &minx_, &miny_, &maxx_, &maxy_);
-    if (minx_ > prev_minx || miny_ > prev_miny || maxx_ < prev_maxx || maxy_ < prev_maxy) {
-      RCLCPP_WARN(
-        rclcpp::get_logger(
-          "nav2_costmap_2d"), "Illegal bounds change, was [tl: (%f, %f), br: (%f, %f)], but "
-        "is now [tl: (%f, %f), br: (%f, %f)]. The offending layer is %s",
-        prev_minx, prev_miny, prev_maxx, prev_maxy,
-        minx_, miny_, maxx_, maxy_,
-        (*plugin)->getName().c_str());
+  if (update_pool_ && plugins_.size() > 1) {
+    // Each plugin only touches its own state in updateBounds(), so layers
+    // that only ever grow the bounding box can expand their bounds
+    // concurrently: every task starts from the same empty seed bounds and
+    // the results are merged by union afterwards, which matches the
+    // sequential pass for such layers. Layers that read the bounds
+    // accumulated by the layers before them (e.g. inflation, which pads the
+    // window of the layers it inflates by its radius) are held back and run
+    // sequentially on the merged union, preserving that dependency.
+    std::vector<size_t> coupled;
+    std::vector<std::array<double, 4>> bounds(
+      plugins_.size(), {minx_, miny_, maxx_, maxy_});
+    std::vector<std::function<void()>> tasks;
+    tasks.reserve(plugins_.size());
+    for (size_t i = 0; i < plugins_.size(); ++i) {
+      if (plugins_[i]->isBoundsCoupled()) {
+        coupled.push_back(i);
+        continue;
+      }
+      tasks.emplace_back(
+        [this, i, robot_x, robot_y, robot_yaw, &bounds]() {
+          const auto start = std::chrono::steady_clock::now();
+          plugins_[i]->updateBounds(
+            robot_x, robot_y, robot_yaw,
+            &bounds[i][0], &bounds[i][1], &bounds[i][2], &bounds[i][3]);
+          if (timing_enabled_) {
+            recordTiming(plugins_[i]->getName(), kUpdateBoundsPhase, start);
+          }
+        });
+    }
+    update_pool_->execute(tasks);
+    for (size_t i = 0; i < plugins_.size(); ++i) {
+      if (plugins_[i]->isBoundsCoupled()) {
+        continue;
+      }
+      // The union merge cannot shrink the accumulated bounds, but a layer
+      // that produced an inverted box would have shrunk them in the
+      // sequential pass, so flag it the same way
+      const auto & b = bounds[i];
+      const bool touched = b[0] != std::numeric_limits<double>::max() ||
+        b[1] != std::numeric_limits<double>::max() ||
+        b[2] != std::numeric_limits<double>::lowest() ||
+        b[3] != std::numeric_limits<double>::lowest();
+      if (touched && (b[0] > b[2] || b[1] > b[3])) {
+        RCLCPP_WARN(
+          rclcpp::get_logger(
+            "nav2_costmap_2d"), "Illegal bounds change, layer returned "
+          "[tl: (%f, %f), br: (%f, %f)]. The offending layer is %s",
+          b[0], b[1], b[2], b[3],
+          plugins_[i]->getName().c_str());
+      }
+      minx_ = std::min(minx_, b[0]);
+      miny_ = std::min(miny_, b[1]);
+      maxx_ = std::max(maxx_, b[2]);
+      maxy_ = std::max(maxy_, b[3]);
+    }
+    for (const size_t i : coupled) {
+      double prev_minx = minx_;
+      double prev_miny = miny_;
+      double prev_maxx = maxx_;
+      double prev_maxy = maxy_;
+      const auto start = std::chrono::steady_clock::now();
+      plugins_[i]->updateBounds(robot_x, robot_y, robot_yaw, &minx_, &miny_, &maxx_, &maxy_);
+      if (timing_enabled_) {
+        recordTiming(plugins_[i]->getName(), kUpdateBoundsPhase, start);
+      }
+      if (minx_ > prev_minx || miny_ > prev_miny || maxx_ < prev_maxx || maxy_ < prev_maxy) {
+        RCLCPP_WARN(
+          rclcpp::get_logger(
+            "nav2_costmap_2d"), "Illegal bounds change, was [tl: (%f, %f), br: (%f, %f)], but "
+          "is now [tl: (%f, %f), br: (%f, %f)]. The offending layer is %s",
+          prev_minx, prev_miny, prev_maxx, prev_maxy,
+          minx_, miny_, maxx_, maxy_,
+          plugins_[i]->getName().c_str());
+      }
+    }
+  } else {
+    for (vector<std::shared_ptr<Layer>>::iterator plugin = plugins_.begin();
+      plugin != plugins_.end(); ++plugin)
+    {
+      double prev_minx = minx_;
+      double prev_miny = miny_;
+      double prev_maxx = maxx_;
+      double prev_maxy = maxy_;
+      const auto start = std::chrono::steady_clock::now();
+      (*plugin)->updateBounds(robot_x, robot_y, robot_yaw, &minx_, &miny_, &maxx_, &maxy_);
+      if (timing_enabled_) {
+        recordTiming((*plugin)->getName(), kUpdateBoundsPhase, start);
+      }
+      if (minx_ > prev_minx || miny_ > prev_miny || maxx_ < prev_maxx || maxy_ < prev_maxy) {
+        RCLCPP_WARN(
+          rclcpp::get_logger(
+            "nav2_costmap_2d"), "Illegal bounds change, was [tl: (%f, %f), br: (%f, %f)], but "
+          "is now [tl: (%f, %f), br: (%f, %f)]. The offending layer is %s",
+          prev_minx, prev_miny, prev_maxx, prev_maxy,
+          minx_, miny_, maxx_, maxy_,
+          (*plugin)->getName().c_str());
+      }
     }
   }
   for (vector<std::shared_ptr<Layer>>::iterator filter = filters_.begin();
@@ -183,7 +338,11 @@ void LayeredCostmap::updateMap(double robot_x, double robot_y, double robot_yaw)
     double prev_miny = miny_;
     double prev_maxx = maxx_;
     double prev_maxy = maxy_;
+    const auto start = std::chrono::steady_clock::now();
     (*filter)->updateBounds(robot_x, robot_y, robot_yaw, &minx_, &miny_, &maxx_, &maxy_);
+    if (timing_enabled_) {
+      recordTiming((*filter)->getName(), kUpdateBoundsPhase, start);
+    }
     if (minx_ > prev_minx || miny_ > prev_miny || maxx_ < prev_maxx || maxy_ < prev_maxy) {
       RCLCPP_WARN(
         rclcpp::get_logger(
@@ -195,6 +354,35 @@ void LayeredCostmap::updateMap(double robot_x, double robot_y, double robot_yaw)
     }
   }
 
+  if (clamp_next_update_) {
+    // Stash the full dirty area so a later unclamped pass completes it, then
+    // only recombine costs inside the requested window this cycle
+    if (has_pending_bounds_) {
+      pending_minx_ = std::min(pending_minx_, minx_);
+      pending_miny_ = std::min(pending_miny_, miny_);
+      pending_maxx_ = std::max(pending_maxx_, maxx_);
+      pending_maxy_ = std::max(pending_maxy_, maxy_);
+    } else {
+      pending_minx_ = minx_;
+      pending_miny_ = miny_;
+      pending_maxx_ = maxx_;
+      pending_maxy_ = maxy_;
+      has_pending_bounds_ = true;
+    }
+    minx_ = std::max(minx_, clamp_minx_);
+    miny_ = std::max(miny_, clamp_miny_);
+    maxx_ = std::min(maxx_, clamp_maxx_);
+    maxy_ = std::min(maxy_, clamp_maxy_);
+    clamp_next_update_ = false;
+  } else if (has_pending_bounds_) {
+    // Fold the leftovers of earlier clamped updates back in
+    minx_ = std::min(minx_, pending_minx_);
+    miny_ = std::min(miny_, pending_miny_);
+    maxx_ = std::max(maxx_, pending_maxx_);
+    maxy_ = std::max(maxy_, pending_maxy_);
+    has_pending_bounds_ = false;
+  }
+
   int x0, xn, y0, yn;
   combined_costmap_.worldToMapEnforceBounds(minx_, miny_, x0, y0);
   combined_costmap_.worldToMapEnforceBounds(maxx_, maxy_, xn, yn);
@@ -218,7 +406,11 @@ void LayeredCostmap::updateMap(double robot_x, double robot_y, double robot_yaw)
     for (vector<std::shared_ptr<Layer>>::iterator plugin = plugins_.begin();
       plugin != plugins_.end(); ++plugin)
     {
+      const auto start = std::chrono::steady_clock::now();
       (*plugin)->updateCosts(combined_costmap_, x0, y0, xn, yn);
+      if (timing_enabled_) {
+        recordTiming((*plugin)->getName(), kUpdateCostsPhase, start);
+      }
     }
   } else {
     // Costmap Filters enabled
@@ -227,7 +419,11 @@ void LayeredCostmap::updateMap(double robot_x, double robot_y, double robot_yaw)
     for (vector<std::shared_ptr<Layer>>::iterator plugin = plugins_.begin();
       plugin != plugins_.end(); ++plugin)
     {
+      const auto start = std::chrono::steady_clock::now();
       (*plugin)->updateCosts(primary_costmap_, x0, y0, xn, yn);
+      if (timing_enabled_) {
+        recordTiming((*plugin)->getName(), kUpdateCostsPhase, start);
+      }
     }
 
     // 2. Copy processed costmap window to a final costmap.
@@ -245,7 +441,11 @@ void LayeredCostmap::updateMap(double robot_x, double robot_y, double robot_yaw)
     for (vector<std::shared_ptr<Layer>>::iterator filter = filters_.begin();
       filter != filters_.end(); ++filter)
     {
+      const auto start = std::chrono::steady_clock::now();
       (*filter)->updateCosts(combined_costmap_, x0, y0, xn, yn);
+      if (timing_enabled_) {
+        recordTiming((*filter)->getName(), kUpdateCostsPhase, start);
+      }
     }
   }
 
@@ -253,10 +453,23 @@ void LayeredCostmap::updateMap(double robot_x, double robot_y, double robot_yaw)
   bxn_ = xn;
   by0_ = y0;
   byn_ = yn;
+  update_count_++;
+
+  NAV2_TRACE("costmap", "update_map_end", update_count_);
 
   initialized_ = true;
 }
 
+void LayeredCostmap::clampNextUpdate(double min_x, double min_y, double max_x, double max_y)
+{
+  std::unique_lock<Costmap2D::mutex_t> lock(*(combined_costmap_.getMutex()));
+  clamp_next_update_ = true;
+  clamp_minx_ = min_x;
+  clamp_miny_ = min_y;
+  clamp_maxx_ = max_x;
+  clamp_maxy_ = max_y;
+}
+
 bool LayeredCostmap::isCurrent()
 {
   current_ = true;
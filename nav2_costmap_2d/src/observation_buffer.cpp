@@ -38,12 +38,15 @@
 
 #include <algorithm>
 #include <list>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 #include <chrono>
 
 #include "tf2/convert.h"
 #include "sensor_msgs/point_cloud2_iterator.hpp"
+#include "nav2_costmap_2d/observation_spatial_index.hpp"
 using namespace std::chrono_literals;
 
 namespace nav2_costmap_2d
@@ -68,24 +71,135 @@ ObservationBuffer::ObservationBuffer(
   min_obstacle_height_(min_obstacle_height), max_obstacle_height_(max_obstacle_height),
   obstacle_max_range_(obstacle_max_range), obstacle_min_range_(obstacle_min_range),
   raytrace_max_range_(raytrace_max_range), raytrace_min_range_(
-    raytrace_min_range), tf_tolerance_(tf_tolerance)
+    raytrace_min_range), tf_tolerance_(tf_tolerance),
+  expiry_slot_width_ns_(
+    std::max<int64_t>(
+      observation_keep_time_.nanoseconds() / static_cast<int64_t>(expiry_wheel_slots_), 1))
 {
   auto node = parent.lock();
   clock_ = node->get_clock();
   logger_ = node->get_logger();
   last_updated_ = node->now();
+  expiry_cursor_time_ = last_updated_;
 }
 
 ObservationBuffer::~ObservationBuffer()
 {
+  if (async_worker_.joinable()) {
+    {
+      std::lock_guard<std::mutex> guard(async_mutex_);
+      async_shutdown_ = true;
+    }
+    async_cv_.notify_all();
+    async_worker_.join();
+  }
+}
+
+void ObservationBuffer::enableAsyncTransform()
+{
+  async_worker_ = std::thread(&ObservationBuffer::asyncWorkerLoop, this);
+}
+
+void ObservationBuffer::bufferCloudAsync(
+  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud)
+{
+  {
+    std::lock_guard<std::mutex> guard(async_mutex_);
+    // keep the queue shallow: under a sustained TF stall it is better to
+    // drop the oldest cloud than to fall ever further behind the sensor
+    if (async_queue_.size() >= 10) {
+      async_queue_.pop_front();
+    }
+    async_queue_.push_back(cloud);
+  }
+  async_cv_.notify_one();
+}
+
+void ObservationBuffer::asyncWorkerLoop()
+{
+  while (true) {
+    sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud;
+    {
+      std::unique_lock<std::mutex> guard(async_mutex_);
+      async_cv_.wait(guard, [this] {return async_shutdown_ || !async_queue_.empty();});
+      if (async_shutdown_) {
+        return;
+      }
+      cloud = async_queue_.front();
+      async_queue_.pop_front();
+    }
+
+    // the transform - and any TF wait - happens here, off the sensor
+    // callback and without holding the observation list lock
+    bufferCloud(cloud);
+  }
+}
+
+void ObservationBuffer::bufferCloud(const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud)
+{
+  // If the cloud already lives in the global frame and every point passes the
+  // height bounds, the incoming message can be shared as-is without
+  // transforming or copying any point data
+  if (cloud->header.frame_id == global_frame_ &&
+    (sensor_frame_.empty() || sensor_frame_ == global_frame_))
+  {
+    bool all_in_bounds = true;
+    for (sensor_msgs::PointCloud2ConstIterator<float> iter_z(*cloud, "z");
+      iter_z != iter_z.end(); ++iter_z)
+    {
+      if (*iter_z > max_obstacle_height_ || *iter_z < min_obstacle_height_) {
+        all_in_bounds = false;
+        break;
+      }
+    }
+
+    if (all_in_bounds) {
+      // the sensor origin is the origin of the (global) sensor frame
+      geometry_msgs::msg::Point origin;
+      Observation observation(
+        origin, cloud, obstacle_max_range_, obstacle_min_range_,
+        raytrace_max_range_, raytrace_min_range_);
+      observation.spatial_index_ = std::make_shared<ObservationSpatialIndex>(*cloud);
+      std::lock_guard<std::recursive_mutex> guard(lock_);
+      observation_list_.push_front(observation);
+      registerExpiry(observation_list_.begin());
+      last_updated_ = clock_->now();
+      purgeStaleObservations();
+      return;
+    }
+  }
+
+  bufferCloud(*cloud);
 }
 
 void ObservationBuffer::bufferCloud(const sensor_msgs::msg::PointCloud2 & cloud)
 {
-  geometry_msgs::msg::PointStamped global_origin;
+  Observation observation;
+
+  // do the transform - and any TF wait - before taking the buffer lock, so
+  // readers are never stalled behind TF
+  if (!transformAndFilterCloud(cloud, observation)) {
+    return;
+  }
+
+  // the index is built outside the lock as well, it only reads the new cloud
+  observation.spatial_index_ = std::make_shared<ObservationSpatialIndex>(*observation.cloud_);
 
-  // create a new observation on the list to be populated
-  observation_list_.push_front(Observation());
+  std::lock_guard<std::recursive_mutex> guard(lock_);
+  observation_list_.push_front(observation);
+  registerExpiry(observation_list_.begin());
+
+  // if the update was successful, we want to update the last updated time
+  last_updated_ = clock_->now();
+
+  // we'll also remove any stale observations from the list
+  purgeStaleObservations();
+}
+
+bool ObservationBuffer::transformAndFilterCloud(
+  const sensor_msgs::msg::PointCloud2 & cloud, Observation & observation)
+{
+  geometry_msgs::msg::PointStamped global_origin;
 
   // check whether the origin frame has been set explicitly
   // or whether we should get it from the cloud
@@ -101,14 +215,14 @@ void ObservationBuffer::bufferCloud(const sensor_msgs::msg::PointCloud2 & cloud)
     local_origin.point.y = 0;
     local_origin.point.z = 0;
     tf2_buffer_.transform(local_origin, global_origin, global_frame_, tf_tolerance_);
-    tf2::convert(global_origin.point, observation_list_.front().origin_);
+    tf2::convert(global_origin.point, observation.origin_);
 
     // make sure to pass on the raytrace/obstacle range
     // of the observation buffer to the observations
-    observation_list_.front().raytrace_max_range_ = raytrace_max_range_;
-    observation_list_.front().raytrace_min_range_ = raytrace_min_range_;
-    observation_list_.front().obstacle_max_range_ = obstacle_max_range_;
-    observation_list_.front().obstacle_min_range_ = obstacle_min_range_;
+    observation.raytrace_max_range_ = raytrace_max_range_;
+    observation.raytrace_min_range_ = raytrace_min_range_;
+    observation.obstacle_max_range_ = obstacle_max_range_;
+    observation.obstacle_min_range_ = obstacle_min_range_;
 
     sensor_msgs::msg::PointCloud2 global_frame_cloud;
 
@@ -117,58 +231,64 @@ void ObservationBuffer::bufferCloud(const sensor_msgs::msg::PointCloud2 & cloud)
     global_frame_cloud.header.stamp = cloud.header.stamp;
 
     // now we need to remove observations from the cloud that are below
-    // or above our height thresholds
-    sensor_msgs::msg::PointCloud2 & observation_cloud = *(observation_list_.front().cloud_);
-    observation_cloud.height = global_frame_cloud.height;
-    observation_cloud.width = global_frame_cloud.width;
-    observation_cloud.fields = global_frame_cloud.fields;
-    observation_cloud.is_bigendian = global_frame_cloud.is_bigendian;
-    observation_cloud.point_step = global_frame_cloud.point_step;
-    observation_cloud.row_step = global_frame_cloud.row_step;
-    observation_cloud.is_dense = global_frame_cloud.is_dense;
-
+    // or above our height thresholds; first count the points that pass
     unsigned int cloud_size = global_frame_cloud.height * global_frame_cloud.width;
-    sensor_msgs::PointCloud2Modifier modifier(observation_cloud);
-    modifier.resize(cloud_size);
     unsigned int point_count = 0;
-
-    // copy over the points that are within our height bounds
-    sensor_msgs::PointCloud2Iterator<float> iter_z(global_frame_cloud, "z");
-    std::vector<unsigned char>::const_iterator iter_global = global_frame_cloud.data.begin(),
-      iter_global_end = global_frame_cloud.data.end();
-    std::vector<unsigned char>::iterator iter_obs = observation_cloud.data.begin();
-    for (; iter_global != iter_global_end; ++iter_z, iter_global +=
-      global_frame_cloud.point_step)
+    for (sensor_msgs::PointCloud2ConstIterator<float> iter_z(global_frame_cloud, "z");
+      iter_z != iter_z.end(); ++iter_z)
     {
-      if ((*iter_z) <= max_obstacle_height_ &&
-        (*iter_z) >= min_obstacle_height_)
-      {
-        std::copy(iter_global, iter_global + global_frame_cloud.point_step, iter_obs);
-        iter_obs += global_frame_cloud.point_step;
+      if ((*iter_z) <= max_obstacle_height_ && (*iter_z) >= min_obstacle_height_) {
         ++point_count;
       }
     }
 
-    // resize the cloud for the number of legal points
-    modifier.resize(point_count);
-    observation_cloud.header.stamp = cloud.header.stamp;
-    observation_cloud.header.frame_id = global_frame_cloud.header.frame_id;
+    auto observation_cloud = std::make_shared<sensor_msgs::msg::PointCloud2>();
+    if (point_count == cloud_size) {
+      // nothing to filter, take the transformed cloud wholesale
+      *observation_cloud = std::move(global_frame_cloud);
+    } else {
+      observation_cloud->height = global_frame_cloud.height;
+      observation_cloud->width = global_frame_cloud.width;
+      observation_cloud->fields = global_frame_cloud.fields;
+      observation_cloud->is_bigendian = global_frame_cloud.is_bigendian;
+      observation_cloud->point_step = global_frame_cloud.point_step;
+      observation_cloud->row_step = global_frame_cloud.row_step;
+      observation_cloud->is_dense = global_frame_cloud.is_dense;
+
+      sensor_msgs::PointCloud2Modifier modifier(*observation_cloud);
+      modifier.resize(point_count);
+
+      // copy over the points that are within our height bounds
+      sensor_msgs::PointCloud2Iterator<float> iter_z(global_frame_cloud, "z");
+      std::vector<unsigned char>::const_iterator iter_global = global_frame_cloud.data.begin(),
+        iter_global_end = global_frame_cloud.data.end();
+      std::vector<unsigned char>::iterator iter_obs = observation_cloud->data.begin();
+      for (; iter_global != iter_global_end; ++iter_z, iter_global +=
+        global_frame_cloud.point_step)
+      {
+        if ((*iter_z) <= max_obstacle_height_ &&
+          (*iter_z) >= min_obstacle_height_)
+        {
+          std::copy(iter_global, iter_global + global_frame_cloud.point_step, iter_obs);
+          iter_obs += global_frame_cloud.point_step;
+        }
+      }
+
+      observation_cloud->header.stamp = cloud.header.stamp;
+      observation_cloud->header.frame_id = global_frame_cloud.header.frame_id;
+    }
+
+    observation.cloud_ = std::move(observation_cloud);
   } catch (tf2::TransformException & ex) {
-    // if an exception occurs, we need to remove the empty observation from the list
-    observation_list_.pop_front();
     RCLCPP_ERROR(
       logger_,
       "TF Exception that should never happen for sensor frame: %s, cloud frame: %s, %s",
       sensor_frame_.c_str(),
       cloud.header.frame_id.c_str(), ex.what());
-    return;
+    return false;
   }
 
-  // if the update was successful, we want to update the last updated time
-  last_updated_ = clock_->now();
-
-  // we'll also remove any stale observations from the list
-  purgeStaleObservations();
+  return true;
 }
 
 // returns a copy of the observations
@@ -184,29 +304,66 @@ void ObservationBuffer::getObservations(std::vector<Observation> & observations)
   }
 }
 
+void ObservationBuffer::registerExpiry(const std::list<Observation>::iterator & obs_it)
+{
+  // zero keep time means we only keep the latest observation,
+  // purgeStaleObservations() handles that without the wheel
+  if (observation_keep_time_ == rclcpp::Duration(0.0s)) {
+    return;
+  }
+
+  rclcpp::Time expiry = rclcpp::Time(obs_it->cloud_->header.stamp) + observation_keep_time_;
+
+  // an already stale cloud is filed under the purge cursor, so the very next
+  // purge visits it; its slot would otherwise not come up for a whole
+  // wheel revolution
+  const rclcpp::Time slot_time = std::max(expiry, expiry_cursor_time_);
+  const size_t slot =
+    static_cast<size_t>(slot_time.nanoseconds() / expiry_slot_width_ns_) % expiry_wheel_slots_;
+  expiry_wheel_[slot].push_back({expiry, obs_it});
+}
+
 void ObservationBuffer::purgeStaleObservations()
 {
-  if (!observation_list_.empty()) {
-    std::list<Observation>::iterator obs_it = observation_list_.begin();
-    // if we're keeping observations for no time... then we'll only keep one observation
-    if (observation_keep_time_ == rclcpp::Duration(0.0s)) {
-      observation_list_.erase(++obs_it, observation_list_.end());
-      return;
-    }
+  if (observation_list_.empty()) {
+    return;
+  }
 
-    // otherwise... we'll have to loop through the observations to see which ones are stale
-    for (obs_it = observation_list_.begin(); obs_it != observation_list_.end(); ++obs_it) {
-      Observation & obs = *obs_it;
-      // check if the observation is out of date... and if it is,
-      // remove it and those that follow from the list
-      if ((clock_->now() - obs.cloud_->header.stamp) >
-        observation_keep_time_)
-      {
-        observation_list_.erase(obs_it, observation_list_.end());
-        return;
+  // if we're keeping observations for no time... then we'll only keep one observation
+  if (observation_keep_time_ == rclcpp::Duration(0.0s)) {
+    observation_list_.erase(++observation_list_.begin(), observation_list_.end());
+    return;
+  }
+
+  const rclcpp::Time now = clock_->now();
+  if (now < expiry_cursor_time_) {
+    // the clock jumped backwards (e.g. a sim time reset), hold the
+    // observations until it catches back up to the cursor
+    return;
+  }
+
+  // drain only the wheel slots that elapsed since the previous purge; each
+  // expired observation is erased through its stored iterator, so a cycle
+  // costs O(slots elapsed + observations expired) rather than a scan of the
+  // whole buffer. The cursor slot is re-visited on the next purge, so
+  // entries sharing a slot but expiring later are not lost
+  const int64_t cursor_slot = expiry_cursor_time_.nanoseconds() / expiry_slot_width_ns_;
+  const int64_t now_slot = now.nanoseconds() / expiry_slot_width_ns_;
+  const int64_t num_slots = std::min<int64_t>(
+    now_slot - cursor_slot + 1, static_cast<int64_t>(expiry_wheel_slots_));
+  for (int64_t i = 0; i < num_slots; ++i) {
+    auto & slot = expiry_wheel_[(cursor_slot + i) % expiry_wheel_slots_];
+    for (auto entry_it = slot.begin(); entry_it != slot.end(); ) {
+      if (entry_it->expiry <= now) {
+        observation_list_.erase(entry_it->observation);
+        entry_it = slot.erase(entry_it);
+      } else {
+        // due a wheel revolution (or the tail of this slot) later
+        ++entry_it;
       }
     }
   }
+  expiry_cursor_time_ = now;
 }
 
 bool ObservationBuffer::isCurrent() const
@@ -0,0 +1,94 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_costmap_2d/observation_spatial_index.hpp"
+
+#include <algorithm>
+
+#include "sensor_msgs/point_cloud2_iterator.hpp"
+
+namespace nav2_costmap_2d
+{
+
+// Keeps the bucket grid small even for clouds with a degenerate extent
+// (e.g. stray far-away returns); the bucket size is grown to compensate
+static constexpr unsigned int kMaxBuckets = 4096;
+
+ObservationSpatialIndex::ObservationSpatialIndex(
+  const sensor_msgs::msg::PointCloud2 & cloud, double bucket_size)
+: bucket_size_(bucket_size)
+{
+  // first pass: find the finite XY extent of the cloud
+  double max_x = 0.0, max_y = 0.0;
+  bool found = false;
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(cloud, "y");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y) {
+    if (!std::isfinite(*iter_x) || !std::isfinite(*iter_y)) {
+      continue;
+    }
+    if (!found) {
+      min_x_ = max_x = *iter_x;
+      min_y_ = max_y = *iter_y;
+      found = true;
+    } else {
+      min_x_ = std::min(min_x_, static_cast<double>(*iter_x));
+      min_y_ = std::min(min_y_, static_cast<double>(*iter_y));
+      max_x = std::max(max_x, static_cast<double>(*iter_x));
+      max_y = std::max(max_y, static_cast<double>(*iter_y));
+    }
+  }
+
+  if (!found) {
+    return;
+  }
+
+  buckets_x_ = static_cast<unsigned int>((max_x - min_x_) / bucket_size_) + 1;
+  buckets_y_ = static_cast<unsigned int>((max_y - min_y_) / bucket_size_) + 1;
+  while (buckets_x_ * buckets_y_ > kMaxBuckets) {
+    bucket_size_ *= 2.0;
+    buckets_x_ = static_cast<unsigned int>((max_x - min_x_) / bucket_size_) + 1;
+    buckets_y_ = static_cast<unsigned int>((max_y - min_y_) / bucket_size_) + 1;
+  }
+
+  // second pass: count points per bucket, then prefix-sum into CSR offsets
+  bucket_starts_.assign(buckets_x_ * buckets_y_ + 1, 0);
+  sensor_msgs::PointCloud2ConstIterator<float> count_x(cloud, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> count_y(cloud, "y");
+  uint32_t num_points = 0;
+  for (; count_x != count_x.end(); ++count_x, ++count_y) {
+    if (std::isfinite(*count_x) && std::isfinite(*count_y)) {
+      bucket_starts_[bucketCoord(*count_y, min_y_) * buckets_x_ +
+        bucketCoord(*count_x, min_x_) + 1]++;
+      num_points++;
+    }
+  }
+  for (size_t b = 1; b < bucket_starts_.size(); ++b) {
+    bucket_starts_[b] += bucket_starts_[b - 1];
+  }
+
+  // third pass: scatter point indices into their buckets
+  point_indices_.resize(num_points);
+  std::vector<uint32_t> fill = bucket_starts_;
+  sensor_msgs::PointCloud2ConstIterator<float> fill_x(cloud, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> fill_y(cloud, "y");
+  for (uint32_t i = 0; fill_x != fill_x.end(); ++fill_x, ++fill_y, ++i) {
+    if (std::isfinite(*fill_x) && std::isfinite(*fill_y)) {
+      point_indices_[fill[bucketCoord(*fill_y, min_y_) * buckets_x_ +
+        bucketCoord(*fill_x, min_x_)]++] = i;
+    }
+  }
+}
+
+}  // namespace nav2_costmap_2d
@@ -0,0 +1,63 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_costmap_2d/obstacle_track_store.hpp"
+
+namespace nav2_costmap_2d
+{
+
+ObstacleTrackStore::ObstacleTrackStore(
+  double cell_size, double persistence_time, unsigned int min_observations)
+: cell_size_(cell_size),
+  persistence_time_(persistence_time),
+  min_observations_(min_observations)
+{
+}
+
+void ObstacleTrackStore::observe(double wx, double wy, const rclcpp::Time & stamp)
+{
+  Track & track = tracks_[keyOf(wx, wy)];
+  if (track.observations == 0) {
+    // freshly inserted by operator[]
+    track.wx = wx;
+    track.wy = wy;
+    track.last_seen = stamp;
+    track.observations = 1;
+    return;
+  }
+
+  // keep the most recent hit position within the cell so the re-marked
+  // point follows the obstacle as it creeps through the lattice
+  track.wx = wx;
+  track.wy = wy;
+  if (stamp > track.last_seen) {
+    track.last_seen = stamp;
+  }
+  if (track.observations < min_observations_) {
+    ++track.observations;
+  }
+}
+
+void ObstacleTrackStore::prune(const rclcpp::Time & now)
+{
+  for (auto it = tracks_.begin(); it != tracks_.end(); ) {
+    if ((now - it->second.last_seen).seconds() > persistence_time_) {
+      it = tracks_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace nav2_costmap_2d
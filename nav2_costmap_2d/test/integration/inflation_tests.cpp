@@ -33,10 +33,12 @@
  */
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <cmath>
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "nav2_costmap_2d/costmap_2d.hpp"
@@ -599,6 +601,47 @@ TEST_F(TestNode, testInflation3)
   ASSERT_EQ(countValues(*costmap, nav2_costmap_2d::INSCRIBED_INFLATED_OBSTACLE), 4u);
 }
 
+/**
+ * Test that a footprint change after startup is recomputed asynchronously
+ * and lands within a few update cycles, without ever losing the tables
+ */
+TEST_F(TestNode, testFootprintChangeAsyncRecompute)
+{
+  initNode(4.1);
+  tf2_ros::Buffer tf(node_->get_clock());
+  nav2_costmap_2d::LayeredCostmap layers("frame", false, false);
+  layers.resizeMap(10, 10, 1, 0, 0);
+
+  // Footprint with inscribed radius = 1.0
+  std::vector<Point> polygon = setRadii(layers, 1, 1);
+
+  std::shared_ptr<nav2_costmap_2d::ObstacleLayer> olayer = nullptr;
+  addObstacleLayer(layers, tf, node_, olayer);
+
+  std::shared_ptr<nav2_costmap_2d::InflationLayer> ilayer = nullptr;
+  addInflationLayer(layers, tf, node_, ilayer);
+  layers.setFootprint(polygon);
+
+  addObservation(olayer, 0, 0, MAX_Z);
+  layers.updateMap(0, 0, 0);
+  nav2_costmap_2d::Costmap2D * costmap = layers.getCostmap();
+  EXPECT_TRUE(costmap->getCost(2, 0) < nav2_costmap_2d::INSCRIBED_INFLATED_OBSTACLE);
+
+  // Grow the footprint to inscribed radius = 2.1, as padding adjustment
+  // tooling would; the tables rebuild on the worker and are swapped in at
+  // the start of a later cycle
+  setRadii(layers, 2.1, 2.3);
+  bool applied = false;
+  for (int i = 0; i < 500 && !applied; ++i) {
+    layers.updateMap(0, 0, 0);
+    applied =
+      costmap->getCost(2, 0) == nav2_costmap_2d::INSCRIBED_INFLATED_OBSTACLE;
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+  EXPECT_TRUE(applied);
+  EXPECT_EQ(nav2_costmap_2d::LETHAL_OBSTACLE, costmap->getCost(0, 0));
+}
+
 /**
  * Test dynamic parameter setting of inflation layer
  */
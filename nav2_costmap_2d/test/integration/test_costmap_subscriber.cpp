@@ -190,6 +190,55 @@ TEST_F(TestCostmapSubscriberShould, handleCostmapUpdateMsgs)
   costmapPublisher->on_deactivate();
 }
 
+TEST_F(TestCostmapSubscriberShould, reportUpdatedRegionAndEpoch)
+{
+  bool always_send_full_costmap = false;
+
+  auto costmapPublisher = std::make_shared<nav2_costmap_2d::Costmap2DPublisher>(
+    node, costmapToSend.get(), "", topicName, always_send_full_costmap);
+  costmapPublisher->on_activate();
+
+  // Before anything is received the whole grid counts as changed
+  auto region = costmapSubscriber->getUpdatedRegion(0);
+  ASSERT_TRUE(region.full);
+
+  // The initial full costmap marks everything changed again
+  const auto & fullChange = mapChanges[0];
+  for (const auto & observation : fullChange.observations) {
+    costmapToSend->setCost(observation.x, observation.y, observation.cost);
+  }
+  costmapPublisher->updateBounds(fullChange.x0, fullChange.xn, fullChange.y0, fullChange.yn);
+  costmapPublisher->publishCostmap();
+  rclcpp::spin_some(node->get_node_base_interface());
+
+  region = costmapSubscriber->getUpdatedRegion(region.epoch);
+  ASSERT_TRUE(region.full);
+
+  // An update patch is reported with its exact cell bounds
+  const auto & updateChange = mapChanges[1];
+  for (const auto & observation : updateChange.observations) {
+    costmapToSend->setCost(observation.x, observation.y, observation.cost);
+  }
+  costmapPublisher->updateBounds(
+    updateChange.x0, updateChange.xn, updateChange.y0, updateChange.yn);
+  costmapPublisher->publishCostmap();
+  rclcpp::spin_some(node->get_node_base_interface());
+
+  region = costmapSubscriber->getUpdatedRegion(region.epoch);
+  ASSERT_FALSE(region.full);
+  EXPECT_EQ(region.x0, updateChange.x0);
+  EXPECT_EQ(region.xn, updateChange.xn);
+  EXPECT_EQ(region.y0, updateChange.y0);
+  EXPECT_EQ(region.yn, updateChange.yn);
+
+  // Nothing new since the previous query
+  region = costmapSubscriber->getUpdatedRegion(region.epoch);
+  ASSERT_FALSE(region.full);
+  EXPECT_EQ(region.x0, region.xn);
+
+  costmapPublisher->on_deactivate();
+}
+
 TEST_F(
   TestCostmapSubscriberShould,
   throwExceptionIfGetCostmapMethodIsCalledBeforeAnyCostmapMsgReceived)
@@ -19,6 +19,7 @@
 
 #include "gtest/gtest.h"
 #include "rclcpp/rclcpp.hpp"
+#include "nav2_costmap_2d/cost_values.hpp"
 #include "nav2_costmap_2d/costmap_topic_collision_checker.hpp"
 #include "nav2_costmap_2d/costmap_2d.hpp"
 #include "nav2_costmap_2d/layered_costmap.hpp"
@@ -203,6 +204,17 @@ public:
     return collision_checker_->isCollisionFree(pose);
   }
 
+  std::vector<double> testPoseBatch(const std::vector<geometry_msgs::msg::Pose2D> & poses)
+  {
+    rclcpp::Time stamp = now();
+    publishPose(poses.front().x, poses.front().y, poses.front().theta, stamp);
+    setPose(poses.front().x, poses.front().y, poses.front().theta, stamp);
+    publishFootprint();
+    publishCostmap();
+    rclcpp::sleep_for(std::chrono::milliseconds(1000));
+    return collision_checker_->scorePoses(poses);
+  }
+
   void setFootprint(double footprint_padding, double robot_radius)
   {
     std::vector<geometry_msgs::msg::Point> new_footprint;
@@ -362,3 +374,23 @@ TEST_F(TestNode, CollisionSpace)
   // Partially in obstacle
   ASSERT_EQ(collision_checker_->testPose(4.5, 4.5, 0), false);
 }
+
+TEST_F(TestNode, BatchScoring)
+{
+  collision_checker_->setFootprint(0, 1);
+
+  // Free space, obstacle and off-map poses scored from one snapshot
+  std::vector<geometry_msgs::msg::Pose2D> poses(3);
+  poses[0].x = 2;
+  poses[0].y = 8.5;
+  poses[1].x = 8.5;
+  poses[1].y = 6.5;
+  poses[2].x = 5;
+  poses[2].y = 13;
+
+  std::vector<double> costs = collision_checker_->testPoseBatch(poses);
+  ASSERT_EQ(costs.size(), 3u);
+  EXPECT_LT(costs[0], nav2_costmap_2d::LETHAL_OBSTACLE);
+  EXPECT_GE(costs[1], nav2_costmap_2d::LETHAL_OBSTACLE);
+  EXPECT_GE(costs[2], nav2_costmap_2d::LETHAL_OBSTACLE);
+}
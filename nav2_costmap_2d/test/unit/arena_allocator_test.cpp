@@ -0,0 +1,88 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "nav2_costmap_2d/arena_allocator.hpp"
+
+using nav2_costmap_2d::Arena;
+using nav2_costmap_2d::ArenaAllocator;
+
+TEST(ArenaAllocator, reset_reuses_storage)
+{
+  Arena arena(64);
+  void * first = arena.allocate(48, alignof(std::max_align_t));
+  arena.reset();
+  void * again = arena.allocate(48, alignof(std::max_align_t));
+  EXPECT_EQ(first, again);
+}
+
+TEST(ArenaAllocator, grows_past_initial_block)
+{
+  Arena arena(16);
+  arena.allocate(16, 1);
+  void * large = arena.allocate(1024, 1);
+  EXPECT_NE(large, nullptr);
+  EXPECT_GE(arena.capacity(), 1024u + 16u);
+}
+
+TEST(ArenaAllocator, capacity_stabilizes_across_cycles)
+{
+  Arena arena;
+  using Vector = std::vector<int, ArenaAllocator<int>>;
+
+  // Warm-up cycle establishes the high-water mark
+  {
+    Vector v{ArenaAllocator<int>(&arena)};
+    for (int i = 0; i < 10000; ++i) {
+      v.push_back(i);
+    }
+  }
+  arena.reset();
+  const size_t high_water = arena.capacity();
+
+  for (int cycle = 0; cycle < 5; ++cycle) {
+    Vector v{ArenaAllocator<int>(&arena)};
+    for (int i = 0; i < 10000; ++i) {
+      v.push_back(i);
+    }
+    ASSERT_EQ(v.size(), 10000u);
+    for (int i = 0; i < 10000; ++i) {
+      ASSERT_EQ(v[i], i);
+    }
+    Vector(v.get_allocator()).swap(v);
+    arena.reset();
+    EXPECT_EQ(arena.capacity(), high_water);
+  }
+}
+
+TEST(ArenaAllocator, default_constructed_falls_back_to_heap)
+{
+  std::vector<int, ArenaAllocator<int>> v;
+  for (int i = 0; i < 100; ++i) {
+    v.push_back(i);
+  }
+  EXPECT_EQ(v.size(), 100u);
+}
+
+TEST(ArenaAllocator, allocators_compare_by_arena)
+{
+  Arena arena_a, arena_b;
+  ArenaAllocator<int> a1(&arena_a), a2(&arena_a);
+  ArenaAllocator<int64_t> b(&arena_b);
+  EXPECT_TRUE(a1 == a2);
+  EXPECT_TRUE(a1 != b);
+}
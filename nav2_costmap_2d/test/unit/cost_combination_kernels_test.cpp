@@ -0,0 +1,95 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "nav2_costmap_2d/cost_combination_kernels.hpp"
+#include "nav2_costmap_2d/cost_values.hpp"
+
+using nav2_costmap_2d::NO_INFORMATION;
+
+// Reference per-cell implementations of the updateWith*() combination
+// rules, as the loops looked before the row kernels were introduced
+static unsigned char refMax(unsigned char master, unsigned char layer)
+{
+  if (layer == NO_INFORMATION) {
+    return master;
+  }
+  if (master == NO_INFORMATION || master < layer) {
+    return layer;
+  }
+  return master;
+}
+
+static unsigned char refMaxWithoutUnknownOverwrite(unsigned char master, unsigned char layer)
+{
+  if (layer != NO_INFORMATION && master != NO_INFORMATION && master < layer) {
+    return layer;
+  }
+  return master;
+}
+
+static unsigned char refOverwrite(unsigned char master, unsigned char layer)
+{
+  return layer == NO_INFORMATION ? master : layer;
+}
+
+template<typename Kernel, typename Reference>
+void checkKernelAgainstReference(Reference reference)
+{
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> cost(0, 255);
+  std::uniform_int_distribution<int> unknown(0, 3);
+
+  // odd lengths exercise both the 16-wide SIMD path and the scalar tail
+  for (unsigned int length : {0u, 1u, 15u, 16u, 17u, 33u, 100u}) {
+    std::vector<unsigned char> master(length), layer(length);
+    for (unsigned int i = 0; i < length; ++i) {
+      master[i] = unknown(gen) == 0 ? NO_INFORMATION : cost(gen);
+      layer[i] = unknown(gen) == 0 ? NO_INFORMATION : cost(gen);
+    }
+
+    std::vector<unsigned char> expected(length);
+    for (unsigned int i = 0; i < length; ++i) {
+      expected[i] = reference(master[i], layer[i]);
+    }
+
+    nav2_costmap_2d::kernels::combineRow<Kernel>(master.data(), layer.data(), length);
+    EXPECT_EQ(master, expected) << "length " << length;
+  }
+}
+
+TEST(CostCombinationKernels, maxMatchesReference)
+{
+  checkKernelAgainstReference<nav2_costmap_2d::kernels::MaxKernel>(refMax);
+}
+
+TEST(CostCombinationKernels, maxWithoutUnknownOverwriteMatchesReference)
+{
+  checkKernelAgainstReference<nav2_costmap_2d::kernels::MaxWithoutUnknownOverwriteKernel>(
+    refMaxWithoutUnknownOverwrite);
+}
+
+TEST(CostCombinationKernels, overwriteMatchesReference)
+{
+  checkKernelAgainstReference<nav2_costmap_2d::kernels::OverwriteKernel>(refOverwrite);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
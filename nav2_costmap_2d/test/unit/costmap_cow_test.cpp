@@ -0,0 +1,82 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "nav2_costmap_2d/costmap_2d.hpp"
+
+TEST(CostmapCopyOnWrite, copySharesUntilMutation)
+{
+  nav2_costmap_2d::Costmap2D original(10, 8, 0.1, 0.0, 0.0);
+  original.setCost(3, 5, 30);
+
+  nav2_costmap_2d::Costmap2D copy(original);
+
+  // the grid is shared after a copy; region views don't detach it
+  EXPECT_EQ(copy.getRegionView().row(0), original.getRegionView().row(0));
+  EXPECT_EQ(copy.getCost(3, 5), 30);
+
+  // mutating the original leaves the copy on the old cells
+  original.setCost(3, 5, 99);
+  EXPECT_EQ(original.getCost(3, 5), 99);
+  EXPECT_EQ(copy.getCost(3, 5), 30);
+  EXPECT_NE(copy.getRegionView().row(0), original.getRegionView().row(0));
+
+  // once detached, further mutations don't copy again
+  const unsigned char * grid = original.getRegionView().row(0);
+  original.setCost(2, 2, 50);
+  EXPECT_EQ(original.getRegionView().row(0), grid);
+}
+
+TEST(CostmapCopyOnWrite, assignmentAndCharMapDetach)
+{
+  nav2_costmap_2d::Costmap2D original(6, 6, 0.1, 0.0, 0.0);
+  original.setCost(1, 1, 42);
+
+  nav2_costmap_2d::Costmap2D copy;
+  copy = original;
+  EXPECT_EQ(copy.getRegionView().row(0), original.getRegionView().row(0));
+
+  // getCharMap() hands out a writable pointer, so it must detach
+  unsigned char * writable = copy.getCharMap();
+  EXPECT_NE(writable, original.getRegionView().row(0));
+  writable[0] = 77;
+  EXPECT_EQ(copy.getCost(0, 0), 77);
+  EXPECT_NE(original.getCost(0, 0), 77);
+
+  // the copy keeps its view consistent after detaching
+  EXPECT_EQ(copy.getCost(1, 1), 42);
+}
+
+TEST(CostmapCopyOnWrite, mutatorsDetachSharedCopies)
+{
+  nav2_costmap_2d::Costmap2D original(8, 8, 0.1, 0.0, 0.0, 0);
+  original.setCost(4, 4, 100);
+
+  nav2_costmap_2d::Costmap2D reset_copy(original);
+  reset_copy.resetMap(0, 0, 8, 8);
+  EXPECT_EQ(reset_copy.getCost(4, 4), 0);
+  EXPECT_EQ(original.getCost(4, 4), 100);
+
+  nav2_costmap_2d::Costmap2D origin_copy(original);
+  origin_copy.updateOrigin(0.2, 0.2);
+  EXPECT_EQ(original.getCost(4, 4), 100);
+  EXPECT_EQ(origin_copy.getCost(2, 2), 100);
+
+  // resizing one side must not disturb the other
+  nav2_costmap_2d::Costmap2D resize_copy(original);
+  resize_copy.resizeMap(4, 4, 0.1, 0.0, 0.0);
+  EXPECT_EQ(original.getCost(4, 4), 100);
+  EXPECT_EQ(resize_copy.getSizeInCellsX(), 4u);
+}
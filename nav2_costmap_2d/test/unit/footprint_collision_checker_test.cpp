@@ -250,3 +250,89 @@ TEST(collision_footprint, make_footprint_from_string_not_pairs) {
     "[[1, 2.2], [.3, -4e4], [-.3, -4e4], [-1, 2.2, 5.6]]", footprint);
   EXPECT_EQ(result, false);
 }
+
+TEST(collision_footprint, cached_footprint_matches_direct)
+{
+  std::shared_ptr<nav2_costmap_2d::Costmap2D> costmap_ =
+    std::make_shared<nav2_costmap_2d::Costmap2D>(100, 100, 0.1, 0, 0, 0);
+
+  costmap_->setCost(62, 50, 254);
+  costmap_->setCost(39, 60, 200);
+
+  geometry_msgs::msg::Point p1;
+  p1.x = -1.0;
+  p1.y = 1.0;
+  geometry_msgs::msg::Point p2;
+  p2.x = 1.0;
+  p2.y = 1.0;
+  geometry_msgs::msg::Point p3;
+  p3.x = 1.0;
+  p3.y = -1.0;
+  geometry_msgs::msg::Point p4;
+  p4.x = -1.0;
+  p4.y = -1.0;
+
+  nav2_costmap_2d::Footprint footprint = {p1, p2, p3, p4};
+
+  nav2_costmap_2d::FootprintCollisionChecker<std::shared_ptr<nav2_costmap_2d::Costmap2D>>
+  collision_checker(costmap_);
+  collision_checker.precomputeFootprintOffsets(footprint, 72);
+
+  // cell-centered poses at precomputed headings must agree with the
+  // direct polygon rasterization
+  for (double theta : {0.0, M_PI / 2.0, M_PI, 3.0 * M_PI / 2.0}) {
+    EXPECT_NEAR(
+      collision_checker.footprintCostAtPoseCached(5.05, 5.05, theta),
+      collision_checker.footprintCostAtPose(5.05, 5.05, theta, footprint), 0.001);
+    EXPECT_NEAR(
+      collision_checker.footprintCostAtPoseCached(4.95, 5.05, theta),
+      collision_checker.footprintCostAtPose(4.95, 5.05, theta, footprint), 0.001);
+  }
+
+  // off-map poses are lethal, as in the direct path
+  EXPECT_NEAR(collision_checker.footprintCostAtPoseCached(-5.0, 5.0, 0.0), 254.0, 0.001);
+  EXPECT_NEAR(collision_checker.footprintCostAtPoseCached(9.95, 5.0, 0.0), 254.0, 0.001);
+}
+
+TEST(collision_footprint, cached_footprint_batch)
+{
+  std::shared_ptr<nav2_costmap_2d::Costmap2D> costmap_ =
+    std::make_shared<nav2_costmap_2d::Costmap2D>(100, 100, 0.1, 0, 0, 0);
+
+  costmap_->setCost(50, 50, 254);
+
+  geometry_msgs::msg::Point p1;
+  p1.x = -0.3;
+  p1.y = 0.3;
+  geometry_msgs::msg::Point p2;
+  p2.x = 0.3;
+  p2.y = 0.3;
+  geometry_msgs::msg::Point p3;
+  p3.x = 0.3;
+  p3.y = -0.3;
+  geometry_msgs::msg::Point p4;
+  p4.x = -0.3;
+  p4.y = -0.3;
+
+  nav2_costmap_2d::Footprint footprint = {p1, p2, p3, p4};
+
+  nav2_costmap_2d::FootprintCollisionChecker<std::shared_ptr<nav2_costmap_2d::Costmap2D>>
+  collision_checker(costmap_);
+  collision_checker.precomputeFootprintOffsets(footprint, 36);
+
+  std::vector<geometry_msgs::msg::Pose2D> poses(3);
+  poses[0].x = 2.0;
+  poses[0].y = 2.0;
+  poses[1].x = 5.3;
+  poses[1].y = 5.05;
+  poses[1].theta = M_PI / 2.0;
+  poses[2].x = 8.0;
+  poses[2].y = 8.0;
+  poses[2].theta = M_PI;
+
+  auto costs = collision_checker.footprintCostBatch(poses);
+  ASSERT_EQ(costs.size(), 3u);
+  EXPECT_NEAR(costs[0], 0.0, 0.001);
+  EXPECT_NEAR(costs[1], 254.0, 0.001);
+  EXPECT_NEAR(costs[2], 0.0, 0.001);
+}
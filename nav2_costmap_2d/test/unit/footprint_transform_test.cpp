@@ -0,0 +1,113 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License. Reserved.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "nav2_costmap_2d/footprint.hpp"
+
+using nav2_costmap_2d::transformFootprint;
+using nav2_costmap_2d::transformFootprints;
+
+std::vector<geometry_msgs::msg::Point> squareFootprint()
+{
+  std::vector<geometry_msgs::msg::Point> footprint(4);
+  footprint[0].x = 0.5;
+  footprint[0].y = 0.3;
+  footprint[1].x = -0.5;
+  footprint[1].y = 0.3;
+  footprint[2].x = -0.5;
+  footprint[2].y = -0.3;
+  footprint[3].x = 0.5;
+  footprint[3].y = -0.3;
+  return footprint;
+}
+
+TEST(FootprintTransform, precomputedRotationMatchesTheta)
+{
+  auto footprint = squareFootprint();
+  double x = 1.5, y = -2.0, theta = 0.7;
+
+  std::vector<geometry_msgs::msg::Point> from_theta, from_trig;
+  transformFootprint(x, y, theta, footprint, from_theta);
+  transformFootprint(x, y, cos(theta), sin(theta), footprint, from_trig);
+
+  ASSERT_EQ(from_theta.size(), from_trig.size());
+  for (unsigned int i = 0; i < from_theta.size(); ++i) {
+    EXPECT_DOUBLE_EQ(from_theta[i].x, from_trig[i].x);
+    EXPECT_DOUBLE_EQ(from_theta[i].y, from_trig[i].y);
+  }
+}
+
+TEST(FootprintTransform, batchedMatchesPerPose)
+{
+  auto footprint = squareFootprint();
+
+  std::vector<geometry_msgs::msg::Pose2D> poses(10);
+  for (unsigned int i = 0; i < poses.size(); ++i) {
+    poses[i].x = 0.1 * i;
+    poses[i].y = -0.05 * i;
+    poses[i].theta = 0.3 * i;
+  }
+
+  std::vector<std::vector<geometry_msgs::msg::Point>> batched;
+  transformFootprints(poses, footprint, batched);
+
+  ASSERT_EQ(batched.size(), poses.size());
+  for (unsigned int i = 0; i < poses.size(); ++i) {
+    std::vector<geometry_msgs::msg::Point> single;
+    transformFootprint(poses[i].x, poses[i].y, poses[i].theta, footprint, single);
+    ASSERT_EQ(batched[i].size(), single.size());
+    for (unsigned int j = 0; j < single.size(); ++j) {
+      EXPECT_DOUBLE_EQ(batched[i][j].x, single[j].x);
+      EXPECT_DOUBLE_EQ(batched[i][j].y, single[j].y);
+    }
+  }
+}
+
+TEST(FootprintTransform, batchedReusesBuffers)
+{
+  auto footprint = squareFootprint();
+
+  std::vector<geometry_msgs::msg::Pose2D> poses(5);
+  std::vector<std::vector<geometry_msgs::msg::Point>> out;
+  transformFootprints(poses, footprint, out);
+  const geometry_msgs::msg::Point * first_buffer = out[0].data();
+
+  // a second pass over the same number of poses must not reallocate
+  transformFootprints(poses, footprint, out);
+  EXPECT_EQ(out[0].data(), first_buffer);
+}
+
+TEST(FootprintTransform, polygonVariantResetsZ)
+{
+  auto footprint = squareFootprint();
+
+  geometry_msgs::msg::PolygonStamped polygon;
+  transformFootprint(1.0, 2.0, 0.5, footprint, polygon);
+  ASSERT_EQ(polygon.polygon.points.size(), footprint.size());
+  polygon.polygon.points[0].z = 7.0;
+
+  // the reused buffer must come back with z cleared
+  transformFootprint(1.0, 2.0, 0.5, footprint, polygon);
+  EXPECT_FLOAT_EQ(polygon.polygon.points[0].z, 0.0f);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,99 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "nav2_costmap_2d/layer.hpp"
+#include "nav2_costmap_2d/layered_costmap.hpp"
+
+using nav2_costmap_2d::LayeredCostmap;
+
+// Layer that reports the whole map dirty exactly once and fills whatever
+// window it is asked to update, mimicking a static layer's first cycle
+class OneShotFullMapLayer : public nav2_costmap_2d::Layer
+{
+public:
+  OneShotFullMapLayer(double size_x, double size_y)
+  : size_x_(size_x), size_y_(size_y) {}
+
+  void reset() override {}
+  bool isClearable() override {return false;}
+
+  void updateBounds(
+    double, double, double,
+    double * min_x, double * min_y, double * max_x, double * max_y) override
+  {
+    if (!reported_) {
+      *min_x = std::min(*min_x, 0.0);
+      *min_y = std::min(*min_y, 0.0);
+      *max_x = std::max(*max_x, size_x_);
+      *max_y = std::max(*max_y, size_y_);
+      reported_ = true;
+    }
+  }
+
+  void updateCosts(
+    nav2_costmap_2d::Costmap2D & master_grid,
+    int min_i, int min_j, int max_i, int max_j) override
+  {
+    for (int j = min_j; j < max_j; ++j) {
+      for (int i = min_i; i < max_i; ++i) {
+        master_grid.setCost(i, j, 100);
+      }
+    }
+  }
+
+private:
+  double size_x_, size_y_;
+  bool reported_{false};
+};
+
+TEST(LayeredCostmapClamp, clampedUpdateCarriesDirtyBoundsOver)
+{
+  LayeredCostmap layers("map", false, false);
+  layers.resizeMap(20, 20, 0.1, 0.0, 0.0);
+  layers.addPlugin(std::make_shared<OneShotFullMapLayer>(2.0, 2.0));
+
+  // Only the requested window is recombined on the clamped pass
+  layers.clampNextUpdate(0.0, 0.0, 0.5, 0.5);
+  layers.updateMap(1.0, 1.0, 0.0);
+
+  auto * map = layers.getCostmap();
+  EXPECT_EQ(map->getCost(2, 2), 100);
+  EXPECT_EQ(map->getCost(10, 10), 0);
+
+  // The layer reported the full map dirty only once, but the leftover area
+  // was carried over and is completed by the next unclamped pass
+  layers.updateMap(1.0, 1.0, 0.0);
+  EXPECT_EQ(map->getCost(10, 10), 100);
+  EXPECT_EQ(map->getCost(19, 19), 100);
+}
+
+TEST(LayeredCostmapClamp, disjointClampWindowKeepsMapDirty)
+{
+  LayeredCostmap layers("map", false, false);
+  layers.resizeMap(20, 20, 0.1, 0.0, 0.0);
+  layers.addPlugin(std::make_shared<OneShotFullMapLayer>(2.0, 2.0));
+
+  // A window fully outside the dirty area must not drop the dirty cells
+  layers.clampNextUpdate(5.0, 5.0, 6.0, 6.0);
+  layers.updateMap(1.0, 1.0, 0.0);
+  EXPECT_EQ(layers.getCostmap()->getCost(10, 10), 0);
+
+  layers.updateMap(1.0, 1.0, 0.0);
+  EXPECT_EQ(layers.getCostmap()->getCost(10, 10), 100);
+}
@@ -0,0 +1,195 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "nav2_costmap_2d/cost_values.hpp"
+#include "nav2_costmap_2d/layer.hpp"
+#include "nav2_costmap_2d/layer_update_thread_pool.hpp"
+#include "nav2_costmap_2d/layered_costmap.hpp"
+
+using nav2_costmap_2d::LayeredCostmap;
+using nav2_costmap_2d::LayerUpdateThreadPool;
+
+// Minimal layer marking one lethal cell, used to compare the sequential
+// and parallel bounds phases without bringing up a full lifecycle node
+class MarkingLayer : public nav2_costmap_2d::Layer
+{
+public:
+  MarkingLayer(double wx, double wy)
+  : wx_(wx), wy_(wy) {}
+
+  void reset() override {}
+  bool isClearable() override {return true;}
+
+  void updateBounds(
+    double, double, double,
+    double * min_x, double * min_y, double * max_x, double * max_y) override
+  {
+    *min_x = std::min(*min_x, wx_ - 0.5);
+    *min_y = std::min(*min_y, wy_ - 0.5);
+    *max_x = std::max(*max_x, wx_ + 0.5);
+    *max_y = std::max(*max_y, wy_ + 0.5);
+  }
+
+  void updateCosts(
+    nav2_costmap_2d::Costmap2D & master_grid, int, int, int, int) override
+  {
+    unsigned int mx, my;
+    if (master_grid.worldToMap(wx_, wy_, mx, my)) {
+      master_grid.setCost(mx, my, nav2_costmap_2d::LETHAL_OBSTACLE);
+    }
+  }
+
+private:
+  double wx_, wy_;
+};
+
+// Inflation-like layer: reads the bounds accumulated by the layers before it
+// and pads them, so the parallel bounds phase must run it after its inputs
+class PaddingLayer : public nav2_costmap_2d::Layer
+{
+public:
+  void reset() override {}
+  bool isClearable() override {return false;}
+  bool isBoundsCoupled() override {return true;}
+
+  void updateBounds(
+    double, double, double,
+    double * min_x, double * min_y, double * max_x, double * max_y) override
+  {
+    seen_min_x_ = *min_x;
+    seen_min_y_ = *min_y;
+    seen_max_x_ = *max_x;
+    seen_max_y_ = *max_y;
+    *min_x -= 0.3;
+    *min_y -= 0.3;
+    *max_x += 0.3;
+    *max_y += 0.3;
+  }
+
+  void updateCosts(nav2_costmap_2d::Costmap2D &, int, int, int, int) override {}
+
+  double seen_min_x_{0.0}, seen_min_y_{0.0}, seen_max_x_{0.0}, seen_max_y_{0.0};
+};
+
+TEST(LayerUpdateThreadPool, executesAllTasksAndRethrows)
+{
+  LayerUpdateThreadPool pool(4);
+  EXPECT_EQ(pool.size(), 4u);
+
+  std::atomic<int> count{0};
+  std::vector<std::function<void()>> tasks;
+  for (int i = 0; i < 100; ++i) {
+    tasks.emplace_back([&count]() {count++;});
+  }
+  pool.execute(tasks);
+  EXPECT_EQ(count.load(), 100);
+
+  tasks.clear();
+  tasks.emplace_back([]() {throw std::runtime_error("boom");});
+  EXPECT_THROW(pool.execute(tasks), std::runtime_error);
+
+  // The pool must stay usable after a task threw
+  pool.execute({[&count]() {count++;}});
+  EXPECT_EQ(count.load(), 101);
+}
+
+TEST(LayeredCostmapParallel, matchesSequentialUpdate)
+{
+  std::shared_ptr<PaddingLayer> s_padding, p_padding;
+  auto make_costmap = [&](bool parallel) {
+      auto layers = std::make_unique<LayeredCostmap>("map", false, false);
+      layers->resizeMap(20, 20, 0.1, 0.0, 0.0);
+      if (parallel) {
+        layers->setParallelUpdate(4);
+      }
+      layers->addPlugin(std::make_shared<MarkingLayer>(0.35, 0.35));
+      layers->addPlugin(std::make_shared<MarkingLayer>(1.25, 0.85));
+      layers->addPlugin(std::make_shared<MarkingLayer>(0.15, 1.65));
+      auto padding = std::make_shared<PaddingLayer>();
+      (parallel ? p_padding : s_padding) = padding;
+      layers->addPlugin(padding);
+      layers->updateMap(1.0, 1.0, 0.0);
+      return layers;
+    };
+
+  auto sequential = make_costmap(false);
+  auto parallel = make_costmap(true);
+
+  double s_minx, s_miny, s_maxx, s_maxy;
+  double p_minx, p_miny, p_maxx, p_maxy;
+  sequential->getUpdatedBounds(s_minx, s_miny, s_maxx, s_maxy);
+  parallel->getUpdatedBounds(p_minx, p_miny, p_maxx, p_maxy);
+  EXPECT_DOUBLE_EQ(s_minx, p_minx);
+  EXPECT_DOUBLE_EQ(s_miny, p_miny);
+  EXPECT_DOUBLE_EQ(s_maxx, p_maxx);
+  EXPECT_DOUBLE_EQ(s_maxy, p_maxy);
+
+  // The bounds-coupled layer must see the merged bounds of the layers before
+  // it, never the empty parallel seed bounds
+  EXPECT_DOUBLE_EQ(s_padding->seen_min_x_, p_padding->seen_min_x_);
+  EXPECT_DOUBLE_EQ(s_padding->seen_min_y_, p_padding->seen_min_y_);
+  EXPECT_DOUBLE_EQ(s_padding->seen_max_x_, p_padding->seen_max_x_);
+  EXPECT_DOUBLE_EQ(s_padding->seen_max_y_, p_padding->seen_max_y_);
+  EXPECT_LT(p_padding->seen_min_x_, std::numeric_limits<double>::max());
+  EXPECT_GT(p_padding->seen_max_x_, std::numeric_limits<double>::lowest());
+
+  auto * s_map = sequential->getCostmap();
+  auto * p_map = parallel->getCostmap();
+  for (unsigned int my = 0; my < s_map->getSizeInCellsY(); ++my) {
+    for (unsigned int mx = 0; mx < s_map->getSizeInCellsX(); ++mx) {
+      EXPECT_EQ(s_map->getCost(mx, my), p_map->getCost(mx, my));
+    }
+  }
+}
+
+TEST(LayeredCostmapTiming, collectsPerLayerStats)
+{
+  LayeredCostmap layers("map", false, false);
+  layers.resizeMap(20, 20, 0.1, 0.0, 0.0);
+  layers.addPlugin(std::make_shared<MarkingLayer>(0.35, 0.35));
+
+  // nothing is recorded until timing is enabled
+  layers.updateMap(1.0, 1.0, 0.0);
+  EXPECT_TRUE(layers.getTimingStats().empty());
+
+  layers.setTimingEnabled(true);
+  layers.updateMap(1.0, 1.0, 0.0);
+  layers.updateMap(1.0, 1.0, 0.0);
+
+  auto stats = layers.getTimingStats();
+  ASSERT_EQ(stats.size(), 2u);  // one update_bounds and one update_costs entry
+  for (const auto & stat : stats) {
+    EXPECT_TRUE(stat.phase == "update_bounds" || stat.phase == "update_costs");
+    EXPECT_EQ(stat.sample_count, 2u);
+    EXPECT_GE(stat.max_time, stat.mean_time);
+  }
+
+  // disabling drops the collected statistics
+  layers.setTimingEnabled(false);
+  EXPECT_TRUE(layers.getTimingStats().empty());
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
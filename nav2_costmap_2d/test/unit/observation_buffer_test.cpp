@@ -0,0 +1,111 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "nav2_costmap_2d/observation_buffer.hpp"
+#include "nav2_util/lifecycle_node.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "sensor_msgs/point_cloud2_iterator.hpp"
+#include "tf2_ros/buffer.h"
+
+class RclCppFixture
+{
+public:
+  RclCppFixture() {rclcpp::init(0, nullptr);}
+  ~RclCppFixture() {rclcpp::shutdown();}
+};
+RclCppFixture g_rclcppfixture;
+
+class ObservationBufferTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    node_ = std::make_shared<nav2_util::LifecycleNode>("observation_buffer_test");
+    tf_buffer_ = std::make_shared<tf2_ros::Buffer>(node_->get_clock());
+  }
+
+  std::unique_ptr<nav2_costmap_2d::ObservationBuffer> makeBuffer(double keep_time)
+  {
+    return std::make_unique<nav2_costmap_2d::ObservationBuffer>(
+      node_, "test_topic", keep_time, 0.0,
+      0.0, 10.0, 10.0, 0.0, 10.0, 0.0, *tf_buffer_, "map", "", tf2::durationFromSec(0.1));
+  }
+
+  // A single-point cloud already in the global frame, buffered through the
+  // shared-message path so no transform is required
+  sensor_msgs::msg::PointCloud2::ConstSharedPtr makeCloud(const rclcpp::Time & stamp)
+  {
+    auto cloud = std::make_shared<sensor_msgs::msg::PointCloud2>();
+    cloud->header.frame_id = "map";
+    cloud->header.stamp = stamp;
+    sensor_msgs::PointCloud2Modifier modifier(*cloud);
+    modifier.setPointCloud2FieldsByString(1, "xyz");
+    modifier.resize(1);
+    sensor_msgs::PointCloud2Iterator<float> iter_z(*cloud, "z");
+    *iter_z = 1.0;
+    return cloud;
+  }
+
+  std::shared_ptr<nav2_util::LifecycleNode> node_;
+  std::shared_ptr<tf2_ros::Buffer> tf_buffer_;
+};
+
+TEST_F(ObservationBufferTest, keepsFreshDropsStale)
+{
+  auto buffer = makeBuffer(1.0);
+  const rclcpp::Time now = node_->now();
+
+  // one observation already past its keep time, one current
+  buffer->bufferCloud(makeCloud(now - rclcpp::Duration::from_seconds(2.0)));
+  buffer->bufferCloud(makeCloud(now));
+
+  std::vector<nav2_costmap_2d::Observation> observations;
+  buffer->getObservations(observations);
+  ASSERT_EQ(observations.size(), 1u);
+  EXPECT_EQ(rclcpp::Time(observations[0].cloud_->header.stamp), now);
+}
+
+TEST_F(ObservationBufferTest, zeroKeepTimeKeepsOnlyLatest)
+{
+  auto buffer = makeBuffer(0.0);
+  const rclcpp::Time now = node_->now();
+
+  buffer->bufferCloud(makeCloud(now - rclcpp::Duration::from_seconds(0.2)));
+  buffer->bufferCloud(makeCloud(now - rclcpp::Duration::from_seconds(0.1)));
+  buffer->bufferCloud(makeCloud(now));
+
+  std::vector<nav2_costmap_2d::Observation> observations;
+  buffer->getObservations(observations);
+  ASSERT_EQ(observations.size(), 1u);
+  EXPECT_EQ(rclcpp::Time(observations[0].cloud_->header.stamp), now);
+}
+
+TEST_F(ObservationBufferTest, retainsEverythingWithinKeepTime)
+{
+  auto buffer = makeBuffer(10.0);
+  const rclcpp::Time now = node_->now();
+
+  for (int i = 0; i < 5; ++i) {
+    buffer->bufferCloud(makeCloud(now - rclcpp::Duration::from_seconds(0.1 * i)));
+  }
+
+  std::vector<nav2_costmap_2d::Observation> observations;
+  buffer->getObservations(observations);
+  EXPECT_EQ(observations.size(), 5u);
+}
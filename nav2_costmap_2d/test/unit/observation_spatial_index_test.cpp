@@ -0,0 +1,101 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <limits>
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "nav2_costmap_2d/observation_spatial_index.hpp"
+#include "sensor_msgs/point_cloud2_iterator.hpp"
+
+using nav2_costmap_2d::ObservationSpatialIndex;
+
+static sensor_msgs::msg::PointCloud2 makeCloud(
+  const std::vector<std::array<float, 3>> & points)
+{
+  sensor_msgs::msg::PointCloud2 cloud;
+  sensor_msgs::PointCloud2Modifier modifier(cloud);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(points.size());
+  sensor_msgs::PointCloud2Iterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(cloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(cloud, "z");
+  for (const auto & p : points) {
+    *iter_x = p[0];
+    *iter_y = p[1];
+    *iter_z = p[2];
+    ++iter_x;
+    ++iter_y;
+    ++iter_z;
+  }
+  return cloud;
+}
+
+TEST(ObservationSpatialIndex, reportsAllPointsInsideRegion)
+{
+  const auto cloud = makeCloud(
+    {{0.5f, 0.5f, 0.0f}, {1.5f, 1.5f, 0.0f}, {10.0f, 10.0f, 0.0f}, {-5.0f, 3.0f, 0.0f}});
+  ObservationSpatialIndex index(cloud, 1.0);
+  EXPECT_EQ(index.size(), 4u);
+
+  // points 0 and 1 lie inside the region and must both be reported;
+  // buckets are coarse so extra candidates are allowed, missing ones are not
+  std::set<uint32_t> got;
+  index.forEachInRegion(0.0, 0.0, 2.0, 2.0, [&](uint32_t idx) {got.insert(idx);});
+  EXPECT_TRUE(got.count(0));
+  EXPECT_TRUE(got.count(1));
+  EXPECT_FALSE(got.count(2));
+
+  // a query outside the cloud extent visits nothing
+  got.clear();
+  index.forEachInRegion(100.0, 100.0, 110.0, 110.0, [&](uint32_t idx) {got.insert(idx);});
+  EXPECT_TRUE(got.empty());
+
+  // a query covering the full extent reports every point exactly once
+  std::vector<uint32_t> all;
+  index.forEachInRegion(-100.0, -100.0, 100.0, 100.0, [&](uint32_t idx) {all.push_back(idx);});
+  EXPECT_EQ(all.size(), 4u);
+  EXPECT_EQ(std::set<uint32_t>(all.begin(), all.end()).size(), 4u);
+}
+
+TEST(ObservationSpatialIndex, skipsNonFinitePoints)
+{
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const auto cloud = makeCloud({{nan, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {0.0f, nan, 0.0f}});
+  ObservationSpatialIndex index(cloud, 1.0);
+  EXPECT_EQ(index.size(), 1u);
+
+  std::set<uint32_t> got;
+  index.forEachInRegion(-10.0, -10.0, 10.0, 10.0, [&](uint32_t idx) {got.insert(idx);});
+  EXPECT_EQ(got, std::set<uint32_t>({1u}));
+}
+
+TEST(ObservationSpatialIndex, handlesEmptyCloud)
+{
+  const auto cloud = makeCloud({});
+  ObservationSpatialIndex index(cloud);
+  EXPECT_EQ(index.size(), 0u);
+
+  bool visited = false;
+  index.forEachInRegion(-10.0, -10.0, 10.0, 10.0, [&](uint32_t) {visited = true;});
+  EXPECT_FALSE(visited);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,102 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License. Reserved.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <utility>
+
+#include "nav2_costmap_2d/obstacle_track_store.hpp"
+
+using nav2_costmap_2d::ObstacleTrackStore;
+
+rclcpp::Time atSeconds(double t)
+{
+  return rclcpp::Time(static_cast<int64_t>(t * 1e9));
+}
+
+std::vector<std::pair<double, double>> activeTracks(
+  const ObstacleTrackStore & store, const rclcpp::Time & now)
+{
+  std::vector<std::pair<double, double>> active;
+  store.forEachActive(now, [&](double wx, double wy) {active.push_back({wx, wy});});
+  return active;
+}
+
+TEST(ObstacleTrackStore, strayDetectionsDoNotPersist)
+{
+  ObstacleTrackStore store(0.05, 1.0, 3);
+
+  store.observe(1.0, 2.0, atSeconds(0.0));
+  EXPECT_EQ(store.size(), 1u);
+  // one hit is below the observation threshold, so nothing is active
+  EXPECT_TRUE(activeTracks(store, atSeconds(0.1)).empty());
+}
+
+TEST(ObstacleTrackStore, reinforcedCellBecomesActiveTrack)
+{
+  ObstacleTrackStore store(0.05, 1.0, 3);
+
+  // hits land in the same 5 cm cell and reinforce one track
+  store.observe(1.00, 2.00, atSeconds(0.0));
+  store.observe(1.01, 2.01, atSeconds(0.2));
+  store.observe(1.02, 2.02, atSeconds(0.4));
+  EXPECT_EQ(store.size(), 1u);
+
+  auto active = activeTracks(store, atSeconds(0.5));
+  ASSERT_EQ(active.size(), 1u);
+  // the track reports the most recent hit position
+  EXPECT_DOUBLE_EQ(active[0].first, 1.02);
+  EXPECT_DOUBLE_EQ(active[0].second, 2.02);
+
+  // still active within the persistence window after the last hit...
+  EXPECT_EQ(activeTracks(store, atSeconds(1.3)).size(), 1u);
+  // ...and inactive beyond it
+  EXPECT_TRUE(activeTracks(store, atSeconds(1.5)).empty());
+}
+
+TEST(ObstacleTrackStore, pruneErasesExpiredTracks)
+{
+  ObstacleTrackStore store(0.05, 1.0, 1);
+
+  store.observe(1.0, 2.0, atSeconds(0.0));
+  store.observe(3.0, 4.0, atSeconds(0.8));
+  EXPECT_EQ(store.size(), 2u);
+
+  // only the first track has aged past the persistence window
+  store.prune(atSeconds(1.5));
+  EXPECT_EQ(store.size(), 1u);
+  auto active = activeTracks(store, atSeconds(1.5));
+  ASSERT_EQ(active.size(), 1u);
+  EXPECT_DOUBLE_EQ(active[0].first, 3.0);
+
+  store.clear();
+  EXPECT_EQ(store.size(), 0u);
+}
+
+TEST(ObstacleTrackStore, separateCellsAreSeparateTracks)
+{
+  ObstacleTrackStore store(0.05, 1.0, 1);
+
+  store.observe(1.0, 2.0, atSeconds(0.0));
+  store.observe(1.1, 2.0, atSeconds(0.0));
+  store.observe(-1.0, -2.0, atSeconds(0.0));
+  EXPECT_EQ(store.size(), 3u);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
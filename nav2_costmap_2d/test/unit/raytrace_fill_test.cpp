@@ -0,0 +1,74 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <random>
+
+#include "gtest/gtest.h"
+#include "nav2_costmap_2d/cost_values.hpp"
+#include "nav2_costmap_2d/costmap_2d.hpp"
+
+using nav2_costmap_2d::Costmap2D;
+using nav2_costmap_2d::FREE_SPACE;
+using nav2_costmap_2d::LETHAL_OBSTACLE;
+
+// Per-cell marking action equivalent to the internal MarkCell functor
+class Marker
+{
+public:
+  Marker(unsigned char * costmap, unsigned char value)
+  : costmap_(costmap), value_(value) {}
+  inline void operator()(unsigned int offset) {costmap_[offset] = value_;}
+
+private:
+  unsigned char * costmap_;
+  unsigned char value_;
+};
+
+// The run-filling raytrace must visit exactly the same cells as the
+// per-cell raytraceLine it replaces, for any slope, direction and length cap
+TEST(RaytraceLineFill, matchesPerCellRaytrace)
+{
+  const unsigned int size = 100;
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<unsigned int> coord(0, size - 1);
+  std::uniform_int_distribution<unsigned int> length(0, 160);
+
+  for (int trial = 0; trial < 500; ++trial) {
+    Costmap2D expected(size, size, 0.05, 0.0, 0.0, LETHAL_OBSTACLE);
+    Costmap2D actual(size, size, 0.05, 0.0, 0.0, LETHAL_OBSTACLE);
+
+    const unsigned int x0 = coord(gen), y0 = coord(gen);
+    const unsigned int x1 = coord(gen), y1 = coord(gen);
+    const unsigned int max_length = length(gen);
+    const unsigned int min_length = length(gen) / 4;
+
+    Marker marker(expected.getCharMap(), FREE_SPACE);
+    expected.raytraceLine(marker, x0, y0, x1, y1, max_length, min_length);
+    actual.raytraceLineFill(FREE_SPACE, x0, y0, x1, y1, max_length, min_length);
+
+    for (unsigned int my = 0; my < size; ++my) {
+      for (unsigned int mx = 0; mx < size; ++mx) {
+        ASSERT_EQ(expected.getCost(mx, my), actual.getCost(mx, my)) <<
+          "cell (" << mx << ", " << my << ") for line (" << x0 << ", " << y0 <<
+          ") -> (" << x1 << ", " << y1 << ") max " << max_length << " min " << min_length;
+      }
+    }
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
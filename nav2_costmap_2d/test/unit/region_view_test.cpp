@@ -0,0 +1,80 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "nav2_costmap_2d/costmap_2d.hpp"
+
+TEST(RegionView, matchesGetCost)
+{
+  nav2_costmap_2d::Costmap2D costmap(10, 8, 0.1, 0.0, 0.0);
+  costmap.setCost(0, 0, 10);
+  costmap.setCost(9, 7, 20);
+  costmap.setCost(3, 5, 30);
+
+  auto view = costmap.getRegionView();
+  EXPECT_EQ(view.x0(), 0u);
+  EXPECT_EQ(view.y0(), 0u);
+  EXPECT_EQ(view.x1(), 10u);
+  EXPECT_EQ(view.y1(), 8u);
+  EXPECT_EQ(view.stride(), 10u);
+
+  for (unsigned int my = 0; my < costmap.getSizeInCellsY(); my++) {
+    for (unsigned int mx = 0; mx < costmap.getSizeInCellsX(); mx++) {
+      EXPECT_EQ(view(mx, my), costmap.getCost(mx, my));
+    }
+  }
+}
+
+TEST(RegionView, windowBoundsAndRows)
+{
+  nav2_costmap_2d::Costmap2D costmap(10, 8, 0.1, 0.0, 0.0);
+  costmap.setCost(4, 3, 40);
+  costmap.setCost(5, 3, 50);
+
+  auto view = costmap.getRegionView(4, 3, 7, 6);
+  EXPECT_TRUE(view.contains(4, 3));
+  EXPECT_TRUE(view.contains(6, 5));
+  EXPECT_FALSE(view.contains(7, 5));
+  EXPECT_FALSE(view.contains(3, 3));
+  EXPECT_FALSE(view.contains(4, 6));
+
+  // Rows expose the raw cells of the window, stride() apart
+  const unsigned char * row = view.row(3);
+  EXPECT_EQ(row[0], 40);
+  EXPECT_EQ(row[1], 50);
+  EXPECT_EQ(view.row(4), row + view.stride());
+}
+
+TEST(RegionView, clampsToMap)
+{
+  nav2_costmap_2d::Costmap2D costmap(10, 8, 0.1, 0.0, 0.0);
+
+  auto view = costmap.getRegionView(6, 5, 100, 100);
+  EXPECT_EQ(view.x0(), 6u);
+  EXPECT_EQ(view.y0(), 5u);
+  EXPECT_EQ(view.x1(), 10u);
+  EXPECT_EQ(view.y1(), 8u);
+
+  // A window fully off the map collapses to an empty view
+  auto empty = costmap.getRegionView(20, 20, 30, 30);
+  EXPECT_EQ(empty.x0(), empty.x1());
+  EXPECT_FALSE(empty.contains(20, 20));
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
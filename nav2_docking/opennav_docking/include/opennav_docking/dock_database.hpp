@@ -118,6 +118,12 @@ protected:
    */
   Dock * findDockInstance(const std::string & dock_id);
 
+  /**
+   * @brief Resolve and store the plugin of every dock instance, called
+   * whenever the set of dock instances has been (re)loaded
+   */
+  void bindDockPlugins();
+
   /**
    * @brief Service request to reload database of docks
    * @param request Service request
@@ -15,6 +15,9 @@
 #ifndef OPENNAV_DOCKING__SIMPLE_CHARGING_DOCK_HPP_
 #define OPENNAV_DOCKING__SIMPLE_CHARGING_DOCK_HPP_
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 #include <string>
 #include <memory>
 #include <vector>
@@ -106,13 +109,39 @@ public:
 protected:
   void jointStateCallback(const sensor_msgs::msg::JointState::SharedPtr state);
 
+  /**
+   * @brief Process one external detection at detector rate: transform into
+   * the docking fixed frame, filter, and apply the detection offsets. Runs
+   * in the subscription callback, so any TF waiting delays only the next
+   * detection and never the control loop.
+   * @param detected_pose The raw detected dock pose
+   */
+  void processDetectedDockPose(const geometry_msgs::msg::PoseStamped & detected_pose);
+
+  /**
+   * @brief Take a consistent snapshot of the latest refined dock pose
+   * produced by the detection callback.
+   * @param pose Filled in with the refined pose, if available
+   * @return true if a refined pose has been produced
+   */
+  bool readRefinedPose(geometry_msgs::msg::PoseStamped & pose);
+
   // Optionally subscribe to a detected dock pose topic
   rclcpp::Subscription<geometry_msgs::msg::PoseStamped>::SharedPtr dock_pose_sub_;
   rclcpp::Publisher<geometry_msgs::msg::PoseStamped>::SharedPtr dock_pose_pub_;
   rclcpp::Publisher<geometry_msgs::msg::PoseStamped>::SharedPtr filtered_dock_pose_pub_;
   rclcpp::Publisher<geometry_msgs::msg::PoseStamped>::SharedPtr staging_pose_pub_;
-  // If subscribed to a detected pose topic, will contain latest message
+  // If subscribed to a detected pose topic, will contain latest message.
+  // Only touched from the detection callback
   geometry_msgs::msg::PoseStamped detected_dock_pose_;
+  // Fixed frame of the current docking attempt, handed to the detection
+  // callback by getRefinedPose()
+  std::mutex detection_frame_mutex_;
+  std::string detection_fixed_frame_;
+  // Latest refined dock pose in the fixed frame, written at detector rate
+  // and read by the control loop through a seqlock so neither side blocks
+  geometry_msgs::msg::PoseStamped refined_dock_pose_;
+  std::atomic<uint32_t> refined_seq_{0};
   // This is the actual dock pose once it has the specified translation/rotation applied
   // If not subscribed to a topic, this is simply the database dock pose
   geometry_msgs::msg::PoseStamped dock_pose_;
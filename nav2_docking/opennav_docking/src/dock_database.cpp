@@ -49,6 +49,8 @@ bool DockDatabase::initialize(
     return false;
   }
 
+  bindDockPlugins();
+
   RCLCPP_INFO(
     node->get_logger(),
     "Docking Server has %u dock types and %u dock instances available.",
@@ -93,6 +95,7 @@ void DockDatabase::reloadDbCb(
   DockMap dock_instances;
   if (utils::parseDockFile(request->filepath, node, dock_instances)) {
     dock_instances_ = dock_instances;
+    bindDockPlugins();
     response->success = true;
     RCLCPP_INFO(
       node->get_logger(),
@@ -107,13 +110,10 @@ void DockDatabase::reloadDbCb(
 Dock * DockDatabase::findDock(const std::string & dock_id)
 {
   Dock * dock_instance = findDockInstance(dock_id);
-  ChargingDock::Ptr dock_plugin{nullptr};
 
   if (dock_instance) {
-    dock_plugin = findDockPlugin(dock_instance->type);
-    if (dock_plugin) {
-      // Populate the plugin shared pointer
-      dock_instance->plugin = dock_plugin;
+    // Plugins are pre-bound when the database is loaded
+    if (dock_instance->plugin) {
       return dock_instance;
     }
     throw opennav_docking_core::DockNotValid("Dock requested has no valid plugin!");
@@ -121,6 +121,23 @@ Dock * DockDatabase::findDock(const std::string & dock_id)
   throw opennav_docking_core::DockNotInDB("Dock ID requested is not in database!");
 }
 
+void DockDatabase::bindDockPlugins()
+{
+  // Resolve each dock's plugin once at load time, so that lookups during
+  // docking actions are a single hash access; docks of an unknown type are
+  // reported here instead of surfacing at the first action using them
+  DockMap::iterator it;
+  for (it = dock_instances_.begin(); it != dock_instances_.end(); ++it) {
+    it->second.plugin = findDockPlugin(it->second.type);
+    if (!it->second.plugin) {
+      RCLCPP_WARN(
+        node_.lock()->get_logger(),
+        "Dock instance %s has unknown plugin type %s!",
+        it->second.id.c_str(), it->second.type.c_str());
+    }
+  }
+}
+
 Dock * DockDatabase::findDockInstance(const std::string & dock_id)
 {
   auto it = dock_instances_.find(dock_id);
@@ -243,7 +243,8 @@ void DockingServer::dockRobot()
       return;
     }
 
-    // Send robot to its staging pose
+    // Send robot to its staging pose. The staging pose of the dock is
+    // computed once per action and reused for every retry cycle below.
     publishDockingFeedback(DockRobot::Feedback::NAV_TO_STAGING_POSE);
     const auto initial_staging_pose = dock->getStagingPose();
     const auto robot_pose = getRobotPoseInFrame(
@@ -299,7 +300,7 @@ void DockingServer::dockRobot()
       }
 
       // Reset to staging pose to try again
-      if (!resetApproach(dock->getStagingPose())) {
+      if (!resetApproach(initial_staging_pose)) {
         // Cancelled, preempted, or shutting down
         stashDockData(goal->use_dock_id, dock, false);
         publishZeroVelocity();
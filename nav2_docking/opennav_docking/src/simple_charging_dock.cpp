@@ -112,10 +112,12 @@ void SimpleChargingDock::configure(
 
   if (use_external_detection_pose_) {
     dock_pose_.header.stamp = rclcpp::Time(0);
+    refined_dock_pose_.header.stamp = rclcpp::Time(0);
     dock_pose_sub_ = node_->create_subscription<geometry_msgs::msg::PoseStamped>(
       "detected_dock_pose", 1,
       [this](const geometry_msgs::msg::PoseStamped::SharedPtr pose) {
         detected_dock_pose_ = *pose;
+        processDetectedDockPose(detected_dock_pose_);
       });
   }
 
@@ -166,45 +168,40 @@ geometry_msgs::msg::PoseStamped SimpleChargingDock::getStagingPose(
   return staging_pose;
 }
 
-bool SimpleChargingDock::getRefinedPose(geometry_msgs::msg::PoseStamped & pose, std::string /*id*/)
+void SimpleChargingDock::processDetectedDockPose(
+  const geometry_msgs::msg::PoseStamped & detected_pose)
 {
-  // If using not detection, set the dock pose to the static fixed-frame version
-  if (!use_external_detection_pose_) {
-    dock_pose_pub_->publish(pose);
-    dock_pose_ = pose;
-    return true;
+  // The fixed frame is only known once docking has started; until then,
+  // refine in the detection's own frame
+  std::string fixed_frame;
+  {
+    std::lock_guard<std::mutex> lock(detection_frame_mutex_);
+    fixed_frame = detection_fixed_frame_;
   }
-
-  // If using detections, get current detections, transform to frame, and apply offsets
-  geometry_msgs::msg::PoseStamped detected = detected_dock_pose_;
-
-  // Validate that external pose is new enough
-  auto timeout = rclcpp::Duration::from_seconds(external_detection_timeout_);
-  if (node_->now() - detected.header.stamp > timeout) {
-    RCLCPP_WARN(node_->get_logger(), "Lost detection or did not detect: timeout exceeded");
-    return false;
+  if (fixed_frame.empty()) {
+    fixed_frame = detected_pose.header.frame_id;
   }
 
-  // Transform detected pose into fixed frame. Note that the argument pose
-  // is the output of detection, but also acts as the initial estimate
-  // and contains the frame_id of docking
-  if (detected.header.frame_id != pose.header.frame_id) {
+  // Transform detected pose into fixed frame. Waiting on TF here delays
+  // only the next detection, never the control loop
+  geometry_msgs::msg::PoseStamped detected = detected_pose;
+  if (detected.header.frame_id != fixed_frame) {
     try {
       if (!tf2_buffer_->canTransform(
-          pose.header.frame_id, detected.header.frame_id,
+          fixed_frame, detected.header.frame_id,
           detected.header.stamp, rclcpp::Duration::from_seconds(0.2)))
       {
         RCLCPP_WARN(node_->get_logger(), "Failed to transform detected dock pose");
-        return false;
+        return;
       }
-      tf2_buffer_->transform(detected, detected, pose.header.frame_id);
+      tf2_buffer_->transform(detected, detected, fixed_frame);
     } catch (const tf2::TransformException & ex) {
       RCLCPP_WARN(node_->get_logger(), "Failed to transform detected dock pose");
-      return false;
+      return;
     }
   }
 
-  // Filter the detected pose
+  // Filter the detected pose, once per measurement
   detected = filter_->update(detected);
   filtered_dock_pose_pub_->publish(detected);
 
@@ -215,19 +212,94 @@ bool SimpleChargingDock::getRefinedPose(geometry_msgs::msg::PoseStamped & pose,
   transform.transform.rotation = detected.pose.orientation;
   tf2::doTransform(just_orientation, just_orientation, transform);
 
+  geometry_msgs::msg::PoseStamped refined;
   tf2::Quaternion orientation;
   orientation.setEuler(0.0, 0.0, tf2::getYaw(just_orientation.pose.orientation));
-  dock_pose_.pose.orientation = tf2::toMsg(orientation);
+  refined.pose.orientation = tf2::toMsg(orientation);
 
-  // Construct dock_pose_ by applying translation/rotation
-  dock_pose_.header = detected.header;
-  dock_pose_.pose.position = detected.pose.position;
-  const double yaw = tf2::getYaw(dock_pose_.pose.orientation);
-  dock_pose_.pose.position.x += cos(yaw) * external_detection_translation_x_ -
+  // Construct the refined pose by applying translation/rotation
+  refined.header = detected.header;
+  refined.pose.position = detected.pose.position;
+  const double yaw = tf2::getYaw(refined.pose.orientation);
+  refined.pose.position.x += cos(yaw) * external_detection_translation_x_ -
     sin(yaw) * external_detection_translation_y_;
-  dock_pose_.pose.position.y += sin(yaw) * external_detection_translation_x_ +
+  refined.pose.position.y += sin(yaw) * external_detection_translation_x_ +
     cos(yaw) * external_detection_translation_y_;
-  dock_pose_.pose.position.z = 0.0;
+  refined.pose.position.z = 0.0;
+
+  // Publish the refined pose into the latest-pose slot for the control loop.
+  // An odd sequence count marks the slot as mid-write
+  uint32_t seq = refined_seq_.load(std::memory_order_relaxed);
+  refined_seq_.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  refined_dock_pose_ = refined;
+  std::atomic_thread_fence(std::memory_order_release);
+  refined_seq_.store(seq + 2, std::memory_order_relaxed);
+}
+
+bool SimpleChargingDock::readRefinedPose(geometry_msgs::msg::PoseStamped & pose)
+{
+  geometry_msgs::msg::PoseStamped refined;
+  uint32_t s1, s2;
+  do {
+    s1 = refined_seq_.load(std::memory_order_acquire);
+    refined = refined_dock_pose_;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    s2 = refined_seq_.load(std::memory_order_relaxed);
+  } while (s1 != s2 || (s1 & 1u));
+
+  if (refined.header.frame_id.empty()) {
+    // No detection has been refined yet
+    return false;
+  }
+  pose = refined;
+  return true;
+}
+
+bool SimpleChargingDock::getRefinedPose(geometry_msgs::msg::PoseStamped & pose, std::string /*id*/)
+{
+  // If using not detection, set the dock pose to the static fixed-frame version
+  if (!use_external_detection_pose_) {
+    dock_pose_pub_->publish(pose);
+    dock_pose_ = pose;
+    return true;
+  }
+
+  // Hand the fixed frame to the detection callback. Note that the argument
+  // pose is the output of detection, but also acts as the initial estimate
+  // and contains the frame_id of docking
+  {
+    std::lock_guard<std::mutex> lock(detection_frame_mutex_);
+    detection_fixed_frame_ = pose.header.frame_id;
+  }
+
+  // Consume the latest refined pose; all TF waiting and filtering happened
+  // at detector rate in the subscription callback
+  geometry_msgs::msg::PoseStamped refined;
+  if (!readRefinedPose(refined)) {
+    RCLCPP_WARN(node_->get_logger(), "Lost detection or did not detect: timeout exceeded");
+    return false;
+  }
+
+  // A detection refined before docking started may still be in the
+  // detection's own frame; wait for one refined in the fixed frame
+  if (refined.header.frame_id != pose.header.frame_id) {
+    RCLCPP_WARN(
+      node_->get_logger(), "Detected dock pose not yet refined into frame %s",
+      pose.header.frame_id.c_str());
+    return false;
+  }
+
+  // Validate that the refined pose is new enough. The dock is static in the
+  // fixed frame, so within this window holding the last refined pose remains
+  // valid through detector hiccups
+  auto timeout = rclcpp::Duration::from_seconds(external_detection_timeout_);
+  if (node_->now() - refined.header.stamp > timeout) {
+    RCLCPP_WARN(node_->get_logger(), "Lost detection or did not detect: timeout exceeded");
+    return false;
+  }
+
+  dock_pose_ = refined;
 
   // Publish & return dock pose for debugging purposes
   dock_pose_pub_->publish(dock_pose_);
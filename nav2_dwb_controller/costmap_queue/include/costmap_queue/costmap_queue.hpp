@@ -36,6 +36,7 @@
 #define COSTMAP_QUEUE__COSTMAP_QUEUE_HPP_
 
 #include <cmath>
+#include <cstdint>
 #include <vector>
 #include <limits>
 #include <memory>
@@ -104,6 +105,10 @@ public:
  * The validCellToQueue overridable-function allows for deriving classes to limit the queue traversal
  * to a subset of all costmap cells. LimitedCostmapQueue does this by ignoring distances above a limit.
  *
+ * Since every priority comes from the precomputed cached_distances_ table, the cells are kept in
+ * integer-indexed buckets over the sorted unique distances (dial's algorithm) rather than in the
+ * double-keyed MapBasedQueue bins, and the seen markers are packed into 64-bit words. The pop
+ * order is identical to the MapBasedQueue implementation.
  */
 class CostmapQueue : public MapBasedQueue<CellData>
 {
@@ -155,12 +160,30 @@ protected:
     unsigned int src_y);
 
   /**
-   * @brief Compute the cached distances
+   * @brief Compute the cached distances and their bucket ranks
    */
   void computeCache();
 
+  /**
+   * @brief Check whether a cell has already been queued
+   * @param index Index of the cell in the costmap
+   */
+  inline bool isSeen(const unsigned int index)
+  {
+    return (seen_[index >> 6] >> (index & 63)) & 1;
+  }
+
+  /**
+   * @brief Mark a cell as queued
+   * @param index Index of the cell in the costmap
+   */
+  inline void markSeen(const unsigned int index)
+  {
+    seen_[index >> 6] |= static_cast<uint64_t>(1) << (index & 63);
+  }
+
   nav2_costmap_2d::Costmap2D & costmap_;
-  std::vector<bool> seen_;
+  std::vector<uint64_t> seen_;
   int max_distance_;
   bool manhattan_;
 
@@ -182,7 +205,12 @@ protected:
     return cached_distances_[dx][dy];
   }
   std::vector<std::vector<double>> cached_distances_;
+  std::vector<std::vector<unsigned int>> cached_ranks_;
   int cached_max_distance_;
+
+  std::vector<std::vector<CellData>> distance_bins_;
+  std::vector<unsigned int> touched_bins_;
+  unsigned int bin_iter_;
 };
 }  // namespace costmap_queue
 
@@ -43,7 +43,7 @@ namespace costmap_queue
 
 CostmapQueue::CostmapQueue(nav2_costmap_2d::Costmap2D & costmap, bool manhattan)
 : MapBasedQueue(), costmap_(costmap), max_distance_(-1), manhattan_(manhattan),
-  cached_max_distance_(-1)
+  cached_max_distance_(-1), bin_iter_(0)
 {
   reset();
 }
@@ -51,11 +51,17 @@ CostmapQueue::CostmapQueue(nav2_costmap_2d::Costmap2D & costmap, bool manhattan)
 void CostmapQueue::reset()
 {
   unsigned int size_x = costmap_.getSizeInCellsX(), size_y = costmap_.getSizeInCellsY();
-  if (seen_.size() != size_x * size_y) {
-    seen_.resize(size_x * size_y);
+  unsigned int word_count = (size_x * size_y + 63) / 64;
+  if (seen_.size() != word_count) {
+    seen_.resize(word_count);
   }
-  std::fill(seen_.begin(), seen_.end(), false);
+  std::fill(seen_.begin(), seen_.end(), 0);
+  for (unsigned int bin : touched_bins_) {
+    distance_bins_[bin].clear();
+  }
+  touched_bins_.clear();
   computeCache();
+  bin_iter_ = distance_bins_.size();
   MapBasedQueue::reset();
 }
 
@@ -69,23 +75,37 @@ void CostmapQueue::enqueueCell(
   unsigned int index, unsigned int cur_x, unsigned int cur_y,
   unsigned int src_x, unsigned int src_y)
 {
-  if (seen_[index]) {return;}
+  if (isSeen(index)) {return;}
 
   // we compute our distance table one cell further than the inflation radius
   // dictates so we can make the check below
-  double distance = distanceLookup(cur_x, cur_y, src_x, src_y);
+  unsigned int dx = CellData::absolute_difference(cur_x, src_x);
+  unsigned int dy = CellData::absolute_difference(cur_y, src_y);
+  double distance = cached_distances_[dx][dy];
   CellData data(distance, index, cur_x, cur_y, src_x, src_y);
   if (validCellToQueue(data)) {
-    seen_[index] = true;
-    enqueue(distance, data);
+    markSeen(index);
+    unsigned int bin = cached_ranks_[dx][dy];
+    if (distance_bins_[bin].empty()) {
+      touched_bins_.push_back(bin);
+    }
+    distance_bins_[bin].push_back(data);
+    item_count_++;
+    if (bin < bin_iter_) {
+      bin_iter_ = bin;
+    }
   }
 }
 
 CellData CostmapQueue::getNextCell()
 {
-  // get the highest priority cell and pop it off the priority queue
-  CellData current_cell = front();
-  pop();
+  // get the highest priority cell and pop it off its bucket
+  CellData current_cell = distance_bins_[bin_iter_].back();
+  distance_bins_[bin_iter_].pop_back();
+  item_count_--;
+  while (bin_iter_ < distance_bins_.size() && distance_bins_[bin_iter_].empty()) {
+    bin_iter_++;
+  }
 
   unsigned int index = current_cell.index_;
   unsigned int mx = current_cell.x_;
@@ -131,6 +151,33 @@ void CostmapQueue::computeCache()
       }
     }
   }
+
+  // rank every distance in the table so cells can be bucketed by integer
+  // index instead of compared as doubles
+  std::vector<double> sorted_distances;
+  sorted_distances.reserve(cached_distances_.size() * cached_distances_.size());
+  for (const std::vector<double> & row : cached_distances_) {
+    sorted_distances.insert(sorted_distances.end(), row.begin(), row.end());
+  }
+  std::sort(sorted_distances.begin(), sorted_distances.end());
+  sorted_distances.erase(
+    std::unique(sorted_distances.begin(), sorted_distances.end()), sorted_distances.end());
+
+  cached_ranks_.clear();
+  cached_ranks_.resize(cached_distances_.size());
+  for (unsigned int i = 0; i < cached_distances_.size(); ++i) {
+    cached_ranks_[i].resize(cached_distances_[i].size());
+    for (unsigned int j = 0; j < cached_distances_[i].size(); ++j) {
+      cached_ranks_[i][j] = std::lower_bound(
+        sorted_distances.begin(), sorted_distances.end(),
+        cached_distances_[i][j]) - sorted_distances.begin();
+    }
+  }
+
+  distance_bins_.clear();
+  distance_bins_.resize(sorted_distances.size());
+  touched_bins_.clear();
+
   cached_max_distance_ = max_distance_;
 }
 
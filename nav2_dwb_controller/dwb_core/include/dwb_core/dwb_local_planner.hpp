@@ -41,7 +41,9 @@
 
 #include "nav2_core/controller.hpp"
 #include "nav2_core/goal_checker.hpp"
+#include "dwb_core/exceptions.hpp"
 #include "dwb_core/publisher.hpp"
+#include "dwb_core/scoring_workers.hpp"
 #include "dwb_core/trajectory_critic.hpp"
 #include "dwb_core/trajectory_generator.hpp"
 #include "nav_2d_msgs/msg/pose2_d_stamped.hpp"
@@ -178,6 +180,23 @@ protected:
     const nav_2d_msgs::msg::Twist2D velocity,
     std::shared_ptr<dwb_msgs::msg::LocalPlanEvaluation> & results);
 
+  /**
+   * @brief Score a trajectory into caller-provided storage
+   *
+   * Same scoring as the public overload, but fills an existing
+   * TrajectoryScore (clearing its critic scores while keeping their
+   * capacity) and leaves score.traj untouched so pooled trajectories are
+   * not copied.
+   *
+   * @param traj Trajectory to check
+   * @param best_score If positive, the threshold for early termination
+   * @param score Output scoring, traj field left as-is
+   */
+  void scoreTrajectory(
+    const dwb_msgs::msg::Trajectory2D & traj,
+    double best_score,
+    dwb_msgs::msg::TrajectoryScore & score);
+
   /**
    * @brief Transforms global plan into same frame as pose, clips far away poses and possibly prunes passed poses
    *
@@ -237,6 +256,16 @@ protected:
   std::string dwb_plugin_name_;
 
   bool short_circuit_trajectory_evaluation_;
+
+  /// Pool sharding trajectory generation and critic scoring across
+  /// threads; sized to one thread, evaluation is exactly serial
+  ScoringWorkers scoring_workers_;
+
+  /// Per-cycle scoring scratch, kept as members so the trajectory pose
+  /// storage and critic score vectors retain their capacity across cycles
+  std::vector<nav_2d_msgs::msg::Twist2D> twists_;
+  std::vector<dwb_msgs::msg::TrajectoryScore> scores_;
+  std::vector<std::shared_ptr<dwb_core::IllegalTrajectoryException>> failures_;
 };
 
 }  // namespace dwb_core
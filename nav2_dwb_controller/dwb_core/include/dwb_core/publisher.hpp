@@ -80,9 +80,17 @@ public:
 
   /**
    * @brief Does the publisher require that the LocalPlanEvaluation be saved
+   *
+   * Recording the full per-trajectory detail is only worthwhile when someone
+   * is actually listening, so this also checks the subscriber counts rather
+   * than the enable flags alone.
    * @return True if the Evaluation is needed to publish either directly or as trajectories
    */
-  bool shouldRecordEvaluation() {return publish_evaluation_ || publish_trajectories_;}
+  bool shouldRecordEvaluation()
+  {
+    return (publish_evaluation_ && eval_pub_->get_subscription_count() > 0) ||
+           (publish_trajectories_ && marker_pub_->get_subscription_count() > 0);
+  }
 
   /**
    * @brief If the pointer is not null, publish the evaluation and trajectories as needed
@@ -0,0 +1,204 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2017, Locus Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DWB_CORE__SCORING_WORKERS_HPP_
+#define DWB_CORE__SCORING_WORKERS_HPP_
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dwb_core
+{
+
+/**
+ * @class ScoringWorkers
+ * @brief Persistent pool of threads sharding trajectory index ranges for
+ * parallel generation and critic scoring. Each thread is handed one
+ * contiguous range of trajectories per control cycle; the calling thread
+ * processes the first range itself, so a pool sized to one thread
+ * degenerates to a plain function call with no synchronization.
+ */
+class ScoringWorkers
+{
+public:
+  ScoringWorkers() = default;
+
+  /**
+   * @brief ScoringWorkers destructor, stops the workers
+   */
+  ~ScoringWorkers()
+  {
+    stop();
+  }
+
+  /**
+   * @brief Set the number of threads sharding the trajectories,
+   * respawning workers
+   * @param thread_count Threads to use, including the calling thread
+   */
+  void start(int thread_count)
+  {
+    thread_count = std::max(1, thread_count);
+    if (thread_count == thread_count_) {
+      return;
+    }
+
+    stop();
+    thread_count_ = thread_count;
+    active_ = true;
+    for (int i = 1; i < thread_count_; i++) {
+      // hand the worker the current cycle so respawned workers do not
+      // mistake a past task for a fresh one
+      workers_.push_back(std::thread(&ScoringWorkers::workerThread, this, i, cycle_));
+    }
+  }
+
+  /**
+   * @brief Get the number of threads sharding the trajectories
+   * @return Thread count, including the calling thread
+   */
+  int getThreadCount() const
+  {
+    return thread_count_;
+  }
+
+  /**
+   * @brief Stop and join the worker threads
+   */
+  void stop()
+  {
+    {
+      std::unique_lock<std::mutex> guard(mutex_);
+      active_ = false;
+    }
+    start_cond_.notify_all();
+    for (auto & worker : workers_) {
+      if (worker.joinable()) {
+        worker.join();
+      }
+    }
+    workers_.clear();
+    thread_count_ = 1;
+  }
+
+  /**
+   * @brief Run a function over trajectory indices [0, total), sharded
+   * across the pool's threads, returning once every range has completed
+   * @param total Number of trajectories to shard
+   * @param fn Function called per shard with its [begin, end) range
+   */
+  void run(size_t total, const std::function<void(size_t, size_t)> & fn)
+  {
+    if (thread_count_ <= 1 || total < 2 * static_cast<size_t>(thread_count_)) {
+      fn(0, total);
+      return;
+    }
+
+    {
+      std::unique_lock<std::mutex> guard(mutex_);
+      task_ = &fn;
+      total_ = total;
+      pending_ = thread_count_ - 1;
+      cycle_++;
+    }
+    start_cond_.notify_all();
+
+    runRange(0);
+
+    std::unique_lock<std::mutex> guard(mutex_);
+    done_cond_.wait(guard, [this]() {return pending_ == 0;});
+    task_ = nullptr;
+  }
+
+protected:
+  /**
+   * @brief Run one thread's range of the current task
+   * @param shard_id Which thread's range to run
+   */
+  void runRange(int shard_id)
+  {
+    const size_t range_size = (total_ + thread_count_ - 1) / thread_count_;
+    const size_t begin = shard_id * range_size;
+    const size_t end = std::min(total_, begin + range_size);
+    if (begin < end) {
+      (*task_)(begin, end);
+    }
+  }
+
+  /**
+   * @brief Worker thread body, waiting for tasks until stopped
+   * @param shard_id Which range of each task this worker runs
+   * @param last_cycle The task cycle current when the worker was spawned
+   */
+  void workerThread(int shard_id, unsigned int last_cycle)
+  {
+    while (true) {
+      {
+        std::unique_lock<std::mutex> guard(mutex_);
+        start_cond_.wait(guard, [&]() {return !active_ || cycle_ != last_cycle;});
+        if (!active_) {
+          return;
+        }
+        last_cycle = cycle_;
+      }
+
+      runRange(shard_id);
+
+      {
+        std::unique_lock<std::mutex> guard(mutex_);
+        pending_--;
+      }
+      done_cond_.notify_one();
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable start_cond_, done_cond_;
+
+  const std::function<void(size_t, size_t)> * task_{nullptr};
+  int thread_count_{1};
+  size_t total_{0};
+  int pending_{0};
+  unsigned int cycle_{0};
+  bool active_{false};
+};
+
+}  // namespace dwb_core
+
+#endif  // DWB_CORE__SCORING_WORKERS_HPP_
@@ -124,6 +124,27 @@ public:
     const nav_2d_msgs::msg::Twist2D & start_vel,
     const nav_2d_msgs::msg::Twist2D & cmd_vel) = 0;
 
+  /**
+   * @brief Generate a Trajectory2D into caller-provided storage
+   *
+   * Overwrites traj, reusing its pose and time offset capacity, so pooled
+   * trajectories can be regenerated every cycle without per-sample
+   * allocations. The default implementation falls back to the by-value
+   * overload for generators that predate this interface.
+   * @param start_pose Current robot location
+   * @param start_vel Current robot velocity
+   * @param cmd_vel The desired command velocity
+   * @param traj Output trajectory
+   */
+  virtual void generateTrajectory(
+    const geometry_msgs::msg::Pose2D & start_pose,
+    const nav_2d_msgs::msg::Twist2D & start_vel,
+    const nav_2d_msgs::msg::Twist2D & cmd_vel,
+    dwb_msgs::msg::Trajectory2D & traj)
+  {
+    traj = generateTrajectory(start_pose, start_vel, cmd_vel);
+  }
+
   /**
    * @brief Limits the maximum linear speed of the robot.
    * @param speed_limit expressed in absolute value (in m/s)
@@ -33,7 +33,9 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -108,6 +110,9 @@ void DWBLocalPlanner::configure(
   declare_parameter_if_not_declared(
     node, dwb_plugin_name_ + ".short_circuit_trajectory_evaluation",
     rclcpp::ParameterValue(true));
+  declare_parameter_if_not_declared(
+    node, dwb_plugin_name_ + ".scoring_threads",
+    rclcpp::ParameterValue(1));
 
   std::string traj_generator_name;
 
@@ -132,6 +137,10 @@ void DWBLocalPlanner::configure(
     short_circuit_trajectory_evaluation_);
   node->get_parameter(dwb_plugin_name_ + ".shorten_transformed_plan", shorten_transformed_plan_);
 
+  int scoring_threads = 1;
+  node->get_parameter(dwb_plugin_name_ + ".scoring_threads", scoring_threads);
+  scoring_workers_.start(scoring_threads);
+
   pub_ = std::make_unique<DWBPublisher>(node, dwb_plugin_name_);
   pub_->on_configure();
 
@@ -166,6 +175,7 @@ DWBLocalPlanner::cleanup()
 {
   pub_->on_cleanup();
 
+  scoring_workers_.stop();
   traj_generator_.reset();
 }
 
@@ -368,49 +378,102 @@ DWBLocalPlanner::coreScoringAlgorithm(
   const nav_2d_msgs::msg::Twist2D velocity,
   std::shared_ptr<dwb_msgs::msg::LocalPlanEvaluation> & results)
 {
-  nav_2d_msgs::msg::Twist2D twist;
-  dwb_msgs::msg::Trajectory2D traj;
   dwb_msgs::msg::TrajectoryScore best, worst;
   best.total = -1;
   worst.total = -1;
   IllegalTrajectoryTracker tracker;
 
+  // Materialize the twists up front so trajectory generation and critic
+  // scoring can be sharded across the scoring workers
+  twists_.clear();
   traj_generator_->startNewIteration(velocity);
   while (traj_generator_->hasMoreTwists()) {
-    twist = traj_generator_->nextTwist();
-    traj = traj_generator_->generateTrajectory(pose, velocity, twist);
+    twists_.push_back(traj_generator_->nextTwist());
+  }
 
-    try {
-      dwb_msgs::msg::TrajectoryScore score = scoreTrajectory(traj, best.total);
-      tracker.addLegalTrajectory();
-      if (results) {
-        results->twists.push_back(score);
-      }
-      if (best.total < 0 || score.total < best.total) {
-        best = score;
-        if (results) {
-          results->best_index = results->twists.size() - 1;
-        }
-      }
-      if (worst.total < 0 || score.total > worst.total) {
-        worst = score;
-        if (results) {
-          results->worst_index = results->twists.size() - 1;
+  // Pooled storage: resizing keeps the pose and critic score capacity of
+  // each slot from previous cycles, so generation and scoring run without
+  // steady-state allocations
+  scores_.resize(twists_.size());
+  failures_.assign(twists_.size(), nullptr);
+  // Shared short-circuit threshold; always at least as tight as the best
+  // any one worker has seen, so partial totals can never win
+  std::atomic<double> best_total{-1.0};
+  std::exception_ptr scoring_error;
+  std::mutex error_mutex;
+
+  scoring_workers_.run(
+    twists_.size(),
+    [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; i++) {
+        try {
+          dwb_msgs::msg::TrajectoryScore & score = scores_[i];
+          traj_generator_->generateTrajectory(pose, velocity, twists_[i], score.traj);
+          try {
+            scoreTrajectory(score.traj, best_total.load(std::memory_order_relaxed), score);
+
+            double seen = best_total.load(std::memory_order_relaxed);
+            while (seen < 0 || score.total < seen) {
+              if (best_total.compare_exchange_weak(
+                  seen, score.total, std::memory_order_relaxed))
+              {
+                break;
+              }
+            }
+          } catch (const dwb_core::IllegalTrajectoryException & e) {
+            failures_[i] = std::make_shared<dwb_core::IllegalTrajectoryException>(e);
+          }
+        } catch (...) {
+          std::lock_guard<std::mutex> guard(error_mutex);
+          scoring_error = std::current_exception();
+          return;
         }
       }
-    } catch (const dwb_core::IllegalTrajectoryException & e) {
+    });
+
+  if (scoring_error) {
+    std::rethrow_exception(scoring_error);
+  }
+
+  if (results) {
+    results->twists.reserve(twists_.size());
+  }
+
+  // Reduce in twist order so the results message, the tracker and the
+  // best/worst tie breaking all match a serial evaluation
+  for (size_t i = 0; i < twists_.size(); i++) {
+    if (failures_[i]) {
       if (results) {
         dwb_msgs::msg::TrajectoryScore failed_score;
-        failed_score.traj = traj;
+        failed_score.traj = scores_[i].traj;
 
         dwb_msgs::msg::CriticScore cs;
-        cs.name = e.getCriticName();
+        cs.name = failures_[i]->getCriticName();
         cs.raw_score = -1.0;
         failed_score.scores.push_back(cs);
         failed_score.total = -1.0;
         results->twists.push_back(failed_score);
       }
-      tracker.addIllegalTrajectory(e);
+      tracker.addIllegalTrajectory(*failures_[i]);
+      continue;
+    }
+
+    const dwb_msgs::msg::TrajectoryScore & score = scores_[i];
+    tracker.addLegalTrajectory();
+    if (results) {
+      results->twists.push_back(score);
+    }
+    if (best.total < 0 || score.total < best.total) {
+      best = score;
+      if (results) {
+        results->best_index = results->twists.size() - 1;
+      }
+    }
+    if (worst.total < 0 || score.total > worst.total) {
+      worst = score;
+      if (results) {
+        results->worst_index = results->twists.size() - 1;
+      }
     }
   }
 
@@ -437,6 +500,18 @@ DWBLocalPlanner::scoreTrajectory(
 {
   dwb_msgs::msg::TrajectoryScore score;
   score.traj = traj;
+  scoreTrajectory(traj, best_score, score);
+  return score;
+}
+
+void
+DWBLocalPlanner::scoreTrajectory(
+  const dwb_msgs::msg::Trajectory2D & traj,
+  double best_score,
+  dwb_msgs::msg::TrajectoryScore & score)
+{
+  score.scores.clear();
+  score.total = 0.0;
 
   for (TrajectoryCritic::Ptr & critic : critics_) {
     dwb_msgs::msg::CriticScore cs;
@@ -457,8 +532,6 @@ DWBLocalPlanner::scoreTrajectory(
       break;
     }
   }
-
-  return score;
 }
 
 nav_2d_msgs::msg::Path2D
@@ -159,8 +159,8 @@ DWBPublisher::publishEvaluation(std::shared_ptr<dwb_msgs::msg::LocalPlanEvaluati
 {
   if (results) {
     if (publish_evaluation_ && eval_pub_->get_subscription_count() > 0) {
-      auto msg = std::make_unique<dwb_msgs::msg::LocalPlanEvaluation>(*results);
-      eval_pub_->publish(std::move(msg));
+      // Publish by reference to avoid deep-copying the evaluation record
+      eval_pub_->publish(*results);
     }
     publishTrajectories(*results);
   }
@@ -236,6 +236,7 @@ DWBPublisher::publishLocalPlan(
   const dwb_msgs::msg::Trajectory2D & traj)
 {
   if (!publish_local_plan_) {return;}
+  if (local_pub_->get_subscription_count() < 1) {return;}
 
   auto path =
     std::make_unique<nav_msgs::msg::Path>(
@@ -243,9 +244,7 @@ DWBPublisher::publishLocalPlan(
       traj.poses, header.frame_id,
       header.stamp));
 
-  if (local_pub_->get_subscription_count() > 0) {
-    local_pub_->publish(std::move(path));
-  }
+  local_pub_->publish(std::move(path));
 }
 
 void
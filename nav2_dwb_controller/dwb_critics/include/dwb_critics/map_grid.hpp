@@ -41,6 +41,7 @@
 #include <utility>
 
 #include "dwb_core/trajectory_critic.hpp"
+#include "dwb_critics/map_grid_cache.hpp"
 #include "costmap_queue/costmap_queue.hpp"
 
 namespace dwb_critics
@@ -84,7 +85,7 @@ public:
    */
   inline double getScore(unsigned int x, unsigned int y)
   {
-    return cell_values_[costmap_->getIndex(x, y)];
+    return (*cell_values_)[costmap_->getIndex(x, y)];
   }
 
   /**
@@ -130,9 +131,17 @@ protected:
    */
   void propogateManhattanDistances();
 
+  /**
+   * @brief Propagate distances from the given seed cells, reusing a field
+   * another critic already propagated from the same seeds this cycle
+   * @param seeds Cell indices to propagate from, marked with zero score
+   */
+  void propagateDistancesFrom(const std::vector<unsigned int> & seeds);
+
   std::shared_ptr<MapGridQueue> queue_;
   nav2_costmap_2d::Costmap2D * costmap_;
-  std::vector<double> cell_values_;
+  std::shared_ptr<MapGridCache> cache_;
+  MapGridCache::Field cell_values_;
   double obstacle_score_, unreachable_score_;  ///< Special cell_values
   bool stop_on_failure_;
   ScoreAggregationType aggregationType_;
@@ -0,0 +1,111 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2017, Locus Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DWB_CRITICS__MAP_GRID_CACHE_HPP_
+#define DWB_CRITICS__MAP_GRID_CACHE_HPP_
+
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "geometry_msgs/msg/pose2_d.hpp"
+#include "nav_2d_msgs/msg/twist2_d.hpp"
+#include "nav2_costmap_2d/costmap_2d.hpp"
+
+namespace dwb_critics
+{
+/**
+ * @class MapGridCache
+ * @brief Distance fields from one control cycle, shared between MapGridCritic instances
+ *
+ * The breadth-first propagation in MapGridCritic queues every cell, so the
+ * resulting field depends only on the seed cells, not on the costmap contents.
+ * Critics seeded from the same cells therefore produce identical fields:
+ * PathAlign seeds from the same plan points as PathDist, and GoalAlign often
+ * lands on the same goal cell as GoalDist. All MapGridCritic instances scoring
+ * the same costmap share one cache, keyed by the exact seed index list, so only
+ * the first critic with a given seed set pays for the propagation each cycle.
+ */
+class MapGridCache
+{
+public:
+  typedef std::shared_ptr<std::vector<double>> Field;
+
+  /**
+   * @brief Get the cache shared by all critics scoring the given costmap
+   * @param costmap The costmap the critics score, used only as a key
+   * @return The cache for that costmap, created on first use
+   */
+  static std::shared_ptr<MapGridCache> getCache(const nav2_costmap_2d::Costmap2D * costmap);
+
+  /**
+   * @brief Drop the cached fields if the prepare arguments indicate a new control cycle
+   *
+   * Every critic prepared within one cycle sees the same pose, velocity and
+   * goal, so a change in any of them marks the cached fields as stale.
+   *
+   * @param pose Current pose passed to TrajectoryCritic::prepare
+   * @param vel Current velocity passed to TrajectoryCritic::prepare
+   * @param goal Goal pose passed to TrajectoryCritic::prepare
+   */
+  void startCycle(
+    const geometry_msgs::msg::Pose2D & pose, const nav_2d_msgs::msg::Twist2D & vel,
+    const geometry_msgs::msg::Pose2D & goal);
+
+  /**
+   * @brief Look up the field propagated from the given seed cells this cycle
+   * @param seeds Cell indices the propagation started from, with zero score
+   * @return The cached field, or nullptr if no critic has propagated from these seeds yet
+   */
+  Field lookup(const std::vector<unsigned int> & seeds);
+
+  /**
+   * @brief Store a freshly propagated field for reuse within the cycle
+   * @param seeds Cell indices the propagation started from
+   * @param field The propagated field
+   */
+  void store(const std::vector<unsigned int> & seeds, Field field);
+
+protected:
+  std::mutex mutex_;
+  std::array<double, 9> cycle_key_;
+  bool cycle_started_{false};
+  std::map<std::vector<unsigned int>, Field> fields_;
+};
+
+}  // namespace dwb_critics
+
+#endif  // DWB_CRITICS__MAP_GRID_CACHE_HPP_
@@ -35,6 +35,7 @@
 #ifndef DWB_CRITICS__OBSTACLE_FOOTPRINT_HPP_
 #define DWB_CRITICS__OBSTACLE_FOOTPRINT_HPP_
 
+#include <cstdint>
 #include <vector>
 #include "dwb_critics/base_obstacle.hpp"
 
@@ -61,13 +62,21 @@ Footprint getOrientedFootprint(
  *
  * A more robust class could check every cell within the robot's footprint without inflating the obstacles,
  * at some computational cost. That is left as an excercise to the reader.
+ *
+ * With the swept_checking parameter, consecutive poses of a trajectory share their border cells:
+ * each cell is only scored the first time the footprint border touches it, so scoring cost is
+ * proportional to the swept area rather than poses x footprint. Which trajectories are rejected
+ * is unchanged, since the union of checked cells is the same, but the score of a legal pose
+ * becomes the running maximum over the border swept so far instead of that pose's border alone.
  */
 class ObstacleFootprintCritic : public BaseObstacleCritic
 {
 public:
+  void onInit() override;
   bool prepare(
     const geometry_msgs::msg::Pose2D & pose, const nav_2d_msgs::msg::Twist2D & vel,
     const geometry_msgs::msg::Pose2D & goal, const nav_2d_msgs::msg::Path2D & global_plan) override;
+  double scoreTrajectory(const dwb_msgs::msg::Trajectory2D & traj) override;
   double scorePose(const geometry_msgs::msg::Pose2D & pose) override;
   virtual double scorePose(
     const geometry_msgs::msg::Pose2D & pose,
@@ -93,7 +102,18 @@ protected:
    */
   double pointCost(int x, int y);
 
+  /**
+   * @brief Score one pose of a trajectory, checking only border cells not yet swept
+   * @param pose The pose to score
+   * @param swept_max Running maximum cost over the border swept so far, updated in place
+   * @return The running maximum including this pose's newly swept cells
+   */
+  double scoreSweptPose(const geometry_msgs::msg::Pose2D & pose, double & swept_max);
+
   Footprint footprint_spec_;
+  bool swept_checking_;
+  std::vector<uint32_t> swept_;  ///< Per-cell stamp marking cells checked this trajectory
+  uint32_t sweep_stamp_{0};
 };
 }  // namespace dwb_critics
 
@@ -41,10 +41,11 @@
 namespace dwb_critics
 {
 bool GoalDistCritic::prepare(
-  const geometry_msgs::msg::Pose2D &, const nav_2d_msgs::msg::Twist2D &,
-  const geometry_msgs::msg::Pose2D &,
+  const geometry_msgs::msg::Pose2D & pose, const nav_2d_msgs::msg::Twist2D & vel,
+  const geometry_msgs::msg::Pose2D & goal,
   const nav_2d_msgs::msg::Path2D & global_plan)
 {
+  cache_->startCycle(pose, vel, goal);
   reset();
 
   unsigned int local_goal_x, local_goal_y;
@@ -52,12 +53,9 @@ bool GoalDistCritic::prepare(
     return false;
   }
 
-  // Enqueue just the last pose
-  int index = costmap_->getIndex(local_goal_x, local_goal_y);
-  cell_values_[index] = 0.0;
-  queue_->enqueueCell(local_goal_x, local_goal_y);
-
-  propogateManhattanDistances();
+  // Propagate from just the last pose
+  std::vector<unsigned int> seeds = {costmap_->getIndex(local_goal_x, local_goal_y)};
+  propagateDistancesFrom(seeds);
 
   return true;
 }
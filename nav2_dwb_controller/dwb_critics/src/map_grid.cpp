@@ -59,6 +59,8 @@ void MapGridCritic::onInit()
 {
   costmap_ = costmap_ros_->getCostmap();
   queue_ = std::make_shared<MapGridQueue>(*costmap_, *this);
+  cache_ = MapGridCache::getCache(costmap_);
+  cell_values_ = std::make_shared<std::vector<double>>();
 
   // Always set to true, but can be overriden by subclasses
   stop_on_failure_ = true;
@@ -93,27 +95,51 @@ void MapGridCritic::onInit()
 
 void MapGridCritic::setAsObstacle(unsigned int index)
 {
-  cell_values_[index] = obstacle_score_;
+  // never scribble on a field other critics may be sharing
+  if (cell_values_.use_count() > 1) {
+    cell_values_ = std::make_shared<std::vector<double>>(*cell_values_);
+  }
+  (*cell_values_)[index] = obstacle_score_;
 }
 
 void MapGridCritic::reset()
 {
   queue_->reset();
-  cell_values_.resize(costmap_->getSizeInCellsX() * costmap_->getSizeInCellsY());
-  obstacle_score_ = static_cast<double>(cell_values_.size());
+  const unsigned int size = costmap_->getSizeInCellsX() * costmap_->getSizeInCellsY();
+  obstacle_score_ = static_cast<double>(size);
   unreachable_score_ = obstacle_score_ + 1.0;
-  std::fill(cell_values_.begin(), cell_values_.end(), unreachable_score_);
+  if (cell_values_.use_count() > 1) {
+    cell_values_ = std::make_shared<std::vector<double>>();
+  }
+  cell_values_->assign(size, unreachable_score_);
 }
 
 void MapGridCritic::propogateManhattanDistances()
 {
   while (!queue_->isEmpty()) {
     costmap_queue::CellData cell = queue_->getNextCell();
-    cell_values_[cell.index_] = CellData::absolute_difference(cell.src_x_, cell.x_) +
+    (*cell_values_)[cell.index_] = CellData::absolute_difference(cell.src_x_, cell.x_) +
       CellData::absolute_difference(cell.src_y_, cell.y_);
   }
 }
 
+void MapGridCritic::propagateDistancesFrom(const std::vector<unsigned int> & seeds)
+{
+  MapGridCache::Field field = cache_->lookup(seeds);
+  if (field && field->size() == cell_values_->size()) {
+    cell_values_ = field;
+    return;
+  }
+
+  const unsigned int size_x = costmap_->getSizeInCellsX();
+  for (unsigned int index : seeds) {
+    (*cell_values_)[index] = 0.0;
+    queue_->enqueueCell(index % size_x, index / size_x);
+  }
+  propogateManhattanDistances();
+  cache_->store(seeds, cell_values_);
+}
+
 double MapGridCritic::scoreTrajectory(const dwb_msgs::msg::Trajectory2D & traj)
 {
   double score = 0.0;
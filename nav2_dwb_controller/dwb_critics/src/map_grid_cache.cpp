@@ -0,0 +1,90 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2017, Locus Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dwb_critics/map_grid_cache.hpp"
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace dwb_critics
+{
+
+std::shared_ptr<MapGridCache> MapGridCache::getCache(const nav2_costmap_2d::Costmap2D * costmap)
+{
+  static std::mutex registry_mutex;
+  static std::map<const nav2_costmap_2d::Costmap2D *,
+    std::weak_ptr<MapGridCache>> registry;
+
+  std::lock_guard<std::mutex> guard(registry_mutex);
+  std::shared_ptr<MapGridCache> cache = registry[costmap].lock();
+  if (!cache) {
+    cache = std::make_shared<MapGridCache>();
+    registry[costmap] = cache;
+  }
+  return cache;
+}
+
+void MapGridCache::startCycle(
+  const geometry_msgs::msg::Pose2D & pose, const nav_2d_msgs::msg::Twist2D & vel,
+  const geometry_msgs::msg::Pose2D & goal)
+{
+  const std::array<double, 9> key =
+  {pose.x, pose.y, pose.theta, vel.x, vel.y, vel.theta, goal.x, goal.y, goal.theta};
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  if (!cycle_started_ || key != cycle_key_) {
+    fields_.clear();
+    cycle_key_ = key;
+    cycle_started_ = true;
+  }
+}
+
+MapGridCache::Field MapGridCache::lookup(const std::vector<unsigned int> & seeds)
+{
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto it = fields_.find(seeds);
+  if (it == fields_.end()) {
+    return nullptr;
+  }
+  return it->second;
+}
+
+void MapGridCache::store(const std::vector<unsigned int> & seeds, Field field)
+{
+  std::lock_guard<std::mutex> guard(mutex_);
+  fields_[seeds] = std::move(field);
+}
+
+}  // namespace dwb_critics
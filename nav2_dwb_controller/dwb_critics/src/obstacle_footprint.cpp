@@ -34,11 +34,13 @@
 
 #include "dwb_critics/obstacle_footprint.hpp"
 #include <algorithm>
+#include <limits>
 #include <vector>
 #include "dwb_critics/line_iterator.hpp"
 #include "dwb_core/exceptions.hpp"
 #include "pluginlib/class_list_macros.hpp"
 #include "nav2_costmap_2d/cost_values.hpp"
+#include "nav2_util/node_utils.hpp"
 
 PLUGINLIB_EXPORT_CLASS(dwb_critics::ObstacleFootprintCritic, dwb_core::TrajectoryCritic)
 
@@ -60,6 +62,21 @@ Footprint getOrientedFootprint(
   return oriented_footprint;
 }
 
+void ObstacleFootprintCritic::onInit()
+{
+  BaseObstacleCritic::onInit();
+
+  auto node = node_.lock();
+  if (!node) {
+    throw std::runtime_error{"Failed to lock node"};
+  }
+
+  nav2_util::declare_parameter_if_not_declared(
+    node,
+    dwb_plugin_name_ + "." + name_ + ".swept_checking", rclcpp::ParameterValue(false));
+  node->get_parameter(dwb_plugin_name_ + "." + name_ + ".swept_checking", swept_checking_);
+}
+
 bool ObstacleFootprintCritic::prepare(
   const geometry_msgs::msg::Pose2D &, const nav_2d_msgs::msg::Twist2D &,
   const geometry_msgs::msg::Pose2D &, const nav_2d_msgs::msg::Path2D &)
@@ -74,6 +91,66 @@ bool ObstacleFootprintCritic::prepare(
   return true;
 }
 
+double ObstacleFootprintCritic::scoreTrajectory(const dwb_msgs::msg::Trajectory2D & traj)
+{
+  if (!swept_checking_) {
+    return BaseObstacleCritic::scoreTrajectory(traj);
+  }
+
+  const unsigned int size = costmap_->getSizeInCellsX() * costmap_->getSizeInCellsY();
+  if (swept_.size() != size || sweep_stamp_ == std::numeric_limits<uint32_t>::max()) {
+    swept_.assign(size, 0);
+    sweep_stamp_ = 0;
+  }
+  sweep_stamp_++;
+
+  double score = 0.0;
+  double swept_max = 0.0;
+  for (unsigned int i = 0; i < traj.poses.size(); ++i) {
+    double pose_score = scoreSweptPose(traj.poses[i], swept_max);
+    // Optimized/branchless version of if (sum_scores_) score += pose_score,
+    // else score = pose_score;
+    score = static_cast<double>(sum_scores_) * score + pose_score;
+  }
+  return score;
+}
+
+double ObstacleFootprintCritic::scoreSweptPose(
+  const geometry_msgs::msg::Pose2D & pose, double & swept_max)
+{
+  unsigned int cell_x, cell_y;
+  if (!costmap_->worldToMap(pose.x, pose.y, cell_x, cell_y)) {
+    throw dwb_core::
+          IllegalTrajectoryException(name_, "Trajectory Goes Off Grid.");
+  }
+
+  Footprint footprint = getOrientedFootprint(pose, footprint_spec_);
+  const unsigned int size_x = costmap_->getSizeInCellsX();
+
+  // rasterize each border line, but only score cells the trajectory's
+  // footprint has not already swept over
+  unsigned int x0, x1, y0, y1;
+  for (unsigned int i = 0; i < footprint.size(); ++i) {
+    const geometry_msgs::msg::Point & a = footprint[i];
+    const geometry_msgs::msg::Point & b = footprint[(i + 1) % footprint.size()];
+    if (!costmap_->worldToMap(a.x, a.y, x0, y0) || !costmap_->worldToMap(b.x, b.y, x1, y1)) {
+      throw dwb_core::
+            IllegalTrajectoryException(name_, "Footprint Goes Off Grid.");
+    }
+
+    for (LineIterator line(x0, y0, x1, y1); line.isValid(); line.advance()) {
+      unsigned int index = line.getY() * size_x + line.getX();
+      if (swept_[index] == sweep_stamp_) {
+        continue;
+      }
+      swept_[index] = sweep_stamp_;
+      swept_max = std::max(swept_max, pointCost(line.getX(), line.getY()));
+    }
+  }
+
+  return swept_max;
+}
+
 double ObstacleFootprintCritic::scorePose(const geometry_msgs::msg::Pose2D & pose)
 {
   unsigned int cell_x, cell_y;
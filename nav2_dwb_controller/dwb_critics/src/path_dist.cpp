@@ -41,11 +41,13 @@
 namespace dwb_critics
 {
 bool PathDistCritic::prepare(
-  const geometry_msgs::msg::Pose2D &, const nav_2d_msgs::msg::Twist2D &,
-  const geometry_msgs::msg::Pose2D &,
+  const geometry_msgs::msg::Pose2D & pose, const nav_2d_msgs::msg::Twist2D & vel,
+  const geometry_msgs::msg::Pose2D & goal,
   const nav_2d_msgs::msg::Path2D & global_plan)
 {
+  cache_->startCycle(pose, vel, goal);
   reset();
+  std::vector<unsigned int> seeds;
   bool started_path = false;
 
   nav_2d_msgs::msg::Path2D adjusted_global_plan =
@@ -68,9 +70,7 @@ bool PathDistCritic::prepare(
         g_x, g_y, map_x,
         map_y) && costmap_->getCost(map_x, map_y) != nav2_costmap_2d::NO_INFORMATION)
     {
-      int index = costmap_->getIndex(map_x, map_y);
-      cell_values_[index] = 0.0;
-      queue_->enqueueCell(map_x, map_y);
+      seeds.push_back(costmap_->getIndex(map_x, map_y));
       started_path = true;
     } else if (started_path) {
       break;
@@ -85,7 +85,7 @@ bool PathDistCritic::prepare(
     return false;
   }
 
-  propogateManhattanDistances();
+  propagateDistancesFrom(seeds);
 
   return true;
 }
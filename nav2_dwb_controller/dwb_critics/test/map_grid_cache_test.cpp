@@ -0,0 +1,95 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2017, Locus Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "dwb_critics/map_grid_cache.hpp"
+
+using dwb_critics::MapGridCache;
+
+TEST(MapGridCacheTests, OneCachePerCostmap)
+{
+  nav2_costmap_2d::Costmap2D costmap_a, costmap_b;
+  EXPECT_EQ(MapGridCache::getCache(&costmap_a), MapGridCache::getCache(&costmap_a));
+  EXPECT_NE(MapGridCache::getCache(&costmap_a), MapGridCache::getCache(&costmap_b));
+}
+
+TEST(MapGridCacheTests, FieldsKeyedBySeeds)
+{
+  nav2_costmap_2d::Costmap2D costmap;
+  auto cache = MapGridCache::getCache(&costmap);
+
+  geometry_msgs::msg::Pose2D pose, goal;
+  nav_2d_msgs::msg::Twist2D vel;
+  cache->startCycle(pose, vel, goal);
+
+  std::vector<unsigned int> seeds = {3, 7, 11};
+  EXPECT_EQ(cache->lookup(seeds), nullptr);
+
+  auto field = std::make_shared<std::vector<double>>(100, 2.0);
+  cache->store(seeds, field);
+  EXPECT_EQ(cache->lookup(seeds), field);
+  EXPECT_EQ(cache->lookup({3, 7}), nullptr);
+  EXPECT_EQ(cache->lookup({3, 7, 12}), nullptr);
+}
+
+TEST(MapGridCacheTests, NewCycleDropsFields)
+{
+  nav2_costmap_2d::Costmap2D costmap;
+  auto cache = MapGridCache::getCache(&costmap);
+
+  geometry_msgs::msg::Pose2D pose, goal;
+  nav_2d_msgs::msg::Twist2D vel;
+  cache->startCycle(pose, vel, goal);
+
+  std::vector<unsigned int> seeds = {42};
+  cache->store(seeds, std::make_shared<std::vector<double>>(10, 0.0));
+
+  // same pose, velocity and goal: still the same cycle
+  cache->startCycle(pose, vel, goal);
+  EXPECT_NE(cache->lookup(seeds), nullptr);
+
+  // any change marks a new cycle
+  pose.x = 0.5;
+  cache->startCycle(pose, vel, goal);
+  EXPECT_EQ(cache->lookup(seeds), nullptr);
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
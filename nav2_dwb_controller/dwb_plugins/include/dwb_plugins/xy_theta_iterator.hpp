@@ -37,6 +37,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "dwb_plugins/velocity_iterator.hpp"
 #include "dwb_plugins/one_d_velocity_iterator.hpp"
@@ -60,10 +61,28 @@ public:
 protected:
   virtual bool isValidVelocity();
   void iterateToValidVelocity();
+
+  /**
+   * @brief Enumerate the admissible samples into the flat sample grid
+   *
+   * The grid only depends on the current velocity, the projection time and
+   * the kinematic limits, so startNewIteration() reuses it until one of
+   * those inputs moves by more than sample_regen_threshold.
+   */
+  void buildSampleGrid(const nav_2d_msgs::msg::Twist2D & current_velocity, double dt);
+
   int vx_samples_, vy_samples_, vtheta_samples_;
   KinematicsHandler::Ptr kinematics_handler_;
 
   std::shared_ptr<OneDVelocityIterator> x_it_, y_it_, th_it_;
+
+  double sample_regen_threshold_;
+  std::vector<nav_2d_msgs::msg::Twist2D> samples_;
+  size_t sample_index_{0};
+  bool have_samples_{false};
+  nav_2d_msgs::msg::Twist2D grid_velocity_;
+  double grid_dt_{0.0};
+  KinematicParameters grid_kinematics_;
 };
 }  // namespace dwb_plugins
 
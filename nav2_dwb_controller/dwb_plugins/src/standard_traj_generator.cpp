@@ -149,12 +149,26 @@ dwb_msgs::msg::Trajectory2D StandardTrajectoryGenerator::generateTrajectory(
   const nav_2d_msgs::msg::Twist2D & cmd_vel)
 {
   dwb_msgs::msg::Trajectory2D traj;
+  generateTrajectory(start_pose, start_vel, cmd_vel, traj);
+  return traj;
+}
+
+void StandardTrajectoryGenerator::generateTrajectory(
+  const geometry_msgs::msg::Pose2D & start_pose,
+  const nav_2d_msgs::msg::Twist2D & start_vel,
+  const nav_2d_msgs::msg::Twist2D & cmd_vel,
+  dwb_msgs::msg::Trajectory2D & traj)
+{
   traj.velocity = cmd_vel;
+  traj.poses.clear();
+  traj.time_offsets.clear();
   //  simulate the trajectory
   geometry_msgs::msg::Pose2D pose = start_pose;
   nav_2d_msgs::msg::Twist2D vel = start_vel;
   double running_time = 0.0;
   std::vector<double> steps = getTimeSteps(cmd_vel);
+  traj.poses.reserve(steps.size() + 2);
+  traj.time_offsets.reserve(steps.size() + 1);
   traj.poses.push_back(start_pose);
   for (double dt : steps) {
     //  calculate velocities
@@ -172,8 +186,6 @@ dwb_msgs::msg::Trajectory2D StandardTrajectoryGenerator::generateTrajectory(
     traj.poses.push_back(pose);
     traj.time_offsets.push_back(rclcpp::Duration::from_seconds(running_time));
   }
-
-  return traj;
 }
 
 /**
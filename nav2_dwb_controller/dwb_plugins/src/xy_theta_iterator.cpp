@@ -63,11 +63,49 @@ void XYThetaIterator::initialize(
   nh->get_parameter(plugin_name + ".vx_samples", vx_samples_);
   nh->get_parameter(plugin_name + ".vy_samples", vy_samples_);
   nh->get_parameter(plugin_name + ".vtheta_samples", vtheta_samples_);
+
+  nav2_util::declare_parameter_if_not_declared(
+    nh,
+    plugin_name + ".sample_regen_threshold", rclcpp::ParameterValue(0.0));
+  nh->get_parameter(plugin_name + ".sample_regen_threshold", sample_regen_threshold_);
+}
+
+// The kinematic limits that shape the sample grid: the per-axis ranges and
+// acceleration limits plus everything isValidSpeed consults
+static bool sameLimits(KinematicParameters & a, KinematicParameters & b)
+{
+  return a.getMinX() == b.getMinX() && a.getMaxX() == b.getMaxX() &&
+         a.getAccX() == b.getAccX() && a.getDecelX() == b.getDecelX() &&
+         a.getMinY() == b.getMinY() && a.getMaxY() == b.getMaxY() &&
+         a.getAccY() == b.getAccY() && a.getDecelY() == b.getDecelY() &&
+         a.getMinTheta() == b.getMinTheta() && a.getMaxTheta() == b.getMaxTheta() &&
+         a.getAccTheta() == b.getAccTheta() && a.getDecelTheta() == b.getDecelTheta() &&
+         a.getMinSpeedXY() == b.getMinSpeedXY() && a.getMaxSpeedXY() == b.getMaxSpeedXY() &&
+         a.getMinSpeedTheta() == b.getMinSpeedTheta();
 }
 
 void XYThetaIterator::startNewIteration(
   const nav_2d_msgs::msg::Twist2D & current_velocity,
   double dt)
+{
+  KinematicParameters kinematics = kinematics_handler_->getKinematics();
+  if (!have_samples_ || dt != grid_dt_ || !sameLimits(kinematics, grid_kinematics_) ||
+    fabs(current_velocity.x - grid_velocity_.x) > sample_regen_threshold_ ||
+    fabs(current_velocity.y - grid_velocity_.y) > sample_regen_threshold_ ||
+    fabs(current_velocity.theta - grid_velocity_.theta) > sample_regen_threshold_)
+  {
+    buildSampleGrid(current_velocity, dt);
+    grid_velocity_ = current_velocity;
+    grid_dt_ = dt;
+    grid_kinematics_ = kinematics;
+    have_samples_ = true;
+  }
+  sample_index_ = 0;
+}
+
+void XYThetaIterator::buildSampleGrid(
+  const nav_2d_msgs::msg::Twist2D & current_velocity,
+  double dt)
 {
   KinematicParameters kinematics = kinematics_handler_->getKinematics();
   x_it_ = std::make_shared<OneDVelocityIterator>(
@@ -88,6 +126,17 @@ void XYThetaIterator::startNewIteration(
   if (!isValidVelocity()) {
     iterateToValidVelocity();
   }
+
+  samples_.clear();
+  while (x_it_ && !x_it_->isFinished()) {
+    nav_2d_msgs::msg::Twist2D velocity;
+    velocity.x = x_it_->getVelocity();
+    velocity.y = y_it_->getVelocity();
+    velocity.theta = th_it_->getVelocity();
+    samples_.push_back(velocity);
+
+    iterateToValidVelocity();
+  }
 }
 
 bool XYThetaIterator::isValidVelocity()
@@ -98,25 +147,18 @@ bool XYThetaIterator::isValidVelocity()
 
 bool XYThetaIterator::hasMoreTwists()
 {
-  return x_it_ && !x_it_->isFinished();
+  return sample_index_ < samples_.size();
 }
 
 nav_2d_msgs::msg::Twist2D XYThetaIterator::nextTwist()
 {
-  nav_2d_msgs::msg::Twist2D velocity;
-  velocity.x = x_it_->getVelocity();
-  velocity.y = y_it_->getVelocity();
-  velocity.theta = th_it_->getVelocity();
-
-  iterateToValidVelocity();
-
-  return velocity;
+  return samples_[sample_index_++];
 }
 
 void XYThetaIterator::iterateToValidVelocity()
 {
   bool valid = false;
-  while (!valid && hasMoreTwists()) {
+  while (!valid && x_it_ && !x_it_->isFinished()) {
     ++(*th_it_);
     if (th_it_->isFinished()) {
       th_it_->reset();
@@ -34,6 +34,8 @@
 
 #include "nav_2d_utils/conversions.hpp"
 
+#include <cstddef>
+#include <stdexcept>
 #include <vector>
 #include <string>
 
@@ -155,8 +157,47 @@ nav_2d_msgs::msg::Path2D pathToPath2D(const nav_msgs::msg::Path & path)
 {
   nav_2d_msgs::msg::Path2D path2d;
   path2d.header = path.header;
-  for (auto & pose : path.poses) {
-    path2d.poses.push_back(poseToPose2D(pose.pose));
+  path2d.poses.resize(path.poses.size());
+  for (unsigned int i = 0; i < path.poses.size(); i++) {
+    path2d.poses[i] = poseToPose2D(path.poses[i].pose);
+  }
+  return path2d;
+}
+
+nav_2d_msgs::msg::Path2D compactPathToPath2D(const nav2_msgs::msg::CompactPath & compact)
+{
+  // Fast path: the compact representation already stores x/y/yaw, so the
+  // poses are reconstructed by accumulating the deltas without going
+  // through quaternions at all
+  const size_t delta_count =
+    compact.pose_count > 0u ? static_cast<size_t>(compact.pose_count) - 1 : 0u;
+  if (compact.delta_x.size() != delta_count ||
+    compact.delta_y.size() != delta_count ||
+    compact.delta_theta.size() != delta_count)
+  {
+    throw std::invalid_argument("Compact path delta arrays do not match its pose count");
+  }
+
+  nav_2d_msgs::msg::Path2D path2d;
+  path2d.header = compact.header;
+  path2d.poses.resize(compact.pose_count);
+  if (compact.pose_count == 0u) {
+    return path2d;
+  }
+
+  double x = compact.start_x;
+  double y = compact.start_y;
+  double theta = compact.start_theta;
+  for (unsigned int i = 0; i < path2d.poses.size(); i++) {
+    if (i > 0) {
+      x += compact.delta_x[i - 1] * compact.xy_resolution;
+      y += compact.delta_y[i - 1] * compact.xy_resolution;
+      theta += compact.delta_theta[i - 1] * compact.theta_resolution;
+      theta = atan2(sin(theta), cos(theta));
+    }
+    path2d.poses[i].x = x;
+    path2d.poses[i].y = y;
+    path2d.poses[i].theta = theta;
   }
   return path2d;
 }
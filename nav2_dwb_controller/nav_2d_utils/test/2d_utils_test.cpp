@@ -34,6 +34,7 @@
 
 #include <math.h>
 #include <tf2/LinearMath/Quaternion.h>
+#include <stdexcept>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -146,6 +147,44 @@ TEST(nav_2d_utils, PathToPathNoNEmpty)
   EXPECT_EQ(path.poses[1].pose.orientation.z, quat.z());
 }
 
+TEST(nav_2d_utils, CompactPathToPath2D)
+{
+  nav2_msgs::msg::CompactPath compact;
+  compact.header.frame_id = "map";
+  compact.pose_count = 3;
+  compact.xy_resolution = 0.01;
+  compact.theta_resolution = 0.001;
+  compact.start_x = 1.0;
+  compact.start_y = 2.0;
+  compact.start_theta = 0.5;
+  compact.delta_x = {100, -50};
+  compact.delta_y = {25, 0};
+  compact.delta_theta = {200, -100};
+
+  nav_2d_msgs::msg::Path2D path2d = nav_2d_utils::compactPathToPath2D(compact);
+  EXPECT_EQ(path2d.header.frame_id, "map");
+  ASSERT_EQ(path2d.poses.size(), 3ul);
+  EXPECT_DOUBLE_EQ(path2d.poses[0].x, 1.0);
+  EXPECT_DOUBLE_EQ(path2d.poses[0].y, 2.0);
+  EXPECT_DOUBLE_EQ(path2d.poses[0].theta, 0.5);
+  EXPECT_NEAR(path2d.poses[1].x, 2.0, 1e-9);
+  EXPECT_NEAR(path2d.poses[1].y, 2.25, 1e-9);
+  EXPECT_NEAR(path2d.poses[1].theta, 0.7, 1e-9);
+  EXPECT_NEAR(path2d.poses[2].x, 1.5, 1e-9);
+  EXPECT_NEAR(path2d.poses[2].y, 2.25, 1e-9);
+  EXPECT_NEAR(path2d.poses[2].theta, 0.6, 1e-9);
+
+  // Delta arrays not matching the pose count must be rejected
+  compact.pose_count = 5;
+  EXPECT_THROW(nav_2d_utils::compactPathToPath2D(compact), std::invalid_argument);
+
+  compact.pose_count = 0;
+  compact.delta_x.clear();
+  compact.delta_y.clear();
+  compact.delta_theta.clear();
+  EXPECT_EQ(nav_2d_utils::compactPathToPath2D(compact).poses.size(), 0ul);
+}
+
 int main(int argc, char ** argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
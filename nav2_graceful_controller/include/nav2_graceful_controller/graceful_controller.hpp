@@ -164,6 +164,15 @@ protected:
   double goal_dist_tolerance_;
   bool goal_reached_;
 
+  // Previous cycle's simulation, reused while the motion target and direction
+  // are effectively unchanged in the robot frame
+  bool sim_cache_valid_{false};
+  geometry_msgs::msg::PoseStamped cached_motion_target_;
+  bool cached_backward_{false};
+  nav_msgs::msg::Path cached_trajectory_;
+  geometry_msgs::msg::TransformStamped cached_costmap_transform_;
+  unsigned int cached_costmap_update_count_{0};
+
   std::shared_ptr<rclcpp_lifecycle::LifecyclePublisher<nav_msgs::msg::Path>> transformed_plan_pub_;
   std::shared_ptr<rclcpp_lifecycle::LifecyclePublisher<nav_msgs::msg::Path>> local_plan_pub_;
   std::shared_ptr<rclcpp_lifecycle::LifecyclePublisher<geometry_msgs::msg::PointStamped>>
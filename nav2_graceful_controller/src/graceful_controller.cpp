@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "angles/angles.h"
 #include "nav2_core/controller_exceptions.hpp"
 #include "nav2_util/geometry_utils.hpp"
 #include "nav2_graceful_controller/graceful_controller.hpp"
@@ -214,6 +215,7 @@ void GracefulController::setPlan(const nav_msgs::msg::Path & path)
 {
   path_handler_->setPlan(path);
   goal_reached_ = false;
+  sim_cache_valid_ = false;
 }
 
 void GracefulController::setSpeedLimit(
@@ -221,6 +223,9 @@ void GracefulController::setSpeedLimit(
 {
   std::lock_guard<std::mutex> param_lock(param_handler_->getMutex());
 
+  // The simulation time step depends on the maximum linear speed
+  sim_cache_valid_ = false;
+
   if (speed_limit == nav2_costmap_2d::NO_SPEED_LIMIT) {
     params_->v_linear_max = params_->v_linear_max_initial;
     params_->v_angular_max = params_->v_angular_max_initial;
@@ -269,9 +274,60 @@ bool GracefulController::simulateTrajectory(
       robot_pose.pose.position.x, robot_pose.pose.position.y,
       tf2::getYaw(robot_pose.pose.orientation)))
   {
+    sim_cache_valid_ = false;
     return false;
   }
 
+  double resolution_ = costmap_ros_->getCostmap()->getResolution();
+  unsigned int costmap_update_count = costmap_ros_->getLayeredCostmap()->getUpdateCount();
+
+  // The simulation integrates in the robot frame, so its shape only depends on
+  // the motion target and direction. If those are effectively unchanged since
+  // the previous cycle, reuse the previous integration and only re-check for
+  // collisions, and only when the costmap or the robot pose actually changed
+  if (sim_cache_valid_ && backward == cached_backward_ &&
+    std::hypot(
+      motion_target.pose.position.x - cached_motion_target_.pose.position.x,
+      motion_target.pose.position.y - cached_motion_target_.pose.position.y) <
+    0.5 * resolution_ &&
+    fabs(
+      angles::shortest_angular_distance(
+        tf2::getYaw(motion_target.pose.orientation),
+        tf2::getYaw(cached_motion_target_.pose.orientation))) < 0.05)
+  {
+    trajectory = cached_trajectory_;
+
+    bool transform_unchanged =
+      std::hypot(
+      costmap_transform.transform.translation.x -
+      cached_costmap_transform_.transform.translation.x,
+      costmap_transform.transform.translation.y -
+      cached_costmap_transform_.transform.translation.y) < 0.5 * resolution_ &&
+      fabs(
+      angles::shortest_angular_distance(
+        tf2::getYaw(costmap_transform.transform.rotation),
+        tf2::getYaw(cached_costmap_transform_.transform.rotation))) < 0.05;
+    if (transform_unchanged && costmap_update_count == cached_costmap_update_count_) {
+      // Same swath against the same costmap: the previous check still holds
+      return true;
+    }
+
+    for (const auto & traj_pose : trajectory.poses) {
+      geometry_msgs::msg::PoseStamped global_pose;
+      tf2::doTransform(traj_pose, global_pose, costmap_transform);
+      if (inCollision(
+          global_pose.pose.position.x, global_pose.pose.position.y,
+          tf2::getYaw(global_pose.pose.orientation)))
+      {
+        sim_cache_valid_ = false;
+        return false;
+      }
+    }
+    cached_costmap_transform_ = costmap_transform;
+    cached_costmap_update_count_ = costmap_update_count;
+    return true;
+  }
+
   // First pose
   geometry_msgs::msg::PoseStamped next_pose;
   next_pose.header.frame_id = costmap_ros_->getBaseFrameID();
@@ -279,7 +335,6 @@ bool GracefulController::simulateTrajectory(
   trajectory.poses.push_back(next_pose);
 
   double distance = std::numeric_limits<double>::max();
-  double resolution_ = costmap_ros_->getCostmap()->getResolution();
   double dt = (params_->v_linear_max > 0.0) ? resolution_ / params_->v_linear_max : 0.0;
 
   // Set max iter to avoid infinite loop
@@ -303,6 +358,7 @@ bool GracefulController::simulateTrajectory(
         global_pose.pose.position.x, global_pose.pose.position.y,
         tf2::getYaw(global_pose.pose.orientation)))
     {
+      sim_cache_valid_ = false;
       return false;
     }
 
@@ -310,6 +366,14 @@ bool GracefulController::simulateTrajectory(
     distance = nav2_util::geometry_utils::euclidean_distance(motion_target.pose, next_pose.pose);
   }while(distance > resolution_ && trajectory.poses.size() < max_iter);
 
+  // Cache the integration for reuse on the next cycle
+  cached_motion_target_ = motion_target;
+  cached_backward_ = backward;
+  cached_trajectory_ = trajectory;
+  cached_costmap_transform_ = costmap_transform;
+  cached_costmap_update_count_ = costmap_update_count;
+  sim_cache_valid_ = true;
+
   return true;
 }
 
@@ -197,11 +197,37 @@ protected:
     const std::string & node_name,
     std::uint8_t transition);
 
+  /**
+   * @brief For a node, call the transition service and verify the resulting
+   * state, without any bond handling. Safe to call concurrently for
+   * different nodes since each service client spins its own callback group.
+   */
+  bool transitionNode(
+    const std::string & node_name,
+    std::uint8_t transition);
+
   /**
    * @brief For each node in the map, transition to the new target state
    */
   bool changeStateForAllNodes(std::uint8_t transition, bool hard_change = false);
 
+  /**
+   * @brief Transition a group of mutually independent nodes concurrently
+   */
+  bool changeStateForGroup(
+    const std::vector<std::string> & group,
+    std::uint8_t transition,
+    bool hard_change);
+
+  /**
+   * @brief Group the managed nodes into dependency levels from the per-node
+   * depends_on parameters. Nodes within a level are independent and may be
+   * transitioned concurrently. Leaves the groups empty, keeping the
+   * sequential list-order behavior, when no dependencies are declared or the
+   * declarations form a cycle.
+   */
+  void computeTransitionGroups();
+
   // Convenience function to highlight the output on the console
   /**
    * @brief Helper function to highlight the output on the console
@@ -247,6 +273,14 @@ protected:
   // The names of the nodes to be managed, in the order of desired bring-up
   std::vector<std::string> node_names_;
 
+  // The declared depends_on nodes for each managed node
+  std::map<std::string, std::vector<std::string>> node_dependencies_;
+
+  // Dependency levels of the managed nodes, transitioned in order for
+  // bring-up and in reverse order for tear-down; empty when transitions
+  // should fall back to the sequential list order
+  std::vector<std::vector<std::string>> transition_groups_;
+
   // Whether to automatically start up the system
   bool autostart_;
   bool attempt_respawn_reconnection_;
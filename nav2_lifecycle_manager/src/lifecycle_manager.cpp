@@ -15,7 +15,10 @@
 
 #include "nav2_lifecycle_manager/lifecycle_manager.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -60,6 +63,30 @@ LifecycleManager::LifecycleManager(const rclcpp::NodeOptions & options)
 
   get_parameter("attempt_respawn_reconnection", attempt_respawn_reconnection_);
 
+  // Each node may declare which other managed nodes it depends on, allowing
+  // independent nodes to be transitioned concurrently
+  for (auto & node_name : node_names_) {
+    declare_parameter(node_name + ".depends_on", std::vector<std::string>());
+    std::vector<std::string> depends_on =
+      get_parameter(node_name + ".depends_on").as_string_array();
+    auto & dependencies = node_dependencies_[node_name];
+    for (auto & dependency : depends_on) {
+      if (std::find(dependencies.begin(), dependencies.end(), dependency) != dependencies.end()) {
+        continue;
+      }
+      if (dependency == node_name ||
+        std::find(node_names_.begin(), node_names_.end(), dependency) == node_names_.end())
+      {
+        RCLCPP_WARN(
+          get_logger(), "Ignoring invalid dependency %s of node %s.",
+          dependency.c_str(), node_name.c_str());
+        continue;
+      }
+      dependencies.push_back(dependency);
+    }
+  }
+  computeTransitionGroups();
+
   callback_group_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive, false);
   manager_srv_ = create_service<ManageLifecycleNodes>(
     get_name() + std::string("/manage_nodes"),
@@ -240,8 +267,64 @@ LifecycleManager::createBondConnection(const std::string & node_name)
   return true;
 }
 
+void
+LifecycleManager::computeTransitionGroups()
+{
+  transition_groups_.clear();
+
+  bool has_dependencies = false;
+  for (auto & kv : node_dependencies_) {
+    has_dependencies = has_dependencies || !kv.second.empty();
+  }
+  if (!has_dependencies) {
+    return;
+  }
+
+  // Group the nodes into topological levels: a node joins the first level
+  // after all of its dependencies, so nodes within a level never depend on
+  // one another. List order is preserved within each level.
+  std::map<std::string, size_t> remaining_dependencies;
+  for (auto & node_name : node_names_) {
+    remaining_dependencies[node_name] = node_dependencies_[node_name].size();
+  }
+
+  size_t grouped = 0;
+  while (grouped < node_names_.size()) {
+    std::vector<std::string> group;
+    for (auto & node_name : node_names_) {
+      if (remaining_dependencies[node_name] == 0) {
+        group.push_back(node_name);
+        remaining_dependencies[node_name] = SIZE_MAX;
+      }
+    }
+    if (group.empty()) {
+      RCLCPP_ERROR(
+        get_logger(),
+        "Dependency cycle in the depends_on parameters. "
+        "Falling back to sequential transitions in node_names order.");
+      transition_groups_.clear();
+      return;
+    }
+    for (auto & node_name : node_names_) {
+      if (remaining_dependencies[node_name] == SIZE_MAX) {
+        continue;
+      }
+      auto & dependencies = node_dependencies_[node_name];
+      for (auto & ready_node : group) {
+        if (std::find(dependencies.begin(), dependencies.end(), ready_node) !=
+          dependencies.end())
+        {
+          remaining_dependencies[node_name]--;
+        }
+      }
+    }
+    grouped += group.size();
+    transition_groups_.push_back(std::move(group));
+  }
+}
+
 bool
-LifecycleManager::changeStateForNode(const std::string & node_name, std::uint8_t transition)
+LifecycleManager::transitionNode(const std::string & node_name, std::uint8_t transition)
 {
   message(transition_label_map_[transition] + node_name);
 
@@ -252,6 +335,16 @@ LifecycleManager::changeStateForNode(const std::string & node_name, std::uint8_t
     return false;
   }
 
+  return true;
+}
+
+bool
+LifecycleManager::changeStateForNode(const std::string & node_name, std::uint8_t transition)
+{
+  if (!transitionNode(node_name, transition)) {
+    return false;
+  }
+
   if (transition == Transition::TRANSITION_ACTIVATE) {
     return createBondConnection(node_name);
   } else if (transition == Transition::TRANSITION_DEACTIVATE) {
@@ -261,13 +354,96 @@ LifecycleManager::changeStateForNode(const std::string & node_name, std::uint8_t
   return true;
 }
 
+bool
+LifecycleManager::changeStateForGroup(
+  const std::vector<std::string> & group,
+  std::uint8_t transition,
+  bool hard_change)
+{
+  if (group.size() == 1) {
+    try {
+      return changeStateForNode(group.front(), transition) || hard_change;
+    } catch (const std::runtime_error & e) {
+      RCLCPP_ERROR(
+        get_logger(),
+        "Failed to change state for node: %s. Exception: %s.", group.front().c_str(), e.what());
+      return false;
+    }
+  }
+
+  // The nodes in a group are independent of one another, so their service
+  // calls can be in flight at the same time. Each lifecycle service client
+  // spins its own callback group, so the calls do not contend on an executor.
+  std::vector<std::future<bool>> results;
+  results.reserve(group.size());
+  for (auto & node_name : group) {
+    results.push_back(
+      std::async(
+        std::launch::async,
+        [this, &node_name, transition]() {
+          return transitionNode(node_name, transition);
+        }));
+  }
+
+  // Drain every future before acting on failures so no call is abandoned.
+  // Bonds are created and destroyed here rather than in the workers since
+  // the bond map is not protected for concurrent access.
+  bool failed = false;
+  bool threw = false;
+  for (size_t i = 0; i != group.size(); i++) {
+    bool transitioned = false;
+    try {
+      transitioned = results[i].get();
+    } catch (const std::runtime_error & e) {
+      RCLCPP_ERROR(
+        get_logger(),
+        "Failed to change state for node: %s. Exception: %s.", group[i].c_str(), e.what());
+      threw = true;
+      continue;
+    }
+
+    if (!transitioned) {
+      failed = true;
+    } else if (transition == Transition::TRANSITION_ACTIVATE) {
+      failed = !createBondConnection(group[i]) || failed;
+    } else if (transition == Transition::TRANSITION_DEACTIVATE) {
+      bond_map_.erase(group[i]);
+    }
+  }
+
+  if (threw) {
+    return false;
+  }
+  return !failed || hard_change;
+}
+
 bool
 LifecycleManager::changeStateForAllNodes(std::uint8_t transition, bool hard_change)
 {
   // Hard change will continue even if a node fails
-  if (transition == Transition::TRANSITION_CONFIGURE ||
-    transition == Transition::TRANSITION_ACTIVATE)
-  {
+  const bool forward_order = transition == Transition::TRANSITION_CONFIGURE ||
+    transition == Transition::TRANSITION_ACTIVATE;
+
+  // With declared dependencies, walk the dependency levels instead of the
+  // flat list, bring-up from the roots and tear-down from the leaves
+  if (!transition_groups_.empty()) {
+    if (forward_order) {
+      for (auto & group : transition_groups_) {
+        if (!changeStateForGroup(group, transition, hard_change)) {
+          return false;
+        }
+      }
+    } else {
+      for (auto rit = transition_groups_.rbegin(); rit != transition_groups_.rend(); ++rit) {
+        if (!changeStateForGroup(*rit, transition, hard_change)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  if (forward_order) {
     for (auto & node_name : node_names_) {
       try {
         if (!changeStateForNode(node_name, transition) && !hard_change) {
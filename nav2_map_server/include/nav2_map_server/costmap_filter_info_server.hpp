@@ -16,6 +16,7 @@
 #define NAV2_MAP_SERVER__COSTMAP_FILTER_INFO_SERVER_HPP_
 
 #include <memory>
+#include <string>
 
 #include "rclcpp/rclcpp.hpp"
 #include "rclcpp_lifecycle/state.hpp"
@@ -75,6 +76,10 @@ private:
   rclcpp_lifecycle::LifecyclePublisher<nav2_msgs::msg::CostmapFilterInfo>::SharedPtr publisher_;
 
   nav2_msgs::msg::CostmapFilterInfo msg_;
+
+  // Name of the shared-memory segment serving the mask, empty when the
+  // mask is delivered over the mask topic by a separate map server
+  std::string mask_shm_name_;
 };  // CostmapFilterInfoServer
 
 }  // namespace nav2_map_server
@@ -98,6 +98,20 @@ bool saveMapToFile(
   const nav_msgs::msg::OccupancyGrid & map,
   const SaveParameters & save_parameters);
 
+/**
+ * @brief Patch a previously saved PGM map in place, rewriting only the
+ * image rows whose cells changed since the previous snapshot. The caller
+ * must pass the same saving parameters that produced the previous save.
+ * @param map OccupancyGrid map data
+ * @param previous OccupancyGrid that was saved to the file before
+ * @param save_parameters Map saving parameters.
+ * @return true if the delta was applied; false if a full save is required
+ */
+bool saveMapDeltaToFile(
+  const nav_msgs::msg::OccupancyGrid & map,
+  const nav_msgs::msg::OccupancyGrid & previous,
+  const SaveParameters & save_parameters);
+
 /**
  * @brief Expand ~/ to home user dir.
  * @param yaml_filename Name of input YAML file.
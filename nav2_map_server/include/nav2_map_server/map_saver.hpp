@@ -16,8 +16,11 @@
 #ifndef NAV2_MAP_SERVER__MAP_SAVER_HPP_
 #define NAV2_MAP_SERVER__MAP_SAVER_HPP_
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "rclcpp/rclcpp.hpp"
 #include "rclcpp_lifecycle/state.hpp"
@@ -100,6 +103,18 @@ protected:
     const std::shared_ptr<nav2_msgs::srv::SaveMap::Request> request,
     std::shared_ptr<nav2_msgs::srv::SaveMap::Response> response);
 
+  /**
+   * @brief Background writer thread routine for the incremental save mode.
+   * Waits for a pending snapshot, patches the previously saved PGM in place
+   * when possible and falls back to a full save otherwise
+   */
+  void writerThread();
+
+  /**
+   * @brief Stops the background writer thread, if running
+   */
+  void stopWriterThread();
+
   // The timeout for saving the map in service
   std::shared_ptr<rclcpp::Duration> save_map_timeout_;
   // Default values for map thresholds
@@ -107,6 +122,24 @@ protected:
   double occupied_thresh_default_;
   // param for handling QoS configuration
   bool map_subscribe_transient_local_;
+  // Whether snapshots are handed off to the background writer thread
+  bool incremental_save_;
+
+  // Background writer thread and the double-buffered pending snapshot.
+  // Only the latest snapshot is kept if the writer falls behind.
+  std::thread writer_thread_;
+  std::mutex writer_mutex_;
+  std::condition_variable writer_cv_;
+  bool writer_shutdown_{false};
+  bool write_pending_{false};
+  nav_msgs::msg::OccupancyGrid::SharedPtr pending_map_;
+  SaveParameters pending_parameters_;
+
+  // The grid and parameters of the last successful save, used as the
+  // delta baseline. Accessed by the writer thread only.
+  nav_msgs::msg::OccupancyGrid last_saved_map_;
+  SaveParameters last_saved_parameters_;
+  bool last_saved_valid_{false};
 
   // The name of the service for saving a map from topic
   const std::string save_map_service_name_{"save_map"};
@@ -21,6 +21,7 @@
 #include "nav2_util/lifecycle_node.hpp"
 #include "nav_msgs/msg/occupancy_grid.hpp"
 #include "nav_msgs/srv/get_map.hpp"
+#include "nav2_msgs/srv/get_map_tile.hpp"
 #include "nav2_msgs/srv/load_map.hpp"
 #include "rclcpp/rclcpp.hpp"
 #include "rclcpp_lifecycle/state.hpp"
@@ -118,15 +119,33 @@ protected:
     const std::shared_ptr<nav2_msgs::srv::LoadMap::Request> request,
     std::shared_ptr<nav2_msgs::srv::LoadMap::Response> response);
 
+  /**
+   * @brief Map tile getting service callback. Copies only the requested
+   * region of the map, clamped to the map bounds, into the response
+   * @param request_header Service request header
+   * @param request Service request with the region in world coordinates
+   * @param response Service response with the tile OccupancyGrid
+   */
+  void getMapTileCallback(
+    const std::shared_ptr<rmw_request_id_t> request_header,
+    const std::shared_ptr<nav2_msgs::srv::GetMapTile::Request> request,
+    std::shared_ptr<nav2_msgs::srv::GetMapTile::Response> response);
+
   // The name of the service for getting a map
   const std::string service_name_{"map"};
 
+  // The name of the service for getting a map tile
+  const std::string map_tile_service_name_{"map_tile"};
+
   // The name of the service for loading a map
   const std::string load_map_service_name_{"load_map"};
 
   // A service to provide the occupancy grid (GetMap) and the message to return
   rclcpp::Service<nav_msgs::srv::GetMap>::SharedPtr occ_service_;
 
+  // A service to provide a region of the occupancy grid (GetMapTile)
+  rclcpp::Service<nav2_msgs::srv::GetMapTile>::SharedPtr map_tile_service_;
+
   // A service to load the occupancy grid from file at run time (LoadMap)
   rclcpp::Service<nav2_msgs::srv::LoadMap>::SharedPtr load_map_service_;
 
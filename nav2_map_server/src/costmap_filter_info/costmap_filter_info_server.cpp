@@ -19,8 +19,12 @@
 
 #include <string>
 #include <memory>
+#include <stdexcept>
 #include <utility>
 
+#include "nav2_map_server/map_io.hpp"
+#include "nav2_util/occ_grid_shm.hpp"
+
 namespace nav2_map_server
 {
 
@@ -32,6 +36,9 @@ CostmapFilterInfoServer::CostmapFilterInfoServer(const rclcpp::NodeOptions & opt
   declare_parameter("mask_topic", "filter_mask");
   declare_parameter("base", 0.0);
   declare_parameter("multiplier", 1.0);
+  declare_parameter("mask_yaml_filename", "");
+  declare_parameter("mask_frame_id", "map");
+  declare_parameter("mask_shm_name", "");
 }
 
 CostmapFilterInfoServer::~CostmapFilterInfoServer()
@@ -56,6 +63,38 @@ CostmapFilterInfoServer::on_configure(const rclcpp_lifecycle::State & /*state*/)
   msg_.base = static_cast<float>(get_parameter("base").as_double());
   msg_.multiplier = static_cast<float>(get_parameter("multiplier").as_double());
 
+  // When a mask filename is given, the mask is loaded here and served through
+  // a shared-memory segment every local consumer of the filter info maps,
+  // instead of each costmap holding a private copy received over mask_topic
+  const std::string mask_yaml_filename = get_parameter("mask_yaml_filename").as_string();
+  if (!mask_yaml_filename.empty()) {
+    nav_msgs::msg::OccupancyGrid mask;
+    if (loadMapFromYaml(mask_yaml_filename, mask) != LOAD_MAP_SUCCESS) {
+      RCLCPP_ERROR(
+        get_logger(), "Failed to load filter mask from %s file",
+        mask_yaml_filename.c_str());
+      return nav2_util::CallbackReturn::FAILURE;
+    }
+    mask.header.frame_id = get_parameter("mask_frame_id").as_string();
+    mask.header.stamp = now();
+
+    mask_shm_name_ = get_parameter("mask_shm_name").as_string();
+    if (mask_shm_name_.empty()) {
+      mask_shm_name_ = "/" + std::string(get_name()) + "_mask";
+    }
+    try {
+      nav2_util::writeOccGridShm(mask_shm_name_, mask);
+    } catch (const std::runtime_error & ex) {
+      RCLCPP_ERROR(get_logger(), "%s", ex.what());
+      mask_shm_name_.clear();
+      return nav2_util::CallbackReturn::FAILURE;
+    }
+    msg_.filter_mask_shm = mask_shm_name_;
+    RCLCPP_INFO(
+      get_logger(), "Serving filter mask %s through %s shared-memory segment",
+      mask_yaml_filename.c_str(), mask_shm_name_.c_str());
+  }
+
   return nav2_util::CallbackReturn::SUCCESS;
 }
 
@@ -93,6 +132,14 @@ CostmapFilterInfoServer::on_cleanup(const rclcpp_lifecycle::State & /*state*/)
   RCLCPP_INFO(get_logger(), "Cleaning up");
 
   publisher_.reset();
+  if (!mask_shm_name_.empty()) {
+    try {
+      nav2_util::removeOccGridShm(mask_shm_name_);
+    } catch (const std::runtime_error & ex) {
+      RCLCPP_WARN(get_logger(), "%s", ex.what());
+    }
+    mask_shm_name_.clear();
+  }
 
   return nav2_util::CallbackReturn::SUCCESS;
 }
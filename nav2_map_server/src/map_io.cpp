@@ -32,8 +32,16 @@
 #include "nav2_map_server/map_io.hpp"
 
 #ifndef _WIN32
+#include <fcntl.h>
 #include <libgen.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -195,27 +203,301 @@ LoadParameters loadMapYaml(const std::string & yaml_filename)
   return load_parameters;
 }
 
-void loadMapFromFile(
+/// Converts pixel brightness (on a scale from 0.0 to 1.0) into an occupancy grid cell.
+/// The Scale mode transparency check is left to the caller: an image without
+/// an alpha channel is always opaque.
+/// @throw std::runtime_error for an invalid map mode
+static int8_t shadeToCell(
   const LoadParameters & load_parameters,
-  nav_msgs::msg::OccupancyGrid & map)
+  const double shade)
 {
-  Magick::InitializeMagick(nullptr);
-  nav_msgs::msg::OccupancyGrid msg;
+  // If negate is true, we consider blacker pixels free, and whiter
+  // pixels occupied. Otherwise, it's vice versa.
+  /// on a scale from 0.0 to 1.0, how occupied is the map cell (before thresholding)?
+  const double occ = (load_parameters.negate ? shade : 1.0 - shade);
+
+  switch (load_parameters.mode) {
+    case MapMode::Trinary:
+      if (load_parameters.occupied_thresh < occ) {
+        return nav2_util::OCC_GRID_OCCUPIED;
+      } else if (occ < load_parameters.free_thresh) {
+        return nav2_util::OCC_GRID_FREE;
+      }
+      return nav2_util::OCC_GRID_UNKNOWN;
+    case MapMode::Scale:
+      if (load_parameters.occupied_thresh < occ) {
+        return nav2_util::OCC_GRID_OCCUPIED;
+      } else if (occ < load_parameters.free_thresh) {
+        return nav2_util::OCC_GRID_FREE;
+      }
+      return std::rint(
+        (occ - load_parameters.free_thresh) /
+        (load_parameters.occupied_thresh - load_parameters.free_thresh) * 100.0);
+    case MapMode::Raw: {
+        const double occ_percent = std::round(shade * 255);
+        if (nav2_util::OCC_GRID_FREE <= occ_percent &&
+          occ_percent <= nav2_util::OCC_GRID_OCCUPIED)
+        {
+          return static_cast<int8_t>(occ_percent);
+        }
+        return nav2_util::OCC_GRID_UNKNOWN;
+      }
+    default:
+      throw std::runtime_error("Invalid map mode");
+  }
+}
 
-  std::cout << "[INFO] [map_io]: Loading image_file: " <<
-    load_parameters.image_file_name << std::endl;
+/// Reads the next unsigned decimal value of a PGM header,
+/// skipping whitespace and '#' comments before it.
+/// @return True if a value was read
+static bool readPgmHeaderValue(
+  const unsigned char * data, const size_t size, size_t & pos, size_t & value)
+{
+  while (pos < size) {
+    if (data[pos] == '#') {
+      while (pos < size && data[pos] != '\n') {
+        pos++;
+      }
+    } else if (std::isspace(data[pos])) {
+      pos++;
+    } else {
+      break;
+    }
+  }
+  if (pos >= size || !std::isdigit(data[pos])) {
+    return false;
+  }
+  value = 0;
+  while (pos < size && std::isdigit(data[pos])) {
+    value = value * 10 + (data[pos] - '0');
+    pos++;
+  }
+  return true;
+}
+
+#ifndef _WIN32
+/// Streams a binary PGM image row-wise straight into the map message,
+/// avoiding the ImageMagick round-trip and its transient allocations.
+/// The file is mapped into memory, so rows are read directly from the page cache.
+/// @return False if the image is not a well-formed binary PGM:
+/// the caller should fall back to the generic ImageMagick loader
+static bool loadRawPgmMap(
+  const LoadParameters & load_parameters,
+  nav_msgs::msg::OccupancyGrid & msg)
+{
+  const int fd = open(load_parameters.image_file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) < 0 || file_stat.st_size < 2) {
+    close(fd);
+    return false;
+  }
+  const size_t size = file_stat.st_size;
+  const unsigned char * data = static_cast<const unsigned char *>(
+    mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0));
+  close(fd);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+
+  bool loaded = false;
+  size_t pos = 2;
+  size_t width, height, maxval;
+  if (data[0] == 'P' && data[1] == '5' &&
+    readPgmHeaderValue(data, size, pos, width) &&
+    readPgmHeaderValue(data, size, pos, height) &&
+    readPgmHeaderValue(data, size, pos, maxval) &&
+    pos < size && std::isspace(data[pos]) &&
+    width > 0 && height > 0 && maxval > 0 && maxval < 65536)
+  {
+    // A single whitespace character separates the header from the raster
+    pos++;
+    const size_t bytes_per_pixel = maxval < 256 ? 1 : 2;
+    if (size - pos >= width * height * bytes_per_pixel) {
+      msg.info.width = width;
+      msg.info.height = height;
+      msg.data.resize(width * height);
+
+      // Precompute the gray value -> cell lookup table for the 8-bit case
+      int8_t lut[256];
+      if (bytes_per_pixel == 1) {
+        for (size_t v = 0; v < 256; v++) {
+          lut[v] = shadeToCell(
+            load_parameters, static_cast<double>(std::min(v, maxval)) / maxval);
+        }
+      }
+
+      // Convert row-wise; the image is flipped on the Y axis in the message
+      for (size_t y = 0; y < height; y++) {
+        const unsigned char * row = data + pos + y * width * bytes_per_pixel;
+        int8_t * out = msg.data.data() + width * (height - y - 1);
+        if (bytes_per_pixel == 1) {
+          for (size_t x = 0; x < width; x++) {
+            out[x] = lut[row[x]];
+          }
+        } else {
+          for (size_t x = 0; x < width; x++) {
+            // 16-bit PGM values are stored most significant byte first
+            const size_t v = (static_cast<size_t>(row[2 * x]) << 8) | row[2 * x + 1];
+            out[x] = shadeToCell(
+              load_parameters, static_cast<double>(std::min(v, maxval)) / maxval);
+          }
+        }
+      }
+      loaded = true;
+    }
+  }
+
+  munmap(const_cast<unsigned char *>(data), size);
+  return loaded;
+}
+/// Header of the compiled occupancy grid cache written next to the map image
+struct MapCacheHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t width;
+  uint32_t height;
+  uint64_t hash;
+};
+
+static constexpr char MAP_CACHE_MAGIC[8] = {'N', 'A', 'V', '2', 'G', 'R', 'I', 'D'};
+static constexpr uint32_t MAP_CACHE_VERSION = 1;
+
+/// Computes an FNV-1a hash over the image file content and the thresholding
+/// parameters. The hash invalidates the compiled cache whenever the image
+/// or any parameter affecting the cell conversion changes.
+/// @return True if the image file could be read
+static bool hashImageAndParameters(const LoadParameters & load_parameters, uint64_t & hash)
+{
+  const int fd = open(load_parameters.image_file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) < 0 || file_stat.st_size == 0) {
+    close(fd);
+    return false;
+  }
+  const size_t size = file_stat.st_size;
+  const unsigned char * data = static_cast<const unsigned char *>(
+    mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0));
+  close(fd);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+
+  uint64_t h = 14695981039346656037ULL;
+  const auto mix = [&h](const void * bytes, const size_t n) {
+      const unsigned char * b = static_cast<const unsigned char *>(bytes);
+      for (size_t i = 0; i < n; i++) {
+        h = (h ^ b[i]) * 1099511628211ULL;
+      }
+    };
+  mix(data, size);
+  munmap(const_cast<unsigned char *>(data), size);
+
+  const unsigned char mode = static_cast<unsigned char>(load_parameters.mode);
+  const unsigned char negate = load_parameters.negate ? 1 : 0;
+  mix(&mode, sizeof(mode));
+  mix(&negate, sizeof(negate));
+  mix(&load_parameters.occupied_thresh, sizeof(load_parameters.occupied_thresh));
+  mix(&load_parameters.free_thresh, sizeof(load_parameters.free_thresh));
+
+  hash = h;
+  return true;
+}
+
+/// Loads the post-threshold grid from the compiled cache next to the image,
+/// if one exists and matches the given content hash
+/// @return True if the cache was valid and loaded
+static bool loadCachedMap(
+  const LoadParameters & load_parameters, const uint64_t hash,
+  nav_msgs::msg::OccupancyGrid & msg)
+{
+  const std::string cache_file_name = load_parameters.image_file_name + ".cache";
+  const int fd = open(cache_file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) < 0 ||
+    file_stat.st_size < static_cast<off_t>(sizeof(MapCacheHeader)))
+  {
+    close(fd);
+    return false;
+  }
+  const size_t size = file_stat.st_size;
+  const unsigned char * data = static_cast<const unsigned char *>(
+    mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0));
+  close(fd);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+
+  bool loaded = false;
+  const MapCacheHeader * header = reinterpret_cast<const MapCacheHeader *>(data);
+  if (memcmp(header->magic, MAP_CACHE_MAGIC, sizeof(MAP_CACHE_MAGIC)) == 0 &&
+    header->version == MAP_CACHE_VERSION &&
+    header->hash == hash &&
+    size == sizeof(MapCacheHeader) +
+    static_cast<size_t>(header->width) * header->height)
+  {
+    msg.info.width = header->width;
+    msg.info.height = header->height;
+    msg.data.resize(static_cast<size_t>(header->width) * header->height);
+    memcpy(msg.data.data(), data + sizeof(MapCacheHeader), msg.data.size());
+    loaded = true;
+  }
+
+  munmap(const_cast<unsigned char *>(data), size);
+  return loaded;
+}
+
+/// Writes the compiled cache next to the image, best-effort: the cache is
+/// written to a temporary file first and atomically renamed into place so
+/// that a concurrent or interrupted load never sees a torn cache
+static void saveCachedMap(
+  const LoadParameters & load_parameters, const uint64_t hash,
+  const nav_msgs::msg::OccupancyGrid & msg)
+{
+  const std::string cache_file_name = load_parameters.image_file_name + ".cache";
+  const std::string tmp_file_name = cache_file_name + ".tmp";
+
+  MapCacheHeader header;
+  memcpy(header.magic, MAP_CACHE_MAGIC, sizeof(MAP_CACHE_MAGIC));
+  header.version = MAP_CACHE_VERSION;
+  header.width = msg.info.width;
+  header.height = msg.info.height;
+  header.hash = hash;
+
+  std::ofstream cache_file(tmp_file_name, std::ios::binary);
+  cache_file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  cache_file.write(reinterpret_cast<const char *>(msg.data.data()), msg.data.size());
+  cache_file.close();
+  if (!cache_file || rename(tmp_file_name.c_str(), cache_file_name.c_str()) != 0) {
+    std::cout << "[WARN] [map_io]: Failed to write map cache: " <<
+      cache_file_name << std::endl;
+    remove(tmp_file_name.c_str());
+  }
+}
+#endif  // _WIN32
+
+/// Loads the image via ImageMagick and converts it pixel-by-pixel.
+/// Generic fallback supporting every format ImageMagick can decode.
+static void loadMagickMap(
+  const LoadParameters & load_parameters,
+  nav_msgs::msg::OccupancyGrid & msg)
+{
+  Magick::InitializeMagick(nullptr);
   Magick::Image img(load_parameters.image_file_name);
 
   // Copy the image data into the map structure
   msg.info.width = img.size().width();
   msg.info.height = img.size().height();
 
-  msg.info.resolution = load_parameters.resolution;
-  msg.info.origin.position.x = load_parameters.origin[0];
-  msg.info.origin.position.y = load_parameters.origin[1];
-  msg.info.origin.position.z = 0.0;
-  msg.info.origin.orientation = orientationAroundZAxis(load_parameters.origin[2]);
-
   // Allocate space to hold the data
   msg.data.resize(msg.info.width * msg.info.height);
 
@@ -238,52 +520,58 @@ void loadMapFromFile(
       /// on a scale from 0.0 to 1.0 how bright is the pixel?
       double shade = Magick::ColorGray::scaleQuantumToDouble(sum / channels.size());
 
-      // If negate is true, we consider blacker pixels free, and whiter
-      // pixels occupied. Otherwise, it's vice versa.
-      /// on a scale from 0.0 to 1.0, how occupied is the map cell (before thresholding)?
-      double occ = (load_parameters.negate ? shade : 1.0 - shade);
-
       int8_t map_cell;
-      switch (load_parameters.mode) {
-        case MapMode::Trinary:
-          if (load_parameters.occupied_thresh < occ) {
-            map_cell = nav2_util::OCC_GRID_OCCUPIED;
-          } else if (occ < load_parameters.free_thresh) {
-            map_cell = nav2_util::OCC_GRID_FREE;
-          } else {
-            map_cell = nav2_util::OCC_GRID_UNKNOWN;
-          }
-          break;
-        case MapMode::Scale:
-          if (pixel.alphaQuantum() != OpaqueOpacity) {
-            map_cell = nav2_util::OCC_GRID_UNKNOWN;
-          } else if (load_parameters.occupied_thresh < occ) {
-            map_cell = nav2_util::OCC_GRID_OCCUPIED;
-          } else if (occ < load_parameters.free_thresh) {
-            map_cell = nav2_util::OCC_GRID_FREE;
-          } else {
-            map_cell = std::rint(
-              (occ - load_parameters.free_thresh) /
-              (load_parameters.occupied_thresh - load_parameters.free_thresh) * 100.0);
-          }
-          break;
-        case MapMode::Raw: {
-            double occ_percent = std::round(shade * 255);
-            if (nav2_util::OCC_GRID_FREE <= occ_percent &&
-              occ_percent <= nav2_util::OCC_GRID_OCCUPIED)
-            {
-              map_cell = static_cast<int8_t>(occ_percent);
-            } else {
-              map_cell = nav2_util::OCC_GRID_UNKNOWN;
-            }
-            break;
-          }
-        default:
-          throw std::runtime_error("Invalid map mode");
+      if (load_parameters.mode == MapMode::Scale && pixel.alphaQuantum() != OpaqueOpacity) {
+        map_cell = nav2_util::OCC_GRID_UNKNOWN;
+      } else {
+        map_cell = shadeToCell(load_parameters, shade);
       }
       msg.data[msg.info.width * (msg.info.height - y - 1) + x] = map_cell;
     }
   }
+}
+
+void loadMapFromFile(
+  const LoadParameters & load_parameters,
+  nav_msgs::msg::OccupancyGrid & map)
+{
+  nav_msgs::msg::OccupancyGrid msg;
+
+  std::cout << "[INFO] [map_io]: Loading image_file: " <<
+    load_parameters.image_file_name << std::endl;
+
+  // The compiled cache holds the post-threshold grid of a previous load of
+  // this image, keyed by a hash of its content and the conversion parameters.
+  // Failing that, binary PGM images (the standard map_saver output) are
+  // streamed directly into the message; everything else goes through
+  // ImageMagick, and the result is cached for the next start-up.
+  bool loaded = false;
+#ifndef _WIN32
+  uint64_t cache_hash = 0;
+  bool from_cache = false;
+  const bool hashed = hashImageAndParameters(load_parameters, cache_hash);
+  if (hashed && loadCachedMap(load_parameters, cache_hash, msg)) {
+    loaded = true;
+    from_cache = true;
+  }
+  if (!loaded) {
+    loaded = loadRawPgmMap(load_parameters, msg);
+  }
+#endif
+  if (!loaded) {
+    loadMagickMap(load_parameters, msg);
+  }
+#ifndef _WIN32
+  if (hashed && !from_cache) {
+    saveCachedMap(load_parameters, cache_hash, msg);
+  }
+#endif
+
+  msg.info.resolution = load_parameters.resolution;
+  msg.info.origin.position.x = load_parameters.origin[0];
+  msg.info.origin.position.y = load_parameters.origin[1];
+  msg.info.origin.position.z = 0.0;
+  msg.info.origin.orientation = orientationAroundZAxis(load_parameters.origin[2]);
 
   // Since loadMapFromFile() does not belong to any node, publishing in a system time.
   rclcpp::Clock clock(RCL_SYSTEM_TIME);
@@ -557,6 +845,113 @@ void tryWriteMapToFile(
   std::cout << "[INFO] [map_io]: Map saved" << std::endl;
 }
 
+/**
+ * @brief Converts an occupancy cell into the 8-bit gray shade written to
+ * PGM images, matching the conversion of the full writer
+ * @param save_parameters Map saving parameters
+ * @param map_cell Occupancy grid cell value
+ * @throw std::runtime_error for a map mode requiring transparency
+ */
+static unsigned char cellToPgmShade(
+  const SaveParameters & save_parameters, const int8_t map_cell)
+{
+  switch (save_parameters.mode) {
+    case MapMode::Trinary:
+      if (map_cell < 0 || 100 < map_cell) {
+        return 205;
+      } else if (map_cell <= std::rint(save_parameters.free_thresh * 100.0)) {
+        return 254;
+      } else if (std::rint(save_parameters.occupied_thresh * 100.0) <= map_cell) {
+        return 0;
+      }
+      return 205;
+    case MapMode::Raw:
+      if (map_cell < 0 || 100 < map_cell) {
+        return 255;
+      }
+      return static_cast<unsigned char>(map_cell);
+    default:
+      throw std::runtime_error("Map mode does not map to a PGM shade");
+  }
+}
+
+bool saveMapDeltaToFile(
+  const nav_msgs::msg::OccupancyGrid & map,
+  const nav_msgs::msg::OccupancyGrid & previous,
+  const SaveParameters & save_parameters)
+{
+  // Only grayscale PGM images can be patched in place; the Scale mode
+  // needs transparency and is written as PNG
+  if (save_parameters.image_format != "pgm" ||
+    (save_parameters.mode != MapMode::Trinary && save_parameters.mode != MapMode::Raw))
+  {
+    return false;
+  }
+  if (map.info.width != previous.info.width ||
+    map.info.height != previous.info.height ||
+    map.info.resolution != previous.info.resolution ||
+    map.info.origin != previous.info.origin ||
+    map.data.size() != previous.data.size())
+  {
+    return false;
+  }
+
+  const std::string mapdatafile =
+    save_parameters.map_file_name + "." + save_parameters.image_format;
+  std::fstream image(mapdatafile, std::ios::in | std::ios::out | std::ios::binary);
+  if (!image) {
+    return false;
+  }
+
+  // Parse the existing PGM header to locate the raster and to check that
+  // the file on disk still matches the grid dimensions
+  char header_buf[256];
+  image.read(header_buf, sizeof(header_buf));
+  const size_t header_len = image.gcount();
+  image.clear();
+  const unsigned char * header = reinterpret_cast<const unsigned char *>(header_buf);
+  size_t pos = 2;
+  size_t width, height, maxval;
+  if (header_len < 2 || header[0] != 'P' || header[1] != '5' ||
+    !readPgmHeaderValue(header, header_len, pos, width) ||
+    !readPgmHeaderValue(header, header_len, pos, height) ||
+    !readPgmHeaderValue(header, header_len, pos, maxval) ||
+    pos >= header_len || !std::isspace(header[pos]) ||
+    width != map.info.width || height != map.info.height || maxval != 255)
+  {
+    return false;
+  }
+  pos++;  // single whitespace character separating the header from the raster
+
+  // Re-encode and overwrite only the image rows whose cells changed
+  std::vector<unsigned char> row(width);
+  size_t rows_written = 0;
+  for (size_t y = 0; y < height; y++) {
+    const size_t base = width * (height - y - 1);
+    if (std::equal(
+        map.data.begin() + base, map.data.begin() + base + width,
+        previous.data.begin() + base))
+    {
+      continue;
+    }
+    for (size_t x = 0; x < width; x++) {
+      row[x] = cellToPgmShade(save_parameters, map.data[base + x]);
+    }
+    image.seekp(pos + y * width);
+    image.write(reinterpret_cast<const char *>(row.data()), width);
+    rows_written++;
+  }
+  image.flush();
+  if (!image) {
+    return false;
+  }
+
+  std::cout <<
+    "[INFO] [map_io]: Updated " << rows_written << " of " << height << " rows in " <<
+    mapdatafile << std::endl;
+  return true;
+}
+
 bool saveMapToFile(
   const nav_msgs::msg::OccupancyGrid & map,
   const SaveParameters & save_parameters)
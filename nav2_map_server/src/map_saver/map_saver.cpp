@@ -51,10 +51,12 @@ MapSaver::MapSaver(const rclcpp::NodeOptions & options)
   declare_parameter("free_thresh_default", 0.25);
   declare_parameter("occupied_thresh_default", 0.65);
   declare_parameter("map_subscribe_transient_local", true);
+  declare_parameter("incremental_save", false);
 }
 
 MapSaver::~MapSaver()
 {
+  stopWriterThread();
 }
 
 nav2_util::CallbackReturn
@@ -70,6 +72,12 @@ MapSaver::on_configure(const rclcpp_lifecycle::State & /*state*/)
   free_thresh_default_ = get_parameter("free_thresh_default").as_double();
   occupied_thresh_default_ = get_parameter("occupied_thresh_default").as_double();
   map_subscribe_transient_local_ = get_parameter("map_subscribe_transient_local").as_bool();
+  incremental_save_ = get_parameter("incremental_save").as_bool();
+
+  if (incremental_save_) {
+    writer_shutdown_ = false;
+    writer_thread_ = std::thread(&MapSaver::writerThread, this);
+  }
 
   // Create a service that saves the occupancy grid from map topic to a file
   save_map_service_ = create_service<nav2_msgs::srv::SaveMap>(
@@ -107,6 +115,11 @@ MapSaver::on_cleanup(const rclcpp_lifecycle::State & /*state*/)
   RCLCPP_INFO(get_logger(), "Cleaning up");
 
   save_map_service_.reset();
+  stopWriterThread();
+  pending_map_.reset();
+  write_pending_ = false;
+  last_saved_map_ = nav_msgs::msg::OccupancyGrid();
+  last_saved_valid_ = false;
 
   return nav2_util::CallbackReturn::SUCCESS;
 }
@@ -217,6 +230,21 @@ bool MapSaver::saveMapTopicToFile(
     map_sub.reset();
     // Map message received. Saving it to file
     nav_msgs::msg::OccupancyGrid::SharedPtr map_msg = future_result.get();
+
+    // In incremental mode, hand the snapshot to the background writer and
+    // return immediately so periodic saves do not stall the caller.
+    // Failures of deferred writes are logged by the writer thread.
+    if (incremental_save_ && writer_thread_.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        pending_map_ = map_msg;
+        pending_parameters_ = save_parameters_loc;
+        write_pending_ = true;
+      }
+      writer_cv_.notify_one();
+      return true;
+    }
+
     if (saveMapToFile(*map_msg, save_parameters_loc)) {
       RCLCPP_INFO(get_logger(), "Map saved successfully");
       return true;
@@ -232,6 +260,68 @@ bool MapSaver::saveMapTopicToFile(
   return false;
 }
 
+void MapSaver::writerThread()
+{
+  while (true) {
+    nav_msgs::msg::OccupancyGrid::SharedPtr map;
+    SaveParameters parameters;
+    {
+      std::unique_lock<std::mutex> lock(writer_mutex_);
+      writer_cv_.wait(lock, [this]() {return write_pending_ || writer_shutdown_;});
+      if (!write_pending_) {
+        return;
+      }
+      map = std::move(pending_map_);
+      parameters = pending_parameters_;
+      write_pending_ = false;
+    }
+
+    // Match the defaulting of checkSaveParameters() so the delta baseline
+    // comparison below sees the format that will actually be written
+    if (parameters.image_format.empty() && parameters.mode != MapMode::Scale) {
+      parameters.image_format = "pgm";
+    }
+
+    // Patch the previous save in place when the target file and the
+    // conversion parameters did not change; fall back to a full save
+    bool saved = false;
+    if (last_saved_valid_ &&
+      parameters.map_file_name == last_saved_parameters_.map_file_name &&
+      parameters.image_format == last_saved_parameters_.image_format &&
+      parameters.mode == last_saved_parameters_.mode &&
+      parameters.free_thresh == last_saved_parameters_.free_thresh &&
+      parameters.occupied_thresh == last_saved_parameters_.occupied_thresh)
+    {
+      saved = saveMapDeltaToFile(*map, last_saved_map_, parameters);
+    }
+    if (!saved) {
+      saved = saveMapToFile(*map, parameters);
+    }
+
+    if (saved) {
+      last_saved_map_ = *map;
+      last_saved_parameters_ = parameters;
+      last_saved_valid_ = true;
+      RCLCPP_INFO(get_logger(), "Map saved successfully");
+    } else {
+      last_saved_valid_ = false;
+      RCLCPP_ERROR(get_logger(), "Failed to save the map");
+    }
+  }
+}
+
+void MapSaver::stopWriterThread()
+{
+  if (writer_thread_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(writer_mutex_);
+      writer_shutdown_ = true;
+    }
+    writer_cv_.notify_all();
+    writer_thread_.join();
+  }
+}
+
 }  // namespace nav2_map_server
 
 #include "rclcpp_components/register_node_macro.hpp"
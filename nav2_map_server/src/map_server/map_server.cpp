@@ -46,6 +46,8 @@
 
 #include "nav2_map_server/map_server.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <memory>
 #include <fstream>
@@ -117,6 +119,11 @@ MapServer::on_configure(const rclcpp_lifecycle::State & /*state*/)
     topic_name,
     rclcpp::QoS(rclcpp::KeepLast(1)).transient_local().reliable());
 
+  // Create a service that provides a region of the occupancy grid
+  map_tile_service_ = create_service<nav2_msgs::srv::GetMapTile>(
+    service_prefix + std::string(map_tile_service_name_),
+    std::bind(&MapServer::getMapTileCallback, this, _1, _2, _3));
+
   // Create a service that loads the occupancy grid from a file
   load_map_service_ = create_service<nav2_msgs::srv::LoadMap>(
     service_prefix + std::string(load_map_service_name_),
@@ -163,6 +170,7 @@ MapServer::on_cleanup(const rclcpp_lifecycle::State & /*state*/)
 
   occ_pub_.reset();
   occ_service_.reset();
+  map_tile_service_.reset();
   load_map_service_.reset();
   map_available_ = false;
   msg_ = nav_msgs::msg::OccupancyGrid();
@@ -193,6 +201,69 @@ void MapServer::getMapCallback(
   response->map = msg_;
 }
 
+void MapServer::getMapTileCallback(
+  const std::shared_ptr<rmw_request_id_t>/*request_header*/,
+  const std::shared_ptr<nav2_msgs::srv::GetMapTile::Request> request,
+  std::shared_ptr<nav2_msgs::srv::GetMapTile::Response> response)
+{
+  // if not in ACTIVE state, ignore request
+  if (get_current_state().id() != lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE) {
+    RCLCPP_WARN(
+      get_logger(),
+      "Received GetMapTile request but not in ACTIVE state, ignoring!");
+    response->success = false;
+    return;
+  }
+  if (!map_available_) {
+    RCLCPP_WARN(
+      get_logger(),
+      "Received GetMapTile request but no map is available, ignoring!");
+    response->success = false;
+    return;
+  }
+
+  // Convert the requested region from world coordinates to cell indices,
+  // clamped to the map bounds
+  const double resolution = msg_.info.resolution;
+  const double origin_x = msg_.info.origin.position.x;
+  const double origin_y = msg_.info.origin.position.y;
+  const int64_t min_x = std::max<int64_t>(
+    0, static_cast<int64_t>(std::floor((request->min_x - origin_x) / resolution)));
+  const int64_t min_y = std::max<int64_t>(
+    0, static_cast<int64_t>(std::floor((request->min_y - origin_y) / resolution)));
+  const int64_t max_x = std::min<int64_t>(
+    msg_.info.width, static_cast<int64_t>(std::ceil((request->max_x - origin_x) / resolution)));
+  const int64_t max_y = std::min<int64_t>(
+    msg_.info.height, static_cast<int64_t>(std::ceil((request->max_y - origin_y) / resolution)));
+
+  if (min_x >= max_x || min_y >= max_y) {
+    RCLCPP_WARN(
+      get_logger(),
+      "Received GetMapTile request with a region outside of the map, ignoring!");
+    response->success = false;
+    return;
+  }
+
+  nav_msgs::msg::OccupancyGrid & tile = response->tile;
+  tile.header = msg_.header;
+  tile.info = msg_.info;
+  tile.info.width = max_x - min_x;
+  tile.info.height = max_y - min_y;
+  // The tile origin is the lower-left corner of the clamped region
+  tile.info.origin.position.x = origin_x + min_x * resolution;
+  tile.info.origin.position.y = origin_y + min_y * resolution;
+
+  // Copy the region row-wise from the stored map
+  tile.data.resize(tile.info.width * tile.info.height);
+  for (int64_t y = min_y; y < max_y; y++) {
+    std::copy(
+      msg_.data.begin() + y * msg_.info.width + min_x,
+      msg_.data.begin() + y * msg_.info.width + max_x,
+      tile.data.begin() + (y - min_y) * tile.info.width);
+  }
+  response->success = true;
+}
+
 void MapServer::loadMapCallback(
   const std::shared_ptr<rmw_request_id_t>/*request_header*/,
   const std::shared_ptr<nav2_msgs::srv::LoadMap::Request> request,
@@ -0,0 +1,185 @@
+// Copyright (c) 2023 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include <geometry_msgs/msg/pose_stamped.hpp>
+#include <geometry_msgs/msg/twist.hpp>
+#include <nav_msgs/msg/path.hpp>
+
+#include <nav2_costmap_2d/cost_values.hpp>
+#include <nav2_costmap_2d/costmap_2d.hpp>
+#include <nav2_costmap_2d/costmap_2d_ros.hpp>
+#include <nav2_core/goal_checker.hpp>
+
+#include <xtensor/xarray.hpp>
+#include <xtensor/xio.hpp>
+#include <xtensor/xview.hpp>
+
+#include "nav2_mppi_controller/optimizer.hpp"
+#include "nav2_mppi_controller/motion_models.hpp"
+
+#include "nav2_mppi_controller/tools/parameters_handler.hpp"
+
+#include "utils.hpp"
+
+// Benchmarks Optimizer::evalControl() end-to-end and each critic in
+// isolation over an obstacle-laden costmap and path fixture, swept across
+// batch_size x time_steps combinations, reporting ns per control cycle.
+
+class RosLockGuard
+{
+public:
+  RosLockGuard() {rclcpp::init(0, nullptr);}
+  ~RosLockGuard() {rclcpp::shutdown();}
+};
+
+RosLockGuard g_rclcpp;
+
+void prepareAndRunBenchmark(
+  int batch_size, int time_steps, std::vector<std::string> critics,
+  benchmark::State & state)
+{
+  bool consider_footprint = true;
+  std::string motion_model = "DiffDrive";
+  unsigned int path_points = 50u;
+  int iteration_count = 2;
+  double lookahead_distance = 10.0;
+
+  TestCostmapSettings costmap_settings{};
+  auto costmap_ros = getDummyCostmapRos(costmap_settings);
+  auto costmap = costmap_ros->getCostmap();
+
+  TestPose start_pose = costmap_settings.getCenterPose();
+  double path_step = costmap_settings.resolution;
+
+  TestPathSettings path_settings{start_pose, path_points, path_step, path_step};
+  TestOptimizerSettings optimizer_settings{batch_size, time_steps, iteration_count,
+    lookahead_distance, motion_model, consider_footprint};
+
+  unsigned int offset = 4;
+  unsigned int obstacle_size = offset * 2;
+
+  unsigned char obstacle_cost = 250;
+
+  auto [obst_x, obst_y] = costmap_settings.getCenterIJ();
+
+  obst_x = obst_x - offset;
+  obst_y = obst_y - offset;
+  addObstacle(costmap, {obst_x, obst_y, obstacle_size, obstacle_cost});
+
+  printInfo(optimizer_settings, path_settings, critics);
+  auto node = getDummyNode(optimizer_settings, critics);
+  auto parameters_handler = std::make_unique<mppi::ParametersHandler>(node);
+  auto optimizer = getDummyOptimizer(node, costmap_ros, parameters_handler.get());
+
+  // evalControl args
+  auto pose = getDummyPointStamped(node, start_pose);
+  auto velocity = getDummyTwist();
+  auto path = getIncrementalDummyPath(node, path_settings);
+  nav2_core::GoalChecker * dummy_goal_checker{nullptr};
+
+  for (auto _ : state) {
+    optimizer->evalControl(pose, velocity, path, dummy_goal_checker);
+  }
+}
+
+static void BM_EvalControl(benchmark::State & state)
+{
+  std::vector<std::string> critics = {{"ConstraintCritic"}, {"CostCritic"}, {"GoalCritic"},
+    {"GoalAngleCritic"}, {"PathAlignCritic"}, {"PathFollowCritic"}, {"PathAngleCritic"},
+    {"PreferForwardCritic"}};
+
+  prepareAndRunBenchmark(state.range(0), state.range(1), critics, state);
+}
+
+static void BM_ConstraintCritic(benchmark::State & state)
+{
+  prepareAndRunBenchmark(state.range(0), state.range(1), {{"ConstraintCritic"}}, state);
+}
+
+static void BM_CostCritic(benchmark::State & state)
+{
+  prepareAndRunBenchmark(state.range(0), state.range(1), {{"CostCritic"}}, state);
+}
+
+static void BM_ObstaclesCritic(benchmark::State & state)
+{
+  prepareAndRunBenchmark(state.range(0), state.range(1), {{"ObstaclesCritic"}}, state);
+}
+
+static void BM_GoalCritic(benchmark::State & state)
+{
+  prepareAndRunBenchmark(state.range(0), state.range(1), {{"GoalCritic"}}, state);
+}
+
+static void BM_GoalAngleCritic(benchmark::State & state)
+{
+  prepareAndRunBenchmark(state.range(0), state.range(1), {{"GoalAngleCritic"}}, state);
+}
+
+static void BM_PathAlignCritic(benchmark::State & state)
+{
+  prepareAndRunBenchmark(state.range(0), state.range(1), {{"PathAlignCritic"}}, state);
+}
+
+static void BM_PathAngleCritic(benchmark::State & state)
+{
+  prepareAndRunBenchmark(state.range(0), state.range(1), {{"PathAngleCritic"}}, state);
+}
+
+static void BM_PathFollowCritic(benchmark::State & state)
+{
+  prepareAndRunBenchmark(state.range(0), state.range(1), {{"PathFollowCritic"}}, state);
+}
+
+static void BM_PreferForwardCritic(benchmark::State & state)
+{
+  prepareAndRunBenchmark(state.range(0), state.range(1), {{"PreferForwardCritic"}}, state);
+}
+
+static void BM_TwirlingCritic(benchmark::State & state)
+{
+  prepareAndRunBenchmark(state.range(0), state.range(1), {{"TwirlingCritic"}}, state);
+}
+
+static void BM_VelocityDeadbandCritic(benchmark::State & state)
+{
+  prepareAndRunBenchmark(state.range(0), state.range(1), {{"VelocityDeadbandCritic"}}, state);
+}
+
+// End-to-end cycle cost across representative sampling densities
+BENCHMARK(BM_EvalControl)
+->Args({300, 12})
+->Args({1000, 56})
+->Args({2000, 56})
+->Args({2000, 80});
+
+// Per-critic cost at the default and a high-density sampling configuration
+BENCHMARK(BM_ConstraintCritic)->Args({1000, 56})->Args({2000, 56});
+BENCHMARK(BM_CostCritic)->Args({1000, 56})->Args({2000, 56});
+BENCHMARK(BM_ObstaclesCritic)->Args({1000, 56})->Args({2000, 56});
+BENCHMARK(BM_GoalCritic)->Args({1000, 56})->Args({2000, 56});
+BENCHMARK(BM_GoalAngleCritic)->Args({1000, 56})->Args({2000, 56});
+BENCHMARK(BM_PathAlignCritic)->Args({1000, 56})->Args({2000, 56});
+BENCHMARK(BM_PathAngleCritic)->Args({1000, 56})->Args({2000, 56});
+BENCHMARK(BM_PathFollowCritic)->Args({1000, 56})->Args({2000, 56});
+BENCHMARK(BM_PreferForwardCritic)->Args({1000, 56})->Args({2000, 56});
+BENCHMARK(BM_TwirlingCritic)->Args({1000, 56})->Args({2000, 56});
+BENCHMARK(BM_VelocityDeadbandCritic)->Args({1000, 56})->Args({2000, 56});
+
+BENCHMARK_MAIN();
@@ -89,6 +89,43 @@ public:
     */
   virtual void score(CriticData & data) = 0;
 
+  /**
+    * @brief Whether this critic can be evaluated by the fused critic pass
+    * this cycle in place of score(), with the same activation gating. Critics
+    * that can express their cost as a sum of per-point terms may override
+    * this together with scorePoint() and finishTrajectory() so CriticManager
+    * can evaluate several critics in one sweep over each trajectory
+    * @param data Critic data to use in scoring
+    * @return true if scorePoint() may be used this cycle
+    */
+  virtual bool fusable(const CriticData & /*data*/) {return false;}
+
+  /**
+    * @brief Compute this critic's raw cost term for one trajectory point in
+    * the fused pass; terms are summed per trajectory by CriticManager
+    * @param data Critic data to use in scoring
+    * @param traj Trajectory (batch) index of the point
+    * @param step Time step index of the point
+    * @return Raw cost term of the point, prior to weighting
+    */
+  virtual float scorePoint(
+    const CriticData & /*data*/, unsigned int /*traj*/, unsigned int /*step*/)
+  {
+    return 0.0f;
+  }
+
+  /**
+    * @brief Turn a trajectory's accumulated per-point terms into its cost,
+    * applying the critic's weight and power
+    * @param data Critic data to use in scoring
+    * @param accumulated Sum of scorePoint() over the trajectory's points
+    * @return Cost to add to the trajectory's total
+    */
+  virtual float finishTrajectory(const CriticData & /*data*/, float accumulated)
+  {
+    return accumulated;
+  }
+
   /**
     * @brief Initialize critic
     */
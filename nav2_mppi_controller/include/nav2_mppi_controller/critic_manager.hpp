@@ -78,6 +78,14 @@ public:
   void evalTrajectoriesScores(CriticData & data) const;
 
 protected:
+  /**
+    * @brief Score trajectories by the fusable critics in a single sweep over
+    * each trajectory, keeping the trajectory's tensors cache-resident instead
+    * of re-touching the whole batch once per critic
+    * @param CriticData Struct of necessary information to pass to the critic functions
+    */
+  void evalFusedScores(CriticData & data) const;
+
   /**
     * @brief Get parameters (critics to load)
     */
@@ -102,6 +110,12 @@ protected:
   std::vector<std::string> critic_names_;
   std::unique_ptr<pluginlib::ClassLoader<critics::CriticFunction>> loader_;
   Critics critics_;
+  bool fuse_critics_{false};
+
+  /// Scratch reused each cycle by the fused pass, mutable since scoring
+  /// scratch is not an observable state change of the manager
+  mutable std::vector<critics::CriticFunction *> fused_critics_;
+  mutable std::vector<float> fused_accum_;
 
   rclcpp::Logger logger_{rclcpp::get_logger("MPPIController")};
 };
@@ -41,6 +41,22 @@ public:
    */
   void score(CriticData & data) override;
 
+  /**
+   * @brief Whether this critic can join the fused pass this cycle, caching
+   * the resolved motion model kind for the per-point kernel
+   */
+  bool fusable(const CriticData & data) override;
+
+  /**
+   * @brief Per-point velocity constraint violation term for the fused pass
+   */
+  float scorePoint(const CriticData & data, unsigned int traj, unsigned int step) override;
+
+  /**
+   * @brief Apply weight and power to a trajectory's accumulated violations
+   */
+  float finishTrajectory(const CriticData & data, float accumulated) override;
+
   float getMaxVelConstraint() {return max_vel_;}
   float getMinVelConstraint() {return min_vel_;}
 
@@ -49,6 +65,8 @@ protected:
   float weight_{0};
   float min_vel_;
   float max_vel_;
+  bool fused_omni_{false};
+  float fused_min_turning_rad_{-1.0f};
 };
 
 }  // namespace mppi::critics
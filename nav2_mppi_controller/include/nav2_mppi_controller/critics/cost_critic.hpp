@@ -15,8 +15,12 @@
 #ifndef NAV2_MPPI_CONTROLLER__CRITICS__COST_CRITIC_HPP_
 #define NAV2_MPPI_CONTROLLER__CRITICS__COST_CRITIC_HPP_
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "nav2_costmap_2d/footprint_collision_checker.hpp"
 #include "nav2_costmap_2d/inflation_layer.hpp"
@@ -56,16 +60,21 @@ protected:
     * @param theta theta of pose
     * @return bool if in collision
     */
-  inline bool inCollision(float cost, float x, float y, float theta)
+  inline bool inCollision(
+    float cost, float x, float y, float theta, unsigned int x_i, unsigned int y_i)
   {
     // If consider_footprint_ check footprint scort for collision
     float score_cost = cost;
     if (consider_footprint_ &&
       (cost >= possible_collision_cost_ || possible_collision_cost_ < 1.0f))
     {
-      score_cost = static_cast<float>(collision_checker_.footprintCostAtPose(
-          static_cast<double>(x), static_cast<double>(y), static_cast<double>(theta),
-          costmap_ros_->getRobotFootprint()));
+      if (footprint_heading_bins_ > 0) {
+        score_cost = footprintCostAtPoseBinned(x_i, y_i, theta);
+      } else {
+        score_cost = static_cast<float>(collision_checker_.footprintCostAtPose(
+            static_cast<double>(x), static_cast<double>(y), static_cast<double>(theta),
+            costmap_ros_->getRobotFootprint()));
+      }
     }
 
     switch (static_cast<unsigned char>(score_cost)) {
@@ -123,6 +132,45 @@ protected:
     return my * size_x_ + mx;
   }
 
+  /**
+    * @brief Rebuild the per-heading-bin footprint perimeter cell offset
+    * tables if the footprint or costmap resolution changed
+    */
+  void updateFootprintOffsets();
+
+  /**
+    * @brief Footprint cost using the precomputed offset table of the nearest
+    * heading bin, gathering costmap cells directly instead of rasterizing the
+    * footprint perimeter per pose
+    * @param x_i Map X coord of pose
+    * @param y_i Map Y coord of pose
+    * @param theta Heading of pose, need not be normalized
+    * @return Max footprint perimeter cost, lethal if any cell is off the map
+    */
+  inline float footprintCostAtPoseBinned(unsigned int x_i, unsigned int y_i, float theta)
+  {
+    const float bin_scale =
+      static_cast<float>(footprint_heading_bins_) / (2.0f * static_cast<float>(M_PI));
+    int bin = static_cast<int>(std::floor(theta * bin_scale)) % footprint_heading_bins_;
+    if (bin < 0) {
+      bin += footprint_heading_bins_;
+    }
+
+    float max_cost = 0.0f;
+    for (const auto & offset : footprint_offsets_[bin]) {
+      const int mx = static_cast<int>(x_i) + offset.first;
+      const int my = static_cast<int>(y_i) + offset.second;
+      if (mx < 0 || my < 0 ||
+        mx >= static_cast<int>(size_x_) || my >= static_cast<int>(size_y_))
+      {
+        return static_cast<float>(nav2_costmap_2d::LETHAL_OBSTACLE);
+      }
+      max_cost = std::max(
+        max_cost, static_cast<float>(costmap_view_(mx, my)));
+    }
+    return max_cost;
+  }
+
   nav2_costmap_2d::FootprintCollisionChecker<nav2_costmap_2d::Costmap2D *>
   collision_checker_{nullptr};
   float possible_collision_cost_;
@@ -139,9 +187,18 @@ protected:
   float origin_x_, origin_y_, resolution_;
   unsigned int size_x_, size_y_;
 
+  /// Whole-map view refreshed each score() call so the inner loops read
+  /// costs with pointer arithmetic rather than per-cell getCost() calls
+  nav2_costmap_2d::Costmap2D::RegionView costmap_view_;
+
   float near_goal_distance_;
   std::string inflation_layer_name_;
 
+  int footprint_heading_bins_{0};
+  std::vector<std::vector<std::pair<int, int>>> footprint_offsets_;
+  std::vector<geometry_msgs::msg::Point> footprint_offsets_footprint_;
+  float footprint_offsets_resolution_{0.0f};
+
   unsigned int power_{0};
 };
 
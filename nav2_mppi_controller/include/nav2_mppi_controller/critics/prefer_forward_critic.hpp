@@ -41,6 +41,21 @@ public:
    */
   void score(CriticData & data) override;
 
+  /**
+   * @brief Whether this critic can join the fused pass this cycle
+   */
+  bool fusable(const CriticData & data) override;
+
+  /**
+   * @brief Per-point reversing penalty term for the fused pass
+   */
+  float scorePoint(const CriticData & data, unsigned int traj, unsigned int step) override;
+
+  /**
+   * @brief Apply weight and power to a trajectory's accumulated penalty
+   */
+  float finishTrajectory(const CriticData & data, float accumulated) override;
+
 protected:
   unsigned int power_{0};
   float weight_{0};
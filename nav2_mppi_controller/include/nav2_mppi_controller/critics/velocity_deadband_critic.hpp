@@ -43,10 +43,27 @@ public:
    */
   void score(CriticData & data) override;
 
+  /**
+   * @brief Whether this critic can join the fused pass this cycle, caching
+   * whether the motion model is holonomic for the per-point kernel
+   */
+  bool fusable(const CriticData & data) override;
+
+  /**
+   * @brief Per-point deadband violation term for the fused pass
+   */
+  float scorePoint(const CriticData & data, unsigned int traj, unsigned int step) override;
+
+  /**
+   * @brief Apply weight and power to a trajectory's accumulated violations
+   */
+  float finishTrajectory(const CriticData & data, float accumulated) override;
+
 protected:
   unsigned int power_{0};
   float weight_{0};
   std::vector<float> deadband_velocities_{0.0f, 0.0f, 0.0f};
+  bool fused_holonomic_{false};
 };
 
 }  // namespace mppi::critics
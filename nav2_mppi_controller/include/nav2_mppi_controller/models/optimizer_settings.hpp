@@ -36,7 +36,9 @@ struct OptimizerSettings
   unsigned int batch_size{0u};
   unsigned int time_steps{0u};
   unsigned int iteration_count{0u};
+  unsigned int rollout_threads{1u};
   bool shift_control_sequence{false};
+  bool warm_start{false};
   size_t retry_attempt_limit{0};
 };
 
@@ -15,6 +15,7 @@
 #ifndef NAV2_MPPI_CONTROLLER__MOTION_MODELS_HPP_
 #define NAV2_MPPI_CONTROLLER__MOTION_MODELS_HPP_
 
+#include <cmath>
 #include <cstdint>
 #include <string>
 
@@ -69,7 +70,19 @@ public:
    * @brief With input velocities, find the vehicle's output velocities
    * @param state Contains control velocities to use to populate vehicle velocities
    */
-  virtual void predict(models::State & state)
+  void predict(models::State & state)
+  {
+    predict(state, 0, state.vx.shape(0));
+  }
+
+  /**
+   * @brief With input velocities, find the vehicle's output velocities for a
+   * contiguous shard of the batch, so shards can run on separate cores
+   * @param state Contains control velocities to use to populate vehicle velocities
+   * @param batch_begin First batch row of the shard
+   * @param batch_end One past the last batch row of the shard
+   */
+  virtual void predict(models::State & state, unsigned int batch_begin, unsigned int batch_end)
   {
     // Previously completed via tensor views, but found to be 10x slower
     // using namespace xt::placeholders;  // NOLINT
@@ -87,7 +100,7 @@ public:
     float min_delta_vx = model_dt_ * control_constraints_.ax_min;
     float max_delta_vy = model_dt_ * control_constraints_.ay_max;
     float max_delta_wz = model_dt_ * control_constraints_.az_max;
-    for (unsigned int i = 0; i != state.vx.shape(0); i++) {
+    for (unsigned int i = batch_begin; i != batch_end; i++) {
       float vx_last = state.vx(i, 0);
       float vy_last = state.vy(i, 0);
       float wz_last = state.wz(i, 0);
@@ -164,8 +177,14 @@ public:
     auto & vx = control_sequence.vx;
     auto & wz = control_sequence.wz;
 
-    auto view = xt::masked_view(wz, xt::fabs(vx) / xt::fabs(wz) < min_turning_r_);
-    view = xt::sign(wz) * vx / min_turning_r_;
+    // Single pass over the sequence; the equivalent masked_view expression
+    // materializes the ratio and mask arrays as temporaries
+    for (unsigned int i = 0; i != vx.shape(0); i++) {
+      const float wz_curr = wz(i);
+      if (std::fabs(vx(i)) < std::fabs(wz_curr) * min_turning_r_) {
+        wz(i) = (wz_curr < 0.0f ? -vx(i) : vx(i)) / min_turning_r_;
+      }
+    }
   }
 
   /**
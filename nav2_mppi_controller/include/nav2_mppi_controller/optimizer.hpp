@@ -43,9 +43,11 @@
 #include "nav2_mppi_controller/models/state.hpp"
 #include "nav2_mppi_controller/models/trajectories.hpp"
 #include "nav2_mppi_controller/models/path.hpp"
+#include "nav2_mppi_controller/tools/cycle_diagnostics.hpp"
 #include "nav2_mppi_controller/tools/noise_generator.hpp"
 #include "nav2_mppi_controller/tools/parameters_handler.hpp"
 #include "nav2_mppi_controller/tools/utils.hpp"
+#include "nav2_mppi_controller/tools/worker_pool.hpp"
 
 namespace mppi
 {
@@ -119,8 +121,11 @@ public:
 
   /**
    * @brief Reset the optimization problem to initial conditions
+   * @param warm_start Whether to retain the previous converged control
+   * sequence, time-shifted to the present, instead of zeroing it. Only
+   * honored when the warm_start parameter is enabled.
    */
-  void reset();
+  void reset(bool warm_start = false);
 
 protected:
   /**
@@ -237,6 +242,13 @@ protected:
    */
   bool fallback(bool fail);
 
+  /**
+   * @brief Re-project the previous converged control sequence onto the new
+   * horizon on goal change, shifting out the controls consumed since the
+   * last cycle and holding the final retained control in the tail
+   */
+  void warmStartControlSequence();
+
 protected:
   rclcpp_lifecycle::LifecycleNode::WeakPtr parent_;
   std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros_;
@@ -248,6 +260,11 @@ protected:
   ParametersHandler * parameters_handler_;
   CriticManager critic_manager_;
   NoiseGenerator noise_generator_;
+  /// Shards the batch dimension of the rollouts across cores, mutable since
+  /// dispatching work is not an observable state change of the optimizer
+  mutable WorkerPool worker_pool_;
+  /// Per-stage cycle timing instrumentation, no-op unless enabled
+  CycleDiagnostics cycle_diag_;
 
   models::OptimizerSettings settings_;
 
@@ -257,12 +274,18 @@ protected:
   models::Trajectories generated_trajectories_;
   models::Path path_;
   xt::xtensor<float, 1> costs_;
+  /// Scratch softmax weights for updateControlSequence(), kept allocated
+  xt::xtensor<float, 1> softmax_weights_;
 
   CriticData critics_data_ =
   {state_, generated_trajectories_, path_, costs_, settings_.model_dt, false, nullptr, nullptr,
     std::nullopt, std::nullopt};  /// Caution, keep references
 
   rclcpp::Logger logger_{rclcpp::get_logger("MPPIController")};
+  rclcpp::Clock::SharedPtr clock_;
+  /// Stamp of the last evaluated control, used to time-shift the retained
+  /// sequence when warm starting across goal changes
+  rclcpp::Time last_eval_stamp_;
 };
 
 }  // namespace mppi
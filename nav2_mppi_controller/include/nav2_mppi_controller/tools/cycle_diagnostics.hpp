@@ -0,0 +1,153 @@
+// Copyright (c) 2023 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_MPPI_CONTROLLER__TOOLS__CYCLE_DIAGNOSTICS_HPP_
+#define NAV2_MPPI_CONTROLLER__TOOLS__CYCLE_DIAGNOSTICS_HPP_
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp_lifecycle/lifecycle_node.hpp"
+#include "diagnostic_msgs/msg/diagnostic_status.hpp"
+#include "std_srvs/srv/trigger.hpp"
+
+#include "nav2_mppi_controller/tools/parameters_handler.hpp"
+
+namespace mppi
+{
+
+/**
+ * @class mppi::CycleDiagnostics
+ * @brief Per-stage timing instrumentation of the optimizer's control cycle.
+ * Stage durations accumulate into ring buffers over a window of cycles,
+ * summaries are published as a diagnostic topic each cycle, and the full
+ * window can be dumped on demand through a trigger service. Disabled by
+ * default, in which case recording is a no-op.
+ */
+class CycleDiagnostics
+{
+public:
+  /// Stages of the optimizer cycle tracked individually
+  enum Stage
+  {
+    PREPARE = 0,       /**< State, path tensor and critic data setup */
+    NOISE,             /**< Applying sampled noises to the control sequence */
+    VELOCITIES,        /**< Motion model velocity propagation */
+    INTEGRATION,       /**< Integrating velocities into trajectories */
+    CRITICS,           /**< Critic scoring of the trajectories */
+    UPDATE_CONTROL,    /**< Softmax update of the control sequence */
+    TOTAL,             /**< Full evalControl cycle */
+    STAGE_COUNT
+  };
+
+  /**
+    * @brief Constructor for mppi::CycleDiagnostics
+    */
+  CycleDiagnostics() = default;
+
+  /**
+   * @brief Initialize diagnostics, creating the topic and dump service when
+   * the cycle_diagnostics parameter is enabled
+   * @param parent WeakPtr to node
+   * @param name Namespace for topics and configs
+   * @param param_handler Get parameters util
+   */
+  void initialize(
+    rclcpp_lifecycle::LifecycleNode::WeakPtr parent, const std::string & name,
+    ParametersHandler * param_handler);
+
+  /**
+   * @brief Whether instrumentation is enabled
+   */
+  bool enabled() const {return enabled_;}
+
+  /**
+   * @brief Accumulate a stage duration into the current cycle
+   * @param stage Stage the duration belongs to
+   * @param ms Elapsed wall-clock milliseconds
+   */
+  void record(Stage stage, float ms);
+
+  /**
+   * @brief Commit the current cycle's stage durations to the ring buffers
+   * and publish the window summary
+   */
+  void endCycle();
+
+protected:
+  /**
+   * @brief Format the full sample window for the dump service
+   * @return Per-stage summary plus all windowed samples, oldest first
+   */
+  std::string dump();
+
+  /**
+   * @brief Display name of a stage
+   */
+  static const char * stageName(unsigned int stage);
+
+  /// Cycles of history kept per stage
+  static constexpr unsigned int kWindow = 100u;
+
+  bool enabled_{false};
+  std::string name_;
+
+  std::mutex mutex_;
+  std::array<float, STAGE_COUNT> current_{};
+  std::array<std::array<float, kWindow>, STAGE_COUNT> samples_{};
+  unsigned int next_{0};
+  unsigned int filled_{0};
+
+  rclcpp_lifecycle::LifecyclePublisher<diagnostic_msgs::msg::DiagnosticStatus>::SharedPtr
+    publisher_;
+  rclcpp::Service<std_srvs::srv::Trigger>::SharedPtr dump_service_;
+};
+
+/**
+ * @class mppi::StageTimer
+ * @brief Scoped wall-clock timer accumulating its lifetime into a
+ * cycle diagnostics stage, free when diagnostics are disabled
+ */
+class StageTimer
+{
+public:
+  StageTimer(CycleDiagnostics & diag, CycleDiagnostics::Stage stage)
+  : diag_(diag), stage_(stage)
+  {
+    if (diag_.enabled()) {
+      start_ = std::chrono::steady_clock::now();
+    }
+  }
+
+  ~StageTimer()
+  {
+    if (diag_.enabled()) {
+      const auto elapsed = std::chrono::steady_clock::now() - start_;
+      diag_.record(stage_, std::chrono::duration<float, std::milli>(elapsed).count());
+    }
+  }
+
+private:
+  CycleDiagnostics & diag_;
+  CycleDiagnostics::Stage stage_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace mppi
+
+#endif  // NAV2_MPPI_CONTROLLER__TOOLS__CYCLE_DIAGNOSTICS_HPP_
@@ -20,6 +20,7 @@
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <vector>
 
 // xtensor creates warnings that needs to be ignored as we are building with -Werror
 #pragma GCC diagnostic push
@@ -31,6 +32,7 @@
 
 #include "nav2_mppi_controller/models/optimizer_settings.hpp"
 #include "nav2_mppi_controller/tools/parameters_handler.hpp"
+#include "nav2_mppi_controller/tools/worker_pool.hpp"
 #include "nav2_mppi_controller/models/control_sequence.hpp"
 #include "nav2_mppi_controller/models/state.hpp"
 
@@ -55,10 +57,12 @@ public:
    * @param is_holonomic If base is holonomic
    * @param name Namespace for configs
    * @param param_handler Get parameters util
+   * @param worker_pool Pool to shard the noise application across, if any
    */
   void initialize(
     mppi::models::OptimizerSettings & settings,
-    bool is_holonomic, const std::string & name, ParametersHandler * param_handler);
+    bool is_holonomic, const std::string & name, ParametersHandler * param_handler,
+    WorkerPool * worker_pool = nullptr);
 
   /**
    * @brief Shutdown noise generator thread
@@ -99,12 +103,27 @@ protected:
    */
   void generateNoisedControls();
 
+  /**
+   * @brief Fill the noise table ring with fresh unit-normal samples, used when
+   * noise_table_ring_size is set so per-cycle generation can scale precomputed
+   * samples by the current standard deviations instead of drawing new ones
+   */
+  void generateNoiseTable();
+
   xt::xtensor<float, 2> noises_vx_;
   xt::xtensor<float, 2> noises_vy_;
   xt::xtensor<float, 2> noises_wz_;
 
+  std::vector<xt::xtensor<float, 2>> noise_table_vx_;
+  std::vector<xt::xtensor<float, 2>> noise_table_vy_;
+  std::vector<xt::xtensor<float, 2>> noise_table_wz_;
+  int noise_table_size_{0};
+  unsigned int noise_table_idx_{0};
+  unsigned int noise_table_refresh_count_{0};
+
   mppi::models::OptimizerSettings settings_;
   bool is_holonomic_;
+  WorkerPool * worker_pool_{nullptr};
 
   std::thread noise_thread_;
   std::condition_variable noise_cond_;
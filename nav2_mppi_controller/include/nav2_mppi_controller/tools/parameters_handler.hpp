@@ -15,7 +15,9 @@
 #ifndef NAV2_MPPI_CONTROLLER__TOOLS__PARAMETERS_HANDLER_HPP_
 #define NAV2_MPPI_CONTROLLER__TOOLS__PARAMETERS_HANDLER_HPP_
 
+#include <atomic>
 #include <functional>
+#include <mutex>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -68,13 +70,23 @@ public:
   void start();
 
   /**
-    * @brief Dynamic parameter callback
+    * @brief Dynamic parameter callback. Only queues the changes; they take
+    * effect on the next applyPendingParameters() call so that settings are
+    * never written while a control cycle is reading them
     * @param parameter Parameter changes to process
     * @return Set Parameter Result
     */
   rcl_interfaces::msg::SetParametersResult dynamicParamsCallback(
     std::vector<rclcpp::Parameter> parameters);
 
+  /**
+    * @brief Apply parameter changes queued by dynamicParamsCallback.
+    * Meant to be called from the control thread at the start of each cycle:
+    * when nothing is pending this is a single atomic load, so the hot loop
+    * neither takes a lock nor can be stalled by a concurrent change
+    */
+  void applyPendingParameters();
+
   /**
     * @brief Get an object to retreive parameters
     * @param ns Namespace to get parameters within
@@ -152,6 +164,12 @@ protected:
   static auto as(const rclcpp::Parameter & parameter);
 
   std::mutex parameters_change_mutex_;
+  // Changes queued by dynamicParamsCallback, guarded by the mutex; the
+  // epochs let applyPendingParameters() skip the mutex when empty. The
+  // applied epoch is only touched by the thread calling apply
+  std::vector<rclcpp::Parameter> pending_parameters_;
+  std::atomic<uint64_t> pending_epoch_{0};
+  uint64_t applied_epoch_{0};
   rclcpp::Logger logger_{rclcpp::get_logger("MPPIController")};
   rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr
     on_set_param_handler_;
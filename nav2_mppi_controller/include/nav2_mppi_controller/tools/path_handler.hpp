@@ -148,6 +148,10 @@ protected:
   nav_msgs::msg::Path global_plan_up_to_inversion_;
   rclcpp::Logger logger_{rclcpp::get_logger("MPPIController")};
 
+  /// Monotonic index of the closest pose reached on global_plan_up_to_inversion_,
+  /// persisted between cycles so searches resume where the robot left off
+  /// instead of erasing passed poses and rescanning from the front
+  size_t progress_idx_{0};
   double max_robot_pose_search_dist_{0};
   double prune_distance_{0};
   double transform_tolerance_{0};
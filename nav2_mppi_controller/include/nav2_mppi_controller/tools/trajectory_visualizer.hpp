@@ -99,12 +99,24 @@ public:
   void reset();
 
 protected:
+  /**
+    * @brief Get the next marker slot from the persistent pool, with header,
+    * namespace, id, type and action populated. Slots are reused across
+    * cycles so steady-state visualization does not allocate markers.
+    * @param marker_namespace Namespace of the marker
+    * @return Marker to fill in pose, scale and color
+    */
+  visualization_msgs::msg::Marker & nextMarker(const std::string & marker_namespace);
+
   std::string frame_id_;
   std::shared_ptr<rclcpp_lifecycle::LifecyclePublisher<visualization_msgs::msg::MarkerArray>>
   trajectories_publisher_;
   std::shared_ptr<rclcpp_lifecycle::LifecyclePublisher<nav_msgs::msg::Path>> transformed_path_pub_;
 
-  std::unique_ptr<visualization_msgs::msg::MarkerArray> points_;
+  // Marker pool, reused across cycles; only the first markers_used_ entries
+  // belong to the current cycle
+  visualization_msgs::msg::MarkerArray points_;
+  size_t markers_used_ = 0;
   int marker_id_ = 0;
 
   ParametersHandler * parameters_handler_;
@@ -0,0 +1,186 @@
+// Copyright (c) 2023 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_MPPI_CONTROLLER__TOOLS__WORKER_POOL_HPP_
+#define NAV2_MPPI_CONTROLLER__TOOLS__WORKER_POOL_HPP_
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mppi
+{
+
+/**
+ * @class mppi::WorkerPool
+ * @brief Persistent pool of worker threads sharding batched work across cores.
+ * Work is split into contiguous shards of the batch dimension, one per thread;
+ * the calling thread processes the first shard itself, so a pool sized to one
+ * thread degenerates to a plain function call with no synchronization.
+ */
+class WorkerPool
+{
+public:
+  /**
+    * @brief Constructor for mppi::WorkerPool
+    */
+  WorkerPool() = default;
+
+  /**
+    * @brief Destructor for mppi::WorkerPool, stops the workers
+    */
+  ~WorkerPool()
+  {
+    shutdown();
+  }
+
+  /**
+    * @brief Set the number of threads sharding the work, respawning the workers
+    * @param thread_count Threads to use, including the calling thread
+    */
+  void setThreadCount(unsigned int thread_count)
+  {
+    thread_count = std::max(1u, thread_count);
+    if (thread_count == thread_count_) {
+      return;
+    }
+
+    shutdown();
+    thread_count_ = thread_count;
+    active_ = true;
+    for (unsigned int i = 1; i < thread_count_; i++) {
+      // hand the worker the current cycle so respawned workers do not
+      // mistake a past task for a fresh one
+      workers_.push_back(std::thread(std::bind(&WorkerPool::workerThread, this, i, cycle_)));
+    }
+  }
+
+  /**
+    * @brief Get the number of threads sharding the work
+    * @return Thread count, including the calling thread
+    */
+  unsigned int getThreadCount() const
+  {
+    return thread_count_;
+  }
+
+  /**
+    * @brief Stop and join the worker threads
+    */
+  void shutdown()
+  {
+    {
+      std::unique_lock<std::mutex> guard(mutex_);
+      active_ = false;
+    }
+    start_cond_.notify_all();
+    for (auto & worker : workers_) {
+      if (worker.joinable()) {
+        worker.join();
+      }
+    }
+    workers_.clear();
+    thread_count_ = 1;
+  }
+
+  /**
+    * @brief Run a function over [0, total), sharded across the pool's threads,
+    * returning once every shard has completed
+    * @param total Size of the batch dimension to shard
+    * @param fn Function called per shard with its [begin, end) range
+    */
+  void forEachShard(unsigned int total, const std::function<void(unsigned int,
+    unsigned int)> & fn)
+  {
+    if (thread_count_ <= 1 || total < 2 * thread_count_) {
+      fn(0, total);
+      return;
+    }
+
+    {
+      std::unique_lock<std::mutex> guard(mutex_);
+      task_ = &fn;
+      total_ = total;
+      pending_ = thread_count_ - 1;
+      cycle_++;
+    }
+    start_cond_.notify_all();
+
+    runShard(0);
+
+    std::unique_lock<std::mutex> guard(mutex_);
+    done_cond_.wait(guard, [this]() {return pending_ == 0;});
+    task_ = nullptr;
+  }
+
+protected:
+  /**
+    * @brief Run one thread's shard of the current task
+    * @param shard_id Which thread's shard to run
+    */
+  void runShard(unsigned int shard_id)
+  {
+    const unsigned int shard_size = (total_ + thread_count_ - 1) / thread_count_;
+    const unsigned int begin = shard_id * shard_size;
+    const unsigned int end = std::min(total_, begin + shard_size);
+    if (begin < end) {
+      (*task_)(begin, end);
+    }
+  }
+
+  /**
+    * @brief Worker thread body, waiting for tasks until shutdown
+    * @param shard_id Which shard of each task this worker runs
+    * @param last_cycle The task cycle current when the worker was spawned
+    */
+  void workerThread(unsigned int shard_id, unsigned int last_cycle)
+  {
+    while (true) {
+      {
+        std::unique_lock<std::mutex> guard(mutex_);
+        start_cond_.wait(guard, [&]() {return !active_ || cycle_ != last_cycle;});
+        if (!active_) {
+          return;
+        }
+        last_cycle = cycle_;
+      }
+
+      runShard(shard_id);
+
+      {
+        std::unique_lock<std::mutex> guard(mutex_);
+        pending_--;
+      }
+      done_cond_.notify_one();
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable start_cond_, done_cond_;
+
+  const std::function<void(unsigned int, unsigned int)> * task_{nullptr};
+  unsigned int thread_count_{1};
+  unsigned int total_{0};
+  unsigned int pending_{0};
+  unsigned int cycle_{0};
+  bool active_{false};
+};
+
+}  // namespace mppi
+
+#endif  // NAV2_MPPI_CONTROLLER__TOOLS__WORKER_POOL_HPP_
@@ -71,7 +71,8 @@ void MPPIController::deactivate()
 
 void MPPIController::reset()
 {
-  optimizer_.reset();
+  // New goals may warm start from the previous sequence when enabled
+  optimizer_.reset(true);
 }
 
 geometry_msgs::msg::TwistStamped MPPIController::computeVelocityCommands(
@@ -83,7 +84,9 @@ geometry_msgs::msg::TwistStamped MPPIController::computeVelocityCommands(
   auto start = std::chrono::system_clock::now();
 #endif
 
-  std::lock_guard<std::mutex> param_lock(*parameters_handler_->getLock());
+  // Fold in any queued parameter changes at the cycle boundary; when none
+  // are pending this is a single atomic load, not a lock
+  parameters_handler_->applyPendingParameters();
   nav_msgs::msg::Path transformed_plan = path_handler_.transformPath(robot_pose);
 
   nav2_costmap_2d::Costmap2D * costmap = costmap_ros_->getCostmap();
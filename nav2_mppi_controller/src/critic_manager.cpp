@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+
 #include "nav2_mppi_controller/critic_manager.hpp"
 
 namespace mppi
@@ -37,6 +39,7 @@ void CriticManager::getParams()
   auto node = parent_.lock();
   auto getParam = parameters_handler_->getParamGetter(name_);
   getParam(critic_names_, "critics", std::vector<std::string>{}, ParameterType::Static);
+  getParam(fuse_critics_, "fuse_critics", false, ParameterType::Static);
 }
 
 void CriticManager::loadCritics()
@@ -67,12 +70,56 @@ std::string CriticManager::getFullName(const std::string & name)
 void CriticManager::evalTrajectoriesScores(
   CriticData & data) const
 {
+  fused_critics_.clear();
+  if (fuse_critics_) {
+    for (const auto & critic : critics_) {
+      if (critic->fusable(data)) {
+        fused_critics_.push_back(critic.get());
+      }
+    }
+  }
+
+  // A lone fusable critic is better served by its own vectorized score()
+  if (fused_critics_.size() > 1u) {
+    evalFusedScores(data);
+  } else {
+    fused_critics_.clear();
+  }
+
   for (const auto & critic : critics_) {
     if (data.fail_flag) {
       break;
     }
+    if (std::find(
+        fused_critics_.begin(), fused_critics_.end(), critic.get()) != fused_critics_.end())
+    {
+      continue;
+    }
     critic->score(data);
   }
 }
 
+void CriticManager::evalFusedScores(CriticData & data) const
+{
+  const unsigned int batch = data.state.vx.shape(0);
+  const unsigned int steps = data.state.vx.shape(1);
+  const unsigned int critic_count = fused_critics_.size();
+  fused_accum_.resize(critic_count);
+
+  for (unsigned int traj = 0; traj != batch; traj++) {
+    std::fill(fused_accum_.begin(), fused_accum_.end(), 0.0f);
+    for (unsigned int step = 0; step != steps; step++) {
+      for (unsigned int k = 0; k != critic_count; k++) {
+        fused_accum_[k] += fused_critics_[k]->scorePoint(data, traj, step);
+      }
+    }
+
+    float cost = 0.0f;
+    for (unsigned int k = 0; k != critic_count; k++) {
+      cost += fused_critics_[k]->finishTrajectory(data, fused_accum_[k]);
+    }
+    data.costs(traj) += cost;
+  }
+}
+
 }  // namespace mppi
@@ -113,6 +113,41 @@ void ConstraintCritic::score(CriticData & data)
   }
 }
 
+bool ConstraintCritic::fusable(const CriticData & data)
+{
+  if (!enabled_) {
+    return false;
+  }
+
+  // Resolve the motion model kind once per cycle rather than per point
+  fused_omni_ = dynamic_cast<OmniMotionModel *>(data.motion_model.get()) != nullptr;
+  auto acker = dynamic_cast<AckermannMotionModel *>(data.motion_model.get());
+  fused_min_turning_rad_ = acker != nullptr ? acker->getMinTurningRadius() : -1.0f;
+  return fused_omni_ || acker != nullptr ||
+         dynamic_cast<DiffDriveMotionModel *>(data.motion_model.get()) != nullptr;
+}
+
+float ConstraintCritic::scorePoint(const CriticData & data, unsigned int traj, unsigned int step)
+{
+  float vel = data.state.vx(traj, step);
+  float term = 0.0f;
+  if (fused_omni_) {
+    const float sgn = vel > 0.0f ? 1.0f : -1.0f;
+    vel = sgn * hypotf(vel, data.state.vy(traj, step));
+  } else if (fused_min_turning_rad_ >= 0.0f) {
+    term += std::max(
+      fused_min_turning_rad_ - (fabsf(vel) / fabsf(data.state.wz(traj, step))), 0.0f);
+  }
+  term += std::max(vel - max_vel_, 0.0f) + std::max(min_vel_ - vel, 0.0f);
+  return term * data.model_dt;
+}
+
+float ConstraintCritic::finishTrajectory(const CriticData & /*data*/, float accumulated)
+{
+  const float cost = accumulated * weight_;
+  return power_ > 1u ? powf(cost, power_) : cost;
+}
+
 }  // namespace mppi::critics
 
 #include <pluginlib/class_list_macros.hpp>
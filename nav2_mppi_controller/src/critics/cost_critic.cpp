@@ -30,6 +30,7 @@ void CostCritic::initialize()
   getParam(near_goal_distance_, "near_goal_distance", 0.5f);
   getParam(inflation_layer_name_, "inflation_layer_name", std::string(""));
   getParam(trajectory_point_step_, "trajectory_point_step", 2);
+  getParam(footprint_heading_bins_, "footprint_heading_bins", 0);
 
   // Normalized by cost value to put in same regime as other weights
   weight_ /= 254.0f;
@@ -94,6 +95,70 @@ float CostCritic::findCircumscribedCost(
   return circumscribed_cost_;
 }
 
+void CostCritic::updateFootprintOffsets()
+{
+  const auto footprint = costmap_ros_->getRobotFootprint();
+  if (!footprint_offsets_.empty() && footprint == footprint_offsets_footprint_ &&
+    resolution_ == footprint_offsets_resolution_)
+  {
+    return;
+  }
+  footprint_offsets_footprint_ = footprint;
+  footprint_offsets_resolution_ = resolution_;
+  footprint_offsets_.assign(footprint_heading_bins_, {});
+
+  const float bin_width = 2.0f * static_cast<float>(M_PI) /
+    static_cast<float>(footprint_heading_bins_);
+  for (int bin = 0; bin != footprint_heading_bins_; bin++) {
+    // Rasterize the footprint perimeter at the bin's center heading into
+    // cell offsets relative to the pose's cell
+    const float angle = (static_cast<float>(bin) + 0.5f) * bin_width;
+    const float cos_a = cosf(angle);
+    const float sin_a = sinf(angle);
+
+    auto & offsets = footprint_offsets_[bin];
+    for (size_t p = 0; p != footprint.size(); p++) {
+      const auto & pt0 = footprint[p];
+      const auto & pt1 = footprint[(p + 1) % footprint.size()];
+      const float x0f = (cos_a * pt0.x - sin_a * pt0.y) / resolution_;
+      const float y0f = (sin_a * pt0.x + cos_a * pt0.y) / resolution_;
+      const float x1f = (cos_a * pt1.x - sin_a * pt1.y) / resolution_;
+      const float y1f = (sin_a * pt1.x + cos_a * pt1.y) / resolution_;
+
+      // Bresenham walk between consecutive rotated vertices
+      int x0 = static_cast<int>(std::floor(x0f));
+      int y0 = static_cast<int>(std::floor(y0f));
+      const int x1 = static_cast<int>(std::floor(x1f));
+      const int y1 = static_cast<int>(std::floor(y1f));
+      const int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+      const int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+      int error = dx + dy;
+      while (true) {
+        offsets.push_back({x0, y0});
+        if (x0 == x1 && y0 == y1) {
+          break;
+        }
+        const int e2 = 2 * error;
+        if (e2 >= dy) {
+          error += dy;
+          x0 += sx;
+        }
+        if (e2 <= dx) {
+          error += dx;
+          y0 += sy;
+        }
+      }
+    }
+
+    // Row-major order so gathers walk the costmap with cache locality
+    std::sort(
+      offsets.begin(), offsets.end(), [](const auto & a, const auto & b) {
+        return a.second != b.second ? a.second < b.second : a.first < b.first;
+      });
+    offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+  }
+}
+
 void CostCritic::score(CriticData & data)
 {
   using xt::evaluation_strategy::immediate;
@@ -110,10 +175,14 @@ void CostCritic::score(CriticData & data)
   resolution_ = static_cast<float>(costmap->getResolution());
   size_x_ = costmap->getSizeInCellsX();
   size_y_ = costmap->getSizeInCellsY();
+  costmap_view_ = costmap->getRegionView();
 
   if (consider_footprint_) {
     // footprint may have changed since initialization if user has dynamic footprints
     possible_collision_cost_ = findCircumscribedCost(costmap_ros_);
+    if (footprint_heading_bins_ > 0) {
+      updateFootprintOffsets();
+    }
   }
 
   // If near the goal, don't apply the preferential term since the goal is near obstacles
@@ -155,11 +224,11 @@ void CostCritic::score(CriticData & data)
         }
         pose_cost = 255.0f;  // NO_INFORMATION in float
       } else {
-        pose_cost = static_cast<float>(costmap->getCost(getIndex(x_i, y_i)));
+        pose_cost = static_cast<float>(costmap_view_(x_i, y_i));
         if (pose_cost < 1.0f) {
           continue;  // In free space
         }
-        if (inCollision(pose_cost, Tx, Ty, traj_yaw(i, j))) {
+        if (inCollision(pose_cost, Tx, Ty, traj_yaw(i, j), x_i, y_i)) {
           traj_cost = collision_cost_;
           trajectory_collide = true;
           break;
@@ -93,6 +93,27 @@ void PathAlignCritic::score(CriticData & data)
   final_pose.y = data.path.y(path_segments_count - 1);
   final_pose.theta = data.path.yaws(path_segments_count - 1);
 
+  // Uniform arc-length index over the path: bucket b stores the last path
+  // point at or before distance b * lut_step, so each lookup scans within a
+  // bucket instead of walking the path per trajectory
+  const float total_dist = path_integrated_distances.back();
+  std::vector<unsigned int> dist_lut;
+  float lut_step = 0.0f;
+  if (total_dist > 0.0f) {
+    dist_lut.resize(2u * path_segments_count);
+    lut_step = total_dist / static_cast<float>(dist_lut.size());
+    unsigned int pt = 0u;
+    for (size_t b = 0; b != dist_lut.size(); b++) {
+      const float bucket_start = static_cast<float>(b) * lut_step;
+      while (pt + 1u < path_segments_count &&
+        path_integrated_distances[pt + 1u] <= bucket_start)
+      {
+        pt++;
+      }
+      dist_lut[b] = pt;
+    }
+  }
+
   float summed_path_dist = 0.0f, dyaw = 0.0f;
   unsigned int num_samples = 0u;
   unsigned int path_pt = 0u;
@@ -125,6 +146,12 @@ void PathAlignCritic::score(CriticData & data)
       Tx_m1 = Tx;
       Ty_m1 = Ty;
       traj_integrated_distance += sqrtf(dx * dx + dy * dy);
+      if (lut_step > 0.0f) {
+        const unsigned int bucket = std::min(
+          static_cast<unsigned int>(traj_integrated_distance / lut_step),
+          static_cast<unsigned int>(dist_lut.size() - 1u));
+        path_pt = dist_lut[bucket];
+      }
       path_pt = utils::findClosestPathPt(
         path_integrated_distances, traj_integrated_distance, path_pt);
 
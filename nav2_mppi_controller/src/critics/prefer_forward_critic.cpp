@@ -50,6 +50,24 @@ void PreferForwardCritic::score(CriticData & data)
   }
 }
 
+bool PreferForwardCritic::fusable(const CriticData & data)
+{
+  return enabled_ &&
+         !utils::withinPositionGoalTolerance(
+    threshold_to_consider_, data.state.pose.pose, data.path);
+}
+
+float PreferForwardCritic::scorePoint(const CriticData & data, unsigned int traj, unsigned int step)
+{
+  return std::max(-data.state.vx(traj, step), 0.0f) * data.model_dt;
+}
+
+float PreferForwardCritic::finishTrajectory(const CriticData & /*data*/, float accumulated)
+{
+  const float cost = accumulated * weight_;
+  return power_ > 1u ? powf(cost, power_) : cost;
+}
+
 }  // namespace mppi::critics
 
 #include <pluginlib/class_list_macros.hpp>
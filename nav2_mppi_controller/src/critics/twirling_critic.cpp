@@ -44,6 +44,23 @@ void TwirlingCritic::score(CriticData & data)
   }
 }
 
+bool TwirlingCritic::fusable(const CriticData & data)
+{
+  return enabled_ &&
+         !utils::withinPositionGoalTolerance(data.goal_checker, data.state.pose.pose, data.path);
+}
+
+float TwirlingCritic::scorePoint(const CriticData & data, unsigned int traj, unsigned int step)
+{
+  return fabsf(data.state.wz(traj, step));
+}
+
+float TwirlingCritic::finishTrajectory(const CriticData & data, float accumulated)
+{
+  const float cost = accumulated / static_cast<float>(data.state.wz.shape(1)) * weight_;
+  return power_ > 1u ? powf(cost, power_) : cost;
+}
+
 }  // namespace mppi::critics
 
 #include <pluginlib/class_list_macros.hpp>
@@ -97,6 +97,33 @@ void VelocityDeadbandCritic::score(CriticData & data)
   return;
 }
 
+bool VelocityDeadbandCritic::fusable(const CriticData & data)
+{
+  if (!enabled_) {
+    return false;
+  }
+  fused_holonomic_ = data.motion_model->isHolonomic();
+  return true;
+}
+
+float VelocityDeadbandCritic::scorePoint(
+  const CriticData & data, unsigned int traj, unsigned int step)
+{
+  float term =
+    std::max(fabsf(deadband_velocities_[0]) - fabsf(data.state.vx(traj, step)), 0.0f) +
+    std::max(fabsf(deadband_velocities_[2]) - fabsf(data.state.wz(traj, step)), 0.0f);
+  if (fused_holonomic_) {
+    term += std::max(fabsf(deadband_velocities_[1]) - fabsf(data.state.vy(traj, step)), 0.0f);
+  }
+  return term * data.model_dt;
+}
+
+float VelocityDeadbandCritic::finishTrajectory(const CriticData & /*data*/, float accumulated)
+{
+  const float cost = accumulated * weight_;
+  return power_ > 1u ? powf(cost, power_) : cost;
+}
+
 }  // namespace mppi::critics
 
 #include <pluginlib/class_list_macros.hpp>
@@ -0,0 +1,134 @@
+// Copyright (c) 2023 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_mppi_controller/tools/cycle_diagnostics.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+
+namespace mppi
+{
+
+void CycleDiagnostics::initialize(
+  rclcpp_lifecycle::LifecycleNode::WeakPtr parent, const std::string & name,
+  ParametersHandler * param_handler)
+{
+  name_ = name;
+
+  auto getParam = param_handler->getParamGetter(name);
+  getParam(enabled_, "cycle_diagnostics", false, ParameterType::Static);
+  if (!enabled_) {
+    return;
+  }
+
+  auto node = parent.lock();
+  publisher_ = node->create_publisher<diagnostic_msgs::msg::DiagnosticStatus>(
+    name + "/cycle_diagnostics", 1);
+  publisher_->on_activate();
+  dump_service_ = node->create_service<std_srvs::srv::Trigger>(
+    name + "/dump_cycle_diagnostics",
+    [this](
+      const std::shared_ptr<std_srvs::srv::Trigger::Request>/*request*/,
+      std::shared_ptr<std_srvs::srv::Trigger::Response> response) {
+      response->success = true;
+      response->message = dump();
+    });
+}
+
+void CycleDiagnostics::record(Stage stage, float ms)
+{
+  std::unique_lock<std::mutex> guard(mutex_);
+  current_[stage] += ms;
+}
+
+void CycleDiagnostics::endCycle()
+{
+  if (!enabled_) {
+    return;
+  }
+
+  diagnostic_msgs::msg::DiagnosticStatus status;
+  status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+  status.name = name_ + " cycle times";
+  status.message = "Optimizer per-stage wall-clock times (ms), last/mean/max over " +
+    std::to_string(kWindow) + " cycles";
+
+  {
+    std::unique_lock<std::mutex> guard(mutex_);
+    for (unsigned int stage = 0; stage != STAGE_COUNT; stage++) {
+      samples_[stage][next_] = current_[stage];
+    }
+    next_ = (next_ + 1u) % kWindow;
+    filled_ = std::min(filled_ + 1u, kWindow);
+    current_.fill(0.0f);
+
+    for (unsigned int stage = 0; stage != STAGE_COUNT; stage++) {
+      float mean = 0.0f, max = 0.0f;
+      for (unsigned int i = 0; i != filled_; i++) {
+        mean += samples_[stage][i];
+        max = std::max(max, samples_[stage][i]);
+      }
+      mean /= static_cast<float>(filled_);
+      const float last =
+        samples_[stage][(next_ + kWindow - 1u) % kWindow];
+
+      char value[64];
+      snprintf(value, sizeof(value), "%.3f / %.3f / %.3f", last, mean, max);
+      diagnostic_msgs::msg::KeyValue kv;
+      kv.key = stageName(stage);
+      kv.value = value;
+      status.values.push_back(kv);
+    }
+  }
+
+  publisher_->publish(status);
+}
+
+std::string CycleDiagnostics::dump()
+{
+  std::unique_lock<std::mutex> guard(mutex_);
+  std::stringstream out;
+  out << "Optimizer per-stage wall-clock times (ms), oldest cycle first, "
+      << filled_ << " cycles recorded" << std::endl;
+
+  char value[32];
+  for (unsigned int stage = 0; stage != STAGE_COUNT; stage++) {
+    out << stageName(stage) << ":";
+    // Ring order: the oldest sample sits at next_ once the window wrapped
+    const unsigned int begin = filled_ == kWindow ? next_ : 0u;
+    for (unsigned int i = 0; i != filled_; i++) {
+      snprintf(value, sizeof(value), " %.3f", samples_[stage][(begin + i) % kWindow]);
+      out << value;
+    }
+    out << std::endl;
+  }
+  return out.str();
+}
+
+const char * CycleDiagnostics::stageName(unsigned int stage)
+{
+  switch (stage) {
+    case PREPARE: return "prepare";
+    case NOISE: return "noise";
+    case VELOCITIES: return "velocities";
+    case INTEGRATION: return "integration";
+    case CRITICS: return "critics";
+    case UPDATE_CONTROL: return "update_control";
+    case TOTAL: return "total";
+  }
+  return "unknown";
+}
+
+}  // namespace mppi
@@ -25,14 +25,21 @@ namespace mppi
 
 void NoiseGenerator::initialize(
   mppi::models::OptimizerSettings & settings, bool is_holonomic,
-  const std::string & name, ParametersHandler * param_handler)
+  const std::string & name, ParametersHandler * param_handler,
+  WorkerPool * worker_pool)
 {
   settings_ = settings;
   is_holonomic_ = is_holonomic;
+  worker_pool_ = worker_pool;
   active_ = true;
 
   auto getParam = param_handler->getParamGetter(name);
   getParam(regenerate_noises_, "regenerate_noises", false);
+  getParam(noise_table_size_, "noise_table_ring_size", 0);
+
+  if (noise_table_size_ > 0) {
+    generateNoiseTable();
+  }
 
   if (regenerate_noises_) {
     noise_thread_ = std::thread(std::bind(&NoiseGenerator::noiseThread, this));
@@ -68,6 +75,20 @@ void NoiseGenerator::setNoisedControls(
 {
   std::unique_lock<std::mutex> guard(noise_lock_);
 
+  if (worker_pool_ && worker_pool_->getThreadCount() > 1) {
+    worker_pool_->forEachShard(
+      settings_.batch_size, [&](unsigned int begin, unsigned int end) {
+        const auto rows = xt::range(begin, end);
+        xt::noalias(xt::view(state.cvx, rows, xt::all())) =
+        control_sequence.vx + xt::view(noises_vx_, rows, xt::all());
+        xt::noalias(xt::view(state.cvy, rows, xt::all())) =
+        control_sequence.vy + xt::view(noises_vy_, rows, xt::all());
+        xt::noalias(xt::view(state.cwz, rows, xt::all())) =
+        control_sequence.wz + xt::view(noises_wz_, rows, xt::all());
+      });
+    return;
+  }
+
   xt::noalias(state.cvx) = control_sequence.vx + noises_vx_;
   xt::noalias(state.cvy) = control_sequence.vy + noises_vy_;
   xt::noalias(state.cwz) = control_sequence.wz + noises_wz_;
@@ -81,6 +102,9 @@ void NoiseGenerator::reset(mppi::models::OptimizerSettings & settings, bool is_h
   // Recompute the noises on reset, initialization, and fallback
   {
     std::unique_lock<std::mutex> guard(noise_lock_);
+    if (noise_table_size_ > 0) {
+      generateNoiseTable();
+    }
     xt::noalias(noises_vx_) = xt::zeros<float>({settings_.batch_size, settings_.time_steps});
     xt::noalias(noises_vy_) = xt::zeros<float>({settings_.batch_size, settings_.time_steps});
     xt::noalias(noises_wz_) = xt::zeros<float>({settings_.batch_size, settings_.time_steps});
@@ -108,6 +132,40 @@ void NoiseGenerator::generateNoisedControls()
 {
   auto & s = settings_;
 
+  if (noise_table_size_ > 0) {
+    const unsigned int size = static_cast<unsigned int>(noise_table_size_);
+
+    // Consume the next precomputed unit-normal slot, rescaled by the current
+    // standard deviations so dynamically reconfigured stds still apply
+    xt::noalias(noises_vx_) = s.sampling_std.vx * noise_table_vx_[noise_table_idx_];
+    xt::noalias(noises_wz_) = s.sampling_std.wz * noise_table_wz_[noise_table_idx_];
+    if (is_holonomic_) {
+      xt::noalias(noises_vy_) = s.sampling_std.vy * noise_table_vy_[noise_table_idx_];
+    }
+    noise_table_idx_ = (noise_table_idx_ + 1) % size;
+
+    // Drip fresh samples back in, one axis of one slot per cycle, so the ring
+    // slowly turns over without paying the full per-cycle sampling cost
+    const unsigned int axes = is_holonomic_ ? 3u : 2u;
+    const unsigned int slot = (noise_table_refresh_count_ / axes) % size;
+    switch (noise_table_refresh_count_ % axes) {
+      case 0u:
+        xt::noalias(noise_table_vx_[slot]) = xt::random::randn<float>(
+          {s.batch_size, s.time_steps}, 0.0f, 1.0f);
+        break;
+      case 1u:
+        xt::noalias(noise_table_wz_[slot]) = xt::random::randn<float>(
+          {s.batch_size, s.time_steps}, 0.0f, 1.0f);
+        break;
+      default:
+        xt::noalias(noise_table_vy_[slot]) = xt::random::randn<float>(
+          {s.batch_size, s.time_steps}, 0.0f, 1.0f);
+        break;
+    }
+    noise_table_refresh_count_++;
+    return;
+  }
+
   xt::noalias(noises_vx_) = xt::random::randn<float>(
     {s.batch_size, s.time_steps}, 0.0f,
     s.sampling_std.vx);
@@ -121,4 +179,22 @@ void NoiseGenerator::generateNoisedControls()
   }
 }
 
+void NoiseGenerator::generateNoiseTable()
+{
+  auto & s = settings_;
+  const unsigned int size = static_cast<unsigned int>(noise_table_size_);
+
+  noise_table_vx_.resize(size);
+  noise_table_vy_.resize(size);
+  noise_table_wz_.resize(size);
+  for (unsigned int i = 0; i != size; i++) {
+    noise_table_vx_[i] = xt::random::randn<float>({s.batch_size, s.time_steps}, 0.0f, 1.0f);
+    noise_table_wz_[i] = xt::random::randn<float>({s.batch_size, s.time_steps}, 0.0f, 1.0f);
+    noise_table_vy_[i] = xt::random::randn<float>({s.batch_size, s.time_steps}, 0.0f, 1.0f);
+  }
+
+  noise_table_idx_ = 0;
+  noise_table_refresh_count_ = 0;
+}
+
 }  // namespace mppi
@@ -46,11 +46,15 @@ void Optimizer::initialize(
 
   auto node = parent_.lock();
   logger_ = node->get_logger();
+  clock_ = node->get_clock();
+  last_eval_stamp_ = clock_->now();
 
   getParams();
 
   critic_manager_.on_configure(parent_, name_, costmap_ros_, parameters_handler_);
-  noise_generator_.initialize(settings_, isHolonomic(), name_, parameters_handler_);
+  noise_generator_.initialize(
+    settings_, isHolonomic(), name_, parameters_handler_, &worker_pool_);
+  cycle_diag_.initialize(parent_, name_, parameters_handler_);
 
   reset();
 }
@@ -71,6 +75,7 @@ void Optimizer::getParams()
   getParam(s.time_steps, "time_steps", 56);
   getParam(s.batch_size, "batch_size", 1000);
   getParam(s.iteration_count, "iteration_count", 1);
+  getParam(s.rollout_threads, "rollout_threads", 1);
   getParam(s.temperature, "temperature", 0.3f);
   getParam(s.gamma, "gamma", 0.015f);
   getParam(s.base_constraints.vx_max, "vx_max", 0.5f);
@@ -85,6 +90,7 @@ void Optimizer::getParams()
   getParam(s.sampling_std.vy, "vy_std", 0.2f);
   getParam(s.sampling_std.wz, "wz_std", 0.4f);
   getParam(s.retry_attempt_limit, "retry_attempt_limit", 1);
+  getParam(s.warm_start, "warm_start", false);
 
   s.base_constraints.ax_max = std::abs(s.base_constraints.ax_max);
   if (s.base_constraints.ax_min > 0.0) {
@@ -126,24 +132,73 @@ void Optimizer::setOffset(double controller_frequency)
   }
 }
 
-void Optimizer::reset()
+void Optimizer::reset(bool warm_start)
 {
   state_.reset(settings_.batch_size, settings_.time_steps);
-  control_sequence_.reset(settings_.time_steps);
-  control_history_[0] = {0.0f, 0.0f, 0.0f};
-  control_history_[1] = {0.0f, 0.0f, 0.0f};
-  control_history_[2] = {0.0f, 0.0f, 0.0f};
-  control_history_[3] = {0.0f, 0.0f, 0.0f};
+  if (warm_start && settings_.warm_start &&
+    control_sequence_.vx.shape(0) == settings_.time_steps)
+  {
+    warmStartControlSequence();
+  } else {
+    control_sequence_.reset(settings_.time_steps);
+    control_history_[0] = {0.0f, 0.0f, 0.0f};
+    control_history_[1] = {0.0f, 0.0f, 0.0f};
+    control_history_[2] = {0.0f, 0.0f, 0.0f};
+    control_history_[3] = {0.0f, 0.0f, 0.0f};
+  }
 
   settings_.constraints = settings_.base_constraints;
 
   costs_ = xt::zeros<float>({settings_.batch_size});
+  softmax_weights_ = xt::zeros<float>({settings_.batch_size});
   generated_trajectories_.reset(settings_.batch_size, settings_.time_steps);
 
   noise_generator_.reset(settings_, isHolonomic());
+  worker_pool_.setThreadCount(settings_.rollout_threads);
   RCLCPP_INFO(logger_, "Optimizer reset");
 }
 
+void Optimizer::warmStartControlSequence()
+{
+  // Re-project the previously converged sequence onto the new horizon by
+  // dropping the controls consumed while replanning was underway, keeping
+  // single-cycle convergence on replan-heavy missions
+  const double elapsed = (clock_->now() - last_eval_stamp_).seconds();
+  const double horizon = static_cast<double>(settings_.time_steps) * settings_.model_dt;
+  if (elapsed < 0.0 || elapsed >= horizon) {
+    // Nothing of the previous sequence overlaps the new horizon
+    control_sequence_.reset(settings_.time_steps);
+    control_history_[0] = {0.0f, 0.0f, 0.0f};
+    control_history_[1] = {0.0f, 0.0f, 0.0f};
+    control_history_[2] = {0.0f, 0.0f, 0.0f};
+    control_history_[3] = {0.0f, 0.0f, 0.0f};
+    return;
+  }
+
+  const unsigned int shift = static_cast<unsigned int>(elapsed / settings_.model_dt);
+  if (shift == 0u) {
+    return;
+  }
+
+  using namespace xt::placeholders;  // NOLINT
+  const unsigned int last_kept = settings_.time_steps - shift - 1u;
+  const int tail = static_cast<int>(shift);
+
+  const float vx_fill = control_sequence_.vx(last_kept);
+  control_sequence_.vx = xt::roll(control_sequence_.vx, -tail);
+  xt::view(control_sequence_.vx, xt::range(-tail, _)) = vx_fill;
+
+  const float wz_fill = control_sequence_.wz(last_kept);
+  control_sequence_.wz = xt::roll(control_sequence_.wz, -tail);
+  xt::view(control_sequence_.wz, xt::range(-tail, _)) = wz_fill;
+
+  if (isHolonomic()) {
+    const float vy_fill = control_sequence_.vy(last_kept);
+    control_sequence_.vy = xt::roll(control_sequence_.vy, -tail);
+    xt::view(control_sequence_.vy, xt::range(-tail, _)) = vy_fill;
+  }
+}
+
 bool Optimizer::isHolonomic() const
 {
   return motion_model_->isHolonomic();
@@ -154,18 +209,27 @@ geometry_msgs::msg::TwistStamped Optimizer::evalControl(
   const geometry_msgs::msg::Twist & robot_speed,
   const nav_msgs::msg::Path & plan, nav2_core::GoalChecker * goal_checker)
 {
-  prepare(robot_pose, robot_speed, plan, goal_checker);
+  geometry_msgs::msg::TwistStamped control;
+  {
+    StageTimer total_timer(cycle_diag_, CycleDiagnostics::TOTAL);
+    {
+      StageTimer timer(cycle_diag_, CycleDiagnostics::PREPARE);
+      prepare(robot_pose, robot_speed, plan, goal_checker);
+    }
 
-  do {
-    optimize();
-  } while (fallback(critics_data_.fail_flag));
+    do {
+      optimize();
+    } while (fallback(critics_data_.fail_flag));
 
-  utils::savitskyGolayFilter(control_sequence_, control_history_, settings_);
-  auto control = getControlFromSequenceAsTwist(plan.header.stamp);
+    utils::savitskyGolayFilter(control_sequence_, control_history_, settings_);
+    control = getControlFromSequenceAsTwist(plan.header.stamp);
 
-  if (settings_.shift_control_sequence) {
-    shiftControlSequence();
+    if (settings_.shift_control_sequence) {
+      shiftControlSequence();
+    }
   }
+  cycle_diag_.endCycle();
+  last_eval_stamp_ = clock_->now();
 
   return control;
 }
@@ -174,8 +238,14 @@ void Optimizer::optimize()
 {
   for (size_t i = 0; i < settings_.iteration_count; ++i) {
     generateNoisedTrajectories();
-    critic_manager_.evalTrajectoriesScores(critics_data_);
-    updateControlSequence();
+    {
+      StageTimer timer(cycle_diag_, CycleDiagnostics::CRITICS);
+      critic_manager_.evalTrajectoriesScores(critics_data_);
+    }
+    {
+      StageTimer timer(cycle_diag_, CycleDiagnostics::UPDATE_CONTROL);
+      updateControlSequence();
+    }
   }
 }
 
@@ -238,41 +308,58 @@ void Optimizer::shiftControlSequence()
 
 void Optimizer::generateNoisedTrajectories()
 {
-  noise_generator_.setNoisedControls(state_, control_sequence_);
-  noise_generator_.generateNextNoises();
-  updateStateVelocities(state_);
-  integrateStateVelocities(generated_trajectories_, state_);
+  {
+    StageTimer timer(cycle_diag_, CycleDiagnostics::NOISE);
+    noise_generator_.setNoisedControls(state_, control_sequence_);
+    noise_generator_.generateNextNoises();
+  }
+  {
+    StageTimer timer(cycle_diag_, CycleDiagnostics::VELOCITIES);
+    updateStateVelocities(state_);
+  }
+  {
+    StageTimer timer(cycle_diag_, CycleDiagnostics::INTEGRATION);
+    integrateStateVelocities(generated_trajectories_, state_);
+  }
 }
 
 void Optimizer::applyControlSequenceConstraints()
 {
   auto & s = settings_;
-
-  if (isHolonomic()) {
-    control_sequence_.vy = xt::clip(control_sequence_.vy, -s.constraints.vy, s.constraints.vy);
-  }
-
-  control_sequence_.vx = xt::clip(control_sequence_.vx, s.constraints.vx_min, s.constraints.vx_max);
-  control_sequence_.wz = xt::clip(control_sequence_.wz, -s.constraints.wz, s.constraints.wz);
+  const bool is_holo = isHolonomic();
 
   float max_delta_vx = s.model_dt * s.constraints.ax_max;
   float min_delta_vx = s.model_dt * s.constraints.ax_min;
   float max_delta_vy = s.model_dt * s.constraints.ay_max;
   float max_delta_wz = s.model_dt * s.constraints.az_max;
-  float vx_last = control_sequence_.vx(0);
-  float vy_last = control_sequence_.vy(0);
-  float wz_last = control_sequence_.wz(0);
+
+  // Velocity limits and acceleration limits are folded into a single pass
+  // over the sequence; the separate xt::clip assignments cost a full
+  // read-modify-write sweep per axis before the rate limiting even starts
+  float vx_last = std::clamp(control_sequence_.vx(0), s.constraints.vx_min, s.constraints.vx_max);
+  control_sequence_.vx(0) = vx_last;
+  float wz_last = std::clamp(control_sequence_.wz(0), -s.constraints.wz, s.constraints.wz);
+  control_sequence_.wz(0) = wz_last;
+  float vy_last = 0.0f;
+  if (is_holo) {
+    vy_last = std::clamp(control_sequence_.vy(0), -s.constraints.vy, s.constraints.vy);
+    control_sequence_.vy(0) = vy_last;
+  }
+
   for (unsigned int i = 1; i != control_sequence_.vx.shape(0); i++) {
     float & vx_curr = control_sequence_.vx(i);
+    vx_curr = std::clamp(vx_curr, s.constraints.vx_min, s.constraints.vx_max);
     vx_curr = std::clamp(vx_curr, vx_last + min_delta_vx, vx_last + max_delta_vx);
     vx_last = vx_curr;
 
     float & wz_curr = control_sequence_.wz(i);
+    wz_curr = std::clamp(wz_curr, -s.constraints.wz, s.constraints.wz);
     wz_curr = std::clamp(wz_curr, wz_last - max_delta_wz, wz_last + max_delta_wz);
     wz_last = wz_curr;
 
-    if (isHolonomic()) {
+    if (is_holo) {
       float & vy_curr = control_sequence_.vy(i);
+      vy_curr = std::clamp(vy_curr, -s.constraints.vy, s.constraints.vy);
       vy_curr = std::clamp(vy_curr, vy_last - max_delta_vy, vy_last + max_delta_vy);
       vy_last = vy_curr;
     }
@@ -302,7 +389,10 @@ void Optimizer::updateInitialStateVelocities(
 void Optimizer::propagateStateVelocitiesFromInitials(
   models::State & state) const
 {
-  motion_model_->predict(state);
+  worker_pool_.forEachShard(
+    settings_.batch_size, [&](unsigned int begin, unsigned int end) {
+      motion_model_->predict(state, begin, end);
+    });
 }
 
 void Optimizer::integrateStateVelocities(
@@ -343,27 +433,38 @@ void Optimizer::integrateStateVelocities(
   const models::State & state) const
 {
   const float initial_yaw = static_cast<float>(tf2::getYaw(state.pose.pose.orientation));
+  const bool is_holo = isHolonomic();
 
-  xt::noalias(trajectories.yaws) =
-    xt::cumsum(state.wz * settings_.model_dt, {1}) + initial_yaw;
-
-  auto yaw_cos = xt::roll(xt::eval(xt::cos(trajectories.yaws)), 1, 1);
-  auto yaw_sin = xt::roll(xt::eval(xt::sin(trajectories.yaws)), 1, 1);
-  xt::view(yaw_cos, xt::all(), 0) = cosf(initial_yaw);
-  xt::view(yaw_sin, xt::all(), 0) = sinf(initial_yaw);
-
-  auto && dx = xt::eval(state.vx * yaw_cos);
-  auto && dy = xt::eval(state.vx * yaw_sin);
-
-  if (isHolonomic()) {
-    dx = dx - state.vy * yaw_sin;
-    dy = dy + state.vy * yaw_cos;
-  }
-
-  xt::noalias(trajectories.x) = state.pose.pose.position.x +
-    xt::cumsum(dx * settings_.model_dt, {1});
-  xt::noalias(trajectories.y) = state.pose.pose.position.y +
-    xt::cumsum(dy * settings_.model_dt, {1});
+  // Trajectories are independent along the batch dimension, so the
+  // integration is sharded into contiguous row blocks across the pool
+  worker_pool_.forEachShard(
+    settings_.batch_size, [&](unsigned int begin, unsigned int end) {
+      const auto rows = xt::range(begin, end);
+
+      auto yaws = xt::view(trajectories.yaws, rows, xt::all());
+      xt::noalias(yaws) =
+      xt::cumsum(xt::view(state.wz, rows, xt::all()) * settings_.model_dt, {1}) + initial_yaw;
+
+      auto yaw_cos = xt::roll(xt::eval(xt::cos(yaws)), 1, 1);
+      auto yaw_sin = xt::roll(xt::eval(xt::sin(yaws)), 1, 1);
+      xt::view(yaw_cos, xt::all(), 0) = cosf(initial_yaw);
+      xt::view(yaw_sin, xt::all(), 0) = sinf(initial_yaw);
+
+      const auto vx = xt::view(state.vx, rows, xt::all());
+      auto && dx = xt::eval(vx * yaw_cos);
+      auto && dy = xt::eval(vx * yaw_sin);
+
+      if (is_holo) {
+        const auto vy = xt::view(state.vy, rows, xt::all());
+        dx = dx - vy * yaw_sin;
+        dy = dy + vy * yaw_cos;
+      }
+
+      xt::noalias(xt::view(trajectories.x, rows, xt::all())) = state.pose.pose.position.x +
+      xt::cumsum(dx * settings_.model_dt, {1});
+      xt::noalias(xt::view(trajectories.y, rows, xt::all())) = state.pose.pose.position.y +
+      xt::cumsum(dy * settings_.model_dt, {1});
+    });
 }
 
 xt::xtensor<float, 2> Optimizer::getOptimizedTrajectory()
@@ -388,32 +489,64 @@ void Optimizer::updateControlSequence()
 {
   const bool is_holo = isHolonomic();
   auto & s = settings_;
-  auto bounded_noises_vx = state_.cvx - control_sequence_.vx;
-  auto bounded_noises_wz = state_.cwz - control_sequence_.wz;
-  xt::noalias(costs_) +=
-    s.gamma / powf(s.sampling_std.vx, 2) * xt::sum(
-    xt::view(control_sequence_.vx, xt::newaxis(), xt::all()) * bounded_noises_vx, 1, immediate);
-  xt::noalias(costs_) +=
-    s.gamma / powf(s.sampling_std.wz, 2) * xt::sum(
-    xt::view(control_sequence_.wz, xt::newaxis(), xt::all()) * bounded_noises_wz, 1, immediate);
-
-  if (is_holo) {
-    auto bounded_noises_vy = state_.cvy - control_sequence_.vy;
-    xt::noalias(costs_) +=
-      s.gamma / powf(s.sampling_std.vy, 2) * xt::sum(
-      xt::view(control_sequence_.vy, xt::newaxis(), xt::all()) * bounded_noises_vy,
-      1, immediate);
+  const unsigned int batch_size = state_.cvx.shape(0);
+  const unsigned int time_steps = state_.cvx.shape(1);
+  const float gamma_vx = s.gamma / powf(s.sampling_std.vx, 2);
+  const float gamma_wz = s.gamma / powf(s.sampling_std.wz, 2);
+  const float gamma_vy = s.gamma / powf(s.sampling_std.vy, 2);
+
+  // Hand-fused reduction: the expression form materialized a
+  // (batch x time) bounded-noise temporary per axis plus batch-sized
+  // exponent/softmax temporaries. One sweep over the control tensors
+  // folds the gamma action costs into costs_ and tracks the minimum
+  // needed for softmax normalization.
+  float min_cost = std::numeric_limits<float>::max();
+  for (unsigned int i = 0; i != batch_size; i++) {
+    float sum_vx = 0.0f;
+    float sum_wz = 0.0f;
+    for (unsigned int j = 0; j != time_steps; j++) {
+      sum_vx += control_sequence_.vx(j) * (state_.cvx(i, j) - control_sequence_.vx(j));
+      sum_wz += control_sequence_.wz(j) * (state_.cwz(i, j) - control_sequence_.wz(j));
+    }
+    float cost = costs_(i) + gamma_vx * sum_vx + gamma_wz * sum_wz;
+    if (is_holo) {
+      float sum_vy = 0.0f;
+      for (unsigned int j = 0; j != time_steps; j++) {
+        sum_vy += control_sequence_.vy(j) * (state_.cvy(i, j) - control_sequence_.vy(j));
+      }
+      cost += gamma_vy * sum_vy;
+    }
+    costs_(i) = cost;
+    min_cost = std::min(min_cost, cost);
   }
 
-  auto && costs_normalized = costs_ - xt::amin(costs_, immediate);
-  auto && exponents = xt::eval(xt::exp(-1 / settings_.temperature * costs_normalized));
-  auto && softmaxes = xt::eval(exponents / xt::sum(exponents, immediate));
-  auto && softmaxes_extened = xt::eval(xt::view(softmaxes, xt::all(), xt::newaxis()));
+  // Softmax weights over the batch, reusing a persistent buffer
+  const float inv_temperature = -1.0f / s.temperature;
+  float exponents_sum = 0.0f;
+  for (unsigned int i = 0; i != batch_size; i++) {
+    const float exponent = std::exp(inv_temperature * (costs_(i) - min_cost));
+    softmax_weights_(i) = exponent;
+    exponents_sum += exponent;
+  }
+  const float inv_exponents_sum = 1.0f / exponents_sum;
 
-  xt::noalias(control_sequence_.vx) = xt::sum(state_.cvx * softmaxes_extened, 0, immediate);
-  xt::noalias(control_sequence_.wz) = xt::sum(state_.cwz * softmaxes_extened, 0, immediate);
+  // Weighted control average accumulated in a second sweep
+  control_sequence_.vx.fill(0.0f);
+  control_sequence_.wz.fill(0.0f);
   if (is_holo) {
-    xt::noalias(control_sequence_.vy) = xt::sum(state_.cvy * softmaxes_extened, 0, immediate);
+    control_sequence_.vy.fill(0.0f);
+  }
+  for (unsigned int i = 0; i != batch_size; i++) {
+    const float softmax = softmax_weights_(i) * inv_exponents_sum;
+    for (unsigned int j = 0; j != time_steps; j++) {
+      control_sequence_.vx(j) += softmax * state_.cvx(i, j);
+      control_sequence_.wz(j) += softmax * state_.cwz(i, j);
+    }
+    if (is_holo) {
+      for (unsigned int j = 0; j != time_steps; j++) {
+        control_sequence_.vy(j) += softmax * state_.cvy(i, j);
+      }
+    }
   }
 
   applyControlSequenceConstraints();
@@ -52,7 +52,32 @@ ParametersHandler::dynamicParamsCallback(
   std::vector<rclcpp::Parameter> parameters)
 {
   rcl_interfaces::msg::SetParametersResult result;
-  std::lock_guard<std::mutex> lock(parameters_change_mutex_);
+
+  {
+    std::lock_guard<std::mutex> lock(parameters_change_mutex_);
+    pending_parameters_.insert(
+      pending_parameters_.end(),
+      std::make_move_iterator(parameters.begin()),
+      std::make_move_iterator(parameters.end()));
+    pending_epoch_.fetch_add(1, std::memory_order_release);
+  }
+
+  result.successful = true;
+  return result;
+}
+
+void ParametersHandler::applyPendingParameters()
+{
+  if (pending_epoch_.load(std::memory_order_acquire) == applied_epoch_) {
+    return;
+  }
+
+  std::vector<rclcpp::Parameter> parameters;
+  {
+    std::lock_guard<std::mutex> lock(parameters_change_mutex_);
+    parameters.swap(pending_parameters_);
+    applied_epoch_ = pending_epoch_.load(std::memory_order_acquire);
+  }
 
   for (auto & pre_cb : pre_callbacks_) {
     pre_cb();
@@ -73,9 +98,6 @@ ParametersHandler::dynamicParamsCallback(
   for (auto & post_cb : post_callbacks_) {
     post_cb();
   }
-
-  result.successful = true;
-  return result;
 }
 
 }  // namespace mppi
@@ -51,12 +51,13 @@ PathHandler::getGlobalPlanConsideringBoundsInCostmapFrame(
 {
   using nav2_util::geometry_utils::euclidean_distance;
 
-  auto begin = global_plan_up_to_inversion_.poses.begin();
+  // Resume from the progress made in past cycles rather than the front of the plan
+  auto begin = global_plan_up_to_inversion_.poses.begin() + progress_idx_;
 
   // Limit the search for the closest pose up to max_robot_pose_search_dist on the path
   auto closest_pose_upper_bound =
     nav2_util::geometry_utils::first_after_integrated_distance(
-    global_plan_up_to_inversion_.poses.begin(), global_plan_up_to_inversion_.poses.end(),
+    begin, global_plan_up_to_inversion_.poses.end(),
     max_robot_pose_search_dist_);
 
   // Find closest point to the robot
@@ -125,13 +126,16 @@ nav_msgs::msg::Path PathHandler::transformPath(
     transformToGlobalPlanFrame(robot_pose);
   auto [transformed_plan, lower_bound] = getGlobalPlanConsideringBoundsInCostmapFrame(global_pose);
 
-  prunePlan(global_plan_up_to_inversion_, lower_bound);
+  // Advance the monotonic progress marker instead of erasing passed poses,
+  // which would memmove the remainder of the plan every cycle
+  progress_idx_ = lower_bound - global_plan_up_to_inversion_.poses.begin();
 
   if (enforce_path_inversion_ && inversion_locale_ != 0u) {
     if (isWithinInversionTolerances(global_pose)) {
       prunePlan(global_plan_, global_plan_.poses.begin() + inversion_locale_);
       global_plan_up_to_inversion_ = global_plan_;
       inversion_locale_ = utils::removePosesAfterFirstInversion(global_plan_up_to_inversion_);
+      progress_idx_ = 0u;
     }
   }
 
@@ -174,6 +178,7 @@ void PathHandler::setPath(const nav_msgs::msg::Path & plan)
 {
   global_plan_ = plan;
   global_plan_up_to_inversion_ = global_plan_;
+  progress_idx_ = 0u;
   if (enforce_path_inversion_) {
     inversion_locale_ = utils::removePosesAfterFirstInversion(global_plan_up_to_inversion_);
   }
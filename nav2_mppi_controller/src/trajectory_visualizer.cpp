@@ -56,6 +56,23 @@ void TrajectoryVisualizer::on_deactivate()
   transformed_path_pub_->on_deactivate();
 }
 
+visualization_msgs::msg::Marker & TrajectoryVisualizer::nextMarker(
+  const std::string & marker_namespace)
+{
+  using visualization_msgs::msg::Marker;
+  if (markers_used_ == points_.markers.size()) {
+    points_.markers.emplace_back();
+  }
+  Marker & marker = points_.markers[markers_used_++];
+  marker.header.frame_id = frame_id_;
+  marker.header.stamp = rclcpp::Time(0, 0);
+  marker.ns = marker_namespace;
+  marker.id = marker_id_++;
+  marker.type = Marker::SPHERE;
+  marker.action = Marker::ADD;
+  return marker;
+}
+
 void TrajectoryVisualizer::add(
   const xt::xtensor<float, 2> & trajectory, const std::string & marker_namespace)
 {
@@ -63,19 +80,21 @@ void TrajectoryVisualizer::add(
   if (!size) {
     return;
   }
+  if (trajectories_publisher_->get_subscription_count() == 0) {
+    // Nobody listening: building markers would be pure overhead
+    return;
+  }
 
   auto add_marker = [&](auto i) {
       float component = static_cast<float>(i) / static_cast<float>(size);
 
-      auto pose = utils::createPose(trajectory(i, 0), trajectory(i, 1), 0.06);
-      auto scale =
+      auto & marker = nextMarker(marker_namespace);
+      marker.pose = utils::createPose(trajectory(i, 0), trajectory(i, 1), 0.06);
+      marker.scale =
         i != size - 1 ?
         utils::createScale(0.03, 0.03, 0.07) :
         utils::createScale(0.07, 0.07, 0.09);
-      auto color = utils::createColor(0, component, component, 1);
-      auto marker = utils::createMarker(
-        marker_id_++, pose, scale, color, frame_id_, marker_namespace);
-      points_->markers.push_back(marker);
+      marker.color = utils::createColor(0, component, component, 1);
     };
 
   for (size_t i = 0; i < size; i++) {
@@ -86,9 +105,17 @@ void TrajectoryVisualizer::add(
 void TrajectoryVisualizer::add(
   const models::Trajectories & trajectories, const std::string & marker_namespace)
 {
+  if (trajectories_publisher_->get_subscription_count() == 0) {
+    // Nobody listening: building markers would be pure overhead
+    return;
+  }
+
   auto & shape = trajectories.x.shape();
   const float shape_1 = static_cast<float>(shape[1]);
-  points_->markers.reserve(floor(shape[0] / trajectory_step_) * floor(shape[1] * time_step_));
+  points_.markers.reserve(
+    markers_used_ +
+    (shape[0] + trajectory_step_ - 1) / trajectory_step_ *
+    ((shape[1] + time_step_ - 1) / time_step_));
 
   for (size_t i = 0; i < shape[0]; i += trajectory_step_) {
     for (size_t j = 0; j < shape[1]; j += time_step_) {
@@ -96,13 +123,10 @@ void TrajectoryVisualizer::add(
       float blue_component = 1.0f - j_flt / shape_1;
       float green_component = j_flt / shape_1;
 
-      auto pose = utils::createPose(trajectories.x(i, j), trajectories.y(i, j), 0.03);
-      auto scale = utils::createScale(0.03, 0.03, 0.03);
-      auto color = utils::createColor(0, green_component, blue_component, 1);
-      auto marker = utils::createMarker(
-        marker_id_++, pose, scale, color, frame_id_, marker_namespace);
-
-      points_->markers.push_back(marker);
+      auto & marker = nextMarker(marker_namespace);
+      marker.pose = utils::createPose(trajectories.x(i, j), trajectories.y(i, j), 0.03);
+      marker.scale = utils::createScale(0.03, 0.03, 0.03);
+      marker.color = utils::createColor(0, green_component, blue_component, 1);
     }
   }
 }
@@ -110,13 +134,16 @@ void TrajectoryVisualizer::add(
 void TrajectoryVisualizer::reset()
 {
   marker_id_ = 0;
-  points_ = std::make_unique<visualization_msgs::msg::MarkerArray>();
+  // keep the pool: its markers are refilled in place next cycle
+  markers_used_ = 0;
 }
 
 void TrajectoryVisualizer::visualize(const nav_msgs::msg::Path & plan)
 {
   if (trajectories_publisher_->get_subscription_count() > 0) {
-    trajectories_publisher_->publish(std::move(points_));
+    // drop pool slots not refilled this cycle; capacity is retained
+    points_.markers.resize(markers_used_);
+    trajectories_publisher_->publish(points_);
   }
 
   reset();
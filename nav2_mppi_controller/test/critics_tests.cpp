@@ -457,6 +457,67 @@ TEST(CriticTests, TwirlingCritic)
   EXPECT_NEAR(costs(0), 3.3, 4e-1);  // (mean of noise with mu=0, sigma=0.5 * 10.0 weight
 }
 
+TEST(CriticTests, FusedKernelsMatchScore)
+{
+  // Standard preamble
+  auto node = std::make_shared<rclcpp_lifecycle::LifecycleNode>("my_node");
+  auto costmap_ros = std::make_shared<nav2_costmap_2d::Costmap2DROS>(
+    "dummy_costmap", "", "dummy_costmap", true);
+  ParametersHandler param_handler(node);
+  rclcpp_lifecycle::State lstate;
+  costmap_ros->on_configure(lstate);
+
+  models::State state;
+  state.reset(100, 30);
+  models::ControlSequence control_sequence;
+  models::Trajectories generated_trajectories;
+  generated_trajectories.reset(100, 30);
+  models::Path path;
+  xt::xtensor<float, 1> costs = xt::zeros<float>({100});
+  float model_dt = 0.1;
+  CriticData data =
+  {state, generated_trajectories, path, costs, model_dt, false, nullptr, nullptr, std::nullopt,
+    std::nullopt};
+  data.motion_model = std::make_shared<DiffDriveMotionModel>();
+  TestGoalChecker goal_checker;  // from utils_tests tolerance of 0.25 positionally
+  data.goal_checker = &goal_checker;
+
+  // Robot away from goal so all critics are active
+  state.pose.pose.position.x = 1.0;
+  path.reset(10);
+  path.x(9) = 10.0;
+  state.vx = xt::random::randn<float>({100, 30}, 0.0, 0.5);
+  state.wz = xt::random::randn<float>({100, 30}, 0.0, 0.5);
+
+  TwirlingCritic twirling;
+  twirling.on_configure(node, "mppi", "twirling", costmap_ros, &param_handler);
+  PreferForwardCritic prefer_forward;
+  prefer_forward.on_configure(node, "mppi", "prefer_forward", costmap_ros, &param_handler);
+  ConstraintCritic constraint;
+  constraint.on_configure(node, "mppi", "constraint", costmap_ros, &param_handler);
+
+  std::vector<critics::CriticFunction *> fused = {&twirling, &prefer_forward, &constraint};
+  for (auto * critic : fused) {
+    EXPECT_TRUE(critic->fusable(data));
+  }
+
+  // Per-point kernels accumulated per trajectory must match the batch score()
+  twirling.score(data);
+  prefer_forward.score(data);
+  constraint.score(data);
+  for (unsigned int traj = 0; traj != 100u; traj++) {
+    float fused_cost = 0.0f;
+    for (auto * critic : fused) {
+      float accum = 0.0f;
+      for (unsigned int step = 0; step != 30u; step++) {
+        accum += critic->scorePoint(data, traj, step);
+      }
+      fused_cost += critic->finishTrajectory(data, accum);
+    }
+    EXPECT_NEAR(costs(traj), fused_cost, 1e-3f);
+  }
+}
+
 TEST(CriticTests, PathFollowCritic)
 {
   // Standard preamble
@@ -129,3 +129,45 @@ TEST(NoiseGeneratorTest, NoiseGeneratorMain)
 
   generator.shutdown();
 }
+
+TEST(NoiseGeneratorTest, NoiseGeneratorRing)
+{
+  // Tests precomputed noise table ring produces scaled, rotating noises
+  auto node = std::make_shared<rclcpp_lifecycle::LifecycleNode>("node");
+  node->declare_parameter("test_name.regenerate_noises", rclcpp::ParameterValue(true));
+  node->declare_parameter("test_name.noise_table_ring_size", rclcpp::ParameterValue(4));
+  ParametersHandler handler(node);
+  NoiseGenerator generator;
+  mppi::models::OptimizerSettings settings;
+  settings.batch_size = 100;
+  settings.time_steps = 25;
+  settings.sampling_std.vx = 0.1;
+  settings.sampling_std.vy = 0.1;
+  settings.sampling_std.wz = 0.1;
+
+  mppi::models::ControlSequence control_sequence;
+  control_sequence.reset(25);
+  mppi::models::State state;
+  state.reset(settings.batch_size, settings.time_steps);
+
+  generator.initialize(settings, false, "test_name", &handler);
+  generator.generateNextNoises();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  generator.setNoisedControls(state, control_sequence);
+
+  // Zero-mean control sequence, so controls are the scaled table samples
+  EXPECT_NE(state.cvx(0), 0);
+  EXPECT_EQ(state.cvy(0), 0);  // Not populated in non-holonomic
+  EXPECT_NE(state.cwz(0), 0);
+  EXPECT_NEAR(state.cvx(0), 0, 0.5);
+  EXPECT_NEAR(state.cwz(0), 0, 0.5);
+  const float first_sample = state.cvx(0);
+
+  // Consuming the next ring slot yields a different sample
+  generator.generateNextNoises();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  generator.setNoisedControls(state, control_sequence);
+  EXPECT_NE(state.cvx(0), first_sample);
+
+  generator.shutdown();
+}
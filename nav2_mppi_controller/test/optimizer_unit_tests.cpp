@@ -115,6 +115,35 @@ public:
     EXPECT_EQ(generated_trajectories_.x, xt::zeros<float>({1000, 50}));
   }
 
+  void testWarmStartReset()
+  {
+    settings_.warm_start = true;
+    control_sequence_.reset(settings_.time_steps);
+    for (unsigned int i = 0; i != settings_.time_steps; i++) {
+      control_sequence_.vx(i) = static_cast<float>(i);
+    }
+    last_eval_stamp_ = clock_->now();
+    reset(true);
+
+    // Sequence is retained (no time has elapsed, so no shift) rather than zeroed
+    EXPECT_EQ(control_sequence_.vx(5), 5.0f);
+
+    // A stale sequence falls back to a cold reset
+    last_eval_stamp_ = clock_->now() -
+      rclcpp::Duration::from_seconds(settings_.time_steps * settings_.model_dt + 1.0);
+    reset(true);
+    EXPECT_EQ(control_sequence_.vx, xt::zeros<float>({50}));
+
+    // Disabled parameter always resets cold
+    for (unsigned int i = 0; i != settings_.time_steps; i++) {
+      control_sequence_.vx(i) = static_cast<float>(i);
+    }
+    settings_.warm_start = false;
+    last_eval_stamp_ = clock_->now();
+    reset(true);
+    EXPECT_EQ(control_sequence_.vx, xt::zeros<float>({50}));
+  }
+
   bool fallbackWrapper(bool fail)
   {
     return fallback(fail);
@@ -333,6 +362,9 @@ TEST(OptimizerTests, resetTests)
   // Tests resetting the full state of all the functions after filling with garbage
   optimizer_tester.fillOptimizerWithGarbage();
   optimizer_tester.testReset();
+
+  // Tests warm starting retains the control sequence only when enabled and fresh
+  optimizer_tester.testWarmStartReset();
 }
 
 TEST(OptimizerTests, FallbackTests)
@@ -109,6 +109,7 @@ TEST(ParameterHandlerTest, PrePostDynamicCallbackTest)
 
   // Dynamic callback should not trigger, wrong parameter, but val should be updated
   a.dynamicParamsCallback(std::vector<rclcpp::Parameter>{random_param});
+  a.applyPendingParameters();
   EXPECT_FALSE(dynamic_triggered);
   EXPECT_TRUE(pre_triggered);
   EXPECT_TRUE(post_triggered);
@@ -117,6 +118,7 @@ TEST(ParameterHandlerTest, PrePostDynamicCallbackTest)
   // Now dynamic parameter bool should be updated, right param called!
   pre_triggered = false, post_triggered = false;
   a.dynamicParamsCallback(std::vector<rclcpp::Parameter>{random_param2});
+  a.applyPendingParameters();
   EXPECT_TRUE(dynamic_triggered);
   EXPECT_TRUE(pre_triggered);
   EXPECT_TRUE(post_triggered);
@@ -175,6 +177,10 @@ TEST(ParameterHandlerTest, DynamicAndStaticParametersTest)
     node->get_node_base_interface(),
     results);
 
+  // Changes are queued until applied, as the controller does each cycle
+  EXPECT_EQ(p1, 7);
+  handler.applyPendingParameters();
+
   // Now, only param1 should change, param 2 should be the same
   EXPECT_EQ(p1, 10);
   EXPECT_EQ(p2, 7);
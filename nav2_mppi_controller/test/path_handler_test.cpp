@@ -203,6 +203,10 @@ TEST(PathHandlerTests, TestTransforms)
   // Put it all together
   auto final_path = handler.transformPath(robot_pose);
   EXPECT_EQ(final_path.poses.size(), path_out.poses.size());
+
+  // Repeated queries from the same pose track progress consistently
+  auto repeated_path = handler.transformPath(robot_pose);
+  EXPECT_EQ(repeated_path.poses.size(), final_path.poses.size());
 }
 
 TEST(PathHandlerTests, TestInversionToleranceChecks)
@@ -81,6 +81,10 @@ TEST(TrajectoryVisualizerTests, VisOptimalTrajectory)
   TrajectoryVisualizer vis;
   vis.on_configure(node, "my_name", "fkmap", parameters_handler.get());
   vis.on_activate();
+  // wait for discovery so the visualizer sees its subscriber and builds markers
+  for (unsigned int i = 0; i != 100 && my_sub->get_publisher_count() == 0; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
   vis.add(optimal_trajectory, "Optimal Trajectory");
   nav_msgs::msg::Path bogus_path;
   vis.visualize(bogus_path);
@@ -145,6 +149,10 @@ TEST(TrajectoryVisualizerTests, VisCandidateTrajectories)
   TrajectoryVisualizer vis;
   vis.on_configure(node, "my_name", "fkmap", parameters_handler.get());
   vis.on_activate();
+  // wait for discovery so the visualizer sees its subscriber and builds markers
+  for (unsigned int i = 0; i != 100 && my_sub->get_publisher_count() == 0; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
   vis.add(candidate_trajectories, "Candidate Trajectories");
   nav_msgs::msg::Path bogus_path;
   vis.visualize(bogus_path);
@@ -44,6 +44,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <functional>
+#include <vector>
 
 namespace nav2_navfn_planner
 {
@@ -169,7 +170,8 @@ public:
 
   /** cell arrays */
   COSTTYPE * costarr;  /**< cost array in 2D configuration space */
-  float * potarr;  /**< potential array, navigation function potential */
+  float * potarr;  /**< potential array, navigation function potential, 32-byte aligned */
+  float * potarr_storage;  /**< owning allocation behind the aligned potarr */
   bool * pending;  /**< pending cells during propagation */
   int nobs;  /**< number of obstacle cells */
 
@@ -182,6 +184,14 @@ public:
   float curT;  /**< current threshold */
   float priInc;  /**< priority threshold increment */
 
+  /** bucketed priority queue, finer-grained alternative to the blocks */
+  bool use_bucketed_queue;  /**< propagate with the bucketed queue instead of the blocks */
+  std::vector<std::vector<int>> buckets;  /**< queue entries bucketed by potential */
+  unsigned int current_bucket;  /**< lowest bucket that may still hold entries */
+  /**< bucket width, at most the smallest cell-to-cell potential increment so
+       that cells queued while processing a bucket land in a later bucket */
+  static constexpr float bucket_width = 32.0f;
+
   /**< number of cycles between checks for cancellation */
   static constexpr int terminal_checking_interval = 5000;
 
@@ -225,6 +235,21 @@ public:
    */
   void updateCellAstar(int n);
 
+  /**
+   * @brief  Updates the cell at index n, queueing improved neighbors into
+   * the bucketed priority queue
+   * @param n The index to update
+   * @param astar Whether to order the queue with the A* distance heuristic
+   */
+  void updateCellBucketed(int n, bool astar);
+
+  /**
+   * @brief  Queue cell n into the bucketed priority queue at a given priority
+   * @param n The cell to queue
+   * @param key The priority to queue it at
+   */
+  void pushBucket(int n, float key);
+
   /**
    * @brief  Set up navigation potential arrays for new propagation
    * @param keepit whether or not use COST_NEUTRAL
@@ -250,6 +275,20 @@ public:
    */
   bool propNavFnAstar(int cycles, std::function<bool()> cancelChecker);
 
+  /**
+   * @brief  Run propagation ordered by a bucketed priority queue over the
+   * potentials, a finer-grained ordering than the priority blocks that
+   * revisits far fewer cells
+   * @param cycles The maximum number of block-equivalent iterations to run for
+   * @param cancelChecker Function to check if the task has been canceled
+   * @param astar Whether to order the queue with the A* distance heuristic
+   * @param atStart Whether or not to stop when the start point is reached
+   * @return true if the start point is reached
+   */
+  bool propNavFnBucketed(
+    int cycles, std::function<bool()> cancelChecker,
+    bool astar, bool atStart = false);
+
   /** gradient and paths */
   float * gradx, * grady;  /**< gradient arrays, size of potential array */
   float * pathx, * pathy;  /**< path points, as subpixel cell coordinates */
@@ -272,6 +311,17 @@ public:
    */
   float gradCell(int n);  /**< calculates gradient at cell <n>, returns norm */
 
+  /**
+   * @brief  Compute the gradient field for one whole row of the potential
+   * array with central differences, so path extraction reads precomputed
+   * values instead of deriving four cells per step. Rows are computed at
+   * most once per propagation; edge rows keep zero gradients.
+   * @param row Row index into the potential array
+   */
+  void computeGradientRow(int row);
+
+  std::vector<uint8_t> grad_row_done_;  /**< rows of the gradient field computed since setup */
+
   float pathStep;  /**< step size for following gradient */
 
   /** display callback */
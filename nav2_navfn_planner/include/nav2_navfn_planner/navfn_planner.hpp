@@ -220,6 +220,10 @@ protected:
   // Whether to use the astar planner or default dijkstras
   bool use_astar_;
 
+  // Whether to propagate potentials with the bucketed priority queue
+  // instead of the classic priority blocks
+  bool use_bucketed_queue_;
+
   // parent node weak ptr
   rclcpp_lifecycle::LifecycleNode::WeakPtr node_;
 
@@ -44,6 +44,7 @@
 #include "nav2_navfn_planner/navfn.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include "nav2_core/planner_exceptions.hpp"
 #include "rclcpp/rclcpp.hpp"
 
@@ -114,8 +115,11 @@ NavFn::NavFn(int xs, int ys)
   // create cell arrays
   costarr = NULL;
   potarr = NULL;
+  potarr_storage = NULL;
   pending = NULL;
   gradx = grady = NULL;
+  use_bucketed_queue = false;
+  current_bucket = 0;
   setNavArr(xs, ys);
 
   // priority buffers
@@ -147,8 +151,8 @@ NavFn::~NavFn()
   if (costarr) {
     delete[] costarr;
   }
-  if (potarr) {
-    delete[] potarr;
+  if (potarr_storage) {
+    delete[] potarr_storage;
   }
   if (pending) {
     delete[] pending;
@@ -215,8 +219,8 @@ NavFn::setNavArr(int xs, int ys)
   if (costarr) {
     delete[] costarr;
   }
-  if (potarr) {
-    delete[] potarr;
+  if (potarr_storage) {
+    delete[] potarr_storage;
   }
   if (pending) {
     delete[] pending;
@@ -231,7 +235,11 @@ NavFn::setNavArr(int xs, int ys)
 
   costarr = new COSTTYPE[ns];  // cost array, 2d config space
   memset(costarr, 0, ns * sizeof(COSTTYPE));
-  potarr = new float[ns];  // navigation potential array
+  // navigation potential array, kept 32-byte aligned so the reset and
+  // propagation sweeps vectorize cleanly
+  potarr_storage = new float[ns + 8];
+  potarr = reinterpret_cast<float *>(
+    (reinterpret_cast<uintptr_t>(potarr_storage) + 31) & ~static_cast<uintptr_t>(31));
   pending = new bool[ns];
   memset(pending, 0, ns * sizeof(bool));
   gradx = new float[ns];
@@ -299,6 +307,9 @@ NavFn::calcNavFnDijkstra(std::function<bool()> cancelChecker, bool atStart)
   setupNavFn(true);
 
   // calculate the nav fn and path
+  if (use_bucketed_queue) {
+    return propNavFnBucketed(std::max(nx * ny / 20, nx + ny), cancelChecker, false, atStart);
+  }
   return propNavFnDijkstra(std::max(nx * ny / 20, nx + ny), cancelChecker, atStart);
 }
 
@@ -313,6 +324,9 @@ NavFn::calcNavFnAstar(std::function<bool()> cancelChecker)
   setupNavFn(true);
 
   // calculate the nav fn and path
+  if (use_bucketed_queue) {
+    return propNavFnBucketed(std::max(nx * ny / 20, nx + ny), cancelChecker, true, true);
+  }
   return propNavFnAstar(std::max(nx * ny / 20, nx + ny), cancelChecker);
 }
 
@@ -349,6 +363,7 @@ NavFn::setupNavFn(bool keepit)
     }
     gradx[i] = grady[i] = 0.0;
   }
+  grad_row_done_.assign(ny, 0);
 
   // outer bounds of cost array
   COSTTYPE * pc;
@@ -563,6 +578,98 @@ NavFn::updateCellAstar(int n)
 }
 
 
+// inserting onto the bucketed priority queue
+
+void
+NavFn::pushBucket(int n, float key)
+{
+  if (n < 0 || n >= ns || pending[n] || costarr[n] >= COST_OBS) {
+    return;
+  }
+
+  unsigned int idx = static_cast<unsigned int>(key / bucket_width);
+  // the A* heuristic is not consistent with the quadratic interpolation,
+  // so keys can land slightly below the bucket being drained
+  if (idx < current_bucket) {
+    idx = current_bucket;
+  }
+  if (idx >= buckets.size()) {
+    buckets.resize(idx + 1);
+  }
+  buckets[idx].push_back(n);
+  pending[n] = true;
+}
+
+
+//
+// Bucketed-queue variant of the cell update
+// Same planar-wave calculation as updateCell()/updateCellAstar(), but
+// improved neighbors are queued at their prospective potential instead
+// of into the coarse priority blocks
+//
+
+inline void
+NavFn::updateCellBucketed(int n, bool astar)
+{
+  // get neighbors
+  const float l = potarr[n - 1];
+  const float r = potarr[n + 1];
+  const float u = potarr[n - nx];
+  const float d = potarr[n + nx];
+
+  // find lowest, and its lowest neighbor
+  float ta, tc;
+  if (l < r) {tc = l;} else {tc = r;}
+  if (u < d) {ta = u;} else {ta = d;}
+
+  // do planar wave update
+  if (costarr[n] < COST_OBS) {  // don't propagate into obstacles
+    float hf = static_cast<float>(costarr[n]);  // traversability factor
+    float dc = tc - ta;  // relative cost between ta,tc
+    if (dc < 0) {  // ta is lowest
+      dc = -dc;
+      ta = tc;
+    }
+
+    // calculate new potential
+    float pot;
+    if (dc >= hf) {  // if too large, use ta-only update
+      pot = ta + hf;
+    } else {  // two-neighbor interpolation update
+      // use quadratic approximation
+      const float div = dc / hf;
+      const float v = -0.2301 * div * div + 0.5307 * div + 0.7040;
+      pot = ta + hf * v;
+    }
+
+    // now add affected neighbors to the bucketed queue
+    if (pot < potarr[n]) {
+      float le = INVSQRT2 * static_cast<float>(costarr[n - 1]);
+      float re = INVSQRT2 * static_cast<float>(costarr[n + 1]);
+      float ue = INVSQRT2 * static_cast<float>(costarr[n - nx]);
+      float de = INVSQRT2 * static_cast<float>(costarr[n + nx]);
+
+      potarr[n] = pot;
+
+      float key = pot;
+      if (astar) {
+        // order by potential plus distance-to-start heuristic
+        int x = n % nx;
+        int y = n / nx;
+        key += hypot(x - start[0], y - start[1]) * static_cast<float>(COST_NEUTRAL);
+      }
+      // requeue any neighbor that could still improve; the margin is looser
+      // than the blocks' edge-cost threshold since the strict ordering here
+      // gives fewer chances for the two-neighbor interpolation to refine
+      if (l > pot - 0.3f * le) {pushBucket(n - 1, key + le);}
+      if (r > pot - 0.3f * re) {pushBucket(n + 1, key + re);}
+      if (u > pot - 0.3f * ue) {pushBucket(n - nx, key + ue);}
+      if (d > pot - 0.3f * de) {pushBucket(n + nx, key + de);}
+    }
+  }
+}
+
+
 //
 // main propagation function
 // Dijkstra method, breadth-first
@@ -742,6 +849,82 @@ NavFn::propNavFnAstar(int cycles, std::function<bool()> cancelChecker)
 }
 
 
+//
+// main propagation function
+// bucketed priority queue, approximately best-first
+// orders cell updates by potential with bucket_width granularity, a much
+// finer ordering than the priority blocks, so cells are rarely revisited
+// runs for a bounded number of cell updates,
+//   or until it runs out of cells to update,
+//   or until the Start cell is found (atStart = true)
+//
+
+bool
+NavFn::propNavFnBucketed(
+  int cycles, std::function<bool()> cancelChecker, bool astar, bool atStart)
+{
+  int nwv = 0;  // max bucket size
+  // callers size <cycles> assuming block-sized batches; the equivalent
+  // budget here is in individual cell updates
+  const int64_t max_updates = static_cast<int64_t>(cycles) * 50;
+  int64_t updates = 0;  // number of cell updates done
+
+  // set up start cell
+  int startCell = start[1] * nx + start[0];
+
+  // seed the queue from the cells queued around the goal by setupNavFn();
+  // their potentials are still unassigned, so they go into the first bucket
+  buckets.clear();
+  buckets.resize(1);
+  current_bucket = 0;
+  for (int i = 0; i < curPe; i++) {
+    buckets[0].push_back(curP[i]);  // pending flags already set by push_cur
+  }
+  curPe = 0;
+
+  // drain buckets in priority order; cells queued while draining a bucket
+  // always land in the current bucket or a later one
+  while (current_bucket < buckets.size() && updates < max_updates) {
+    // index the bucket afresh each access: pushBucket() may grow the
+    // outer vector and invalidate any reference held across it
+    if (static_cast<int>(buckets[current_bucket].size()) > nwv) {
+      nwv = static_cast<int>(buckets[current_bucket].size());
+    }
+    for (size_t i = 0; i < buckets[current_bucket].size() && updates < max_updates; i++) {
+      if (updates % terminal_checking_interval == 0 && cancelChecker()) {
+        throw nav2_core::PlannerCancelled("Planner was cancelled");
+      }
+      int n = buckets[current_bucket][i];
+      pending[n] = false;
+      updateCellBucketed(n, astar);
+      updates++;
+    }
+    buckets[current_bucket].clear();
+    current_bucket++;
+
+    // check if we've hit the Start cell; its bucket has fully drained, so
+    // its potential can no longer improve meaningfully
+    if ((atStart || astar) && potarr[startCell] < POT_HIGH) {
+      break;
+    }
+  }
+
+  if (astar) {
+    last_path_cost_ = potarr[startCell];
+  }
+
+  RCLCPP_DEBUG(
+    rclcpp::get_logger("rclcpp"),
+    "[NavFn] Bucketed queue used %d updates (%d%% of cells), largest bucket %d\n",
+    static_cast<int>(updates), (int)((updates * 100.0) / (ns - nobs)), nwv);
+
+  if (atStart || astar) {
+    return potarr[startCell] < POT_HIGH;
+  }
+  return updates < max_updates;
+}
+
+
 float NavFn::getLastPathCost()
 {
   return last_path_cost_;
@@ -871,11 +1054,15 @@ NavFn::calcPath(int n, int * st)
         return 0;
       }
     } else {  // have a good gradient here
-      // get grad at four positions near cell
-      gradCell(stc);
-      gradCell(stc + 1);
-      gradCell(stcnx);
-      gradCell(stcnx + 1);
+      // gradients come from whole rows precomputed on first touch, instead
+      // of deriving the four interpolation corners cell by cell
+      const int row = stc / nx;
+      if (!grad_row_done_[row]) {
+        computeGradientRow(row);
+      }
+      if (!grad_row_done_[row + 1]) {
+        computeGradientRow(row + 1);
+      }
 
 
       // get interpolated gradient
@@ -986,6 +1173,54 @@ NavFn::gradCell(int n)
   return norm;
 }
 
+// compute the gradient field for a whole row at once; the branch-free body
+// keeps the loop vectorizable, and edge rows/columns keep the zero gradients
+// they were initialized with
+void
+NavFn::computeGradientRow(int row)
+{
+  grad_row_done_[row] = 1;
+  if (row < 1 || row >= ny - 1) {
+    return;
+  }
+
+  const float * pot = potarr;
+  const int base = row * nx;
+  for (int x = 1; x < nx - 1; x++) {
+    const int n = base + x;
+    const float cv = pot[n];
+    float dx = 0.0f;
+    float dy = 0.0f;
+
+    if (cv >= POT_HIGH) {
+      // in an obstacle: point toward a free neighbor, if any
+      if (pot[n - 1] < POT_HIGH) {
+        dx = -COST_OBS;
+      } else if (pot[n + 1] < POT_HIGH) {
+        dx = COST_OBS;
+      }
+      if (pot[n - nx] < POT_HIGH) {
+        dy = -COST_OBS;
+      } else if (pot[n + nx] < POT_HIGH) {
+        dy = COST_OBS;
+      }
+    } else {
+      // central differences, one-sided next to obstacle cells
+      if (pot[n - 1] < POT_HIGH) {dx += pot[n - 1] - cv;}
+      if (pot[n + 1] < POT_HIGH) {dx += cv - pot[n + 1];}
+      if (pot[n - nx] < POT_HIGH) {dy += pot[n - nx] - cv;}
+      if (pot[n + nx] < POT_HIGH) {dy += cv - pot[n + nx];}
+    }
+
+    const float sq = dx * dx + dy * dy;
+    if (sq > 0.0f) {
+      const float inv = 1.0f / std::sqrt(sq);
+      gradx[n] = inv * dx;
+      grady[n] = inv * dy;
+    }
+  }
+}
+
 
 //
 // display function setup
@@ -90,11 +90,15 @@ NavfnPlanner::configure(
   declare_parameter_if_not_declared(
     node, name + ".use_final_approach_orientation", rclcpp::ParameterValue(false));
   node->get_parameter(name + ".use_final_approach_orientation", use_final_approach_orientation_);
+  declare_parameter_if_not_declared(
+    node, name + ".use_bucketed_queue", rclcpp::ParameterValue(false));
+  node->get_parameter(name + ".use_bucketed_queue", use_bucketed_queue_);
 
   // Create a planner based on the new costmap size
   planner_ = std::make_unique<NavFn>(
     costmap_->getSizeInCellsX(),
     costmap_->getSizeInCellsY());
+  planner_->use_bucketed_queue = use_bucketed_queue_;
 }
 
 void
@@ -535,6 +539,11 @@ NavfnPlanner::dynamicParametersCallback(std::vector<rclcpp::Parameter> parameter
         allow_unknown_ = parameter.as_bool();
       } else if (name == name_ + ".use_final_approach_orientation") {
         use_final_approach_orientation_ = parameter.as_bool();
+      } else if (name == name_ + ".use_bucketed_queue") {
+        use_bucketed_queue_ = parameter.as_bool();
+        if (planner_) {
+          planner_->use_bucketed_queue = use_bucketed_queue_;
+        }
       }
     }
   }
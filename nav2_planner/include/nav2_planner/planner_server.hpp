@@ -27,6 +27,7 @@
 #include "nav_msgs/msg/path.hpp"
 #include "nav2_util/lifecycle_node.hpp"
 #include "nav2_msgs/action/compute_path_to_pose.hpp"
+#include "nav2_msgs/action/compute_path_to_goal_set.hpp"
 #include "nav2_msgs/action/compute_path_through_poses.hpp"
 #include "nav2_msgs/msg/costmap.hpp"
 #include "nav2_util/robot_utils.hpp"
@@ -38,9 +39,11 @@
 #include "pluginlib/class_loader.hpp"
 #include "pluginlib/class_list_macros.hpp"
 #include "nav2_core/global_planner.hpp"
+#include "nav2_core/goal_set_planner.hpp"
 #include "nav2_msgs/srv/is_path_valid.hpp"
 #include "nav2_costmap_2d/footprint_collision_checker.hpp"
 #include "nav2_core/planner_exceptions.hpp"
+#include "nav2_planner/route_cache.hpp"
 
 namespace nav2_planner
 {
@@ -78,6 +81,47 @@ public:
     const std::string & planner_id,
     std::function<bool()> cancel_checker);
 
+  /**
+   * @brief Plan the legs of a through-poses request concurrently on a pool
+   * of instances of the desired plugin and stitch the results in order.
+   * Each leg starts at the preceding viapoint rather than the end of the
+   * previous leg's path, so the legs are independent of each other.
+   * @param start starting pose
+   * @param goals viapoints to plan through
+   * @param planner_id The planner to plan with
+   * @param cancel_checker A function to check if the action has been canceled
+   * @param failed_start Set to the failing leg's start pose on error
+   * @param failed_goal Set to the failing leg's goal pose on error
+   * @return Concatenated path through the viapoints
+   */
+  nav_msgs::msg::Path getPlanThroughPosesParallel(
+    const geometry_msgs::msg::PoseStamped & start,
+    const std::vector<geometry_msgs::msg::PoseStamped> & goals,
+    const std::string & planner_id,
+    std::function<bool()> cancel_checker,
+    geometry_msgs::msg::PoseStamped & failed_start,
+    geometry_msgs::msg::PoseStamped & failed_goal);
+
+  /**
+   * @brief Plan optimally with the desired plugin only out to the receding
+   * horizon along a coarse guide path from the guide planner, and append
+   * the remaining guide path beyond it. Bounds planning latency on long
+   * missions, with the caller replanning as the robot advances.
+   * @param start starting pose
+   * @param goal goal request
+   * @param planner_id The planner to plan with inside the horizon
+   * @param cancel_checker A function to check if the action has been canceled
+   * @param horizon_index Set to the index of the first coarse pose past the
+   * horizon, 0 if the whole path was planned optimally
+   * @return Path
+   */
+  nav_msgs::msg::Path getRecedingHorizonPlan(
+    const geometry_msgs::msg::PoseStamped & start,
+    const geometry_msgs::msg::PoseStamped & goal,
+    const std::string & planner_id,
+    std::function<bool()> cancel_checker,
+    uint32_t & horizon_index);
+
 protected:
   /**
    * @brief Configure member variables and initializes planner
@@ -112,9 +156,12 @@ protected:
 
   using ActionToPose = nav2_msgs::action::ComputePathToPose;
   using ActionToPoseResult = ActionToPose::Result;
+  using ActionGoalSet = nav2_msgs::action::ComputePathToGoalSet;
+  using ActionGoalSetResult = ActionGoalSet::Result;
   using ActionThroughPoses = nav2_msgs::action::ComputePathThroughPoses;
   using ActionThroughPosesResult = ActionThroughPoses::Result;
   using ActionServerToPose = nav2_util::SimpleActionServer<ActionToPose>;
+  using ActionServerGoalSet = nav2_util::SimpleActionServer<ActionGoalSet>;
   using ActionServerThroughPoses = nav2_util::SimpleActionServer<ActionThroughPoses>;
 
   /**
@@ -139,6 +186,19 @@ protected:
    */
   void waitForCostmap();
 
+  /**
+   * @brief Region-aware variant of waitForCostmap() for a known start and goal.
+   * If the costmap activated lazily and its first full update is still running
+   * in the background, this pulls in just the area the request plans over so
+   * the first plan doesn't wait for the whole map to inflate, then waits for
+   * the costmap to become valid as usual.
+   * @param start Start pose of the pending request, in the global frame
+   * @param goal Goal pose of the pending request, in the global frame
+   */
+  void waitForCostmap(
+    const geometry_msgs::msg::PoseStamped & start,
+    const geometry_msgs::msg::PoseStamped & goal);
+
   /**
    * @brief Check if an action server has a preemption request and replaces the goal
    * with the new preemption goal.
@@ -193,6 +253,13 @@ protected:
    */
   void computePlan();
 
+  /**
+   * @brief The action server callback which calls planner to get the path
+   * ComputePathToGoalSet: one search to the cheapest of several candidate
+   * goals when the plugin supports it, sequential per-goal planning otherwise
+   */
+  void computePlanToGoalSet();
+
   /**
    * @brief The action server callback which calls planner to get the path
    * ComputePathThroughPoses
@@ -208,6 +275,115 @@ protected:
     const std::shared_ptr<nav2_msgs::srv::IsPathValid::Request> request,
     std::shared_ptr<nav2_msgs::srv::IsPathValid::Response> response);
 
+  /**
+   * @brief Per-pose results of the last isPathValid check
+   *
+   * IsPathValidCondition ticks the service at BT rate with the same path,
+   * so the per-pose cost verdicts are remembered along with the costmap
+   * update count they were computed against. On the next call only poses
+   * whose cells fall inside the costmap update bounds need a fresh cost
+   * query; on quiet cycles nothing does.
+   */
+  struct PathValidityCache
+  {
+    bool usable{false};
+    std_msgs::msg::Header path_header;
+    size_t path_size{0};
+    geometry_msgs::msg::Pose path_front;
+    geometry_msgs::msg::Pose path_back;
+    bool use_radius{true};
+    nav2_costmap_2d::Footprint footprint;
+    unsigned int update_count{0};
+    double origin_x{0.0};
+    double origin_y{0.0};
+    double resolution{0.0};
+    unsigned int size_x{0};
+    unsigned int size_y{0};
+    unsigned int first_checked{0};
+    std::vector<unsigned int> cells_x;
+    std::vector<unsigned int> cells_y;
+    std::vector<uint8_t> blocked;
+  };
+
+  /**
+   * @brief A cached path from a previous request for potential reuse
+   */
+  struct CachedPath
+  {
+    std::string planner_id;
+    geometry_msgs::msg::PoseStamped goal;
+    nav_msgs::msg::Path path;
+  };
+
+  /**
+   * @brief Look for a cached path to this goal that is still collision-free
+   * against the current costmap and starts near the requested start pose
+   * @param start starting pose
+   * @param goal goal request
+   * @param planner_id The planner the path must have been planned with
+   * @param path Set to the cached path, truncated to begin at the pose
+   * closest to start, if one was found
+   * @return bool If a valid cached path was found
+   */
+  bool tryGetCachedPath(
+    const geometry_msgs::msg::PoseStamped & start,
+    const geometry_msgs::msg::PoseStamped & goal,
+    const std::string & planner_id,
+    nav_msgs::msg::Path & path);
+
+  /**
+   * @brief Outcome of checking a previously planned path for reuse
+   */
+  enum class PathReuse
+  {
+    VALID,           ///< Collision-free, truncated path produced
+    REJECTED_START,  ///< Does not pass near the requested start
+    BLOCKED          ///< Now blocked in the costmap, evict it
+  };
+
+  /**
+   * @brief Check a previously planned path against the current costmap and,
+   * if it is still collision-free, truncate it to begin at the pose closest
+   * to the requested start. Shared by the recent-path and route caches
+   * @param cached The stored path to check
+   * @param start starting pose
+   * @param path Set to the truncated path when the check passes
+   * @return PathReuse The verdict
+   */
+  PathReuse revalidateAndTruncate(
+    const nav_msgs::msg::Path & cached,
+    const geometry_msgs::msg::PoseStamped & start,
+    nav_msgs::msg::Path & path);
+
+  /**
+   * @brief Look for a learned route for this start/goal region pair that is
+   * still collision-free against the current costmap. Routes that fail
+   * validation are dropped so a fresh plan can replace them
+   * @param start starting pose
+   * @param goal goal request
+   * @param planner_id The planner the route must have been planned with
+   * @param path Set to the stored route, truncated to begin at the pose
+   * closest to start, if one was found
+   * @return bool If a valid learned route was found
+   */
+  bool tryGetRouteCachePath(
+    const geometry_msgs::msg::PoseStamped & start,
+    const geometry_msgs::msg::PoseStamped & goal,
+    const std::string & planner_id,
+    nav_msgs::msg::Path & path);
+
+  /**
+   * @brief Store a freshly planned path for reuse by later requests,
+   * evicting the oldest entry when the cache is full
+   * @param goal goal request
+   * @param planner_id The planner the path was planned with
+   * @param path The path to cache
+   */
+  void cachePath(
+    const geometry_msgs::msg::PoseStamped & goal,
+    const std::string & planner_id,
+    const nav_msgs::msg::Path & path);
+
   /**
    * @brief Publish a path for visualization purposes
    * @param path Reference to Global Path
@@ -229,6 +405,7 @@ protected:
 
   // Our action server implements the ComputePathToPose action
   std::unique_ptr<ActionServerToPose> action_server_pose_;
+  std::unique_ptr<ActionServerGoalSet> action_server_goal_set_;
   std::unique_ptr<ActionServerThroughPoses> action_server_poses_;
 
   // Dynamic parameters handler
@@ -237,6 +414,9 @@ protected:
 
   // Planner
   PlannerMap planners_;
+  // Extra instances of each planner plugin for parallel through-poses legs
+  std::unordered_map<std::string, std::vector<nav2_core::GlobalPlanner::Ptr>> planner_pools_;
+  int through_poses_parallelism_;
   pluginlib::ClassLoader<nav2_core::GlobalPlanner> gp_loader_;
   std::vector<std::string> default_ids_;
   std::vector<std::string> default_types_;
@@ -245,6 +425,19 @@ protected:
   double max_planner_duration_;
   std::string planner_ids_concat_;
 
+  // Cache of recent paths to reuse instead of replanning when still valid
+  std::vector<CachedPath> path_cache_;
+  int path_cache_size_;
+  double path_cache_start_tolerance_;
+
+  // Learned routes for repeated station-to-station missions, keyed by
+  // quantized start/goal region pairs and optionally persisted to disk
+  RouteCache route_cache_;
+
+  // Receding-horizon planning, 0 plans full missions optimally
+  double receding_horizon_distance_;
+  std::string receding_horizon_guide_planner_;
+
   // TF buffer
   std::shared_ptr<tf2_ros::Buffer> tf_;
 
@@ -260,6 +453,7 @@ protected:
 
   // Service to determine if the path is valid
   rclcpp::Service<nav2_msgs::srv::IsPathValid>::SharedPtr is_path_valid_service_;
+  PathValidityCache validity_cache_;
 };
 
 }  // namespace nav2_planner
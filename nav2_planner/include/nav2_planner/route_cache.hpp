@@ -0,0 +1,165 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_PLANNER__ROUTE_CACHE_HPP_
+#define NAV2_PLANNER__ROUTE_CACHE_HPP_
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "geometry_msgs/msg/pose_stamped.hpp"
+#include "nav_msgs/msg/path.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+namespace nav2_planner
+{
+
+/**
+ * @class nav2_planner::RouteCache
+ * @brief Store of successful paths keyed by quantized start/goal region
+ * pairs and the planner that produced them, optionally persisted to disk.
+ * Robots that run the same station-to-station missions all day hit the same
+ * region pairs repeatedly, so a stored route that still validates against
+ * the live costmap replaces a full planner run. The cache only stores and
+ * retrieves routes; collision validation against the current costmap is the
+ * caller's job.
+ */
+class RouteCache
+{
+public:
+  RouteCache() = default;
+
+  /**
+   * @brief Configure the cache
+   * @param quantization Region edge length in meters used to quantize start
+   * and goal positions into keys, non-positive disables the cache
+   * @param file_path File to persist routes in, empty keeps the cache
+   * in memory only
+   * @param logger Logger to use
+   */
+  void configure(
+    double quantization, const std::string & file_path, const rclcpp::Logger & logger);
+
+  /**
+   * @brief Whether the cache is configured to store anything
+   */
+  bool enabled() const {return quantization_ > 0.0;}
+
+  /**
+   * @brief Look up the stored route for this start/goal region pair
+   * @param start starting pose
+   * @param goal goal pose
+   * @param planner_id The planner the route must have been planned with
+   * @param path Set to the stored route if one was found
+   * @return bool If a route for the region pair exists
+   */
+  bool lookup(
+    const geometry_msgs::msg::PoseStamped & start,
+    const geometry_msgs::msg::PoseStamped & goal,
+    const std::string & planner_id,
+    nav_msgs::msg::Path & path) const;
+
+  /**
+   * @brief Store a successful path under its start/goal region pair,
+   * replacing any previous route for the pair
+   */
+  void store(
+    const geometry_msgs::msg::PoseStamped & start,
+    const geometry_msgs::msg::PoseStamped & goal,
+    const std::string & planner_id,
+    const nav_msgs::msg::Path & path);
+
+  /**
+   * @brief Drop the stored route for this region pair, e.g. after it failed
+   * validation against the live costmap
+   */
+  void invalidate(
+    const geometry_msgs::msg::PoseStamped & start,
+    const geometry_msgs::msg::PoseStamped & goal,
+    const std::string & planner_id);
+
+  /**
+   * @brief Load routes from the configured file, replacing the current
+   * contents. A missing file is not an error, it simply means no routes
+   * have been learned yet
+   * @return bool If the file was read successfully
+   */
+  bool load();
+
+  /**
+   * @brief Persist the current routes to the configured file
+   * @return bool If the file was written successfully
+   */
+  bool save() const;
+
+  /**
+   * @brief Number of stored routes
+   */
+  size_t size() const {return routes_.size();}
+
+  /**
+   * @brief Drop all stored routes
+   */
+  void clear() {routes_.clear();}
+
+protected:
+  /**
+   * @brief A start/goal region pair and the planner that served it
+   */
+  struct RouteKey
+  {
+    int64_t start_x{0};
+    int64_t start_y{0};
+    int64_t goal_x{0};
+    int64_t goal_y{0};
+    std::string planner_id;
+
+    friend bool operator==(const RouteKey & a, const RouteKey & b)
+    {
+      return a.start_x == b.start_x && a.start_y == b.start_y &&
+             a.goal_x == b.goal_x && a.goal_y == b.goal_y &&
+             a.planner_id == b.planner_id;
+    }
+  };
+
+  struct RouteKeyHash
+  {
+    size_t operator()(const RouteKey & key) const
+    {
+      size_t seed = std::hash<std::string>()(key.planner_id);
+      for (const int64_t v : {key.start_x, key.start_y, key.goal_x, key.goal_y}) {
+        seed ^= std::hash<int64_t>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      }
+      return seed;
+    }
+  };
+
+  /**
+   * @brief Build the key for a start/goal pair under the current quantization
+   */
+  RouteKey makeKey(
+    const geometry_msgs::msg::PoseStamped & start,
+    const geometry_msgs::msg::PoseStamped & goal,
+    const std::string & planner_id) const;
+
+  std::unordered_map<RouteKey, nav_msgs::msg::Path, RouteKeyHash> routes_;
+  double quantization_{0.0};
+  std::string file_path_;
+  rclcpp::Logger logger_{rclcpp::get_logger("route_cache")};
+};
+
+}  // namespace nav2_planner
+
+#endif  // NAV2_PLANNER__ROUTE_CACHE_HPP_
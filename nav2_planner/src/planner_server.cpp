@@ -13,6 +13,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <iomanip>
@@ -21,6 +23,7 @@
 #include <iterator>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -29,6 +32,7 @@
 #include "nav2_util/costmap.hpp"
 #include "nav2_util/node_utils.hpp"
 #include "nav2_util/geometry_utils.hpp"
+#include "nav2_util/trace.hpp"
 #include "nav2_costmap_2d/cost_values.hpp"
 
 #include "nav2_planner/planner_server.hpp"
@@ -53,6 +57,27 @@ PlannerServer::PlannerServer(const rclcpp::NodeOptions & options)
   declare_parameter("planner_plugins", default_ids_);
   declare_parameter("expected_planner_frequency", 1.0);
   declare_parameter("action_server_result_timeout", 10.0);
+  // Number of instances of each planner plugin to plan through-poses legs
+  // with concurrently. Values above 1 require a plugin whose instances can
+  // plan at the same time within one process.
+  declare_parameter("through_poses_parallelism", 1);
+  // Number of recent paths to keep for reuse when a request repeats a goal
+  // and the cached path is still collision-free, 0 to always replan
+  declare_parameter("path_cache_size", 0);
+  declare_parameter("path_cache_start_tolerance", 0.5);
+  // Learned route cache for repeated station-to-station missions: successful
+  // paths are stored under their quantized start/goal region pair and reused
+  // when they still validate against the live costmap. 0 disables. Routes
+  // persist across restarts when route_cache_file is set.
+  declare_parameter("route_cache_quantization", 0.0);
+  declare_parameter("route_cache_file", std::string(""));
+  // Receding-horizon planning: plan optimally only within this distance of
+  // the robot and append a coarse guide path beyond it, bounding planning
+  // latency on long missions. 0 plans the full mission optimally.
+  declare_parameter("receding_horizon_distance", 0.0);
+  // Planner plugin to find the coarse guide path with, typically a cheap
+  // 2D search; required when receding_horizon_distance is positive
+  declare_parameter("receding_horizon_guide_planner", std::string(""));
 
   get_parameter("planner_plugins", planner_ids_);
   if (planner_ids_ == default_ids_) {
@@ -73,6 +98,7 @@ PlannerServer::~PlannerServer()
    * Backstop ensuring this state is destroyed, even if deactivate/cleanup are
    * never called.
    */
+  planner_pools_.clear();
   planners_.clear();
   costmap_thread_.reset();
 }
@@ -123,6 +149,57 @@ PlannerServer::on_configure(const rclcpp_lifecycle::State & /*state*/)
     }
   }
 
+  get_parameter("path_cache_size", path_cache_size_);
+  get_parameter("path_cache_start_tolerance", path_cache_start_tolerance_);
+  path_cache_.clear();
+
+  double route_cache_quantization = 0.0;
+  std::string route_cache_file;
+  get_parameter("route_cache_quantization", route_cache_quantization);
+  get_parameter("route_cache_file", route_cache_file);
+  route_cache_.configure(route_cache_quantization, route_cache_file, get_logger());
+  route_cache_.load();
+
+  get_parameter("receding_horizon_distance", receding_horizon_distance_);
+  get_parameter("receding_horizon_guide_planner", receding_horizon_guide_planner_);
+  if (receding_horizon_distance_ > 0.0 &&
+    planners_.find(receding_horizon_guide_planner_) == planners_.end())
+  {
+    RCLCPP_ERROR(
+      get_logger(), "receding_horizon_guide_planner %s is not a configured planner plugin",
+      receding_horizon_guide_planner_.c_str());
+    return nav2_util::CallbackReturn::FAILURE;
+  }
+
+  get_parameter("through_poses_parallelism", through_poses_parallelism_);
+  if (through_poses_parallelism_ < 1) {
+    RCLCPP_WARN(
+      get_logger(),
+      "through_poses_parallelism is %d, but must be at least 1. Planning legs sequentially.",
+      through_poses_parallelism_);
+    through_poses_parallelism_ = 1;
+  }
+
+  for (size_t i = 0; through_poses_parallelism_ > 1 && i != planner_ids_.size(); i++) {
+    try {
+      for (int j = 1; j < through_poses_parallelism_; j++) {
+        nav2_core::GlobalPlanner::Ptr planner =
+          gp_loader_.createUniqueInstance(planner_types_[i]);
+        planner->configure(node, planner_ids_[i], tf_, costmap_ros_);
+        planner_pools_[planner_ids_[i]].push_back(planner);
+      }
+      RCLCPP_INFO(
+        get_logger(), "Created %d instances of global planner plugin %s"
+        " for parallel through-poses planning",
+        through_poses_parallelism_, planner_ids_[i].c_str());
+    } catch (const std::exception & ex) {
+      RCLCPP_FATAL(
+        get_logger(), "Failed to create global planner. Exception: %s",
+        ex.what());
+      return nav2_util::CallbackReturn::FAILURE;
+    }
+  }
+
   for (size_t i = 0; i != planner_ids_.size(); i++) {
     planner_ids_concat_ += planner_ids_[i] + std::string(" ");
   }
@@ -160,6 +237,14 @@ PlannerServer::on_configure(const rclcpp_lifecycle::State & /*state*/)
     std::chrono::milliseconds(500),
     true, server_options);
 
+  action_server_goal_set_ = std::make_unique<ActionServerGoalSet>(
+    shared_from_this(),
+    "compute_path_to_goal_set",
+    std::bind(&PlannerServer::computePlanToGoalSet, this),
+    nullptr,
+    std::chrono::milliseconds(500),
+    true, server_options);
+
   action_server_poses_ = std::make_unique<ActionServerThroughPoses>(
     shared_from_this(),
     "compute_path_through_poses",
@@ -178,17 +263,28 @@ PlannerServer::on_activate(const rclcpp_lifecycle::State & /*state*/)
 
   plan_publisher_->on_activate();
   action_server_pose_->activate();
+  action_server_goal_set_->activate();
   action_server_poses_->activate();
   const auto costmap_ros_state = costmap_ros_->activate();
   if (costmap_ros_state.id() != lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE) {
     return nav2_util::CallbackReturn::FAILURE;
   }
 
+  // Start producing lock-free costmap snapshots now, so the planners can
+  // already grab one on the first plan request
+  costmap_ros_->getCostmapSnapshot();
+
   PlannerMap::iterator it;
   for (it = planners_.begin(); it != planners_.end(); ++it) {
     it->second->activate();
   }
 
+  for (auto & pool : planner_pools_) {
+    for (auto & planner : pool.second) {
+      planner->activate();
+    }
+  }
+
   auto node = shared_from_this();
 
   is_path_valid_service_ = node->create_service<nav2_msgs::srv::IsPathValid>(
@@ -213,6 +309,7 @@ PlannerServer::on_deactivate(const rclcpp_lifecycle::State & /*state*/)
   RCLCPP_INFO(get_logger(), "Deactivating");
 
   action_server_pose_->deactivate();
+  action_server_goal_set_->deactivate();
   action_server_poses_->deactivate();
   plan_publisher_->on_deactivate();
 
@@ -230,8 +327,17 @@ PlannerServer::on_deactivate(const rclcpp_lifecycle::State & /*state*/)
     it->second->deactivate();
   }
 
+  for (auto & pool : planner_pools_) {
+    for (auto & planner : pool.second) {
+      planner->deactivate();
+    }
+  }
+
   dyn_params_handler_.reset();
 
+  // keep the routes learned this session for the next one
+  route_cache_.save();
+
   // destroy bond connection
   destroyBond();
 
@@ -244,6 +350,7 @@ PlannerServer::on_cleanup(const rclcpp_lifecycle::State & /*state*/)
   RCLCPP_INFO(get_logger(), "Cleaning up");
 
   action_server_pose_.reset();
+  action_server_goal_set_.reset();
   action_server_poses_.reset();
   plan_publisher_.reset();
   tf_.reset();
@@ -255,7 +362,16 @@ PlannerServer::on_cleanup(const rclcpp_lifecycle::State & /*state*/)
     it->second->cleanup();
   }
 
+  for (auto & pool : planner_pools_) {
+    for (auto & planner : pool.second) {
+      planner->cleanup();
+    }
+  }
+
+  planner_pools_.clear();
   planners_.clear();
+  path_cache_.clear();
+  route_cache_.clear();
   costmap_thread_.reset();
   costmap_ = nullptr;
   return nav2_util::CallbackReturn::SUCCESS;
@@ -289,6 +405,27 @@ void PlannerServer::waitForCostmap()
   }
 }
 
+void PlannerServer::waitForCostmap(
+  const geometry_msgs::msg::PoseStamped & start,
+  const geometry_msgs::msg::PoseStamped & goal)
+{
+  if (!costmap_ros_->isCurrent()) {
+    // If the costmap activated lazily and its first full update is still
+    // running in the background, pull in just the area this request plans
+    // over. Searches can spill past the straight-line box, so pad it
+    // generously; once the first full update has run this is a no-op.
+    const double pad = std::max(
+      10.0, 0.5 * nav2_util::geometry_utils::euclidean_distance(start, goal));
+    costmap_ros_->updateMapRegion(
+      std::min(start.pose.position.x, goal.pose.position.x) - pad,
+      std::min(start.pose.position.y, goal.pose.position.y) - pad,
+      std::max(start.pose.position.x, goal.pose.position.x) + pad,
+      std::max(start.pose.position.y, goal.pose.position.y) + pad);
+  }
+
+  waitForCostmap();
+}
+
 template<typename T>
 bool PlannerServer::isCancelRequested(
   std::unique_ptr<nav2_util::SimpleActionServer<T>> & action_server)
@@ -398,37 +535,43 @@ void PlannerServer::computePlanThroughPoses()
         return action_server_poses_->is_cancel_requested();
       };
 
-    // Get consecutive paths through these points
-    for (unsigned int i = 0; i != goal->goals.size(); i++) {
-      // Get starting point
-      if (i == 0) {
-        curr_start = start;
-      } else {
-        // pick the end of the last planning task as the start for the next one
-        // to allow for path tolerance deviations
-        curr_start = concat_path.poses.back();
-        curr_start.header = concat_path.header;
-      }
-      curr_goal = goal->goals[i];
+    if (through_poses_parallelism_ > 1 && goal->goals.size() > 1) {
+      // Plan the legs concurrently on the pool of planner instances
+      concat_path = getPlanThroughPosesParallel(
+        start, goal->goals, goal->planner_id, cancel_checker, curr_start, curr_goal);
+    } else {
+      // Get consecutive paths through these points
+      for (unsigned int i = 0; i != goal->goals.size(); i++) {
+        // Get starting point
+        if (i == 0) {
+          curr_start = start;
+        } else {
+          // pick the end of the last planning task as the start for the next one
+          // to allow for path tolerance deviations
+          curr_start = concat_path.poses.back();
+          curr_start.header = concat_path.header;
+        }
+        curr_goal = goal->goals[i];
 
-      // Transform them into the global frame
-      if (!transformPosesToGlobalFrame(curr_start, curr_goal)) {
-        throw nav2_core::PlannerTFError("Unable to transform poses to global frame");
-      }
+        // Transform them into the global frame
+        if (!transformPosesToGlobalFrame(curr_start, curr_goal)) {
+          throw nav2_core::PlannerTFError("Unable to transform poses to global frame");
+        }
 
-      // Get plan from start -> goal
-      nav_msgs::msg::Path curr_path = getPlan(
-        curr_start, curr_goal, goal->planner_id,
-        cancel_checker);
+        // Get plan from start -> goal
+        nav_msgs::msg::Path curr_path = getPlan(
+          curr_start, curr_goal, goal->planner_id,
+          cancel_checker);
 
-      if (!validatePath<ActionThroughPoses>(curr_goal, curr_path, goal->planner_id)) {
-        throw nav2_core::NoValidPathCouldBeFound(goal->planner_id + " generated a empty path");
-      }
+        if (!validatePath<ActionThroughPoses>(curr_goal, curr_path, goal->planner_id)) {
+          throw nav2_core::NoValidPathCouldBeFound(goal->planner_id + " generated a empty path");
+        }
 
-      // Concatenate paths together
-      concat_path.poses.insert(
-        concat_path.poses.end(), curr_path.poses.begin(), curr_path.poses.end());
-      concat_path.header = curr_path.header;
+        // Concatenate paths together
+        concat_path.poses.insert(
+          concat_path.poses.end(), curr_path.poses.begin(), curr_path.poses.end());
+        concat_path.header = curr_path.header;
+      }
     }
 
     // Publish the plan for visualization purposes
@@ -497,6 +640,10 @@ PlannerServer::computePlan()
 {
   std::lock_guard<std::mutex> lock(dynamic_params_lock_);
 
+  NAV2_TRACE(
+    "planner", "compute_plan_begin",
+    costmap_ros_->getLayeredCostmap()->getUpdateCount());
+
   auto start_time = this->now();
 
   // Initialize the ComputePathToPose goal and result
@@ -510,8 +657,6 @@ PlannerServer::computePlan()
       return;
     }
 
-    waitForCostmap();
-
     getPreemptedGoalIfRequested(action_server_pose_, goal);
 
     // Use start pose if provided otherwise use current robot pose
@@ -525,11 +670,22 @@ PlannerServer::computePlan()
       throw nav2_core::PlannerTFError("Unable to transform poses to global frame");
     }
 
+    // Now that the request's region is known, the wait can be region-aware
+    waitForCostmap(start, goal_pose);
+
     auto cancel_checker = [this]() {
         return action_server_pose_->is_cancel_requested();
       };
 
-    result->path = getPlan(start, goal_pose, goal->planner_id, cancel_checker);
+    if (receding_horizon_distance_ > 0.0 &&
+      nav2_util::geometry_utils::euclidean_distance(start, goal_pose) >
+      receding_horizon_distance_)
+    {
+      result->path = getRecedingHorizonPlan(
+        start, goal_pose, goal->planner_id, cancel_checker, result->horizon_index);
+    } else {
+      result->path = getPlan(start, goal_pose, goal->planner_id, cancel_checker);
+    }
 
     if (!validatePath<ActionThroughPoses>(goal_pose, result->path, goal->planner_id)) {
       throw nav2_core::NoValidPathCouldBeFound(goal->planner_id + " generated a empty path");
@@ -547,6 +703,10 @@ PlannerServer::computePlan()
         "Planner loop missed its desired rate of %.4f Hz. Current loop rate is %.4f Hz",
         1 / max_planner_duration_, 1 / cycle_duration.seconds());
     }
+    NAV2_TRACE(
+      "planner", "compute_plan_end",
+      costmap_ros_->getLayeredCostmap()->getUpdateCount());
+
     action_server_pose_->succeeded_current(result);
   } catch (nav2_core::InvalidPlanner & ex) {
     exceptionWarning(start, goal->goal, goal->planner_id, ex);
@@ -590,6 +750,180 @@ PlannerServer::computePlan()
   }
 }
 
+void
+PlannerServer::computePlanToGoalSet()
+{
+  std::lock_guard<std::mutex> lock(dynamic_params_lock_);
+
+  auto start_time = this->now();
+
+  // Initialize the ComputePathToGoalSet goal and result
+  auto goal = action_server_goal_set_->get_current_goal();
+  auto result = std::make_shared<ActionGoalSet::Result>();
+  result->best_goal_index = -1;
+
+  geometry_msgs::msg::PoseStamped start;
+  geometry_msgs::msg::PoseStamped first_goal;
+
+  try {
+    if (isServerInactive(action_server_goal_set_) || isCancelRequested(action_server_goal_set_)) {
+      return;
+    }
+
+    waitForCostmap();
+
+    getPreemptedGoalIfRequested(action_server_goal_set_, goal);
+
+    if (goal->goals.empty()) {
+      throw nav2_core::NoViapointsGiven("No goal candidates given");
+    }
+    first_goal = goal->goals.front();
+
+    // Use start pose if provided otherwise use current robot pose
+    if (!getStartPose<ActionGoalSet>(goal, start)) {
+      throw nav2_core::PlannerTFError("Unable to get start pose");
+    }
+
+    // Transform start and all candidates into the global frame
+    std::vector<geometry_msgs::msg::PoseStamped> goals = goal->goals;
+    if (!costmap_ros_->transformPoseToGlobalFrame(start, start)) {
+      throw nav2_core::PlannerTFError("Unable to transform poses to global frame");
+    }
+    for (auto & candidate : goals) {
+      if (!costmap_ros_->transformPoseToGlobalFrame(candidate, candidate)) {
+        throw nav2_core::PlannerTFError("Unable to transform poses to global frame");
+      }
+    }
+
+    auto cancel_checker = [this]() {
+        return action_server_goal_set_->is_cancel_requested();
+      };
+
+    // Resolve the planner plugin to use
+    std::string planner_id = goal->planner_id;
+    if (planners_.find(planner_id) == planners_.end()) {
+      if (planners_.size() == 1 && planner_id.empty()) {
+        RCLCPP_WARN_ONCE(
+          get_logger(), "No planners specified in action call. "
+          "Server will use only plugin %s in server."
+          " This warning will appear once.", planner_ids_concat_.c_str());
+        planner_id = planners_.begin()->first;
+      } else {
+        RCLCPP_ERROR(
+          get_logger(), "planner %s is not a valid planner. "
+          "Planner names are: %s", planner_id.c_str(),
+          planner_ids_concat_.c_str());
+        throw nav2_core::InvalidPlanner("Planner id " + planner_id + " is invalid");
+      }
+    }
+
+    int best_goal_index = -1;
+    std::vector<float> goal_costs(goals.size(), -1.0f);
+    auto goal_set_planner =
+      dynamic_cast<nav2_core::GoalSetPlanner *>(planners_[planner_id].get());
+    if (goal_set_planner) {
+      // One search serves the whole candidate set
+      result->path = goal_set_planner->createPlanToGoalSet(
+        start, goals, cancel_checker, best_goal_index, goal_costs);
+    } else {
+      // Fall back to one full search per candidate, keeping the shortest
+      float best_cost = std::numeric_limits<float>::max();
+      for (unsigned int i = 0; i != goals.size(); i++) {
+        nav_msgs::msg::Path candidate_path;
+        try {
+          candidate_path =
+            planners_[planner_id]->createPlan(start, goals[i], cancel_checker);
+        } catch (nav2_core::PlannerCancelled &) {
+          throw;
+        } catch (nav2_core::PlannerException &) {
+          continue;
+        }
+        if (candidate_path.poses.empty()) {
+          continue;
+        }
+        const float cost = static_cast<float>(
+          nav2_util::geometry_utils::calculate_path_length(candidate_path));
+        goal_costs[i] = cost;
+        if (cost < best_cost) {
+          best_cost = cost;
+          best_goal_index = static_cast<int>(i);
+          result->path = candidate_path;
+        }
+      }
+      if (best_goal_index < 0) {
+        throw nav2_core::NoValidPathCouldBeFound(
+                planner_id + " failed to generate a path to any goal candidate");
+      }
+    }
+
+    result->best_goal_index = static_cast<int16_t>(best_goal_index);
+    result->goal_costs = goal_costs;
+
+    const geometry_msgs::msg::PoseStamped & best_goal =
+      best_goal_index >= 0 ? goals[best_goal_index] : goals.front();
+    if (!validatePath<ActionGoalSet>(best_goal, result->path, planner_id)) {
+      throw nav2_core::NoValidPathCouldBeFound(planner_id + " generated a empty path");
+    }
+
+    // Publish the plan for visualization purposes
+    publishPlan(result->path);
+
+    auto cycle_duration = this->now() - start_time;
+    result->planning_time = cycle_duration;
+
+    if (max_planner_duration_ && cycle_duration.seconds() > max_planner_duration_) {
+      RCLCPP_WARN(
+        get_logger(),
+        "Planner loop missed its desired rate of %.4f Hz. Current loop rate is %.4f Hz",
+        1 / max_planner_duration_, 1 / cycle_duration.seconds());
+    }
+    action_server_goal_set_->succeeded_current(result);
+  } catch (nav2_core::InvalidPlanner & ex) {
+    exceptionWarning(start, first_goal, goal->planner_id, ex);
+    result->error_code = ActionGoalSetResult::INVALID_PLANNER;
+    action_server_goal_set_->terminate_current(result);
+  } catch (nav2_core::StartOccupied & ex) {
+    exceptionWarning(start, first_goal, goal->planner_id, ex);
+    result->error_code = ActionGoalSetResult::START_OCCUPIED;
+    action_server_goal_set_->terminate_current(result);
+  } catch (nav2_core::GoalOccupied & ex) {
+    exceptionWarning(start, first_goal, goal->planner_id, ex);
+    result->error_code = ActionGoalSetResult::GOAL_OCCUPIED;
+    action_server_goal_set_->terminate_current(result);
+  } catch (nav2_core::NoValidPathCouldBeFound & ex) {
+    exceptionWarning(start, first_goal, goal->planner_id, ex);
+    result->error_code = ActionGoalSetResult::NO_VALID_PATH;
+    action_server_goal_set_->terminate_current(result);
+  } catch (nav2_core::PlannerTimedOut & ex) {
+    exceptionWarning(start, first_goal, goal->planner_id, ex);
+    result->error_code = ActionGoalSetResult::TIMEOUT;
+    action_server_goal_set_->terminate_current(result);
+  } catch (nav2_core::StartOutsideMapBounds & ex) {
+    exceptionWarning(start, first_goal, goal->planner_id, ex);
+    result->error_code = ActionGoalSetResult::START_OUTSIDE_MAP;
+    action_server_goal_set_->terminate_current(result);
+  } catch (nav2_core::GoalOutsideMapBounds & ex) {
+    exceptionWarning(start, first_goal, goal->planner_id, ex);
+    result->error_code = ActionGoalSetResult::GOAL_OUTSIDE_MAP;
+    action_server_goal_set_->terminate_current(result);
+  } catch (nav2_core::PlannerTFError & ex) {
+    exceptionWarning(start, first_goal, goal->planner_id, ex);
+    result->error_code = ActionGoalSetResult::TF_ERROR;
+    action_server_goal_set_->terminate_current(result);
+  } catch (nav2_core::NoViapointsGiven & ex) {
+    exceptionWarning(start, first_goal, goal->planner_id, ex);
+    result->error_code = ActionGoalSetResult::NO_GOALS_GIVEN;
+    action_server_goal_set_->terminate_current(result);
+  } catch (nav2_core::PlannerCancelled &) {
+    RCLCPP_INFO(get_logger(), "Goal was canceled. Canceling planning action.");
+    action_server_goal_set_->terminate_all();
+  } catch (std::exception & ex) {
+    exceptionWarning(start, first_goal, goal->planner_id, ex);
+    result->error_code = ActionGoalSetResult::UNKNOWN;
+    action_server_goal_set_->terminate_current(result);
+  }
+}
+
 nav_msgs::msg::Path
 PlannerServer::getPlan(
   const geometry_msgs::msg::PoseStamped & start,
@@ -603,14 +937,38 @@ PlannerServer::getPlan(
     goal.pose.position.x, goal.pose.position.y);
 
   if (planners_.find(planner_id) != planners_.end()) {
-    return planners_[planner_id]->createPlan(start, goal, cancel_checker);
+    nav_msgs::msg::Path path;
+    if (tryGetCachedPath(start, goal, planner_id, path)) {
+      return path;
+    }
+    if (tryGetRouteCachePath(start, goal, planner_id, path)) {
+      return path;
+    }
+
+    path = planners_[planner_id]->createPlan(start, goal, cancel_checker);
+    cachePath(goal, planner_id, path);
+    route_cache_.store(start, goal, planner_id, path);
+    return path;
   } else {
     if (planners_.size() == 1 && planner_id.empty()) {
       RCLCPP_WARN_ONCE(
         get_logger(), "No planners specified in action call. "
         "Server will use only plugin %s in server."
         " This warning will appear once.", planner_ids_concat_.c_str());
-      return planners_[planners_.begin()->first]->createPlan(start, goal, cancel_checker);
+
+      const std::string & default_id = planners_.begin()->first;
+      nav_msgs::msg::Path path;
+      if (tryGetCachedPath(start, goal, default_id, path)) {
+        return path;
+      }
+      if (tryGetRouteCachePath(start, goal, default_id, path)) {
+        return path;
+      }
+
+      path = planners_[default_id]->createPlan(start, goal, cancel_checker);
+      cachePath(goal, default_id, path);
+      route_cache_.store(start, goal, default_id, path);
+      return path;
     } else {
       RCLCPP_ERROR(
         get_logger(), "planner %s is not a valid planner. "
@@ -623,6 +981,333 @@ PlannerServer::getPlan(
   return nav_msgs::msg::Path();
 }
 
+nav_msgs::msg::Path
+PlannerServer::getRecedingHorizonPlan(
+  const geometry_msgs::msg::PoseStamped & start,
+  const geometry_msgs::msg::PoseStamped & goal,
+  const std::string & planner_id,
+  std::function<bool()> cancel_checker,
+  uint32_t & horizon_index)
+{
+  using nav2_util::geometry_utils::euclidean_distance;
+
+  // Find a coarse guide path over the whole mission with the cheap planner
+  nav_msgs::msg::Path guide_path =
+    getPlan(start, goal, receding_horizon_guide_planner_, cancel_checker);
+
+  // Walk the guide path out to the horizon to pick the intermediate goal
+  double traveled = 0.0;
+  size_t boundary = 0;
+  while (boundary + 1 < guide_path.poses.size() && traveled < receding_horizon_distance_) {
+    traveled += euclidean_distance(guide_path.poses[boundary], guide_path.poses[boundary + 1]);
+    boundary++;
+  }
+
+  // The guide path ran out before the horizon; plan the mission optimally
+  if (boundary + 1 >= guide_path.poses.size()) {
+    horizon_index = 0;
+    return getPlan(start, goal, planner_id, cancel_checker);
+  }
+
+  // Orient the horizon goal along the guide path so SE2 planners hand
+  // over to the next cycle's plan smoothly
+  geometry_msgs::msg::PoseStamped horizon_goal = guide_path.poses[boundary];
+  horizon_goal.header = guide_path.header;
+  horizon_goal.pose.orientation = nav2_util::geometry_utils::orientationAroundZAxis(
+    atan2(
+      guide_path.poses[boundary + 1].pose.position.y - horizon_goal.pose.position.y,
+      guide_path.poses[boundary + 1].pose.position.x - horizon_goal.pose.position.x));
+
+  // Optimal path up to the horizon, coarse guide path beyond it
+  nav_msgs::msg::Path path = getPlan(start, horizon_goal, planner_id, cancel_checker);
+  horizon_index = path.poses.size();
+  path.poses.insert(
+    path.poses.end(), guide_path.poses.begin() + boundary + 1, guide_path.poses.end());
+  return path;
+}
+
+nav_msgs::msg::Path
+PlannerServer::getPlanThroughPosesParallel(
+  const geometry_msgs::msg::PoseStamped & start,
+  const std::vector<geometry_msgs::msg::PoseStamped> & goals,
+  const std::string & planner_id,
+  std::function<bool()> cancel_checker,
+  geometry_msgs::msg::PoseStamped & failed_start,
+  geometry_msgs::msg::PoseStamped & failed_goal)
+{
+  std::string id = planner_id;
+  if (planners_.find(id) == planners_.end()) {
+    if (planners_.size() == 1 && id.empty()) {
+      RCLCPP_WARN_ONCE(
+        get_logger(), "No planners specified in action call. "
+        "Server will use only plugin %s in server."
+        " This warning will appear once.", planner_ids_concat_.c_str());
+      id = planners_.begin()->first;
+    } else {
+      RCLCPP_ERROR(
+        get_logger(), "planner %s is not a valid planner. "
+        "Planner names are: %s", planner_id.c_str(),
+        planner_ids_concat_.c_str());
+      throw nav2_core::InvalidPlanner("Planner id " + planner_id + " is invalid");
+    }
+  }
+
+  // Each leg starts at the preceding viapoint so no leg depends on the
+  // path of another; transform all of them up front
+  std::vector<geometry_msgs::msg::PoseStamped> leg_starts(goals.size());
+  std::vector<geometry_msgs::msg::PoseStamped> leg_goals(goals.size());
+  for (unsigned int i = 0; i != goals.size(); i++) {
+    leg_starts[i] = i == 0 ? start : goals[i - 1];
+    leg_goals[i] = goals[i];
+    if (!transformPosesToGlobalFrame(leg_starts[i], leg_goals[i])) {
+      failed_start = leg_starts[i];
+      failed_goal = leg_goals[i];
+      throw nav2_core::PlannerTFError("Unable to transform poses to global frame");
+    }
+  }
+
+  std::vector<nav2_core::GlobalPlanner::Ptr> instances;
+  instances.push_back(planners_[id]);
+  for (auto & planner : planner_pools_[id]) {
+    instances.push_back(planner);
+  }
+
+  const unsigned int num_workers =
+    std::min(static_cast<unsigned int>(instances.size()),
+      static_cast<unsigned int>(goals.size()));
+  std::vector<nav_msgs::msg::Path> leg_paths(goals.size());
+  std::vector<std::exception_ptr> leg_errors(goals.size());
+  std::atomic<unsigned int> next_leg{0};
+  std::atomic<bool> abort{false};
+
+  // Once any leg fails, stop the others early through their cancel checkers
+  auto worker_cancel_checker = [&abort, cancel_checker]() {
+      return abort.load() || cancel_checker();
+    };
+
+  std::vector<std::thread> workers;
+  for (unsigned int w = 0; w != num_workers; w++) {
+    workers.emplace_back(
+      [&, w]() {
+        unsigned int i;
+        while ((i = next_leg++) < goals.size() && !abort.load()) {
+          try {
+            leg_paths[i] = instances[w]->createPlan(
+              leg_starts[i], leg_goals[i], worker_cancel_checker);
+          } catch (nav2_core::PlannerCancelled &) {
+            // Only a cancellation of the action itself is an error of this
+            // leg; one triggered by another leg's failure is not
+            if (cancel_checker()) {
+              leg_errors[i] = std::current_exception();
+              abort = true;
+            }
+          } catch (...) {
+            leg_errors[i] = std::current_exception();
+            abort = true;
+          }
+        }
+      });
+  }
+
+  for (auto & worker : workers) {
+    worker.join();
+  }
+
+  for (unsigned int i = 0; i != goals.size(); i++) {
+    if (leg_errors[i]) {
+      failed_start = leg_starts[i];
+      failed_goal = leg_goals[i];
+      std::rethrow_exception(leg_errors[i]);
+    }
+  }
+
+  // Stitch the legs back together in order
+  nav_msgs::msg::Path concat_path;
+  for (unsigned int i = 0; i != goals.size(); i++) {
+    if (!validatePath<ActionThroughPoses>(leg_goals[i], leg_paths[i], id)) {
+      failed_start = leg_starts[i];
+      failed_goal = leg_goals[i];
+      throw nav2_core::NoValidPathCouldBeFound(id + " generated a empty path");
+    }
+
+    concat_path.poses.insert(
+      concat_path.poses.end(), leg_paths[i].poses.begin(), leg_paths[i].poses.end());
+    concat_path.header = leg_paths[i].header;
+  }
+
+  return concat_path;
+}
+
+bool PlannerServer::tryGetCachedPath(
+  const geometry_msgs::msg::PoseStamped & start,
+  const geometry_msgs::msg::PoseStamped & goal,
+  const std::string & planner_id,
+  nav_msgs::msg::Path & path)
+{
+  if (path_cache_size_ < 1) {
+    return false;
+  }
+
+  auto same_pose = [](const geometry_msgs::msg::Pose & a, const geometry_msgs::msg::Pose & b) {
+      return std::abs(a.position.x - b.position.x) < 1e-6 &&
+             std::abs(a.position.y - b.position.y) < 1e-6 &&
+             std::abs(a.orientation.z - b.orientation.z) < 1e-6 &&
+             std::abs(a.orientation.w - b.orientation.w) < 1e-6;
+    };
+
+  auto entry = path_cache_.begin();
+  for (; entry != path_cache_.end(); ++entry) {
+    if (entry->planner_id == planner_id && same_pose(entry->goal.pose, goal.pose)) {
+      break;
+    }
+  }
+
+  if (entry == path_cache_.end()) {
+    return false;
+  }
+
+  switch (revalidateAndTruncate(entry->path, start, path)) {
+    case PathReuse::BLOCKED:
+      path_cache_.erase(entry);
+      return false;
+    case PathReuse::REJECTED_START:
+      return false;
+    case PathReuse::VALID:
+      break;
+  }
+
+  RCLCPP_DEBUG(
+    get_logger(), "Reusing cached path of %s to (%.2f, %.2f)",
+    planner_id.c_str(), goal.pose.position.x, goal.pose.position.y);
+  return true;
+}
+
+PlannerServer::PathReuse
+PlannerServer::revalidateAndTruncate(
+  const nav_msgs::msg::Path & cached,
+  const geometry_msgs::msg::PoseStamped & start,
+  nav_msgs::msg::Path & path)
+{
+  // Reuse is only meaningful if the cached path passes near the new start
+  float closest_distance = std::numeric_limits<float>::max();
+  unsigned int closest_point_index = 0;
+  for (unsigned int i = 0; i < cached.poses.size(); ++i) {
+    float current_distance = nav2_util::geometry_utils::euclidean_distance(
+      start.pose.position, cached.poses[i].pose.position);
+    if (current_distance < closest_distance) {
+      closest_point_index = i;
+      closest_distance = current_distance;
+    }
+  }
+
+  if (closest_distance > path_cache_start_tolerance_) {
+    return PathReuse::REJECTED_START;
+  }
+
+  // Check the remainder of the cached path against the current costmap,
+  // with the same lethal check the IsPathValid service applies. Validation
+  // reads the lock-free snapshot when one exists, taking the costmap lock
+  // only before the first update cycle has completed.
+  std::shared_ptr<const nav2_costmap_2d::Costmap2D> snapshot =
+    costmap_ros_->getCostmapSnapshot();
+  nav2_costmap_2d::Costmap2D * costmap = snapshot ?
+    const_cast<nav2_costmap_2d::Costmap2D *>(snapshot.get()) : costmap_;
+  std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock(
+    *(costmap_->getMutex()), std::defer_lock);
+  if (!snapshot) {
+    lock.lock();
+  }
+  nav2_costmap_2d::FootprintCollisionChecker<nav2_costmap_2d::Costmap2D *>
+  checker(costmap);
+  unsigned int mx = 0;
+  unsigned int my = 0;
+  bool use_radius = costmap_ros_->getUseRadius();
+
+  unsigned int cost = nav2_costmap_2d::FREE_SPACE;
+  for (unsigned int i = closest_point_index; i < cached.poses.size(); ++i) {
+    auto & position = cached.poses[i].pose.position;
+    if (use_radius) {
+      if (costmap->worldToMap(position.x, position.y, mx, my)) {
+        cost = costmap->getCost(mx, my);
+      } else {
+        cost = nav2_costmap_2d::LETHAL_OBSTACLE;
+      }
+    } else {
+      nav2_costmap_2d::Footprint footprint = costmap_ros_->getRobotFootprint();
+      auto theta = tf2::getYaw(cached.poses[i].pose.orientation);
+      cost = static_cast<unsigned int>(checker.footprintCostAtPose(
+          position.x, position.y, theta, footprint));
+    }
+
+    if (use_radius &&
+      (cost == nav2_costmap_2d::LETHAL_OBSTACLE ||
+      cost == nav2_costmap_2d::INSCRIBED_INFLATED_OBSTACLE))
+    {
+      return PathReuse::BLOCKED;
+    } else if (cost == nav2_costmap_2d::LETHAL_OBSTACLE) {
+      return PathReuse::BLOCKED;
+    }
+  }
+
+  path.header = cached.header;
+  path.header.stamp = now();
+  path.poses.assign(
+    cached.poses.begin() + closest_point_index, cached.poses.end());
+  return PathReuse::VALID;
+}
+
+bool PlannerServer::tryGetRouteCachePath(
+  const geometry_msgs::msg::PoseStamped & start,
+  const geometry_msgs::msg::PoseStamped & goal,
+  const std::string & planner_id,
+  nav_msgs::msg::Path & path)
+{
+  nav_msgs::msg::Path stored;
+  if (!route_cache_.lookup(start, goal, planner_id, stored)) {
+    return false;
+  }
+
+  switch (revalidateAndTruncate(stored, start, path)) {
+    case PathReuse::BLOCKED:
+      // the world changed along this route, relearn it from a fresh plan
+      route_cache_.invalidate(start, goal, planner_id);
+      return false;
+    case PathReuse::REJECTED_START:
+      return false;
+    case PathReuse::VALID:
+      break;
+  }
+
+  RCLCPP_DEBUG(
+    get_logger(), "Reusing learned route of %s to (%.2f, %.2f)",
+    planner_id.c_str(), goal.pose.position.x, goal.pose.position.y);
+  return true;
+}
+
+void PlannerServer::cachePath(
+  const geometry_msgs::msg::PoseStamped & goal,
+  const std::string & planner_id,
+  const nav_msgs::msg::Path & path)
+{
+  if (path_cache_size_ < 1 || path.poses.empty()) {
+    return;
+  }
+
+  for (auto & entry : path_cache_) {
+    if (entry.planner_id == planner_id && entry.goal.pose == goal.pose) {
+      entry.goal = goal;
+      entry.path = path;
+      return;
+    }
+  }
+
+  if (path_cache_.size() >= static_cast<size_t>(path_cache_size_)) {
+    path_cache_.erase(path_cache_.begin());
+  }
+
+  path_cache_.push_back({planner_id, goal, path});
+}
+
 void
 PlannerServer::publishPlan(const nav_msgs::msg::Path & path)
 {
@@ -668,34 +1353,108 @@ void PlannerServer::isPathValid(
      * the footprint.
      */
     std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock(*(costmap_->getMutex()));
-    unsigned int mx = 0;
-    unsigned int my = 0;
 
     bool use_radius = costmap_ros_->getUseRadius();
+    auto layered_costmap = costmap_ros_->getLayeredCostmap();
+    const unsigned int update_count = layered_costmap->getUpdateCount();
+    const unsigned int path_size = request->path.poses.size();
+    nav2_costmap_2d::Footprint footprint;
+    if (!use_radius) {
+      footprint = costmap_ros_->getRobotFootprint();
+    }
 
-    unsigned int cost = nav2_costmap_2d::FREE_SPACE;
-    for (unsigned int i = closest_point_index; i < request->path.poses.size(); ++i) {
-      auto & position = request->path.poses[i].pose.position;
-      if (use_radius) {
-        if (costmap_->worldToMap(position.x, position.y, mx, my)) {
-          cost = costmap_->getCost(mx, my);
-        } else {
+    // Query the cost under one pose and remember its cell and verdict
+    auto check_pose = [&](unsigned int i) {
+        auto & position = request->path.poses[i].pose.position;
+        unsigned int mx = 0;
+        unsigned int my = 0;
+        unsigned int cost = nav2_costmap_2d::FREE_SPACE;
+        if (!costmap_->worldToMap(position.x, position.y, mx, my)) {
+          mx = 0;
+          my = 0;
           cost = nav2_costmap_2d::LETHAL_OBSTACLE;
+        } else if (use_radius) {
+          cost = costmap_->getCost(mx, my);
         }
-      } else {
-        nav2_costmap_2d::Footprint footprint = costmap_ros_->getRobotFootprint();
-        auto theta = tf2::getYaw(request->path.poses[i].pose.orientation);
-        cost = static_cast<unsigned int>(collision_checker_->footprintCostAtPose(
-            position.x, position.y, theta, footprint));
+        if (!use_radius && cost != nav2_costmap_2d::LETHAL_OBSTACLE) {
+          auto theta = tf2::getYaw(request->path.poses[i].pose.orientation);
+          cost = static_cast<unsigned int>(collision_checker_->footprintCostAtPose(
+              position.x, position.y, theta, footprint));
+        }
+        validity_cache_.cells_x[i] = mx;
+        validity_cache_.cells_y[i] = my;
+        validity_cache_.blocked[i] =
+          cost == nav2_costmap_2d::LETHAL_OBSTACLE ||
+          (use_radius && cost == nav2_costmap_2d::INSCRIBED_INFLATED_OBSTACLE);
+      };
+
+    /**
+     * IsPathValidCondition ticks this service at BT rate with the same path,
+     * so the previous per-pose verdicts are reusable whenever the path and
+     * the costmap geometry are unchanged and at most one map update happened
+     * since: with zero updates every verdict still holds, with exactly one
+     * the update bounds tell us which poses need a fresh cost query.
+     */
+    bool cache_usable = validity_cache_.usable &&
+      validity_cache_.use_radius == use_radius &&
+      validity_cache_.path_size == path_size &&
+      validity_cache_.path_header == request->path.header &&
+      validity_cache_.path_front == request->path.poses.front().pose &&
+      validity_cache_.path_back == request->path.poses.back().pose &&
+      validity_cache_.origin_x == costmap_->getOriginX() &&
+      validity_cache_.origin_y == costmap_->getOriginY() &&
+      validity_cache_.resolution == costmap_->getResolution() &&
+      validity_cache_.size_x == costmap_->getSizeInCellsX() &&
+      validity_cache_.size_y == costmap_->getSizeInCellsY() &&
+      (use_radius || validity_cache_.footprint == footprint) &&
+      validity_cache_.first_checked <= closest_point_index &&
+      update_count - validity_cache_.update_count <= 1;
+
+    if (!cache_usable) {
+      validity_cache_.cells_x.assign(path_size, 0);
+      validity_cache_.cells_y.assign(path_size, 0);
+      validity_cache_.blocked.assign(path_size, 0);
+      for (unsigned int i = closest_point_index; i < path_size; ++i) {
+        check_pose(i);
+      }
+      validity_cache_.usable = true;
+      validity_cache_.path_header = request->path.header;
+      validity_cache_.path_size = path_size;
+      validity_cache_.path_front = request->path.poses.front().pose;
+      validity_cache_.path_back = request->path.poses.back().pose;
+      validity_cache_.use_radius = use_radius;
+      validity_cache_.footprint = footprint;
+      validity_cache_.origin_x = costmap_->getOriginX();
+      validity_cache_.origin_y = costmap_->getOriginY();
+      validity_cache_.resolution = costmap_->getResolution();
+      validity_cache_.size_x = costmap_->getSizeInCellsX();
+      validity_cache_.size_y = costmap_->getSizeInCellsY();
+      validity_cache_.first_checked = closest_point_index;
+      validity_cache_.update_count = update_count;
+    } else if (update_count != validity_cache_.update_count) {
+      // re-check only the poses whose cells the last update touched,
+      // inflated by the footprint radius when footprint checking is used
+      unsigned int x0, xn, y0, yn;
+      layered_costmap->getBounds(&x0, &xn, &y0, &yn);
+      unsigned int margin = 0;
+      if (!use_radius) {
+        margin = static_cast<unsigned int>(
+          std::ceil(layered_costmap->getCircumscribedRadius() / costmap_->getResolution()));
       }
+      for (unsigned int i = closest_point_index; i < path_size; ++i) {
+        if (validity_cache_.cells_x[i] + margin >= x0 &&
+          validity_cache_.cells_x[i] < xn + margin &&
+          validity_cache_.cells_y[i] + margin >= y0 &&
+          validity_cache_.cells_y[i] < yn + margin)
+        {
+          check_pose(i);
+        }
+      }
+      validity_cache_.update_count = update_count;
+    }
 
-      if (use_radius &&
-        (cost == nav2_costmap_2d::LETHAL_OBSTACLE ||
-        cost == nav2_costmap_2d::INSCRIBED_INFLATED_OBSTACLE))
-      {
-        response->is_valid = false;
-        break;
-      } else if (cost == nav2_costmap_2d::LETHAL_OBSTACLE) {
+    for (unsigned int i = closest_point_index; i < path_size; ++i) {
+      if (validity_cache_.blocked[i]) {
         response->is_valid = false;
         break;
       }
@@ -723,6 +1482,30 @@ PlannerServer::dynamicParametersCallback(std::vector<rclcpp::Parameter> paramete
             " than 0.0 to turn on duration overrrun warning messages", parameter.as_double());
           max_planner_duration_ = 0.0;
         }
+      } else if (name == "path_cache_start_tolerance") {
+        path_cache_start_tolerance_ = parameter.as_double();
+      } else if (name == "receding_horizon_distance") {
+        if (parameter.as_double() <= 0.0 ||
+          planners_.find(receding_horizon_guide_planner_) != planners_.end())
+        {
+          receding_horizon_distance_ = parameter.as_double();
+        } else {
+          RCLCPP_WARN(
+            get_logger(),
+            "Cannot enable receding-horizon planning without a valid "
+            "receding_horizon_guide_planner configured");
+        }
+      }
+    } else if (type == ParameterType::PARAMETER_INTEGER) {
+      if (name == "path_cache_size") {
+        path_cache_size_ = parameter.as_int();
+        if (path_cache_size_ < 1) {
+          path_cache_.clear();
+        } else {
+          while (path_cache_.size() > static_cast<size_t>(path_cache_size_)) {
+            path_cache_.erase(path_cache_.begin());
+          }
+        }
       }
     }
   }
@@ -0,0 +1,205 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_planner/route_cache.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <utility>
+
+namespace nav2_planner
+{
+
+// Format marker written as the first line of the persistence file
+static const char * const kRouteCacheMagic = "nav2_route_cache 1";
+
+void
+RouteCache::configure(
+  double quantization, const std::string & file_path, const rclcpp::Logger & logger)
+{
+  quantization_ = quantization;
+  file_path_ = file_path;
+  logger_ = logger;
+  routes_.clear();
+}
+
+RouteCache::RouteKey
+RouteCache::makeKey(
+  const geometry_msgs::msg::PoseStamped & start,
+  const geometry_msgs::msg::PoseStamped & goal,
+  const std::string & planner_id) const
+{
+  RouteKey key;
+  key.start_x = static_cast<int64_t>(std::floor(start.pose.position.x / quantization_));
+  key.start_y = static_cast<int64_t>(std::floor(start.pose.position.y / quantization_));
+  key.goal_x = static_cast<int64_t>(std::floor(goal.pose.position.x / quantization_));
+  key.goal_y = static_cast<int64_t>(std::floor(goal.pose.position.y / quantization_));
+  key.planner_id = planner_id;
+  return key;
+}
+
+bool
+RouteCache::lookup(
+  const geometry_msgs::msg::PoseStamped & start,
+  const geometry_msgs::msg::PoseStamped & goal,
+  const std::string & planner_id,
+  nav_msgs::msg::Path & path) const
+{
+  if (!enabled()) {
+    return false;
+  }
+
+  auto it = routes_.find(makeKey(start, goal, planner_id));
+  if (it == routes_.end()) {
+    return false;
+  }
+
+  path = it->second;
+  return true;
+}
+
+void
+RouteCache::store(
+  const geometry_msgs::msg::PoseStamped & start,
+  const geometry_msgs::msg::PoseStamped & goal,
+  const std::string & planner_id,
+  const nav_msgs::msg::Path & path)
+{
+  if (!enabled() || path.poses.empty()) {
+    return;
+  }
+
+  routes_[makeKey(start, goal, planner_id)] = path;
+}
+
+void
+RouteCache::invalidate(
+  const geometry_msgs::msg::PoseStamped & start,
+  const geometry_msgs::msg::PoseStamped & goal,
+  const std::string & planner_id)
+{
+  if (!enabled()) {
+    return;
+  }
+
+  routes_.erase(makeKey(start, goal, planner_id));
+}
+
+bool
+RouteCache::load()
+{
+  if (!enabled() || file_path_.empty()) {
+    return false;
+  }
+
+  std::ifstream file(file_path_);
+  if (!file) {
+    // nothing learned yet
+    return true;
+  }
+
+  std::string magic;
+  std::getline(file, magic);
+  if (magic != kRouteCacheMagic) {
+    RCLCPP_WARN(
+      logger_, "Route cache file %s has an unrecognized format, ignoring it",
+      file_path_.c_str());
+    return false;
+  }
+
+  std::unordered_map<RouteKey, nav_msgs::msg::Path, RouteKeyHash> routes;
+  std::string token;
+  while (file >> token) {
+    size_t num_poses = 0;
+    RouteKey key;
+    nav_msgs::msg::Path path;
+    if (token != "route" ||
+      !(file >> key.start_x >> key.start_y >> key.goal_x >> key.goal_y >>
+      key.planner_id >> path.header.frame_id >> num_poses))
+    {
+      RCLCPP_WARN(
+        logger_, "Route cache file %s is malformed, ignoring it", file_path_.c_str());
+      return false;
+    }
+
+    path.poses.resize(num_poses);
+    for (auto & pose : path.poses) {
+      pose.header.frame_id = path.header.frame_id;
+      auto & p = pose.pose;
+      if (!(file >> p.position.x >> p.position.y >> p.position.z >>
+        p.orientation.x >> p.orientation.y >> p.orientation.z >> p.orientation.w))
+      {
+        RCLCPP_WARN(
+          logger_, "Route cache file %s is malformed, ignoring it", file_path_.c_str());
+        return false;
+      }
+    }
+    routes[key] = std::move(path);
+  }
+
+  routes_ = std::move(routes);
+  RCLCPP_INFO(
+    logger_, "Loaded %zu learned routes from %s", routes_.size(), file_path_.c_str());
+  return true;
+}
+
+bool
+RouteCache::save() const
+{
+  if (!enabled() || file_path_.empty()) {
+    return false;
+  }
+
+  // written to a temporary and renamed into place, so a crash mid-write
+  // never leaves a truncated file behind
+  const std::string tmp_path = file_path_ + ".tmp";
+  {
+    std::ofstream file(tmp_path);
+    if (!file) {
+      RCLCPP_WARN(
+        logger_, "Failed to write route cache file %s", tmp_path.c_str());
+      return false;
+    }
+
+    file.precision(17);
+    file << kRouteCacheMagic << "\n";
+    for (const auto & [key, path] : routes_) {
+      file << "route " << key.start_x << " " << key.start_y << " " <<
+        key.goal_x << " " << key.goal_y << " " << key.planner_id << " " <<
+        path.header.frame_id << " " << path.poses.size() << "\n";
+      for (const auto & pose : path.poses) {
+        const auto & p = pose.pose;
+        file << p.position.x << " " << p.position.y << " " << p.position.z << " " <<
+          p.orientation.x << " " << p.orientation.y << " " << p.orientation.z << " " <<
+          p.orientation.w << "\n";
+      }
+    }
+    if (!file) {
+      RCLCPP_WARN(
+        logger_, "Failed to write route cache file %s", tmp_path.c_str());
+      return false;
+    }
+  }
+
+  if (std::rename(tmp_path.c_str(), file_path_.c_str()) != 0) {
+    RCLCPP_WARN(
+      logger_, "Failed to move route cache file into place at %s", file_path_.c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace nav2_planner
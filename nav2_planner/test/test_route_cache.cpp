@@ -0,0 +1,110 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "nav2_planner/route_cache.hpp"
+
+using nav2_planner::RouteCache;
+
+static geometry_msgs::msg::PoseStamped makePose(double x, double y)
+{
+  geometry_msgs::msg::PoseStamped pose;
+  pose.pose.position.x = x;
+  pose.pose.position.y = y;
+  pose.pose.orientation.w = 1.0;
+  return pose;
+}
+
+static nav_msgs::msg::Path makePath(double x0, double y0, double x1, double y1)
+{
+  nav_msgs::msg::Path path;
+  path.header.frame_id = "map";
+  path.poses.push_back(makePose(x0, y0));
+  path.poses.push_back(makePose((x0 + x1) / 2.0, (y0 + y1) / 2.0));
+  path.poses.push_back(makePose(x1, y1));
+  return path;
+}
+
+TEST(RouteCache, quantizedRegionKeying)
+{
+  RouteCache cache;
+  cache.configure(1.0, "", rclcpp::get_logger("route_cache_test"));
+  ASSERT_TRUE(cache.enabled());
+
+  cache.store(makePose(0.2, 0.2), makePose(10.3, 5.1), "GridBased", makePath(0.2, 0.2, 10.3, 5.1));
+  EXPECT_EQ(cache.size(), 1u);
+
+  // any start/goal falling in the same 1 m regions hits the stored route
+  nav_msgs::msg::Path path;
+  EXPECT_TRUE(cache.lookup(makePose(0.9, 0.1), makePose(10.9, 5.9), "GridBased", path));
+  EXPECT_EQ(path.poses.size(), 3u);
+
+  // a different region pair or planner misses
+  EXPECT_FALSE(cache.lookup(makePose(2.5, 0.1), makePose(10.9, 5.9), "GridBased", path));
+  EXPECT_FALSE(cache.lookup(makePose(0.9, 0.1), makePose(10.9, 5.9), "SmacHybrid", path));
+
+  cache.invalidate(makePose(0.5, 0.5), makePose(10.5, 5.5), "GridBased");
+  EXPECT_FALSE(cache.lookup(makePose(0.9, 0.1), makePose(10.9, 5.9), "GridBased", path));
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(RouteCache, disabledStoresNothing)
+{
+  RouteCache cache;
+  cache.configure(0.0, "", rclcpp::get_logger("route_cache_test"));
+  EXPECT_FALSE(cache.enabled());
+
+  cache.store(makePose(0, 0), makePose(1, 1), "GridBased", makePath(0, 0, 1, 1));
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(RouteCache, persistsAcrossInstances)
+{
+  const std::string file = "/tmp/nav2_route_cache_test.routes";
+  std::remove(file.c_str());
+
+  {
+    RouteCache cache;
+    cache.configure(1.0, file, rclcpp::get_logger("route_cache_test"));
+    cache.store(makePose(0.5, 0.5), makePose(8.5, 3.5), "GridBased", makePath(0.5, 0.5, 8.5, 3.5));
+    cache.store(makePose(8.5, 3.5), makePose(0.5, 0.5), "GridBased", makePath(8.5, 3.5, 0.5, 0.5));
+    EXPECT_TRUE(cache.save());
+  }
+
+  RouteCache cache;
+  cache.configure(1.0, file, rclcpp::get_logger("route_cache_test"));
+  EXPECT_TRUE(cache.load());
+  EXPECT_EQ(cache.size(), 2u);
+
+  nav_msgs::msg::Path path;
+  ASSERT_TRUE(cache.lookup(makePose(0.5, 0.5), makePose(8.5, 3.5), "GridBased", path));
+  EXPECT_EQ(path.header.frame_id, "map");
+  ASSERT_EQ(path.poses.size(), 3u);
+  EXPECT_DOUBLE_EQ(path.poses[2].pose.position.x, 8.5);
+  EXPECT_DOUBLE_EQ(path.poses[2].pose.position.y, 3.5);
+
+  std::remove(file.c_str());
+}
+
+TEST(RouteCache, loadToleratesMissingFile)
+{
+  RouteCache cache;
+  cache.configure(1.0, "/tmp/nav2_route_cache_does_not_exist.routes",
+    rclcpp::get_logger("route_cache_test"));
+  EXPECT_TRUE(cache.load());
+  EXPECT_EQ(cache.size(), 0u);
+}
@@ -15,7 +15,11 @@
 #ifndef NAV2_REGULATED_PURE_PURSUIT_CONTROLLER__COLLISION_CHECKER_HPP_
 #define NAV2_REGULATED_PURE_PURSUIT_CONTROLLER__COLLISION_CHECKER_HPP_
 
+#include <cstdint>
+#include <map>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 #include <memory>
 #include <algorithm>
@@ -39,6 +43,13 @@ namespace nav2_regulated_pure_pursuit_controller
 /**
  * @class nav2_regulated_pure_pursuit_controller::CollisionChecker
  * @brief Checks for collision based on a RPP control command
+ *
+ * With use_collision_arc_caching enabled, the projected arc and the footprint
+ * border cells it sweeps are memoized by quantized (linear velocity, angular
+ * velocity, yaw), so the steady-state case of a barely-changing command is a
+ * scan over precomputed cell offsets instead of a pose-by-pose footprint
+ * rasterization. Quantization means checked cells can differ from the exact
+ * projection by up to a cell, which is why the cache is opt-in.
  */
 class CollisionChecker
 {
@@ -90,6 +101,55 @@ public:
   double costAtPose(const double & x, const double & y);
 
 protected:
+  /**
+   * @brief A single projected pose of a cached collision arc
+   */
+  struct ArcPose
+  {
+    double dist_from_start;                         ///< For the carrot distance cutoff
+    double offset_x, offset_y;                      ///< World-frame offset from the arc start
+    std::vector<std::pair<int, int>> cell_offsets;  ///< Footprint border cells, relative to start
+  };
+
+  /**
+   * @brief The poses and footprint cells swept by one quantized (v, w, yaw) command
+   */
+  struct CachedArc
+  {
+    std::vector<ArcPose> poses;
+  };
+
+  /**
+   * @brief Collision check scanning the memoized arc for the current command
+   * @param robot_pose Pose of robot
+   * @param linear_vel linear velocity to forward project
+   * @param angular_vel angular velocity to forward project
+   * @param carrot_dist Distance to the carrot for PP
+   * @return Whether collision is imminent
+   */
+  bool isCollisionImminentCached(
+    const geometry_msgs::msg::PoseStamped & robot_pose,
+    const double & linear_vel, const double & angular_vel,
+    const double & carrot_dist);
+
+  /**
+   * @brief Look up or build the cached arc for a quantized command
+   * @param linear_vel linear velocity to forward project
+   * @param angular_vel angular velocity to forward project
+   * @param yaw Current robot yaw
+   * @return The cached arc entry
+   */
+  const CachedArc & getCachedArc(
+    const double & linear_vel, const double & angular_vel, const double & yaw);
+
+  /**
+   * @brief Rasterize the footprint border at a pose relative to the arc start
+   * @param relative_pose Pose offset from the arc start, which sits at a cell center
+   * @param arc_pose Arc pose whose cell offsets are filled in
+   */
+  void appendFootprintCellOffsets(
+    const geometry_msgs::msg::Pose2D & relative_pose, ArcPose & arc_pose);
+
   rclcpp::Logger logger_ {rclcpp::get_logger("RPPCollisionChecker")};
   std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros_;
   nav2_costmap_2d::Costmap2D * costmap_;
@@ -98,6 +158,13 @@ protected:
   Parameters * params_;
   std::shared_ptr<rclcpp_lifecycle::LifecyclePublisher<nav_msgs::msg::Path>> carrot_arc_pub_;
   rclcpp::Clock::SharedPtr clock_;
+
+  // Arc memoization state; cleared whenever the footprint, costmap resolution
+  // or projection horizon it was built against changes
+  std::map<std::tuple<int64_t, int64_t, int64_t>, CachedArc> arc_cache_;
+  std::vector<geometry_msgs::msg::Point> cached_footprint_;
+  double cached_resolution_{0.0};
+  double cached_max_time_{0.0};
 };
 
 }  // namespace nav2_regulated_pure_pursuit_controller
@@ -60,6 +60,7 @@ struct Parameters
   double max_robot_pose_search_dist;
   bool interpolate_curvature_after_goal;
   bool use_collision_detection;
+  bool use_collision_arc_caching;
   double transform_tolerance;
 };
 
@@ -77,9 +77,14 @@ public:
     const geometry_msgs::msg::PoseStamped & in_pose,
     geometry_msgs::msg::PoseStamped & out_pose) const;
 
-  void setPlan(const nav_msgs::msg::Path & path) {global_plan_ = path;}
+  /**
+   * @brief Sets the global plan and precomputes its cumulative arc-length
+   * table, so the per-cycle integrated distance bound becomes a binary search
+   * @param path Global plan
+   */
+  void setPlan(const nav_msgs::msg::Path & path);
 
-  nav_msgs::msg::Path getPlan() {return global_plan_;}
+  nav_msgs::msg::Path getPlan();
 
 protected:
   /**
@@ -93,6 +98,10 @@ protected:
   std::shared_ptr<tf2_ros::Buffer> tf_;
   std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros_;
   nav_msgs::msg::Path global_plan_;
+  /// Cumulative distance along the plan up to each pose, computed in setPlan()
+  std::vector<double> arclengths_;
+  /// Poses before this index are passed; pruned lazily instead of erased
+  size_t prune_index_{0};
 };
 
 }  // namespace nav2_regulated_pure_pursuit_controller
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <string>
 #include <limits>
 #include <memory>
@@ -20,12 +21,31 @@
 #include <utility>
 
 #include "nav2_regulated_pure_pursuit_controller/collision_checker.hpp"
+#include "nav2_util/line_iterator.hpp"
 
 namespace nav2_regulated_pure_pursuit_controller
 {
 
 using namespace nav2_costmap_2d;  // NOLINT
 
+namespace
+{
+bool sameFootprint(
+  const std::vector<geometry_msgs::msg::Point> & a,
+  const std::vector<geometry_msgs::msg::Point> & b)
+{
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (unsigned int i = 0; i < a.size(); ++i) {
+    if (a[i].x != b[i].x || a[i].y != b[i].y) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
 CollisionChecker::CollisionChecker(
   rclcpp_lifecycle::LifecycleNode::SharedPtr node,
   std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros,
@@ -61,6 +81,10 @@ bool CollisionChecker::isCollisionImminent(
     return true;
   }
 
+  if (params_->use_collision_arc_caching) {
+    return isCollisionImminentCached(robot_pose, linear_vel, angular_vel, carrot_dist);
+  }
+
   // visualization messages
   nav_msgs::msg::Path arc_pts_msg;
   arc_pts_msg.header.frame_id = costmap_ros_->getGlobalFrameID();
@@ -124,6 +148,184 @@ bool CollisionChecker::isCollisionImminent(
   return false;
 }
 
+bool CollisionChecker::isCollisionImminentCached(
+  const geometry_msgs::msg::PoseStamped & robot_pose,
+  const double & linear_vel, const double & angular_vel,
+  const double & carrot_dist)
+{
+  const double yaw = tf2::getYaw(robot_pose.pose.orientation);
+  const CachedArc & arc = getCachedArc(linear_vel, angular_vel, yaw);
+
+  unsigned int mx, my;
+  if (!costmap_->worldToMap(robot_pose.pose.position.x, robot_pose.pose.position.y, mx, my)) {
+    // the start pose was already cleared by inCollision(), which warned
+    return false;
+  }
+
+  nav_msgs::msg::Path arc_pts_msg;
+  arc_pts_msg.header.frame_id = costmap_ros_->getGlobalFrameID();
+  arc_pts_msg.header.stamp = robot_pose.header.stamp;
+  geometry_msgs::msg::PoseStamped pose_msg;
+  pose_msg.header.frame_id = arc_pts_msg.header.frame_id;
+  pose_msg.header.stamp = arc_pts_msg.header.stamp;
+
+  const int size_x = static_cast<int>(costmap_->getSizeInCellsX());
+  const int size_y = static_cast<int>(costmap_->getSizeInCellsY());
+  const bool tracking_unknown = costmap_ros_->getLayeredCostmap()->isTrackingUnknown();
+
+  for (const ArcPose & arc_pose : arc.poses) {
+    // check if past carrot pose, where no longer a thoughtfully valid command
+    if (arc_pose.dist_from_start > carrot_dist) {
+      break;
+    }
+
+    // store it for visualization
+    pose_msg.pose.position.x = robot_pose.pose.position.x + arc_pose.offset_x;
+    pose_msg.pose.position.y = robot_pose.pose.position.y + arc_pose.offset_y;
+    pose_msg.pose.position.z = 0.01;
+    arc_pts_msg.poses.push_back(pose_msg);
+
+    // scan this pose's precomputed footprint cells, mirroring footprintCost():
+    // any lethal cell is a collision, and a wholly unknown border is only
+    // tolerated when the costmap is tracking unknown space
+    double footprint_cost = 0.0;
+    for (const std::pair<int, int> & offset : arc_pose.cell_offsets) {
+      const int cx = static_cast<int>(mx) + offset.first;
+      const int cy = static_cast<int>(my) + offset.second;
+      if (cx < 0 || cy < 0 || cx >= size_x || cy >= size_y) {
+        footprint_cost = static_cast<double>(LETHAL_OBSTACLE);
+        break;
+      }
+      const double point_cost = static_cast<double>(costmap_->getCost(cx, cy));
+      if (point_cost == static_cast<double>(LETHAL_OBSTACLE)) {
+        footprint_cost = point_cost;
+        break;
+      }
+      footprint_cost = std::max(footprint_cost, point_cost);
+    }
+
+    if (footprint_cost == static_cast<double>(NO_INFORMATION) && tracking_unknown) {
+      continue;
+    }
+
+    if (footprint_cost >= static_cast<double>(LETHAL_OBSTACLE)) {
+      carrot_arc_pub_->publish(arc_pts_msg);
+      return true;
+    }
+  }
+
+  carrot_arc_pub_->publish(arc_pts_msg);
+
+  return false;
+}
+
+const CollisionChecker::CachedArc & CollisionChecker::getCachedArc(
+  const double & linear_vel, const double & angular_vel, const double & yaw)
+{
+  const double resolution = costmap_->getResolution();
+  const double max_time = params_->max_allowed_time_to_collision_up_to_carrot;
+  const double max_radius = costmap_ros_->getLayeredCostmap()->getCircumscribedRadius();
+  const std::vector<geometry_msgs::msg::Point> & footprint = costmap_ros_->getRobotFootprint();
+
+  if (resolution != cached_resolution_ || max_time != cached_max_time_ ||
+    !sameFootprint(footprint, cached_footprint_))
+  {
+    arc_cache_.clear();
+    cached_resolution_ = resolution;
+    cached_max_time_ = max_time;
+    cached_footprint_ = footprint;
+  }
+
+  // bins sized so that quantizing the command or yaw displaces any footprint
+  // point by less than a cell over the projection horizon
+  const double v_bin = resolution / max_time;
+  const double w_bin = resolution / (max_radius * max_time);
+  const double yaw_bin = resolution / max_radius;
+  const std::tuple<int64_t, int64_t, int64_t> key(
+    std::llround(linear_vel / v_bin),
+    std::llround(angular_vel / w_bin),
+    std::llround(yaw / yaw_bin));
+
+  auto it = arc_cache_.find(key);
+  if (it != arc_cache_.end()) {
+    return it->second;
+  }
+
+  if (arc_cache_.size() >= 512) {
+    arc_cache_.clear();
+  }
+
+  // project the arc for the quantized command, exactly as the uncached path
+  // does for the raw one, and rasterize the footprint border at each pose
+  const double v = std::get<0>(key) * v_bin;
+  const double w = std::get<1>(key) * w_bin;
+  double projection_time = 0.0;
+  if (fabs(v) < 0.01 && fabs(w) > 0.01) {
+    projection_time = 2.0 * sin((resolution / 2) / max_radius) / fabs(w);
+  } else {
+    projection_time = resolution / fabs(v);
+  }
+
+  CachedArc arc;
+  geometry_msgs::msg::Pose2D curr_pose;
+  curr_pose.x = 0.0;
+  curr_pose.y = 0.0;
+  curr_pose.theta = std::get<2>(key) * yaw_bin;
+
+  int i = 1;
+  while (i * projection_time < max_time) {
+    i++;
+
+    curr_pose.x += projection_time * (v * cos(curr_pose.theta));
+    curr_pose.y += projection_time * (v * sin(curr_pose.theta));
+    curr_pose.theta += projection_time * w;
+
+    ArcPose arc_pose;
+    arc_pose.dist_from_start = hypot(curr_pose.x, curr_pose.y);
+    arc_pose.offset_x = curr_pose.x;
+    arc_pose.offset_y = curr_pose.y;
+    appendFootprintCellOffsets(curr_pose, arc_pose);
+    arc.poses.push_back(std::move(arc_pose));
+  }
+
+  return arc_cache_.emplace(key, std::move(arc)).first->second;
+}
+
+void CollisionChecker::appendFootprintCellOffsets(
+  const geometry_msgs::msg::Pose2D & relative_pose, ArcPose & arc_pose)
+{
+  const double resolution = costmap_->getResolution();
+  const double cos_th = cos(relative_pose.theta);
+  const double sin_th = sin(relative_pose.theta);
+
+  // cell offsets assume the arc start sits at a cell center; the robot's
+  // actual sub-cell position can shift the rasterization by one cell
+  std::vector<std::pair<int, int>> vertices;
+  vertices.reserve(cached_footprint_.size());
+  for (const geometry_msgs::msg::Point & pt : cached_footprint_) {
+    const double wx = relative_pose.x + pt.x * cos_th - pt.y * sin_th;
+    const double wy = relative_pose.y + pt.x * sin_th + pt.y * cos_th;
+    vertices.emplace_back(
+      static_cast<int>(std::floor(wx / resolution + 0.5)),
+      static_cast<int>(std::floor(wy / resolution + 0.5)));
+  }
+
+  for (unsigned int i = 0; i < vertices.size(); ++i) {
+    const std::pair<int, int> & a = vertices[i];
+    const std::pair<int, int> & b = vertices[(i + 1) % vertices.size()];
+    for (nav2_util::LineIterator line(a.first, a.second, b.first, b.second);
+      line.isValid(); line.advance())
+    {
+      arc_pose.cell_offsets.emplace_back(line.getX(), line.getY());
+    }
+  }
+
+  std::sort(arc_pose.cell_offsets.begin(), arc_pose.cell_offsets.end());
+  arc_pose.cell_offsets.erase(
+    std::unique(arc_pose.cell_offsets.begin(), arc_pose.cell_offsets.end()),
+    arc_pose.cell_offsets.end());
+}
+
 bool CollisionChecker::inCollision(
   const double & x,
   const double & y,
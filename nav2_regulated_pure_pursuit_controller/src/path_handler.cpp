@@ -50,11 +50,12 @@ nav_msgs::msg::Path PathHandler::transformGlobalPlan(
   double max_robot_pose_search_dist,
   bool reject_unit_path)
 {
-  if (global_plan_.poses.empty()) {
+  const size_t remaining = global_plan_.poses.size() - prune_index_;
+  if (global_plan_.poses.empty() || remaining == 0) {
     throw nav2_core::InvalidPath("Received plan with zero length");
   }
 
-  if (reject_unit_path && global_plan_.poses.size() == 1) {
+  if (reject_unit_path && remaining == 1) {
     throw nav2_core::InvalidPath("Received plan with length of one");
   }
 
@@ -64,16 +65,22 @@ nav_msgs::msg::Path PathHandler::transformGlobalPlan(
     throw nav2_core::ControllerTFError("Unable to transform robot pose into global plan's frame");
   }
 
+  const auto plan_begin = global_plan_.poses.begin() + prune_index_;
+
+  // bound the closest pose search by integrated distance, using the
+  // arc-length table from setPlan() instead of re-integrating the plan
+  auto upper_bound_it = std::upper_bound(
+    arclengths_.begin() + prune_index_ + 1, arclengths_.end(),
+    arclengths_[prune_index_] + max_robot_pose_search_dist);
   auto closest_pose_upper_bound =
-    nav2_util::geometry_utils::first_after_integrated_distance(
-    global_plan_.poses.begin(), global_plan_.poses.end(), max_robot_pose_search_dist);
+    global_plan_.poses.begin() + (upper_bound_it - arclengths_.begin());
 
   // First find the closest pose on the path to the robot
   // bounded by when the path turns around (if it does) so we don't get a pose from a later
   // portion of the path
   auto transformation_begin =
     nav2_util::geometry_utils::min_by(
-    global_plan_.poses.begin(), closest_pose_upper_bound,
+    plan_begin, closest_pose_upper_bound,
     [&robot_pose](const geometry_msgs::msg::PoseStamped & ps) {
       return euclidean_distance(robot_pose, ps);
     });
@@ -81,7 +88,7 @@ nav_msgs::msg::Path PathHandler::transformGlobalPlan(
   // Make sure we always have at least 2 points on the transformed plan and that we don't prune
   // the global plan below 2 points in order to have always enough point to interpolate the
   // end of path direction
-  if (global_plan_.poses.begin() != closest_pose_upper_bound && global_plan_.poses.size() > 1 &&
+  if (plan_begin != closest_pose_upper_bound && remaining > 1 &&
     transformation_begin == std::prev(closest_pose_upper_bound))
   {
     transformation_begin = std::prev(std::prev(closest_pose_upper_bound));
@@ -117,9 +124,10 @@ nav_msgs::msg::Path PathHandler::transformGlobalPlan(
   transformed_plan.header.frame_id = costmap_ros_->getBaseFrameID();
   transformed_plan.header.stamp = robot_pose.header.stamp;
 
-  // Remove the portion of the global plan that we've already passed so we don't
-  // process it on the next iteration (this is called path pruning)
-  global_plan_.poses.erase(begin(global_plan_.poses), transformation_begin);
+  // Remember the portion of the global plan that we've already passed so we don't
+  // process it on the next iteration (this is called path pruning); advancing the
+  // index keeps the arc-length table valid without shifting the pose array
+  prune_index_ = transformation_begin - global_plan_.poses.begin();
 
   if (transformed_plan.poses.empty()) {
     throw nav2_core::InvalidPath("Resulting plan has 0 poses in it.");
@@ -128,6 +136,32 @@ nav_msgs::msg::Path PathHandler::transformGlobalPlan(
   return transformed_plan;
 }
 
+void PathHandler::setPlan(const nav_msgs::msg::Path & path)
+{
+  global_plan_ = path;
+  prune_index_ = 0;
+
+  // cumulative arc-length table; the per-cycle integrated distance bound in
+  // transformGlobalPlan() is a binary search over it
+  arclengths_.resize(global_plan_.poses.size());
+  double length = 0.0;
+  for (size_t i = 0; i < global_plan_.poses.size(); ++i) {
+    if (i > 0) {
+      length += euclidean_distance(global_plan_.poses[i - 1], global_plan_.poses[i]);
+    }
+    arclengths_[i] = length;
+  }
+}
+
+nav_msgs::msg::Path PathHandler::getPlan()
+{
+  nav_msgs::msg::Path remaining_plan;
+  remaining_plan.header = global_plan_.header;
+  remaining_plan.poses.assign(
+    global_plan_.poses.begin() + prune_index_, global_plan_.poses.end());
+  return remaining_plan;
+}
+
 bool PathHandler::transformPose(
   const std::string frame,
   const geometry_msgs::msg::PoseStamped & in_pose,
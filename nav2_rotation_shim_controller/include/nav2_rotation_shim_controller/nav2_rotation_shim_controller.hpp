@@ -172,6 +172,11 @@ protected:
   nav2_core::Controller::Ptr primary_controller_;
   bool path_updated_;
   nav_msgs::msg::Path current_path_;
+  // Path point at the forward sampling distance, cached in the path frame at
+  // setPlan() so the per-cycle heading check needs no TF when poses arrive
+  // in that frame
+  geometry_msgs::msg::PoseStamped sampled_path_pt_;
+  bool sampled_pt_valid_{false};
   double forward_sampling_distance_, angular_dist_threshold_;
   double rotate_to_heading_angular_vel_, max_angular_accel_;
   double control_duration_, simulate_ahead_time_;
@@ -188,10 +188,22 @@ geometry_msgs::msg::TwistStamped RotationShimController::computeVelocityCommands
 
     std::lock_guard<std::mutex> lock_reinit(mutex_);
     try {
-      geometry_msgs::msg::Pose sampled_pt_base = transformPoseToBaseFrame(getSampledPathPt());
+      double angular_distance_to_heading;
+      if (sampled_pt_valid_ && pose.header.frame_id == current_path_.header.frame_id) {
+        // The heading check is the bearing toward the cached sample point
+        // relative to the robot's yaw, which is pure arithmetic in the
+        // path frame
+        double bearing_to_sampled_pt = std::atan2(
+          sampled_path_pt_.pose.position.y - pose.pose.position.y,
+          sampled_path_pt_.pose.position.x - pose.pose.position.x);
+        angular_distance_to_heading = angles::shortest_angular_distance(
+          tf2::getYaw(pose.pose.orientation), bearing_to_sampled_pt);
+      } else {
+        geometry_msgs::msg::Pose sampled_pt_base = transformPoseToBaseFrame(getSampledPathPt());
 
-      double angular_distance_to_heading =
-        std::atan2(sampled_pt_base.position.y, sampled_pt_base.position.x);
+        angular_distance_to_heading =
+          std::atan2(sampled_pt_base.position.y, sampled_pt_base.position.x);
+      }
       if (fabs(angular_distance_to_heading) > angular_dist_threshold_) {
         RCLCPP_DEBUG(
           logger_,
@@ -326,6 +338,16 @@ void RotationShimController::setPlan(const nav_msgs::msg::Path & path)
 {
   path_updated_ = true;
   current_path_ = path;
+
+  // Cache the sampled path point once per plan; too-short paths fall back to
+  // the per-cycle sampling and its existing error handling
+  try {
+    sampled_path_pt_ = getSampledPathPt();
+    sampled_pt_valid_ = true;
+  } catch (const std::runtime_error &) {
+    sampled_pt_valid_ = false;
+  }
+
   primary_controller_->setPlan(path);
 }
 
@@ -0,0 +1,116 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_RVIZ_PLUGINS__COSTMAP_DISPLAY_HPP_
+#define NAV2_RVIZ_PLUGINS__COSTMAP_DISPLAY_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include "nav2_msgs/msg/costmap.hpp"
+#include "nav2_msgs/msg/costmap_update.hpp"
+
+#include "rviz_common/message_filter_display.hpp"
+
+#include <OgreMaterial.h>
+#include <OgreTexture.h>
+
+namespace Ogre
+{
+class ManualObject;
+}  // namespace Ogre
+
+namespace rviz_common
+{
+namespace properties
+{
+class FloatProperty;
+}  // namespace properties
+}  // namespace rviz_common
+
+namespace nav2_rviz_plugins
+{
+
+/**
+ * @brief Displays a nav2_msgs/Costmap grid along with its
+ * nav2_msgs/CostmapUpdate stream. Unlike converting the costmap to an
+ * OccupancyGrid for the stock map display, the cost values are kept in a
+ * single-channel texture that is patched only within the update rectangles,
+ * and colorization happens on the GPU through a palette lookup in the
+ * fragment shader, so large costmaps at high update rates do not re-upload
+ * or re-colorize the full grid every cycle.
+ */
+class CostmapDisplay : public rviz_common::MessageFilterDisplay<nav2_msgs::msg::Costmap>
+{
+  Q_OBJECT
+
+public:
+  CostmapDisplay();
+  ~CostmapDisplay() override;
+
+  void processMessage(nav2_msgs::msg::Costmap::ConstSharedPtr msg) override;
+
+protected:
+  void onInitialize() override;
+  void reset() override;
+
+  /**
+   * @brief Additionally subscribes to the update topic, derived from the
+   * costmap topic name as "<topic>_updates"
+   */
+  void subscribe() override;
+  void unsubscribe() override;
+
+private Q_SLOTS:
+  /// Rebuild the palette texture with the new alpha baked in
+  void updateAlpha();
+
+private:
+  /// Handler of the update rectangle stream
+  void incomingUpdate(nav2_msgs::msg::CostmapUpdate::ConstSharedPtr update);
+
+  /**
+   * @brief Decode the update window cells into a raw row-major buffer
+   * @param update Update message in raw or run-length encoding
+   * @param cells Output buffer of size_x * size_y window cells
+   * @return True if the data field was consistent with the window size
+   */
+  bool decodeUpdate(
+    const nav2_msgs::msg::CostmapUpdate & update, std::vector<uint8_t> & cells) const;
+
+  /// (Re-)create the cost texture, the quad and the material for new metadata
+  void createSceneObjects(const nav2_msgs::msg::CostmapMetaData & metadata);
+
+  /// Build the 256-entry RGBA palette texture holding the costmap colors
+  Ogre::TexturePtr makePaletteTexture() const;
+
+  /// Place the quad at the costmap origin in the fixed frame
+  bool transformMap(const nav2_msgs::msg::Costmap & msg);
+
+  nav2_msgs::msg::Costmap::ConstSharedPtr current_map_;
+  bool loaded_{false};
+
+  rclcpp::Subscription<nav2_msgs::msg::CostmapUpdate>::SharedPtr update_subscription_;
+
+  Ogre::TexturePtr texture_;
+  Ogre::TexturePtr palette_texture_;
+  Ogre::MaterialPtr material_;
+  Ogre::ManualObject * manual_object_{nullptr};
+
+  rviz_common::properties::FloatProperty * alpha_property_;
+};
+
+}  // namespace nav2_rviz_plugins
+
+#endif  // NAV2_RVIZ_PLUGINS__COSTMAP_DISPLAY_HPP_
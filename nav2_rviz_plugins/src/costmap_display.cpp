@@ -0,0 +1,350 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_rviz_plugins/costmap_display.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <OgreHardwarePixelBuffer.h>
+#include <OgreManualObject.h>
+#include <OgreMaterialManager.h>
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+#include <OgreTechnique.h>
+#include <OgreTextureManager.h>
+
+#include "rviz_common/display_context.hpp"
+#include "rviz_common/frame_manager_iface.hpp"
+#include "rviz_common/properties/float_property.hpp"
+
+namespace nav2_rviz_plugins
+{
+
+using rviz_common::properties::StatusProperty;
+
+CostmapDisplay::CostmapDisplay()
+{
+  alpha_property_ = new rviz_common::properties::FloatProperty(
+    "Alpha", 0.7f,
+    "Amount of transparency to apply to the costmap.",
+    this, SLOT(updateAlpha()));
+  alpha_property_->setMin(0.0f);
+  alpha_property_->setMax(1.0f);
+}
+
+CostmapDisplay::~CostmapDisplay()
+{
+  if (initialized() && manual_object_) {
+    scene_manager_->destroyManualObject(manual_object_);
+    manual_object_ = nullptr;
+  }
+}
+
+void CostmapDisplay::onInitialize()
+{
+  MFDClass::onInitialize();
+}
+
+void CostmapDisplay::subscribe()
+{
+  MFDClass::subscribe();
+
+  if (!isEnabled() || topic_property_->isEmpty()) {
+    return;
+  }
+
+  try {
+    update_subscription_ =
+      rviz_ros_node_.lock()->get_raw_node()->
+      template create_subscription<nav2_msgs::msg::CostmapUpdate>(
+      topic_property_->getTopicStd() + "_updates", rclcpp::QoS(rclcpp::KeepLast(10)),
+      [this](nav2_msgs::msg::CostmapUpdate::ConstSharedPtr update) {incomingUpdate(update);});
+    setStatus(StatusProperty::Ok, "Update Topic", "OK");
+  } catch (rclcpp::exceptions::InvalidTopicNameError & e) {
+    setStatus(
+      StatusProperty::Error, "Update Topic",
+      QString("Error subscribing: ") + e.what());
+  }
+}
+
+void CostmapDisplay::unsubscribe()
+{
+  MFDClass::unsubscribe();
+  update_subscription_.reset();
+}
+
+void CostmapDisplay::processMessage(nav2_msgs::msg::Costmap::ConstSharedPtr msg)
+{
+  const auto & metadata = msg->metadata;
+  if (metadata.size_x == 0u || metadata.size_y == 0u) {
+    setStatus(StatusProperty::Error, "Map", "Received a costmap of zero size");
+    return;
+  }
+  if (msg->data.size() != static_cast<size_t>(metadata.size_x) * metadata.size_y) {
+    setStatus(StatusProperty::Error, "Map", "Data size does not match width * height");
+    return;
+  }
+
+  // The texture and the quad survive across messages of the same geometry:
+  // a full map of unchanged size is only a texture upload, and the update
+  // stream below patches sub-rectangles of the same texture
+  if (!loaded_ || !current_map_ ||
+    current_map_->metadata.size_x != metadata.size_x ||
+    current_map_->metadata.size_y != metadata.size_y)
+  {
+    createSceneObjects(metadata);
+  }
+  current_map_ = msg;
+
+  Ogre::PixelBox full_box(
+    metadata.size_x, metadata.size_y, 1, Ogre::PF_L8,
+    const_cast<uint8_t *>(msg->data.data()));
+  texture_->getBuffer()->blitFromMemory(full_box);
+
+  if (!transformMap(*msg)) {
+    return;
+  }
+
+  loaded_ = true;
+  scene_node_->setVisible(true);
+  setStatus(StatusProperty::Ok, "Map", "Costmap received");
+  context_->queueRender();
+}
+
+void CostmapDisplay::incomingUpdate(nav2_msgs::msg::CostmapUpdate::ConstSharedPtr update)
+{
+  if (!loaded_ || !current_map_) {
+    // Ignore updates until the full costmap arrives to patch into
+    return;
+  }
+
+  const auto & metadata = current_map_->metadata;
+  if (update->x + update->size_x > metadata.size_x ||
+    update->y + update->size_y > metadata.size_y)
+  {
+    setStatus(
+      StatusProperty::Error, "Update",
+      "Update area outside of costmap area");
+    return;
+  }
+  if (update->size_x == 0u || update->size_y == 0u) {
+    return;
+  }
+
+  std::vector<uint8_t> cells;
+  if (!decodeUpdate(*update, cells)) {
+    setStatus(StatusProperty::Error, "Update", "Update data does not match update size");
+    return;
+  }
+
+  // Patch only the changed rectangle of the cost texture; cells outside of
+  // it are neither uploaded nor recolorized
+  Ogre::PixelBox update_box(update->size_x, update->size_y, 1, Ogre::PF_L8, cells.data());
+  texture_->getBuffer()->blitFromMemory(
+    update_box,
+    Ogre::Box(
+      update->x, update->y,
+      update->x + update->size_x, update->y + update->size_y));
+
+  setStatus(StatusProperty::Ok, "Update", "Update received");
+  context_->queueRender();
+}
+
+bool CostmapDisplay::decodeUpdate(
+  const nav2_msgs::msg::CostmapUpdate & update, std::vector<uint8_t> & cells) const
+{
+  const size_t area = static_cast<size_t>(update.size_x) * update.size_y;
+
+  if (update.encoding == nav2_msgs::msg::CostmapUpdate::ENCODING_RAW) {
+    if (update.data.size() != area) {
+      return false;
+    }
+    cells.assign(update.data.begin(), update.data.end());
+    return true;
+  }
+
+  if (update.encoding == nav2_msgs::msg::CostmapUpdate::ENCODING_RLE) {
+    if (update.data.size() % 2u != 0u) {
+      return false;
+    }
+    cells.clear();
+    cells.reserve(area);
+    for (size_t i = 0; i < update.data.size(); i += 2) {
+      const size_t run_length = static_cast<size_t>(update.data[i]) + 1;
+      if (cells.size() + run_length > area) {
+        return false;
+      }
+      cells.insert(cells.end(), run_length, update.data[i + 1]);
+    }
+    return cells.size() == area;
+  }
+
+  return false;
+}
+
+void CostmapDisplay::createSceneObjects(const nav2_msgs::msg::CostmapMetaData & metadata)
+{
+  static int costmap_display_count = 0;
+  const std::string suffix = std::to_string(costmap_display_count++);
+
+  if (manual_object_) {
+    scene_manager_->destroyManualObject(manual_object_);
+    manual_object_ = nullptr;
+  }
+
+  texture_ = Ogre::TextureManager::getSingleton().createManual(
+    "CostmapDisplayTexture" + suffix, "rviz_rendering",
+    Ogre::TEX_TYPE_2D, metadata.size_x, metadata.size_y, 0,
+    Ogre::PF_L8, Ogre::TU_DYNAMIC_WRITE_ONLY);
+  palette_texture_ = makePaletteTexture();
+
+  // The Indexed8BitImage material looks each cost value up in the palette
+  // texture inside the fragment shader, so colorization happens on the GPU
+  // and only the single-channel cost values ever cross to the graphics card
+  Ogre::MaterialPtr base_material = Ogre::MaterialManager::getSingleton().getByName(
+    "rviz/Indexed8BitImage", "rviz_rendering");
+  material_ = base_material->clone("CostmapDisplayMaterial" + suffix);
+  material_->setReceiveShadows(false);
+  material_->getTechnique(0)->setLightingEnabled(false);
+  material_->setDepthWriteEnabled(false);
+  material_->setSceneBlending(Ogre::SBT_TRANSPARENT_ALPHA);
+
+  Ogre::Pass * pass = material_->getTechnique(0)->getPass(0);
+  Ogre::TextureUnitState * tex_unit =
+    pass->getNumTextureUnitStates() > 0 ?
+    pass->getTextureUnitState(0) : pass->createTextureUnitState();
+  tex_unit->setTexture(texture_);
+  tex_unit->setTextureFiltering(Ogre::TFO_NONE);
+  Ogre::TextureUnitState * palette_unit =
+    pass->getNumTextureUnitStates() > 1 ?
+    pass->getTextureUnitState(1) : pass->createTextureUnitState();
+  palette_unit->setTexture(palette_texture_);
+  palette_unit->setTextureFiltering(Ogre::TFO_NONE);
+
+  // A unit quad in the X-Y plane; the scene node scale stretches it to the
+  // metric size of the costmap
+  manual_object_ = scene_manager_->createManualObject();
+  scene_node_->attachObject(manual_object_);
+  manual_object_->begin(
+    material_->getName(), Ogre::RenderOperation::OT_TRIANGLE_LIST, "rviz_rendering");
+  // First triangle
+  manual_object_->position(0.0f, 0.0f, 0.0f);
+  manual_object_->textureCoord(0.0f, 0.0f);
+  manual_object_->normal(0.0f, 0.0f, 1.0f);
+  manual_object_->position(1.0f, 1.0f, 0.0f);
+  manual_object_->textureCoord(1.0f, 1.0f);
+  manual_object_->normal(0.0f, 0.0f, 1.0f);
+  manual_object_->position(0.0f, 1.0f, 0.0f);
+  manual_object_->textureCoord(0.0f, 1.0f);
+  manual_object_->normal(0.0f, 0.0f, 1.0f);
+  // Second triangle
+  manual_object_->position(0.0f, 0.0f, 0.0f);
+  manual_object_->textureCoord(0.0f, 0.0f);
+  manual_object_->normal(0.0f, 0.0f, 1.0f);
+  manual_object_->position(1.0f, 0.0f, 0.0f);
+  manual_object_->textureCoord(1.0f, 0.0f);
+  manual_object_->normal(0.0f, 0.0f, 1.0f);
+  manual_object_->position(1.0f, 1.0f, 0.0f);
+  manual_object_->textureCoord(1.0f, 1.0f);
+  manual_object_->normal(0.0f, 0.0f, 1.0f);
+  manual_object_->end();
+
+  scene_node_->setScale(
+    metadata.resolution * metadata.size_x,
+    metadata.resolution * metadata.size_y, 1.0f);
+}
+
+Ogre::TexturePtr CostmapDisplay::makePaletteTexture() const
+{
+  const float alpha = alpha_property_->getFloat();
+  std::vector<uint8_t> palette(256 * 4, 0);
+  auto set_color = [&palette, alpha](int cost, int r, int g, int b, float a) {
+      palette[4 * cost + 0] = static_cast<uint8_t>(r);
+      palette[4 * cost + 1] = static_cast<uint8_t>(g);
+      palette[4 * cost + 2] = static_cast<uint8_t>(b);
+      palette[4 * cost + 3] = static_cast<uint8_t>(255.0f * a * alpha);
+    };
+
+  // Free space renders fully transparent
+  set_color(0, 0, 0, 0, 0.0f);
+  // Gradient from blue to red over the inflated cost range
+  for (int cost = 1; cost <= 252; cost++) {
+    set_color(cost, cost, 0, 252 - cost, 1.0f);
+  }
+  // Inscribed obstacle
+  set_color(253, 0, 255, 255, 1.0f);
+  // Lethal obstacle
+  set_color(254, 255, 0, 255, 1.0f);
+  // Unknown space
+  set_color(255, 112, 137, 134, 1.0f);
+
+  Ogre::DataStreamPtr palette_stream;
+  palette_stream.reset(new Ogre::MemoryDataStream(palette.data(), palette.size()));
+
+  static int palette_count = 0;
+  return Ogre::TextureManager::getSingleton().loadRawData(
+    "CostmapDisplayPalette" + std::to_string(palette_count++), "rviz_rendering",
+    palette_stream, 256, 1, Ogre::PF_BYTE_RGBA, Ogre::TEX_TYPE_1D, 0);
+}
+
+bool CostmapDisplay::transformMap(const nav2_msgs::msg::Costmap & msg)
+{
+  geometry_msgs::msg::Pose origin = msg.metadata.origin;
+
+  Ogre::Vector3 position;
+  Ogre::Quaternion orientation;
+  if (!context_->getFrameManager()->transform(
+      msg.header.frame_id, msg.header.stamp, origin, position, orientation))
+  {
+    setMissingTransformToFixedFrame(msg.header.frame_id);
+    scene_node_->setVisible(false);
+    return false;
+  }
+  setTransformOk();
+
+  scene_node_->setPosition(position);
+  scene_node_->setOrientation(orientation);
+  return true;
+}
+
+void CostmapDisplay::updateAlpha()
+{
+  if (!material_) {
+    return;
+  }
+
+  palette_texture_ = makePaletteTexture();
+  Ogre::Pass * pass = material_->getTechnique(0)->getPass(0);
+  if (pass->getNumTextureUnitStates() > 1) {
+    pass->getTextureUnitState(1)->setTexture(palette_texture_);
+  }
+  context_->queueRender();
+}
+
+void CostmapDisplay::reset()
+{
+  MFDClass::reset();
+  loaded_ = false;
+  current_map_.reset();
+  if (scene_node_) {
+    scene_node_->setVisible(false);
+  }
+}
+
+}  // namespace nav2_rviz_plugins
+
+#include "pluginlib/class_list_macros.hpp"
+PLUGINLIB_EXPORT_CLASS(nav2_rviz_plugins::CostmapDisplay, rviz_common::Display)
@@ -28,8 +28,8 @@
 #include "nav2_costmap_2d/costmap_2d.hpp"
 #include "nav2_core/planner_exceptions.hpp"
 
-#include "nav2_smac_planner/thirdparty/robin_hood.h"
 #include "nav2_smac_planner/analytic_expansion.hpp"
+#include "nav2_smac_planner/node_graph.hpp"
 #include "nav2_smac_planner/node_2d.hpp"
 #include "nav2_smac_planner/node_hybrid.hpp"
 #include "nav2_smac_planner/node_lattice.hpp"
@@ -49,7 +49,7 @@ class AStarAlgorithm
 {
 public:
   typedef NodeT * NodePtr;
-  typedef robin_hood::unordered_node_map<uint64_t, NodeT> Graph;
+  typedef NodeGraph<NodeT> Graph;
   typedef std::vector<NodePtr> NodeVector;
   typedef std::pair<float, NodeBasic<NodeT>> NodeElement;
   typedef typename NodeT::Coordinates Coordinates;
@@ -69,7 +69,16 @@ public:
     }
   };
 
-  typedef std::priority_queue<NodeElement, std::vector<NodeElement>, NodeComparator> NodeQueue;
+  /**
+   * @struct nav2_smac_planner::NodeQueue
+   * @brief Open list exposing a clear of its underlying storage, so
+   * repeated searches reuse the capacity grown by earlier requests
+   */
+  struct NodeQueue
+    : std::priority_queue<NodeElement, std::vector<NodeElement>, NodeComparator>
+  {
+    void clear() {this->c.clear();}
+  };
 
   /**
    * @brief A constructor for nav2_smac_planner::AStarAlgorithm
@@ -102,6 +111,24 @@ public:
     const float & lookup_table_size,
     const unsigned int & dim_3_size);
 
+  /**
+   * @brief Update the motion model and search info of an initialized planner
+   * in place, retaining the graph reservations and cached heuristic tables.
+   * The distance heuristic is recomputed only when an input shaping it
+   * (motion model, turning radius, table size, angle bins) changed. Call
+   * before initialize() so the previous inputs are still visible for
+   * comparison.
+   * @param motion_model Motion model to use for search
+   * @param search_info Search info to use for search
+   * @param lookup_table_size Size of the distance heuristic lookup table
+   * @param dim_3_size Number of angle quantization bins
+   */
+  void updateSearchInfo(
+    const MotionModel & motion_model,
+    const SearchInfo & search_info,
+    const float & lookup_table_size,
+    const unsigned int & dim_3_size);
+
   /**
    * @brief Creating path from given costmap, start, and goal
    * @param path Reference to a vector of indicies of generated path
@@ -122,6 +149,25 @@ public:
    */
   void setCollisionChecker(GridCollisionChecker * collision_checker);
 
+  /**
+   * @brief Restrict expansion to cells marked in a costmap-sized mask,
+   * e.g. a corridor found at a coarser pyramid level. The mask is
+   * indexed [my * size_x + mx], must match the costmap dimensions and
+   * outlive the search, and must mark the start and goal cells; pass
+   * nullptr to lift the restriction
+   * @param mask Cell mask sized to the current costmap, or nullptr
+   */
+  void setExpansionMask(const std::vector<uint8_t> * mask);
+
+  /**
+   * @brief Attach a telemetry buffer that createPath() fills while searching,
+   * or detach it with nullptr. The buffer is owned by the caller, must
+   * outlive the search, and should be reset() to the costmap size before
+   * each plan
+   * @param telemetry Buffer to record into, or nullptr to disable
+   */
+  void setExpansionTelemetry(ExpansionTelemetry * telemetry);
+
   /**
    * @brief Set the goal for planning, as a node index
    * @param mx The node X index of the goal
@@ -133,6 +179,38 @@ public:
     const float & my,
     const unsigned int & dim_3);
 
+  /**
+   * @brief Set a set of candidate goals for planning, as node coordinates.
+   * The search shares one heuristic envelope across the candidates and
+   * terminates when the cheapest of them is settled; per-candidate costs
+   * are available from getGoalSetCosts() afterward.
+   * @param goals Candidate goal coordinates, in node space
+   * @param terminal_costs Optional per-candidate cost charged on top of the
+   * path cost when comparing candidates (e.g. the final rotation left at
+   * that candidate); empty treats all candidates as free. With non-zero
+   * terminal costs the search runs on past the first settled candidate
+   * until no queued node can beat the incumbent's total any more
+   */
+  void setGoals(
+    const CoordinateVector & goals,
+    const std::vector<float> & terminal_costs = std::vector<float>());
+
+  /**
+   * @brief Get the index into the goal set of the candidate the last
+   * search settled on
+   * @return Index of the reached candidate, -1 if none was settled
+   */
+  int getBestGoalIndex() const {return _best_goal_index;}
+
+  /**
+   * @brief Get per-candidate costs of the last goal-set search: exact for
+   * the settled goal (estimated from the analytic expansion root when it
+   * was reached analytically), an upper bound for candidates the shared
+   * expansion touched, -1 for candidates never reached
+   * @return Costs indexed as the goal set given to setGoals()
+   */
+  const std::vector<float> & getGoalSetCosts() const {return _goal_set_costs;}
+
   /**
    * @brief Set the starting pose for planning, as a node index
    * @param mx The node X index of the goal
@@ -213,12 +291,40 @@ protected:
   inline NodePtr addToGraph(const uint64_t & index);
 
   /**
-   * @brief Check if this node is the goal node
+   * @brief Check if this node is the goal node, or one of the candidate
+   * goals when a goal set is active; the matched candidate's index is
+   * recorded as the best goal
    * @param node Node pointer to check if its the goal node
    * @return if node is goal
    */
   inline bool isGoal(NodePtr & node);
 
+  /**
+   * @brief Get the goal node to target analytic expansions at: the single
+   * goal, or the heuristically nearest candidate when a goal set is active
+   * @param node Node the expansion would start from
+   * @param heuristic Set to the heuristic cost from the node to the
+   * returned candidate, only populated when a goal set is active
+   * @return Goal node to expand towards
+   */
+  inline NodePtr getAnalyticExpansionGoal(const NodePtr & node, float & heuristic);
+
+  /**
+   * @brief Record per-candidate accumulated costs of a finished goal-set
+   * search into _goal_set_costs
+   */
+  inline void finalizeGoalSetCosts();
+
+  /**
+   * @brief Get the terminal cost of a goal-set candidate
+   * @param goal_index Index of the candidate in the goal set
+   * @return Terminal cost of the candidate, 0 when none were given
+   */
+  inline float getTerminalCost(const unsigned int & goal_index) const
+  {
+    return _goal_terminal_costs.empty() ? 0.0f : _goal_terminal_costs[goal_index];
+  }
+
   /**
    * @brief Get cost of heuristic of node
    * @param node Node pointer to get heuristic for
@@ -232,6 +338,28 @@ protected:
    */
   inline bool areInputsValid();
 
+  /**
+   * @brief Check if a node falls inside the active expansion mask
+   * @param node Node pointer to check
+   * @return true if no mask is set or the node's cell is marked
+   */
+  inline bool inExpansionMask(const NodePtr & node);
+
+  /**
+   * @brief Creating path searching from the start and goal simultaneously,
+   * each direction on its own thread, stitching the trees at the best
+   * meeting cell. Only defined for Node2D, whose search is symmetric;
+   * the SE2 nodes share directional static motion and heuristic state
+   * @param path Reference to a vector of indicies of generated path
+   * @param num_iterations Reference to number of iterations to create plan
+   * @param tolerance Reference to tolerance in costmap nodes
+   * @param cancel_checker Function to check if the task has been canceled
+   * @return if plan was successful
+   */
+  bool createPathBidirectional(
+    CoordinateVector & path, int & num_iterations, const float & tolerance,
+    std::function<bool()> cancel_checker);
+
   /**
    * @brief Clear hueristic queue of nodes to search
    */
@@ -250,6 +378,13 @@ protected:
   inline void populateExpansionsLog(
     const NodePtr & node, std::vector<std::tuple<float, float, float>> * expansions_log);
 
+  /**
+   * @brief Record one expansion into the attached telemetry buffer
+   * @param node Node expanded
+   * @param current_key Queue key the node was popped with
+   */
+  inline void recordExpansion(const NodePtr & node, const float & current_key);
+
   bool _traverse_unknown;
   bool _is_initialized;
   int _max_iterations;
@@ -260,12 +395,25 @@ protected:
   unsigned int _x_size;
   unsigned int _y_size;
   unsigned int _dim3_size;
+  float _lookup_table_size;
   SearchInfo _search_info;
 
   Coordinates _goal_coordinates;
   NodePtr _start;
   NodePtr _goal;
 
+  // Candidate goals when planning to a goal set, empty in single-goal mode
+  NodeVector _goals;
+  CoordinateVector _goals_coordinates;
+  int _best_goal_index;
+  std::vector<float> _goal_set_costs;
+  std::vector<float> _goal_terminal_costs;
+  // Incumbent of a weighted goal-set search: the settled candidate whose
+  // path cost plus terminal cost is lowest so far
+  int _incumbent_goal_index;
+  float _incumbent_total_cost;
+  float _incumbent_path_cost;
+
   Graph _graph;
   NodeQueue _queue;
 
@@ -274,6 +422,10 @@ protected:
 
   GridCollisionChecker * _collision_checker;
   nav2_costmap_2d::Costmap2D * _costmap;
+  // Optional coarse-to-fine corridor mask, not owned
+  const std::vector<uint8_t> * _expansion_mask;
+  // Optional search introspection buffer, not owned
+  ExpansionTelemetry * _telemetry;
   std::unique_ptr<AnalyticExpansion<NodeT>> _expander;
 };
 
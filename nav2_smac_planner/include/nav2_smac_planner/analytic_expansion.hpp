@@ -19,6 +19,7 @@
 #include <vector>
 #include <list>
 #include <memory>
+#include <unordered_map>
 
 #include "nav2_smac_planner/node_2d.hpp"
 #include "nav2_smac_planner/node_hybrid.hpp"
@@ -121,12 +122,33 @@ public:
   void cleanNode(const NodePtr & nodes);
 
 protected:
+  /**
+   * @brief Check if a shot origin is near the origin of a recently failed
+   * shot, in which case a new attempt is very likely to fail the same way
+   * @param node_coords Coordinates of the proposed shot origin
+   * @return If the origin falls in a recently failed origin's bucket
+   */
+  bool isRecentFailedShotOrigin(const Coordinates & node_coords);
+
+  /**
+   * @brief Record the origin of a failed shot for later attempts to skip
+   * @param node_coords Coordinates of the failed shot origin
+   */
+  void recordFailedShotOrigin(const Coordinates & node_coords);
+
   MotionModel _motion_model;
   SearchInfo _search_info;
   bool _traverse_unknown;
   unsigned int _dim_3_size;
   GridCollisionChecker * _collision_checker;
   std::list<std::unique_ptr<NodeT>> _detached_nodes;
+  // Spatially hashed origins of recently failed shots and the attempt
+  // number they failed at, to skip repeating doomed attempts nearby
+  std::unordered_map<uint64_t, unsigned int> _failed_shot_origins;
+  unsigned int _analytic_attempt_count{0};
+  // Curve fraction that blocked the last failed shot, checked first on the
+  // next shot since consecutive attempts tend to fail on the same obstacle
+  float _last_failed_fraction{-1.0f};
 };
 
 }  // namespace nav2_smac_planner
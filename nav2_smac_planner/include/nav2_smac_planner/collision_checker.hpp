@@ -14,10 +14,13 @@
 
 #include <vector>
 #include <memory>
+#include <tuple>
+#include <utility>
 
 #include "nav2_costmap_2d/footprint_collision_checker.hpp"
 #include "nav2_costmap_2d/costmap_2d_ros.hpp"
 #include "nav2_smac_planner/constants.hpp"
+#include "nav2_smac_planner/types.hpp"
 #include "rclcpp_lifecycle/lifecycle_node.hpp"
 
 #ifndef NAV2_SMAC_PLANNER__COLLISION_CHECKER_HPP_
@@ -98,6 +101,38 @@ public:
    */
   float getCost();
 
+  /**
+   * @brief Register the swept footprint of a motion primitive for batched
+   * collision checking. The footprint cells of the sampled poses are merged
+   * into one deduplicated union so heavily overlapping successive poses are
+   * only checked once, quantized to the costmap cells and heading bins
+   * @param poses Sampled poses along the primitive, x and y in cell
+   * coordinates relative to the primitive start, theta in radians
+   * @return Handle to check with inCollisionSwept()
+   */
+  unsigned int registerSweptFootprint(const MotionPoses & poses);
+
+  /**
+   * @brief Check every sampled pose of a registered primitive in one batch
+   * @param x X of the primitive start pose, in cell coordinates
+   * @param y Y of the primitive start pose, in cell coordinates
+   * @param handle Handle returned by registerSweptFootprint()
+   * @param traverse_unknown Whether or not to traverse in unknown space
+   * @return boolean if in collision or not
+   */
+  bool inCollisionSwept(
+    const float & x,
+    const float & y,
+    const unsigned int & handle,
+    const bool & traverse_unknown);
+
+  /**
+   * @brief Get the generation of the footprint; swept footprints registered
+   * for an older generation must be re-registered
+   * @return the footprint generation
+   */
+  unsigned int getFootprintGeneration() {return footprint_generation_;}
+
   /**
    * @brief Get the angles of the precomputed footprint orientations
    * @return the ordered vector of angles corresponding to footprints
@@ -124,11 +159,25 @@ private:
   bool outsideRange(const unsigned int & max, const float & value);
 
 protected:
+  /**
+   * @struct nav2_smac_planner::GridCollisionChecker::SweptFootprint
+   * @brief Precomputed cells of a primitive's swept footprint
+   */
+  struct SweptFootprint
+  {
+    // cell offset and heading bin of each sampled pose center
+    std::vector<std::tuple<int, int, unsigned int>> centers;
+    // deduplicated union of the footprint outline cell offsets
+    std::vector<std::pair<int, int>> outline_union;
+  };
+
   std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros_;
   std::vector<nav2_costmap_2d::Footprint> oriented_footprints_;
+  std::vector<SweptFootprint> swept_footprints_;
+  unsigned int footprint_generation_{0};
   nav2_costmap_2d::Footprint unoriented_footprint_;
   float footprint_cost_;
-  bool footprint_is_radius_;
+  bool footprint_is_radius_{false};
   std::vector<float> angles_;
   float possible_collision_cost_{-1};
   rclcpp::Logger logger_{rclcpp::get_logger("SmacPlannerCollisionChecker")};
@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "nav2_costmap_2d/costmap_2d_ros.hpp"
 #include "nav2_smac_planner/constants.hpp"
@@ -101,6 +102,31 @@ protected:
     const unsigned int & new_mx,
     const unsigned int & new_my);
 
+  /**
+   * @brief Reduce a rectangle of downsampled cells from the original costmap,
+   * row-wise over contiguous memory so the reductions vectorize
+   * @param start_dx First X-coordinate of the downsampled rectangle
+   * @param start_dy First Y-coordinate of the downsampled rectangle
+   * @param end_dx One past the last X-coordinate of the downsampled rectangle
+   * @param end_dy One past the last Y-coordinate of the downsampled rectangle
+   */
+  void downsampleRegion(
+    const unsigned int & start_dx, const unsigned int & start_dy,
+    const unsigned int & end_dx, const unsigned int & end_dy);
+
+  /**
+   * @brief Find the rectangle of original costmap cells that changed since
+   * the snapshot taken by the previous downsample() call
+   * @param min_x Lowest changed X-coordinate, set if any changed
+   * @param min_y Lowest changed Y-coordinate, set if any changed
+   * @param max_x One past the highest changed X-coordinate, set if any changed
+   * @param max_y One past the highest changed Y-coordinate, set if any changed
+   * @return whether any cell changed
+   */
+  bool findChangedSourceBounds(
+    unsigned int & min_x, unsigned int & min_y,
+    unsigned int & max_x, unsigned int & max_y);
+
   unsigned int _size_x;
   unsigned int _size_y;
   unsigned int _downsampled_size_x;
@@ -111,6 +137,9 @@ protected:
   nav2_costmap_2d::Costmap2D * _costmap;
   std::unique_ptr<nav2_costmap_2d::Costmap2D> _downsampled_costmap;
   std::unique_ptr<nav2_costmap_2d::Costmap2DPublisher> _downsampled_costmap_pub;
+  // Copy of the original costmap at the previous downsample() call, to
+  // limit steady-state updates to the cells that actually changed
+  std::vector<unsigned char> _source_snapshot;
 };
 
 }  // namespace nav2_smac_planner
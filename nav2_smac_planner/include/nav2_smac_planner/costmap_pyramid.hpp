@@ -0,0 +1,140 @@
+// Copyright (c) 2026, Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License. Reserved.
+
+#ifndef NAV2_SMAC_PLANNER__COSTMAP_PYRAMID_HPP_
+#define NAV2_SMAC_PLANNER__COSTMAP_PYRAMID_HPP_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "nav2_costmap_2d/costmap_2d_ros.hpp"
+#include "nav2_smac_planner/costmap_downsampler.hpp"
+
+namespace nav2_smac_planner
+{
+
+/**
+ * @class nav2_smac_planner::CostmapPyramid
+ * @brief A set of downsampled levels of one costmap, shared between the
+ * planner plugins running on it so that each resolution is maintained
+ * once per map update rather than once per planner. Levels are updated
+ * incrementally from the cells that changed since the previous request.
+ * Plan requests on one costmap are serialized by the planner server; the
+ * internal mutex only guards level creation against concurrent configure.
+ */
+class CostmapPyramid
+{
+public:
+  /**
+   * @brief Get the pyramid shared by the planners of the given costmap,
+   * creating it on first use
+   * @param costmap The costmap the pyramid is built over
+   * @return Shared pyramid handle
+   */
+  static std::shared_ptr<CostmapPyramid> getOrCreate(nav2_costmap_2d::Costmap2D * costmap);
+
+  /**
+   * @brief A constructor for CostmapPyramid
+   * @param costmap The costmap the pyramid is built over
+   */
+  explicit CostmapPyramid(nav2_costmap_2d::Costmap2D * costmap);
+
+  /**
+   * @brief Get the level downsampled by the given factor, refreshed from
+   * the cells of the base costmap that changed since the last request.
+   * Must be called with the base costmap lock held (or on a snapshot
+   * that cannot change underneath the downsampler).
+   * @param factor Multiplier for the costmap resolution
+   * @return The downsampled costmap, owned by the pyramid
+   */
+  nav2_costmap_2d::Costmap2D * getLevel(const unsigned int & factor);
+
+  /**
+   * @brief Attach a ROS publisher to a level so it is published on every
+   * refresh, preserving the per-planner downsampled costmap topic. No-op
+   * if the level already publishes.
+   * @param node Lifecycle node pointer
+   * @param global_frame The ID of the global frame used by the costmap
+   * @param topic_name The name of the topic to publish the level on
+   * @param factor Multiplier for the costmap resolution
+   */
+  void addLevelPublisher(
+    const nav2_util::LifecycleNode::WeakPtr & node,
+    const std::string & global_frame,
+    const std::string & topic_name,
+    const unsigned int & factor);
+
+  /**
+   * @brief Activate the level publishers, refcounted across the planners
+   * sharing this pyramid
+   */
+  void on_activate();
+
+  /**
+   * @brief Deactivate the level publishers once all planners deactivated
+   */
+  void on_deactivate();
+
+  /**
+   * @brief Find a start-goal corridor at a coarse level and mark it in a
+   * base-resolution cell mask, for pruning a subsequent fine search.
+   * Runs a lightweight 8-connected grid search on the level; each coarse
+   * cell of the result is stamped into the mask as its block of base
+   * cells dilated by the given radius. Same locking contract as
+   * getLevel().
+   * @param factor Multiplier of the coarse level to search
+   * @param start_x X-coordinate of the start, in base costmap cells
+   * @param start_y Y-coordinate of the start, in base costmap cells
+   * @param goal_x X-coordinate of the goal, in base costmap cells
+   * @param goal_y Y-coordinate of the goal, in base costmap cells
+   * @param radius_cells Dilation radius of the corridor, in base cells
+   * @param mask Set to 1 for base cells inside the corridor, 0 outside;
+   * resized to the base costmap
+   * @return whether the coarse search connected start and goal
+   */
+  bool findCorridor(
+    const unsigned int & factor,
+    const unsigned int & start_x, const unsigned int & start_y,
+    const unsigned int & goal_x, const unsigned int & goal_y,
+    const unsigned int & radius_cells,
+    std::vector<uint8_t> & mask);
+
+protected:
+  /**
+   * @brief Get the downsampler of a level, creating a publisher-less one
+   * on first use. Must be called with _mutex held.
+   * @param factor Multiplier for the costmap resolution
+   * @return Reference to the level's downsampler
+   */
+  CostmapDownsampler & getDownsampler(const unsigned int & factor);
+
+  nav2_costmap_2d::Costmap2D * _costmap;
+  std::mutex _mutex;
+  std::map<unsigned int, std::unique_ptr<CostmapDownsampler>> _levels;
+  std::set<unsigned int> _publishing_levels;
+  int _activations;
+
+  // One pyramid per costmap, shared by every planner instance in this
+  // library; dropped once the last planner releases its handle
+  static std::mutex _registry_mutex;
+  static std::map<nav2_costmap_2d::Costmap2D *, std::weak_ptr<CostmapPyramid>> _registry;
+};
+
+}  // namespace nav2_smac_planner
+
+#endif  // NAV2_SMAC_PLANNER__COSTMAP_PYRAMID_HPP_
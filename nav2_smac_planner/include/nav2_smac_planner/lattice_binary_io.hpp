@@ -0,0 +1,67 @@
+// Copyright (c) 2021, Samsung Research America
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License. Reserved.
+
+#ifndef NAV2_SMAC_PLANNER__LATTICE_BINARY_IO_HPP_
+#define NAV2_SMAC_PLANNER__LATTICE_BINARY_IO_HPP_
+
+#include <string>
+
+#include "nav2_smac_planner/types.hpp"
+
+namespace nav2_smac_planner
+{
+
+/**
+ * @brief Check whether a lattice file is in the compiled binary format,
+ * rather than the JSON format generated by the lattice generator
+ * @param lattice_filepath Filepath to the lattice file
+ * @return Whether the file starts with the binary format magic number
+ */
+bool isBinaryLatticeFile(const std::string & lattice_filepath);
+
+/**
+ * @brief Read the metadata of a binary lattice file
+ * @param lattice_filepath Filepath to the binary lattice file
+ * @return The lattice metadata
+ */
+LatticeMetadata readBinaryLatticeMetadata(const std::string & lattice_filepath);
+
+/**
+ * @brief Read the metadata and motion primitives of a binary lattice file.
+ * The file is memory mapped and decoded with a linear walk over its flat
+ * arrays, avoiding the JSON parsing cost at activation
+ * @param lattice_filepath Filepath to the binary lattice file
+ * @param lattice_metadata Metadata to populate
+ * @param primitives Motion primitives to populate, in file order
+ */
+void readBinaryLattice(
+  const std::string & lattice_filepath,
+  LatticeMetadata & lattice_metadata,
+  MotionPrimitives & primitives);
+
+/**
+ * @brief Write metadata and motion primitives as a binary lattice file,
+ * used by the lattice_binary_converter tool to compile JSON lattice files
+ * @param lattice_filepath Filepath of the binary lattice file to write
+ * @param lattice_metadata Metadata to persist
+ * @param primitives Motion primitives to persist
+ */
+void writeBinaryLattice(
+  const std::string & lattice_filepath,
+  const LatticeMetadata & lattice_metadata,
+  const MotionPrimitives & primitives);
+
+}  // namespace nav2_smac_planner
+
+#endif  // NAV2_SMAC_PLANNER__LATTICE_BINARY_IO_HPP_
@@ -0,0 +1,228 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_SMAC_PLANNER__NODE_GRAPH_HPP_
+#define NAV2_SMAC_PLANNER__NODE_GRAPH_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace nav2_smac_planner
+{
+
+/**
+ * @class nav2_smac_planner::NodeGraph
+ * @brief Arena-backed node pool with an open-addressing index, replacing a
+ * per-node allocating hash map for the A* search graph.
+ *
+ * Nodes are constructed in large fixed-capacity blocks in expansion order, so
+ * neighboring expansions land on neighboring cache lines and node pointers
+ * stay stable as the graph grows. The index maps cell indices to arena slots
+ * and only moves 12-byte entries when it grows, so resizing never touches or
+ * copies node objects.
+ */
+template<typename NodeT>
+class NodeGraph
+{
+public:
+  NodeGraph()
+  {
+    reserve(kBlockCapacity);
+  }
+
+  ~NodeGraph()
+  {
+    destroyNodes();
+    for (NodeT * block : blocks_) {
+      std::allocator<NodeT>().deallocate(block, kBlockCapacity);
+    }
+  }
+
+  NodeGraph(const NodeGraph &) = delete;
+  NodeGraph & operator=(const NodeGraph &) = delete;
+
+  /**
+   * @brief Size the index for an expected number of nodes
+   * @param num_nodes Expected node count
+   */
+  void reserve(const size_t & num_nodes)
+  {
+    size_t capacity = 2;
+    while (capacity * 3 < num_nodes * 4) {
+      capacity *= 2;
+    }
+    if (capacity > slots_.size()) {
+      rehash(capacity);
+    }
+  }
+
+  /**
+   * @brief Find an existing node
+   * @param index Cell index of the node
+   * @return Pointer to the node, or nullptr if not in the graph
+   */
+  NodeT * find(const uint64_t & index)
+  {
+    const size_t pos = probe(index);
+    return slots_[pos] == kEmpty ? nullptr : nodeAt(slots_[pos]);
+  }
+
+  /**
+   * @brief Get an existing node or construct it in the arena
+   * @param index Cell index of the node
+   * @return Pointer to the node, stable for the lifetime of the graph
+   */
+  NodeT * getOrCreate(const uint64_t & index)
+  {
+    if ((size_ + 1) * 4 > slots_.size() * 3) {
+      rehash(slots_.size() * 2);
+    }
+
+    const size_t pos = probe(index);
+    if (slots_[pos] != kEmpty) {
+      return nodeAt(slots_[pos]);
+    }
+
+    const size_t block = size_ / kBlockCapacity;
+    if (block == blocks_.size()) {
+      blocks_.emplace_back(std::allocator<NodeT>().allocate(kBlockCapacity));
+    }
+    NodeT * node = new (blocks_[block] + size_ % kBlockCapacity) NodeT(index);
+
+    slots_[pos] = static_cast<uint32_t>(size_++);
+    keys_[pos] = index;
+    return node;
+  }
+
+  /**
+   * @brief Get an existing node by index
+   * @param index Cell index of the node, which must be in the graph
+   * @return Reference to the node
+   */
+  NodeT & at(const uint64_t & index)
+  {
+    NodeT * node = find(index);
+    if (!node) {
+      throw std::out_of_range("Node index is not in the graph");
+    }
+    return *node;
+  }
+
+  /**
+   * @brief If the graph holds no nodes
+   */
+  bool empty() const
+  {
+    return size_ == 0;
+  }
+
+  /**
+   * @brief The number of nodes in the graph
+   */
+  size_t size() const
+  {
+    return size_;
+  }
+
+  /**
+   * @brief Destroy all nodes but keep the first arena block and the index
+   * storage for the next search, so steady-state planning does not allocate
+   */
+  void clear()
+  {
+    destroyNodes();
+    size_ = 0;
+    for (size_t b = 1; b < blocks_.size(); ++b) {
+      std::allocator<NodeT>().deallocate(blocks_[b], kBlockCapacity);
+    }
+    if (blocks_.size() > 1) {
+      blocks_.resize(1);
+    }
+    std::fill(slots_.begin(), slots_.end(), kEmpty);
+  }
+
+private:
+  /**
+   * @brief Linear probe for the position of index, or its insertion position
+   */
+  size_t probe(const uint64_t & index) const
+  {
+    size_t pos = hash(index) & (slots_.size() - 1);
+    while (slots_[pos] != kEmpty && keys_[pos] != index) {
+      pos = (pos + 1) & (slots_.size() - 1);
+    }
+    return pos;
+  }
+
+  /**
+   * @brief Mix the cell index into a well-distributed table hash (splitmix64)
+   */
+  static size_t hash(uint64_t index)
+  {
+    index += 0x9e3779b97f4a7c15ULL;
+    index = (index ^ (index >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    index = (index ^ (index >> 27)) * 0x94d049bb133111ebULL;
+    return static_cast<size_t>(index ^ (index >> 31));
+  }
+
+  /**
+   * @brief Grow the index to the given power-of-two capacity and reinsert
+   * the (key, slot) entries; node objects are not touched
+   */
+  void rehash(const size_t & capacity)
+  {
+    std::vector<uint32_t> old_slots = std::move(slots_);
+    std::vector<uint64_t> old_keys = std::move(keys_);
+    slots_.assign(capacity, kEmpty);
+    keys_.assign(capacity, 0);
+    for (size_t i = 0; i < old_slots.size(); ++i) {
+      if (old_slots[i] != kEmpty) {
+        const size_t pos = probe(old_keys[i]);
+        slots_[pos] = old_slots[i];
+        keys_[pos] = old_keys[i];
+      }
+    }
+  }
+
+  /**
+   * @brief The arena address of a slot
+   */
+  NodeT * nodeAt(const size_t & slot) const
+  {
+    return blocks_[slot / kBlockCapacity] + slot % kBlockCapacity;
+  }
+
+  void destroyNodes()
+  {
+    for (size_t slot = 0; slot < size_; ++slot) {
+      nodeAt(slot)->~NodeT();
+    }
+  }
+
+  static constexpr size_t kBlockCapacity = 100000;
+  static constexpr uint32_t kEmpty = 0xFFFFFFFFu;
+
+  std::vector<NodeT *> blocks_;      ///< fixed-capacity arena blocks
+  std::vector<uint32_t> slots_;      ///< open-addressing table of arena slots
+  std::vector<uint64_t> keys_;       ///< cell index stored per table entry
+  size_t size_{0};
+};
+
+}  // namespace nav2_smac_planner
+
+#endif  // NAV2_SMAC_PLANNER__NODE_GRAPH_HPP_
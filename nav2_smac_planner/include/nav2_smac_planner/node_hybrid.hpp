@@ -22,6 +22,7 @@
 #include <functional>
 #include <queue>
 #include <memory>
+#include <string>
 #include <utility>
 #include <limits>
 
@@ -94,9 +95,10 @@ struct HybridMotionTable
   /**
    * @brief Get projections of motion models
    * @param node Ptr to NodeHybrid
-   * @return A set of motion poses
+   * @param projection_list Set of motion poses to populate, reused across
+   * expansions to avoid allocating in the search hot loop
    */
-  MotionPoses getProjections(const NodeHybrid * node);
+  void getProjections(const NodeHybrid * node, MotionPoses & projection_list);
 
   /**
    * @brief Get the angular bin to use from a raw orientation
@@ -133,6 +135,7 @@ struct HybridMotionTable
   float travel_distance_reward;
   bool downsample_obstacle_heuristic;
   bool use_quadratic_cost_penalty;
+  bool incremental_obstacle_heuristic;
   ompl::base::StateSpacePtr state_space;
   std::vector<std::vector<double>> delta_xs;
   std::vector<std::vector<double>> delta_ys;
@@ -407,6 +410,44 @@ public:
     const unsigned int & dim_3_size,
     const SearchInfo & search_info);
 
+  /**
+   * @brief Memory map a persisted distance heuristic table cache file,
+   * validating it was generated with the same settings
+   * @param filepath Path of the cache file to map
+   * @param motion_model Motion model to use for state space
+   * @param dim_3_size Number of quantization bins for caching
+   * @param search_info Info containing minimum radius to use
+   * @param num_entries Number of table entries expected
+   * @return whether a matching table was mapped
+   */
+  static bool mapDistanceHeuristic(
+    const std::string & filepath,
+    const MotionModel & motion_model,
+    const unsigned int & dim_3_size,
+    const SearchInfo & search_info,
+    const uint64_t & num_entries);
+
+  /**
+   * @brief Persist the computed distance heuristic table to a cache file
+   * for later activations to memory map instead of recomputing
+   * @param filepath Path of the cache file to write
+   * @param motion_model Motion model to use for state space
+   * @param dim_3_size Number of quantization bins for caching
+   * @param search_info Info containing minimum radius to use
+   * @param num_entries Number of table entries to persist
+   */
+  static void persistDistanceHeuristic(
+    const std::string & filepath,
+    const MotionModel & motion_model,
+    const unsigned int & dim_3_size,
+    const SearchInfo & search_info,
+    const uint64_t & num_entries);
+
+  /**
+   * @brief Unmap the distance heuristic table cache file, if mapped
+   */
+  static void unmapDistanceHeuristic();
+
   /**
    * @brief Compute the Obstacle heuristic
    * @param node_coords Coordinates to get heuristic at
@@ -441,6 +482,33 @@ public:
     const unsigned int & start_x, const unsigned int & start_y,
     const unsigned int & goal_x, const unsigned int & goal_y);
 
+  /**
+   * @brief reset the obstacle heuristic state, seeding the expansion from
+   * a set of candidate goals so one envelope serves all of them
+   * @param costmap_ros Costmap to use
+   * @param start_x X coordinate of the start
+   * @param start_y Y coordinate of the start
+   * @param goals Candidate goal cells to seed the expansion from
+   */
+  static void resetObstacleHeuristic(
+    std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros,
+    const unsigned int & start_x, const unsigned int & start_y,
+    const std::vector<std::pair<unsigned int, unsigned int>> & goals);
+
+  /**
+   * @brief Repair the obstacle heuristic state incrementally for an
+   * unchanged goal, invalidating and re-seeding only the region downstream
+   * of cells whose sampled cost changed since the previous request
+   * @param costmap Costmap to sample costs from
+   * @param goal_index Heuristic cell index of the (unchanged) goal
+   * @param size_x X size of the heuristic lookup table
+   * @return Whether the repair succeeded; false if a cost decreased, which
+   * may improve cells outside the invalidated region and requires a full reset
+   */
+  static bool repairObstacleHeuristic(
+    nav2_costmap_2d::Costmap2D * costmap,
+    const unsigned int & goal_index, const unsigned int & size_x);
+
   /**
    * @brief Using the inflation layer, find the footprint's adjusted cost
    * if the robot is non-circular
@@ -478,6 +546,7 @@ public:
   {
     inflation_layer.reset();
     costmap_ros.reset();
+    unmapDistanceHeuristic();
   }
 
   NodeHybrid * parent;
@@ -489,11 +558,20 @@ public:
   // Wavefront lookup and queue for continuing to expand as needed
   static LookupTable obstacle_heuristic_lookup_table;
   static ObstacleHeuristicQueue obstacle_heuristic_queue;
+  // Sampled costs and goal backing the obstacle heuristic of the previous
+  // request, used to repair the lookup table incrementally
+  static LookupTable sampled_cost_cache;
+  static unsigned int obstacle_heuristic_goal_index;
 
   static std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros;
   static std::shared_ptr<nav2_costmap_2d::InflationLayer> inflation_layer;
   // Dubin / Reeds-Shepp lookup and size for dereferencing
   static LookupTable dist_heuristic_lookup_table;
+  // Active table for lookups: the in-memory table above or a read-only
+  // memory mapped cache file persisted across lifecycle activations
+  static float * dist_heuristic_table_ptr;
+  static void * dist_heuristic_mapping;
+  static size_t dist_heuristic_mapping_size;
   static float size_lookup;
 
 private:
@@ -68,11 +68,13 @@ struct LatticeMotionTable
    * @brief Get projections of motion models
    * @param node Ptr to NodeLattice
    * @param Reference direction change index
-   * @return A set of motion poses
+   * @param primitive_projection_list Set of motion primitives to populate,
+   * reused across expansions to avoid allocating in the search hot loop
    */
-  MotionPrimitivePtrs getMotionPrimitives(
+  void getMotionPrimitives(
     const NodeLattice * node,
-    unsigned int & direction_change_index);
+    unsigned int & direction_change_index,
+    MotionPrimitivePtrs & primitive_projection_list);
 
   /**
    * @brief Get file metadata needed
@@ -368,6 +370,20 @@ public:
     NodeHybrid::resetObstacleHeuristic(costmap_ros, start_x, start_y, goal_x, goal_y);
   }
 
+  /**
+   * @brief Compute the wavefront heuristic seeded from a set of candidate goals
+   * @param costmap Costmap to use
+   * @param goals Candidate goal cells to seed the expansion from
+   */
+  static void resetObstacleHeuristic(
+    std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros,
+    const unsigned int & start_x, const unsigned int & start_y,
+    const std::vector<std::pair<unsigned int, unsigned int>> & goals)
+  {
+    // State Lattice and Hybrid-A* share this heuristics
+    NodeHybrid::resetObstacleHeuristic(costmap_ros, start_x, start_y, goals);
+  }
+
   /**
    * @brief Compute the Obstacle heuristic
    * @param node_coords Coordinates to get heuristic at
@@ -23,7 +23,7 @@
 #include "nav2_smac_planner/a_star.hpp"
 #include "nav2_smac_planner/smoother.hpp"
 #include "nav2_smac_planner/utils.hpp"
-#include "nav2_smac_planner/costmap_downsampler.hpp"
+#include "nav2_smac_planner/costmap_pyramid.hpp"
 #include "nav_msgs/msg/occupancy_grid.hpp"
 #include "nav2_core/global_planner.hpp"
 #include "nav_msgs/msg/path.hpp"
@@ -102,13 +102,17 @@ protected:
   GridCollisionChecker _collision_checker;
   std::unique_ptr<Smoother> _smoother;
   nav2_costmap_2d::Costmap2D * _costmap;
-  std::unique_ptr<CostmapDownsampler> _costmap_downsampler;
+  std::shared_ptr<CostmapPyramid> _pyramid;
   rclcpp::Clock::SharedPtr _clock;
   rclcpp::Logger _logger{rclcpp::get_logger("SmacPlanner2D")};
   std::string _global_frame, _name;
   float _tolerance;
   int _downsampling_factor;
   bool _downsample_costmap;
+  bool _coarse_to_fine;
+  int _coarse_to_fine_factor;
+  double _corridor_width;
+  std::vector<uint8_t> _expansion_mask;
   rclcpp_lifecycle::LifecyclePublisher<nav_msgs::msg::Path>::SharedPtr _raw_plan_publisher;
   double _max_planning_time;
   bool _allow_unknown;
@@ -22,9 +22,11 @@
 #include "nav2_smac_planner/a_star.hpp"
 #include "nav2_smac_planner/smoother.hpp"
 #include "nav2_smac_planner/utils.hpp"
-#include "nav2_smac_planner/costmap_downsampler.hpp"
+#include "nav2_smac_planner/costmap_pyramid.hpp"
 #include "nav_msgs/msg/occupancy_grid.hpp"
+#include "nav2_msgs/msg/expansion_telemetry.hpp"
 #include "nav2_core/global_planner.hpp"
+#include "nav2_core/goal_set_planner.hpp"
 #include "nav_msgs/msg/path.hpp"
 #include "nav2_costmap_2d/costmap_2d_ros.hpp"
 #include "nav2_costmap_2d/costmap_2d.hpp"
@@ -37,7 +39,7 @@
 namespace nav2_smac_planner
 {
 
-class SmacPlannerHybrid : public nav2_core::GlobalPlanner
+class SmacPlannerHybrid : public nav2_core::GlobalPlanner, public nav2_core::GoalSetPlanner
 {
 public:
   /**
@@ -89,6 +91,25 @@ public:
     const geometry_msgs::msg::PoseStamped & goal,
     std::function<bool()> cancel_checker)  override;
 
+  /**
+   * @brief Creating a plan to the cheapest of a set of candidate goals in
+   * one search, sharing the heuristic envelope across the candidates
+   * @param start Start pose
+   * @param goals Candidate goal poses
+   * @param cancel_checker Function to check if the action has been canceled
+   * @param best_goal_index Set to the index of the candidate the path
+   * reaches, -1 if none was settled
+   * @param goal_costs Set to per-candidate planning costs, -1 for
+   * candidates not reached
+   * @return nav2_msgs::Path of the generated path
+   */
+  nav_msgs::msg::Path createPlanToGoalSet(
+    const geometry_msgs::msg::PoseStamped & start,
+    const std::vector<geometry_msgs::msg::PoseStamped> & goals,
+    std::function<bool()> cancel_checker,
+    int & best_goal_index,
+    std::vector<float> & goal_costs) override;
+
 protected:
   /**
    * @brief Callback executed when a paramter change is detected
@@ -97,6 +118,13 @@ protected:
   rcl_interfaces::msg::SetParametersResult
   dynamicParametersCallback(std::vector<rclcpp::Parameter> parameters);
 
+  /**
+   * @brief Publish the telemetry captured during the last search, if anyone
+   * is subscribed
+   * @param planning_time Wall-clock search time, in seconds
+   */
+  void publishExpansionTelemetry(const double & planning_time);
+
   std::unique_ptr<AStarAlgorithm<NodeHybrid>> _a_star;
   GridCollisionChecker _collision_checker;
   std::unique_ptr<Smoother> _smoother;
@@ -104,10 +132,11 @@ protected:
   rclcpp::Logger _logger{rclcpp::get_logger("SmacPlannerHybrid")};
   nav2_costmap_2d::Costmap2D * _costmap;
   std::shared_ptr<nav2_costmap_2d::Costmap2DROS> _costmap_ros;
-  std::unique_ptr<CostmapDownsampler> _costmap_downsampler;
+  std::shared_ptr<CostmapPyramid> _pyramid;
   std::string _global_frame, _name;
   float _lookup_table_dim;
   float _tolerance;
+  double _goal_heading_tolerance;
   bool _downsample_costmap;
   int _downsampling_factor;
   double _angle_bin_size;
@@ -121,6 +150,8 @@ protected:
   double _lookup_table_size;
   double _minimum_turning_radius_global_coords;
   bool _debug_visualizations;
+  bool _debug_expansion_telemetry;
+  ExpansionTelemetry _expansion_telemetry;
   std::string _motion_model_for_search;
   MotionModel _motion_model;
   rclcpp_lifecycle::LifecyclePublisher<nav_msgs::msg::Path>::SharedPtr _raw_plan_publisher;
@@ -128,6 +159,8 @@ protected:
     _planned_footprints_publisher;
   rclcpp_lifecycle::LifecyclePublisher<geometry_msgs::msg::PoseArray>::SharedPtr
     _expansions_publisher;
+  rclcpp_lifecycle::LifecyclePublisher<nav2_msgs::msg::ExpansionTelemetry>::SharedPtr
+    _expansion_telemetry_publisher;
   std::mutex _mutex;
   rclcpp_lifecycle::LifecycleNode::WeakPtr _node;
 
@@ -133,24 +133,24 @@ protected:
     const double & max_time);
 
   /**
-   * @brief Get the field value for a given dimension
-   * @param msg Current pose to sample
-   * @param dim Dimension ID of interest
-   * @return dim value
+   * @brief Copy the positions of a path msg into flat coordinate arrays
+   * @param path Path to read from
+   * @param xs X coordinates to populate
+   * @param ys Y coordinates to populate
    */
-  inline double getFieldByDim(
-    const geometry_msgs::msg::PoseStamped & msg,
-    const unsigned int & dim);
+  void pathToArrays(
+    const nav_msgs::msg::Path & path,
+    std::vector<double> & xs, std::vector<double> & ys);
 
   /**
-   * @brief Set the field value for a given dimension
-   * @param msg Current pose to sample
-   * @param dim Dimension ID of interest
-   * @param value to set the dimention to for the pose
+   * @brief Write flat coordinate arrays back into a path msg's positions
+   * @param xs X coordinates to read from
+   * @param ys Y coordinates to read from
+   * @param path Path to populate
    */
-  inline void setFieldByDim(
-    geometry_msgs::msg::PoseStamped & msg, const unsigned int dim,
-    const double & value);
+  void arraysToPath(
+    const std::vector<double> & xs, const std::vector<double> & ys,
+    nav_msgs::msg::Path & path);
 
   /**
    * @brief Finds the starting and end indices of path segments where
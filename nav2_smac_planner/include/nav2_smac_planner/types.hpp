@@ -15,6 +15,10 @@
 #ifndef NAV2_SMAC_PLANNER__TYPES_HPP_
 #define NAV2_SMAC_PLANNER__TYPES_HPP_
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
 #include <vector>
 #include <utility>
 #include <string>
@@ -46,11 +50,81 @@ struct SearchInfo
   float analytic_expansion_max_cost{200.0};
   bool analytic_expansion_max_cost_override{false};
   std::string lattice_filepath;
+  std::string lookup_table_cache_path;
   bool cache_obstacle_heuristic{false};
   bool allow_reverse_expansion{false};
   bool allow_primitive_interpolation{false};
   bool downsample_obstacle_heuristic{true};
   bool use_quadratic_cost_penalty{false};
+  bool incremental_obstacle_heuristic{false};
+  bool use_bidirectional_search{false};
+};
+
+/**
+ * @struct nav2_smac_planner::ExpansionTelemetry
+ * @brief Preallocated introspection buffer for a single search, recording
+ * where expansion effort went so search parameters can be tuned from field
+ * data. All recording is a handful of increments per expansion, cheap
+ * enough to leave enabled in production
+ */
+struct ExpansionTelemetry
+{
+  /// Side length of a telemetry tile, in costmap cells
+  static constexpr unsigned int tile_size{32};
+  /// Buckets of the heuristic-share histogram over [0, 1]
+  static constexpr unsigned int histogram_buckets{10};
+
+  unsigned int tiles_x{0};
+  unsigned int tiles_y{0};
+  /// Expansions per tile, row-major from the costmap origin
+  std::vector<uint32_t> tile_expansions;
+  /// Distribution of h / (g + h) at expansion time, in even buckets
+  std::array<uint32_t, histogram_buckets> heuristic_share_histogram{};
+  uint32_t expansions{0};
+  /// Queue pops discarded because the node was already visited
+  uint32_t duplicate_pops{0};
+  uint32_t analytic_attempts{0};
+  uint32_t analytic_successes{0};
+
+  /**
+   * @brief Size the tile grid for a costmap and zero all counters. Reuses
+   * the tile vector's capacity, so steady-state resets do not allocate
+   * @param x_size Costmap size in cells, X
+   * @param y_size Costmap size in cells, Y
+   */
+  void reset(const unsigned int & x_size, const unsigned int & y_size)
+  {
+    tiles_x = (x_size + tile_size - 1) / tile_size;
+    tiles_y = (y_size + tile_size - 1) / tile_size;
+    tile_expansions.assign(static_cast<size_t>(tiles_x) * tiles_y, 0);
+    heuristic_share_histogram.fill(0);
+    expansions = 0;
+    duplicate_pops = 0;
+    analytic_attempts = 0;
+    analytic_successes = 0;
+  }
+
+  /**
+   * @brief Record one expansion popped with key f = g + h
+   * @param x Cell coordinate of the expanded node, X
+   * @param y Cell coordinate of the expanded node, Y
+   * @param g Accumulated cost of the expanded node
+   * @param f Queue key the node was popped with
+   */
+  inline void countExpansion(const float & x, const float & y, const float & g, const float & f)
+  {
+    expansions++;
+    const unsigned int tx = std::min(static_cast<unsigned int>(x) / tile_size, tiles_x - 1);
+    const unsigned int ty = std::min(static_cast<unsigned int>(y) / tile_size, tiles_y - 1);
+    tile_expansions[static_cast<size_t>(ty) * tiles_x + tx]++;
+    if (f > 0.0f) {
+      const float share = std::max(0.0f, f - g) / f;
+      const unsigned int bucket = std::min(
+        static_cast<unsigned int>(share * static_cast<float>(histogram_buckets)),
+        histogram_buckets - 1);
+      heuristic_share_histogram[bucket]++;
+    }
+  }
 };
 
 /**
@@ -186,6 +260,12 @@ struct MotionPrimitive
   float straight_length;
   bool left_turn;
   MotionPoses poses;
+
+  // Swept collision footprints lazily registered with the collision checker
+  // on first use, one per travel direction, valid for the noted generation
+  unsigned int swept_handle_forward{std::numeric_limits<unsigned int>::max()};
+  unsigned int swept_handle_backward{std::numeric_limits<unsigned int>::max()};
+  unsigned int swept_generation{0};
 };
 
 typedef std::vector<MotionPrimitive> MotionPrimitives;
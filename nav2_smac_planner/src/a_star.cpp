@@ -14,11 +14,13 @@
 // limitations under the License. Reserved.
 
 #include <omp.h>
+#include <atomic>
 #include <cmath>
 #include <stdexcept>
 #include <memory>
 #include <algorithm>
 #include <limits>
+#include <mutex>
 #include <type_traits>
 #include <chrono>
 #include <thread>
@@ -42,11 +44,18 @@ AStarAlgorithm<NodeT>::AStarAlgorithm(
   _max_planning_time(0),
   _x_size(0),
   _y_size(0),
+  _lookup_table_size(0.0f),
   _search_info(search_info),
   _goal_coordinates(Coordinates()),
   _start(nullptr),
   _goal(nullptr),
-  _motion_model(motion_model)
+  _best_goal_index(-1),
+  _incumbent_goal_index(-1),
+  _incumbent_total_cost(0.0f),
+  _incumbent_path_cost(0.0f),
+  _motion_model(motion_model),
+  _expansion_mask(nullptr),
+  _telemetry(nullptr)
 {
   _graph.reserve(100000);
 }
@@ -75,6 +84,7 @@ void AStarAlgorithm<NodeT>::initialize(
     NodeT::precomputeDistanceHeuristic(lookup_table_size, _motion_model, dim_3_size, _search_info);
   }
   _is_initialized = true;
+  _lookup_table_size = lookup_table_size;
   _dim3_size = dim_3_size;
   _expander = std::make_unique<AnalyticExpansion<NodeT>>(
     _motion_model, _search_info, _traverse_unknown, _dim3_size);
@@ -104,6 +114,62 @@ void AStarAlgorithm<Node2D>::initialize(
     _motion_model, _search_info, _traverse_unknown, _dim3_size);
 }
 
+template<typename NodeT>
+void AStarAlgorithm<NodeT>::updateSearchInfo(
+  const MotionModel & motion_model,
+  const SearchInfo & search_info,
+  const float & lookup_table_size,
+  const unsigned int & dim_3_size)
+{
+  const bool heuristic_inputs_changed =
+    motion_model != _motion_model ||
+    dim_3_size != _dim3_size ||
+    lookup_table_size != _lookup_table_size ||
+    search_info.minimum_turning_radius != _search_info.minimum_turning_radius ||
+    search_info.lookup_table_cache_path != _search_info.lookup_table_cache_path;
+
+  _motion_model = motion_model;
+  _search_info = search_info;
+  _dim3_size = dim_3_size;
+  _lookup_table_size = lookup_table_size;
+
+  if (_is_initialized && heuristic_inputs_changed) {
+    NodeT::precomputeDistanceHeuristic(lookup_table_size, _motion_model, dim_3_size, _search_info);
+  }
+
+  // Penalties and primitives live in the node's static motion table; its
+  // init skips primitive recomputation when the shaping inputs are unchanged
+  if (_x_size > 0 && _y_size > 0) {
+    NodeT::initMotionModel(_motion_model, _x_size, _y_size, _dim3_size, _search_info);
+  }
+
+  _expander = std::make_unique<AnalyticExpansion<NodeT>>(
+    _motion_model, _search_info, _traverse_unknown, _dim3_size);
+}
+
+template<>
+void AStarAlgorithm<Node2D>::updateSearchInfo(
+  const MotionModel & motion_model,
+  const SearchInfo & search_info,
+  const float & /*lookup_table_size*/,
+  const unsigned int & dim_3_size)
+{
+  if (dim_3_size != 1) {
+    throw std::runtime_error("Node type Node2D cannot be given non-1 dim 3 quantization.");
+  }
+
+  _motion_model = motion_model;
+  _search_info = search_info;
+  _dim3_size = dim_3_size;
+
+  if (_x_size > 0 && _y_size > 0) {
+    Node2D::initMotionModel(_motion_model, _x_size, _y_size, _dim3_size, _search_info);
+  }
+
+  _expander = std::make_unique<AnalyticExpansion<Node2D>>(
+    _motion_model, _search_info, _traverse_unknown, _dim3_size);
+}
+
 template<typename NodeT>
 void AStarAlgorithm<NodeT>::setCollisionChecker(GridCollisionChecker * collision_checker)
 {
@@ -123,15 +189,33 @@ void AStarAlgorithm<NodeT>::setCollisionChecker(GridCollisionChecker * collision
 }
 
 template<typename NodeT>
-typename AStarAlgorithm<NodeT>::NodePtr AStarAlgorithm<NodeT>::addToGraph(
-  const uint64_t & index)
+void AStarAlgorithm<NodeT>::setExpansionMask(const std::vector<uint8_t> * mask)
+{
+  _expansion_mask = mask;
+}
+
+template<typename NodeT>
+void AStarAlgorithm<NodeT>::setExpansionTelemetry(ExpansionTelemetry * telemetry)
+{
+  _telemetry = telemetry;
+}
+
+template<typename NodeT>
+bool AStarAlgorithm<NodeT>::inExpansionMask(const NodePtr & node)
 {
-  auto iter = _graph.find(index);
-  if (iter != _graph.end()) {
-    return &(iter->second);
+  if (_expansion_mask == nullptr) {
+    return true;
   }
+  const Coordinates coords = NodeT::getCoords(node->getIndex(), getSizeX(), getSizeDim3());
+  return (*_expansion_mask)[static_cast<size_t>(coords.y) * getSizeX() +
+         static_cast<size_t>(coords.x)] != 0;
+}
 
-  return &(_graph.emplace(index, NodeT(index)).first->second);
+template<typename NodeT>
+typename AStarAlgorithm<NodeT>::NodePtr AStarAlgorithm<NodeT>::addToGraph(
+  const uint64_t & index)
+{
+  return _graph.getOrCreate(index);
 }
 
 template<>
@@ -188,6 +272,20 @@ void AStarAlgorithm<NodeT>::populateExpansionsLog(
     NodeT::motion_table.getAngleFromBin(coords.theta));
 }
 
+template<>
+void AStarAlgorithm<Node2D>::recordExpansion(const NodePtr & node, const float & current_key)
+{
+  Node2D::Coordinates coords = node->getCoords(node->getIndex());
+  _telemetry->countExpansion(coords.x, coords.y, node->getAccumulatedCost(), current_key);
+}
+
+template<typename NodeT>
+void AStarAlgorithm<NodeT>::recordExpansion(const NodePtr & node, const float & current_key)
+{
+  _telemetry->countExpansion(
+    node->pose.x, node->pose.y, node->getAccumulatedCost(), current_key);
+}
+
 template<>
 void AStarAlgorithm<Node2D>::setGoal(
   const float & mx,
@@ -198,6 +296,9 @@ void AStarAlgorithm<Node2D>::setGoal(
     throw std::runtime_error("Node type Node2D cannot be given non-zero goal dim 3.");
   }
 
+  _goals.clear();
+  _goals_coordinates.clear();
+  _goal_terminal_costs.clear();
   _goal = addToGraph(
     Node2D::getIndex(
       static_cast<unsigned int>(mx),
@@ -212,6 +313,12 @@ void AStarAlgorithm<NodeT>::setGoal(
   const float & my,
   const unsigned int & dim_3)
 {
+  // a preceding goal-set search leaves a multi-seeded heuristic envelope
+  // behind, which a cached single-goal request must not reuse
+  const bool previous_was_goal_set = !_goals_coordinates.empty();
+  _goals.clear();
+  _goals_coordinates.clear();
+  _goal_terminal_costs.clear();
   _goal = addToGraph(
     NodeT::getIndex(
       static_cast<unsigned int>(mx),
@@ -220,7 +327,9 @@ void AStarAlgorithm<NodeT>::setGoal(
 
   typename NodeT::Coordinates goal_coords(mx, my, dim_3);
 
-  if (!_search_info.cache_obstacle_heuristic || goal_coords != _goal_coordinates) {
+  if (previous_was_goal_set || !_search_info.cache_obstacle_heuristic ||
+    goal_coords != _goal_coordinates)
+  {
     if (!_start) {
       throw std::runtime_error("Start must be set before goal.");
     }
@@ -233,6 +342,76 @@ void AStarAlgorithm<NodeT>::setGoal(
   _goal->setPose(_goal_coordinates);
 }
 
+template<>
+void AStarAlgorithm<Node2D>::setGoals(
+  const CoordinateVector & goals,
+  const std::vector<float> & terminal_costs)
+{
+  if (goals.empty()) {
+    throw std::runtime_error("Goal set cannot be empty.");
+  }
+  if (!terminal_costs.empty() && terminal_costs.size() != goals.size()) {
+    throw std::runtime_error("Goal set and terminal costs sizes do not match.");
+  }
+
+  _goals.clear();
+  _goal_terminal_costs = terminal_costs;
+  _goals_coordinates = goals;
+  for (const Coordinates & coords : goals) {
+    _goals.push_back(
+      addToGraph(
+        Node2D::getIndex(
+          static_cast<unsigned int>(coords.x),
+          static_cast<unsigned int>(coords.y),
+          getSizeX())));
+  }
+  _goal = _goals.front();
+  _goal_coordinates = goals.front();
+}
+
+template<typename NodeT>
+void AStarAlgorithm<NodeT>::setGoals(
+  const CoordinateVector & goals,
+  const std::vector<float> & terminal_costs)
+{
+  if (goals.empty()) {
+    throw std::runtime_error("Goal set cannot be empty.");
+  }
+  if (!terminal_costs.empty() && terminal_costs.size() != goals.size()) {
+    throw std::runtime_error("Goal set and terminal costs sizes do not match.");
+  }
+
+  if (!_start) {
+    throw std::runtime_error("Start must be set before goal.");
+  }
+
+  _goals.clear();
+  _goal_terminal_costs = terminal_costs;
+  _goals_coordinates = goals;
+  std::vector<std::pair<unsigned int, unsigned int>> goal_cells;
+  goal_cells.reserve(goals.size());
+  for (const Coordinates & coords : goals) {
+    NodePtr goal = addToGraph(
+      NodeT::getIndex(
+        static_cast<unsigned int>(coords.x),
+        static_cast<unsigned int>(coords.y),
+        static_cast<unsigned int>(coords.theta)));
+    goal->setPose(coords);
+    _goals.push_back(goal);
+    goal_cells.emplace_back(
+      static_cast<unsigned int>(coords.x), static_cast<unsigned int>(coords.y));
+  }
+
+  // One obstacle heuristic envelope seeded from every candidate serves the
+  // whole set; with the admissible shared heuristic, the first candidate
+  // settled is the cheapest
+  NodeT::resetObstacleHeuristic(
+    _collision_checker->getCostmapROS(), _start->pose.x, _start->pose.y, goal_cells);
+
+  _goal = _goals.front();
+  _goal_coordinates = goals.front();
+}
+
 template<typename NodeT>
 bool AStarAlgorithm<NodeT>::areInputsValid()
 {
@@ -247,10 +426,22 @@ bool AStarAlgorithm<NodeT>::areInputsValid()
   }
 
   // Check if ending point is valid
-  if (getToleranceHeuristic() < 0.001 &&
-    !_goal->isNodeValid(_traverse_unknown, _collision_checker))
-  {
-    throw nav2_core::GoalOccupied("Goal was in lethal cost");
+  if (getToleranceHeuristic() < 0.001) {
+    if (_goals.empty()) {
+      if (!_goal->isNodeValid(_traverse_unknown, _collision_checker)) {
+        throw nav2_core::GoalOccupied("Goal was in lethal cost");
+      }
+    } else {
+      // a goal set only needs one reachable candidate; occupied candidates
+      // simply remain unsettled
+      bool any_valid = false;
+      for (const NodePtr & goal : _goals) {
+        any_valid = any_valid || goal->isNodeValid(_traverse_unknown, _collision_checker);
+      }
+      if (!any_valid) {
+        throw nav2_core::GoalOccupied("All goal candidates were in lethal cost");
+      }
+    }
   }
 
   // Note: We do not check the if the start is valid because it is cleared
@@ -264,9 +455,23 @@ bool AStarAlgorithm<NodeT>::createPath(
   std::function<bool()> cancel_checker,
   std::vector<std::tuple<float, float, float>> * expansions_log)
 {
+  if constexpr (std::is_same<NodeT, Node2D>::value) {
+    // Goal sets terminate on whichever candidate settles first, which the
+    // two-tree meeting logic cannot express; fall through to the
+    // unidirectional search in that case
+    if (_search_info.use_bidirectional_search && _goals.empty()) {
+      return createPathBidirectional(path, iterations, tolerance, cancel_checker);
+    }
+  }
+
   steady_clock::time_point start_time = steady_clock::now();
   _tolerance = tolerance;
   _best_heuristic_node = {std::numeric_limits<float>::max(), 0};
+  _best_goal_index = -1;
+  _goal_set_costs.assign(_goals.size(), -1.0f);
+  _incumbent_goal_index = -1;
+  _incumbent_total_cost = std::numeric_limits<float>::max();
+  _incumbent_path_cost = 0.0f;
   clearQueue();
 
   if (!areInputsValid()) {
@@ -280,7 +485,11 @@ bool AStarAlgorithm<NodeT>::createPath(
   // Optimization: preallocate all variables
   NodePtr current_node = nullptr;
   NodePtr neighbor = nullptr;
+  float current_key = 0.0f;
   NodePtr expansion_result = nullptr;
+  NodePtr expansion_goal = nullptr;
+  float expansion_heuristic = 0.0;
+  float expansion_cost_basis = 0.0;
   float g_cost = 0.0;
   NodeVector neighbors;
   int approach_iterations = 0;
@@ -312,11 +521,19 @@ bool AStarAlgorithm<NodeT>::createPath(
       std::chrono::duration<double> planning_duration =
         std::chrono::duration_cast<std::chrono::duration<double>>(steady_clock::now() - start_time);
       if (static_cast<double>(planning_duration.count()) >= _max_planning_time) {
+        // A candidate settled before the timeout still beats failing
+        if (_incumbent_goal_index >= 0) {
+          _best_goal_index = _incumbent_goal_index;
+          finalizeGoalSetCosts();
+          _goal_set_costs[_best_goal_index] = _incumbent_path_cost;
+          return _goals[_best_goal_index]->backtracePath(path);
+        }
         return false;
       }
     }
 
     // 1) Pick Nbest from O s.t. min(f(Nbest)), remove from queue
+    current_key = _queue.top().first;
     current_node = getNextNode();
 
     // Save current node coordinates for debug
@@ -327,6 +544,9 @@ bool AStarAlgorithm<NodeT>::createPath(
     // We allow for nodes to be queued multiple times in case
     // shorter paths result in it, but we can visit only once
     if (current_node->wasVisited()) {
+      if (_telemetry) {
+        _telemetry->duplicate_pops++;
+      }
       continue;
     }
 
@@ -335,18 +555,50 @@ bool AStarAlgorithm<NodeT>::createPath(
     // 2) Mark Nbest as visited
     current_node->visited();
 
+    if (_telemetry) {
+      recordExpansion(current_node, current_key);
+    }
+
     // 2.1) Use an analytic expansion (if available) to generate a path
     expansion_result = nullptr;
+    expansion_heuristic = 0.0f;
+    expansion_goal = getAnalyticExpansionGoal(current_node, expansion_heuristic);
+    // The expansion marks the goal visited without accumulating cost along
+    // the analytic segment, so remember the cost basis at its root
+    expansion_cost_basis = current_node->getAccumulatedCost() + expansion_heuristic;
     expansion_result = _expander->tryAnalyticExpansion(
-      current_node, getGoal(), neighborGetter, analytic_iterations, closest_distance);
+      current_node, expansion_goal, neighborGetter, analytic_iterations, closest_distance);
+    if (_telemetry && expansion_goal != nullptr) {
+      _telemetry->analytic_attempts++;
+      if (expansion_result != nullptr) {
+        _telemetry->analytic_successes++;
+      }
+    }
     if (expansion_result != nullptr) {
       current_node = expansion_result;
     }
 
     // 3) Check if we're at the goal, backtrace if required
     if (isGoal(current_node)) {
-      return current_node->backtracePath(path);
-    } else if (_best_heuristic_node.first < getToleranceHeuristic()) {
+      if (_goals.empty()) {
+        return current_node->backtracePath(path);
+      }
+      // A settled candidate becomes the incumbent if its path cost plus
+      // terminal cost beats the previous one. An analytically expanded
+      // candidate accumulated no cost along the segment, so its cost basis
+      // stands in for the path cost
+      const float settled_path_cost = expansion_result != nullptr ?
+        expansion_cost_basis : current_node->getAccumulatedCost();
+      const float settled_total_cost =
+        settled_path_cost + getTerminalCost(_best_goal_index);
+      if (settled_total_cost < _incumbent_total_cost) {
+        _incumbent_total_cost = settled_total_cost;
+        _incumbent_path_cost = settled_path_cost;
+        _incumbent_goal_index = _best_goal_index;
+      }
+    } else if (_incumbent_goal_index < 0 &&
+      _best_heuristic_node.first < getToleranceHeuristic())
+    {
       // Optimization: Let us find when in tolerance and refine within reason
       approach_iterations++;
       if (approach_iterations >= getOnApproachMaxIterations()) {
@@ -354,6 +606,20 @@ bool AStarAlgorithm<NodeT>::createPath(
       }
     }
 
+    // 3.1) The incumbent is the result once no queued node can beat its
+    // total any more: every later pop carries f >= the current key, a
+    // lower bound on any path completed through it. With no terminal
+    // costs this holds on the settling pop itself, terminating the search
+    // on the first settled candidate as before
+    if (_incumbent_goal_index >= 0 &&
+      (_queue.empty() || _incumbent_total_cost <= current_key))
+    {
+      _best_goal_index = _incumbent_goal_index;
+      finalizeGoalSetCosts();
+      _goal_set_costs[_best_goal_index] = _incumbent_path_cost;
+      return _goals[_best_goal_index]->backtracePath(path);
+    }
+
     // 4) Expand neighbors of Nbest not visited
     neighbors.clear();
     current_node->getNeighbors(neighborGetter, _collision_checker, _traverse_unknown, neighbors);
@@ -363,6 +629,11 @@ bool AStarAlgorithm<NodeT>::createPath(
     {
       neighbor = *neighbor_iterator;
 
+      // 4.0) Skip neighbors outside the coarse-to-fine corridor, if set
+      if (!inExpansionMask(neighbor)) {
+        continue;
+      }
+
       // 4.1) Compute the cost to go to this node
       g_cost = current_node->getAccumulatedCost() + current_node->getTraversalCost(neighbor);
 
@@ -377,6 +648,237 @@ bool AStarAlgorithm<NodeT>::createPath(
     }
   }
 
+  // Out of iterations: a settled candidate beats returning nothing even if
+  // a cheaper one might still have been found
+  if (_incumbent_goal_index >= 0) {
+    _best_goal_index = _incumbent_goal_index;
+    finalizeGoalSetCosts();
+    _goal_set_costs[_best_goal_index] = _incumbent_path_cost;
+    return _goals[_best_goal_index]->backtracePath(path);
+  }
+
+  if (_best_heuristic_node.first < getToleranceHeuristic()) {
+    // If we run out of search options, return the path that is closest, if within tolerance.
+    return _graph.at(_best_heuristic_node.second).backtracePath(path);
+  }
+
+  return false;
+}
+
+template<>
+bool AStarAlgorithm<Node2D>::createPathBidirectional(
+  CoordinateVector & path, int & iterations,
+  const float & tolerance,
+  std::function<bool()> cancel_checker)
+{
+  steady_clock::time_point start_time = steady_clock::now();
+  _tolerance = tolerance;
+  _best_heuristic_node = {std::numeric_limits<float>::max(), 0};
+  clearQueue();
+
+  if (!areInputsValid()) {
+    return false;
+  }
+
+  const float inf = std::numeric_limits<float>::max();
+  const uint64_t start_index = _start->getIndex();
+  const uint64_t goal_index = _goal->getIndex();
+  const Coordinates start_coords = Node2D::getCoords(start_index, getSizeX(), 1);
+  const uint64_t max_index = static_cast<uint64_t>(getSizeX()) *
+    static_cast<uint64_t>(getSizeY());
+
+  // Closed costs each direction publishes for the opposite search to detect
+  // meeting cells without locking
+  std::vector<std::atomic<float>> closed_forward(max_index), closed_reverse(max_index);
+  for (uint64_t i = 0; i != max_index; ++i) {
+    closed_forward[i].store(inf, std::memory_order_relaxed);
+    closed_reverse[i].store(inf, std::memory_order_relaxed);
+  }
+
+  // Best meeting cell found so far, with the cost mirrored atomically for the
+  // cheap termination check in the search loops
+  std::mutex meeting_mutex;
+  uint64_t meeting_index = max_index;
+  std::atomic<float> meeting_cost{inf};
+  std::atomic<float> min_f_forward{0.0f}, min_f_reverse{0.0f};
+  std::atomic<bool> done{false}, cancelled{false};
+
+  // The reverse search runs on its own graph, queue and collision checker
+  // copy, so the only shared state between the threads is atomic
+  Graph reverse_graph;
+  NodeQueue reverse_queue;
+  GridCollisionChecker reverse_checker(*_collision_checker);
+  int iterations_forward = 0, iterations_reverse = 0;
+
+  auto search = [&](
+    Graph & graph, NodeQueue & queue, GridCollisionChecker * checker,
+    std::atomic<float> * own_closed, std::atomic<float> * other_closed,
+    std::atomic<float> & own_min_f, std::atomic<float> & other_min_f,
+    const uint64_t & search_start_index, const Coordinates & target_coords,
+    const bool is_forward, int & local_iterations)
+    {
+      NodePtr current_node = nullptr;
+      NodePtr neighbor = nullptr;
+      float g_cost = 0.0, heuristic = 0.0;
+      NodeVector neighbors;
+      NeighborIterator neighbor_iterator;
+
+      NodeGetter neighborGetter =
+        [&](const uint64_t & index, NodePtr & neighbor_rtn) -> bool
+        {
+          if (index >= max_index) {
+            return false;
+          }
+
+          neighbor_rtn = graph.getOrCreate(index);
+          return true;
+        };
+
+      NodePtr search_start = graph.getOrCreate(search_start_index);
+      search_start->setAccumulatedCost(0.0);
+      NodeBasic<Node2D> queued_start(search_start_index);
+      queued_start.populateSearchNode(search_start);
+      queue.emplace(0.0, std::move(queued_start));
+
+      while (!done.load(std::memory_order_acquire) &&
+        local_iterations < getMaxIterations() && !queue.empty())
+      {
+        // The forward search runs on the calling thread and owns the
+        // timeout and cancellation checks
+        if (is_forward && local_iterations % _terminal_checking_interval == 0) {
+          if (cancel_checker()) {
+            cancelled.store(true, std::memory_order_release);
+            done.store(true, std::memory_order_release);
+            break;
+          }
+          std::chrono::duration<double> planning_duration =
+            std::chrono::duration_cast<std::chrono::duration<double>>(
+            steady_clock::now() - start_time);
+          if (static_cast<double>(planning_duration.count()) >= _max_planning_time) {
+            done.store(true, std::memory_order_release);
+            break;
+          }
+        }
+
+        const float current_f = queue.top().first;
+        NodeBasic<Node2D> top = queue.top().second;
+        queue.pop();
+        top.processSearchNode();
+        current_node = top.graph_node_ptr;
+
+        if (current_node->wasVisited()) {
+          continue;
+        }
+
+        local_iterations++;
+        current_node->visited();
+        own_min_f.store(current_f, std::memory_order_release);
+
+        const uint64_t idx = current_node->getIndex();
+        const float g = current_node->getAccumulatedCost();
+        own_closed[idx].store(g, std::memory_order_release);
+
+        // If the opposite search closed this cell, it is a meeting candidate
+        const float other_g = other_closed[idx].load(std::memory_order_acquire);
+        if (other_g < inf) {
+          std::lock_guard<std::mutex> lock(meeting_mutex);
+          if (g + other_g < meeting_cost.load(std::memory_order_relaxed)) {
+            meeting_index = idx;
+            meeting_cost.store(g + other_g, std::memory_order_relaxed);
+          }
+        }
+
+        // No remaining pair of frontier nodes can beat the meeting found
+        if (meeting_cost.load(std::memory_order_acquire) <=
+          std::max(
+            own_min_f.load(std::memory_order_relaxed),
+            other_min_f.load(std::memory_order_acquire)))
+        {
+          done.store(true, std::memory_order_release);
+          break;
+        }
+
+        neighbors.clear();
+        current_node->getNeighbors(neighborGetter, checker, _traverse_unknown, neighbors);
+
+        for (neighbor_iterator = neighbors.begin();
+          neighbor_iterator != neighbors.end(); ++neighbor_iterator)
+        {
+          neighbor = *neighbor_iterator;
+
+          if (!inExpansionMask(neighbor)) {
+            continue;
+          }
+
+          g_cost = g + current_node->getTraversalCost(neighbor);
+
+          if (g_cost < neighbor->getAccumulatedCost()) {
+            neighbor->setAccumulatedCost(g_cost);
+            neighbor->parent = current_node;
+            heuristic = Node2D::getHeuristicCost(
+              Node2D::getCoords(neighbor->getIndex(), getSizeX(), 1), target_coords);
+
+            // only the forward search tracks the tolerance fallback
+            if (is_forward && heuristic < _best_heuristic_node.first) {
+              _best_heuristic_node = {heuristic, neighbor->getIndex()};
+            }
+
+            NodeBasic<Node2D> queued_node(neighbor->getIndex());
+            queued_node.populateSearchNode(neighbor);
+            queue.emplace(g_cost + heuristic, std::move(queued_node));
+          }
+        }
+      }
+
+      // an exhausted direction cannot improve the meeting any further; let
+      // the opposite search terminate on the meeting found so far
+      own_min_f.store(inf, std::memory_order_release);
+    };
+
+  std::thread reverse_thread(
+    [&]() {
+      search(
+        reverse_graph, reverse_queue, &reverse_checker,
+        closed_reverse.data(), closed_forward.data(),
+        min_f_reverse, min_f_forward,
+        goal_index, start_coords, false, iterations_reverse);
+    });
+
+  search(
+    _graph, _queue, _collision_checker,
+    closed_forward.data(), closed_reverse.data(),
+    min_f_forward, min_f_reverse,
+    start_index, _goal_coordinates, true, iterations_forward);
+
+  reverse_thread.join();
+  iterations += iterations_forward + iterations_reverse;
+
+  if (cancelled.load(std::memory_order_acquire)) {
+    throw nav2_core::PlannerCancelled("Planner was cancelled");
+  }
+
+  if (meeting_index < max_index) {
+    // Stitch the two trees: the reverse leg walks from the meeting cell to
+    // the goal, the forward leg from the meeting cell to the start, keeping
+    // the goal-to-start ordering createPath() returns
+    CoordinateVector reverse_leg;
+    for (NodePtr node = &reverse_graph.at(meeting_index); node != nullptr;
+      node = node->parent)
+    {
+      reverse_leg.push_back(Node2D::getCoords(node->getIndex()));
+    }
+    path.reserve(reverse_leg.size());
+    for (auto it = reverse_leg.rbegin(); it != reverse_leg.rend(); ++it) {
+      path.push_back(*it);
+    }
+    for (NodePtr node = _graph.at(meeting_index).parent; node != nullptr;
+      node = node->parent)
+    {
+      path.push_back(Node2D::getCoords(node->getIndex()));
+    }
+    return true;
+  }
+
   if (_best_heuristic_node.first < getToleranceHeuristic()) {
     // If we run out of search options, return the path that is closest, if within tolerance.
     return _graph.at(_best_heuristic_node.second).backtracePath(path);
@@ -388,7 +890,51 @@ bool AStarAlgorithm<NodeT>::createPath(
 template<typename NodeT>
 bool AStarAlgorithm<NodeT>::isGoal(NodePtr & node)
 {
-  return node == getGoal();
+  if (_goals.empty()) {
+    return node == getGoal();
+  }
+
+  for (unsigned int i = 0; i != _goals.size(); i++) {
+    if (node == _goals[i]) {
+      _best_goal_index = static_cast<int>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+template<typename NodeT>
+typename AStarAlgorithm<NodeT>::NodePtr
+AStarAlgorithm<NodeT>::getAnalyticExpansionGoal(const NodePtr & node, float & heuristic)
+{
+  if (_goals.empty()) {
+    return _goal;
+  }
+
+  const Coordinates node_coords =
+    NodeT::getCoords(node->getIndex(), getSizeX(), getSizeDim3());
+  unsigned int best = 0;
+  float best_heuristic = std::numeric_limits<float>::max();
+  for (unsigned int i = 0; i != _goals.size(); i++) {
+    const float candidate_heuristic =
+      NodeT::getHeuristicCost(node_coords, _goals_coordinates[i]);
+    if (candidate_heuristic < best_heuristic) {
+      best_heuristic = candidate_heuristic;
+      best = i;
+    }
+  }
+  heuristic = best_heuristic;
+  return _goals[best];
+}
+
+template<typename NodeT>
+void AStarAlgorithm<NodeT>::finalizeGoalSetCosts()
+{
+  const float max_cost = std::numeric_limits<float>::max();
+  for (unsigned int i = 0; i != _goals.size(); i++) {
+    const float accumulated = _goals[i]->getAccumulatedCost();
+    _goal_set_costs[i] = accumulated < max_cost ? accumulated : -1.0f;
+  }
 }
 
 template<typename NodeT>
@@ -417,7 +963,7 @@ void AStarAlgorithm<NodeT>::addNode(const float & cost, NodePtr & node)
 {
   NodeBasic<NodeT> queued_node(node->getIndex());
   queued_node.populateSearchNode(node);
-  _queue.emplace(cost, queued_node);
+  _queue.emplace(cost, std::move(queued_node));
 }
 
 template<typename NodeT>
@@ -425,8 +971,17 @@ float AStarAlgorithm<NodeT>::getHeuristicCost(const NodePtr & node)
 {
   const Coordinates node_coords =
     NodeT::getCoords(node->getIndex(), getSizeX(), getSizeDim3());
-  float heuristic = NodeT::getHeuristicCost(
-    node_coords, _goal_coordinates);
+  float heuristic;
+  if (_goals.empty()) {
+    heuristic = NodeT::getHeuristicCost(node_coords, _goal_coordinates);
+  } else {
+    // Admissibility over the goal set requires the cheapest candidate's
+    // estimate, so the first candidate settled is the cheapest to reach
+    heuristic = std::numeric_limits<float>::max();
+    for (const Coordinates & goal_coords : _goals_coordinates) {
+      heuristic = std::min(heuristic, NodeT::getHeuristicCost(node_coords, goal_coords));
+    }
+  }
 
   if (heuristic < _best_heuristic_node.first) {
     _best_heuristic_node = {heuristic, node->getIndex()};
@@ -438,16 +993,17 @@ float AStarAlgorithm<NodeT>::getHeuristicCost(const NodePtr & node)
 template<typename NodeT>
 void AStarAlgorithm<NodeT>::clearQueue()
 {
-  NodeQueue q;
-  std::swap(_queue, q);
+  // Keeps the underlying storage, so steady-state searches do not regrow
+  // the open list from scratch
+  _queue.clear();
 }
 
 template<typename NodeT>
 void AStarAlgorithm<NodeT>::clearGraph()
 {
-  Graph g;
-  std::swap(_graph, g);
-  _graph.reserve(100000);
+  // destroys the nodes but keeps the arena and index storage sized for the
+  // next search
+  _graph.clear();
 }
 
 template<typename NodeT>
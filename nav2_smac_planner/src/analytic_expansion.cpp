@@ -39,11 +39,48 @@ AnalyticExpansion<NodeT>::AnalyticExpansion(
 {
 }
 
+// Bucket size, in cells, of the spatial hash of failed shot origins
+const unsigned int FAILED_SHOT_BUCKET_SIZE = 4;
+// Number of subsequent attempts a failed shot origin suppresses nearby shots
+const unsigned int FAILED_SHOT_TTL = 10;
+
 template<typename NodeT>
 void AnalyticExpansion<NodeT>::setCollisionChecker(
   GridCollisionChecker * collision_checker)
 {
   _collision_checker = collision_checker;
+  // New search: forget failures from prior requests
+  _failed_shot_origins.clear();
+  _analytic_attempt_count = 0;
+  _last_failed_fraction = -1.0f;
+}
+
+template<typename NodeT>
+bool AnalyticExpansion<NodeT>::isRecentFailedShotOrigin(const Coordinates & node_coords)
+{
+  const uint64_t bucket =
+    (static_cast<uint64_t>(node_coords.x / FAILED_SHOT_BUCKET_SIZE) << 32) |
+    static_cast<uint64_t>(node_coords.y / FAILED_SHOT_BUCKET_SIZE);
+  auto cached = _failed_shot_origins.find(bucket);
+  if (cached == _failed_shot_origins.end()) {
+    return false;
+  }
+
+  if (_analytic_attempt_count - cached->second >= FAILED_SHOT_TTL) {
+    _failed_shot_origins.erase(cached);
+    return false;
+  }
+
+  return true;
+}
+
+template<typename NodeT>
+void AnalyticExpansion<NodeT>::recordFailedShotOrigin(const Coordinates & node_coords)
+{
+  const uint64_t bucket =
+    (static_cast<uint64_t>(node_coords.x / FAILED_SHOT_BUCKET_SIZE) << 32) |
+    static_cast<uint64_t>(node_coords.y / FAILED_SHOT_BUCKET_SIZE);
+  _failed_shot_origins[bucket] = _analytic_attempt_count;
 }
 
 template<typename NodeT>
@@ -80,6 +117,15 @@ typename AnalyticExpansion<NodeT>::NodePtr AnalyticExpansion<NodeT>::tryAnalytic
     if (analytic_iterations <= 0) {
       // Reset the counter and try the analytic path expansion
       analytic_iterations = desired_iterations;
+      _analytic_attempt_count++;
+
+      // A shot from near a recently failed origin will fail the same way,
+      // skip it until the failure's TTL expires
+      if (isRecentFailedShotOrigin(node_coords)) {
+        analytic_iterations--;
+        return NodePtr(nullptr);
+      }
+
       AnalyticExpansionNodes analytic_nodes =
         getAnalyticPath(current_node, goal_node, getter, current_node->motion_table.state_space);
       if (!analytic_nodes.empty()) {
@@ -153,6 +199,8 @@ typename AnalyticExpansion<NodeT>::NodePtr AnalyticExpansion<NodeT>::tryAnalytic
 
         return setAnalyticPath(node, goal_node, analytic_nodes);
       }
+
+      recordFailedShotOrigin(node_coords);
     }
 
     analytic_iterations--;
@@ -192,6 +240,22 @@ typename AnalyticExpansion<NodeT>::AnalyticExpansionNodes AnalyticExpansion<Node
 
   unsigned int num_intervals = static_cast<unsigned int>(std::floor(d / sqrt_2));
 
+  // Probe the curve fraction that blocked the last failed shot first.
+  // Consecutive shots tend to fail on the same obstacle, so a doomed curve
+  // is usually rejected here with a single collision check instead of
+  // walking all of the poses leading up to it
+  if (_last_failed_fraction > 0.0f && num_intervals > 0) {
+    state_space->interpolate(from(), to(), _last_failed_fraction, s());
+    const std::vector<double> probe = s.reals();
+    double probe_theta = (probe[2] < 0.0) ? (probe[2] + 2.0 * M_PI) : probe[2];
+    probe_theta = (probe_theta > 2.0 * M_PI) ? (probe_theta - 2.0 * M_PI) : probe_theta;
+    if (_collision_checker->inCollision(
+        probe[0], probe[1], node->motion_table.getAngle(probe_theta), _traverse_unknown))
+    {
+      return AnalyticExpansionNodes();
+    }
+  }
+
   AnalyticExpansionNodes possible_nodes;
   // When "from" and "to" are zero or one cell away,
   // num_intervals == 0
@@ -236,6 +300,7 @@ typename AnalyticExpansion<NodeT>::AnalyticExpansionNodes AnalyticExpansion<Node
       } else {
         // Abort
         next->setPose(initial_node_coords);
+        _last_failed_fraction = i / num_intervals;
         failure = true;
         break;
       }
@@ -12,7 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License. Reserved.
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "nav2_smac_planner/collision_checker.hpp"
+#include "nav2_util/line_iterator.hpp"
 
 namespace nav2_smac_planner
 {
@@ -53,6 +58,12 @@ void GridCollisionChecker::setFootprint(
   const bool & radius,
   const double & possible_collision_cost)
 {
+  // invalidate registered swept footprints if the checking semantics changed
+  if (radius != footprint_is_radius_ || (!radius && !(footprint == unoriented_footprint_))) {
+    swept_footprints_.clear();
+    footprint_generation_++;
+  }
+
   possible_collision_cost_ = static_cast<float>(possible_collision_cost);
   footprint_is_radius_ = radius;
 
@@ -192,6 +203,126 @@ float GridCollisionChecker::getCost()
   return static_cast<float>(footprint_cost_);
 }
 
+unsigned int GridCollisionChecker::registerSweptFootprint(const MotionPoses & poses)
+{
+  SweptFootprint swept;
+  swept.centers.reserve(poses.size());
+  const double resolution = costmap_->getResolution();
+  const float bin_size = 2.0f * static_cast<float>(M_PI) / static_cast<float>(angles_.size());
+
+  for (const auto & pose : poses) {
+    float theta = fmodf(pose._theta, 2.0f * static_cast<float>(M_PI));
+    if (theta < 0.0f) {
+      theta += 2.0f * static_cast<float>(M_PI);
+    }
+    const unsigned int bin = static_cast<unsigned int>(theta / bin_size) % angles_.size();
+    swept.centers.emplace_back(
+      static_cast<int>(std::lround(pose._x)), static_cast<int>(std::lround(pose._y)), bin);
+
+    if (footprint_is_radius_) {
+      continue;
+    }
+
+    // Rasterize the outline of this pose's oriented footprint in cell offset
+    // space, the same way the costmap footprint offsets are precomputed
+    const nav2_costmap_2d::Footprint & oriented_footprint = oriented_footprints_[bin];
+    std::vector<std::pair<int, int>> vertices;
+    vertices.reserve(oriented_footprint.size());
+    for (const auto & pt : oriented_footprint) {
+      vertices.emplace_back(
+        static_cast<int>(std::lround(pose._x + pt.x / resolution)),
+        static_cast<int>(std::lround(pose._y + pt.y / resolution)));
+    }
+
+    for (unsigned int i = 0; i < vertices.size(); ++i) {
+      const auto & from = vertices[i];
+      const auto & to = vertices[(i + 1) % vertices.size()];
+      for (nav2_util::LineIterator line(from.first, from.second, to.first, to.second);
+        line.isValid(); line.advance())
+      {
+        swept.outline_union.emplace_back(line.getX(), line.getY());
+      }
+    }
+  }
+
+  // successive poses overlap heavily; merge their cells so each is checked once
+  std::sort(swept.outline_union.begin(), swept.outline_union.end());
+  swept.outline_union.erase(
+    std::unique(swept.outline_union.begin(), swept.outline_union.end()),
+    swept.outline_union.end());
+
+  swept_footprints_.push_back(std::move(swept));
+  return swept_footprints_.size() - 1;
+}
+
+bool GridCollisionChecker::inCollisionSwept(
+  const float & x,
+  const float & y,
+  const unsigned int & handle,
+  const bool & traverse_unknown)
+{
+  const SweptFootprint & swept = swept_footprints_[handle];
+  const int cell_x = static_cast<int>(x + 0.5f);
+  const int cell_y = static_cast<int>(y + 0.5f);
+  const int size_x = static_cast<int>(costmap_->getSizeInCellsX());
+  const int size_y = static_cast<int>(costmap_->getSizeInCellsY());
+  float max_cost = 0.0f;
+  float cost = 0.0f;
+  bool check_outline = !footprint_is_radius_ && possible_collision_cost_ <= 0.0f;
+
+  for (const auto & center : swept.centers) {
+    const int mx = cell_x + std::get<0>(center);
+    const int my = cell_y + std::get<1>(center);
+    if (mx < 0 || my < 0 || mx >= size_x || my >= size_y) {
+      return true;
+    }
+
+    cost = static_cast<float>(costmap_->getCost(mx, my));
+    if (cost == UNKNOWN) {
+      if (!traverse_unknown) {
+        return true;
+      }
+      check_outline = true;
+    } else if (footprint_is_radius_) {
+      if (cost >= INSCRIBED) {
+        return true;
+      }
+    } else {
+      if (cost == INSCRIBED || cost == OCCUPIED) {
+        return true;
+      }
+      if (cost >= possible_collision_cost_) {
+        // potentially inscribed, the footprint cells must be checked
+        check_outline = true;
+      }
+    }
+    max_cost = std::max(max_cost, cost);
+  }
+
+  if (!footprint_is_radius_ && check_outline) {
+    for (const auto & offset : swept.outline_union) {
+      const int mx = cell_x + offset.first;
+      const int my = cell_y + offset.second;
+      if (mx < 0 || my < 0 || mx >= size_x || my >= size_y) {
+        return true;
+      }
+
+      cost = static_cast<float>(costmap_->getCost(mx, my));
+      if (cost == UNKNOWN) {
+        if (!traverse_unknown) {
+          return true;
+        }
+      } else if (cost >= OCCUPIED) {
+        return true;
+      }
+      max_cost = std::max(max_cost, cost);
+    }
+  }
+
+  footprint_cost_ = max_cost;
+  return false;
+}
+
 bool GridCollisionChecker::outsideRange(const unsigned int & max, const float & value)
 {
   return value < 0.0f || value > max;
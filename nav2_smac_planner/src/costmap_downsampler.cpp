@@ -18,6 +18,8 @@
 #include <string>
 #include <memory>
 #include <algorithm>
+#include <cstring>
+#include <vector>
 
 namespace nav2_smac_planner
 {
@@ -44,6 +46,7 @@ void CostmapDownsampler::on_configure(
   _costmap = costmap;
   _downsampling_factor = downsampling_factor;
   _use_min_cost_neighbor = use_min_cost_neighbor;
+  _source_snapshot.clear();
   updateCostmapSize();
 
   _downsampled_costmap = std::make_unique<nav2_costmap_2d::Costmap2D>(
@@ -75,6 +78,7 @@ void CostmapDownsampler::on_cleanup()
   _costmap = nullptr;
   _downsampled_costmap.reset();
   _downsampled_costmap_pub.reset();
+  _source_snapshot.clear();
 }
 
 nav2_costmap_2d::Costmap2D * CostmapDownsampler::downsample(
@@ -91,19 +95,112 @@ nav2_costmap_2d::Costmap2D * CostmapDownsampler::downsample(
     resizeCostmap();
   }
 
-  // Assign costs
-  for (unsigned int i = 0; i < _downsampled_size_x; ++i) {
-    for (unsigned int j = 0; j < _downsampled_size_y; ++j) {
-      setCostOfCell(i, j);
+  // Assign costs; when a snapshot of the last request is available, only
+  // for the rectangle of cells that changed since
+  if (_source_snapshot.size() != static_cast<size_t>(_size_x) * _size_y) {
+    downsampleRegion(0, 0, _downsampled_size_x, _downsampled_size_y);
+  } else {
+    unsigned int min_x, min_y, max_x, max_y;
+    if (findChangedSourceBounds(min_x, min_y, max_x, max_y)) {
+      downsampleRegion(
+        min_x / _downsampling_factor, min_y / _downsampling_factor,
+        (max_x - 1) / _downsampling_factor + 1, (max_y - 1) / _downsampling_factor + 1);
     }
   }
 
+  const unsigned char * char_map = _costmap->getCharMap();
+  _source_snapshot.assign(char_map, char_map + static_cast<size_t>(_size_x) * _size_y);
+
   if (_downsampled_costmap_pub) {
     _downsampled_costmap_pub->publishCostmap();
   }
   return _downsampled_costmap.get();
 }
 
+void CostmapDownsampler::downsampleRegion(
+  const unsigned int & start_dx, const unsigned int & start_dy,
+  const unsigned int & end_dx, const unsigned int & end_dy)
+{
+  const unsigned char * char_map = _costmap->getCharMap();
+  unsigned char * downsampled_map = _downsampled_costmap->getCharMap();
+  const unsigned char initial_cost = _use_min_cost_neighbor ? 255 : 0;
+  const unsigned int start_x = start_dx * _downsampling_factor;
+  const unsigned int end_x = std::min(end_dx * _downsampling_factor, _size_x);
+  std::vector<unsigned char> reduced_row(end_x - start_x);
+
+  for (unsigned int dy = start_dy; dy < end_dy; ++dy) {
+    // Reduce the block's source rows elementwise into one row; the loops run
+    // over contiguous bytes so compilers turn them into SIMD min/max
+    std::fill(reduced_row.begin(), reduced_row.end(), initial_cost);
+    const unsigned int block_start_y = dy * _downsampling_factor;
+    const unsigned int block_end_y = std::min(block_start_y + _downsampling_factor, _size_y);
+    for (unsigned int my = block_start_y; my < block_end_y; ++my) {
+      const unsigned char * source_row = &char_map[static_cast<size_t>(my) * _size_x + start_x];
+      if (_use_min_cost_neighbor) {
+        for (unsigned int i = 0; i < reduced_row.size(); ++i) {
+          reduced_row[i] = std::min(reduced_row[i], source_row[i]);
+        }
+      } else {
+        for (unsigned int i = 0; i < reduced_row.size(); ++i) {
+          reduced_row[i] = std::max(reduced_row[i], source_row[i]);
+        }
+      }
+    }
+
+    // Reduce each cell's span of the combined row horizontally
+    unsigned char * downsampled_row =
+      &downsampled_map[static_cast<size_t>(dy) * _downsampled_size_x];
+    for (unsigned int dx = start_dx; dx < end_dx; ++dx) {
+      const unsigned int span_start = dx * _downsampling_factor - start_x;
+      const unsigned int span_end = std::min(
+        span_start + _downsampling_factor, static_cast<unsigned int>(reduced_row.size()));
+      unsigned char cost = initial_cost;
+      for (unsigned int i = span_start; i < span_end; ++i) {
+        cost = _use_min_cost_neighbor ?
+          std::min(cost, reduced_row[i]) : std::max(cost, reduced_row[i]);
+      }
+      downsampled_row[dx] = cost;
+    }
+  }
+}
+
+bool CostmapDownsampler::findChangedSourceBounds(
+  unsigned int & min_x, unsigned int & min_y,
+  unsigned int & max_x, unsigned int & max_y)
+{
+  const unsigned char * char_map = _costmap->getCharMap();
+  bool found = false;
+  min_x = _size_x;
+  max_x = 0;
+
+  for (unsigned int my = 0; my < _size_y; ++my) {
+    const unsigned char * current_row = &char_map[static_cast<size_t>(my) * _size_x];
+    const unsigned char * snapshot_row = &_source_snapshot[static_cast<size_t>(my) * _size_x];
+    if (memcmp(current_row, snapshot_row, _size_x) == 0) {
+      continue;
+    }
+
+    if (!found) {
+      min_y = my;
+      found = true;
+    }
+    max_y = my + 1;
+
+    unsigned int first = 0;
+    while (current_row[first] == snapshot_row[first]) {
+      first++;
+    }
+    unsigned int last = _size_x - 1;
+    while (current_row[last] == snapshot_row[last]) {
+      last--;
+    }
+    min_x = std::min(min_x, first);
+    max_x = std::max(max_x, last + 1);
+  }
+
+  return found;
+}
+
 void CostmapDownsampler::updateCostmapSize()
 {
   _size_x = _costmap->getSizeInCellsX();
@@ -121,6 +218,8 @@ void CostmapDownsampler::resizeCostmap()
     _downsampled_resolution,
     _costmap->getOriginX(),
     _costmap->getOriginY());
+  // Resizing resets the downsampled contents, force a full pass
+  _source_snapshot.clear();
 }
 
 void CostmapDownsampler::setCostOfCell(
@@ -0,0 +1,231 @@
+// Copyright (c) 2026, Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License. Reserved.
+
+#include "nav2_smac_planner/costmap_pyramid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nav2_smac_planner/constants.hpp"
+
+namespace nav2_smac_planner
+{
+
+std::mutex CostmapPyramid::_registry_mutex;
+std::map<nav2_costmap_2d::Costmap2D *,
+  std::weak_ptr<CostmapPyramid>> CostmapPyramid::_registry;
+
+std::shared_ptr<CostmapPyramid> CostmapPyramid::getOrCreate(
+  nav2_costmap_2d::Costmap2D * costmap)
+{
+  std::lock_guard<std::mutex> lock(_registry_mutex);
+  std::shared_ptr<CostmapPyramid> pyramid = _registry[costmap].lock();
+  if (!pyramid) {
+    pyramid = std::make_shared<CostmapPyramid>(costmap);
+    _registry[costmap] = pyramid;
+  }
+  return pyramid;
+}
+
+CostmapPyramid::CostmapPyramid(nav2_costmap_2d::Costmap2D * costmap)
+: _costmap(costmap),
+  _activations(0)
+{
+}
+
+CostmapDownsampler & CostmapPyramid::getDownsampler(const unsigned int & factor)
+{
+  std::unique_ptr<CostmapDownsampler> & downsampler = _levels[factor];
+  if (!downsampler) {
+    downsampler = std::make_unique<CostmapDownsampler>();
+    // an expired node handle configures the level without a publisher
+    downsampler->on_configure(
+      nav2_util::LifecycleNode::WeakPtr(), "", "", _costmap, factor);
+  }
+  return *downsampler;
+}
+
+nav2_costmap_2d::Costmap2D * CostmapPyramid::getLevel(const unsigned int & factor)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return getDownsampler(factor).downsample(factor);
+}
+
+void CostmapPyramid::addLevelPublisher(
+  const nav2_util::LifecycleNode::WeakPtr & node,
+  const std::string & global_frame,
+  const std::string & topic_name,
+  const unsigned int & factor)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_publishing_levels.count(factor) > 0) {
+    return;
+  }
+
+  std::unique_ptr<CostmapDownsampler> & downsampler = _levels[factor];
+  if (!downsampler) {
+    downsampler = std::make_unique<CostmapDownsampler>();
+  }
+  downsampler->on_configure(node, global_frame, topic_name, _costmap, factor);
+  _publishing_levels.insert(factor);
+  if (_activations > 0) {
+    downsampler->on_activate();
+  }
+}
+
+void CostmapPyramid::on_activate()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (++_activations == 1) {
+    for (auto & level : _levels) {
+      level.second->on_activate();
+    }
+  }
+}
+
+void CostmapPyramid::on_deactivate()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_activations > 0 && --_activations == 0) {
+    for (auto & level : _levels) {
+      level.second->on_deactivate();
+    }
+  }
+}
+
+bool CostmapPyramid::findCorridor(
+  const unsigned int & factor,
+  const unsigned int & start_x, const unsigned int & start_y,
+  const unsigned int & goal_x, const unsigned int & goal_y,
+  const unsigned int & radius_cells,
+  std::vector<uint8_t> & mask)
+{
+  nav2_costmap_2d::Costmap2D * level = getLevel(factor);
+  const unsigned int size_x = level->getSizeInCellsX();
+  const unsigned int size_y = level->getSizeInCellsY();
+  if (size_x == 0 || size_y == 0 || factor < 2) {
+    return false;
+  }
+
+  const uint64_t start_index = static_cast<uint64_t>(
+    std::min(start_y / factor, size_y - 1)) * size_x + std::min(start_x / factor, size_x - 1);
+  const uint64_t goal_index = static_cast<uint64_t>(
+    std::min(goal_y / factor, size_y - 1)) * size_x + std::min(goal_x / factor, size_x - 1);
+
+  const unsigned char * costs = level->getCharMap();
+  const uint64_t num_cells = static_cast<uint64_t>(size_x) * size_y;
+  const float inf = std::numeric_limits<float>::max();
+
+  // A coarse cell pools the max of its block, so anything below lethal
+  // may still contain a passage; only rule out fully blocked cells. The
+  // start and goal cells are kept searchable even if their blocks pool
+  // an obstacle, the fine search resolves them exactly.
+  auto traversable = [&](const uint64_t & index) -> bool {
+      return costs[index] < OCCUPIED || index == start_index || index == goal_index;
+    };
+
+  const float sqrt2 = std::sqrt(2.0f);
+  const unsigned int goal_mx = goal_index % size_x;
+  const unsigned int goal_my = goal_index / size_x;
+  auto heuristic = [&](const unsigned int & mx, const unsigned int & my) -> float {
+      const float dx = std::abs(static_cast<float>(mx) - static_cast<float>(goal_mx));
+      const float dy = std::abs(static_cast<float>(my) - static_cast<float>(goal_my));
+      return std::max(dx, dy) + (sqrt2 - 1.0f) * std::min(dx, dy);
+    };
+
+  std::vector<float> g_costs(num_cells, inf);
+  std::vector<int64_t> parents(num_cells, -1);
+  std::vector<uint8_t> visited(num_cells, 0);
+  using QueueElement = std::pair<float, uint64_t>;
+  std::priority_queue<QueueElement, std::vector<QueueElement>,
+    std::greater<QueueElement>> queue;
+
+  g_costs[start_index] = 0.0f;
+  queue.emplace(heuristic(start_index % size_x, start_index / size_x), start_index);
+
+  while (!queue.empty()) {
+    const uint64_t current = queue.top().second;
+    queue.pop();
+    if (visited[current]) {
+      continue;
+    }
+    visited[current] = 1;
+    if (current == goal_index) {
+      break;
+    }
+
+    const unsigned int mx = current % size_x;
+    const unsigned int my = current / size_x;
+    for (int dy = -1; dy <= 1; ++dy) {
+      for (int dx = -1; dx <= 1; ++dx) {
+        if (dx == 0 && dy == 0) {
+          continue;
+        }
+        const int nx = static_cast<int>(mx) + dx;
+        const int ny = static_cast<int>(my) + dy;
+        if (nx < 0 || ny < 0 || nx >= static_cast<int>(size_x) ||
+          ny >= static_cast<int>(size_y))
+        {
+          continue;
+        }
+        const uint64_t neighbor = static_cast<uint64_t>(ny) * size_x + nx;
+        if (visited[neighbor] || !traversable(neighbor)) {
+          continue;
+        }
+        // penalize pooled cost so the corridor stays in open space
+        const float g_cost = g_costs[current] +
+          (dx != 0 && dy != 0 ? sqrt2 : 1.0f) +
+          2.0f * static_cast<float>(costs[neighbor]) / INSCRIBED;
+        if (g_cost < g_costs[neighbor]) {
+          g_costs[neighbor] = g_cost;
+          parents[neighbor] = static_cast<int64_t>(current);
+          queue.emplace(g_cost + heuristic(nx, ny), neighbor);
+        }
+      }
+    }
+  }
+
+  if (!visited[goal_index]) {
+    return false;
+  }
+
+  // Stamp each coarse path cell into the mask as its base-resolution
+  // block, dilated by the corridor radius
+  const unsigned int base_x = _costmap->getSizeInCellsX();
+  const unsigned int base_y = _costmap->getSizeInCellsY();
+  mask.assign(static_cast<size_t>(base_x) * base_y, 0);
+  for (int64_t index = static_cast<int64_t>(goal_index); index >= 0; index = parents[index]) {
+    const unsigned int mx = index % size_x;
+    const unsigned int my = index / size_x;
+    const unsigned int bx0 = mx * factor > radius_cells ? mx * factor - radius_cells : 0;
+    const unsigned int by0 = my * factor > radius_cells ? my * factor - radius_cells : 0;
+    const unsigned int bx1 = std::min((mx + 1) * factor + radius_cells, base_x);
+    const unsigned int by1 = std::min((my + 1) * factor + radius_cells, base_y);
+    for (unsigned int by = by0; by < by1; ++by) {
+      std::fill(
+        mask.begin() + static_cast<size_t>(by) * base_x + bx0,
+        mask.begin() + static_cast<size_t>(by) * base_x + bx1, 1);
+    }
+  }
+
+  return true;
+}
+
+}  // namespace nav2_smac_planner
@@ -0,0 +1,58 @@
+// Copyright (c) 2021, Samsung Research America
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License. Reserved.
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "nlohmann/json.hpp"
+#include "nav2_smac_planner/lattice_binary_io.hpp"
+#include "nav2_smac_planner/utils.hpp"
+
+// Compiles a JSON lattice file from the lattice generator into the binary
+// format loadable by the lattice planner without JSON parsing, e.g.
+//   ros2 run nav2_smac_planner lattice_binary_converter input.json output.bin
+int main(int argc, char ** argv)
+{
+  if (argc != 3) {
+    std::cerr << "Usage: lattice_binary_converter <input json file> <output binary file>" <<
+      std::endl;
+    return 1;
+  }
+
+  std::ifstream lattice_file(argv[1]);
+  if (!lattice_file.is_open()) {
+    std::cerr << "Could not open lattice file " << argv[1] << std::endl;
+    return 1;
+  }
+
+  nlohmann::json json;
+  lattice_file >> json;
+
+  nav2_smac_planner::LatticeMetadata lattice_metadata;
+  nav2_smac_planner::fromJsonToMetaData(json["lattice_metadata"], lattice_metadata);
+
+  nav2_smac_planner::MotionPrimitives primitives;
+  nlohmann::json json_primitives = json["primitives"];
+  primitives.reserve(json_primitives.size());
+  for (unsigned int i = 0; i < json_primitives.size(); ++i) {
+    nav2_smac_planner::MotionPrimitive primitive;
+    nav2_smac_planner::fromJsonToMotionPrimitive(json_primitives[i], primitive);
+    primitives.push_back(primitive);
+  }
+
+  nav2_smac_planner::writeBinaryLattice(argv[2], lattice_metadata, primitives);
+  std::cout << "Wrote " << primitives.size() << " primitives to " << argv[2] << std::endl;
+  return 0;
+}
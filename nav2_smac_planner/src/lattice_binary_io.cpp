@@ -0,0 +1,238 @@
+// Copyright (c) 2021, Samsung Research America
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License. Reserved.
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "nav2_smac_planner/lattice_binary_io.hpp"
+
+namespace nav2_smac_planner
+{
+
+namespace
+{
+
+const uint32_t lattice_binary_magic = 0x4E324C50;  // "N2LP"
+const uint32_t lattice_binary_version = 1;
+
+/**
+ * @class MappedLatticeFile
+ * @brief A read-only memory mapping of a lattice file, unmapped on destruction
+ */
+struct MappedLatticeFile
+{
+  explicit MappedLatticeFile(const std::string & filepath)
+  {
+    int fd = open(filepath.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error("Could not open lattice file!");
+    }
+
+    struct stat file_info;
+    if (fstat(fd, &file_info) < 0) {
+      close(fd);
+      throw std::runtime_error("Could not stat lattice file!");
+    }
+
+    size = file_info.st_size;
+    addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+      throw std::runtime_error("Could not memory map lattice file!");
+    }
+  }
+
+  ~MappedLatticeFile()
+  {
+    munmap(addr, size);
+  }
+
+  void * addr{nullptr};
+  size_t size{0};
+};
+
+/**
+ * @class BinaryCursor
+ * @brief A sequential, bounds checked reader over a memory mapped lattice file
+ */
+struct BinaryCursor
+{
+  const char * data;
+  size_t remaining;
+
+  void readInto(void * destination, const size_t & num_bytes)
+  {
+    if (num_bytes > remaining) {
+      throw std::runtime_error("Binary lattice file is truncated or corrupt!");
+    }
+    memcpy(destination, data, num_bytes);
+    data += num_bytes;
+    remaining -= num_bytes;
+  }
+
+  template<typename T>
+  T read()
+  {
+    T value;
+    readInto(&value, sizeof(T));
+    return value;
+  }
+};
+
+/**
+ * @brief Read and validate the metadata block at the head of a mapped file
+ * @param cursor Cursor at the start of the file
+ * @param lattice_metadata Metadata to populate
+ */
+void readMetadataBlock(BinaryCursor & cursor, LatticeMetadata & lattice_metadata)
+{
+  if (cursor.read<uint32_t>() != lattice_binary_magic) {
+    throw std::runtime_error("File is not a binary lattice file!");
+  }
+  if (cursor.read<uint32_t>() != lattice_binary_version) {
+    throw std::runtime_error("Binary lattice file has an unsupported version!");
+  }
+
+  lattice_metadata.min_turning_radius = cursor.read<float>();
+  lattice_metadata.grid_resolution = cursor.read<float>();
+  lattice_metadata.number_of_headings = cursor.read<uint32_t>();
+  lattice_metadata.number_of_trajectories = cursor.read<uint32_t>();
+
+  const uint32_t motion_model_length = cursor.read<uint32_t>();
+  lattice_metadata.motion_model.resize(motion_model_length);
+  cursor.readInto(&lattice_metadata.motion_model[0], motion_model_length);
+
+  lattice_metadata.heading_angles.resize(lattice_metadata.number_of_headings);
+  cursor.readInto(
+    lattice_metadata.heading_angles.data(),
+    lattice_metadata.number_of_headings * sizeof(float));
+}
+
+}  // namespace
+
+bool isBinaryLatticeFile(const std::string & lattice_filepath)
+{
+  std::ifstream lattice_file(lattice_filepath, std::ios::binary);
+  uint32_t magic = 0;
+  lattice_file.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+  return lattice_file && magic == lattice_binary_magic;
+}
+
+LatticeMetadata readBinaryLatticeMetadata(const std::string & lattice_filepath)
+{
+  MappedLatticeFile mapping(lattice_filepath);
+  BinaryCursor cursor{static_cast<const char *>(mapping.addr), mapping.size};
+  LatticeMetadata lattice_metadata;
+  readMetadataBlock(cursor, lattice_metadata);
+  return lattice_metadata;
+}
+
+void readBinaryLattice(
+  const std::string & lattice_filepath,
+  LatticeMetadata & lattice_metadata,
+  MotionPrimitives & primitives)
+{
+  MappedLatticeFile mapping(lattice_filepath);
+  BinaryCursor cursor{static_cast<const char *>(mapping.addr), mapping.size};
+  readMetadataBlock(cursor, lattice_metadata);
+
+  const uint64_t num_primitives = cursor.read<uint64_t>();
+  primitives.clear();
+  primitives.reserve(num_primitives);
+  for (uint64_t i = 0; i < num_primitives; ++i) {
+    MotionPrimitive primitive;
+    primitive.trajectory_id = cursor.read<uint32_t>();
+    primitive.start_angle = cursor.read<float>();
+    primitive.end_angle = cursor.read<float>();
+    primitive.turning_radius = cursor.read<float>();
+    primitive.trajectory_length = cursor.read<float>();
+    primitive.arc_length = cursor.read<float>();
+    primitive.straight_length = cursor.read<float>();
+    primitive.left_turn = cursor.read<uint8_t>() != 0;
+
+    const uint64_t num_poses = cursor.read<uint64_t>();
+    primitive.poses.resize(num_poses);
+    for (uint64_t j = 0; j < num_poses; ++j) {
+      primitive.poses[j]._x = cursor.read<float>();
+      primitive.poses[j]._y = cursor.read<float>();
+      primitive.poses[j]._theta = cursor.read<float>();
+    }
+
+    primitives.push_back(std::move(primitive));
+  }
+}
+
+void writeBinaryLattice(
+  const std::string & lattice_filepath,
+  const LatticeMetadata & lattice_metadata,
+  const MotionPrimitives & primitives)
+{
+  std::ofstream lattice_file(lattice_filepath, std::ios::binary | std::ios::trunc);
+  if (!lattice_file) {
+    throw std::runtime_error("Could not open binary lattice file for writing!");
+  }
+
+  auto write = [&lattice_file](const void * source, const size_t & num_bytes) {
+      lattice_file.write(static_cast<const char *>(source), num_bytes);
+    };
+  auto write_uint32 = [&write](const uint32_t & value) {write(&value, sizeof(value));};
+  auto write_uint64 = [&write](const uint64_t & value) {write(&value, sizeof(value));};
+  auto write_float = [&write](const float & value) {write(&value, sizeof(value));};
+
+  write_uint32(lattice_binary_magic);
+  write_uint32(lattice_binary_version);
+  write_float(lattice_metadata.min_turning_radius);
+  write_float(lattice_metadata.grid_resolution);
+  write_uint32(lattice_metadata.number_of_headings);
+  write_uint32(lattice_metadata.number_of_trajectories);
+  write_uint32(lattice_metadata.motion_model.size());
+  write(lattice_metadata.motion_model.data(), lattice_metadata.motion_model.size());
+  write(
+    lattice_metadata.heading_angles.data(),
+    lattice_metadata.heading_angles.size() * sizeof(float));
+
+  write_uint64(primitives.size());
+  for (const MotionPrimitive & primitive : primitives) {
+    write_uint32(primitive.trajectory_id);
+    write_float(primitive.start_angle);
+    write_float(primitive.end_angle);
+    write_float(primitive.turning_radius);
+    write_float(primitive.trajectory_length);
+    write_float(primitive.arc_length);
+    write_float(primitive.straight_length);
+    const uint8_t left_turn = primitive.left_turn ? 1 : 0;
+    write(&left_turn, sizeof(left_turn));
+
+    write_uint64(primitive.poses.size());
+    for (const MotionPose & pose : primitive.poses) {
+      write_float(pose._x);
+      write_float(pose._y);
+      write_float(pose._theta);
+    }
+  }
+
+  lattice_file.close();
+  if (!lattice_file) {
+    throw std::runtime_error("Could not write binary lattice file!");
+  }
+}
+
+}  // namespace nav2_smac_planner
@@ -14,13 +14,21 @@
 // See the License for the specific language governing permissions and
 // limitations under the License. Reserved.
 
+#include <fcntl.h>
 #include <math.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <vector>
 #include <memory>
 #include <algorithm>
 #include <queue>
 #include <limits>
+#include <string>
 #include <utility>
 
 #include "ompl/base/ScopedState.h"
@@ -40,10 +48,16 @@ float NodeHybrid::travel_distance_cost = sqrtf(2.0f);
 HybridMotionTable NodeHybrid::motion_table;
 float NodeHybrid::size_lookup = 25;
 LookupTable NodeHybrid::dist_heuristic_lookup_table;
+float * NodeHybrid::dist_heuristic_table_ptr = nullptr;
+void * NodeHybrid::dist_heuristic_mapping = nullptr;
+size_t NodeHybrid::dist_heuristic_mapping_size = 0;
 std::shared_ptr<nav2_costmap_2d::Costmap2DROS> NodeHybrid::costmap_ros = nullptr;
 std::shared_ptr<nav2_costmap_2d::InflationLayer> NodeHybrid::inflation_layer = nullptr;
 
 ObstacleHeuristicQueue NodeHybrid::obstacle_heuristic_queue;
+LookupTable NodeHybrid::sampled_cost_cache;
+unsigned int NodeHybrid::obstacle_heuristic_goal_index =
+  std::numeric_limits<unsigned int>::max();
 
 // Each of these tables are the projected motion models through
 // time and space applied to the search on the current node in
@@ -68,6 +82,7 @@ void HybridMotionTable::initDubin(
   travel_distance_reward = 1.0f - search_info.retrospective_penalty;
   downsample_obstacle_heuristic = search_info.downsample_obstacle_heuristic;
   use_quadratic_cost_penalty = search_info.use_quadratic_cost_penalty;
+  incremental_obstacle_heuristic = search_info.incremental_obstacle_heuristic;
 
   // if nothing changed, no need to re-compute primitives
   if (num_angle_quantization_in == num_angle_quantization &&
@@ -195,6 +210,7 @@ void HybridMotionTable::initReedsShepp(
   travel_distance_reward = 1.0f - search_info.retrospective_penalty;
   downsample_obstacle_heuristic = search_info.downsample_obstacle_heuristic;
   use_quadratic_cost_penalty = search_info.use_quadratic_cost_penalty;
+  incremental_obstacle_heuristic = search_info.incremental_obstacle_heuristic;
 
   // if nothing changed, no need to re-compute primitives
   if (num_angle_quantization_in == num_angle_quantization &&
@@ -299,9 +315,10 @@ void HybridMotionTable::initReedsShepp(
   }
 }
 
-MotionPoses HybridMotionTable::getProjections(const NodeHybrid * node)
+void HybridMotionTable::getProjections(
+  const NodeHybrid * node, MotionPoses & projection_list)
 {
-  MotionPoses projection_list;
+  projection_list.clear();
   projection_list.reserve(projections.size());
 
   for (unsigned int i = 0; i != projections.size(); i++) {
@@ -324,8 +341,6 @@ MotionPoses HybridMotionTable::getProjections(const NodeHybrid * node)
       delta_ys[i][node_heading] + node->pose.y,
       new_heading, motion_model._turn_dir);
   }
-
-  return projection_list;
 }
 
 unsigned int HybridMotionTable::getClosestAngularBin(const double & theta)
@@ -482,6 +497,37 @@ inline float distanceHeuristic2D(
   return std::sqrt(dx * dx + dy * dy);
 }
 
+inline float sampledCost(
+  nav2_costmap_2d::Costmap2D * costmap, const unsigned int idx,
+  const unsigned int size_x, const bool downsample)
+{
+  if (!downsample) {
+    return static_cast<float>(costmap->getCost(idx));
+  }
+
+  // Get costmap values as if downsampled
+  unsigned int y_offset = (idx / size_x) * 2;
+  unsigned int x_offset = (idx - ((idx / size_x) * size_x)) * 2;
+  float cost = costmap->getCost(x_offset, y_offset);
+  for (unsigned int i = 0; i < 2u; ++i) {
+    unsigned int mxd = x_offset + i;
+    if (mxd >= costmap->getSizeInCellsX()) {
+      continue;
+    }
+    for (unsigned int j = 0; j < 2u; ++j) {
+      unsigned int myd = y_offset + j;
+      if (myd >= costmap->getSizeInCellsY()) {
+        continue;
+      }
+      if (i == 0 && j == 0) {
+        continue;
+      }
+      cost = std::min(cost, static_cast<float>(costmap->getCost(mxd, myd)));
+    }
+  }
+  return cost;
+}
+
 void NodeHybrid::resetObstacleHeuristic(
   std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros_i,
   const unsigned int & start_x, const unsigned int & start_y,
@@ -507,6 +553,25 @@ void NodeHybrid::resetObstacleHeuristic(
     size = size_x * costmap->getSizeInCellsY();
   }
 
+  // Set initial goal point to queue from. Divided by 2 due to downsampled costmap.
+  unsigned int goal_index;
+  if (motion_table.downsample_obstacle_heuristic) {
+    goal_index = floor(goal_y / 2.0f) * size_x + floor(goal_x / 2.0f);
+  } else {
+    goal_index = floor(goal_y) * size_x + floor(goal_x);
+  }
+
+  // If the goal is unchanged, repair the existing expansion around cells
+  // whose cost changed instead of recomputing the whole table from scratch
+  if (motion_table.incremental_obstacle_heuristic &&
+    goal_index == obstacle_heuristic_goal_index &&
+    obstacle_heuristic_lookup_table.size() == size &&
+    sampled_cost_cache.size() == size &&
+    repairObstacleHeuristic(costmap, goal_index, size_x))
+  {
+    return;
+  }
+
   if (obstacle_heuristic_lookup_table.size() == size) {
     // must reset all values
     std::fill(
@@ -523,20 +588,211 @@ void NodeHybrid::resetObstacleHeuristic(
   obstacle_heuristic_queue.clear();
   obstacle_heuristic_queue.reserve(size);
 
-  // Set initial goal point to queue from. Divided by 2 due to downsampled costmap.
-  unsigned int goal_index;
-  if (motion_table.downsample_obstacle_heuristic) {
-    goal_index = floor(goal_y / 2.0f) * size_x + floor(goal_x / 2.0f);
-  } else {
-    goal_index = floor(goal_y) * size_x + floor(goal_x);
-  }
-
   obstacle_heuristic_queue.emplace_back(
     distanceHeuristic2D(goal_index, size_x, start_x, start_y), goal_index);
 
   // initialize goal cell with a very small value to differentiate it from 0.0 (~uninitialized)
   // the negative value means the cell is in the open set
   obstacle_heuristic_lookup_table[goal_index] = -0.00001f;
+
+  // snapshot the sampled costs so the next request can detect changed cells
+  if (motion_table.incremental_obstacle_heuristic) {
+    const bool downsample = motion_table.downsample_obstacle_heuristic;
+    sampled_cost_cache.resize(size);
+    for (unsigned int i = 0; i < size; ++i) {
+      sampled_cost_cache[i] = sampledCost(costmap, i, size_x, downsample);
+    }
+    obstacle_heuristic_goal_index = goal_index;
+  } else {
+    sampled_cost_cache.clear();
+    obstacle_heuristic_goal_index = std::numeric_limits<unsigned int>::max();
+  }
+}
+
+void NodeHybrid::resetObstacleHeuristic(
+  std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros_i,
+  const unsigned int & start_x, const unsigned int & start_y,
+  const std::vector<std::pair<unsigned int, unsigned int>> & goals)
+{
+  costmap_ros = costmap_ros_i;
+  inflation_layer = nav2_costmap_2d::InflationLayer::getInflationLayer(costmap_ros);
+  auto costmap = costmap_ros->getCostmap();
+
+  unsigned int size = 0u;
+  unsigned int size_x = 0u;
+  if (motion_table.downsample_obstacle_heuristic) {
+    size_x = ceil(static_cast<float>(costmap->getSizeInCellsX()) / 2.0f);
+    size = size_x *
+      ceil(static_cast<float>(costmap->getSizeInCellsY()) / 2.0f);
+  } else {
+    size_x = costmap->getSizeInCellsX();
+    size = size_x * costmap->getSizeInCellsY();
+  }
+
+  if (obstacle_heuristic_lookup_table.size() == size) {
+    // must reset all values
+    std::fill(
+      obstacle_heuristic_lookup_table.begin(),
+      obstacle_heuristic_lookup_table.end(), 0.0f);
+  } else {
+    unsigned int obstacle_size = obstacle_heuristic_lookup_table.size();
+    obstacle_heuristic_lookup_table.resize(size, 0.0f);
+    // must reset values for non-constructed indices
+    std::fill_n(
+      obstacle_heuristic_lookup_table.begin(), obstacle_size, 0.0f);
+  }
+
+  obstacle_heuristic_queue.clear();
+  obstacle_heuristic_queue.reserve(size);
+
+  // Seed every candidate goal so a single expansion yields an admissible
+  // heuristic to the nearest of them from any cell
+  for (const std::pair<unsigned int, unsigned int> & goal : goals) {
+    unsigned int goal_index;
+    if (motion_table.downsample_obstacle_heuristic) {
+      goal_index = floor(goal.second / 2.0f) * size_x + floor(goal.first / 2.0f);
+    } else {
+      goal_index = floor(goal.second) * size_x + floor(goal.first);
+    }
+
+    if (obstacle_heuristic_lookup_table[goal_index] == 0.0f) {
+      obstacle_heuristic_queue.emplace_back(
+        distanceHeuristic2D(goal_index, size_x, start_x, start_y), goal_index);
+      obstacle_heuristic_lookup_table[goal_index] = -0.00001f;
+    }
+  }
+
+  // multi-goal envelopes are not incrementally repairable: the goal set
+  // changes between requests, so the single-goal repair path does not apply
+  sampled_cost_cache.clear();
+  obstacle_heuristic_goal_index = std::numeric_limits<unsigned int>::max();
+}
+
+bool NodeHybrid::repairObstacleHeuristic(
+  nav2_costmap_2d::Costmap2D * costmap,
+  const unsigned int & goal_index, const unsigned int & size_x)
+{
+  const bool downsample = motion_table.downsample_obstacle_heuristic;
+  const unsigned int size = obstacle_heuristic_lookup_table.size();
+  const unsigned int size_y = size / size_x;
+  const int size_x_int = static_cast<int>(size_x);
+  const float sqrt2 = sqrtf(2.0f);
+  const std::vector<int> neighborhood = {1, -1,  // left right
+    size_x_int, -size_x_int,  // up down
+    size_x_int + 1, size_x_int - 1,  // upper diagonals
+    -size_x_int + 1, -size_x_int - 1};  // lower diagonals
+
+  // find the cells whose sampled cost changed since the previous request
+  std::vector<std::pair<unsigned int, float>> wave;  // (cell, old |value|)
+  for (unsigned int i = 0; i < size; ++i) {
+    const float cost = sampledCost(costmap, i, size_x, downsample);
+    if (cost != sampled_cost_cache[i]) {
+      if (cost < sampled_cost_cache[i]) {
+        // a lowered cost can create shortcuts improving cells well outside
+        // the invalidated region, which the retained expansion cannot see;
+        // fall back to a full recomputation to stay admissible
+        return false;
+      }
+      sampled_cost_cache[i] = cost;
+      if (obstacle_heuristic_lookup_table[i] != 0.0f) {
+        wave.emplace_back(i, fabsf(obstacle_heuristic_lookup_table[i]));
+        obstacle_heuristic_lookup_table[i] = 0.0f;
+      }
+    }
+  }
+
+  if (wave.empty()) {
+    // nothing moved, the previous expansion is still exact
+    return true;
+  }
+
+  // invalidate downstream of the changed cells: any neighbor with a larger
+  // value may have derived its cost through the cell being cleared, since
+  // values increase strictly monotonically away from the goal
+  std::vector<unsigned int> cleared;
+  while (!wave.empty()) {
+    const float old_value = wave.back().second;
+    const unsigned int idx = wave.back().first;
+    wave.pop_back();
+    cleared.push_back(idx);
+    for (unsigned int i = 0; i != neighborhood.size(); i++) {
+      const unsigned int new_idx = static_cast<unsigned int>(
+        static_cast<int>(idx) + neighborhood[i]);
+      if (new_idx >= size) {
+        continue;
+      }
+      const float value = obstacle_heuristic_lookup_table[new_idx];
+      if (value != 0.0f && fabsf(value) > old_value) {
+        wave.emplace_back(new_idx, fabsf(value));
+        obstacle_heuristic_lookup_table[new_idx] = 0.0f;
+      }
+    }
+  }
+
+  // drop retained frontier entries pointing into the invalidated region
+  obstacle_heuristic_queue.erase(
+    std::remove_if(
+      obstacle_heuristic_queue.begin(), obstacle_heuristic_queue.end(),
+      [](const ObstacleHeuristicElement & e) {
+        return obstacle_heuristic_lookup_table[e.second] == 0.0f;
+      }),
+    obstacle_heuristic_queue.end());
+
+  // re-seed the goal if it was swept up in the invalidation
+  if (obstacle_heuristic_lookup_table[goal_index] == 0.0f) {
+    obstacle_heuristic_lookup_table[goal_index] = -0.00001f;
+    obstacle_heuristic_queue.emplace_back(0.0f, goal_index);
+  }
+
+  // re-open cleared cells bordering the surviving expansion so the lazy
+  // search can rebuild just the invalidated region on demand; queue
+  // priorities are recomputed wholesale on the next heuristic query
+  const bool is_circular = costmap_ros->getUseRadius();
+  for (const unsigned int & idx : cleared) {
+    float cost = sampled_cost_cache[idx];
+    if (!is_circular) {
+      cost = adjustedFootprintCost(cost);
+      if (cost >= OCCUPIED) {
+        continue;
+      }
+    } else if (cost >= INSCRIBED) {
+      continue;
+    }
+
+    const unsigned int my = idx / size_x;
+    const unsigned int mx = idx - (my * size_x);
+    if (mx >= size_x - 3 || mx <= 3 || my >= size_y - 3 || my <= 3) {
+      continue;
+    }
+
+    float best_cost = 0.0f;
+    for (unsigned int i = 0; i != neighborhood.size(); i++) {
+      const unsigned int new_idx = static_cast<unsigned int>(
+        static_cast<int>(idx) + neighborhood[i]);
+      if (new_idx >= size || obstacle_heuristic_lookup_table[new_idx] <= 0.0f) {
+        continue;
+      }
+      float travel_cost;
+      if (motion_table.use_quadratic_cost_penalty) {
+        travel_cost = (i <= 3 ? 1.0f : sqrt2) *
+          (1.0f + (motion_table.cost_penalty * cost * cost / 63504.0f));  // 252^2
+      } else {
+        travel_cost = (i <= 3 ? 1.0f : sqrt2) *
+          (1.0f + (motion_table.cost_penalty * cost / 252.0f));
+      }
+      const float new_cost = obstacle_heuristic_lookup_table[new_idx] + travel_cost;
+      if (best_cost == 0.0f || new_cost < best_cost) {
+        best_cost = new_cost;
+      }
+    }
+
+    if (best_cost > 0.0f) {
+      obstacle_heuristic_lookup_table[idx] = -best_cost;
+      obstacle_heuristic_queue.emplace_back(best_cost, idx);
+    }
+  }
+
+  return true;
 }
 
 float NodeHybrid::adjustedFootprintCost(const float & cost)
@@ -646,30 +902,7 @@ float NodeHybrid::getObstacleHeuristic(
 
       // if neighbor path is better and non-lethal, set new cost and add to queue
       if (new_idx < size_x * size_y) {
-        if (downsample_H) {
-          // Get costmap values as if downsampled
-          unsigned int y_offset = (new_idx / size_x) * 2;
-          unsigned int x_offset = (new_idx - ((new_idx / size_x) * size_x)) * 2;
-          cost = costmap->getCost(x_offset, y_offset);
-          for (unsigned int i = 0; i < 2u; ++i) {
-            unsigned int mxd = x_offset + i;
-            if (mxd >= costmap->getSizeInCellsX()) {
-              continue;
-            }
-            for (unsigned int j = 0; j < 2u; ++j) {
-              unsigned int myd = y_offset + j;
-              if (myd >= costmap->getSizeInCellsY()) {
-                continue;
-              }
-              if (i == 0 && j == 0) {
-                continue;
-              }
-              cost = std::min(cost, static_cast<float>(costmap->getCost(mxd, myd)));
-            }
-          }
-        } else {
-          cost = static_cast<float>(costmap->getCost(new_idx));
-        }
+        cost = sampledCost(costmap, new_idx, size_x, downsample_H);
 
         if (!is_circular) {
           // Adjust cost value if using SE2 footprint checks
@@ -794,7 +1027,7 @@ float NodeHybrid::getDistanceHeuristic(
       x_pos * ceiling_size * motion_table.num_angle_quantization +
       y_pos * motion_table.num_angle_quantization +
       theta_pos;
-    motion_heuristic = dist_heuristic_lookup_table[index];
+    motion_heuristic = dist_heuristic_table_ptr[index];
   } else if (obstacle_heuristic <= 0.0) {
     // If no obstacle heuristic value, must have some H to use
     // In nominal situations, this should never be called.
@@ -840,12 +1073,24 @@ void NodeHybrid::precomputeDistanceHeuristic(
   int dim_3_size_int = static_cast<int>(dim_3_size);
   float angular_bin_size = 2 * M_PI / static_cast<float>(dim_3_size);
 
+  // If a cache file is set, map a previously persisted table instead of
+  // recomputing the distances, which dominates startup on large windows
+  unmapDistanceHeuristic();
+  const uint64_t num_entries =
+    static_cast<uint64_t>(size_lookup * ceil(size_lookup / 2.0) * dim_3_size_int);
+  if (!search_info.lookup_table_cache_path.empty() &&
+    mapDistanceHeuristic(
+      search_info.lookup_table_cache_path, motion_model, dim_3_size, search_info, num_entries))
+  {
+    return;
+  }
+
   // Create a lookup table of Dubin/Reeds-Shepp distances in a window around the goal
   // to help drive the search towards admissible approaches. Deu to symmetries in the
   // Heuristic space, we need to only store 2 of the 4 quadrants and simply mirror
   // around the X axis any relative node lookup. This reduces memory overhead and increases
   // the size of a window a platform can store in memory.
-  dist_heuristic_lookup_table.resize(size_lookup * ceil(size_lookup / 2.0) * dim_3_size_int);
+  dist_heuristic_lookup_table.resize(num_entries);
   for (float x = ceil(-size_lookup / 2.0); x <= floor(size_lookup / 2.0); x += 1.0) {
     for (float y = 0.0; y <= floor(size_lookup / 2.0); y += 1.0) {
       for (int heading = 0; heading != dim_3_size_int; heading++) {
@@ -858,6 +1103,131 @@ void NodeHybrid::precomputeDistanceHeuristic(
       }
     }
   }
+  dist_heuristic_table_ptr = dist_heuristic_lookup_table.data();
+
+  if (!search_info.lookup_table_cache_path.empty()) {
+    persistDistanceHeuristic(
+      search_info.lookup_table_cache_path, motion_model, dim_3_size, search_info, num_entries);
+  }
+}
+
+// On-disk layout preceding the raw float entries of a persisted table
+struct DistHeuristicFileHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t motion_model;
+  uint32_t dim_3_size;
+  float size_lookup;
+  float min_turning_radius;
+  uint64_t num_entries;
+};
+
+const uint32_t dist_heuristic_file_magic = 0x4E324448;  // "N2DH"
+const uint32_t dist_heuristic_file_version = 1;
+
+bool NodeHybrid::mapDistanceHeuristic(
+  const std::string & filepath,
+  const MotionModel & motion_model,
+  const unsigned int & dim_3_size,
+  const SearchInfo & search_info,
+  const uint64_t & num_entries)
+{
+  int fd = open(filepath.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat file_info;
+  if (fstat(fd, &file_info) < 0 ||
+    static_cast<uint64_t>(file_info.st_size) !=
+    sizeof(DistHeuristicFileHeader) + num_entries * sizeof(float))
+  {
+    RCLCPP_WARN(
+      rclcpp::get_logger("SmacPlannerHybrid"),
+      "Distance heuristic cache %s is not sized for the current settings, recomputing.",
+      filepath.c_str());
+    close(fd);
+    return false;
+  }
+
+  void * mapping = mmap(nullptr, file_info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+
+  DistHeuristicFileHeader header;
+  memcpy(&header, mapping, sizeof(header));
+  if (header.magic != dist_heuristic_file_magic ||
+    header.version != dist_heuristic_file_version ||
+    header.motion_model != static_cast<uint32_t>(motion_model) ||
+    header.dim_3_size != dim_3_size ||
+    header.size_lookup != size_lookup ||
+    header.min_turning_radius != search_info.minimum_turning_radius ||
+    header.num_entries != num_entries)
+  {
+    RCLCPP_WARN(
+      rclcpp::get_logger("SmacPlannerHybrid"),
+      "Distance heuristic cache %s was generated with different settings, recomputing.",
+      filepath.c_str());
+    munmap(mapping, file_info.st_size);
+    return false;
+  }
+
+  dist_heuristic_mapping = mapping;
+  dist_heuristic_mapping_size = file_info.st_size;
+  dist_heuristic_table_ptr = reinterpret_cast<float *>(
+    static_cast<char *>(mapping) + sizeof(DistHeuristicFileHeader));
+
+  // The table lives in the mapping, release the in-memory copy
+  dist_heuristic_lookup_table.clear();
+  dist_heuristic_lookup_table.shrink_to_fit();
+  return true;
+}
+
+void NodeHybrid::persistDistanceHeuristic(
+  const std::string & filepath,
+  const MotionModel & motion_model,
+  const unsigned int & dim_3_size,
+  const SearchInfo & search_info,
+  const uint64_t & num_entries)
+{
+  DistHeuristicFileHeader header;
+  header.magic = dist_heuristic_file_magic;
+  header.version = dist_heuristic_file_version;
+  header.motion_model = static_cast<uint32_t>(motion_model);
+  header.dim_3_size = dim_3_size;
+  header.size_lookup = size_lookup;
+  header.min_turning_radius = search_info.minimum_turning_radius;
+  header.num_entries = num_entries;
+
+  // Write to a scratch file and rename so a concurrent reader on a shared
+  // filesystem never maps a partially written table
+  const std::string scratch_filepath = filepath + ".tmp";
+  std::ofstream file(scratch_filepath, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  file.write(
+    reinterpret_cast<const char *>(dist_heuristic_lookup_table.data()),
+    num_entries * sizeof(float));
+  file.close();
+
+  if (!file || std::rename(scratch_filepath.c_str(), filepath.c_str()) != 0) {
+    RCLCPP_WARN(
+      rclcpp::get_logger("SmacPlannerHybrid"),
+      "Unable to persist distance heuristic cache to %s.", filepath.c_str());
+    std::remove(scratch_filepath.c_str());
+  }
+}
+
+void NodeHybrid::unmapDistanceHeuristic()
+{
+  if (dist_heuristic_mapping) {
+    munmap(dist_heuristic_mapping, dist_heuristic_mapping_size);
+    dist_heuristic_mapping = nullptr;
+    dist_heuristic_mapping_size = 0;
+    dist_heuristic_table_ptr = nullptr;
+  }
 }
 
 void NodeHybrid::getNeighbors(
@@ -870,7 +1240,10 @@ void NodeHybrid::getNeighbors(
   uint64_t index = 0;
   NodePtr neighbor = nullptr;
   Coordinates initial_node_coords;
-  const MotionPoses motion_projections = motion_table.getProjections(this);
+  // Scratch storage reused across expansions, per search thread, so the
+  // hot loop performs no allocations after the first expansions
+  thread_local MotionPoses motion_projections;
+  motion_table.getProjections(this, motion_projections);
 
   for (unsigned int i = 0; i != motion_projections.size(); i++) {
     index = NodeHybrid::getIndex(
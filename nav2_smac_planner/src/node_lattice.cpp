@@ -27,6 +27,7 @@
 #include "ompl/base/spaces/DubinsStateSpace.h"
 #include "ompl/base/spaces/ReedsSheppStateSpace.h"
 
+#include "nav2_smac_planner/lattice_binary_io.hpp"
 #include "nav2_smac_planner/node_lattice.hpp"
 
 using namespace std::chrono;  // NOLINT
@@ -66,14 +67,27 @@ void LatticeMotionTable::initMotionModel(
   rotation_penalty = search_info.rotation_penalty;
   min_turning_radius = search_info.minimum_turning_radius;
 
-  // Get the metadata about this minimum control set
-  lattice_metadata = getLatticeMetadata(current_lattice_filepath);
-  std::ifstream latticeFile(current_lattice_filepath);
-  if (!latticeFile.is_open()) {
-    throw std::runtime_error("Could not open lattice file");
+  // Read the metadata and primitives of this minimum control set, from the
+  // compiled binary format if given one, else by parsing the JSON file
+  MotionPrimitives all_primitives;
+  if (isBinaryLatticeFile(current_lattice_filepath)) {
+    readBinaryLattice(current_lattice_filepath, lattice_metadata, all_primitives);
+  } else {
+    std::ifstream latticeFile(current_lattice_filepath);
+    if (!latticeFile.is_open()) {
+      throw std::runtime_error("Could not open lattice file");
+    }
+    nlohmann::json json;
+    latticeFile >> json;
+    fromJsonToMetaData(json["lattice_metadata"], lattice_metadata);
+    nlohmann::json json_primitives = json["primitives"];
+    all_primitives.reserve(json_primitives.size());
+    for (unsigned int i = 0; i < json_primitives.size(); ++i) {
+      MotionPrimitive new_primitive;
+      fromJsonToMotionPrimitive(json_primitives[i], new_primitive);
+      all_primitives.push_back(new_primitive);
+    }
   }
-  nlohmann::json json;
-  latticeFile >> json;
   num_angle_quantization = lattice_metadata.number_of_headings;
 
   if (!state_space) {
@@ -91,10 +105,8 @@ void LatticeMotionTable::initMotionModel(
   // Populate the motion primitives at each heading angle
   float prev_start_angle = 0.0;
   std::vector<MotionPrimitive> primitives;
-  nlohmann::json json_primitives = json["primitives"];
-  for (unsigned int i = 0; i < json_primitives.size(); ++i) {
-    MotionPrimitive new_primitive;
-    fromJsonToMotionPrimitive(json_primitives[i], new_primitive);
+  for (unsigned int i = 0; i < all_primitives.size(); ++i) {
+    MotionPrimitive & new_primitive = all_primitives[i];
 
     if (prev_start_angle != new_primitive.start_angle) {
       motion_primitives.push_back(primitives);
@@ -114,12 +126,15 @@ void LatticeMotionTable::initMotionModel(
   }
 }
 
-MotionPrimitivePtrs LatticeMotionTable::getMotionPrimitives(
+void LatticeMotionTable::getMotionPrimitives(
   const NodeLattice * node,
-  unsigned int & direction_change_index)
+  unsigned int & direction_change_index,
+  MotionPrimitivePtrs & primitive_projection_list)
 {
   MotionPrimitives & prims_at_heading = motion_primitives[node->pose.theta];
-  MotionPrimitivePtrs primitive_projection_list;
+  primitive_projection_list.clear();
+  primitive_projection_list.reserve(
+    prims_at_heading.size() * (allow_reverse_expansion ? 2 : 1));
   for (unsigned int i = 0; i != prims_at_heading.size(); i++) {
     primitive_projection_list.push_back(&prims_at_heading[i]);
   }
@@ -142,12 +157,14 @@ MotionPrimitivePtrs LatticeMotionTable::getMotionPrimitives(
       primitive_projection_list.push_back(&prims_at_reverse_heading[i]);
     }
   }
-
-  return primitive_projection_list;
 }
 
 LatticeMetadata LatticeMotionTable::getLatticeMetadata(const std::string & lattice_filepath)
 {
+  if (isBinaryLatticeFile(lattice_filepath)) {
+    return readBinaryLatticeMetadata(lattice_filepath);
+  }
+
   std::ifstream lattice_file(lattice_filepath);
   if (!lattice_file.is_open()) {
     throw std::runtime_error("Could not open lattice file!");
@@ -235,45 +252,54 @@ bool NodeLattice::isNodeValid(
   float max_cell_cost = collision_checker->getCost();
 
   // If valid motion primitives are set, check intermediary poses > 1 cell apart
+  // as one batch, deduplicating the footprint cells shared between the poses
   if (motion_primitive) {
     const float & grid_resolution = motion_table.lattice_metadata.grid_resolution;
-    const float & resolution_diag_sq = 2.0 * grid_resolution * grid_resolution;
-    MotionPose last_pose(1e9, 1e9, 1e9, TurnDirection::UNKNOWN);
-    MotionPose pose_dist(0.0, 0.0, 0.0, TurnDirection::UNKNOWN);
 
-    // Back out the initial node starting point to move motion primitive relative to
-    MotionPose initial_pose, prim_pose;
-    initial_pose._x = this->pose.x - (motion_primitive->poses.back()._x / grid_resolution);
-    initial_pose._y = this->pose.y - (motion_primitive->poses.back()._y / grid_resolution);
-    initial_pose._theta = motion_table.getAngleFromBin(motion_primitive->start_angle);
-
-    for (auto it = motion_primitive->poses.begin(); it != motion_primitive->poses.end(); ++it) {
-      // poses are in metric coordinates from (0, 0), not grid space yet
-      pose_dist = *it - last_pose;
-      // Avoid square roots by (hypot(x, y) > res) == (x*x+y*y > diag*diag)
-      if (pose_dist._x * pose_dist._x + pose_dist._y * pose_dist._y > resolution_diag_sq) {
-        last_pose = *it;
-        // Convert primitive pose into grid space if it should be checked
-        prim_pose._x = initial_pose._x + (it->_x / grid_resolution);
-        prim_pose._y = initial_pose._y + (it->_y / grid_resolution);
-        // If reversing, invert the angle because the robot is backing into the primitive
-        // not driving forward with it
-        if (is_backwards) {
-          prim_pose._theta = std::fmod(it->_theta + M_PI, 2.0 * M_PI);
-        } else {
-          prim_pose._theta = it->_theta;
+    // Register the primitive's swept footprint with the collision checker on
+    // first use, or again if the footprint changed since
+    if (motion_primitive->swept_handle_forward == std::numeric_limits<unsigned int>::max() ||
+      motion_primitive->swept_generation != collision_checker->getFootprintGeneration())
+    {
+      const float & resolution_diag_sq = 2.0 * grid_resolution * grid_resolution;
+      MotionPose last_pose(1e9, 1e9, 1e9, TurnDirection::UNKNOWN);
+      MotionPose pose_dist(0.0, 0.0, 0.0, TurnDirection::UNKNOWN);
+      MotionPoses forward_samples, backward_samples;
+
+      for (auto it = motion_primitive->poses.begin(); it != motion_primitive->poses.end(); ++it) {
+        // poses are in metric coordinates from (0, 0), not grid space yet
+        pose_dist = *it - last_pose;
+        // Avoid square roots by (hypot(x, y) > res) == (x*x+y*y > diag*diag)
+        if (pose_dist._x * pose_dist._x + pose_dist._y * pose_dist._y > resolution_diag_sq) {
+          last_pose = *it;
+          forward_samples.emplace_back(
+            it->_x / grid_resolution, it->_y / grid_resolution,
+            it->_theta, TurnDirection::UNKNOWN);
+          // If reversing, invert the angle because the robot is backing into the primitive
+          // not driving forward with it
+          backward_samples.emplace_back(
+            it->_x / grid_resolution, it->_y / grid_resolution,
+            std::fmod(it->_theta + M_PI, 2.0 * M_PI), TurnDirection::UNKNOWN);
         }
-        if (collision_checker->inCollision(
-            prim_pose._x,
-            prim_pose._y,
-            prim_pose._theta / bin_size /*bin in collision checker*/,
-            traverse_unknown))
-        {
-          return false;
-        }
-        max_cell_cost = std::max(max_cell_cost, collision_checker->getCost());
       }
+
+      motion_primitive->swept_handle_forward =
+        collision_checker->registerSweptFootprint(forward_samples);
+      motion_primitive->swept_handle_backward =
+        collision_checker->registerSweptFootprint(backward_samples);
+      motion_primitive->swept_generation = collision_checker->getFootprintGeneration();
+    }
+
+    // Back out the initial node starting point to move motion primitive relative to
+    const float initial_x = this->pose.x - (motion_primitive->poses.back()._x / grid_resolution);
+    const float initial_y = this->pose.y - (motion_primitive->poses.back()._y / grid_resolution);
+    const unsigned int & handle = is_backwards ?
+      motion_primitive->swept_handle_backward : motion_primitive->swept_handle_forward;
+
+    if (collision_checker->inCollisionSwept(initial_x, initial_y, handle, traverse_unknown)) {
+      return false;
     }
+    max_cell_cost = std::max(max_cell_cost, collision_checker->getCost());
   }
 
   _cell_cost = max_cell_cost;
@@ -486,9 +512,10 @@ void NodeLattice::getNeighbors(
   NodePtr neighbor = nullptr;
   Coordinates initial_node_coords, motion_projection;
   unsigned int direction_change_index = 0;
-  MotionPrimitivePtrs motion_primitives = motion_table.getMotionPrimitives(
-    this,
-    direction_change_index);
+  // Scratch storage reused across expansions, per search thread, so the
+  // hot loop performs no allocations after the first expansions
+  thread_local MotionPrimitivePtrs motion_primitives;
+  motion_table.getMotionPrimitives(this, direction_change_index, motion_primitives);
   const float & grid_resolution = motion_table.lattice_metadata.grid_resolution;
 
   for (unsigned int i = 0; i != motion_primitives.size(); i++) {
@@ -34,7 +34,7 @@ SmacPlanner2D::SmacPlanner2D()
   _collision_checker(nullptr, 1, nullptr),
   _smoother(nullptr),
   _costmap(nullptr),
-  _costmap_downsampler(nullptr)
+  _pyramid(nullptr)
 {
 }
 
@@ -70,6 +70,15 @@ void SmacPlanner2D::configure(
   nav2_util::declare_parameter_if_not_declared(
     node, name + ".downsampling_factor", rclcpp::ParameterValue(1));
   node->get_parameter(name + ".downsampling_factor", _downsampling_factor);
+  nav2_util::declare_parameter_if_not_declared(
+    node, name + ".coarse_to_fine_search", rclcpp::ParameterValue(false));
+  node->get_parameter(name + ".coarse_to_fine_search", _coarse_to_fine);
+  nav2_util::declare_parameter_if_not_declared(
+    node, name + ".coarse_to_fine_factor", rclcpp::ParameterValue(4));
+  node->get_parameter(name + ".coarse_to_fine_factor", _coarse_to_fine_factor);
+  nav2_util::declare_parameter_if_not_declared(
+    node, name + ".corridor_width", rclcpp::ParameterValue(1.5));
+  node->get_parameter(name + ".corridor_width", _corridor_width);
   nav2_util::declare_parameter_if_not_declared(
     node, name + ".cost_travel_multiplier", rclcpp::ParameterValue(1.0));
   node->get_parameter(name + ".cost_travel_multiplier", _search_info.cost_penalty);
@@ -89,6 +98,9 @@ void SmacPlanner2D::configure(
   nav2_util::declare_parameter_if_not_declared(
     node, name + ".use_final_approach_orientation", rclcpp::ParameterValue(false));
   node->get_parameter(name + ".use_final_approach_orientation", _use_final_approach_orientation);
+  nav2_util::declare_parameter_if_not_declared(
+    node, name + ".use_bidirectional_search", rclcpp::ParameterValue(false));
+  node->get_parameter(name + ".use_bidirectional_search", _search_info.use_bidirectional_search);
 
   nav2_util::declare_parameter_if_not_declared(
     node, name + ".max_planning_time", rclcpp::ParameterValue(2.0));
@@ -135,12 +147,12 @@ void SmacPlanner2D::configure(
   _smoother = std::make_unique<Smoother>(params);
   _smoother->initialize(1e-50 /*No valid minimum turning radius for 2D*/);
 
-  // Initialize costmap downsampler
+  // Attach to the multi-resolution pyramid shared between the planners
+  // running on this costmap, so each level is only maintained once
+  _pyramid = CostmapPyramid::getOrCreate(_costmap);
   if (_downsample_costmap && _downsampling_factor > 1) {
-    std::string topic_name = "downsampled_costmap";
-    _costmap_downsampler = std::make_unique<CostmapDownsampler>();
-    _costmap_downsampler->on_configure(
-      node, _global_frame, topic_name, _costmap, _downsampling_factor);
+    _pyramid->addLevelPublisher(
+      node, _global_frame, "downsampled_costmap", _downsampling_factor);
   }
 
   _raw_plan_publisher = node->create_publisher<nav_msgs::msg::Path>("unsmoothed_plan", 1);
@@ -159,9 +171,7 @@ void SmacPlanner2D::activate()
     _logger, "Activating plugin %s of type SmacPlanner2D",
     _name.c_str());
   _raw_plan_publisher->on_activate();
-  if (_costmap_downsampler) {
-    _costmap_downsampler->on_activate();
-  }
+  _pyramid->on_activate();
   auto node = _node.lock();
   // Add callback for dynamic parameters
   _dyn_params_handler = node->add_on_set_parameters_callback(
@@ -174,9 +184,7 @@ void SmacPlanner2D::deactivate()
     _logger, "Deactivating plugin %s of type SmacPlanner2D",
     _name.c_str());
   _raw_plan_publisher->on_deactivate();
-  if (_costmap_downsampler) {
-    _costmap_downsampler->on_deactivate();
-  }
+  _pyramid->on_deactivate();
   // shutdown dyn_param_handler
   auto node = _node.lock();
   if (_dyn_params_handler && node) {
@@ -192,10 +200,7 @@ void SmacPlanner2D::cleanup()
     _name.c_str());
   _a_star.reset();
   _smoother.reset();
-  if (_costmap_downsampler) {
-    _costmap_downsampler->on_cleanup();
-    _costmap_downsampler.reset();
-  }
+  _pyramid.reset();
   _raw_plan_publisher.reset();
 }
 
@@ -211,10 +216,10 @@ nav_msgs::msg::Path SmacPlanner2D::createPlan(
 
   // Downsample costmap, if required
   nav2_costmap_2d::Costmap2D * costmap = _costmap;
-  if (_costmap_downsampler) {
-    costmap = _costmap_downsampler->downsample(_downsampling_factor);
-    _collision_checker.setCostmap(costmap);
+  if (_downsample_costmap && _downsampling_factor > 1) {
+    costmap = _pyramid->getLevel(_downsampling_factor);
   }
+  _collision_checker.setCostmap(costmap);
 
   // Set collision checker and costmap information
   _a_star->setCollisionChecker(&_collision_checker);
@@ -271,14 +276,47 @@ nav_msgs::msg::Path SmacPlanner2D::createPlan(
     return plan;
   }
 
+  // Find a corridor at a coarser pyramid level to prune the fine search,
+  // when enabled and searching at full resolution
+  bool masked = false;
+  if (_coarse_to_fine && _coarse_to_fine_factor > 1 && costmap == _costmap) {
+    const unsigned int radius_cells =
+      static_cast<unsigned int>(_corridor_width / costmap->getResolution());
+    masked = _pyramid->findCorridor(
+      _coarse_to_fine_factor,
+      static_cast<unsigned int>(mx_start), static_cast<unsigned int>(my_start),
+      static_cast<unsigned int>(mx_goal), static_cast<unsigned int>(my_goal),
+      radius_cells, _expansion_mask);
+  }
+  _a_star->setExpansionMask(masked ? &_expansion_mask : nullptr);
+
   // Compute plan
   Node2D::CoordinateVector path;
   int num_iterations = 0;
-  // Note: All exceptions thrown are handled by the planner server and returned to the action
-  if (!_a_star->createPath(
+  bool found = _a_star->createPath(
+    path, num_iterations,
+    _tolerance / static_cast<float>(costmap->getResolution()), cancel_checker);
+
+  // The corridor is a heuristic restriction; if nothing was found inside
+  // it, fall back to an unrestricted search before giving up
+  if (!found && masked) {
+    _a_star->setExpansionMask(nullptr);
+    masked = false;
+    path.clear();
+    num_iterations = 0;
+    _a_star->setCollisionChecker(&_collision_checker);  // clears the searched graph
+    _a_star->setStart(mx_start, my_start, 0);
+    _a_star->setGoal(mx_goal, my_goal, 0);
+    found = _a_star->createPath(
       path, num_iterations,
-      _tolerance / static_cast<float>(costmap->getResolution()), cancel_checker))
-  {
+      _tolerance / static_cast<float>(costmap->getResolution()), cancel_checker);
+  }
+  if (masked) {
+    _a_star->setExpansionMask(nullptr);
+  }
+
+  // Note: All exceptions thrown are handled by the planner server and returned to the action
+  if (!found) {
     // Note: If the start is blocked only one iteration will occur before failure
     if (num_iterations == 1) {
       throw nav2_core::StartOccupied("Start occupied");
@@ -364,6 +402,8 @@ SmacPlanner2D::dynamicParametersCallback(std::vector<rclcpp::Parameter> paramete
       } else if (name == _name + ".max_planning_time") {
         reinit_a_star = true;
         _max_planning_time = parameter.as_double();
+      } else if (name == _name + ".corridor_width") {
+        _corridor_width = parameter.as_double();
       }
     } else if (type == ParameterType::PARAMETER_BOOL) {
       if (name == _name + ".downsample_costmap") {
@@ -374,11 +414,18 @@ SmacPlanner2D::dynamicParametersCallback(std::vector<rclcpp::Parameter> paramete
         _allow_unknown = parameter.as_bool();
       } else if (name == _name + ".use_final_approach_orientation") {
         _use_final_approach_orientation = parameter.as_bool();
+      } else if (name == _name + ".use_bidirectional_search") {
+        reinit_a_star = true;
+        _search_info.use_bidirectional_search = parameter.as_bool();
+      } else if (name == _name + ".coarse_to_fine_search") {
+        _coarse_to_fine = parameter.as_bool();
       }
     } else if (type == ParameterType::PARAMETER_INTEGER) {
       if (name == _name + ".downsampling_factor") {
         reinit_downsampler = true;
         _downsampling_factor = parameter.as_int();
+      } else if (name == _name + ".coarse_to_fine_factor") {
+        _coarse_to_fine_factor = parameter.as_int();
       } else if (name == _name + ".max_iterations") {
         reinit_a_star = true;
         _max_iterations = parameter.as_int();
@@ -419,14 +466,12 @@ SmacPlanner2D::dynamicParametersCallback(std::vector<rclcpp::Parameter> paramete
         1.0 /*unused for 2D*/);
     }
 
-    // Re-Initialize costmap downsampler
+    // Attach the downsampled-costmap publisher to the new level if needed
     if (reinit_downsampler) {
       if (_downsample_costmap && _downsampling_factor > 1) {
         auto node = _node.lock();
-        std::string topic_name = "downsampled_costmap";
-        _costmap_downsampler = std::make_unique<CostmapDownsampler>();
-        _costmap_downsampler->on_configure(
-          node, _global_frame, topic_name, _costmap, _downsampling_factor);
+        _pyramid->addLevelPublisher(
+          node, _global_frame, "downsampled_costmap", _downsampling_factor);
       }
     }
   }
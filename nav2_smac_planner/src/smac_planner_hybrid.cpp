@@ -37,7 +37,7 @@ SmacPlannerHybrid::SmacPlannerHybrid()
   _smoother(nullptr),
   _costmap(nullptr),
   _costmap_ros(nullptr),
-  _costmap_downsampler(nullptr)
+  _pyramid(nullptr)
 {
 }
 
@@ -85,6 +85,9 @@ void SmacPlannerHybrid::configure(
   nav2_util::declare_parameter_if_not_declared(
     node, name + ".tolerance", rclcpp::ParameterValue(0.25));
   _tolerance = static_cast<float>(node->get_parameter(name + ".tolerance").as_double());
+  nav2_util::declare_parameter_if_not_declared(
+    node, name + ".goal_heading_tolerance", rclcpp::ParameterValue(0.0));
+  node->get_parameter(name + ".goal_heading_tolerance", _goal_heading_tolerance);
   nav2_util::declare_parameter_if_not_declared(
     node, name + ".allow_unknown", rclcpp::ParameterValue(true));
   node->get_parameter(name + ".allow_unknown", _allow_unknown);
@@ -146,6 +149,10 @@ void SmacPlannerHybrid::configure(
     node, name + ".downsample_obstacle_heuristic", rclcpp::ParameterValue(true));
   node->get_parameter(
     name + ".downsample_obstacle_heuristic", _search_info.downsample_obstacle_heuristic);
+  nav2_util::declare_parameter_if_not_declared(
+    node, name + ".incremental_obstacle_heuristic", rclcpp::ParameterValue(false));
+  node->get_parameter(
+    name + ".incremental_obstacle_heuristic", _search_info.incremental_obstacle_heuristic);
 
   nav2_util::declare_parameter_if_not_declared(
     node, name + ".analytic_expansion_max_length", rclcpp::ParameterValue(3.0));
@@ -159,11 +166,18 @@ void SmacPlannerHybrid::configure(
   nav2_util::declare_parameter_if_not_declared(
     node, name + ".lookup_table_size", rclcpp::ParameterValue(20.0));
   node->get_parameter(name + ".lookup_table_size", _lookup_table_size);
+  nav2_util::declare_parameter_if_not_declared(
+    node, name + ".lookup_table_cache_path", rclcpp::ParameterValue(std::string("")));
+  node->get_parameter(name + ".lookup_table_cache_path", _search_info.lookup_table_cache_path);
 
   nav2_util::declare_parameter_if_not_declared(
     node, name + ".debug_visualizations", rclcpp::ParameterValue(false));
   node->get_parameter(name + ".debug_visualizations", _debug_visualizations);
 
+  nav2_util::declare_parameter_if_not_declared(
+    node, name + ".debug_expansion_telemetry", rclcpp::ParameterValue(false));
+  node->get_parameter(name + ".debug_expansion_telemetry", _debug_expansion_telemetry);
+
   nav2_util::declare_parameter_if_not_declared(
     node, name + ".motion_model_for_search", rclcpp::ParameterValue(std::string("DUBIN")));
   node->get_parameter(name + ".motion_model_for_search", _motion_model_for_search);
@@ -225,16 +239,30 @@ void SmacPlannerHybrid::configure(
     _costmap_ros->getUseRadius(),
     findCircumscribedCost(_costmap_ros));
 
-  // Initialize A* template
-  _a_star = std::make_unique<AStarAlgorithm<NodeHybrid>>(_motion_model, _search_info);
-  _a_star->initialize(
-    _allow_unknown,
-    _max_iterations,
-    _max_on_approach_iterations,
-    _terminal_checking_interval,
-    _max_planning_time,
-    _lookup_table_dim,
-    _angle_quantizations);
+  // Initialize A* template, updating a still-live instance in place so a
+  // reconfigure does not pay the cold-start cost of its heuristic tables
+  if (_a_star) {
+    _a_star->updateSearchInfo(
+      _motion_model, _search_info, _lookup_table_dim, _angle_quantizations);
+    _a_star->initialize(
+      _allow_unknown,
+      _max_iterations,
+      _max_on_approach_iterations,
+      _terminal_checking_interval,
+      _max_planning_time,
+      _lookup_table_dim,
+      _angle_quantizations);
+  } else {
+    _a_star = std::make_unique<AStarAlgorithm<NodeHybrid>>(_motion_model, _search_info);
+    _a_star->initialize(
+      _allow_unknown,
+      _max_iterations,
+      _max_on_approach_iterations,
+      _terminal_checking_interval,
+      _max_planning_time,
+      _lookup_table_dim,
+      _angle_quantizations);
+  }
 
   // Initialize path smoother
   if (smooth_path) {
@@ -244,12 +272,12 @@ void SmacPlannerHybrid::configure(
     _smoother->initialize(_minimum_turning_radius_global_coords);
   }
 
-  // Initialize costmap downsampler
+  // Attach to the multi-resolution pyramid shared between the planners
+  // running on this costmap, so each level is only maintained once
+  _pyramid = CostmapPyramid::getOrCreate(_costmap);
   if (_downsample_costmap && _downsampling_factor > 1) {
-    _costmap_downsampler = std::make_unique<CostmapDownsampler>();
-    std::string topic_name = "downsampled_costmap";
-    _costmap_downsampler->on_configure(
-      node, _global_frame, topic_name, _costmap, _downsampling_factor);
+    _pyramid->addLevelPublisher(
+      node, _global_frame, "downsampled_costmap", _downsampling_factor);
   }
 
   _raw_plan_publisher = node->create_publisher<nav_msgs::msg::Path>("unsmoothed_plan", 1);
@@ -260,6 +288,11 @@ void SmacPlannerHybrid::configure(
       "planned_footprints", 1);
   }
 
+  if (_debug_expansion_telemetry) {
+    _expansion_telemetry_publisher = node->create_publisher<nav2_msgs::msg::ExpansionTelemetry>(
+      "expansion_telemetry", 1);
+  }
+
   RCLCPP_INFO(
     _logger, "Configured plugin %s of type SmacPlannerHybrid with "
     "maximum iterations %i, max on approach iterations %i, and %s. Tolerance %.2f."
@@ -279,9 +312,10 @@ void SmacPlannerHybrid::activate()
     _expansions_publisher->on_activate();
     _planned_footprints_publisher->on_activate();
   }
-  if (_costmap_downsampler) {
-    _costmap_downsampler->on_activate();
+  if (_debug_expansion_telemetry) {
+    _expansion_telemetry_publisher->on_activate();
   }
+  _pyramid->on_activate();
   auto node = _node.lock();
   // Add callback for dynamic parameters
   _dyn_params_handler = node->add_on_set_parameters_callback(
@@ -308,9 +342,10 @@ void SmacPlannerHybrid::deactivate()
     _expansions_publisher->on_deactivate();
     _planned_footprints_publisher->on_deactivate();
   }
-  if (_costmap_downsampler) {
-    _costmap_downsampler->on_deactivate();
+  if (_debug_expansion_telemetry) {
+    _expansion_telemetry_publisher->on_deactivate();
   }
+  _pyramid->on_deactivate();
   // shutdown dyn_param_handler
   auto node = _node.lock();
   if (_dyn_params_handler && node) {
@@ -327,13 +362,11 @@ void SmacPlannerHybrid::cleanup()
   nav2_smac_planner::NodeHybrid::destroyStaticAssets();
   _a_star.reset();
   _smoother.reset();
-  if (_costmap_downsampler) {
-    _costmap_downsampler->on_cleanup();
-    _costmap_downsampler.reset();
-  }
+  _pyramid.reset();
   _raw_plan_publisher.reset();
   _expansions_publisher.reset();
   _planned_footprints_publisher.reset();
+  _expansion_telemetry_publisher.reset();
 }
 
 nav_msgs::msg::Path SmacPlannerHybrid::createPlan(
@@ -344,14 +377,29 @@ nav_msgs::msg::Path SmacPlannerHybrid::createPlan(
   std::lock_guard<std::mutex> lock_reinit(_mutex);
   steady_clock::time_point a = steady_clock::now();
 
-  std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock(*(_costmap->getMutex()));
+  // Plan against the immutable snapshot of the last completed update cycle
+  // when one exists, so the search does not hold the costmap lock and
+  // obstacle integration keeps running; until the first snapshot has been
+  // produced, fall back to locking the live costmap for the whole search
+  std::shared_ptr<const nav2_costmap_2d::Costmap2D> snapshot =
+    _costmap_ros->getCostmapSnapshot();
+  std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock(
+    *(_costmap->getMutex()), std::defer_lock);
+  if (!snapshot) {
+    lock.lock();
+  }
 
-  // Downsample costmap, if required
-  nav2_costmap_2d::Costmap2D * costmap = _costmap;
-  if (_costmap_downsampler) {
-    costmap = _costmap_downsampler->downsample(_downsampling_factor);
-    _collision_checker.setCostmap(costmap);
+  // Downsample costmap, if required. The snapshot is never written, so the
+  // const_cast only bridges to read-only consumers.
+  nav2_costmap_2d::Costmap2D * costmap = snapshot ?
+    const_cast<nav2_costmap_2d::Costmap2D *>(snapshot.get()) : _costmap;
+  if (_downsample_costmap && _downsampling_factor > 1) {
+    // the pyramid reads the live costmap, so it refreshes under the lock
+    if (snapshot) {lock.lock();}
+    costmap = _pyramid->getLevel(_downsampling_factor);
+    if (snapshot) {lock.unlock();}
   }
+  _collision_checker.setCostmap(costmap);
 
   // Set collision checker and costmap information
   _collision_checker.setFootprint(
@@ -394,7 +442,34 @@ nav_msgs::msg::Path SmacPlannerHybrid::createPlan(
     orientation_bin -= static_cast<float>(_angle_quantizations);
   }
   orientation_bin_id = static_cast<unsigned int>(floor(orientation_bin));
-  _a_star->setGoal(mx, my, orientation_bin_id);
+
+  // Accept every heading bin within the goal heading tolerance as a
+  // termination, charging each off-heading candidate the cost of the final
+  // rotation it leaves behind (an arc at the minimum turning radius), so
+  // near-goal expansions stop maneuvering to hit one exact quantized heading
+  const unsigned int tolerance_bins = std::min(
+    static_cast<unsigned int>(_goal_heading_tolerance / _angle_bin_size),
+    (_angle_quantizations - 1) / 2);
+  if (tolerance_bins == 0) {
+    _a_star->setGoal(mx, my, orientation_bin_id);
+  } else {
+    NodeHybrid::CoordinateVector goal_candidates;
+    std::vector<float> rotation_costs;
+    goal_candidates.reserve(2 * tolerance_bins + 1);
+    rotation_costs.reserve(2 * tolerance_bins + 1);
+    const float rotation_cost_per_bin = _search_info.minimum_turning_radius *
+      static_cast<float>(_angle_bin_size) * _search_info.non_straight_penalty;
+    const int quantizations = static_cast<int>(_angle_quantizations);
+    for (int offset = -static_cast<int>(tolerance_bins);
+      offset <= static_cast<int>(tolerance_bins); offset++)
+    {
+      const unsigned int bin = static_cast<unsigned int>(
+        (static_cast<int>(orientation_bin_id) + offset + quantizations) % quantizations);
+      goal_candidates.emplace_back(mx, my, static_cast<float>(bin));
+      rotation_costs.push_back(std::abs(offset) * rotation_cost_per_bin);
+    }
+    _a_star->setGoals(goal_candidates, rotation_costs);
+  }
 
   // Setup message
   nav_msgs::msg::Path plan;
@@ -416,6 +491,12 @@ nav_msgs::msg::Path SmacPlannerHybrid::createPlan(
   if (_debug_visualizations) {
     expansions = std::make_unique<std::vector<std::tuple<float, float, float>>>();
   }
+  if (_debug_expansion_telemetry) {
+    _expansion_telemetry.reset(costmap->getSizeInCellsX(), costmap->getSizeInCellsY());
+    _a_star->setExpansionTelemetry(&_expansion_telemetry);
+  } else {
+    _a_star->setExpansionTelemetry(nullptr);
+  }
   // Note: All exceptions thrown are handled by the planner server and returned to the action
   if (!_a_star->createPath(
       path, num_iterations,
@@ -434,6 +515,10 @@ nav_msgs::msg::Path SmacPlannerHybrid::createPlan(
       }
       _expansions_publisher->publish(msg);
     }
+    if (_debug_expansion_telemetry) {
+      publishExpansionTelemetry(
+        duration_cast<duration<double>>(steady_clock::now() - a).count());
+    }
 
     // Note: If the start is blocked only one iteration will occur before failure
     if (num_iterations == 1) {
@@ -497,6 +582,10 @@ nav_msgs::msg::Path SmacPlannerHybrid::createPlan(
   duration<double> time_span = duration_cast<duration<double>>(b - a);
   double time_remaining = _max_planning_time - static_cast<double>(time_span.count());
 
+  if (_debug_expansion_telemetry) {
+    publishExpansionTelemetry(static_cast<double>(time_span.count()));
+  }
+
 #ifdef BENCHMARK_TESTING
   std::cout << "It took " << time_span.count() * 1000 <<
     " milliseconds with " << num_iterations << " iterations." << std::endl;
@@ -517,6 +606,206 @@ nav_msgs::msg::Path SmacPlannerHybrid::createPlan(
   return plan;
 }
 
+nav_msgs::msg::Path SmacPlannerHybrid::createPlanToGoalSet(
+  const geometry_msgs::msg::PoseStamped & start,
+  const std::vector<geometry_msgs::msg::PoseStamped> & goals,
+  std::function<bool()> cancel_checker,
+  int & best_goal_index,
+  std::vector<float> & goal_costs)
+{
+  std::lock_guard<std::mutex> lock_reinit(_mutex);
+  steady_clock::time_point a = steady_clock::now();
+
+  // Same snapshot-on-request scheme as createPlan(): search lock-free
+  // against the last completed update cycle whenever a snapshot exists
+  std::shared_ptr<const nav2_costmap_2d::Costmap2D> snapshot =
+    _costmap_ros->getCostmapSnapshot();
+  std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock(
+    *(_costmap->getMutex()), std::defer_lock);
+  if (!snapshot) {
+    lock.lock();
+  }
+
+  best_goal_index = -1;
+  goal_costs.assign(goals.size(), -1.0f);
+
+  // Downsample costmap, if required
+  nav2_costmap_2d::Costmap2D * costmap = snapshot ?
+    const_cast<nav2_costmap_2d::Costmap2D *>(snapshot.get()) : _costmap;
+  if (_downsample_costmap && _downsampling_factor > 1) {
+    // the pyramid reads the live costmap, so it refreshes under the lock
+    if (snapshot) {lock.lock();}
+    costmap = _pyramid->getLevel(_downsampling_factor);
+    if (snapshot) {lock.unlock();}
+  }
+  _collision_checker.setCostmap(costmap);
+
+  // Set collision checker and costmap information
+  _collision_checker.setFootprint(
+    _costmap_ros->getRobotFootprint(),
+    _costmap_ros->getUseRadius(),
+    findCircumscribedCost(_costmap_ros));
+  _a_star->setCollisionChecker(&_collision_checker);
+
+  // Set starting point, in A* bin search coordinates
+  float mx, my;
+  if (!costmap->worldToMapContinuous(start.pose.position.x, start.pose.position.y, mx, my)) {
+    throw nav2_core::StartOutsideMapBounds(
+            "Start Coordinates of(" + std::to_string(start.pose.position.x) + ", " +
+            std::to_string(start.pose.position.y) + ") was outside bounds");
+  }
+
+  double orientation_bin = tf2::getYaw(start.pose.orientation) / _angle_bin_size;
+  while (orientation_bin < 0.0) {
+    orientation_bin += static_cast<float>(_angle_quantizations);
+  }
+  // This is needed to handle precision issues
+  if (orientation_bin >= static_cast<float>(_angle_quantizations)) {
+    orientation_bin -= static_cast<float>(_angle_quantizations);
+  }
+  unsigned int orientation_bin_id = static_cast<unsigned int>(floor(orientation_bin));
+  _a_star->setStart(mx, my, orientation_bin_id);
+
+  // Set candidate goal points, in A* bin search coordinates; candidates
+  // outside the costmap are excluded and keep their -1 cost
+  NodeHybrid::CoordinateVector candidates;
+  std::vector<unsigned int> candidate_to_goal;
+  candidates.reserve(goals.size());
+  candidate_to_goal.reserve(goals.size());
+  for (unsigned int i = 0; i != goals.size(); i++) {
+    if (!costmap->worldToMapContinuous(
+        goals[i].pose.position.x, goals[i].pose.position.y, mx, my))
+    {
+      continue;
+    }
+    orientation_bin = tf2::getYaw(goals[i].pose.orientation) / _angle_bin_size;
+    while (orientation_bin < 0.0) {
+      orientation_bin += static_cast<float>(_angle_quantizations);
+    }
+    // This is needed to handle precision issues
+    if (orientation_bin >= static_cast<float>(_angle_quantizations)) {
+      orientation_bin -= static_cast<float>(_angle_quantizations);
+    }
+    candidates.emplace_back(mx, my, floor(orientation_bin));
+    candidate_to_goal.push_back(i);
+  }
+
+  if (candidates.empty()) {
+    throw nav2_core::GoalOutsideMapBounds(
+            "All " + std::to_string(goals.size()) +
+            " goal candidates were outside the map bounds");
+  }
+  _a_star->setGoals(candidates);
+
+  // Setup message
+  nav_msgs::msg::Path plan;
+  plan.header.stamp = _clock->now();
+  plan.header.frame_id = _global_frame;
+  geometry_msgs::msg::PoseStamped pose;
+  pose.header = plan.header;
+  pose.pose.position.z = 0.0;
+  pose.pose.orientation.x = 0.0;
+  pose.pose.orientation.y = 0.0;
+  pose.pose.orientation.z = 0.0;
+  pose.pose.orientation.w = 1.0;
+
+  // Compute plan
+  NodeHybrid::CoordinateVector path;
+  int num_iterations = 0;
+  if (_debug_expansion_telemetry) {
+    _expansion_telemetry.reset(costmap->getSizeInCellsX(), costmap->getSizeInCellsY());
+    _a_star->setExpansionTelemetry(&_expansion_telemetry);
+  } else {
+    _a_star->setExpansionTelemetry(nullptr);
+  }
+  // Note: All exceptions thrown are handled by the planner server and returned to the action
+  if (!_a_star->createPath(
+      path, num_iterations,
+      _tolerance / static_cast<float>(costmap->getResolution()), cancel_checker))
+  {
+    if (_debug_expansion_telemetry) {
+      publishExpansionTelemetry(
+        duration_cast<duration<double>>(steady_clock::now() - a).count());
+    }
+
+    // Note: If the start is blocked only one iteration will occur before failure
+    if (num_iterations == 1) {
+      throw nav2_core::StartOccupied("Start occupied");
+    }
+
+    if (num_iterations < _a_star->getMaxIterations()) {
+      throw nav2_core::NoValidPathCouldBeFound("no valid path found to any goal candidate");
+    } else {
+      throw nav2_core::PlannerTimedOut("exceeded maximum iterations");
+    }
+  }
+
+  // Map the settled candidate and per-candidate costs back to the goal
+  // indices given by the caller
+  const int best_candidate = _a_star->getBestGoalIndex();
+  if (best_candidate >= 0) {
+    best_goal_index = static_cast<int>(candidate_to_goal[best_candidate]);
+  }
+  const std::vector<float> & candidate_costs = _a_star->getGoalSetCosts();
+  for (unsigned int i = 0; i != candidate_costs.size(); i++) {
+    goal_costs[candidate_to_goal[i]] = candidate_costs[i];
+  }
+
+  // Convert to world coordinates
+  plan.poses.reserve(path.size());
+  for (int i = path.size() - 1; i >= 0; --i) {
+    pose.pose = getWorldCoords(path[i].x, path[i].y, costmap);
+    pose.pose.orientation = getWorldOrientation(path[i].theta);
+    plan.poses.push_back(pose);
+  }
+
+  // Publish raw path for debug
+  if (_raw_plan_publisher->get_subscription_count() > 0) {
+    _raw_plan_publisher->publish(plan);
+  }
+
+  // Find how much time we have left to do smoothing
+  steady_clock::time_point b = steady_clock::now();
+  duration<double> time_span = duration_cast<duration<double>>(b - a);
+  double time_remaining = _max_planning_time - static_cast<double>(time_span.count());
+
+  if (_debug_expansion_telemetry) {
+    publishExpansionTelemetry(static_cast<double>(time_span.count()));
+  }
+
+  // Smooth plan
+  if (_smoother && num_iterations > 1) {
+    _smoother->smooth(plan, costmap, time_remaining);
+  }
+
+  return plan;
+}
+
+void SmacPlannerHybrid::publishExpansionTelemetry(const double & planning_time)
+{
+  if (_expansion_telemetry_publisher->get_subscription_count() == 0) {
+    return;
+  }
+
+  auto msg = std::make_unique<nav2_msgs::msg::ExpansionTelemetry>();
+  msg->header.stamp = _clock->now();
+  msg->header.frame_id = _global_frame;
+  msg->expansions = _expansion_telemetry.expansions;
+  msg->duplicate_pops = _expansion_telemetry.duplicate_pops;
+  msg->analytic_attempts = _expansion_telemetry.analytic_attempts;
+  msg->analytic_successes = _expansion_telemetry.analytic_successes;
+  msg->tile_size = ExpansionTelemetry::tile_size;
+  msg->tiles_x = _expansion_telemetry.tiles_x;
+  msg->tiles_y = _expansion_telemetry.tiles_y;
+  msg->tile_expansions = _expansion_telemetry.tile_expansions;
+  std::copy(
+    _expansion_telemetry.heuristic_share_histogram.begin(),
+    _expansion_telemetry.heuristic_share_histogram.end(),
+    msg->heuristic_share_histogram.begin());
+  msg->planning_time = planning_time;
+  _expansion_telemetry_publisher->publish(std::move(msg));
+}
+
 rcl_interfaces::msg::SetParametersResult
 SmacPlannerHybrid::dynamicParametersCallback(std::vector<rclcpp::Parameter> parameters)
 {
@@ -538,6 +827,8 @@ SmacPlannerHybrid::dynamicParametersCallback(std::vector<rclcpp::Parameter> para
         _max_planning_time = parameter.as_double();
       } else if (name == _name + ".tolerance") {
         _tolerance = static_cast<float>(parameter.as_double());
+      } else if (name == _name + ".goal_heading_tolerance") {
+        _goal_heading_tolerance = parameter.as_double();
       } else if (name == _name + ".lookup_table_size") {
         reinit_a_star = true;
         _lookup_table_size = parameter.as_double();
@@ -595,6 +886,9 @@ SmacPlannerHybrid::dynamicParametersCallback(std::vector<rclcpp::Parameter> para
       } else if (name == _name + ".cache_obstacle_heuristic") {
         reinit_a_star = true;
         _search_info.cache_obstacle_heuristic = parameter.as_bool();
+      } else if (name == _name + ".incremental_obstacle_heuristic") {
+        reinit_a_star = true;
+        _search_info.incremental_obstacle_heuristic = parameter.as_bool();
       } else if (name == _name + ".allow_primitive_interpolation") {
         _search_info.allow_primitive_interpolation = parameter.as_bool();
         reinit_a_star = true;
@@ -652,6 +946,9 @@ SmacPlannerHybrid::dynamicParametersCallback(std::vector<rclcpp::Parameter> para
             "valid options are MOORE, VON_NEUMANN, DUBIN, REEDS_SHEPP.",
             _motion_model_for_search.c_str());
         }
+      } else if (name == _name + ".lookup_table_cache_path") {
+        reinit_a_star = true;
+        _search_info.lookup_table_cache_path = parameter.as_string();
       }
     }
   }
@@ -682,9 +979,12 @@ SmacPlannerHybrid::dynamicParametersCallback(std::vector<rclcpp::Parameter> para
 
     auto node = _node.lock();
 
-    // Re-Initialize A* template
+    // Re-Initialize A* template in place, retaining the graph reservations
+    // and recomputing the distance heuristic only when its inputs changed,
+    // so threshold tweaks do not leave the planner cold-starting
     if (reinit_a_star) {
-      _a_star = std::make_unique<AStarAlgorithm<NodeHybrid>>(_motion_model, _search_info);
+      _a_star->updateSearchInfo(
+        _motion_model, _search_info, _lookup_table_dim, _angle_quantizations);
       _a_star->initialize(
         _allow_unknown,
         _max_iterations,
@@ -695,14 +995,10 @@ SmacPlannerHybrid::dynamicParametersCallback(std::vector<rclcpp::Parameter> para
         _angle_quantizations);
     }
 
-    // Re-Initialize costmap downsampler
-    if (reinit_downsampler) {
-      if (_downsample_costmap && _downsampling_factor > 1) {
-        std::string topic_name = "downsampled_costmap";
-        _costmap_downsampler = std::make_unique<CostmapDownsampler>();
-        _costmap_downsampler->on_configure(
-          node, _global_frame, topic_name, _costmap, _downsampling_factor);
-      }
+    // Attach the downsampled-costmap publisher to the new level if needed
+    if (reinit_downsampler && _downsample_costmap && _downsampling_factor > 1) {
+      _pyramid->addLevelPublisher(
+        node, _global_frame, "downsampled_costmap", _downsampling_factor);
     }
 
     // Re-Initialize collision checker
@@ -277,7 +277,23 @@ nav_msgs::msg::Path SmacPlannerLattice::createPlan(
   std::lock_guard<std::mutex> lock_reinit(_mutex);
   steady_clock::time_point a = steady_clock::now();
 
-  std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock(*(_costmap->getMutex()));
+  // Plan against the immutable snapshot of the last completed update cycle
+  // when one exists, so the search does not hold the costmap lock and
+  // obstacle integration keeps running; until the first snapshot has been
+  // produced, fall back to locking the live costmap for the whole search
+  std::shared_ptr<const nav2_costmap_2d::Costmap2D> snapshot =
+    _costmap_ros->getCostmapSnapshot();
+  std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock(
+    *(_costmap->getMutex()), std::defer_lock);
+  if (!snapshot) {
+    lock.lock();
+  }
+
+  // The snapshot is never written, so the const_cast only bridges to
+  // read-only consumers
+  nav2_costmap_2d::Costmap2D * costmap = snapshot ?
+    const_cast<nav2_costmap_2d::Costmap2D *>(snapshot.get()) : _costmap;
+  _collision_checker.setCostmap(costmap);
 
   // Set collision checker and costmap information
   _collision_checker.setFootprint(
@@ -288,7 +304,7 @@ nav_msgs::msg::Path SmacPlannerLattice::createPlan(
 
   // Set starting point, in A* bin search coordinates
   float mx, my;
-  if (!_costmap->worldToMapContinuous(start.pose.position.x, start.pose.position.y, mx, my)) {
+  if (!costmap->worldToMapContinuous(start.pose.position.x, start.pose.position.y, mx, my)) {
     throw nav2_core::StartOutsideMapBounds(
             "Start Coordinates of(" + std::to_string(start.pose.position.x) + ", " +
             std::to_string(start.pose.position.y) + ") was outside bounds");
@@ -298,7 +314,7 @@ nav_msgs::msg::Path SmacPlannerLattice::createPlan(
     NodeLattice::motion_table.getClosestAngularBin(tf2::getYaw(start.pose.orientation)));
 
   // Set goal point, in A* bin search coordinates
-  if (!_costmap->worldToMapContinuous(goal.pose.position.x, goal.pose.position.y, mx, my)) {
+  if (!costmap->worldToMapContinuous(goal.pose.position.x, goal.pose.position.y, mx, my)) {
     throw nav2_core::GoalOutsideMapBounds(
             "Goal Coordinates of(" + std::to_string(goal.pose.position.x) + ", " +
             std::to_string(goal.pose.position.y) + ") was outside bounds");
@@ -331,7 +347,7 @@ nav_msgs::msg::Path SmacPlannerLattice::createPlan(
   // Note: All exceptions thrown are handled by the planner server and returned to the action
   if (!_a_star->createPath(
       path, num_iterations,
-      _tolerance / static_cast<float>(_costmap->getResolution()), cancel_checker, expansions.get()))
+      _tolerance / static_cast<float>(costmap->getResolution()), cancel_checker, expansions.get()))
   {
     if (_debug_visualizations) {
       geometry_msgs::msg::PoseArray msg;
@@ -363,7 +379,7 @@ nav_msgs::msg::Path SmacPlannerLattice::createPlan(
   plan.poses.reserve(path.size());
   geometry_msgs::msg::PoseStamped last_pose = pose;
   for (int i = path.size() - 1; i >= 0; --i) {
-    pose.pose = getWorldCoords(path[i].x, path[i].y, _costmap);
+    pose.pose = getWorldCoords(path[i].x, path[i].y, costmap);
     pose.pose.orientation = getWorldOrientation(path[i].theta);
     if (fabs(pose.pose.position.x - last_pose.pose.position.x) < 1e-4 &&
       fabs(pose.pose.position.y - last_pose.pose.position.y) < 1e-4 &&
@@ -428,7 +444,7 @@ nav_msgs::msg::Path SmacPlannerLattice::createPlan(
 
   // Smooth plan
   if (_smoother && num_iterations > 1) {
-    _smoother->smooth(plan, _costmap, time_remaining);
+    _smoother->smooth(plan, costmap, time_remaining);
   }
 
 #ifdef BENCHMARK_TESTING
@@ -107,11 +107,16 @@ bool Smoother::smoothImpl(
   int its = 0;
   double change = tolerance_;
   const unsigned int & path_size = path.poses.size();
-  double x_i, y_i, y_m1, y_ip1, y_i_org;
+  double y_i, y_i_org;
   unsigned int mx, my;
 
-  nav_msgs::msg::Path new_path = path;
-  nav_msgs::msg::Path last_path = path;
+  // Iterate over flat coordinate arrays; converting the poses once and back
+  // on exit keeps the hot loop free of message and quaternion accesses.
+  // The loop only updates positions, so orientations stay in the path msg
+  std::vector<double> orig_x, orig_y;
+  pathToArrays(path, orig_x, orig_y);
+  std::vector<double> new_x = orig_x, new_y = orig_y;
+  std::vector<double> last_x = orig_x, last_y = orig_y;
 
   while (change >= tolerance_) {
     its += 1;
@@ -122,7 +127,7 @@ bool Smoother::smoothImpl(
       RCLCPP_DEBUG(
         rclcpp::get_logger("SmacPlannerSmoother"),
         "Number of iterations has exceeded limit of %i.", max_its_);
-      path = last_path;
+      arraysToPath(last_x, last_y, path);
       updateApproximatePathOrientations(path, reversing_segment);
       return false;
     }
@@ -134,32 +139,29 @@ bool Smoother::smoothImpl(
       RCLCPP_DEBUG(
         rclcpp::get_logger("SmacPlannerSmoother"),
         "Smoothing time exceeded allowed duration of %0.2f.", max_time);
-      path = last_path;
+      arraysToPath(last_x, last_y, path);
       updateApproximatePathOrientations(path, reversing_segment);
       return false;
     }
 
     for (unsigned int i = 1; i != path_size - 1; i++) {
-      for (unsigned int j = 0; j != 2; j++) {
-        x_i = getFieldByDim(path.poses[i], j);
-        y_i = getFieldByDim(new_path.poses[i], j);
-        y_m1 = getFieldByDim(new_path.poses[i - 1], j);
-        y_ip1 = getFieldByDim(new_path.poses[i + 1], j);
-        y_i_org = y_i;
-
-        // Smooth based on local 3 point neighborhood and original data locations
-        y_i += data_w_ * (x_i - y_i) + smooth_w_ * (y_ip1 + y_m1 - (2.0 * y_i));
-        setFieldByDim(new_path.poses[i], j, y_i);
-        change += abs(y_i - y_i_org);
-      }
+      // Smooth based on local 3 point neighborhood and original data locations
+      y_i = new_x[i];
+      y_i_org = y_i;
+      y_i += data_w_ * (orig_x[i] - y_i) + smooth_w_ * (new_x[i + 1] + new_x[i - 1] - (2.0 * y_i));
+      new_x[i] = y_i;
+      change += abs(y_i - y_i_org);
+
+      y_i = new_y[i];
+      y_i_org = y_i;
+      y_i += data_w_ * (orig_y[i] - y_i) + smooth_w_ * (new_y[i + 1] + new_y[i - 1] - (2.0 * y_i));
+      new_y[i] = y_i;
+      change += abs(y_i - y_i_org);
 
       // validate update is admissible, only checks cost if a valid costmap pointer is provided
       float cost = 0.0;
       if (costmap) {
-        costmap->worldToMap(
-          getFieldByDim(new_path.poses[i], 0),
-          getFieldByDim(new_path.poses[i], 1),
-          mx, my);
+        costmap->worldToMap(new_x[i], new_y[i], mx, my);
         cost = static_cast<float>(costmap->getCost(mx, my));
       }
 
@@ -168,49 +170,49 @@ bool Smoother::smoothImpl(
           rclcpp::get_logger("SmacPlannerSmoother"),
           "Smoothing process resulted in an infeasible collision. "
           "Returning the last path before the infeasibility was introduced.");
-        path = last_path;
+        arraysToPath(last_x, last_y, path);
         updateApproximatePathOrientations(path, reversing_segment);
         return false;
       }
     }
 
-    last_path = new_path;
+    last_x = new_x;
+    last_y = new_y;
   }
 
+  arraysToPath(new_x, new_y, path);
+
   // Lets do additional refinement, it shouldn't take more than a couple milliseconds
   // but really puts the path quality over the top.
   if (do_refinement_ && refinement_ctr_ < refinement_num_) {
     refinement_ctr_++;
-    smoothImpl(new_path, reversing_segment, costmap, max_time);
+    smoothImpl(path, reversing_segment, costmap, max_time);
   }
 
-  updateApproximatePathOrientations(new_path, reversing_segment);
-  path = new_path;
+  updateApproximatePathOrientations(path, reversing_segment);
   return true;
 }
 
-double Smoother::getFieldByDim(
-  const geometry_msgs::msg::PoseStamped & msg, const unsigned int & dim)
+void Smoother::pathToArrays(
+  const nav_msgs::msg::Path & path,
+  std::vector<double> & xs, std::vector<double> & ys)
 {
-  if (dim == 0) {
-    return msg.pose.position.x;
-  } else if (dim == 1) {
-    return msg.pose.position.y;
-  } else {
-    return msg.pose.position.z;
+  const unsigned int path_size = path.poses.size();
+  xs.resize(path_size);
+  ys.resize(path_size);
+  for (unsigned int i = 0; i != path_size; i++) {
+    xs[i] = path.poses[i].pose.position.x;
+    ys[i] = path.poses[i].pose.position.y;
   }
 }
 
-void Smoother::setFieldByDim(
-  geometry_msgs::msg::PoseStamped & msg, const unsigned int dim,
-  const double & value)
+void Smoother::arraysToPath(
+  const std::vector<double> & xs, const std::vector<double> & ys,
+  nav_msgs::msg::Path & path)
 {
-  if (dim == 0) {
-    msg.pose.position.x = value;
-  } else if (dim == 1) {
-    msg.pose.position.y = value;
-  } else {
-    msg.pose.position.z = value;
+  for (unsigned int i = 0; i != path.poses.size(); i++) {
+    path.poses[i].pose.position.x = xs[i];
+    path.poses[i].pose.position.y = ys[i];
   }
 }
 
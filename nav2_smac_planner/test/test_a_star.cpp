@@ -141,6 +141,74 @@ TEST(AStarTest, test_a_star_2d)
   delete costmapA;
 }
 
+TEST(AStarTest, test_a_star_2d_bidirectional)
+{
+  auto lnode = std::make_shared<rclcpp_lifecycle::LifecycleNode>("test");
+  nav2_smac_planner::SearchInfo info;
+  info.use_bidirectional_search = true;
+  nav2_smac_planner::AStarAlgorithm<nav2_smac_planner::Node2D> a_star(
+    nav2_smac_planner::MotionModel::TWOD, info);
+  int max_iterations = 10000;
+  float tolerance = 0.0;
+  int it_on_approach = 10;
+  int terminal_checking_interval = 5000;
+  double max_planning_time = 120.0;
+  int num_it = 0;
+
+  a_star.initialize(
+    false, max_iterations, it_on_approach, terminal_checking_interval,
+    max_planning_time, 0.0, 1);
+
+  nav2_costmap_2d::Costmap2D * costmapA =
+    new nav2_costmap_2d::Costmap2D(100, 100, 0.1, 0.0, 0.0, 0);
+  // island in the middle of lethal cost to cross
+  for (unsigned int i = 40; i <= 60; ++i) {
+    for (unsigned int j = 40; j <= 60; ++j) {
+      costmapA->setCost(i, j, 254);
+    }
+  }
+
+  // Convert raw costmap into a costmap ros object
+  auto costmap_ros = std::make_shared<nav2_costmap_2d::Costmap2DROS>();
+  costmap_ros->on_configure(rclcpp_lifecycle::State());
+  auto costmap = costmap_ros->getCostmap();
+  *costmap = *costmapA;
+
+  auto dummy_cancel_checker = []() {
+      return false;
+    };
+
+  std::unique_ptr<nav2_smac_planner::GridCollisionChecker> checker =
+    std::make_unique<nav2_smac_planner::GridCollisionChecker>(costmap_ros, 1, lnode);
+  checker->setFootprint(nav2_costmap_2d::Footprint(), true, 0.0);
+  a_star.setCollisionChecker(checker.get());
+  a_star.setStart(20u, 20u, 0);
+  a_star.setGoal(80u, 80u, 0);
+  nav2_smac_planner::Node2D::CoordinateVector path;
+  EXPECT_TRUE(a_star.createPath(path, num_it, tolerance, dummy_cancel_checker));
+
+  // same ordering as the unidirectional search: goal first, start last
+  EXPECT_EQ(path.front().x, 80.0f);
+  EXPECT_EQ(path.front().y, 80.0f);
+  EXPECT_EQ(path.back().x, 20.0f);
+  EXPECT_EQ(path.back().y, 20.0f);
+
+  // path is contiguous across the meeting point and collision free
+  for (unsigned int i = 0; i != path.size(); i++) {
+    EXPECT_EQ(costmapA->getCost(path[i].x, path[i].y), 0);
+    if (i > 0) {
+      EXPECT_LE(fabs(path[i].x - path[i - 1].x), 1.0f);
+      EXPECT_LE(fabs(path[i].y - path[i - 1].y), 1.0f);
+    }
+  }
+
+  // near-optimal: the unidirectional search finds this path in 82 cells
+  EXPECT_GE(path.size(), 80u);
+  EXPECT_LE(path.size(), 85u);
+
+  delete costmapA;
+}
+
 TEST(AStarTest, test_a_star_se2)
 {
   auto lnode = std::make_shared<rclcpp_lifecycle::LifecycleNode>("test");
@@ -214,10 +282,141 @@ TEST(AStarTest, test_a_star_se2)
   // Expansions properly recorded
   EXPECT_GT(expansions->size(), 5u);
 
+  // warm in-place update: tweak a penalty without rebuilding the planner,
+  // search remains functional with the updated search info
+  info.cost_penalty = 2.5;
+  a_star.updateSearchInfo(nav2_smac_planner::MotionModel::DUBIN, info, 401, size_theta);
+  a_star.setCollisionChecker(checker.get());
+  a_star.setStart(10u, 10u, 0u);
+  a_star.setGoal(80u, 80u, 40u);
+  path.clear();
+  num_it = 0;
+  EXPECT_TRUE(a_star.createPath(path, num_it, tolerance, dummy_cancel_checker));
+  EXPECT_GT(path.size(), 0u);
+  for (unsigned int i = 0; i != path.size(); i++) {
+    EXPECT_EQ(costmapA->getCost(path[i].x, path[i].y), 0);
+  }
+
+  // goal-set planning: one search over two candidates settles on the
+  // cheaper one and reports per-candidate costs
+  a_star.setCollisionChecker(checker.get());
+  a_star.setStart(10u, 10u, 0u);
+  nav2_smac_planner::NodeHybrid::CoordinateVector candidates;
+  candidates.emplace_back(80.0f, 80.0f, 40.0f);  // far candidate
+  candidates.emplace_back(30.0f, 10.0f, 0.0f);  // near candidate
+  a_star.setGoals(candidates);
+  path.clear();
+  num_it = 0;
+  EXPECT_TRUE(a_star.createPath(path, num_it, tolerance, dummy_cancel_checker));
+  EXPECT_GT(path.size(), 0u);
+  for (unsigned int i = 0; i != path.size(); i++) {
+    EXPECT_EQ(costmapA->getCost(path[i].x, path[i].y), 0);
+  }
+  EXPECT_EQ(a_star.getBestGoalIndex(), 1);
+  ASSERT_EQ(a_star.getGoalSetCosts().size(), 2u);
+  EXPECT_GT(a_star.getGoalSetCosts()[1], 0.0f);
+  // the path ends at the settled candidate
+  EXPECT_NEAR(path.front().x, 30.0f, 2.0f);
+  EXPECT_NEAR(path.front().y, 10.0f, 2.0f);
+
+  // weighted goal set: a terminal cost on the nearest candidate steers the
+  // search onto a slightly farther free one, which only wins once no queued
+  // node can beat its total any more
+  a_star.setCollisionChecker(checker.get());
+  a_star.setStart(10u, 10u, 0u);
+  candidates.clear();
+  candidates.emplace_back(30.0f, 10.0f, 0.0f);  // near, heavily penalized
+  candidates.emplace_back(35.0f, 10.0f, 0.0f);  // slightly farther, free
+  std::vector<float> terminal_costs = {1000.0f, 0.0f};
+  a_star.setGoals(candidates, terminal_costs);
+  path.clear();
+  num_it = 0;
+  EXPECT_TRUE(a_star.createPath(path, num_it, tolerance, dummy_cancel_checker));
+  EXPECT_GT(path.size(), 0u);
+  EXPECT_EQ(a_star.getBestGoalIndex(), 1);
+  EXPECT_NEAR(path.front().x, 35.0f, 2.0f);
+  EXPECT_NEAR(path.front().y, 10.0f, 2.0f);
+
   delete costmapA;
   nav2_smac_planner::NodeHybrid::destroyStaticAssets();
 }
 
+TEST(AStarTest, test_expansion_telemetry)
+{
+  auto lnode = std::make_shared<rclcpp_lifecycle::LifecycleNode>("test");
+  nav2_smac_planner::SearchInfo info;
+  info.change_penalty = 0.1;
+  info.non_straight_penalty = 1.1;
+  info.reverse_penalty = 2.0;
+  info.minimum_turning_radius = 8;  // in grid coordinates
+  info.retrospective_penalty = 0.015;
+  info.analytic_expansion_max_length = 20.0;  // in grid coordinates
+  info.analytic_expansion_ratio = 3.5;
+  unsigned int size_theta = 72;
+  info.cost_penalty = 1.7;
+  nav2_smac_planner::AStarAlgorithm<nav2_smac_planner::NodeHybrid> a_star(
+    nav2_smac_planner::MotionModel::DUBIN, info);
+  int max_iterations = 10000;
+  float tolerance = 10.0;
+  int it_on_approach = 10;
+  int terminal_checking_interval = 5000;
+  double max_planning_time = 120.0;
+  int num_it = 0;
+
+  a_star.initialize(
+    false, max_iterations, it_on_approach, terminal_checking_interval,
+    max_planning_time, 401, size_theta);
+
+  auto costmap_ros = std::make_shared<nav2_costmap_2d::Costmap2DROS>();
+  costmap_ros->on_configure(rclcpp_lifecycle::State());
+  auto costmap = costmap_ros->getCostmap();
+  *costmap = nav2_costmap_2d::Costmap2D(100, 100, 0.1, 0.0, 0.0, 0);
+
+  std::unique_ptr<nav2_smac_planner::GridCollisionChecker> checker =
+    std::make_unique<nav2_smac_planner::GridCollisionChecker>(costmap_ros, size_theta, lnode);
+  checker->setFootprint(nav2_costmap_2d::Footprint(), true, 0.0);
+
+  nav2_smac_planner::ExpansionTelemetry telemetry;
+  telemetry.reset(costmap->getSizeInCellsX(), costmap->getSizeInCellsY());
+  EXPECT_EQ(telemetry.tiles_x, 4u);
+  EXPECT_EQ(telemetry.tiles_y, 4u);
+  EXPECT_EQ(telemetry.tile_expansions.size(), 16u);
+
+  a_star.setCollisionChecker(checker.get());
+  a_star.setExpansionTelemetry(&telemetry);
+  a_star.setStart(10u, 10u, 0u);
+  a_star.setGoal(80u, 80u, 40u);
+  nav2_smac_planner::NodeHybrid::CoordinateVector path;
+
+  auto dummy_cancel_checker = []() {
+      return false;
+    };
+
+  EXPECT_TRUE(a_star.createPath(path, num_it, tolerance, dummy_cancel_checker));
+
+  // every expansion is recorded, in total, per tile, and in the histogram
+  EXPECT_EQ(telemetry.expansions, static_cast<uint32_t>(num_it));
+  uint32_t tile_total = 0;
+  for (const auto & count : telemetry.tile_expansions) {
+    tile_total += count;
+  }
+  EXPECT_EQ(tile_total, telemetry.expansions);
+  uint32_t histogram_total = 0;
+  for (const auto & count : telemetry.heuristic_share_histogram) {
+    histogram_total += count;
+  }
+  // the start node pops with a zero key and is excluded from the histogram
+  EXPECT_EQ(histogram_total, telemetry.expansions - 1);
+  // an open map offers plenty of analytic shots, one of which succeeds
+  EXPECT_GT(telemetry.analytic_attempts, 0u);
+  EXPECT_GT(telemetry.analytic_successes, 0u);
+
+  // resetting zeroes the buffer without changing its shape
+  telemetry.reset(costmap->getSizeInCellsX(), costmap->getSizeInCellsY());
+  EXPECT_EQ(telemetry.expansions, 0u);
+  EXPECT_EQ(telemetry.tile_expansions.size(), 16u);
+}
+
 TEST(AStarTest, test_a_star_analytic_expansion)
 {
   auto lnode = std::make_shared<rclcpp_lifecycle::LifecycleNode>("test");
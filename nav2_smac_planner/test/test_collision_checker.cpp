@@ -213,3 +213,67 @@ TEST(collision_footprint, test_point_and_line_cost)
   EXPECT_NEAR(right_value, 254.0, 0.001);
   delete costmap_;
 }
+
+TEST(collision_footprint, test_swept_footprint)
+{
+  auto node = std::make_shared<rclcpp_lifecycle::LifecycleNode>("testF");
+  nav2_costmap_2d::Costmap2D * costmap_ = new nav2_costmap_2d::Costmap2D(100, 100, 0.1, 0, 0, 0);
+
+  geometry_msgs::msg::Point p1;
+  p1.x = -0.3;
+  p1.y = 0.2;
+  geometry_msgs::msg::Point p2;
+  p2.x = 0.3;
+  p2.y = 0.2;
+  geometry_msgs::msg::Point p3;
+  p3.x = 0.3;
+  p3.y = -0.2;
+  geometry_msgs::msg::Point p4;
+  p4.x = -0.3;
+  p4.y = -0.2;
+
+  nav2_costmap_2d::Footprint footprint = {p1, p2, p3, p4};
+
+  // Convert raw costmap into a costmap ros object
+  auto costmap_ros = std::make_shared<nav2_costmap_2d::Costmap2DROS>();
+  costmap_ros->on_configure(rclcpp_lifecycle::State());
+  auto costmap = costmap_ros->getCostmap();
+  *costmap = *costmap_;
+
+  nav2_smac_planner::GridCollisionChecker collision_checker(costmap_ros, 72, node);
+  collision_checker.setFootprint(footprint, false /*use footprint*/, 0.0);
+
+  // A straight primitive sampled every 2 cells, in cell offsets from its start
+  nav2_smac_planner::MotionPoses samples;
+  for (unsigned int i = 0; i != 5; i++) {
+    samples.emplace_back(
+      2.0f * static_cast<float>(i), 0.0f, 0.0f, nav2_smac_planner::TurnDirection::UNKNOWN);
+  }
+
+  unsigned int handle = collision_checker.registerSweptFootprint(samples);
+
+  // Batched result must agree with checking each sampled pose individually
+  EXPECT_FALSE(collision_checker.inCollisionSwept(30.0, 50.0, handle, false));
+  for (const auto & sample : samples) {
+    EXPECT_FALSE(collision_checker.inCollision(30.0f + sample._x, 50.0f, 0.0, false));
+  }
+
+  // A lethal cell along the swept path collides both ways
+  costmap->setCost(34, 50, 254);
+  EXPECT_TRUE(collision_checker.inCollisionSwept(30.0, 50.0, handle, false));
+  bool any_pose_collides = false;
+  for (const auto & sample : samples) {
+    any_pose_collides = any_pose_collides ||
+      collision_checker.inCollision(30.0f + sample._x, 50.0f, 0.0, false);
+  }
+  EXPECT_TRUE(any_pose_collides);
+
+  // Clear of the swept path, neither collides
+  EXPECT_FALSE(collision_checker.inCollisionSwept(30.0, 60.0, handle, false));
+
+  // Changing the footprint invalidates registered handles
+  unsigned int generation = collision_checker.getFootprintGeneration();
+  collision_checker.setFootprint(footprint, true /*radius*/, 0.0);
+  EXPECT_NE(collision_checker.getFootprintGeneration(), generation);
+  delete costmap_;
+}
@@ -65,3 +65,34 @@ TEST(CostmapDownsampler, costmap_downsample_test)
 
   downsampler.resizeCostmap();
 }
+
+TEST(CostmapDownsampler, costmap_downsample_incremental_test)
+{
+  nav2_util::LifecycleNode::SharedPtr node = std::make_shared<nav2_util::LifecycleNode>(
+    "CostmapDownsamplerIncrementalTest");
+  nav2_smac_planner::CostmapDownsampler downsampler;
+
+  // create basic costmap
+  nav2_costmap_2d::Costmap2D costmap(10, 10, 0.05, 0.0, 0.0, 0);
+  costmap.setCost(2, 2, 100);
+
+  downsampler.on_configure(node, "map", "unused_topic", &costmap, 2);
+  nav2_costmap_2d::Costmap2D * downsampledCostmap = downsampler.downsample(2);
+  EXPECT_EQ(downsampledCostmap->getCost(1, 1), 100);
+
+  // a changed cell is reflected by the next downsampling
+  costmap.setCost(7, 7, 200);
+  downsampler.downsample(2);
+  EXPECT_EQ(downsampledCostmap->getCost(3, 3), 200);
+  EXPECT_EQ(downsampledCostmap->getCost(1, 1), 100);
+
+  // so is a lowered cost in a previously downsampled cell
+  costmap.setCost(2, 2, 50);
+  downsampler.downsample(2);
+  EXPECT_EQ(downsampledCostmap->getCost(1, 1), 50);
+
+  // an unchanged costmap downsamples to the same result
+  downsampler.downsample(2);
+  EXPECT_EQ(downsampledCostmap->getCost(1, 1), 50);
+  EXPECT_EQ(downsampledCostmap->getCost(3, 3), 200);
+}
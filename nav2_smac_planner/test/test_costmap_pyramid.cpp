@@ -0,0 +1,109 @@
+// Copyright (c) 2026, Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License. Reserved.
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "rclcpp/rclcpp.hpp"
+#include "nav2_costmap_2d/costmap_2d.hpp"
+#include "nav2_util/lifecycle_node.hpp"
+#include "nav2_smac_planner/costmap_pyramid.hpp"
+
+class RclCppFixture
+{
+public:
+  RclCppFixture() {rclcpp::init(0, nullptr);}
+  ~RclCppFixture() {rclcpp::shutdown();}
+};
+RclCppFixture g_rclcppfixture;
+
+TEST(CostmapPyramid, shared_levels_test)
+{
+  nav2_costmap_2d::Costmap2D costmap(10, 10, 0.05, 0.0, 0.0, 0);
+  costmap.setCost(0, 0, 100);
+
+  // planners of the same costmap share one pyramid instance
+  std::shared_ptr<nav2_smac_planner::CostmapPyramid> pyramid =
+    nav2_smac_planner::CostmapPyramid::getOrCreate(&costmap);
+  std::shared_ptr<nav2_smac_planner::CostmapPyramid> pyramid2 =
+    nav2_smac_planner::CostmapPyramid::getOrCreate(&costmap);
+  EXPECT_EQ(pyramid.get(), pyramid2.get());
+
+  // a different costmap gets a different pyramid
+  nav2_costmap_2d::Costmap2D other(10, 10, 0.05, 0.0, 0.0, 0);
+  EXPECT_NE(pyramid.get(), nav2_smac_planner::CostmapPyramid::getOrCreate(&other).get());
+
+  // levels are downsampled by their factor and stable across requests
+  nav2_costmap_2d::Costmap2D * level = pyramid->getLevel(2);
+  EXPECT_EQ(level->getSizeInCellsX(), 5u);
+  EXPECT_EQ(level->getSizeInCellsY(), 5u);
+  EXPECT_EQ(level->getCost(0, 0), 100);
+  EXPECT_EQ(pyramid->getLevel(2), level);
+
+  // level refreshes pick up costmap changes
+  costmap.setCost(9, 9, 254);
+  level = pyramid->getLevel(2);
+  EXPECT_EQ(level->getCost(4, 4), 254);
+
+  // publisher-backed level and lifecycle transitions
+  nav2_util::LifecycleNode::SharedPtr node = std::make_shared<nav2_util::LifecycleNode>(
+    "CostmapPyramidTest");
+  pyramid->addLevelPublisher(node, "map", "unused_topic", 5);
+  pyramid->on_activate();
+  EXPECT_EQ(pyramid->getLevel(5)->getSizeInCellsX(), 2u);
+  pyramid->on_deactivate();
+}
+
+TEST(CostmapPyramid, find_corridor_test)
+{
+  // 40x40 map with a wall at x=20..21 and a gap at y=28..31, so the
+  // factor-4 level has one traversable cell through the wall
+  nav2_costmap_2d::Costmap2D costmap(40, 40, 0.05, 0.0, 0.0, 0);
+  for (unsigned int y = 0; y < 40; ++y) {
+    if (y < 28 || y > 31) {
+      costmap.setCost(20, y, 254);
+      costmap.setCost(21, y, 254);
+    }
+  }
+
+  std::shared_ptr<nav2_smac_planner::CostmapPyramid> pyramid =
+    nav2_smac_planner::CostmapPyramid::getOrCreate(&costmap);
+
+  std::vector<uint8_t> mask;
+  EXPECT_TRUE(pyramid->findCorridor(4, 2, 2, 38, 2, 2, mask));
+  EXPECT_EQ(mask.size(), 1600u);
+
+  // start, goal and the gap through the wall are inside the corridor
+  EXPECT_EQ(mask[2 * 40 + 2], 1);
+  EXPECT_EQ(mask[2 * 40 + 38], 1);
+  EXPECT_EQ(mask[29 * 40 + 20], 1);
+
+  // blocked parts of the wall far from the gap stay outside
+  EXPECT_EQ(mask[2 * 40 + 20], 0);
+
+  // the corridor actually prunes the map
+  size_t marked = 0;
+  for (const uint8_t & cell : mask) {
+    marked += cell;
+  }
+  EXPECT_LT(marked, mask.size());
+
+  // sealing the gap leaves no corridor to find
+  for (unsigned int y = 28; y <= 31; ++y) {
+    costmap.setCost(20, y, 254);
+    costmap.setCost(21, y, 254);
+  }
+  EXPECT_FALSE(pyramid->findCorridor(4, 2, 2, 38, 2, 2, mask));
+}
@@ -0,0 +1,71 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "nav2_smac_planner/node_graph.hpp"
+
+using nav2_smac_planner::NodeGraph;
+
+// Minimal node type mirroring the NodeT(index) construction the graph uses
+struct TestNode
+{
+  explicit TestNode(const uint64_t & index)
+  : index_(index) {}
+  uint64_t index_;
+};
+
+TEST(NodeGraphTest, test_create_find_and_clear)
+{
+  NodeGraph<TestNode> graph;
+  EXPECT_TRUE(graph.empty());
+  EXPECT_EQ(graph.find(42u), nullptr);
+
+  TestNode * node = graph.getOrCreate(42u);
+  ASSERT_NE(node, nullptr);
+  EXPECT_EQ(node->index_, 42u);
+  EXPECT_EQ(graph.getOrCreate(42u), node);
+  EXPECT_EQ(graph.find(42u), node);
+  EXPECT_EQ(&graph.at(42u), node);
+  EXPECT_EQ(graph.size(), 1u);
+
+  EXPECT_THROW(graph.at(43u), std::out_of_range);
+
+  graph.clear();
+  EXPECT_TRUE(graph.empty());
+  EXPECT_EQ(graph.find(42u), nullptr);
+}
+
+TEST(NodeGraphTest, test_pointers_stable_across_growth)
+{
+  NodeGraph<TestNode> graph;
+  graph.reserve(100);
+
+  // force the index through several growth steps and into a second arena
+  // block, then check earlier node pointers still resolve unchanged
+  std::vector<TestNode *> nodes;
+  const uint64_t num_nodes = 250000;
+  for (uint64_t i = 0; i < num_nodes; ++i) {
+    nodes.push_back(graph.getOrCreate(i * 7919u));
+  }
+  EXPECT_EQ(graph.size(), num_nodes);
+
+  for (uint64_t i = 0; i < num_nodes; ++i) {
+    EXPECT_EQ(graph.find(i * 7919u), nodes[i]);
+    EXPECT_EQ(nodes[i]->index_, i * 7919u);
+  }
+}
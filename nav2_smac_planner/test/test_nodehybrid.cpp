@@ -14,6 +14,7 @@
 
 #include <math.h>
 #include <cmath>
+#include <cstdio>
 #include <memory>
 #include <string>
 #include <vector>
@@ -239,6 +240,111 @@ TEST(NodeHybridTest, test_obstacle_heuristic)
   nav2_smac_planner::NodeHybrid::destroyStaticAssets();
 }
 
+TEST(NodeHybridTest, test_incremental_obstacle_heuristic)
+{
+  auto node = std::make_shared<rclcpp_lifecycle::LifecycleNode>("test");
+  nav2_smac_planner::SearchInfo info;
+  info.change_penalty = 0.1;
+  info.non_straight_penalty = 1.1;
+  info.reverse_penalty = 2.0;
+  info.minimum_turning_radius = 8;
+  info.cost_penalty = 1.7;
+  info.retrospective_penalty = 0.0;
+  info.incremental_obstacle_heuristic = true;
+  unsigned int size_x = 100;
+  unsigned int size_y = 100;
+  unsigned int size_theta = 72;
+
+  nav2_smac_planner::NodeHybrid::initMotionModel(
+    nav2_smac_planner::MotionModel::DUBIN, size_x, size_y, size_theta, info);
+
+  auto costmap_ros = std::make_shared<nav2_costmap_2d::Costmap2DROS>();
+  costmap_ros->on_configure(rclcpp_lifecycle::State());
+  auto costmap = costmap_ros->getCostmap();
+  *costmap = nav2_costmap_2d::Costmap2D(100, 100, 0.1, 0.0, 0.0, 0);
+  // wall with a single gap
+  for (unsigned int i = 20; i <= 80; ++i) {
+    for (unsigned int j = 40; j <= 60; ++j) {
+      if (i < 48 || i > 52) {
+        costmap->setCost(i, j, 254);
+      }
+    }
+  }
+
+  nav2_smac_planner::NodeHybrid testA(0);
+  testA.pose.x = 50;
+  testA.pose.y = 10;
+  testA.pose.theta = 0;
+
+  nav2_smac_planner::NodeHybrid testB(1);
+  testB.pose.x = 50;
+  testB.pose.y = 90;
+  testB.pose.theta = 0;
+
+  nav2_smac_planner::NodeHybrid::resetObstacleHeuristic(
+    costmap_ros, testA.pose.x, testA.pose.y, testB.pose.x, testB.pose.y);
+  float gap_cost = nav2_smac_planner::NodeHybrid::getObstacleHeuristic(
+    testA.pose, testB.pose, info.cost_penalty);
+  EXPECT_GT(gap_cost, 0.0f);
+
+  // an unchanged costmap must repair to the identical expansion
+  nav2_smac_planner::NodeHybrid::resetObstacleHeuristic(
+    costmap_ros, testA.pose.x, testA.pose.y, testB.pose.x, testB.pose.y);
+  EXPECT_EQ(
+    nav2_smac_planner::NodeHybrid::getObstacleHeuristic(
+      testA.pose, testB.pose, info.cost_penalty),
+    gap_cost);
+
+  // close the gap, forcing the heuristic around the wall
+  for (unsigned int i = 48; i <= 52; ++i) {
+    for (unsigned int j = 40; j <= 60; ++j) {
+      costmap->setCost(i, j, 254);
+    }
+  }
+  nav2_smac_planner::NodeHybrid::resetObstacleHeuristic(
+    costmap_ros, testA.pose.x, testA.pose.y, testB.pose.x, testB.pose.y);
+  float repaired_cost = nav2_smac_planner::NodeHybrid::getObstacleHeuristic(
+    testA.pose, testB.pose, info.cost_penalty);
+  EXPECT_GT(repaired_cost, gap_cost);
+
+  // reopen the gap: the lowered costs force a fallback to a full reset,
+  // which must restore the original heuristic
+  for (unsigned int i = 48; i <= 52; ++i) {
+    for (unsigned int j = 40; j <= 60; ++j) {
+      costmap->setCost(i, j, 0);
+    }
+  }
+  nav2_smac_planner::NodeHybrid::resetObstacleHeuristic(
+    costmap_ros, testA.pose.x, testA.pose.y, testB.pose.x, testB.pose.y);
+  EXPECT_NEAR(
+    nav2_smac_planner::NodeHybrid::getObstacleHeuristic(
+      testA.pose, testB.pose, info.cost_penalty),
+    gap_cost, 0.01f);
+
+  // close it again and compare the repaired expansion to a full recomputation
+  for (unsigned int i = 48; i <= 52; ++i) {
+    for (unsigned int j = 40; j <= 60; ++j) {
+      costmap->setCost(i, j, 254);
+    }
+  }
+  nav2_smac_planner::NodeHybrid::resetObstacleHeuristic(
+    costmap_ros, testA.pose.x, testA.pose.y, testB.pose.x, testB.pose.y);
+  repaired_cost = nav2_smac_planner::NodeHybrid::getObstacleHeuristic(
+    testA.pose, testB.pose, info.cost_penalty);
+
+  // the repaired expansion must match a full recomputation
+  info.incremental_obstacle_heuristic = false;
+  nav2_smac_planner::NodeHybrid::initMotionModel(
+    nav2_smac_planner::MotionModel::DUBIN, size_x, size_y, size_theta, info);
+  nav2_smac_planner::NodeHybrid::resetObstacleHeuristic(
+    costmap_ros, testA.pose.x, testA.pose.y, testB.pose.x, testB.pose.y);
+  float full_cost = nav2_smac_planner::NodeHybrid::getObstacleHeuristic(
+    testA.pose, testB.pose, info.cost_penalty);
+  EXPECT_NEAR(repaired_cost, full_cost, 0.01f);
+
+  nav2_smac_planner::NodeHybrid::destroyStaticAssets();
+}
+
 TEST(NodeHybridTest, test_node_debin_neighbors)
 {
   nav2_smac_planner::SearchInfo info;
@@ -420,3 +526,49 @@ TEST(NodeHybridTest, basic_get_closest_angular_bin_test)
     EXPECT_EQ(expected_angular_bin, calculated_angular_bin);
   }
 }
+
+TEST(NodeHybridTest, test_distance_heuristic_cache)
+{
+  nav2_smac_planner::SearchInfo info;
+  info.minimum_turning_radius = 8;
+  unsigned int size_x = 10;
+  unsigned int size_y = 10;
+  unsigned int size_theta = 72;
+
+  nav2_smac_planner::NodeHybrid::initMotionModel(
+    nav2_smac_planner::MotionModel::DUBIN, size_x, size_y, size_theta, info);
+
+  // Compute a fresh table without a cache file set
+  nav2_smac_planner::NodeHybrid::precomputeDistanceHeuristic(
+    11.0, nav2_smac_planner::MotionModel::DUBIN, size_theta, info);
+
+  nav2_smac_planner::NodeHybrid::Coordinates node_coords(6.0, 7.0, 9.0);
+  nav2_smac_planner::NodeHybrid::Coordinates goal_coords(4.0, 5.0, 0.0);
+  float fresh_heuristic =
+    nav2_smac_planner::NodeHybrid::getDistanceHeuristic(node_coords, goal_coords, 1.0);
+  EXPECT_GT(fresh_heuristic, 0.0f);
+
+  // With a cache path set, the first computation persists the table and the
+  // next precompute maps the file instead, yielding the same lookups
+  const std::string cache_path = "/tmp/test_dist_heuristic_cache.bin";
+  std::remove(cache_path.c_str());
+  info.lookup_table_cache_path = cache_path;
+  nav2_smac_planner::NodeHybrid::precomputeDistanceHeuristic(
+    11.0, nav2_smac_planner::MotionModel::DUBIN, size_theta, info);
+  nav2_smac_planner::NodeHybrid::precomputeDistanceHeuristic(
+    11.0, nav2_smac_planner::MotionModel::DUBIN, size_theta, info);
+  float mapped_heuristic =
+    nav2_smac_planner::NodeHybrid::getDistanceHeuristic(node_coords, goal_coords, 1.0);
+  EXPECT_NEAR(fresh_heuristic, mapped_heuristic, 0.001f);
+
+  // A cache generated with different settings is rejected and recomputed
+  info.minimum_turning_radius = 12;
+  nav2_smac_planner::NodeHybrid::precomputeDistanceHeuristic(
+    11.0, nav2_smac_planner::MotionModel::DUBIN, size_theta, info);
+  float larger_radius_heuristic =
+    nav2_smac_planner::NodeHybrid::getDistanceHeuristic(node_coords, goal_coords, 1.0);
+  EXPECT_GE(larger_radius_heuristic, mapped_heuristic);
+
+  std::remove(cache_path.c_str());
+  nav2_smac_planner::NodeHybrid::destroyStaticAssets();
+}
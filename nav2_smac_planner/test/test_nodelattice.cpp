@@ -13,12 +13,14 @@
 // See the License for the specific language governing permissions and
 // limitations under the License. Reserved.
 
+#include <cstdio>
 #include <fstream>
 #include <string>
 #include <vector>
 #include <memory>
 #include <unordered_map>
 #include <limits>
+#include "nav2_smac_planner/lattice_binary_io.hpp"
 #include "nav2_smac_planner/node_lattice.hpp"
 #include "gtest/gtest.h"
 #include "ament_index_cpp/get_package_share_directory.hpp"
@@ -92,6 +94,72 @@ TEST(NodeLatticeTest, parser_test)
   EXPECT_NEAR(myPrimitives[0].poses[1]._theta, 6.09345, 0.015);
 }
 
+TEST(NodeLatticeTest, binary_lattice_roundtrip_test)
+{
+  std::string pkg_share_dir = ament_index_cpp::get_package_share_directory("nav2_smac_planner");
+  std::string filePath =
+    pkg_share_dir +
+    "/sample_primitives/5cm_resolution/0.5m_turning_radius/ackermann" +
+    "/output.json";
+  std::ifstream myJsonFile(filePath);
+
+  ASSERT_TRUE(myJsonFile.is_open());
+  EXPECT_FALSE(nav2_smac_planner::isBinaryLatticeFile(filePath));
+
+  json j;
+  myJsonFile >> j;
+
+  nav2_smac_planner::LatticeMetadata metaData;
+  nav2_smac_planner::fromJsonToMetaData(j["lattice_metadata"], metaData);
+
+  json jsonPrimatives = j["primitives"];
+  nav2_smac_planner::MotionPrimitives myPrimitives;
+  for (unsigned int i = 0; i < jsonPrimatives.size(); ++i) {
+    nav2_smac_planner::MotionPrimitive newPrimative;
+    nav2_smac_planner::fromJsonToMotionPrimitive(jsonPrimatives[i], newPrimative);
+    myPrimitives.push_back(newPrimative);
+  }
+
+  // Compile the JSON lattice into the binary format, as the converter does
+  std::string binaryFilePath = "/tmp/test_lattice_roundtrip.bin";
+  nav2_smac_planner::writeBinaryLattice(binaryFilePath, metaData, myPrimitives);
+  EXPECT_TRUE(nav2_smac_planner::isBinaryLatticeFile(binaryFilePath));
+
+  // Metadata read back matches the JSON parse
+  nav2_smac_planner::LatticeMetadata binaryMetaData =
+    nav2_smac_planner::LatticeMotionTable::getLatticeMetadata(binaryFilePath);
+  EXPECT_EQ(binaryMetaData.min_turning_radius, metaData.min_turning_radius);
+  EXPECT_EQ(binaryMetaData.grid_resolution, metaData.grid_resolution);
+  EXPECT_EQ(binaryMetaData.number_of_headings, metaData.number_of_headings);
+  EXPECT_EQ(binaryMetaData.number_of_trajectories, metaData.number_of_trajectories);
+  EXPECT_EQ(binaryMetaData.motion_model, metaData.motion_model);
+  ASSERT_EQ(binaryMetaData.heading_angles.size(), metaData.heading_angles.size());
+  EXPECT_EQ(binaryMetaData.heading_angles[3], metaData.heading_angles[3]);
+
+  // Primitives read back match the JSON parse exactly
+  nav2_smac_planner::MotionPrimitives binaryPrimitives;
+  nav2_smac_planner::readBinaryLattice(binaryFilePath, binaryMetaData, binaryPrimitives);
+  ASSERT_EQ(binaryPrimitives.size(), myPrimitives.size());
+  for (unsigned int i = 0; i < myPrimitives.size(); ++i) {
+    EXPECT_EQ(binaryPrimitives[i].trajectory_id, myPrimitives[i].trajectory_id);
+    EXPECT_EQ(binaryPrimitives[i].start_angle, myPrimitives[i].start_angle);
+    EXPECT_EQ(binaryPrimitives[i].end_angle, myPrimitives[i].end_angle);
+    EXPECT_EQ(binaryPrimitives[i].turning_radius, myPrimitives[i].turning_radius);
+    EXPECT_EQ(binaryPrimitives[i].trajectory_length, myPrimitives[i].trajectory_length);
+    EXPECT_EQ(binaryPrimitives[i].arc_length, myPrimitives[i].arc_length);
+    EXPECT_EQ(binaryPrimitives[i].straight_length, myPrimitives[i].straight_length);
+    EXPECT_EQ(binaryPrimitives[i].left_turn, myPrimitives[i].left_turn);
+    ASSERT_EQ(binaryPrimitives[i].poses.size(), myPrimitives[i].poses.size());
+    for (unsigned int p = 0; p < myPrimitives[i].poses.size(); ++p) {
+      EXPECT_EQ(binaryPrimitives[i].poses[p]._x, myPrimitives[i].poses[p]._x);
+      EXPECT_EQ(binaryPrimitives[i].poses[p]._y, myPrimitives[i].poses[p]._y);
+      EXPECT_EQ(binaryPrimitives[i].poses[p]._theta, myPrimitives[i].poses[p]._theta);
+    }
+  }
+
+  std::remove(binaryFilePath.c_str());
+}
+
 TEST(NodeLatticeTest, test_node_lattice_neighbors_and_parsing)
 {
   std::string pkg_share_dir = ament_index_cpp::get_package_share_directory("nav2_smac_planner");
@@ -122,10 +190,9 @@ TEST(NodeLatticeTest, test_node_lattice_neighbors_and_parsing)
   nav2_smac_planner::NodeLattice aNode(0);
   unsigned int direction_change_index = 0;
   aNode.setPose(nav2_smac_planner::NodeHybrid::Coordinates(0, 0, 0));
-  nav2_smac_planner::MotionPrimitivePtrs projections =
-    nav2_smac_planner::NodeLattice::motion_table.getMotionPrimitives(
-    &aNode,
-    direction_change_index);
+  nav2_smac_planner::MotionPrimitivePtrs projections;
+  nav2_smac_planner::NodeLattice::motion_table.getMotionPrimitives(
+    &aNode, direction_change_index, projections);
 
   EXPECT_NEAR(projections[0]->poses.back()._x, 0.5, 0.01);
   EXPECT_NEAR(projections[0]->poses.back()._y, -0.35, 0.01);
@@ -387,8 +454,9 @@ TEST(NodeLatticeTest, test_node_lattice_custom_footprint)
   // initialize direction change index
   unsigned int direction_change_index = 0;
   // Test that the node is valid though all motion primitives poses for custom footprint
-  nav2_smac_planner::MotionPrimitivePtrs motion_primitives =
-    nav2_smac_planner::NodeLattice::motion_table.getMotionPrimitives(&node, direction_change_index);
+  nav2_smac_planner::MotionPrimitivePtrs motion_primitives;
+  nav2_smac_planner::NodeLattice::motion_table.getMotionPrimitives(
+    &node, direction_change_index, motion_primitives);
   EXPECT_GT(motion_primitives.size(), 0u);
   for (unsigned int i = 0; i < motion_primitives.size(); i++) {
     EXPECT_EQ(node.isNodeValid(true, checker.get(), motion_primitives[i], false), true);
@@ -0,0 +1,253 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <random>
+
+#include "nav_msgs/msg/path.hpp"
+#include "nav2_costmap_2d/costmap_subscriber.hpp"
+#include "nav2_msgs/msg/costmap.hpp"
+#include "nav2_smoother/savitzky_golay_smoother.hpp"
+#include "nav2_smoother/simple_smoother.hpp"
+#include "nav2_util/lifecycle_node.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "tf2_ros/buffer.h"
+
+#ifdef HAVE_CONSTRAINED_SMOOTHER
+#include "nav2_constrained_smoother/constrained_smoother.hpp"
+#endif
+
+// Heap allocations are part of the smoothing cost we want to compare, so the
+// benchmark binary replaces global operator new with a counting shim. Only
+// the count is recorded; allocation itself still goes through malloc.
+static std::atomic<uint64_t> g_allocation_count{0};
+
+void * operator new(std::size_t size)
+{
+  g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void * p = std::malloc(size)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void * operator new[](std::size_t size)
+{
+  g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void * p = std::malloc(size)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void * p) noexcept {std::free(p);}
+void operator delete[](void * p) noexcept {std::free(p);}
+void operator delete(void * p, std::size_t) noexcept {std::free(p);}
+void operator delete[](void * p, std::size_t) noexcept {std::free(p);}
+
+class RosLockGuard
+{
+public:
+  RosLockGuard() {rclcpp::init(0, nullptr);}
+  ~RosLockGuard() {rclcpp::shutdown();}
+};
+
+RosLockGuard g_rclcpp;
+
+namespace
+{
+
+// Node, costmap and subscribers shared by every smoother under test,
+// mirroring the setup the smoother plugin tests use
+struct SmootherHarness
+{
+  rclcpp_lifecycle::LifecycleNode::SharedPtr node;
+  std::shared_ptr<tf2_ros::Buffer> tf;
+  std::shared_ptr<nav2_costmap_2d::CostmapSubscriber> costmap_sub;
+  std::shared_ptr<nav2_costmap_2d::FootprintSubscriber> footprint_sub;
+};
+
+SmootherHarness makeHarness()
+{
+  SmootherHarness harness;
+  harness.node =
+    std::make_shared<rclcpp_lifecycle::LifecycleNode>("smoother_benchmark");
+  harness.tf = std::make_shared<tf2_ros::Buffer>(harness.node->get_clock());
+
+  // 5 m x 5 m free grid with a lethal island in a corner the paths avoid,
+  // injected straight into the subscriber as the plugin tests do
+  auto costmap_msg = std::make_shared<nav2_msgs::msg::Costmap>();
+  costmap_msg->header.stamp = harness.node->now();
+  costmap_msg->header.frame_id = "map";
+  costmap_msg->data.resize(100 * 100);
+  costmap_msg->metadata.resolution = 0.05;
+  costmap_msg->metadata.size_x = 100;
+  costmap_msg->metadata.size_y = 100;
+  for (unsigned int i = 70; i <= 80; ++i) {
+    for (unsigned int j = 10; j <= 20; ++j) {
+      costmap_msg->data[j * 100 + i] = 254;
+    }
+  }
+
+  std::weak_ptr<rclcpp_lifecycle::LifecycleNode> parent = harness.node;
+  harness.costmap_sub =
+    std::make_shared<nav2_costmap_2d::CostmapSubscriber>(parent, "dummy_topic");
+  harness.costmap_sub->costmapCallback(costmap_msg);
+  return harness;
+}
+
+// Stand-in for a recorded plan: a sinusoid across the free space with
+// per-pose sensor-grade jitter, the kind of raggedness smoothers exist to fix
+nav_msgs::msg::Path makeRecordedPath(const size_t num_poses)
+{
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> jitter(-0.03, 0.03);
+
+  nav_msgs::msg::Path path;
+  path.header.frame_id = "map";
+  path.poses.resize(num_poses);
+  for (size_t i = 0; i < num_poses; ++i) {
+    const double t = static_cast<double>(i) / static_cast<double>(num_poses - 1);
+    auto & pose = path.poses[i].pose;
+    pose.position.x = 0.5 + 4.0 * t;
+    pose.position.y = 2.5 + 0.4 * sin(4.0 * M_PI * t) + jitter(gen);
+  }
+
+  // Headings along the path, required by the constrained smoother
+  for (size_t i = 0; i < num_poses; ++i) {
+    const auto & from = path.poses[i > 0 ? i - 1 : 0].pose.position;
+    const auto & to = path.poses[i + 1 < num_poses ? i + 1 : i].pose.position;
+    const double yaw = atan2(to.y - from.y, to.x - from.x);
+    path.poses[i].pose.orientation.z = sin(yaw / 2.0);
+    path.poses[i].pose.orientation.w = cos(yaw / 2.0);
+  }
+  return path;
+}
+
+double pathLength(const nav_msgs::msg::Path & path)
+{
+  double length = 0.0;
+  for (size_t i = 1; i < path.poses.size(); ++i) {
+    length += std::hypot(
+      path.poses[i].pose.position.x - path.poses[i - 1].pose.position.x,
+      path.poses[i].pose.position.y - path.poses[i - 1].pose.position.y);
+  }
+  return length;
+}
+
+// Mean squared discrete second derivative, lower is smoother
+double pathRoughness(const nav_msgs::msg::Path & path)
+{
+  double sum = 0.0;
+  for (size_t i = 1; i + 1 < path.poses.size(); ++i) {
+    const auto & prev = path.poses[i - 1].pose.position;
+    const auto & curr = path.poses[i].pose.position;
+    const auto & next = path.poses[i + 1].pose.position;
+    const double ddx = next.x - 2.0 * curr.x + prev.x;
+    const double ddy = next.y - 2.0 * curr.y + prev.y;
+    sum += ddx * ddx + ddy * ddy;
+  }
+  return sum / static_cast<double>(path.poses.size());
+}
+
+// Shared measurement loop: per-iteration latency from the benchmark clock,
+// allocations from the counting operator new, quality from the last output
+void benchmarkSmoother(benchmark::State & state, nav2_core::Smoother & smoother)
+{
+  const nav_msgs::msg::Path base_path =
+    makeRecordedPath(static_cast<size_t>(state.range(0)));
+  const rclcpp::Duration max_time = rclcpp::Duration::from_seconds(120.0);
+
+  nav_msgs::msg::Path path;
+  const uint64_t allocations_before =
+    g_allocation_count.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    path = base_path;
+    smoother.smooth(path, max_time);
+    benchmark::DoNotOptimize(path);
+  }
+  const uint64_t allocations =
+    g_allocation_count.load(std::memory_order_relaxed) - allocations_before;
+
+  state.counters["allocs"] = static_cast<double>(allocations) /
+    static_cast<double>(state.iterations());
+  state.counters["length_m"] = pathLength(path);
+  state.counters["roughness_in"] = pathRoughness(base_path);
+  state.counters["roughness_out"] = pathRoughness(path);
+}
+
+void BM_simpleSmoother(benchmark::State & state)
+{
+  SmootherHarness harness = makeHarness();
+  auto smoother = std::make_shared<nav2_smoother::SimpleSmoother>();
+  smoother->configure(
+    harness.node, "simple", harness.tf, harness.costmap_sub, harness.footprint_sub);
+  smoother->activate();
+
+  benchmarkSmoother(state, *smoother);
+
+  smoother->deactivate();
+  smoother->cleanup();
+}
+
+void BM_savitzkyGolaySmoother(benchmark::State & state)
+{
+  SmootherHarness harness = makeHarness();
+  auto smoother = std::make_shared<nav2_smoother::SavitzkyGolaySmoother>();
+  smoother->configure(
+    harness.node, "savitzky_golay", harness.tf, harness.costmap_sub,
+    harness.footprint_sub);
+  smoother->activate();
+
+  benchmarkSmoother(state, *smoother);
+
+  smoother->deactivate();
+  smoother->cleanup();
+}
+
+BENCHMARK(BM_simpleSmoother)
+->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_savitzkyGolaySmoother)
+->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+#ifdef HAVE_CONSTRAINED_SMOOTHER
+void BM_constrainedSmoother(benchmark::State & state)
+{
+  SmootherHarness harness = makeHarness();
+  auto smoother = std::make_shared<nav2_constrained_smoother::ConstrainedSmoother>();
+  smoother->configure(
+    harness.node, "constrained", harness.tf, harness.costmap_sub,
+    harness.footprint_sub);
+  smoother->activate();
+
+  benchmarkSmoother(state, *smoother);
+
+  smoother->deactivate();
+  smoother->cleanup();
+}
+
+BENCHMARK(BM_constrainedSmoother)
+->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace
+
+BENCHMARK_MAIN();
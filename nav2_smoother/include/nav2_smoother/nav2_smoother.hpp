@@ -136,6 +136,22 @@ protected:
    */
   bool findSmootherId(const std::string & c_name, std::string & name);
 
+  /**
+   * @brief Smooth the path in fixed-size overlapping chunks, yielding
+   * between chunks for cancel checks and publishing the partially smoothed
+   * path as the chunks complete. Used instead of a single smooth() call
+   * when chunk_size is set and the path is longer than one chunk, so that
+   * long smoothing runs stay preemptible.
+   * @param path Path to smooth in place
+   * @param max_duration Maximum smoothing duration over all chunks
+   * @param cancelled Set to true if the goal was canceled between chunks
+   * @return bool Whether all chunks completed smoothing in time
+   */
+  bool smoothChunked(
+    nav_msgs::msg::Path & path,
+    const rclcpp::Duration & max_duration,
+    bool & cancelled);
+
   /**
    * @brief Validate that the path contains a meaningful path for smoothing
    * @param path current path
@@ -162,6 +178,11 @@ protected:
   std::vector<std::string> smoother_types_;
   std::string smoother_ids_concat_, current_smoother_;
 
+  // Chunked smoothing: number of poses smoothed per chunk (0 disables
+  // chunking) and the pose overlap giving each chunk boundary context
+  int chunk_size_;
+  int chunk_overlap_;
+
   // Utilities
   std::shared_ptr<nav2_costmap_2d::CostmapSubscriber> costmap_sub_;
   std::shared_ptr<nav2_costmap_2d::FootprintSubscriber> footprint_sub_;
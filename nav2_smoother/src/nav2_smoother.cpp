@@ -14,6 +14,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <string>
@@ -53,6 +54,8 @@ SmootherServer::SmootherServer(const rclcpp::NodeOptions & options)
     rclcpp::ParameterValue(std::string("base_link")));
   declare_parameter("transform_tolerance", rclcpp::ParameterValue(0.1));
   declare_parameter("smoother_plugins", default_ids_);
+  declare_parameter("chunk_size", rclcpp::ParameterValue(0));
+  declare_parameter("chunk_overlap", rclcpp::ParameterValue(10));
 
   declare_parameter("action_server_result_timeout", 10.0);
 }
@@ -90,6 +93,15 @@ SmootherServer::on_configure(const rclcpp_lifecycle::State &)
   this->get_parameter("footprint_topic", footprint_topic);
   this->get_parameter("transform_tolerance", transform_tolerance);
   this->get_parameter("robot_base_frame", robot_base_frame);
+  this->get_parameter("chunk_size", chunk_size_);
+  this->get_parameter("chunk_overlap", chunk_overlap_);
+  if (chunk_size_ > 0 && chunk_overlap_ >= chunk_size_) {
+    RCLCPP_WARN(
+      get_logger(),
+      "chunk_overlap (%d) must be smaller than chunk_size (%d), setting it to %d",
+      chunk_overlap_, chunk_size_, chunk_size_ / 2);
+    chunk_overlap_ = chunk_size_ / 2;
+  }
   costmap_sub_ = std::make_shared<nav2_costmap_2d::CostmapSubscriber>(
     shared_from_this(), costmap_topic);
   footprint_sub_ = std::make_shared<nav2_costmap_2d::FootprintSubscriber>(
@@ -285,8 +297,22 @@ void SmootherServer::smoothPlan()
       throw nav2_core::InvalidPath("Requested path to smooth is invalid");
     }
 
-    result->was_completed = smoothers_[current_smoother_]->smooth(
-      result->path, goal->max_smoothing_duration);
+    if (chunk_size_ > 0 &&
+      result->path.poses.size() > static_cast<size_t>(chunk_size_))
+    {
+      bool cancelled = false;
+      result->was_completed = smoothChunked(
+        result->path, goal->max_smoothing_duration, cancelled);
+      if (cancelled) {
+        RCLCPP_INFO(
+          get_logger(), "Goal was canceled. Stopping smoothing of the remaining path.");
+        action_server_->terminate_all();
+        return;
+      }
+    } else {
+      result->was_completed = smoothers_[current_smoother_]->smooth(
+        result->path, goal->max_smoothing_duration);
+    }
     result->smoothing_duration = this->now() - start_time;
 
     if (!result->was_completed) {
@@ -368,6 +394,61 @@ void SmootherServer::smoothPlan()
   }
 }
 
+bool SmootherServer::smoothChunked(
+  nav_msgs::msg::Path & path,
+  const rclcpp::Duration & max_duration,
+  bool & cancelled)
+{
+  auto smoother = smoothers_[current_smoother_];
+  const auto start_time = this->now();
+  const size_t chunk = static_cast<size_t>(chunk_size_);
+  const size_t overlap = static_cast<size_t>(chunk_overlap_);
+
+  nav_msgs::msg::Path segment;
+  segment.header = path.header;
+
+  bool completed = true;
+  size_t begin = 0;
+  while (begin < path.poses.size()) {
+    // Yield between chunks so a preemption does not have to wait
+    // for the whole path to finish smoothing
+    if (action_server_->is_cancel_requested()) {
+      cancelled = true;
+      return false;
+    }
+
+    const size_t end = std::min(begin + chunk, path.poses.size());
+    const bool last_chunk = end == path.poses.size();
+    segment.poses.assign(path.poses.begin() + begin, path.poses.begin() + end);
+
+    // Give each chunk the time left of the overall budget; a non-positive
+    // budget keeps whatever no-limit semantics the plugin implements
+    rclcpp::Duration remaining_time = max_duration;
+    if (max_duration.nanoseconds() > 0) {
+      remaining_time = max_duration - (this->now() - start_time);
+    }
+    completed = smoother->smooth(segment, remaining_time) && completed;
+
+    // Stitch the smoothed chunk back, allowing the plugin to have
+    // resampled it. A later chunk re-smooths and overwrites the overlap
+    // tail of the previous one with context on both sides.
+    path.poses.erase(path.poses.begin() + begin, path.poses.begin() + end);
+    path.poses.insert(
+      path.poses.begin() + begin, segment.poses.begin(), segment.poses.end());
+
+    // Stream the partially smoothed path out early
+    plan_publisher_->publish(path);
+
+    if (last_chunk) {
+      break;
+    }
+    begin += std::max<size_t>(
+      segment.poses.size() > overlap ? segment.poses.size() - overlap : 0, 1);
+  }
+
+  return completed;
+}
+
 bool SmootherServer::validate(const nav_msgs::msg::Path & path)
 {
   if (path.poses.empty()) {
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License. Reserved.
 
+#include <array>
 #include <vector>
 #include <memory>
 #include "nav2_smoother/savitzky_golay_smoother.hpp"
@@ -106,7 +107,7 @@ bool SavitzkyGolaySmoother::smoothImpl(
     3.0 / 21.0,
     -2.0 / 21.0};
 
-  auto applyFilter = [&](const std::vector<geometry_msgs::msg::Point> & data)
+  auto applyFilter = [&](const std::array<geometry_msgs::msg::Point, 7> & data)
     -> geometry_msgs::msg::Point
     {
       geometry_msgs::msg::Point val;
@@ -143,17 +144,21 @@ bool SavitzkyGolaySmoother::smoothImpl(
         plan_pts[idx + 2].pose.position,
         plan_pts[idx + 3].pose.position});
 
-      // Apply nominal filter
+      // Apply nominal filter as a streaming convolution: the window slides
+      // one pose per step, shifting in a single new sample rather than
+      // re-gathering all seven each pose
+      std::array<geometry_msgs::msg::Point, 7> window;
+      for (unsigned int k = 0; k != 7; k++) {
+        window[k] = plan_pts[k].pose.position;
+      }
       for (idx = 3; idx < path_size - 4; ++idx) {
-        plan_pts[idx].pose.position = applyFilter(
-        {
-          plan_pts[idx - 3].pose.position,
-          plan_pts[idx - 2].pose.position,
-          plan_pts[idx - 1].pose.position,
-          plan_pts[idx].pose.position,
-          plan_pts[idx + 1].pose.position,
-          plan_pts[idx + 2].pose.position,
-          plan_pts[idx + 3].pose.position});
+        const geometry_msgs::msg::Point filtered = applyFilter(window);
+        plan_pts[idx].pose.position = filtered;
+        for (unsigned int k = 0; k != 6; k++) {
+          window[k] = window[k + 1];
+        }
+        window[2] = filtered;
+        window[6] = plan_pts[idx + 4].pose.position;
       }
 
       // Handle terminal boundary conditions, last point is fixed
@@ -124,12 +124,30 @@ bool SimpleSmoother::smoothImpl(
 
   int its = 0;
   double change = tolerance_;
-  const unsigned int & path_size = path.poses.size();
-  double x_i, y_i, y_m1, y_ip1, y_i_org;
+  const unsigned int path_size = path.poses.size();
+  double x_i, y_i, y_i_org;
   unsigned int mx, my;
 
-  nav_msgs::msg::Path new_path = path;
-  nav_msgs::msg::Path last_path = path;
+  // Structure-of-arrays copies of the pose positions: the fixed anchors the
+  // data term pulls towards, the working buffers updated in place, and the
+  // last fully accepted iteration for rollback. The iteration loop then runs
+  // over flat doubles rather than through the pose message accessors.
+  std::vector<double> anchor_x(path_size), anchor_y(path_size);
+  for (unsigned int i = 0; i != path_size; i++) {
+    anchor_x[i] = path.poses[i].pose.position.x;
+    anchor_y[i] = path.poses[i].pose.position.y;
+  }
+  std::vector<double> new_x = anchor_x, new_y = anchor_y;
+  std::vector<double> last_x = anchor_x, last_y = anchor_y;
+
+  // Write a set of smoothed positions back into the pose message path
+  auto applyToPath =
+    [&path, path_size](const std::vector<double> & xs, const std::vector<double> & ys) {
+      for (unsigned int i = 0; i != path_size; i++) {
+        path.poses[i].pose.position.x = xs[i];
+        path.poses[i].pose.position.y = ys[i];
+      }
+    };
 
   while (change >= tolerance_) {
     its += 1;
@@ -140,7 +158,7 @@ bool SimpleSmoother::smoothImpl(
       RCLCPP_WARN(
         logger_,
         "Number of iterations has exceeded limit of %i.", max_its_);
-      path = last_path;
+      applyToPath(last_x, last_y);
       updateApproximatePathOrientations(path, reversing_segment);
       return false;
     }
@@ -152,32 +170,31 @@ bool SimpleSmoother::smoothImpl(
       RCLCPP_WARN(
         logger_,
         "Smoothing time exceeded allowed duration of %0.2f.", max_time);
-      path = last_path;
+      applyToPath(last_x, last_y);
       updateApproximatePathOrientations(path, reversing_segment);
       throw nav2_core::SmootherTimedOut("Smoothing time exceed allowed duration");
     }
 
     for (unsigned int i = 1; i != path_size - 1; i++) {
-      for (unsigned int j = 0; j != 2; j++) {
-        x_i = getFieldByDim(path.poses[i], j);
-        y_i = getFieldByDim(new_path.poses[i], j);
-        y_m1 = getFieldByDim(new_path.poses[i - 1], j);
-        y_ip1 = getFieldByDim(new_path.poses[i + 1], j);
-        y_i_org = y_i;
-
-        // Smooth based on local 3 point neighborhood and original data locations
-        y_i += data_w_ * (x_i - y_i) + smooth_w_ * (y_ip1 + y_m1 - (2.0 * y_i));
-        setFieldByDim(new_path.poses[i], j, y_i);
-        change += abs(y_i - y_i_org);
-      }
+      // Smooth based on local 3 point neighborhood and original data locations
+      x_i = new_x[i];
+      y_i_org = x_i;
+      x_i += data_w_ * (anchor_x[i] - x_i) +
+        smooth_w_ * (new_x[i + 1] + new_x[i - 1] - (2.0 * x_i));
+      new_x[i] = x_i;
+      change += abs(x_i - y_i_org);
+
+      y_i = new_y[i];
+      y_i_org = y_i;
+      y_i += data_w_ * (anchor_y[i] - y_i) +
+        smooth_w_ * (new_y[i + 1] + new_y[i - 1] - (2.0 * y_i));
+      new_y[i] = y_i;
+      change += abs(y_i - y_i_org);
 
       // validate update is admissible, only checks cost if a valid costmap pointer is provided
       float cost = 0.0;
       if (costmap) {
-        costmap->worldToMap(
-          getFieldByDim(new_path.poses[i], 0),
-          getFieldByDim(new_path.poses[i], 1),
-          mx, my);
+        costmap->worldToMap(x_i, y_i, mx, my);
         cost = static_cast<float>(costmap->getCost(mx, my));
       }
 
@@ -186,24 +203,26 @@ bool SimpleSmoother::smoothImpl(
           rclcpp::get_logger("SmacPlannerSmoother"),
           "Smoothing process resulted in an infeasible collision. "
           "Returning the last path before the infeasibility was introduced.");
-        path = last_path;
+        applyToPath(last_x, last_y);
         updateApproximatePathOrientations(path, reversing_segment);
         return false;
       }
     }
 
-    last_path = new_path;
+    last_x = new_x;
+    last_y = new_y;
   }
 
+  applyToPath(new_x, new_y);
+
   // Lets do additional refinement, it shouldn't take more than a couple milliseconds
   // but really puts the path quality over the top.
   if (do_refinement_ && refinement_ctr_ < refinement_num_) {
     refinement_ctr_++;
-    smoothImpl(new_path, reversing_segment, costmap, max_time);
+    smoothImpl(path, reversing_segment, costmap, max_time);
   }
 
-  updateApproximatePathOrientations(new_path, reversing_segment);
-  path = new_path;
+  updateApproximatePathOrientations(path, reversing_segment);
   return true;
 }
 
@@ -0,0 +1,313 @@
+#! /usr/bin/env python3
+# Copyright (c) 2026 Open Navigation LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import json
+import math
+import sys
+import time
+
+from action_msgs.msg import GoalStatus
+from geometry_msgs.msg import Pose
+from geometry_msgs.msg import PoseStamped
+from geometry_msgs.msg import PoseWithCovarianceStamped
+from geometry_msgs.msg import Twist
+from lifecycle_msgs.srv import GetState
+from nav2_msgs.action import NavigateToPose
+from nav_msgs.msg import OccupancyGrid
+from nav_msgs.msg import Path
+
+import rclpy
+
+from rclpy.action import ActionClient
+from rclpy.node import Node
+from rclpy.qos import QoSDurabilityPolicy, QoSHistoryPolicy, QoSReliabilityPolicy
+from rclpy.qos import QoSProfile
+
+
+def summarize(samples_s):
+    # Latencies are collected in seconds; the report is in milliseconds
+    samples = sorted(1000.0 * s for s in samples_s)
+    if not samples:
+        return {'count': 0}
+    return {
+        'count': len(samples),
+        'unit': 'ms',
+        'min': samples[0],
+        'mean': sum(samples) / len(samples),
+        'p50': samples[len(samples) // 2],
+        'p95': samples[min(len(samples) - 1, int(math.ceil(0.95 * len(samples))) - 1)],
+        'max': samples[-1],
+    }
+
+
+class LatencyBenchmark(Node):
+    """
+    Drives repeated navigation goals and samples end-to-end latencies.
+
+    Timestamps are taken with a monotonic clock at the instrumented
+    boundaries the servers already expose as topics: the planner server's
+    'plan' publisher, the controller server's 'cmd_vel' publisher and the
+    local costmap publisher. Per goal cycle this yields goal receipt to
+    first plan, goal receipt to first cmd_vel, and replan intervals during
+    traversal; costmap publish gaps are sampled continuously as staleness.
+    """
+
+    def __init__(self, initial_pose: Pose, goal_poses, cycles: int):
+        super().__init__(node_name='latency_benchmark')
+        self.initial_pose_pub = self.create_publisher(
+            PoseWithCovarianceStamped, 'initialpose', 10
+        )
+
+        pose_qos = QoSProfile(
+            durability=QoSDurabilityPolicy.TRANSIENT_LOCAL,
+            reliability=QoSReliabilityPolicy.RELIABLE,
+            history=QoSHistoryPolicy.KEEP_LAST,
+            depth=1,
+        )
+
+        self.model_pose_sub = self.create_subscription(
+            PoseWithCovarianceStamped, 'amcl_pose', self.poseCallback, pose_qos
+        )
+        self.plan_sub = self.create_subscription(
+            Path, 'plan', self.planCallback, 10
+        )
+        self.cmd_vel_sub = self.create_subscription(
+            Twist, 'cmd_vel', self.cmdVelCallback, 10
+        )
+        self.costmap_sub = self.create_subscription(
+            OccupancyGrid, 'local_costmap/costmap', self.costmapCallback, pose_qos
+        )
+
+        self.initial_pose_received = False
+        self.initial_pose = initial_pose
+        self.goal_poses = goal_poses
+        self.cycles = cycles
+        self.set_initial_pose_timeout = 15
+        self.action_client = ActionClient(self, NavigateToPose, 'navigate_to_pose')
+
+        # Armed at goal send; the callbacks fill in the first arrivals
+        self.goal_sent_time = None
+        self.first_plan_latency = None
+        self.first_cmd_vel_latency = None
+        self.last_plan_time = None
+        self.last_costmap_time = None
+
+        self.goal_to_first_plan = []
+        self.goal_to_first_cmd_vel = []
+        self.replan_intervals = []
+        self.costmap_intervals = []
+
+    def info_msg(self, msg: str):
+        self.get_logger().info('\033[1;37;44m' + msg + '\033[0m')
+
+    def error_msg(self, msg: str):
+        self.get_logger().error('\033[1;37;41m' + msg + '\033[0m')
+
+    def poseCallback(self, msg):
+        self.initial_pose_received = True
+
+    def planCallback(self, msg):
+        now = time.monotonic()
+        if self.goal_sent_time is not None:
+            if self.first_plan_latency is None:
+                self.first_plan_latency = now - self.goal_sent_time
+            elif self.last_plan_time is not None:
+                self.replan_intervals.append(now - self.last_plan_time)
+        self.last_plan_time = now
+
+    def cmdVelCallback(self, msg):
+        if self.goal_sent_time is not None and self.first_cmd_vel_latency is None:
+            self.first_cmd_vel_latency = time.monotonic() - self.goal_sent_time
+
+    def costmapCallback(self, msg):
+        now = time.monotonic()
+        if self.last_costmap_time is not None:
+            self.costmap_intervals.append(now - self.last_costmap_time)
+        self.last_costmap_time = now
+
+    def setInitialPose(self):
+        msg = PoseWithCovarianceStamped()
+        msg.pose.pose = self.initial_pose
+        msg.header.frame_id = 'map'
+        self.info_msg('Publishing Initial Pose')
+        self.initial_pose_pub.publish(msg)
+
+    def getStampedPoseMsg(self, pose: Pose):
+        msg = PoseStamped()
+        msg.header.frame_id = 'map'
+        msg.pose = pose
+        return msg
+
+    def runBenchmarkCycle(self, goal_pose: Pose):
+        self.info_msg("Waiting for 'NavigateToPose' action server")
+        while not self.action_client.wait_for_server(timeout_sec=1.0):
+            self.info_msg("'NavigateToPose' action server not available, waiting...")
+
+        goal_msg = NavigateToPose.Goal()
+        goal_msg.pose = self.getStampedPoseMsg(goal_pose)
+
+        self.first_plan_latency = None
+        self.first_cmd_vel_latency = None
+        self.last_plan_time = None
+
+        self.info_msg('Sending goal request...')
+        self.goal_sent_time = time.monotonic()
+        send_goal_future = self.action_client.send_goal_async(goal_msg)
+
+        rclpy.spin_until_future_complete(self, send_goal_future)
+        goal_handle = send_goal_future.result()
+
+        if not goal_handle.accepted:
+            self.error_msg('Goal rejected')
+            return False
+
+        get_result_future = goal_handle.get_result_async()
+        rclpy.spin_until_future_complete(self, get_result_future)
+        status = get_result_future.result().status
+        self.goal_sent_time = None
+        if status != GoalStatus.STATUS_SUCCEEDED:
+            self.error_msg(f'Goal failed with status code: {status}')
+            return False
+
+        if self.first_plan_latency is None or self.first_cmd_vel_latency is None:
+            self.error_msg('Goal completed without observing a plan and a cmd_vel')
+            return False
+        self.goal_to_first_plan.append(self.first_plan_latency)
+        self.goal_to_first_cmd_vel.append(self.first_cmd_vel_latency)
+        self.info_msg(
+            f'Cycle complete: first plan {1000.0 * self.first_plan_latency:.1f} ms,'
+            f' first cmd_vel {1000.0 * self.first_cmd_vel_latency:.1f} ms'
+        )
+        return True
+
+    def run(self):
+        # Cycle back and forth through the goal list so each cycle ends
+        # where the next begins
+        poses = self.goal_poses
+        ok = True
+        for i in range(self.cycles):
+            ok = self.runBenchmarkCycle(poses[i % len(poses)]) and ok
+        return ok
+
+    def report(self, output_path):
+        report = {
+            'cycles': self.cycles,
+            'goal_to_first_plan': summarize(self.goal_to_first_plan),
+            'goal_to_first_cmd_vel': summarize(self.goal_to_first_cmd_vel),
+            'replan_interval': summarize(self.replan_intervals),
+            'local_costmap_publish_interval': summarize(self.costmap_intervals),
+        }
+        with open(output_path, 'w') as out:
+            json.dump(report, out, indent=2)
+            out.write('\n')
+        self.info_msg(f'Wrote latency report to {output_path}')
+        self.info_msg(json.dumps(report))
+
+    def wait_for_node_active(self, node_name: str):
+        # Waits for the node within the tester namespace to become active
+        self.info_msg(f'Waiting for {node_name} to become active')
+        node_service = f'{node_name}/get_state'
+        state_client = self.create_client(GetState, node_service)
+        while not state_client.wait_for_service(timeout_sec=1.0):
+            self.info_msg(f'{node_service} service not available, waiting...')
+        req = GetState.Request()
+        state = 'UNKNOWN'
+        while state != 'active':
+            self.info_msg(f'Getting {node_name} state...')
+            future = state_client.call_async(req)
+            rclpy.spin_until_future_complete(self, future)
+            if future.result() is not None:
+                state = future.result().current_state.label
+                self.info_msg(f'Result of get_state: {state}')
+            else:
+                self.error_msg(
+                    f'Exception while calling service: {future.exception()!r}'
+                )
+            time.sleep(2)
+
+    def wait_for_initial_pose(self):
+        self.initial_pose_received = False
+        # If the initial pose is not received within 15 seconds, return False
+        start_time = time.time()
+        duration = 0.0
+        while not self.initial_pose_received:
+            self.info_msg('Setting initial pose')
+            self.setInitialPose()
+            self.info_msg('Waiting for amcl_pose to be received')
+            if duration > self.set_initial_pose_timeout:
+                self.error_msg('Timeout waiting for initial pose to be set')
+                return False
+            rclpy.spin_once(self, timeout_sec=1)
+            duration = time.time() - start_time
+        return True
+
+
+def pose2d(x, y, yaw=0.0):
+    pose = Pose()
+    pose.position.x = x
+    pose.position.y = y
+    pose.position.z = 0.01
+    pose.orientation.w = math.cos(yaw / 2.0)
+    pose.orientation.z = math.sin(yaw / 2.0)
+    return pose
+
+
+def main(argv=sys.argv[1:]):
+    parser = argparse.ArgumentParser(description='Nav2 end-to-end latency benchmark')
+    parser.add_argument(
+        '-r', '--robot', type=float, nargs=4,
+        metavar=('init_x', 'init_y', 'final_x', 'final_y'),
+        help='The robot starting and final positions.'
+    )
+    parser.add_argument(
+        '-c', '--cycles', type=int, default=4,
+        help='Number of navigation cycles to sample.'
+    )
+    parser.add_argument(
+        '-o', '--output', type=str, default='latency_report.json',
+        help='Path of the JSON latency report artifact.'
+    )
+    args, unknown = parser.parse_known_args()
+
+    rclpy.init()
+
+    init_x, init_y, final_x, final_y = args.robot
+    # Alternate between the two endpoints so every cycle starts where the
+    # previous one finished
+    benchmark = LatencyBenchmark(
+        initial_pose=pose2d(init_x, init_y),
+        goal_poses=[pose2d(final_x, final_y), pose2d(init_x, init_y)],
+        cycles=args.cycles,
+    )
+
+    benchmark.wait_for_node_active('amcl')
+    if not benchmark.wait_for_initial_pose():
+        sys.exit(1)
+    benchmark.wait_for_node_active('bt_navigator')
+
+    passed = benchmark.run()
+    benchmark.report(args.output)
+    if passed:
+        benchmark.info_msg('Benchmark PASSED')
+
+    benchmark.destroy_node()
+    rclpy.shutdown()
+    if not passed:
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
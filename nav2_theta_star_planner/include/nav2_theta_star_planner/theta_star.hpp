@@ -15,19 +15,24 @@
 #ifndef NAV2_THETA_STAR_PLANNER__THETA_STAR_HPP_
 #define NAV2_THETA_STAR_PLANNER__THETA_STAR_HPP_
 
+#include <cfloat>
 #include <cmath>
 #include <chrono>
+#include <cstdint>
 #include <vector>
-#include <queue>
 #include <algorithm>
 #include "rclcpp/rclcpp.hpp"
 #include "nav2_costmap_2d/costmap_2d_ros.hpp"
 
 const double INF_COST = DBL_MAX;
+const float INF_COST_F = FLT_MAX;
 const int UNKNOWN_COST = 255;
 const int OBS_COST = 254;
 const int LETHAL_COST = 252;
 
+/// sentinel for "no node stored at this cell" in the 32-bit node ids
+const uint32_t NO_NODE = UINT32_MAX;
+
 struct coordsM
 {
   int x, y;
@@ -38,24 +43,6 @@ struct coordsW
   double x, y;
 };
 
-struct tree_node
-{
-  int x, y;
-  double g = INF_COST;
-  double h = INF_COST;
-  const tree_node * parent_id = nullptr;
-  bool is_in_queue = false;
-  double f = INF_COST;
-};
-
-struct comp
-{
-  bool operator()(const tree_node * p1, const tree_node * p2)
-  {
-    return (p1->f) > (p2->f);
-  }
-};
-
 namespace theta_star
 {
 class ThetaStar
@@ -78,6 +65,9 @@ public:
   int size_x_, size_y_;
   /// the interval at which the planner checks if it has been cancelled
   int terminal_checking_interval_;
+  /// parameter to set whether the search tree is retained between requests
+  /// sharing a goal, so unchanged regions are not searched from scratch
+  bool use_incremental_replanning_;
 
   ThetaStar();
 
@@ -126,24 +116,37 @@ public:
   int nodes_opened = 0;
 
 protected:
-  /// for the coordinates (x,y), it stores at node_position_[size_x_ * y + x],
-  /// the pointer to the location at which the data of the node is present in nodes_data_
+  /// for the coordinates (x,y), it stores at node_position_[size_x_ * y + x]
+  /// the id of the node for that cell, or NO_NODE if none was generated yet;
   /// it is initialised with size_x_ * size_y_ elements
   /// and its number of elements increases to account for a change in map size
-  std::vector<tree_node *> node_position_;
-
-  /// the vector nodes_data_ stores the coordinates, costs and index of the parent node,
-  /// and whether or not the node is present in queue_, for all the nodes searched
-  /// it is initialised with no elements
-  /// and its size increases depending on the number of nodes searched
-  std::vector<tree_node> nodes_data_;
-
-  /// this is the priority queue (open_list) to select the next node to be expanded
-  std::priority_queue<tree_node *, std::vector<tree_node *>, comp> queue_;
+  std::vector<uint32_t> node_position_;
+
+  /// per-node search data, split by field (structure of arrays) so the hot
+  /// expansion loop only touches the costs and parent ids it needs; indexed
+  /// by the 32-bit node ids handed out by index_generated_, and reserved to
+  /// the map size once so expansion never reallocates
+  std::vector<uint16_t> node_x_, node_y_;
+  std::vector<float> node_g_, node_f_;
+  std::vector<uint32_t> node_parent_;
+  std::vector<uint8_t> node_in_queue_;
+
+  /// the open list: a binary min-heap of node ids ordered by node_f_
+  std::vector<uint32_t> queue_;
+
+  /// orders the open list by the f cost of the referenced nodes
+  struct heap_comp
+  {
+    const std::vector<float> & f;
+    bool operator()(const uint32_t & i1, const uint32_t & i2) const
+    {
+      return f[i1] > f[i2];
+    }
+  };
 
-  /// it is a counter like variable used to generate consecutive indices
+  /// it is a counter like variable used to generate consecutive node ids
   /// such that the data for all the nodes (in open and closed lists) could be stored
-  /// consecutively in nodes_data_
+  /// consecutively in the node arrays
   int index_generated_;
 
   const coordsM moves[8] = {{0, 1},
@@ -155,40 +158,38 @@ protected:
     {1, 1},
     {-1, -1}};
 
-  tree_node * exp_node;
-
-
   /** @brief it performs a line of sight (los) check between the current node and the parent node of its parent node;
    *            if an los is found and the new costs calculated are lesser, then the cost and parent node
    *            of the current node is updated
-   * @param data of the current node
+   * @param curr_id the id of the current node
    */
-  void resetParent(tree_node * curr_data);
+  void resetParent(const uint32_t & curr_id);
 
   /**
    * @brief this function expands the current node
-   * @param curr_data used to send the data of the current node
-   * @param curr_id used to send the index of the current node as stored in nodes_position_
+   * @param curr_id the id of the current node
    */
-  void setNeighbors(const tree_node * curr_data);
+  void setNeighbors(const uint32_t & curr_id);
 
   /**
    * @brief performs the line of sight check using Bresenham's Algorithm,
    *            and has been modified to calculate the traversal cost incurred in a straight line path between
    *            the two points whose coordinates are (x0, y0) and (x1, y1)
    * @param sl_cost is used to return the cost thus incurred
+   * @param max_cost aborts the walk early once the accumulated cost exceeds it,
+   *            for the callers that only care about an LOS cheaper than a known bound
    * @return true if a line of sight exists between the points
    */
   bool losCheck(
     const int & x0, const int & y0, const int & x1, const int & y1,
-    double & sl_cost) const;
+    double & sl_cost, const double & max_cost = INF_COST) const;
 
   /**
    * @brief it returns the path by backtracking from the goal to the start, by using their parent nodes
    * @param raw_points used to return the path  thus found
-   * @param curr_id sends in the index of the goal coordinate, as stored in nodes_position
+   * @param curr_id sends in the id of the goal node
    */
-  void backtrace(std::vector<coordsW> & raw_points, const tree_node * curr_n) const;
+  void backtrace(std::vector<coordsW> & raw_points, uint32_t curr_id) const;
 
   /**
    * @brief it is an overloaded function to ease the cost calculations while performing the LOS check
@@ -209,6 +210,34 @@ protected:
     }
   }
 
+  /**
+   * @brief overload of the above working on the costmap's raw character map at a
+   *            flattened cell index, so the LOS kernel can step the index incrementally
+   *            instead of recomputing it and re-fetching the cell cost per probe
+   * @param cmap the costmap's raw character map
+   * @param index the flattened index (size_x_ * cy + cx) of the probed cell
+   * @param cost accumulates the straight line traversal cost, as above
+   * @return false if the traversal cost is greater than / equal to the LETHAL_COST and true otherwise
+   */
+  bool isSafe(const unsigned char * cmap, const int & index, double & cost) const
+  {
+    const unsigned char map_cost = cmap[index];
+    if (map_cost == UNKNOWN_COST) {
+      if (!allow_unknown_) {
+        return false;
+      }
+      cost += w_traversal_cost_ * (OBS_COST - 1) * (OBS_COST - 1) /
+        LETHAL_COST / LETHAL_COST;
+      return true;
+    }
+    const double curr_cost = 26 + 0.9 * map_cost;
+    if (curr_cost < LETHAL_COST) {
+      cost += w_traversal_cost_ * curr_cost * curr_cost / LETHAL_COST / LETHAL_COST;
+      return true;
+    }
+    return false;
+  }
+
   /*
    * @brief this function scales the costmap cost by shifting the origin to 25 and then multiply
    *           the actual costmap cost by 0.9 to keep the output in the range of [25, 255)
@@ -259,12 +288,12 @@ protected:
   }
 
   /**
-   * @brief checks if the coordinates of a node is the goal or not
+   * @brief checks if the coordinates (cx, cy) are the goal or not
    * @return the result of the check
    */
-  inline bool isGoal(const tree_node & this_node) const
+  inline bool isGoal(const int & cx, const int & cy) const
   {
-    return this_node.x == dst_.x && this_node.y == dst_.y;
+    return cx == dst_.x && cy == dst_.y;
   }
 
   /**
@@ -275,47 +304,71 @@ protected:
 
   /**
    * @brief it stores id_this in node_position_ at the index [ size_x_*cy + cx ]
-   * @param id_this a pointer to the location at which the data of the point(cx, cy) is stored in nodes_data_
+   * @param id_this the id of the node holding the data of the point(cx, cy)
    */
-  inline void addIndex(const int & cx, const int & cy, tree_node * node_this)
+  inline void addIndex(const int & cx, const int & cy, const uint32_t & id_this)
   {
-    node_position_[size_x_ * cy + cx] = node_this;
+    node_position_[size_x_ * cy + cx] = id_this;
   }
 
   /**
-   * @brief retrieves the pointer of the location at which the data of the point(cx, cy) is stored in nodes_data
-   * @return id_this is the pointer to that location
+   * @brief retrieves the id of the node storing the data of the point(cx, cy)
+   * @return the node id, or NO_NODE if none was generated for that cell
    */
-  inline tree_node * getIndex(const int & cx, const int & cy)
+  inline uint32_t getIndex(const int & cx, const int & cy) const
   {
     return node_position_[size_x_ * cy + cx];
   }
 
   /**
-   * @brief this function depending on the size of the nodes_data_ vector allots space to store the data for a node(x, y)
-   * @param id_this is the index at which the data is stored/has to be stored for that node
+   * @brief depending on the size of the node arrays, this function allots or resets
+   *            the storage for the data of a node
+   * @param id_this is the id at which the data is stored/has to be stored for that node
    */
   void addToNodesData(const int & id_this)
   {
-    if (static_cast<int>(nodes_data_.size()) <= id_this) {
-      nodes_data_.push_back({});
+    if (static_cast<int>(node_g_.size()) <= id_this) {
+      node_x_.push_back(0);
+      node_y_.push_back(0);
+      node_g_.push_back(INF_COST_F);
+      node_f_.push_back(INF_COST_F);
+      node_parent_.push_back(NO_NODE);
+      node_in_queue_.push_back(0);
     } else {
-      nodes_data_[id_this] = {};
+      node_g_[id_this] = INF_COST_F;
+      node_f_[id_this] = INF_COST_F;
+      node_parent_[id_this] = NO_NODE;
+      node_in_queue_[id_this] = 0;
     }
   }
 
+  /**
+   * @brief attempts to serve the request from the search tree retained by the last
+   *            request; the tree is rooted at the goal, so while the goal is unchanged the
+   *            parent chain from the current start still leads to it, and only the cells
+   *            along that chain have to be revalidated against the costmap deltas
+   * @param raw_path is used to return the path recovered from the retained tree
+   * @return true if the retained tree produced a valid path, false if a fresh search is needed
+   */
+  bool tryReusePath(std::vector<coordsW> & raw_path);
+
   /**
    * @brief initialises the values of global variables at beginning of the execution of the generatePath function
    */
   void resetContainers();
 
   /**
-   * @brief clears the priority queue after each execution of the generatePath function
+   * @brief clears the open list after each execution of the generatePath function
    */
   void clearQueue()
   {
-    queue_ = std::priority_queue<tree_node *, std::vector<tree_node *>, comp>();
+    queue_.clear();
   }
+
+  /// the goal the retained search tree is rooted at
+  coordsM last_dst_;
+  /// whether the containers still hold a tree usable for incremental replanning
+  bool tree_valid_;
 };
 }   //  namespace theta_star
 
@@ -28,9 +28,11 @@ ThetaStar::ThetaStar()
   size_x_(0),
   size_y_(0),
   terminal_checking_interval_(5000),
-  index_generated_(0)
+  use_incremental_replanning_(false),
+  index_generated_(0),
+  last_dst_{-1, -1},
+  tree_valid_(false)
 {
-  exp_node = new tree_node;
 }
 
 void ThetaStar::setStartAndGoal(
@@ -47,15 +49,29 @@ void ThetaStar::setStartAndGoal(
 
 bool ThetaStar::generatePath(std::vector<coordsW> & raw_path, std::function<bool()> cancel_checker)
 {
+  if (use_incremental_replanning_ && tryReusePath(raw_path)) {
+    return true;
+  }
+
+  // root the search tree at the goal when incremental replanning is on, so the
+  // retained parent chains keep leading to the goal while the robot advances
+  if (use_incremental_replanning_) {
+    std::swap(src_, dst_);
+  }
+
   resetContainers();
   addToNodesData(index_generated_);
+  const uint32_t src_id = static_cast<uint32_t>(index_generated_);
   double src_g_cost = getTraversalCost(src_.x, src_.y), src_h_cost = getHCost(src_.x, src_.y);
-  nodes_data_[index_generated_] =
-  {src_.x, src_.y, src_g_cost, src_h_cost, &nodes_data_[index_generated_], true,
-    src_g_cost + src_h_cost};
-  queue_.push({&nodes_data_[index_generated_]});
-  addIndex(src_.x, src_.y, &nodes_data_[index_generated_]);
-  tree_node * curr_data = &nodes_data_[index_generated_];
+  node_x_[src_id] = static_cast<uint16_t>(src_.x);
+  node_y_[src_id] = static_cast<uint16_t>(src_.y);
+  node_g_[src_id] = static_cast<float>(src_g_cost);
+  node_f_[src_id] = static_cast<float>(src_g_cost + src_h_cost);
+  node_parent_[src_id] = src_id;
+  node_in_queue_[src_id] = 1;
+  queue_.push_back(src_id);
+  addIndex(src_.x, src_.y, src_id);
+  uint32_t curr_id = src_id;
   index_generated_++;
   nodes_opened = 0;
 
@@ -67,56 +83,127 @@ bool ThetaStar::generatePath(std::vector<coordsW> & raw_path, std::function<bool
       throw nav2_core::PlannerCancelled("Planner was canceled");
     }
 
-    if (isGoal(*curr_data)) {
+    if (isGoal(node_x_[curr_id], node_y_[curr_id])) {
       break;
     }
 
-    resetParent(curr_data);
-    setNeighbors(curr_data);
+    resetParent(curr_id);
+    setNeighbors(curr_id);
 
-    curr_data = queue_.top();
-    queue_.pop();
+    curr_id = queue_.front();
+    std::pop_heap(queue_.begin(), queue_.end(), heap_comp{node_f_});
+    queue_.pop_back();
   }
 
   if (queue_.empty()) {
     raw_path.clear();
+    if (use_incremental_replanning_) {
+      std::swap(src_, dst_);
+      tree_valid_ = false;
+    }
     return false;
   }
 
-  backtrace(raw_path, curr_data);
+  backtrace(raw_path, curr_id);
   clearQueue();
 
+  if (use_incremental_replanning_) {
+    std::swap(src_, dst_);
+    // the tree was searched goal to start, so the traced path runs start to
+    // goal once flipped back into request order
+    std::reverse(raw_path.begin(), raw_path.end());
+    last_dst_ = dst_;
+    tree_valid_ = true;
+  }
+
+  return true;
+}
+
+bool ThetaStar::tryReusePath(std::vector<coordsW> & raw_path)
+{
+  // a retained tree is only usable while the goal and the map size are unchanged
+  if (!tree_valid_ || dst_.x != last_dst_.x || dst_.y != last_dst_.y ||
+    size_x_ != static_cast<int>(costmap_->getSizeInCellsX()) ||
+    size_y_ != static_cast<int>(costmap_->getSizeInCellsY()))
+  {
+    return false;
+  }
+
+  uint32_t curr_n = getIndex(src_.x, src_.y);
+  if (curr_n == NO_NODE || node_g_[curr_n] == INF_COST_F) {
+    // the robot has left the region expanded by the last search
+    return false;
+  }
+
+  // revalidate the retained parent chain against the current costmap; a cell
+  // invalidated by a costmap delta along it forces a fresh search, deltas
+  // elsewhere on the map cannot affect this path and are left alone
+  raw_path.clear();
+  coordsW world{};
+  double sl_cost = 0;
+  while (node_parent_[curr_n] != curr_n) {
+    const uint32_t curr_par = node_parent_[curr_n];
+    if (!isSafe(node_x_[curr_n], node_y_[curr_n]) ||
+      !losCheck(
+        node_x_[curr_n], node_y_[curr_n], node_x_[curr_par], node_y_[curr_par], sl_cost))
+    {
+      raw_path.clear();
+      return false;
+    }
+    costmap_->mapToWorld(node_x_[curr_n], node_y_[curr_n], world.x, world.y);
+    raw_path.push_back(world);
+    curr_n = curr_par;
+  }
+  costmap_->mapToWorld(node_x_[curr_n], node_y_[curr_n], world.x, world.y);
+  raw_path.push_back(world);
+
   return true;
 }
 
-void ThetaStar::resetParent(tree_node * curr_data)
+void ThetaStar::resetParent(const uint32_t & curr_id)
 {
   double g_cost, los_cost = 0;
-  curr_data->is_in_queue = false;
-  const tree_node * curr_par = curr_data->parent_id;
-  const tree_node * maybe_par = curr_par->parent_id;
-
-  if (losCheck(curr_data->x, curr_data->y, maybe_par->x, maybe_par->y, los_cost)) {
-    g_cost = maybe_par->g +
-      getEuclideanCost(curr_data->x, curr_data->y, maybe_par->x, maybe_par->y) + los_cost;
-
-    if (g_cost < curr_data->g) {
-      curr_data->parent_id = maybe_par;
-      curr_data->g = g_cost;
-      curr_data->f = g_cost + curr_data->h;
+  node_in_queue_[curr_id] = 0;
+  const uint32_t curr_par = node_parent_[curr_id];
+  const uint32_t maybe_par = node_parent_[curr_par];
+
+  const double euc_cost = getEuclideanCost(
+    node_x_[curr_id], node_y_[curr_id], node_x_[maybe_par], node_y_[maybe_par]);
+  // an LOS costlier than this cannot improve on the current parent, so the
+  // check is skipped outright or aborted as soon as it crosses the bound
+  const double max_los_cost = static_cast<double>(node_g_[curr_id]) -
+    static_cast<double>(node_g_[maybe_par]) - euc_cost;
+
+  if (max_los_cost > 0 &&
+    losCheck(
+      node_x_[curr_id], node_y_[curr_id], node_x_[maybe_par], node_y_[maybe_par],
+      los_cost, max_los_cost))
+  {
+    g_cost = node_g_[maybe_par] + euc_cost + los_cost;
+
+    if (g_cost < node_g_[curr_id]) {
+      // the heuristic term is recovered from f and g rather than stored
+      const float h_cost = node_f_[curr_id] - node_g_[curr_id];
+      node_parent_[curr_id] = maybe_par;
+      node_g_[curr_id] = static_cast<float>(g_cost);
+      node_f_[curr_id] = static_cast<float>(g_cost) + h_cost;
     }
   }
 }
 
-void ThetaStar::setNeighbors(const tree_node * curr_data)
+void ThetaStar::setNeighbors(const uint32_t & curr_id)
 {
   int mx, my;
-  tree_node * m_id = nullptr;
+  uint32_t m_id = NO_NODE;
   double g_cost, h_cost, cal_cost;
 
+  const int cx = node_x_[curr_id];
+  const int cy = node_y_[curr_id];
+  const double cg = node_g_[curr_id];
+
   for (int i = 0; i < how_many_corners_; i++) {
-    mx = curr_data->x + moves[i].x;
-    my = curr_data->y + moves[i].y;
+    mx = cx + moves[i].x;
+    my = cy + moves[i].y;
 
     if (withinLimits(mx, my)) {
       if (!isSafe(mx, my)) {
@@ -126,49 +213,46 @@ void ThetaStar::setNeighbors(const tree_node * curr_data)
       continue;
     }
 
-    g_cost = curr_data->g + getEuclideanCost(curr_data->x, curr_data->y, mx, my) +
-      getTraversalCost(mx, my);
+    g_cost = cg + getEuclideanCost(cx, cy, mx, my) + getTraversalCost(mx, my);
 
     m_id = getIndex(mx, my);
 
-    if (m_id == nullptr) {
+    if (m_id == NO_NODE) {
       addToNodesData(index_generated_);
-      m_id = &nodes_data_[index_generated_];
+      m_id = static_cast<uint32_t>(index_generated_);
       addIndex(mx, my, m_id);
       index_generated_++;
     }
 
-    exp_node = m_id;
-
     h_cost = getHCost(mx, my);
     cal_cost = g_cost + h_cost;
-    if (exp_node->f > cal_cost) {
-      exp_node->g = g_cost;
-      exp_node->h = h_cost;
-      exp_node->f = cal_cost;
-      exp_node->parent_id = curr_data;
-      if (!exp_node->is_in_queue) {
-        exp_node->x = mx;
-        exp_node->y = my;
-        exp_node->is_in_queue = true;
-        queue_.push({m_id});
+    if (node_f_[m_id] > cal_cost) {
+      node_g_[m_id] = static_cast<float>(g_cost);
+      node_f_[m_id] = static_cast<float>(cal_cost);
+      node_parent_[m_id] = curr_id;
+      if (!node_in_queue_[m_id]) {
+        node_x_[m_id] = static_cast<uint16_t>(mx);
+        node_y_[m_id] = static_cast<uint16_t>(my);
+        node_in_queue_[m_id] = 1;
+        queue_.push_back(m_id);
+        std::push_heap(queue_.begin(), queue_.end(), heap_comp{node_f_});
       }
     }
   }
 }
 
-void ThetaStar::backtrace(std::vector<coordsW> & raw_points, const tree_node * curr_n) const
+void ThetaStar::backtrace(std::vector<coordsW> & raw_points, uint32_t curr_n) const
 {
   std::vector<coordsW> path_rev;
   coordsW world{};
   do {
-    costmap_->mapToWorld(curr_n->x, curr_n->y, world.x, world.y);
+    costmap_->mapToWorld(node_x_[curr_n], node_y_[curr_n], world.x, world.y);
     path_rev.push_back(world);
     if (path_rev.size() > 1) {
-      curr_n = curr_n->parent_id;
+      curr_n = node_parent_[curr_n];
     }
-  } while (curr_n->parent_id != curr_n);
-  costmap_->mapToWorld(curr_n->x, curr_n->y, world.x, world.y);
+  } while (node_parent_[curr_n] != curr_n);
+  costmap_->mapToWorld(node_x_[curr_n], node_y_[curr_n], world.x, world.y);
   path_rev.push_back(world);
 
   raw_points.reserve(path_rev.size());
@@ -179,7 +263,7 @@ void ThetaStar::backtrace(std::vector<coordsW> & raw_points, const tree_node * c
 
 bool ThetaStar::losCheck(
   const int & x0, const int & y0, const int & x1, const int & y1,
-  double & sl_cost) const
+  double & sl_cost, const double & max_cost) const
 {
   sl_cost = 0;
 
@@ -194,41 +278,61 @@ bool ThetaStar::losCheck(
   cx = x0;
   cy = y0;
 
+  // the flattened index of the probed cell (cx + u_x, cy + u_y) is stepped
+  // alongside the coordinates, so each probe costs a single load off the raw
+  // character map instead of recomputing the index and re-fetching the cost
+  const unsigned char * cmap = costmap_->getCharMap();
+  const int map_width = static_cast<int>(costmap_->getSizeInCellsX());
+  const int step_y = sy * map_width;
+  int curr = map_width * (cy + u_y) + cx + u_x;
+
   if (dx >= dy) {
     while (cx != x1) {
       f += dy;
       if (f >= dx) {
-        if (!isSafe(cx + u_x, cy + u_y, sl_cost)) {
+        if (!isSafe(cmap, curr, sl_cost)) {
           return false;
         }
         cy += sy;
+        curr += step_y;
         f -= dx;
       }
-      if (f != 0 && !isSafe(cx + u_x, cy + u_y, sl_cost)) {
+      if (f != 0 && !isSafe(cmap, curr, sl_cost)) {
         return false;
       }
-      if (dy == 0 && !isSafe(cx + u_x, cy, sl_cost) && !isSafe(cx + u_x, cy - 1, sl_cost)) {
+      // when dy == 0, u_y is -1 and curr indexes (cx + u_x, cy - 1)
+      if (dy == 0 && !isSafe(cmap, curr + map_width, sl_cost) && !isSafe(cmap, curr, sl_cost)) {
+        return false;
+      }
+      if (sl_cost > max_cost) {
         return false;
       }
       cx += sx;
+      curr += sx;
     }
   } else {
     while (cy != y1) {
       f = f + dx;
       if (f >= dy) {
-        if (!isSafe(cx + u_x, cy + u_y, sl_cost)) {
+        if (!isSafe(cmap, curr, sl_cost)) {
           return false;
         }
         cx += sx;
+        curr += sx;
         f -= dy;
       }
-      if (f != 0 && !isSafe(cx + u_x, cy + u_y, sl_cost)) {
+      if (f != 0 && !isSafe(cmap, curr, sl_cost)) {
+        return false;
+      }
+      // when dx == 0, u_x is -1 and curr indexes (cx - 1, cy + u_y)
+      if (dx == 0 && !isSafe(cmap, curr + 1, sl_cost) && !isSafe(cmap, curr, sl_cost)) {
         return false;
       }
-      if (dx == 0 && !isSafe(cx, cy + u_y, sl_cost) && !isSafe(cx - 1, cy + u_y, sl_cost)) {
+      if (sl_cost > max_cost) {
         return false;
       }
       cy += sy;
+      curr += step_y;
     }
   }
   return true;
@@ -245,7 +349,16 @@ void ThetaStar::resetContainers()
     static_cast<int>(node_position_.size()) < (curr_size_x * curr_size_y))
   {
     initializePosn(curr_size_y * curr_size_x - last_size_y * last_size_x);
-    nodes_data_.reserve(curr_size_x * curr_size_y);
+    // reserve the node arrays and the open list once, so expansion never
+    // reallocates while the map size is stable
+    const size_t cells = static_cast<size_t>(curr_size_x) * curr_size_y;
+    node_x_.reserve(cells);
+    node_y_.reserve(cells);
+    node_g_.reserve(cells);
+    node_f_.reserve(cells);
+    node_parent_.reserve(cells);
+    node_in_queue_.reserve(cells);
+    queue_.reserve(cells);
   } else {
     initializePosn();
   }
@@ -257,12 +370,12 @@ void ThetaStar::initializePosn(int size_inc)
 {
   if (!node_position_.empty()) {
     for (int i = 0; i < size_x_ * size_y_; i++) {
-      node_position_[i] = nullptr;
+      node_position_[i] = NO_NODE;
     }
   }
 
   for (int i = 0; i < size_inc; i++) {
-    node_position_.push_back(nullptr);
+    node_position_.push_back(NO_NODE);
   }
 }
 
@@ -66,6 +66,11 @@ void ThetaStarPlanner::configure(
   nav2_util::declare_parameter_if_not_declared(
     node, name + ".use_final_approach_orientation", rclcpp::ParameterValue(false));
   node->get_parameter(name + ".use_final_approach_orientation", use_final_approach_orientation_);
+
+  nav2_util::declare_parameter_if_not_declared(
+    node, name_ + ".use_incremental_replanning", rclcpp::ParameterValue(false));
+  node->get_parameter(
+    name_ + ".use_incremental_replanning", planner_->use_incremental_replanning_);
 }
 
 void ThetaStarPlanner::cleanup()
@@ -255,6 +260,8 @@ ThetaStarPlanner::dynamicParametersCallback(std::vector<rclcpp::Parameter> param
         use_final_approach_orientation_ = parameter.as_bool();
       } else if (name == name_ + ".allow_unknown") {
         planner_->allow_unknown_ = parameter.as_bool();
+      } else if (name == name_ + ".use_incremental_replanning") {
+        planner_->use_incremental_replanning_ = parameter.as_bool();
       }
     }
   }
@@ -43,22 +43,20 @@ public:
 
   bool uwithinLimits(const int & cx, const int & cy) {return withinLimits(cx, cy);}
 
-  bool uisGoal(const tree_node & this_node) {return isGoal(this_node);}
+  bool uisGoal(const int & cx, const int & cy) {return isGoal(cx, cy);}
 
   void uinitializePosn(int size_inc = 0)
   {
     node_position_.reserve(size_x_ * size_y_); initializePosn(size_inc);
   }
 
-  void uaddIndex(const int & cx, const int & cy) {addIndex(cx, cy, &nodes_data_[0]);}
+  void uaddIndex(const int & cx, const int & cy) {addIndex(cx, cy, 0);}
 
-  tree_node * ugetIndex(const int & cx, const int & cy) {return getIndex(cx, cy);}
-
-  tree_node * test_getIndex() {return &nodes_data_[0];}
+  uint32_t ugetIndex(const int & cx, const int & cy) {return getIndex(cx, cy);}
 
   void uaddToNodesData(const int & id) {addToNodesData(id);}
 
-  void uresetContainers() {nodes_data_.clear(); resetContainers();}
+  void uresetContainers() {resetContainers();}
 
   bool runAlgo(
     std::vector<coordsW> & path,
@@ -105,17 +103,11 @@ TEST(ThetaStarTest, test_theta_star) {
   EXPECT_TRUE(planner_->uwithinLimits(18, 18));
   EXPECT_FALSE(planner_->uwithinLimits(120, 140));
 
-  tree_node n = {g.x, g.y, 120, 0, NULL, false, 20};
-  n.parent_id = &n;
   /// Check if the isGoal function works properly
-  EXPECT_TRUE(planner_->uisGoal(n));           // both (x,y) are the goal coordinates
-  n.x = 25;
-  EXPECT_FALSE(planner_->uisGoal(n));          // only y coordinate matches with that of goal
-  n.x = g.x;
-  n.y = 20;
-  EXPECT_FALSE(planner_->uisGoal(n));          // only x coordinate matches with that of goal
-  n.x = 30;
-  EXPECT_FALSE(planner_->uisGoal(n));          // both (x, y) are different from the goal coordinate
+  EXPECT_TRUE(planner_->uisGoal(g.x, g.y));    // both (x,y) are the goal coordinates
+  EXPECT_FALSE(planner_->uisGoal(25, g.y));    // only y coordinate matches with that of goal
+  EXPECT_FALSE(planner_->uisGoal(g.x, 20));    // only x coordinate matches with that of goal
+  EXPECT_FALSE(planner_->uisGoal(30, 20));     // both (x, y) are different from the goal coordinate
 
   /// Check if the isSafe functions work properly
   EXPECT_TRUE(planner_->isSafe(5, 5));         // cost at this point is 0
@@ -125,8 +117,8 @@ TEST(ThetaStarTest, test_theta_star) {
   coordsM c = {18, 18};
   planner_->uaddToNodesData(0);
   planner_->uaddIndex(c.x, c.y);
-  tree_node * c_node = planner_->ugetIndex(c.x, c.y);
-  EXPECT_EQ(c_node, planner_->test_getIndex());
+  EXPECT_EQ(planner_->ugetIndex(c.x, c.y), 0u);
+  EXPECT_EQ(planner_->ugetIndex(c.x + 1, c.y), NO_NODE);
 
   double sl_cost = 0.0;
   /// Checking for the case where the losCheck should return the value as true
@@ -146,6 +138,58 @@ TEST(ThetaStarTest, test_theta_star) {
   EXPECT_EQ(static_cast<int>(path.size()), 0);
 }
 
+// Tests meant to test the incremental replanning mode and its tree reuse
+TEST(ThetaStarTest, test_theta_star_incremental) {
+  auto planner_ = std::make_unique<test_theta_star>();
+  planner_->costmap_ = new nav2_costmap_2d::Costmap2D(50, 50, 1.0, 0.0, 0.0, 0);
+  planner_->use_incremental_replanning_ = true;
+  geometry_msgs::msg::PoseStamped start, goal;
+  start.pose.position.x = 5;
+  start.pose.position.y = 5;
+  start.pose.orientation.w = 1.0;
+  goal.pose.position.x = 40;
+  goal.pose.position.y = 40;
+  goal.pose.orientation.w = 1.0;
+  planner_->setStartAndGoal(start, goal);
+  std::vector<coordsW> path;
+  /// Check that the first request runs a fresh search and orders the path start to goal
+  EXPECT_TRUE(planner_->runAlgo(path));
+  ASSERT_GT(static_cast<int>(path.size()), 0);
+  EXPECT_NEAR(path.front().x, 5.5, 1e-9);
+  EXPECT_NEAR(path.back().x, 40.5, 1e-9);
+
+  /// Check that a replan to the same goal is served from the retained tree
+  start.pose.position.x = 7;
+  start.pose.position.y = 7;
+  planner_->setStartAndGoal(start, goal);
+  planner_->nodes_opened = 0;
+  path.clear();
+  EXPECT_TRUE(planner_->runAlgo(path));
+  ASSERT_GT(static_cast<int>(path.size()), 0);
+  EXPECT_EQ(planner_->nodes_opened, 0);
+  EXPECT_NEAR(path.front().x, 7.5, 1e-9);
+  EXPECT_NEAR(path.back().x, 40.5, 1e-9);
+
+  /// Check that a costmap delta across the retained path forces a fresh search
+  for (int i = 0; i < 50; i++) {
+    planner_->costmap_->setCost(i, 20, 253);
+  }
+  planner_->costmap_->setCost(0, 20, 0);
+  path.clear();
+  EXPECT_TRUE(planner_->runAlgo(path));
+  ASSERT_GT(static_cast<int>(path.size()), 0);
+  EXPECT_GT(planner_->nodes_opened, 0);
+
+  /// Check that a goal change also invalidates the retained tree
+  goal.pose.position.x = 45;
+  goal.pose.position.y = 45;
+  planner_->setStartAndGoal(start, goal);
+  planner_->nodes_opened = 0;
+  path.clear();
+  EXPECT_TRUE(planner_->runAlgo(path));
+  EXPECT_GT(planner_->nodes_opened, 0);
+}
+
 // Smoke tests meant to detect issues arising from the plugin part rather than the algorithm
 TEST(ThetaStarPlanner, test_theta_star_planner) {
   rclcpp_lifecycle::LifecycleNode::SharedPtr life_node =
@@ -15,7 +15,10 @@
 #ifndef NAV2_UTIL__GEOMETRY_UTILS_HPP_
 #define NAV2_UTIL__GEOMETRY_UTILS_HPP_
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <stdexcept>
 
 #include "geometry_msgs/msg/pose.hpp"
 #include "geometry_msgs/msg/pose_stamped.hpp"
@@ -24,6 +27,7 @@
 #include "geometry_msgs/msg/quaternion.hpp"
 #include "tf2_geometry_msgs/tf2_geometry_msgs.hpp"
 #include "nav_msgs/msg/path.hpp"
+#include "nav2_msgs/msg/compact_path.hpp"
 
 namespace nav2_util
 {
@@ -179,6 +183,137 @@ inline double calculate_path_length(const nav_msgs::msg::Path & path, size_t sta
   return path_length;
 }
 
+/**
+ * @brief Get a yaw angle from a geometry_msgs Quaternion
+ * @param orientation Quaternion to get the yaw angle from
+ * @return double Yaw angle
+ */
+inline double yawFromQuaternion(const geometry_msgs::msg::Quaternion & orientation)
+{
+  return std::atan2(
+    2.0 * (orientation.w * orientation.z + orientation.x * orientation.y),
+    1.0 - 2.0 * (orientation.y * orientation.y + orientation.z * orientation.z));
+}
+
+/**
+ * @brief Compress a path into its compact quantized delta representation.
+ * The header is shared rather than duplicated per pose and each pose after
+ * the first is stored as a fixed-point x/y/yaw delta, dropping z, roll,
+ * pitch and per-pose stamps. When a step between consecutive poses is too
+ * large for the requested resolution, the resolution of the whole message is
+ * widened so every step fits; the effective values are in the message.
+ * @param path Path to compress
+ * @param xy_resolution Requested quantization step of the x/y deltas [m]
+ * @param theta_resolution Requested quantization step of the yaw deltas [rad]
+ * @return nav2_msgs::msg::CompactPath Compact representation of the path
+ */
+inline nav2_msgs::msg::CompactPath compactPath(
+  const nav_msgs::msg::Path & path,
+  double xy_resolution = 0.001,
+  double theta_resolution = 0.001)
+{
+  // Largest delta representable in an int16, with margin for the extra step
+  // that quantization rounding can add
+  constexpr double max_quantized_delta = 32000.0;
+
+  nav2_msgs::msg::CompactPath compact;
+  compact.header = path.header;
+  compact.pose_count = static_cast<uint32_t>(path.poses.size());
+  compact.xy_resolution = xy_resolution;
+  compact.theta_resolution = theta_resolution;
+  if (path.poses.empty()) {
+    return compact;
+  }
+
+  // Widen the resolutions if any step would overflow the quantized deltas
+  for (size_t idx = 1; idx < path.poses.size(); ++idx) {
+    const auto & prev = path.poses[idx - 1].pose;
+    const auto & curr = path.poses[idx].pose;
+    const double max_step = std::max(
+      std::abs(curr.position.x - prev.position.x),
+      std::abs(curr.position.y - prev.position.y));
+    compact.xy_resolution = std::max(
+      compact.xy_resolution, max_step / max_quantized_delta);
+  }
+
+  compact.start_x = path.poses.front().pose.position.x;
+  compact.start_y = path.poses.front().pose.position.y;
+  compact.start_theta = yawFromQuaternion(path.poses.front().pose.orientation);
+
+  compact.delta_x.reserve(path.poses.size() - 1);
+  compact.delta_y.reserve(path.poses.size() - 1);
+  compact.delta_theta.reserve(path.poses.size() - 1);
+
+  // Quantize against the reconstructed previous pose rather than the exact
+  // one, so the quantization error does not accumulate along the path
+  double prev_x = compact.start_x;
+  double prev_y = compact.start_y;
+  double prev_theta = compact.start_theta;
+  for (size_t idx = 1; idx < path.poses.size(); ++idx) {
+    const auto & pose = path.poses[idx].pose;
+    const double dx = std::round((pose.position.x - prev_x) / compact.xy_resolution);
+    const double dy = std::round((pose.position.y - prev_y) / compact.xy_resolution);
+    double dtheta_raw = yawFromQuaternion(pose.orientation) - prev_theta;
+    dtheta_raw = std::atan2(std::sin(dtheta_raw), std::cos(dtheta_raw));
+    const double dtheta = std::round(dtheta_raw / compact.theta_resolution);
+    compact.delta_x.push_back(static_cast<int16_t>(dx));
+    compact.delta_y.push_back(static_cast<int16_t>(dy));
+    compact.delta_theta.push_back(static_cast<int16_t>(dtheta));
+    prev_x += dx * compact.xy_resolution;
+    prev_y += dy * compact.xy_resolution;
+    prev_theta += dtheta * compact.theta_resolution;
+    prev_theta = std::atan2(std::sin(prev_theta), std::cos(prev_theta));
+  }
+
+  return compact;
+}
+
+/**
+ * @brief Expand a compact quantized path back into a nav_msgs Path.
+ * All poses carry the shared header; positions and yaws are reconstructed
+ * to within half a quantization step of the original path.
+ * @param compact Compact path to expand
+ * @return nav_msgs::msg::Path Expanded path
+ * @throw std::invalid_argument if the delta arrays do not match pose_count
+ */
+inline nav_msgs::msg::Path expandPath(const nav2_msgs::msg::CompactPath & compact)
+{
+  const size_t delta_count =
+    compact.pose_count > 0u ? static_cast<size_t>(compact.pose_count) - 1 : 0u;
+  if (compact.delta_x.size() != delta_count ||
+    compact.delta_y.size() != delta_count ||
+    compact.delta_theta.size() != delta_count)
+  {
+    throw std::invalid_argument("Compact path delta arrays do not match its pose count");
+  }
+
+  nav_msgs::msg::Path path;
+  path.header = compact.header;
+  path.poses.resize(compact.pose_count);
+  if (compact.pose_count == 0u) {
+    return path;
+  }
+
+  double x = compact.start_x;
+  double y = compact.start_y;
+  double theta = compact.start_theta;
+  for (size_t idx = 0; idx < path.poses.size(); ++idx) {
+    if (idx > 0) {
+      x += compact.delta_x[idx - 1] * compact.xy_resolution;
+      y += compact.delta_y[idx - 1] * compact.xy_resolution;
+      theta += compact.delta_theta[idx - 1] * compact.theta_resolution;
+      theta = std::atan2(std::sin(theta), std::cos(theta));
+    }
+    auto & pose = path.poses[idx];
+    pose.header = compact.header;
+    pose.pose.position.x = x;
+    pose.pose.position.y = y;
+    pose.pose.orientation = orientationAroundZAxis(theta);
+  }
+
+  return path;
+}
+
 }  // namespace geometry_utils
 }  // namespace nav2_util
 
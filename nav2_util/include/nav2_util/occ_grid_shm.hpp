@@ -0,0 +1,94 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_UTIL__OCC_GRID_SHM_HPP_
+#define NAV2_UTIL__OCC_GRID_SHM_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "nav_msgs/msg/occupancy_grid.hpp"
+
+namespace nav2_util
+{
+
+/**
+ * @brief Copies an occupancy grid into a named POSIX shared-memory segment,
+ * replacing any previous contents of the segment. Readers in other processes
+ * map the single copy of the cell data through SharedOccupancyGrid instead of
+ * each holding a private copy received over a topic.
+ * @param segment_name Segment name, a leading slash and no other slashes
+ * @param grid Grid to publish into the segment
+ * @throw std::runtime_error if the segment could not be created or resized
+ */
+void writeOccGridShm(
+  const std::string & segment_name,
+  const nav_msgs::msg::OccupancyGrid & grid);
+
+/**
+ * @brief Removes a segment created by writeOccGridShm(). Existing mappings
+ * of the segment stay valid until they are released. A missing segment is
+ * not an error.
+ * @param segment_name Name of the segment to remove
+ * @throw std::runtime_error if the segment could not be unlinked
+ */
+void removeOccGridShm(const std::string & segment_name);
+
+/**
+ * @brief Read-only mapping of an occupancy grid published through
+ * writeOccGridShm(). All mappings of one segment share the same physical
+ * pages of cell data; grid() carries the metadata while data() addresses
+ * the cells directly in the segment.
+ */
+class SharedOccupancyGrid
+{
+public:
+  /**
+   * @brief Maps the named segment read-only
+   * @param segment_name Name of the segment to map
+   * @throw std::runtime_error if the segment is missing or does not hold
+   * a grid written by writeOccGridShm()
+   */
+  explicit SharedOccupancyGrid(const std::string & segment_name);
+
+  /**
+   * @brief Releases the mapping
+   */
+  ~SharedOccupancyGrid();
+
+  SharedOccupancyGrid(const SharedOccupancyGrid &) = delete;
+  SharedOccupancyGrid & operator=(const SharedOccupancyGrid &) = delete;
+
+  /**
+   * @brief Metadata of the mapped grid; its data field is left empty
+   */
+  const nav_msgs::msg::OccupancyGrid & grid() const {return grid_;}
+
+  /**
+   * @brief Cell data of the mapped grid, row-major,
+   * info.width * info.height entries
+   */
+  const int8_t * data() const {return data_;}
+
+private:
+  nav_msgs::msg::OccupancyGrid grid_;
+  const int8_t * data_{nullptr};
+  void * mapping_{nullptr};
+  size_t mapping_size_{0};
+};
+
+}  // namespace nav2_util
+
+#endif  // NAV2_UTIL__OCC_GRID_SHM_HPP_
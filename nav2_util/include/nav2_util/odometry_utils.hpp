@@ -16,10 +16,11 @@
 #ifndef NAV2_UTIL__ODOMETRY_UTILS_HPP_
 #define NAV2_UTIL__ODOMETRY_UTILS_HPP_
 
+#include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <chrono>
 #include <memory>
-#include <mutex>
 #include <string>
 #include <deque>
 
@@ -36,7 +37,8 @@ namespace nav2_util
 /**
  * @class OdomSmoother
  * Wrapper for getting smooth odometry readings using a simple moving avergae.
- * Subscribes to the topic with a mutex.
+ * The smoothed twist is published through a sequence lock, so readers never
+ * block the odom callback and the callback never blocks readers.
  */
 class OdomSmoother
 {
@@ -68,13 +70,13 @@ public:
    * @brief Get twist msg from smoother
    * @return twist Twist msg
    */
-  inline geometry_msgs::msg::Twist getTwist() {return vel_smooth_.twist;}
+  inline geometry_msgs::msg::Twist getTwist() {return readTwist().twist;}
 
   /**
    * @brief Get twist stamped msg from smoother
    * @return twist TwistStamped msg
    */
-  inline geometry_msgs::msg::TwistStamped getTwistStamped() {return vel_smooth_;}
+  inline geometry_msgs::msg::TwistStamped getTwistStamped() {return readTwist();}
 
 protected:
   /**
@@ -88,10 +90,21 @@ protected:
    */
   void updateState();
 
+  /**
+   * @brief Copy out a consistent snapshot of the smoothed twist,
+   * retrying if the odom callback published while reading
+   * @return twist TwistStamped msg
+   */
+  geometry_msgs::msg::TwistStamped readTwist() const;
+
   rclcpp::Subscription<nav_msgs::msg::Odometry>::SharedPtr odom_sub_;
   nav_msgs::msg::Odometry odom_cumulate_;
+
+  // History and running sum are only touched by the odom callback; the
+  // smoothed result is handed to readers through a sequence lock on
+  // vel_smooth_, odd while the callback is writing it
   geometry_msgs::msg::TwistStamped vel_smooth_;
-  std::mutex odom_mutex_;
+  std::atomic<uint32_t> vel_seq_{0};
 
   rclcpp::Duration odom_history_duration_;
   std::deque<nav_msgs::msg::Odometry> odom_history_;
@@ -0,0 +1,97 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_UTIL__PARAMETER_TRANSACTION_HPP_
+#define NAV2_UTIL__PARAMETER_TRANSACTION_HPP_
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+
+namespace nav2_util
+{
+
+/// A set of parameter values for a group of nodes, keyed by fully qualified node name
+/**
+ * Represents one mission profile: everything that has to change on each node
+ * to switch the stack over, e.g. critic weights on the controller server and
+ * inflation radii on the costmap nodes.
+ */
+using ParameterSnapshot = std::map<std::string, std::vector<rclcpp::Parameter>>;
+
+/// The outcome of applying a parameter snapshot
+struct ParameterTransactionResult
+{
+  /// True only if every node accepted its full parameter list
+  bool successful{true};
+
+  /// Rejection reason or service failure per failed node, keyed by node name
+  std::map<std::string, std::string> failed_nodes;
+};
+
+/// Capture the current values of all parameters on the given nodes
+/**
+ * Queries each node's parameter services, issuing all requests up front so
+ * the captures overlap rather than run back to back. The result can be
+ * applied later with apply_parameter_snapshot() to return the group of nodes
+ * to this configuration.
+ *
+ * \param[in] node A node to issue the service requests from. It must not be
+ *            spun by an executor elsewhere; see generate_internal_node().
+ * \param[in] node_names A vector of fully qualified node names to capture.
+ * \param[in] timeout The maximum time to wait for all captures together.
+ * \return The captured parameter values per node
+ * \throw std::runtime_error if a node's parameter services are unavailable
+ *        or the timeout expires
+ */
+ParameterSnapshot capture_parameter_snapshot(
+  const rclcpp::Node::SharedPtr & node,
+  const std::vector<std::string> & node_names,
+  const std::chrono::milliseconds timeout = std::chrono::milliseconds(2000));
+
+/// Apply a parameter snapshot to its nodes as one bounded-latency operation
+/**
+ * Each node receives its full parameter list in a single atomic set request,
+ * so its dynamic parameter callback runs exactly once per profile switch
+ * instead of once per parameter. The requests to all nodes are issued up
+ * front and awaited together, so the switch completes within roughly one
+ * service round trip rather than one per parameter.
+ *
+ * Atomicity is per node: ROS 2 has no cross-node commit, so a node that
+ * rejects its list leaves the other nodes on the new profile. Pass
+ * rollback_on_failure to restore the prior values of the touched parameters
+ * on every node when any of them fails, at the cost of one extra capture
+ * round trip before the apply.
+ *
+ * \param[in] node A node to issue the service requests from. It must not be
+ *            spun by an executor elsewhere; see generate_internal_node().
+ * \param[in] snapshot The parameter values to apply, per node.
+ * \param[in] timeout The maximum time to wait for the whole transaction,
+ *            including the capture and restore passes when rolling back.
+ * \param[in] rollback_on_failure Restore the prior values on all nodes if
+ *            any node fails to apply its list.
+ * \return The outcome, listing any nodes that failed and why
+ */
+ParameterTransactionResult apply_parameter_snapshot(
+  const rclcpp::Node::SharedPtr & node,
+  const ParameterSnapshot & snapshot,
+  const std::chrono::milliseconds timeout = std::chrono::milliseconds(2000),
+  const bool rollback_on_failure = false);
+
+}  // namespace nav2_util
+
+#endif  // NAV2_UTIL__PARAMETER_TRANSACTION_HPP_
@@ -19,6 +19,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "geometry_msgs/msg/pose_stamped.hpp"
 #include "geometry_msgs/msg/twist.hpp"
@@ -62,6 +63,23 @@ bool transformPoseInTargetFrame(
   tf2_ros::Buffer & tf_buffer, const std::string target_frame,
   const double transform_timeout = 0.1);
 
+/**
+* @brief transform an array of poses into a target frame, sharing one
+* transform lookup across every consecutive run of poses with the same
+* header rather than looking up per pose
+* @param input_poses Poses to transform
+* @param transformed_poses Output transformations
+* @param tf_buffer TF buffer to use for the transformation
+* @param target_frame Frame to transform into
+* @param transform_timeout TF Timeout to use for transformation
+* @return bool Whether all poses could be transformed successfully
+*/
+bool transformPoses(
+  const std::vector<geometry_msgs::msg::PoseStamped> & input_poses,
+  std::vector<geometry_msgs::msg::PoseStamped> & transformed_poses,
+  tf2_ros::Buffer & tf_buffer, const std::string target_frame,
+  const double transform_timeout = 0.1);
+
 /**
  * @brief Obtains a transform from source_frame_id -> to target_frame_id
  * @param source_frame_id Source frame ID to convert from
@@ -15,6 +15,8 @@
 #ifndef NAV2_UTIL__SERVICE_CLIENT_HPP_
 #define NAV2_UTIL__SERVICE_CLIENT_HPP_
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 
 #include "rclcpp/rclcpp.hpp"
@@ -34,10 +36,13 @@ public:
   * @brief A constructor
   * @param service_name name of the service to call
   * @param provided_node Node to create the service client off of
+  * @param warmup_timeout Bounded time to wait for the server at construction,
+  * paying the discovery latency up front so the first invoke() does not
   */
   explicit ServiceClient(
     const std::string & service_name,
-    const NodeT & provided_node)
+    const NodeT & provided_node,
+    const std::chrono::nanoseconds warmup_timeout = std::chrono::nanoseconds(0))
   : service_name_(service_name), node_(provided_node)
   {
     callback_group_ = node_->create_callback_group(
@@ -48,6 +53,13 @@ public:
       service_name,
       rclcpp::SystemDefaultsQoS(),
       callback_group_);
+    if (warmup_timeout > std::chrono::nanoseconds(0) &&
+      !client_->wait_for_service(warmup_timeout))
+    {
+      RCLCPP_DEBUG(
+        node_->get_logger(), "%s service client: service did not appear while warming up",
+        service_name_.c_str());
+    }
   }
 
   using RequestType = typename ServiceT::Request;
@@ -56,18 +68,35 @@ public:
   /**
   * @brief Invoke the service and block until completed or timed out
   * @param request The request object to call the service using
-  * @param timeout Maximum timeout to wait for, default infinite
+  * @param timeout Deadline budget over the service wait and the call
+  * together, failing fast when the server is absent, default infinite
   * @return Response A pointer to the service response from the request
   */
   typename ResponseType::SharedPtr invoke(
     typename RequestType::SharedPtr & request,
     const std::chrono::nanoseconds timeout = std::chrono::nanoseconds(-1))
   {
-    while (!client_->wait_for_service(std::chrono::seconds(1))) {
+    const bool bounded = timeout >= std::chrono::nanoseconds(0);
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    auto remaining = [&deadline]() {
+        return std::max(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+            deadline - std::chrono::steady_clock::now()),
+          std::chrono::nanoseconds(0));
+      };
+
+    while (!client_->wait_for_service(
+        bounded ? std::min(remaining(), std::chrono::nanoseconds(std::chrono::seconds(1))) :
+        std::chrono::nanoseconds(std::chrono::seconds(1))))
+    {
       if (!rclcpp::ok()) {
         throw std::runtime_error(
                 service_name_ + " service client: interrupted while waiting for service");
       }
+      if (bounded && remaining() == std::chrono::nanoseconds(0)) {
+        throw std::runtime_error(
+                service_name_ + " service client: service is not available within timeout");
+      }
       RCLCPP_INFO(
         node_->get_logger(), "%s service client: waiting for service to appear...",
         service_name_.c_str());
@@ -78,7 +107,8 @@ public:
       service_name_.c_str());
     auto future_result = client_->async_send_request(request);
 
-    if (callback_group_executor_.spin_until_future_complete(future_result, timeout) !=
+    if (callback_group_executor_.spin_until_future_complete(
+        future_result, bounded ? remaining() : timeout) !=
       rclcpp::FutureReturnCode::SUCCESS)
     {
       // Pending request must be manually cleaned up if execution is interrupted or timed out
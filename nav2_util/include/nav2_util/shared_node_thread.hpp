@@ -0,0 +1,71 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_UTIL__SHARED_NODE_THREAD_HPP_
+#define NAV2_UTIL__SHARED_NODE_THREAD_HPP_
+
+#include <memory>
+
+#include "rclcpp/rclcpp.hpp"
+
+namespace nav2_util
+{
+
+class SharedExecutorRunner;
+
+/**
+ * @class nav2_util::SharedNodeThread
+ * @brief Processes a node's callbacks on an executor thread shared by all
+ * SharedNodeThread instances in the process. A drop-in alternative to
+ * NodeThread for mostly-idle helper nodes: instead of one dedicated spinner
+ * thread per node, all opted-in nodes multiplex onto a single background
+ * executor, reducing idle wakeups and context switches. Use NodeThread
+ * instead when a node's callbacks are long-running or latency-critical,
+ * since callbacks of all sharing nodes execute sequentially.
+ */
+class SharedNodeThread
+{
+public:
+  /**
+   * @brief Adds the node to the process-wide shared executor thread,
+   * starting it if this is the first opted-in node
+   * @param node_base Interface to Node to spin on the shared thread
+   */
+  explicit SharedNodeThread(
+    rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base);
+
+  /**
+   * @brief Adds the node to the process-wide shared executor thread,
+   * starting it if this is the first opted-in node
+   * @param node Node pointer to spin on the shared thread
+   */
+  template<typename NodeT>
+  explicit SharedNodeThread(NodeT node)
+  : SharedNodeThread(node->get_node_base_interface())
+  {}
+
+  /**
+   * @brief A destructor, removing the node from the shared executor thread.
+   * The thread is shut down when the last opted-in node is removed.
+   */
+  ~SharedNodeThread();
+
+protected:
+  rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_;
+  std::shared_ptr<SharedExecutorRunner> runner_;
+};
+
+}  // namespace nav2_util
+
+#endif  // NAV2_UTIL__SHARED_NODE_THREAD_HPP_
@@ -15,6 +15,7 @@
 #ifndef NAV2_UTIL__SIMPLE_ACTION_SERVER_HPP_
 #define NAV2_UTIL__SIMPLE_ACTION_SERVER_HPP_
 
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -135,6 +136,24 @@ public:
       executor_->add_callback_group(callback_group_, node_base_interface_);
       executor_thread_ = std::make_unique<nav2_util::NodeThread>(executor_);
     }
+    worker_thread_ = std::thread(&SimpleActionServer::worker, this);
+  }
+
+  /**
+   * @brief A destructor for SimpleActionServer, shutting down the worker thread.
+   * Blocks until a goal being executed has finished, as the previous
+   * per-goal async execution did.
+   */
+  ~SimpleActionServer()
+  {
+    {
+      std::lock_guard<std::mutex> lock(worker_mutex_);
+      worker_shutdown_ = true;
+    }
+    worker_cv_.notify_one();
+    if (worker_thread_.joinable()) {
+      worker_thread_.join();
+    }
   }
 
   /**
@@ -220,13 +239,46 @@ public:
 
       current_handle_ = handle;
 
-      // Return quickly to avoid blocking the executor, so spin up a new thread
+      // Return quickly to avoid blocking the executor,
+      // so hand the goal off to the persistent worker thread
       debug_msg("Executing goal asynchronously.");
-      execution_future_ = std::async(
-        std::launch::async, [this]() {
-          setSoftRealTimePriority();
-          work();
-        });
+      dispatch_to_worker();
+    }
+  }
+
+  /**
+   * @brief Long-running loop of the worker thread. Goals are executed on this
+   * single persistent thread rather than spawning one per accepted goal, so
+   * accepting a goal when idle is only a notification, not a thread creation
+   */
+  void worker()
+  {
+    setSoftRealTimePriority();
+    std::unique_lock<std::mutex> lock(worker_mutex_);
+    while (!worker_shutdown_) {
+      worker_cv_.wait(lock, [this]() {return work_available_ || worker_shutdown_;});
+      if (worker_shutdown_) {
+        break;
+      }
+      work_available_ = false;
+      lock.unlock();
+
+      while (true) {
+        work();
+
+        // Only report idle while holding update_mutex_, so a goal accepted as
+        // work() was winding down is picked up here rather than left pending
+        std::lock_guard<std::recursive_mutex> update_lock(update_mutex_);
+        if (rclcpp::ok() && !stop_execution_ && is_active(pending_handle_)) {
+          debug_msg("Executing a late pending handle on the worker thread.");
+          accept_pending_goal();
+          continue;
+        }
+        work_promise_.set_value();
+        break;
+      }
+
+      lock.lock();
     }
   }
 
@@ -252,7 +304,7 @@ public:
       std::lock_guard<std::recursive_mutex> lock(update_mutex_);
 
       if (stop_execution_) {
-        warn_msg("Stopping the thread per request.");
+        warn_msg("Stopping the work loop per request.");
         terminate_all();
         if (completion_callback_) {completion_callback_();}
         break;
@@ -535,6 +587,26 @@ protected:
   bool stop_execution_{false};
   bool use_realtime_prioritization_{false};
 
+  std::thread worker_thread_;
+  std::mutex worker_mutex_;
+  std::condition_variable worker_cv_;
+  std::promise<void> work_promise_;
+  bool work_available_{false};
+  bool worker_shutdown_{false};
+
+  /**
+   * @brief Wake up the worker thread to execute the current goal. Must be
+   * called with update_mutex_ held and the worker idle
+   */
+  void dispatch_to_worker()
+  {
+    std::lock_guard<std::mutex> lock(worker_mutex_);
+    work_promise_ = std::promise<void>();
+    execution_future_ = work_promise_.get_future();
+    work_available_ = true;
+    worker_cv_.notify_one();
+  }
+
   mutable std::recursive_mutex update_mutex_;
   bool server_active_{false};
   bool preempt_requested_{false};
@@ -0,0 +1,63 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_UTIL__TRACE_HPP_
+#define NAV2_UTIL__TRACE_HPP_
+
+#include <cstdint>
+
+/**
+ * Lightweight tracing surface for correlating work across Nav2 subsystems.
+ *
+ * Tracepoints compile to nothing unless the tree is built with
+ * -DNAV2_TRACING_ENABLED=On (see nav2_package()), so instrumented hot paths
+ * carry no overhead in regular builds. When tracing is compiled in, every
+ * tracepoint calls through a process-wide sink registered at startup --
+ * typically a thin shim forwarding to LTTng / ros2_tracing userspace
+ * tracepoints -- passing the subsystem name, the event name and a
+ * correlation id that lets offline tooling stitch causal chains, e.g. a
+ * cmd_vel back to the costmap update it was computed from.
+ */
+
+namespace nav2_util
+{
+namespace trace
+{
+
+/// Sink invoked by compiled-in tracepoints; must be safe to call concurrently
+typedef void (* TraceFn)(
+  const char * subsystem, const char * event, uint64_t correlation_id);
+
+/**
+ * @brief Register the process-wide tracepoint sink, nullptr to unregister
+ */
+void setTraceFunction(TraceFn fn);
+
+/**
+ * @brief Forward one event to the registered sink, if any
+ */
+void emit(const char * subsystem, const char * event, uint64_t correlation_id);
+
+}  // namespace trace
+}  // namespace nav2_util
+
+#ifdef NAV2_TRACING_ENABLED
+#define NAV2_TRACE(subsystem, event, correlation_id) \
+  nav2_util::trace::emit(subsystem, event, static_cast<uint64_t>(correlation_id))
+#else
+// Arguments are not evaluated, disabled tracepoints cost nothing
+#define NAV2_TRACE(subsystem, event, correlation_id) static_cast<void>(0)
+#endif
+
+#endif  // NAV2_UTIL__TRACE_HPP_
@@ -106,8 +106,24 @@ public:
     if (is_stamped_) {
       twist_stamped_pub_->publish(std::move(velocity));
     } else {
-      auto twist_msg = std::make_unique<geometry_msgs::msg::Twist>(velocity->twist);
-      twist_pub_->publish(std::move(twist_msg));
+      // publish the inner twist by reference rather than allocating a
+      // converted message for every velocity command
+      twist_pub_->publish(velocity->twist);
+    }
+  }
+
+  /**
+  * @brief Publish by const reference, letting rclcpp use a loaned message when
+  * the middleware supports it, so steady-state publishing allocates nothing
+  * at this layer
+  * @param velocity The message to publish
+  */
+  void publish(const geometry_msgs::msg::TwistStamped & velocity)
+  {
+    if (is_stamped_) {
+      twist_stamped_pub_->publish(velocity);
+    } else {
+      twist_pub_->publish(velocity.twist);
     }
   }
 
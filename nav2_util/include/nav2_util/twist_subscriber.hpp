@@ -20,9 +20,11 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "geometry_msgs/msg/twist.hpp"
 #include "geometry_msgs/msg/twist_stamped.hpp"
+#include "std_msgs/msg/header.hpp"
 #include "rclcpp/parameter_service.hpp"
 #include "rclcpp/rclcpp.hpp"
 #include "rclcpp/qos.hpp"
@@ -34,6 +36,13 @@
 namespace nav2_util
 {
 
+/**
+ * @brief Tag type selecting the TwistSubscriber constructor that adapts
+ * unstamped input into the stamped callback, see TwistSubscriber
+ */
+struct adapt_unstamped_t {};
+inline constexpr adapt_unstamped_t adapt_unstamped{};
+
 /**
  * @class nav2_util::TwistSubscriber
  * @brief A simple wrapper on a Twist subscriber that receives either
@@ -138,13 +147,84 @@ public:
     }
   }
 
+  /**
+  * @brief A constructor that delivers every command through the stamped callback
+  *
+  * When enable_stamped_cmd_vel is false, the Twist subscription adapts each
+  * message in place into a pooled TwistStamped (empty header) before invoking
+  * the callback, so no per-message conversion allocation happens on the
+  * cmd_vel path. A pooled message is not reused while the callback's receiver
+  * still holds a reference to it, so retaining the pointer is safe.
+  *
+  * @param node The node to add the subscriber to
+  * @param topic The subscriber topic name
+  * @param qos The subscriber quality of service
+  * @param TwistStampedCallback The subscriber callback for TwistStamped messages
+  */
+  template<typename TwistStampedCallbackT>
+  explicit TwistSubscriber(
+    nav2_util::LifecycleNode::SharedPtr node,
+    const std::string & topic,
+    const rclcpp::QoS & qos,
+    adapt_unstamped_t,
+    TwistStampedCallbackT && TwistStampedCallback
+  )
+  {
+    nav2_util::declare_parameter_if_not_declared(
+      node, "enable_stamped_cmd_vel",
+      rclcpp::ParameterValue(false));
+    node->get_parameter("enable_stamped_cmd_vel", is_stamped_);
+    if (is_stamped_) {
+      twist_stamped_sub_ = node->create_subscription<geometry_msgs::msg::TwistStamped>(
+        topic,
+        qos,
+        std::forward<TwistStampedCallbackT>(TwistStampedCallback));
+    } else {
+      twist_sub_ = node->create_subscription<geometry_msgs::msg::Twist>(
+        topic,
+        qos,
+        [this, callback = std::forward<TwistStampedCallbackT>(TwistStampedCallback)](
+          geometry_msgs::msg::Twist::SharedPtr msg) {
+          auto twist_stamped = acquireStampedMessage();
+          twist_stamped->header = std_msgs::msg::Header();
+          twist_stamped->twist = *msg;
+          callback(twist_stamped);
+        });
+    }
+  }
+
 protected:
+  /**
+  * @brief Get a message from the pool that nothing downstream still references,
+  * growing the pool if necessary
+  *
+  * Subscription callbacks for a single subscription never run concurrently,
+  * so the pool needs no locking.
+  */
+  geometry_msgs::msg::TwistStamped::SharedPtr acquireStampedMessage()
+  {
+    for (auto & pooled : stamped_pool_) {
+      if (pooled.use_count() == 1) {
+        return pooled;
+      }
+    }
+    if (stamped_pool_.size() < max_pool_size_) {
+      stamped_pool_.push_back(std::make_shared<geometry_msgs::msg::TwistStamped>());
+      return stamped_pool_.back();
+    }
+    // every pooled message is still held downstream, fall back to a fresh one
+    return std::make_shared<geometry_msgs::msg::TwistStamped>();
+  }
   //! @brief The user-configured value for ROS parameter enable_stamped_cmd_vel
   bool is_stamped_{false};
   //! @brief The subscription when using Twist
   rclcpp::Subscription<geometry_msgs::msg::Twist>::SharedPtr twist_sub_ {nullptr};
   //! @brief The subscription when using TwistStamped
   rclcpp::Subscription<geometry_msgs::msg::TwistStamped>::SharedPtr twist_stamped_sub_ {nullptr};
+  //! @brief Reusable stamped messages for the unstamped-adapting constructor
+  std::vector<geometry_msgs::msg::TwistStamped::SharedPtr> stamped_pool_;
+  //! @brief Cap on pooled messages retained downstream at once
+  static constexpr size_t max_pool_size_{8};
 };
 
 
@@ -0,0 +1,169 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_util/occ_grid_shm.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace nav2_util
+{
+
+namespace
+{
+
+// On-segment layout: this header, frame_id characters, then the cell data
+struct OccGridShmHeader
+{
+  uint32_t magic;
+  uint32_t width;
+  uint32_t height;
+  uint32_t frame_id_length;
+  int32_t stamp_sec;
+  uint32_t stamp_nanosec;
+  double resolution;
+  double origin_position[3];
+  double origin_orientation[4];
+};
+
+constexpr uint32_t occ_grid_shm_magic = 0x4e324f47u;  // "N2OG"
+
+[[noreturn]] void throwErrno(const std::string & what, const std::string & segment_name)
+{
+  throw std::runtime_error(
+          what + " shared-memory segment \"" + segment_name + "\": " + strerror(errno));
+}
+
+}  // namespace
+
+void writeOccGridShm(
+  const std::string & segment_name,
+  const nav_msgs::msg::OccupancyGrid & grid)
+{
+  const size_t size =
+    sizeof(OccGridShmHeader) + grid.header.frame_id.size() + grid.data.size();
+
+  int fd = shm_open(segment_name.c_str(), O_CREAT | O_RDWR, 0644);
+  if (fd < 0) {
+    throwErrno("Failed to create", segment_name);
+  }
+  if (ftruncate(fd, size) < 0) {
+    close(fd);
+    throwErrno("Failed to resize", segment_name);
+  }
+  void * mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mem == MAP_FAILED) {
+    throwErrno("Failed to map", segment_name);
+  }
+
+  OccGridShmHeader * header = static_cast<OccGridShmHeader *>(mem);
+  header->width = grid.info.width;
+  header->height = grid.info.height;
+  header->frame_id_length = static_cast<uint32_t>(grid.header.frame_id.size());
+  header->stamp_sec = grid.header.stamp.sec;
+  header->stamp_nanosec = grid.header.stamp.nanosec;
+  header->resolution = grid.info.resolution;
+  header->origin_position[0] = grid.info.origin.position.x;
+  header->origin_position[1] = grid.info.origin.position.y;
+  header->origin_position[2] = grid.info.origin.position.z;
+  header->origin_orientation[0] = grid.info.origin.orientation.x;
+  header->origin_orientation[1] = grid.info.origin.orientation.y;
+  header->origin_orientation[2] = grid.info.origin.orientation.z;
+  header->origin_orientation[3] = grid.info.origin.orientation.w;
+
+  char * payload = static_cast<char *>(mem) + sizeof(OccGridShmHeader);
+  memcpy(payload, grid.header.frame_id.c_str(), grid.header.frame_id.size());
+  if (!grid.data.empty()) {
+    memcpy(payload + grid.header.frame_id.size(), grid.data.data(), grid.data.size());
+  }
+
+  // Written last: readers racing the very first write see an incomplete
+  // segment as invalid instead of as a truncated grid
+  header->magic = occ_grid_shm_magic;
+
+  munmap(mem, size);
+}
+
+void removeOccGridShm(const std::string & segment_name)
+{
+  if (shm_unlink(segment_name.c_str()) < 0 && errno != ENOENT) {
+    throwErrno("Failed to remove", segment_name);
+  }
+}
+
+SharedOccupancyGrid::SharedOccupancyGrid(const std::string & segment_name)
+{
+  int fd = shm_open(segment_name.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    throwErrno("Failed to open", segment_name);
+  }
+  struct stat st;
+  if (fstat(fd, &st) < 0) {
+    close(fd);
+    throwErrno("Failed to stat", segment_name);
+  }
+  mapping_size_ = static_cast<size_t>(st.st_size);
+  mapping_ = mmap(nullptr, mapping_size_, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping_ == MAP_FAILED) {
+    mapping_ = nullptr;
+    throwErrno("Failed to map", segment_name);
+  }
+
+  const OccGridShmHeader * header = static_cast<const OccGridShmHeader *>(mapping_);
+  if (mapping_size_ < sizeof(OccGridShmHeader) ||
+    header->magic != occ_grid_shm_magic ||
+    mapping_size_ != sizeof(OccGridShmHeader) + header->frame_id_length +
+    static_cast<size_t>(header->width) * header->height)
+  {
+    munmap(mapping_, mapping_size_);
+    mapping_ = nullptr;
+    throw std::runtime_error(
+            "Shared-memory segment \"" + segment_name +
+            "\" does not hold a valid occupancy grid");
+  }
+
+  const char * payload = static_cast<const char *>(mapping_) + sizeof(OccGridShmHeader);
+  grid_.header.frame_id = std::string(payload, header->frame_id_length);
+  grid_.header.stamp.sec = header->stamp_sec;
+  grid_.header.stamp.nanosec = header->stamp_nanosec;
+  grid_.info.resolution = header->resolution;
+  grid_.info.width = header->width;
+  grid_.info.height = header->height;
+  grid_.info.origin.position.x = header->origin_position[0];
+  grid_.info.origin.position.y = header->origin_position[1];
+  grid_.info.origin.position.z = header->origin_position[2];
+  grid_.info.origin.orientation.x = header->origin_orientation[0];
+  grid_.info.origin.orientation.y = header->origin_orientation[1];
+  grid_.info.origin.orientation.z = header->origin_orientation[2];
+  grid_.info.origin.orientation.w = header->origin_orientation[3];
+  data_ = reinterpret_cast<const int8_t *>(payload + header->frame_id_length);
+}
+
+SharedOccupancyGrid::~SharedOccupancyGrid()
+{
+  if (mapping_) {
+    munmap(mapping_, mapping_size_);
+  }
+}
+
+}  // namespace nav2_util
@@ -65,8 +65,6 @@ OdomSmoother::OdomSmoother(
 
 void OdomSmoother::odomCallback(const nav_msgs::msg::Odometry::SharedPtr msg)
 {
-  std::lock_guard<std::mutex> lock(odom_mutex_);
-
   // update cumulated odom only if history is not empty
   if (!odom_history_.empty()) {
     // to store current time
@@ -109,13 +107,36 @@ void OdomSmoother::updateState()
   odom_cumulate_.twist.twist.angular.y += odom.twist.twist.angular.y;
   odom_cumulate_.twist.twist.angular.z += odom.twist.twist.angular.z;
 
-  vel_smooth_.header = odom.header;
-  vel_smooth_.twist.linear.x = odom_cumulate_.twist.twist.linear.x / odom_history_.size();
-  vel_smooth_.twist.linear.y = odom_cumulate_.twist.twist.linear.y / odom_history_.size();
-  vel_smooth_.twist.linear.z = odom_cumulate_.twist.twist.linear.z / odom_history_.size();
-  vel_smooth_.twist.angular.x = odom_cumulate_.twist.twist.angular.x / odom_history_.size();
-  vel_smooth_.twist.angular.y = odom_cumulate_.twist.twist.angular.y / odom_history_.size();
-  vel_smooth_.twist.angular.z = odom_cumulate_.twist.twist.angular.z / odom_history_.size();
+  geometry_msgs::msg::TwistStamped vel;
+  vel.header = odom.header;
+  vel.twist.linear.x = odom_cumulate_.twist.twist.linear.x / odom_history_.size();
+  vel.twist.linear.y = odom_cumulate_.twist.twist.linear.y / odom_history_.size();
+  vel.twist.linear.z = odom_cumulate_.twist.twist.linear.z / odom_history_.size();
+  vel.twist.angular.x = odom_cumulate_.twist.twist.angular.x / odom_history_.size();
+  vel.twist.angular.y = odom_cumulate_.twist.twist.angular.y / odom_history_.size();
+  vel.twist.angular.z = odom_cumulate_.twist.twist.angular.z / odom_history_.size();
+
+  // Sequence lock write: the sequence is odd while vel_smooth_ is being
+  // updated, so a reader copying it concurrently will retry
+  const uint32_t seq = vel_seq_.load(std::memory_order_relaxed);
+  vel_seq_.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  vel_smooth_ = vel;
+  std::atomic_thread_fence(std::memory_order_release);
+  vel_seq_.store(seq + 2, std::memory_order_relaxed);
+}
+
+geometry_msgs::msg::TwistStamped OdomSmoother::readTwist() const
+{
+  geometry_msgs::msg::TwistStamped vel;
+  uint32_t seq_before, seq_after;
+  do {
+    seq_before = vel_seq_.load(std::memory_order_acquire);
+    vel = vel_smooth_;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    seq_after = vel_seq_.load(std::memory_order_relaxed);
+  } while (seq_before != seq_after || (seq_before & 1u));
+  return vel;
 }
 
 }  // namespace nav2_util
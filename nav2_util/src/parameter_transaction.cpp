@@ -0,0 +1,206 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rcl_interfaces/srv/list_parameters.hpp"
+
+#include "nav2_util/parameter_transaction.hpp"
+
+namespace nav2_util
+{
+
+using std::chrono::steady_clock;
+
+/// Time left until the deadline, clamped at zero so waits cannot go negative
+static std::chrono::milliseconds time_left(const steady_clock::time_point & deadline)
+{
+  auto left =
+    std::chrono::duration_cast<std::chrono::milliseconds>(deadline - steady_clock::now());
+  return left > std::chrono::milliseconds(0) ? left : std::chrono::milliseconds(0);
+}
+
+template<typename FutureT>
+static void wait_for_reply(
+  const rclcpp::Node::SharedPtr & node,
+  FutureT & future,
+  const steady_clock::time_point & deadline,
+  const std::string & node_name)
+{
+  if (rclcpp::spin_until_future_complete(node, future, time_left(deadline)) !=
+    rclcpp::FutureReturnCode::SUCCESS)
+  {
+    throw std::runtime_error("Timed out waiting on parameter services of node " + node_name);
+  }
+}
+
+ParameterSnapshot capture_parameter_snapshot(
+  const rclcpp::Node::SharedPtr & node,
+  const std::vector<std::string> & node_names,
+  const std::chrono::milliseconds timeout)
+{
+  const auto deadline = steady_clock::now() + timeout;
+
+  // Issue every list request before waiting on any reply, so the captures
+  // overlap across nodes instead of paying one round trip per node
+  std::vector<std::shared_ptr<rclcpp::AsyncParametersClient>> clients;
+  std::vector<std::shared_future<rcl_interfaces::msg::ListParametersResult>> list_futures;
+  for (const auto & node_name : node_names) {
+    auto client = std::make_shared<rclcpp::AsyncParametersClient>(node, node_name);
+    if (!client->wait_for_service(time_left(deadline))) {
+      throw std::runtime_error("Parameter services unavailable for node " + node_name);
+    }
+    list_futures.push_back(
+      client->list_parameters(
+        {}, rcl_interfaces::srv::ListParameters::Request::DEPTH_RECURSIVE));
+    clients.push_back(client);
+  }
+
+  std::vector<std::shared_future<std::vector<rclcpp::Parameter>>> get_futures(node_names.size());
+  for (unsigned int i = 0; i != node_names.size(); ++i) {
+    wait_for_reply(node, list_futures[i], deadline, node_names[i]);
+    get_futures[i] = clients[i]->get_parameters(list_futures[i].get().names);
+  }
+
+  ParameterSnapshot snapshot;
+  for (unsigned int i = 0; i != node_names.size(); ++i) {
+    wait_for_reply(node, get_futures[i], deadline, node_names[i]);
+    snapshot[node_names[i]] = get_futures[i].get();
+  }
+
+  return snapshot;
+}
+
+/// Capture only the parameters a snapshot touches, for restoring them later
+static ParameterSnapshot capture_prior_values(
+  const rclcpp::Node::SharedPtr & node,
+  const ParameterSnapshot & snapshot,
+  const steady_clock::time_point & deadline)
+{
+  std::vector<std::shared_ptr<rclcpp::AsyncParametersClient>> clients;
+  std::vector<std::shared_future<std::vector<rclcpp::Parameter>>> get_futures;
+  std::vector<std::string> node_names;
+  for (const auto & entry : snapshot) {
+    auto client = std::make_shared<rclcpp::AsyncParametersClient>(node, entry.first);
+    if (!client->wait_for_service(time_left(deadline))) {
+      throw std::runtime_error("Parameter services unavailable for node " + entry.first);
+    }
+    std::vector<std::string> names;
+    names.reserve(entry.second.size());
+    for (const auto & parameter : entry.second) {
+      names.push_back(parameter.get_name());
+    }
+    get_futures.push_back(client->get_parameters(names));
+    clients.push_back(client);
+    node_names.push_back(entry.first);
+  }
+
+  ParameterSnapshot prior;
+  for (unsigned int i = 0; i != node_names.size(); ++i) {
+    wait_for_reply(node, get_futures[i], deadline, node_names[i]);
+    // Parameters the snapshot introduces have no prior value to restore,
+    // so drop the unset placeholders the service returns for them
+    std::vector<rclcpp::Parameter> values;
+    for (const auto & parameter : get_futures[i].get()) {
+      if (parameter.get_type() != rclcpp::ParameterType::PARAMETER_NOT_SET) {
+        values.push_back(parameter);
+      }
+    }
+    prior[node_names[i]] = std::move(values);
+  }
+
+  return prior;
+}
+
+ParameterTransactionResult apply_parameter_snapshot(
+  const rclcpp::Node::SharedPtr & node,
+  const ParameterSnapshot & snapshot,
+  const std::chrono::milliseconds timeout,
+  const bool rollback_on_failure)
+{
+  const auto deadline = steady_clock::now() + timeout;
+  ParameterTransactionResult result;
+
+  // The prior values must be in hand before anything changes, or a partial
+  // failure could not be rolled back; abort without touching any node if
+  // they cannot be captured
+  ParameterSnapshot prior;
+  if (rollback_on_failure) {
+    try {
+      prior = capture_prior_values(node, snapshot, deadline);
+    } catch (const std::runtime_error & e) {
+      result.successful = false;
+      for (const auto & entry : snapshot) {
+        result.failed_nodes[entry.first] = std::string("Transaction aborted: ") + e.what();
+      }
+      return result;
+    }
+  }
+
+  // One atomic set request per node, all issued before waiting on any reply:
+  // each node coalesces its dynamic parameter callback work into a single
+  // invocation and the nodes process their requests concurrently
+  struct PendingApply
+  {
+    std::string node_name;
+    std::shared_ptr<rclcpp::AsyncParametersClient> client;
+    std::shared_future<rcl_interfaces::msg::SetParametersResult> future;
+  };
+  std::vector<PendingApply> pending;
+  for (const auto & entry : snapshot) {
+    auto client = std::make_shared<rclcpp::AsyncParametersClient>(node, entry.first);
+    if (!client->wait_for_service(time_left(deadline))) {
+      result.successful = false;
+      result.failed_nodes[entry.first] = "Parameter services unavailable";
+      continue;
+    }
+    auto future = client->set_parameters_atomically(entry.second);
+    pending.push_back({entry.first, client, std::move(future)});
+  }
+
+  for (auto & apply : pending) {
+    if (rclcpp::spin_until_future_complete(node, apply.future, time_left(deadline)) !=
+      rclcpp::FutureReturnCode::SUCCESS)
+    {
+      result.successful = false;
+      result.failed_nodes[apply.node_name] = "Timed out waiting for the set request";
+      continue;
+    }
+    auto reply = apply.future.get();
+    if (!reply.successful) {
+      result.successful = false;
+      result.failed_nodes[apply.node_name] = reply.reason;
+    }
+  }
+
+  if (!result.successful && rollback_on_failure) {
+    auto restore = apply_parameter_snapshot(node, prior, time_left(deadline), false);
+    if (!restore.successful) {
+      for (const auto & failure : restore.failed_nodes) {
+        RCLCPP_ERROR(
+          node->get_logger(), "Failed to roll back parameters of node %s: %s",
+          failure.first.c_str(), failure.second.c_str());
+      }
+    }
+  }
+
+  return result;
+}
+
+}  // namespace nav2_util
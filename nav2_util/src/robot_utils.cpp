@@ -17,6 +17,7 @@
 #include <string>
 #include <cmath>
 #include <memory>
+#include <vector>
 
 #include "tf2/convert.h"
 #include "nav2_util/robot_utils.hpp"
@@ -77,6 +78,42 @@ bool transformPoseInTargetFrame(
   return false;
 }
 
+bool transformPoses(
+  const std::vector<geometry_msgs::msg::PoseStamped> & input_poses,
+  std::vector<geometry_msgs::msg::PoseStamped> & transformed_poses,
+  tf2_ros::Buffer & tf_buffer, const std::string target_frame,
+  const double transform_timeout)
+{
+  static rclcpp::Logger logger = rclcpp::get_logger("transformPoses");
+
+  transformed_poses.resize(input_poses.size());
+
+  // Poses out of a path or a footprint share a frame and timestamp, so one
+  // lookup covers each consecutive run of identical headers
+  geometry_msgs::msg::TransformStamped transform;
+  bool transform_cached = false;
+  for (unsigned int i = 0; i != input_poses.size(); i++) {
+    const auto & pose = input_poses[i];
+    if (!transform_cached || !(pose.header == input_poses[i - 1].header)) {
+      try {
+        transform = tf_buffer.lookupTransform(
+          target_frame, pose.header.frame_id,
+          tf2_ros::fromMsg(pose.header.stamp),
+          tf2::durationFromSec(transform_timeout));
+      } catch (tf2::TransformException & ex) {
+        RCLCPP_ERROR(
+          logger, "Failed to transform from %s to %s: %s",
+          pose.header.frame_id.c_str(), target_frame.c_str(), ex.what());
+        return false;
+      }
+      transform_cached = true;
+    }
+    tf2::doTransform(pose, transformed_poses[i], transform);
+  }
+
+  return true;
+}
+
 bool getTransform(
   const std::string & source_frame_id,
   const std::string & target_frame_id,
@@ -0,0 +1,94 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "nav2_util/shared_node_thread.hpp"
+
+namespace nav2_util
+{
+
+/**
+ * @class nav2_util::SharedExecutorRunner
+ * @brief The process-wide executor thread behind SharedNodeThread. It is
+ * reference counted by the SharedNodeThread instances holding it, so the
+ * thread starts with the first opted-in node and stops with the last.
+ */
+class SharedExecutorRunner
+{
+public:
+  SharedExecutorRunner()
+  {
+    executor_ = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+    thread_ = std::make_unique<std::thread>(
+      [this]() {
+        executor_->spin();
+      });
+  }
+
+  ~SharedExecutorRunner()
+  {
+    executor_->cancel();
+    thread_->join();
+  }
+
+  void add_node(rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base)
+  {
+    executor_->add_node(node_base, true);
+  }
+
+  void remove_node(rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base)
+  {
+    executor_->remove_node(node_base, true);
+  }
+
+  /**
+   * @brief Get the runner shared by the process, creating it when no
+   * SharedNodeThread currently holds one
+   */
+  static std::shared_ptr<SharedExecutorRunner> instance()
+  {
+    static std::mutex mutex;
+    static std::weak_ptr<SharedExecutorRunner> instance;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<SharedExecutorRunner> runner = instance.lock();
+    if (!runner) {
+      runner = std::make_shared<SharedExecutorRunner>();
+      instance = runner;
+    }
+    return runner;
+  }
+
+private:
+  rclcpp::executors::SingleThreadedExecutor::SharedPtr executor_;
+  std::unique_ptr<std::thread> thread_;
+};
+
+SharedNodeThread::SharedNodeThread(
+  rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base)
+: node_(node_base)
+{
+  runner_ = SharedExecutorRunner::instance();
+  runner_->add_node(node_);
+}
+
+SharedNodeThread::~SharedNodeThread()
+{
+  runner_->remove_node(node_);
+}
+
+}  // namespace nav2_util
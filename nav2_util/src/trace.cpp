@@ -0,0 +1,43 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_util/trace.hpp"
+
+#include <atomic>
+
+namespace nav2_util
+{
+namespace trace
+{
+
+namespace
+{
+std::atomic<TraceFn> trace_fn{nullptr};
+}  // namespace
+
+void setTraceFunction(TraceFn fn)
+{
+  trace_fn.store(fn, std::memory_order_release);
+}
+
+void emit(const char * subsystem, const char * event, uint64_t correlation_id)
+{
+  TraceFn fn = trace_fn.load(std::memory_order_acquire);
+  if (fn) {
+    fn(subsystem, event, correlation_id);
+  }
+}
+
+}  // namespace trace
+}  // namespace nav2_util
@@ -13,6 +13,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <utility>
+#include <vector>
+
 #include "nav2_util/geometry_utils.hpp"
 #include "geometry_msgs/msg/point.hpp"
 #include "geometry_msgs/msg/pose.hpp"
@@ -128,3 +131,92 @@ TEST(GeometryUtils, calculate_path_length)
     calculate_path_length(circle_path),
     2 * pi * polar_distance, 1e-1);
 }
+
+TEST(GeometryUtils, compact_path_round_trip)
+{
+  using nav2_util::geometry_utils::compactPath;
+  using nav2_util::geometry_utils::expandPath;
+  using nav2_util::geometry_utils::orientationAroundZAxis;
+  using nav2_util::geometry_utils::yawFromQuaternion;
+
+  nav_msgs::msg::Path path;
+  path.header.frame_id = "map";
+  double theta = 0.0;
+  double x = 3.0, y = -2.0;
+  for (int i = 0; i < 500; i++) {
+    theta = std::sin(i * 0.05) * 2.0;
+    x += 0.025 * std::cos(theta);
+    y += 0.025 * std::sin(theta);
+    geometry_msgs::msg::PoseStamped pose;
+    pose.pose.position.x = x;
+    pose.pose.position.y = y;
+    pose.pose.orientation = orientationAroundZAxis(theta);
+    path.poses.push_back(pose);
+  }
+
+  nav2_msgs::msg::CompactPath compact = compactPath(path);
+  EXPECT_EQ(compact.pose_count, path.poses.size());
+  EXPECT_EQ(compact.delta_x.size(), path.poses.size() - 1);
+  EXPECT_EQ(compact.header.frame_id, "map");
+  EXPECT_DOUBLE_EQ(compact.xy_resolution, 0.001);
+
+  nav_msgs::msg::Path expanded = expandPath(compact);
+  ASSERT_EQ(expanded.poses.size(), path.poses.size());
+  EXPECT_EQ(expanded.header.frame_id, "map");
+  for (unsigned int i = 0; i < path.poses.size(); i++) {
+    // Reconstruction error is bounded by half a quantization step
+    EXPECT_NEAR(
+      expanded.poses[i].pose.position.x, path.poses[i].pose.position.x, 0.0005);
+    EXPECT_NEAR(
+      expanded.poses[i].pose.position.y, path.poses[i].pose.position.y, 0.0005);
+    EXPECT_NEAR(
+      yawFromQuaternion(expanded.poses[i].pose.orientation),
+      yawFromQuaternion(path.poses[i].pose.orientation), 0.0005);
+  }
+}
+
+TEST(GeometryUtils, compact_path_widens_resolution)
+{
+  using nav2_util::geometry_utils::compactPath;
+  using nav2_util::geometry_utils::expandPath;
+
+  // Sparse waypoints whose steps do not fit the requested resolution
+  nav_msgs::msg::Path path;
+  std::vector<std::pair<double, double>> points =
+  {{0.0, 0.0}, {100.0, -250.0}, {-400.0, 300.0}};
+  for (const auto & point : points) {
+    geometry_msgs::msg::PoseStamped pose;
+    pose.pose.position.x = point.first;
+    pose.pose.position.y = point.second;
+    pose.pose.orientation.w = 1.0;
+    path.poses.push_back(pose);
+  }
+
+  nav2_msgs::msg::CompactPath compact = compactPath(path);
+  EXPECT_GT(compact.xy_resolution, 0.001);
+
+  nav_msgs::msg::Path expanded = expandPath(compact);
+  ASSERT_EQ(expanded.poses.size(), path.poses.size());
+  for (unsigned int i = 0; i < path.poses.size(); i++) {
+    EXPECT_NEAR(
+      expanded.poses[i].pose.position.x, path.poses[i].pose.position.x,
+      compact.xy_resolution / 2.0 + 1e-9);
+    EXPECT_NEAR(
+      expanded.poses[i].pose.position.y, path.poses[i].pose.position.y,
+      compact.xy_resolution / 2.0 + 1e-9);
+  }
+}
+
+TEST(GeometryUtils, compact_path_empty_and_invalid)
+{
+  using nav2_util::geometry_utils::compactPath;
+  using nav2_util::geometry_utils::expandPath;
+
+  nav_msgs::msg::Path empty_path;
+  nav2_msgs::msg::CompactPath compact = compactPath(empty_path);
+  EXPECT_EQ(compact.pose_count, 0u);
+  EXPECT_EQ(expandPath(compact).poses.size(), 0u);
+
+  compact.pose_count = 5;
+  EXPECT_THROW(expandPath(compact), std::invalid_argument);
+}
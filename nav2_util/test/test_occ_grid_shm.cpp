@@ -0,0 +1,79 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdexcept>
+#include <string>
+
+#include "nav2_util/occ_grid_shm.hpp"
+
+#include "gtest/gtest.h"
+
+TEST(OccGridShm, round_trip)
+{
+  nav_msgs::msg::OccupancyGrid grid;
+  grid.header.frame_id = "map";
+  grid.header.stamp.sec = 42;
+  grid.header.stamp.nanosec = 7;
+  grid.info.resolution = 0.05;
+  grid.info.width = 4;
+  grid.info.height = 3;
+  grid.info.origin.position.x = -1.5;
+  grid.info.origin.position.y = 2.25;
+  grid.info.origin.orientation.w = 1.0;
+  grid.data.resize(grid.info.width * grid.info.height);
+  for (size_t i = 0; i < grid.data.size(); i++) {
+    grid.data[i] = static_cast<int8_t>(i * 9 - 30);
+  }
+
+  const std::string name = "/nav2_util_test_occ_grid_shm";
+  nav2_util::writeOccGridShm(name, grid);
+
+  {
+    nav2_util::SharedOccupancyGrid view(name);
+    EXPECT_EQ(view.grid().header.frame_id, grid.header.frame_id);
+    EXPECT_EQ(view.grid().header.stamp.sec, grid.header.stamp.sec);
+    EXPECT_EQ(view.grid().header.stamp.nanosec, grid.header.stamp.nanosec);
+    EXPECT_EQ(view.grid().info.resolution, grid.info.resolution);
+    EXPECT_EQ(view.grid().info.width, grid.info.width);
+    EXPECT_EQ(view.grid().info.height, grid.info.height);
+    EXPECT_EQ(view.grid().info.origin.position.x, grid.info.origin.position.x);
+    EXPECT_EQ(view.grid().info.origin.position.y, grid.info.origin.position.y);
+    EXPECT_EQ(view.grid().info.origin.orientation.w, grid.info.origin.orientation.w);
+    // The metadata grid does not carry a private copy of the cells
+    EXPECT_TRUE(view.grid().data.empty());
+    for (size_t i = 0; i < grid.data.size(); i++) {
+      EXPECT_EQ(view.data()[i], grid.data[i]);
+    }
+
+    // Re-publishing into the segment is observed by existing mappings
+    grid.data[0] = 99;
+    nav2_util::writeOccGridShm(name, grid);
+    EXPECT_EQ(view.data()[0], 99);
+
+    // The mapping survives removal of the segment name
+    nav2_util::removeOccGridShm(name);
+    EXPECT_EQ(view.data()[5], grid.data[5]);
+  }
+
+  // A removed segment can no longer be mapped; removing it again is a no-op
+  EXPECT_THROW(nav2_util::SharedOccupancyGrid{name}, std::runtime_error);
+  EXPECT_NO_THROW(nav2_util::removeOccGridShm(name));
+}
+
+TEST(OccGridShm, missing_segment_throws)
+{
+  EXPECT_THROW(
+    nav2_util::SharedOccupancyGrid{"/nav2_util_test_occ_grid_shm_missing"},
+    std::runtime_error);
+}
@@ -0,0 +1,140 @@
+// Copyright (c) 2026 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "nav2_util/node_thread.hpp"
+#include "nav2_util/node_utils.hpp"
+#include "nav2_util/parameter_transaction.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+class RclCppFixture
+{
+public:
+  RclCppFixture() {rclcpp::init(0, nullptr);}
+  ~RclCppFixture() {rclcpp::shutdown();}
+};
+RclCppFixture g_rclcppfixture;
+
+/// A node with a couple of declared parameters and a counting set callback
+class TargetNode
+{
+public:
+  explicit TargetNode(const std::string & name)
+  {
+    node = std::make_shared<rclcpp::Node>(name);
+    node->declare_parameter("speed", 0.5);
+    node->declare_parameter("profile", std::string("default"));
+    handle = node->add_on_set_parameters_callback(
+      [this](std::vector<rclcpp::Parameter> parameters) {
+        callback_invocations++;
+        last_batch_size = parameters.size();
+        rcl_interfaces::msg::SetParametersResult result;
+        result.successful = true;
+        for (const auto & parameter : parameters) {
+          if (parameter.get_name() == "speed" && parameter.as_double() > 10.0) {
+            result.successful = false;
+            result.reason = "speed out of range";
+          }
+        }
+        return result;
+      });
+    thread = std::make_shared<nav2_util::NodeThread>(node->get_node_base_interface());
+  }
+
+  rclcpp::Node::SharedPtr node;
+  rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr handle;
+  std::shared_ptr<nav2_util::NodeThread> thread;
+  std::atomic<unsigned int> callback_invocations{0};
+  std::atomic<size_t> last_batch_size{0};
+};
+
+TEST(ParameterTransaction, capture_and_apply)
+{
+  TargetNode target_a("param_target_a");
+  TargetNode target_b("param_target_b");
+  auto client_node = nav2_util::generate_internal_node("param_transaction_test");
+
+  // The capture should hold the declared values of both nodes
+  auto prior = nav2_util::capture_parameter_snapshot(
+    client_node, {"/param_target_a", "/param_target_b"});
+  ASSERT_EQ(prior.size(), 2u);
+  bool found_speed = false;
+  for (const auto & parameter : prior["/param_target_a"]) {
+    if (parameter.get_name() == "speed") {
+      EXPECT_EQ(parameter.as_double(), 0.5);
+      found_speed = true;
+    }
+  }
+  EXPECT_TRUE(found_speed);
+
+  // Applying a profile delivers each node its list in one callback invocation
+  nav2_util::ParameterSnapshot profile;
+  profile["/param_target_a"] = {
+    rclcpp::Parameter("speed", 1.5), rclcpp::Parameter("profile", std::string("fast"))};
+  profile["/param_target_b"] = {
+    rclcpp::Parameter("speed", 0.25), rclcpp::Parameter("profile", std::string("slow"))};
+  auto result = nav2_util::apply_parameter_snapshot(client_node, profile);
+  EXPECT_TRUE(result.successful);
+  EXPECT_TRUE(result.failed_nodes.empty());
+  EXPECT_EQ(target_a.callback_invocations, 1u);
+  EXPECT_EQ(target_a.last_batch_size, 2u);
+  EXPECT_EQ(target_b.callback_invocations, 1u);
+  EXPECT_EQ(target_b.last_batch_size, 2u);
+  EXPECT_EQ(target_a.node->get_parameter("speed").as_double(), 1.5);
+  EXPECT_EQ(target_b.node->get_parameter("profile").as_string(), std::string("slow"));
+}
+
+TEST(ParameterTransaction, rollback_on_partial_failure)
+{
+  TargetNode target_a("rollback_target_a");
+  TargetNode target_b("rollback_target_b");
+  auto client_node = nav2_util::generate_internal_node("param_transaction_test");
+
+  // Target B rejects its list, so target A's accepted values must be restored
+  nav2_util::ParameterSnapshot profile;
+  profile["/rollback_target_a"] = {rclcpp::Parameter("speed", 2.0)};
+  profile["/rollback_target_b"] = {rclcpp::Parameter("speed", 100.0)};
+  auto result = nav2_util::apply_parameter_snapshot(
+    client_node, profile, std::chrono::milliseconds(2000), true);
+  EXPECT_FALSE(result.successful);
+  ASSERT_EQ(result.failed_nodes.size(), 1u);
+  EXPECT_EQ(result.failed_nodes.begin()->first, std::string("/rollback_target_b"));
+  EXPECT_EQ(result.failed_nodes.begin()->second, std::string("speed out of range"));
+  EXPECT_EQ(target_a.node->get_parameter("speed").as_double(), 0.5);
+  EXPECT_EQ(target_b.node->get_parameter("speed").as_double(), 0.5);
+}
+
+TEST(ParameterTransaction, unavailable_node_reported)
+{
+  auto client_node = nav2_util::generate_internal_node("param_transaction_test");
+
+  nav2_util::ParameterSnapshot profile;
+  profile["/no_such_node"] = {rclcpp::Parameter("speed", 1.0)};
+  auto result = nav2_util::apply_parameter_snapshot(
+    client_node, profile, std::chrono::milliseconds(100));
+  EXPECT_FALSE(result.successful);
+  ASSERT_EQ(result.failed_nodes.size(), 1u);
+  EXPECT_EQ(
+    result.failed_nodes.begin()->second, std::string("Parameter services unavailable"));
+
+  EXPECT_THROW(
+    nav2_util::capture_parameter_snapshot(
+      client_node, {"/no_such_node"}, std::chrono::milliseconds(100)),
+    std::runtime_error);
+}
@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <cmath>
+#include <vector>
 #include "rclcpp/rclcpp.hpp"
 #include "nav2_util/robot_utils.hpp"
 #include "tf2_ros/transform_listener.h"
@@ -32,6 +33,11 @@ TEST(RobotUtils, LookupExceptionError)
   ASSERT_FALSE(nav2_util::getCurrentPose(global_pose, tf, "map", "base_link", 0.1));
   global_pose.header.frame_id = "base_link";
   ASSERT_FALSE(nav2_util::transformPoseInTargetFrame(global_pose, global_pose, tf, "map", 0.1));
+
+  std::vector<geometry_msgs::msg::PoseStamped> poses, transformed_poses;
+  ASSERT_TRUE(nav2_util::transformPoses(poses, transformed_poses, tf, "map", 0.1));
+  poses.push_back(global_pose);
+  ASSERT_FALSE(nav2_util::transformPoses(poses, transformed_poses, tf, "map", 0.1));
 }
 
 TEST(RobotUtils, validateTwist)
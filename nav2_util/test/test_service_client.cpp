@@ -97,3 +97,15 @@ TEST(ServiceClient, can_ServiceClient_timeout)
   rclcpp::shutdown();
   ASSERT_EQ(ready, false);
 }
+
+TEST(ServiceClient, can_ServiceClient_fail_within_deadline)
+{
+  rclcpp::init(0, nullptr);
+  auto node = rclcpp::Node::make_shared("test_node");
+  TestServiceClient t("bar", node);
+  auto req = std::make_shared<std_srvs::srv::Empty::Request>();
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_THROW(t.invoke(req, std::chrono::milliseconds(20)), std::runtime_error);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+  rclcpp::shutdown();
+}
@@ -0,0 +1,84 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "nav2_util/shared_node_thread.hpp"
+#include "gtest/gtest.h"
+#include "rclcpp/rclcpp.hpp"
+
+using namespace std::chrono_literals;  // NOLINT
+
+TEST(SharedNodeThread, MultiplexesNodes)
+{
+  rclcpp::init(0, nullptr);
+
+  auto node_a = std::make_shared<rclcpp::Node>("shared_thread_node_a");
+  auto node_b = std::make_shared<rclcpp::Node>("shared_thread_node_b");
+
+  std::atomic<int> ticks_a{0};
+  std::atomic<int> ticks_b{0};
+  auto timer_a = node_a->create_wall_timer(5ms, [&]() {ticks_a++;});
+  auto timer_b = node_b->create_wall_timer(5ms, [&]() {ticks_b++;});
+
+  // Both nodes are serviced by the same background thread
+  auto thread_a = std::make_unique<nav2_util::SharedNodeThread>(node_a);
+  auto thread_b = std::make_unique<nav2_util::SharedNodeThread>(node_b);
+
+  auto start = std::chrono::steady_clock::now();
+  while ((ticks_a == 0 || ticks_b == 0) &&
+    std::chrono::steady_clock::now() - start < 2s)
+  {
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_GT(ticks_a, 0);
+  EXPECT_GT(ticks_b, 0);
+
+  // Removing one node must not stop servicing the other
+  thread_a.reset();
+  const int ticks_b_before = ticks_b;
+  start = std::chrono::steady_clock::now();
+  while (ticks_b == ticks_b_before &&
+    std::chrono::steady_clock::now() - start < 2s)
+  {
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_GT(ticks_b, ticks_b_before);
+
+  // Removing the last node stops the shared thread; a later opt-in
+  // must transparently start a fresh one
+  thread_b.reset();
+  auto node_c = std::make_shared<rclcpp::Node>("shared_thread_node_c");
+  std::atomic<int> ticks_c{0};
+  auto timer_c = node_c->create_wall_timer(5ms, [&]() {ticks_c++;});
+  auto thread_c = std::make_unique<nav2_util::SharedNodeThread>(node_c);
+
+  start = std::chrono::steady_clock::now();
+  while (ticks_c == 0 && std::chrono::steady_clock::now() - start < 2s) {
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_GT(ticks_c, 0);
+
+  thread_c.reset();
+  rclcpp::shutdown();
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
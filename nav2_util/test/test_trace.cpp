@@ -0,0 +1,71 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Compile the tracepoints in for this translation unit
+#define NAV2_TRACING_ENABLED
+#include "nav2_util/trace.hpp"
+
+#include "gtest/gtest.h"
+
+namespace
+{
+
+std::vector<std::tuple<std::string, std::string, uint64_t>> calls;
+
+void record(const char * subsystem, const char * event, uint64_t correlation_id)
+{
+  calls.emplace_back(subsystem, event, correlation_id);
+}
+
+}  // namespace
+
+TEST(Trace, forwards_to_registered_sink)
+{
+  calls.clear();
+
+  // Without a sink, emitting is a no-op
+  nav2_util::trace::emit("costmap", "update_map_begin", 1);
+  EXPECT_TRUE(calls.empty());
+
+  nav2_util::trace::setTraceFunction(record);
+  nav2_util::trace::emit("costmap", "update_map_begin", 7);
+  ASSERT_EQ(calls.size(), 1u);
+  EXPECT_EQ(std::get<0>(calls[0]), "costmap");
+  EXPECT_EQ(std::get<1>(calls[0]), "update_map_begin");
+  EXPECT_EQ(std::get<2>(calls[0]), 7u);
+
+  // Unregistering stops the forwarding again
+  nav2_util::trace::setTraceFunction(nullptr);
+  nav2_util::trace::emit("costmap", "update_map_end", 7);
+  EXPECT_EQ(calls.size(), 1u);
+}
+
+TEST(Trace, macro_emits_when_compiled_in)
+{
+  calls.clear();
+  nav2_util::trace::setTraceFunction(record);
+
+  NAV2_TRACE("planner", "compute_plan_begin", 42);
+
+  ASSERT_EQ(calls.size(), 1u);
+  EXPECT_EQ(std::get<0>(calls[0]), "planner");
+  EXPECT_EQ(std::get<1>(calls[0]), "compute_plan_begin");
+  EXPECT_EQ(std::get<2>(calls[0]), 42u);
+
+  nav2_util::trace::setTraceFunction(nullptr);
+}
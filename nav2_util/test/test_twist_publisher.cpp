@@ -62,6 +62,40 @@ TEST(TwistPublisher, Unstamped)
   pub_thread.join();
 }
 
+TEST(TwistPublisher, UnstampedByReference)
+{
+  rclcpp::init(0, nullptr);
+  auto pub_node = std::make_shared<nav2_util::LifecycleNode>("pub_node", "");
+  pub_node->configure();
+  auto vel_publisher = std::make_unique<nav2_util::TwistPublisher>(pub_node, "cmd_vel", 1);
+  pub_node->activate();
+  vel_publisher->on_activate();
+  auto pub_thread = std::thread([&]() {rclcpp::spin(pub_node->get_node_base_interface());});
+
+  auto sub_node = std::make_shared<nav2_util::LifecycleNode>("sub_node", "");
+  sub_node->configure();
+  sub_node->activate();
+
+  geometry_msgs::msg::TwistStamped pub_msg {};
+  pub_msg.twist.linear.x = 42.0;
+
+  geometry_msgs::msg::Twist sub_msg {};
+  auto my_sub = sub_node->create_subscription<geometry_msgs::msg::Twist>(
+    "cmd_vel", 10,
+    [&](const geometry_msgs::msg::Twist msg) {sub_msg = msg;});
+
+  vel_publisher->publish(pub_msg);
+  rclcpp::spin_some(sub_node->get_node_base_interface());
+
+  EXPECT_EQ(pub_msg.twist.linear.x, sub_msg.linear.x);
+  EXPECT_EQ(vel_publisher->get_subscription_count(), 1);
+  pub_node->deactivate();
+  sub_node->deactivate();
+  rclcpp::shutdown();
+  // // Have to join thread after rclcpp is shut down otherwise test hangs.
+  pub_thread.join();
+}
+
 TEST(TwistPublisher, Stamped)
 {
   rclcpp::init(0, nullptr);
@@ -78,6 +78,39 @@ public:
     const double accel, const double decel, const double eta);
 
 protected:
+  /**
+   * @brief Find the scale factor, eta, within a precomputed feasible
+   * velocity delta envelope
+   * @param v_curr current velocity
+   * @param v_cmd commanded velocity
+   * @param accel_dv maximum velocity change per tick while accelerating
+   * @param decel_dv maximum velocity change per tick while decelerating
+   * @return Scale factor, eta
+   */
+  double findEtaEnvelopeConstraint(
+    const double v_curr, const double v_cmd,
+    const double accel_dv, const double decel_dv);
+
+  /**
+   * @brief Apply scale factor constraints within a precomputed feasible
+   * velocity delta envelope
+   * @param v_curr current velocity
+   * @param v_cmd commanded velocity
+   * @param accel_dv maximum velocity change per tick while accelerating
+   * @param decel_dv maximum velocity change per tick while decelerating
+   * @param eta Scale factor
+   * @return Velocity command
+   */
+  double applyEnvelopeConstraints(
+    const double v_curr, const double v_cmd,
+    const double accel_dv, const double decel_dv, const double eta);
+
+  /**
+   * @brief Regenerate the per-axis per-tick velocity delta envelopes,
+   * called when the acceleration limits or smoothing frequency change
+   */
+  void updateAccelerationEnvelopes();
+
   /**
    * @brief Configures parameters and member variables
    * @param state LifeCycle Node's state
@@ -115,9 +148,8 @@ protected:
 
   /**
    * @brief Callback for incoming velocity commands
-   * @param msg Twist message
+   * @param msg TwistStamped message
    */
-  void inputCommandCallback(const geometry_msgs::msg::Twist::SharedPtr msg);
   void inputCommandStampedCallback(const geometry_msgs::msg::TwistStamped::SharedPtr msg);
 
   /**
@@ -125,6 +157,23 @@ protected:
    */
   void smootherTimer();
 
+  /**
+   * @brief Low-rate keepalive while holding a converged setpoint: republish
+   * the held command and re-arm the smoothing timer if the input times out
+   */
+  void keepaliveTimer();
+
+  /**
+   * @brief Arm the full-rate smoothing timer and stop the keepalive
+   */
+  void armSmoothingTimer();
+
+  /**
+   * @brief Drop to the low-rate keepalive, or go fully dormant when stopped
+   * @param dormant Stop both timers until the next input command
+   */
+  void disarmSmoothingTimer(const bool dormant);
+
   /**
    * @brief Dynamic reconfigure callback
    * @param parameters Parameter list to change
@@ -137,6 +186,7 @@ protected:
   std::unique_ptr<nav2_util::TwistPublisher> smoothed_cmd_pub_;
   std::unique_ptr<nav2_util::TwistSubscriber> cmd_sub_;
   rclcpp::TimerBase::SharedPtr timer_;
+  rclcpp::TimerBase::SharedPtr keepalive_timer_;
 
   rclcpp::Clock::SharedPtr clock_;
   geometry_msgs::msg::TwistStamped last_cmd_;
@@ -144,6 +194,9 @@ protected:
 
   // Parameters
   double smoothing_frequency_;
+  // Republish rate while holding a converged setpoint; <= 0 keeps the
+  // smoothing timer running at full rate continuously
+  double keepalive_frequency_;
   double odom_duration_;
   std::string odom_topic_;
   bool open_loop_;
@@ -153,6 +206,10 @@ protected:
   std::vector<double> min_velocities_;
   std::vector<double> max_accels_;
   std::vector<double> max_decels_;
+  // Per-axis feasible velocity change per timer tick, precomputed from the
+  // acceleration limits and smoothing frequency
+  std::vector<double> accel_dvs_;
+  std::vector<double> decel_dvs_;
   std::vector<double> deadband_velocities_;
   rclcpp::Duration velocity_timeout_{0, 0};
   rclcpp::Time last_command_time_;
@@ -41,6 +41,10 @@ VelocitySmoother::~VelocitySmoother()
     timer_->cancel();
     timer_.reset();
   }
+  if (keepalive_timer_) {
+    keepalive_timer_->cancel();
+    keepalive_timer_.reset();
+  }
 }
 
 nav2_util::CallbackReturn
@@ -53,10 +57,12 @@ VelocitySmoother::on_configure(const rclcpp_lifecycle::State &)
 
   // Smoothing metadata
   declare_parameter_if_not_declared(node, "smoothing_frequency", rclcpp::ParameterValue(20.0));
+  declare_parameter_if_not_declared(node, "keepalive_frequency", rclcpp::ParameterValue(1.0));
   declare_parameter_if_not_declared(
     node, "feedback", rclcpp::ParameterValue(std::string("OPEN_LOOP")));
   declare_parameter_if_not_declared(node, "scale_velocities", rclcpp::ParameterValue(false));
   node->get_parameter("smoothing_frequency", smoothing_frequency_);
+  node->get_parameter("keepalive_frequency", keepalive_frequency_);
   node->get_parameter("feedback", feedback_type);
   node->get_parameter("scale_velocities", scale_velocities_);
 
@@ -117,6 +123,8 @@ VelocitySmoother::on_configure(const rclcpp_lifecycle::State &)
             " All limits must be size of 3 representing (x, y, theta).");
   }
 
+  updateAccelerationEnvelopes();
+
   // Get control type
   if (feedback_type == "OPEN_LOOP") {
     open_loop_ = true;
@@ -132,7 +140,7 @@ VelocitySmoother::on_configure(const rclcpp_lifecycle::State &)
   cmd_sub_ = std::make_unique<nav2_util::TwistSubscriber>(
     node,
     "cmd_vel", rclcpp::QoS(1),
-    std::bind(&VelocitySmoother::inputCommandCallback, this, std::placeholders::_1),
+    nav2_util::adapt_unstamped,
     std::bind(&VelocitySmoother::inputCommandStampedCallback, this, std::placeholders::_1)
   );
 
@@ -160,6 +168,13 @@ VelocitySmoother::on_activate(const rclcpp_lifecycle::State &)
   timer_ = this->create_wall_timer(
     std::chrono::milliseconds(static_cast<int>(timer_duration_ms)),
     std::bind(&VelocitySmoother::smootherTimer, this));
+  if (keepalive_frequency_ > 0.0) {
+    double keepalive_duration_ms = 1000.0 / keepalive_frequency_;
+    keepalive_timer_ = this->create_wall_timer(
+      std::chrono::milliseconds(static_cast<int>(keepalive_duration_ms)),
+      std::bind(&VelocitySmoother::keepaliveTimer, this));
+    keepalive_timer_->cancel();
+  }
 
   dyn_params_handler_ = this->add_on_set_parameters_callback(
     std::bind(&VelocitySmoother::dynamicParametersCallback, this, _1));
@@ -177,6 +192,10 @@ VelocitySmoother::on_deactivate(const rclcpp_lifecycle::State &)
     timer_->cancel();
     timer_.reset();
   }
+  if (keepalive_timer_) {
+    keepalive_timer_->cancel();
+    keepalive_timer_.reset();
+  }
   smoothed_cmd_pub_->on_deactivate();
 
   remove_on_set_parameters_callback(dyn_params_handler_.get());
@@ -219,18 +238,72 @@ void VelocitySmoother::inputCommandStampedCallback(
   } else {
     last_command_time_ = msg->header.stamp;
   }
+
+  // A new setpoint may require smoothing toward it; the timer drops back
+  // to the keepalive on its own once the output has converged
+  armSmoothingTimer();
+}
+
+void VelocitySmoother::armSmoothingTimer()
+{
+  if (!timer_ || !keepalive_timer_) {
+    return;
+  }
+  keepalive_timer_->cancel();
+  if (timer_->is_canceled()) {
+    timer_->reset();
+  }
 }
 
-void VelocitySmoother::inputCommandCallback(
-  geometry_msgs::msg::Twist::SharedPtr msg)
+void VelocitySmoother::disarmSmoothingTimer(const bool dormant)
 {
-  auto twist_stamped = std::make_shared<geometry_msgs::msg::TwistStamped>();
-  twist_stamped->twist = *msg;
-  inputCommandStampedCallback(twist_stamped);
+  if (!timer_ || !keepalive_timer_) {
+    return;
+  }
+  timer_->cancel();
+  if (dormant) {
+    keepalive_timer_->cancel();
+  } else if (keepalive_timer_->is_canceled()) {
+    keepalive_timer_->reset();
+  }
+}
+
+void VelocitySmoother::keepaliveTimer()
+{
+  if (!command_) {
+    return;
+  }
+
+  // On input timeout, hand back to the smoothing timer so the existing
+  // deceleration-to-zero logic runs at full rate
+  if (now() - last_command_time_ > velocity_timeout_) {
+    armSmoothingTimer();
+    return;
+  }
+
+  // Zero-order hold: republish the held output so downstream consumers
+  // and watchdogs keep seeing a live command
+  auto cmd_vel = std::make_unique<geometry_msgs::msg::TwistStamped>();
+  cmd_vel->header = command_->header;
+  cmd_vel->twist = last_cmd_.twist;
+  cmd_vel->twist.linear.x =
+    fabs(cmd_vel->twist.linear.x) < deadband_velocities_[0] ? 0.0 : cmd_vel->twist.linear.x;
+  cmd_vel->twist.linear.y =
+    fabs(cmd_vel->twist.linear.y) < deadband_velocities_[1] ? 0.0 : cmd_vel->twist.linear.y;
+  cmd_vel->twist.angular.z =
+    fabs(cmd_vel->twist.angular.z) < deadband_velocities_[2] ? 0.0 : cmd_vel->twist.angular.z;
+  smoothed_cmd_pub_->publish(std::move(cmd_vel));
 }
 
 double VelocitySmoother::findEtaConstraint(
   const double v_curr, const double v_cmd, const double accel, const double decel)
+{
+  return findEtaEnvelopeConstraint(
+    v_curr, v_cmd, accel / smoothing_frequency_, decel / smoothing_frequency_);
+}
+
+double VelocitySmoother::findEtaEnvelopeConstraint(
+  const double v_curr, const double v_cmd, const double accel_dv, const double decel_dv)
 {
   // Exploiting vector scaling properties
   double dv = v_cmd - v_curr;
@@ -242,11 +315,11 @@ double VelocitySmoother::findEtaConstraint(
   // and if v_cmd and v_curr have the same sign (i.e. speed is NOT passing through 0.0)
   // Decelerating otherwise
   if (abs(v_cmd) >= abs(v_curr) && v_curr * v_cmd >= 0.0) {
-    v_component_max = accel / smoothing_frequency_;
-    v_component_min = -accel / smoothing_frequency_;
+    v_component_max = accel_dv;
+    v_component_min = -accel_dv;
   } else {
-    v_component_max = -decel / smoothing_frequency_;
-    v_component_min = decel / smoothing_frequency_;
+    v_component_max = -decel_dv;
+    v_component_min = decel_dv;
   }
 
   if (dv > v_component_max) {
@@ -263,6 +336,14 @@ double VelocitySmoother::findEtaConstraint(
 double VelocitySmoother::applyConstraints(
   const double v_curr, const double v_cmd,
   const double accel, const double decel, const double eta)
+{
+  return applyEnvelopeConstraints(
+    v_curr, v_cmd, accel / smoothing_frequency_, decel / smoothing_frequency_, eta);
+}
+
+double VelocitySmoother::applyEnvelopeConstraints(
+  const double v_curr, const double v_cmd,
+  const double accel_dv, const double decel_dv, const double eta)
 {
   double dv = v_cmd - v_curr;
 
@@ -273,20 +354,31 @@ double VelocitySmoother::applyConstraints(
   // and if v_cmd and v_curr have the same sign (i.e. speed is NOT passing through 0.0)
   // Decelerating otherwise
   if (abs(v_cmd) >= abs(v_curr) && v_curr * v_cmd >= 0.0) {
-    v_component_max = accel / smoothing_frequency_;
-    v_component_min = -accel / smoothing_frequency_;
+    v_component_max = accel_dv;
+    v_component_min = -accel_dv;
   } else {
-    v_component_max = -decel / smoothing_frequency_;
-    v_component_min = decel / smoothing_frequency_;
+    v_component_max = -decel_dv;
+    v_component_min = decel_dv;
   }
 
   return v_curr + std::clamp(eta * dv, v_component_min, v_component_max);
 }
 
+void VelocitySmoother::updateAccelerationEnvelopes()
+{
+  accel_dvs_.resize(3);
+  decel_dvs_.resize(3);
+  for (unsigned int i = 0; i != 3; i++) {
+    accel_dvs_[i] = max_accels_[i] / smoothing_frequency_;
+    decel_dvs_[i] = max_decels_[i] / smoothing_frequency_;
+  }
+}
+
 void VelocitySmoother::smootherTimer()
 {
-  // Wait until the first command is received
+  // Wait until the first command is received, at the keepalive rate
   if (!command_) {
+    disarmSmoothingTimer(false);
     return;
   }
 
@@ -297,6 +389,8 @@ void VelocitySmoother::smootherTimer()
   if (now() - last_command_time_ > velocity_timeout_) {
     if (last_cmd_ == geometry_msgs::msg::TwistStamped() || stopped_) {
       stopped_ = true;
+      // fully stopped with no input: sleep until the next command arrives
+      disarmSmoothingTimer(true);
       return;
     }
     *command_ = geometry_msgs::msg::TwistStamped();
@@ -323,40 +417,53 @@ void VelocitySmoother::smootherTimer()
     command_->twist.angular.z, min_velocities_[2],
     max_velocities_[2]);
 
-  // Find if any component is not within the acceleration constraints. If so, store the most
-  // significant scale factor to apply to the vector <dvx, dvy, dvw>, eta, to reduce all axes
-  // proportionally to follow the same direction, within change of velocity bounds.
-  // In case eta reduces another axis out of its own limit, apply accel constraint to guarantee
-  // output is within limits, even if it deviates from requested command slightly.
-  double eta = 1.0;
-  if (scale_velocities_) {
-    double curr_eta = -1.0;
-
-    curr_eta = findEtaConstraint(
-      current_.twist.linear.x, command_->twist.linear.x, max_accels_[0], max_decels_[0]);
-    if (curr_eta > 0.0 && std::fabs(1.0 - curr_eta) > std::fabs(1.0 - eta)) {
-      eta = curr_eta;
-    }
+  // Steady state fast path: in open loop the current velocity is the last
+  // output, so when the clamped command already matches it the constraint
+  // math below is an identity (dv == 0 on every axis) and can be skipped
+  bool steady_state = false;
+  if (open_loop_ &&
+    command_->twist.linear.x == last_cmd_.twist.linear.x &&
+    command_->twist.linear.y == last_cmd_.twist.linear.y &&
+    command_->twist.angular.z == last_cmd_.twist.angular.z)
+  {
+    cmd_vel->twist = last_cmd_.twist;
+    steady_state = true;
+  } else {
+    // Find if any component is not within the acceleration constraints. If so, store the most
+    // significant scale factor to apply to the vector <dvx, dvy, dvw>, eta, to reduce all axes
+    // proportionally to follow the same direction, within change of velocity bounds.
+    // In case eta reduces another axis out of its own limit, apply accel constraint to guarantee
+    // output is within limits, even if it deviates from requested command slightly.
+    double eta = 1.0;
+    if (scale_velocities_) {
+      double curr_eta = -1.0;
+
+      curr_eta = findEtaEnvelopeConstraint(
+        current_.twist.linear.x, command_->twist.linear.x, accel_dvs_[0], decel_dvs_[0]);
+      if (curr_eta > 0.0 && std::fabs(1.0 - curr_eta) > std::fabs(1.0 - eta)) {
+        eta = curr_eta;
+      }
 
-    curr_eta = findEtaConstraint(
-      current_.twist.linear.y, command_->twist.linear.y, max_accels_[1], max_decels_[1]);
-    if (curr_eta > 0.0 && std::fabs(1.0 - curr_eta) > std::fabs(1.0 - eta)) {
-      eta = curr_eta;
-    }
+      curr_eta = findEtaEnvelopeConstraint(
+        current_.twist.linear.y, command_->twist.linear.y, accel_dvs_[1], decel_dvs_[1]);
+      if (curr_eta > 0.0 && std::fabs(1.0 - curr_eta) > std::fabs(1.0 - eta)) {
+        eta = curr_eta;
+      }
 
-    curr_eta = findEtaConstraint(
-      current_.twist.angular.z, command_->twist.angular.z, max_accels_[2], max_decels_[2]);
-    if (curr_eta > 0.0 && std::fabs(1.0 - curr_eta) > std::fabs(1.0 - eta)) {
-      eta = curr_eta;
+      curr_eta = findEtaEnvelopeConstraint(
+        current_.twist.angular.z, command_->twist.angular.z, accel_dvs_[2], decel_dvs_[2]);
+      if (curr_eta > 0.0 && std::fabs(1.0 - curr_eta) > std::fabs(1.0 - eta)) {
+        eta = curr_eta;
+      }
     }
-  }
 
-  cmd_vel->twist.linear.x = applyConstraints(
-    current_.twist.linear.x, command_->twist.linear.x, max_accels_[0], max_decels_[0], eta);
-  cmd_vel->twist.linear.y = applyConstraints(
-    current_.twist.linear.y, command_->twist.linear.y, max_accels_[1], max_decels_[1], eta);
-  cmd_vel->twist.angular.z = applyConstraints(
-    current_.twist.angular.z, command_->twist.angular.z, max_accels_[2], max_decels_[2], eta);
+    cmd_vel->twist.linear.x = applyEnvelopeConstraints(
+      current_.twist.linear.x, command_->twist.linear.x, accel_dvs_[0], decel_dvs_[0], eta);
+    cmd_vel->twist.linear.y = applyEnvelopeConstraints(
+      current_.twist.linear.y, command_->twist.linear.y, accel_dvs_[1], decel_dvs_[1], eta);
+    cmd_vel->twist.angular.z = applyEnvelopeConstraints(
+      current_.twist.angular.z, command_->twist.angular.z, accel_dvs_[2], decel_dvs_[2], eta);
+  }
   last_cmd_ = *cmd_vel;
 
   // Apply deadband restrictions & publish
@@ -368,6 +475,13 @@ void VelocitySmoother::smootherTimer()
     fabs(cmd_vel->twist.angular.z) < deadband_velocities_[2] ? 0.0 : cmd_vel->twist.angular.z;
 
   smoothed_cmd_pub_->publish(std::move(cmd_vel));
+
+  // The output has converged on the commanded setpoint, so every further
+  // tick would be a zero-order hold republish: keep holding at the
+  // keepalive rate instead until the setpoint changes or the input times out
+  if (steady_state) {
+    disarmSmoothingTimer(false);
+  }
 }
 
 rcl_interfaces::msg::SetParametersResult
@@ -392,6 +506,27 @@ VelocitySmoother::dynamicParametersCallback(std::vector<rclcpp::Parameter> param
         timer_ = this->create_wall_timer(
           std::chrono::milliseconds(static_cast<int>(timer_duration_ms)),
           std::bind(&VelocitySmoother::smootherTimer, this));
+        updateAccelerationEnvelopes();
+      } else if (name == "keepalive_frequency") {
+        keepalive_frequency_ = parameter.as_double();
+        if (keepalive_timer_) {
+          keepalive_timer_->cancel();
+          keepalive_timer_.reset();
+        }
+
+        if (keepalive_frequency_ > 0.0) {
+          double keepalive_duration_ms = 1000.0 / keepalive_frequency_;
+          keepalive_timer_ = this->create_wall_timer(
+            std::chrono::milliseconds(static_cast<int>(keepalive_duration_ms)),
+            std::bind(&VelocitySmoother::keepaliveTimer, this));
+          keepalive_timer_->cancel();
+        }
+
+        // Run at full rate until the smoothing timer settles back into
+        // whichever state matches the current command stream
+        if (timer_ && timer_->is_canceled()) {
+          timer_->reset();
+        }
       } else if (name == "velocity_timeout") {
         velocity_timeout_ = rclcpp::Duration::from_seconds(parameter.as_double());
       } else if (name == "odom_duration") {
@@ -442,6 +577,7 @@ VelocitySmoother::dynamicParametersCallback(std::vector<rclcpp::Parameter> param
         }
         if (result.successful) {
           max_accels_ = parameter.as_double_array();
+          updateAccelerationEnvelopes();
         }
       } else if (name == "max_decel") {
         for (unsigned int i = 0; i != 3; i++) {
@@ -454,6 +590,7 @@ VelocitySmoother::dynamicParametersCallback(std::vector<rclcpp::Parameter> param
         }
         if (result.successful) {
           max_decels_ = parameter.as_double_array();
+          updateAccelerationEnvelopes();
         }
       } else if (name == "deadband_velocity") {
         deadband_velocities_ = parameter.as_double_array();
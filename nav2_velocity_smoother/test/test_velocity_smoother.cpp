@@ -50,7 +50,12 @@ public:
   bool hasCommandMsg() {return last_command_time_.nanoseconds() != 0;}
   geometry_msgs::msg::TwistStamped::SharedPtr lastCommandMsg() {return command_;}
 
-  void sendCommandMsg(geometry_msgs::msg::Twist::SharedPtr msg) {inputCommandCallback(msg);}
+  void sendCommandMsg(geometry_msgs::msg::Twist::SharedPtr msg)
+  {
+    auto twist_stamped = std::make_shared<geometry_msgs::msg::TwistStamped>();
+    twist_stamped->twist = *msg;
+    inputCommandStampedCallback(twist_stamped);
+  }
 };
 
 TEST(VelocitySmootherTest, openLoopTestTimer)
@@ -62,6 +67,8 @@ TEST(VelocitySmootherTest, openLoopTestTimer)
   smoother->set_parameter(rclcpp::Parameter("scale_velocities", true));
   smoother->declare_parameter("deadband_velocity", rclcpp::ParameterValue(deadbands));
   smoother->set_parameter(rclcpp::Parameter("deadband_velocity", deadbands));
+  smoother->declare_parameter("keepalive_frequency", rclcpp::ParameterValue(5.0));
+  smoother->set_parameter(rclcpp::Parameter("keepalive_frequency", 5.0));
   rclcpp_lifecycle::State state;
   smoother->configure(state);
   smoother->activate(state);
@@ -88,9 +95,11 @@ TEST(VelocitySmootherTest, openLoopTestTimer)
     rclcpp::spin_some(smoother->get_node_base_interface());
   }
 
-  // Sanity check we have the approximately right number of messages for the timespan and timeout
-  EXPECT_GT(linear_vels.size(), 19u);
-  EXPECT_LT(linear_vels.size(), 30u);
+  // Sanity check on the message count: the ramp up and the timeout ramp down
+  // run at the full smoothing rate, but the converged setpoint in between is
+  // held at the 5 Hz keepalive rate rather than republished at 20 Hz
+  EXPECT_GT(linear_vels.size(), 8u);
+  EXPECT_LT(linear_vels.size(), 19u);
 
   // Should have last command be a stop since we timed out the command stream
   EXPECT_EQ(linear_vels.back(), 0.0);
@@ -647,6 +656,7 @@ TEST(VelocitySmootherTest, testDynamicParameter)
 
   auto results = rec_param->set_parameters_atomically(
     {rclcpp::Parameter("smoothing_frequency", 100.0),
+      rclcpp::Parameter("keepalive_frequency", 2.0),
       rclcpp::Parameter("feedback", std::string("CLOSED_LOOP")),
       rclcpp::Parameter("scale_velocities", true),
       rclcpp::Parameter("max_velocity", max_vel),
@@ -663,6 +673,7 @@ TEST(VelocitySmootherTest, testDynamicParameter)
     results);
 
   EXPECT_EQ(smoother->get_parameter("smoothing_frequency").as_double(), 100.0);
+  EXPECT_EQ(smoother->get_parameter("keepalive_frequency").as_double(), 2.0);
   EXPECT_EQ(smoother->get_parameter("feedback").as_string(), std::string("CLOSED_LOOP"));
   EXPECT_EQ(smoother->get_parameter("scale_velocities").as_bool(), true);
   EXPECT_EQ(smoother->get_parameter("max_velocity").as_double_array(), max_vel);
@@ -44,6 +44,8 @@
 #include <math.h>
 #include <limits.h>
 #include <algorithm>
+#include <cassert>
+#include <type_traits>
 
 #include <rclcpp/logger.hpp>
 #include <rclcpp/logging.hpp>
@@ -52,7 +54,9 @@
  * @class VoxelGrid
  * @brief A 3D grid structure that stores points as an integer array.
  *        X and Y index the array and Z selects which bit of the integer
- *        is used giving a limit of 16 vertical cells.
+ *        is used, giving a limit of 16 vertical cells with the uint32_t
+ *        columns of VoxelGrid and 32 with the uint64_t columns of
+ *        VoxelGrid64.
  */
 namespace nav2_voxel_grid
 {
@@ -64,29 +68,44 @@ enum VoxelStatus
   MARKED = 2,
 };
 
-class VoxelGrid
+/**
+ * Column-packed voxel grid, templated on the column word. The low half of
+ * each word holds the per-level "occupied or unknown" bits, the high half
+ * the per-level "marked" bits: marked = 11, unknown = 01, free = 00.
+ * Use the VoxelGrid (uint32_t, 16 levels) or VoxelGrid64 (uint64_t,
+ * 32 levels) instantiations.
+ */
+template<typename ColT>
+class VoxelGridImpl
 {
 public:
+  // Two bits of state per z level, split across the word's two halves
+  static constexpr unsigned int half_bits = sizeof(ColT) * 4;
+  static constexpr unsigned int max_z_levels = half_bits;
+
+  // Integer type of one half-word, for isolating the per-level bit fields
+  using HalfT = typename std::conditional<sizeof(ColT) == 4, uint16_t, uint32_t>::type;
+
   /**
    * @brief  Constructor for a voxel grid
    * @param size_x The x size of the grid
    * @param size_y The y size of the grid
-   * @param size_z The z size of the grid, only sizes <= 16 are supported
+   * @param size_z The z size of the grid, only sizes <= max_z_levels are supported
    */
-  VoxelGrid(unsigned int size_x, unsigned int size_y, unsigned int size_z);
+  VoxelGridImpl(unsigned int size_x, unsigned int size_y, unsigned int size_z);
 
-  ~VoxelGrid();
+  ~VoxelGridImpl();
 
   /**
    * @brief  Resizes a voxel grid to the desired size
    * @param size_x The x size of the grid
    * @param size_y The y size of the grid
-   * @param size_z The z size of the grid, only sizes <= 16 are supported
+   * @param size_z The z size of the grid, only sizes <= max_z_levels are supported
    */
   void resize(unsigned int size_x, unsigned int size_y, unsigned int size_z);
 
   void reset();
-  uint32_t * getData() {return data_;}
+  ColT * getData() {return data_;}
 
   inline void markVoxel(unsigned int x, unsigned int y, unsigned int z)
   {
@@ -94,7 +113,7 @@ public:
       RCLCPP_DEBUG(logger, "Error, voxel out of bounds.\n");
       return;
     }
-    uint32_t full_mask = ((uint32_t)1 << z << 16) | (1 << z);
+    ColT full_mask = ((ColT)1 << z << half_bits) | ((ColT)1 << z);
     data_[y * size_x_ + x] |= full_mask;  // clear unknown and mark cell
   }
 
@@ -108,11 +127,11 @@ public:
     }
 
     int index = y * size_x_ + x;
-    uint32_t * col = &data_[index];
-    uint32_t full_mask = ((uint32_t)1 << z << 16) | (1 << z);
+    ColT * col = &data_[index];
+    ColT full_mask = ((ColT)1 << z << half_bits) | ((ColT)1 << z);
     *col |= full_mask;  // clear unknown and mark cell
 
-    unsigned int marked_bits = *col >> 16;
+    unsigned int marked_bits = (unsigned int)(HalfT)(*col >> half_bits);
 
     // make sure the number of bits in each is below our thresholds
     return !bitsBelowThreshold(marked_bits, marked_threshold);
@@ -124,7 +143,7 @@ public:
       RCLCPP_DEBUG(logger, "Error, voxel out of bounds.\n");
       return;
     }
-    uint32_t full_mask = ((uint32_t)1 << z << 16) | (1 << z);
+    ColT full_mask = ((ColT)1 << z << half_bits) | ((ColT)1 << z);
     data_[y * size_x_ + x] &= ~(full_mask);  // clear unknown and clear cell
   }
 
@@ -141,12 +160,12 @@ public:
       return;
     }
     int index = y * size_x_ + x;
-    uint32_t * col = &data_[index];
-    uint32_t full_mask = ((uint32_t)1 << z << 16) | (1 << z);
+    ColT * col = &data_[index];
+    ColT full_mask = ((ColT)1 << z << half_bits) | ((ColT)1 << z);
     *col &= ~(full_mask);  // clear unknown and clear cell
 
-    unsigned int unknown_bits = uint16_t(*col >> 16) ^ uint16_t(*col);
-    unsigned int marked_bits = *col >> 16;
+    unsigned int unknown_bits = (unsigned int)((HalfT)(*col >> half_bits) ^ (HalfT)(*col));
+    unsigned int marked_bits = (unsigned int)(HalfT)(*col >> half_bits);
 
     // make sure the number of bits in each is below our thresholds
     if (bitsBelowThreshold(unknown_bits, 1) && bitsBelowThreshold(marked_bits, 1)) {
@@ -156,6 +175,9 @@ public:
 
   inline bool bitsBelowThreshold(unsigned int n, unsigned int bit_threshold)
   {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned int)__builtin_popcount(n) <= bit_threshold;
+#else
     unsigned int bit_count;
     for (bit_count = 0; n; ) {
       ++bit_count;
@@ -165,9 +187,10 @@ public:
       n &= n - 1;  // clear the least significant bit set
     }
     return true;
+#endif
   }
 
-  static inline unsigned int numBits(unsigned int n)
+  static inline unsigned int numBits(ColT n)
   {
     unsigned int bit_count;
     for (bit_count = 0; n; ++bit_count) {
@@ -178,13 +201,13 @@ public:
 
   static VoxelStatus getVoxel(
     unsigned int x, unsigned int y, unsigned int z,
-    unsigned int size_x, unsigned int size_y, unsigned int size_z, const uint32_t * data)
+    unsigned int size_x, unsigned int size_y, unsigned int size_z, const ColT * data)
   {
     if (x >= size_x || y >= size_y || z >= size_z) {
       return UNKNOWN;
     }
-    uint32_t full_mask = ((uint32_t)1 << z << 16) | (1 << z);
-    uint32_t result = data[y * size_x + x] & full_mask;
+    ColT full_mask = ((ColT)1 << z << half_bits) | ((ColT)1 << z);
+    ColT result = data[y * size_x + x] & full_mask;
     unsigned int bits = numBits(result);
 
     // known marked: 11 = 2 bits, unknown: 01 = 1 bit, known free: 00 = 0 bits
@@ -209,6 +232,33 @@ public:
     unsigned char free_cost = 0, unsigned char unknown_cost = 255,
     unsigned int max_length = UINT_MAX, unsigned int min_length = 0);
 
+  /**
+   * Trace a clearing line but only OR the z-masks it visits into mask_grid
+   * (one column word per column, same layout as the voxel data) instead of
+   * touching the grid itself. Several such accumulations can run in parallel
+   * on disjoint mask grids; applyClearMasks() then clears everything in one
+   * column-major pass. The final column bits (and therefore the costmap
+   * values) are identical to calling clearVoxelLineInMap() per line, since
+   * clearing only removes bits and the result only depends on the union of
+   * the masks applied to each column.
+   */
+  void accumulateClearLine(
+    ColT * mask_grid,
+    double x0, double y0, double z0, double x1, double y1, double z1,
+    unsigned int max_length = UINT_MAX, unsigned int min_length = 0);
+
+  /**
+   * Clear the accumulated masks from the columns in [begin_index, end_index)
+   * and update the corresponding 2D costmap cells, using the same threshold
+   * logic as clearVoxelLineInMap(). Columns with a zero mask are skipped.
+   * Callers may partition the index range across threads; bands are
+   * race-free as long as they do not overlap.
+   */
+  void applyClearMasks(
+    const ColT * mask_grid, unsigned int begin_index, unsigned int end_index,
+    unsigned char * map_2d, unsigned int unknown_threshold, unsigned int mark_threshold,
+    unsigned char free_cost = 0, unsigned char unknown_cost = 255);
+
   VoxelStatus getVoxel(unsigned int x, unsigned int y, unsigned int z);
 
   // Are there any obstacles at that (x, y) location in the grid?
@@ -263,12 +313,27 @@ public:
     int offset_dy = sign(dy) * size_x_;
     int offset_dz = sign(dz);
 
-    unsigned int z_mask = ((1 << 16) | 1) << (unsigned int)min_z0;
+    ColT z_mask = (((ColT)1 << half_bits) | (ColT)1) << (unsigned int)min_z0;
     unsigned int offset = (unsigned int)min_y0 * size_x_ + (unsigned int)min_x0;
 
     GridOffset grid_off(offset);
     ZOffset z_off(z_mask);
 
+    // Lines that stay within one z slice are the common case for planar
+    // sensors; use the 2D kernel where the z mask is loop-invariant
+    if (abs_dz == 0) {
+      if (abs_dx >= abs_dy) {
+        bresenham2D(
+          at, grid_off, grid_off, abs_dx, abs_dy, abs_dx / 2,
+          offset_dx, offset_dy, offset, z_mask, (unsigned int)(scale * abs_dx));
+      } else {
+        bresenham2D(
+          at, grid_off, grid_off, abs_dy, abs_dx, abs_dy / 2,
+          offset_dy, offset_dx, offset, z_mask, (unsigned int)(scale * abs_dy));
+      }
+      return;
+    }
+
     // is x dominant
     if (abs_dx >= max(abs_dy, abs_dz)) {
       int error_y = abs_dx / 2;
@@ -307,7 +372,7 @@ private:
     ActionType at, OffA off_a, OffB off_b, OffC off_c,
     unsigned int abs_da, unsigned int abs_db, unsigned int abs_dc,
     int error_b, int error_c, int offset_a, int offset_b, int offset_c, unsigned int & offset,
-    unsigned int & z_mask, unsigned int max_length = UINT_MAX)
+    ColT & z_mask, unsigned int max_length = UINT_MAX)
   {
     unsigned int end = std::min(max_length, abs_da);
     for (unsigned int i = 0; i < end; ++i) {
@@ -327,6 +392,29 @@ private:
     at(offset, z_mask);
   }
 
+  // Specialized traversal for lines confined to one z slice: identical to
+  // bresenham3D with abs_dc == 0 (the c-axis error can then never trip), but
+  // with the z bookkeeping removed from the per-step work entirely
+  template<class ActionType, class OffA, class OffB>
+  inline void bresenham2D(
+    ActionType at, OffA off_a, OffB off_b,
+    unsigned int abs_da, unsigned int abs_db, int error_b,
+    int offset_a, int offset_b, unsigned int & offset, ColT & z_mask,
+    unsigned int max_length = UINT_MAX)
+  {
+    unsigned int end = std::min(max_length, abs_da);
+    for (unsigned int i = 0; i < end; ++i) {
+      at(offset, z_mask);
+      off_a(offset_a);
+      error_b += abs_db;
+      if ((unsigned int)error_b >= abs_da) {
+        off_b(offset_b);
+        error_b -= abs_da;
+      }
+    }
+    at(offset, z_mask);
+  }
+
   inline int sign(int i)
   {
     return i > 0 ? 1 : -1;
@@ -338,7 +426,7 @@ private:
   }
 
   unsigned int size_x_, size_y_, size_z_;
-  uint32_t * data_;
+  ColT * data_;
   unsigned char * costmap;
   rclcpp::Logger logger;
 
@@ -347,36 +435,50 @@ private:
   class MarkVoxel
   {
 public:
-    explicit MarkVoxel(uint32_t * data)
+    explicit MarkVoxel(ColT * data)
     : data_(data) {}
-    inline void operator()(unsigned int offset, unsigned int z_mask)
+    inline void operator()(unsigned int offset, ColT z_mask)
     {
       data_[offset] |= z_mask;  // clear unknown and mark cell
     }
 
 private:
-    uint32_t * data_;
+    ColT * data_;
   };
 
   class ClearVoxel
   {
 public:
-    explicit ClearVoxel(uint32_t * data)
+    explicit ClearVoxel(ColT * data)
     : data_(data) {}
-    inline void operator()(unsigned int offset, unsigned int z_mask)
+    inline void operator()(unsigned int offset, ColT z_mask)
     {
       data_[offset] &= ~(z_mask);  // clear unknown and clear cell
     }
 
 private:
-    uint32_t * data_;
+    ColT * data_;
+  };
+
+  class OrMask
+  {
+public:
+    explicit OrMask(ColT * masks)
+    : masks_(masks) {}
+    inline void operator()(unsigned int offset, ColT z_mask)
+    {
+      masks_[offset] |= z_mask;  // remember the bits to clear for later
+    }
+
+private:
+    ColT * masks_;
   };
 
   class ClearVoxelInMap
   {
 public:
     ClearVoxelInMap(
-      uint32_t * data, unsigned char * costmap,
+      ColT * data, unsigned char * costmap,
       unsigned int unknown_clear_threshold, unsigned int marked_clear_threshold,
       unsigned char free_cost = 0, unsigned char unknown_cost = 255)
     : data_(data), costmap_(costmap),
@@ -386,13 +488,13 @@ public:
     {
     }
 
-    inline void operator()(unsigned int offset, unsigned int z_mask)
+    inline void operator()(unsigned int offset, ColT z_mask)
     {
-      uint32_t * col = &data_[offset];
+      ColT * col = &data_[offset];
       *col &= ~(z_mask);  // clear unknown and clear cell
 
-      unsigned int unknown_bits = uint16_t(*col >> 16) ^ uint16_t(*col);
-      unsigned int marked_bits = *col >> 16;
+      unsigned int unknown_bits = (unsigned int)((HalfT)(*col >> half_bits) ^ (HalfT)(*col));
+      unsigned int marked_bits = (unsigned int)(HalfT)(*col >> half_bits);
 
       // make sure the number of bits in each is below our thresholds
       if (bitsBelowThreshold(marked_bits, marked_clear_threshold_)) {
@@ -407,6 +509,9 @@ public:
 private:
     inline bool bitsBelowThreshold(unsigned int n, unsigned int bit_threshold)
     {
+#if defined(__GNUC__) || defined(__clang__)
+      return (unsigned int)__builtin_popcount(n) <= bit_threshold;
+#else
       unsigned int bit_count;
       for (bit_count = 0; n; ) {
         ++bit_count;
@@ -416,9 +521,10 @@ private:
         n &= n - 1;  // clear the least significant bit set
       }
       return true;
+#endif
     }
 
-    uint32_t * data_;
+    ColT * data_;
     unsigned char * costmap_;
     unsigned int unknown_clear_threshold_, marked_clear_threshold_;
     unsigned char free_cost_, unknown_cost_;
@@ -441,7 +547,7 @@ private:
   class ZOffset
   {
 public:
-    explicit ZOffset(unsigned int & z_mask)
+    explicit ZOffset(ColT & z_mask)
     : z_mask_(z_mask) {}
     inline void operator()(int offset_val)
     {
@@ -449,10 +555,17 @@ public:
     }
 
 private:
-    unsigned int & z_mask_;
+    ColT & z_mask_;
   };
 };
 
+// The historical 16-level grid and the 32-level variant for tall environments
+using VoxelGrid = VoxelGridImpl<uint32_t>;
+using VoxelGrid64 = VoxelGridImpl<uint64_t>;
+
+extern template class VoxelGridImpl<uint32_t>;
+extern template class VoxelGridImpl<uint64_t>;
+
 }  // namespace nav2_voxel_grid
 
 #endif  // NAV2_VOXEL_GRID__VOXEL_GRID_HPP_
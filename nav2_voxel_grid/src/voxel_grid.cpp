@@ -41,30 +41,32 @@
 
 namespace nav2_voxel_grid
 {
-VoxelGrid::VoxelGrid(unsigned int size_x, unsigned int size_y, unsigned int size_z)
+template<typename ColT>
+VoxelGridImpl<ColT>::VoxelGridImpl(unsigned int size_x, unsigned int size_y, unsigned int size_z)
 : logger(rclcpp::get_logger("voxel_grid"))
 {
   size_x_ = size_x;
   size_y_ = size_y;
   size_z_ = size_z;
 
-  if (size_z_ > 16) {
+  if (size_z_ > max_z_levels) {
     RCLCPP_INFO(
-      logger, "Error, this implementation can only support up to 16 z values (%d)",
-      size_z_);
-    size_z_ = 16;
+      logger, "Error, this implementation can only support up to %d z values (%d)",
+      max_z_levels, size_z_);
+    size_z_ = max_z_levels;
   }
 
-  data_ = new uint32_t[size_x_ * size_y_];
-  uint32_t unknown_col = ~((uint32_t)0) >> 16;
-  uint32_t * col = data_;
+  data_ = new ColT[size_x_ * size_y_];
+  ColT unknown_col = ~((ColT)0) >> half_bits;
+  ColT * col = data_;
   for (unsigned int i = 0; i < size_x_ * size_y_; ++i) {
     *col = unknown_col;
     ++col;
   }
 }
 
-void VoxelGrid::resize(unsigned int size_x, unsigned int size_y, unsigned int size_z)
+template<typename ColT>
+void VoxelGridImpl<ColT>::resize(unsigned int size_x, unsigned int size_y, unsigned int size_z)
 {
   // if we're not actually changing the size, we can just reset things
   if (size_x == size_x_ && size_y == size_y_ && size_z == size_z_) {
@@ -77,38 +79,41 @@ void VoxelGrid::resize(unsigned int size_x, unsigned int size_y, unsigned int si
   size_y_ = size_y;
   size_z_ = size_z;
 
-  if (size_z_ > 16) {
+  if (size_z_ > max_z_levels) {
     RCLCPP_INFO(
-      logger, "Error, this implementation can only support up to 16 z values (%d)",
-      size_z);
-    size_z_ = 16;
+      logger, "Error, this implementation can only support up to %d z values (%d)",
+      max_z_levels, size_z);
+    size_z_ = max_z_levels;
   }
 
-  data_ = new uint32_t[size_x_ * size_y_];
-  uint32_t unknown_col = ~((uint32_t)0) >> 16;
-  uint32_t * col = data_;
+  data_ = new ColT[size_x_ * size_y_];
+  ColT unknown_col = ~((ColT)0) >> half_bits;
+  ColT * col = data_;
   for (unsigned int i = 0; i < size_x_ * size_y_; ++i) {
     *col = unknown_col;
     ++col;
   }
 }
 
-VoxelGrid::~VoxelGrid()
+template<typename ColT>
+VoxelGridImpl<ColT>::~VoxelGridImpl()
 {
   delete[] data_;
 }
 
-void VoxelGrid::reset()
+template<typename ColT>
+void VoxelGridImpl<ColT>::reset()
 {
-  uint32_t unknown_col = ~((uint32_t)0) >> 16;
-  uint32_t * col = data_;
+  ColT unknown_col = ~((ColT)0) >> half_bits;
+  ColT * col = data_;
   for (unsigned int i = 0; i < size_x_ * size_y_; ++i) {
     *col = unknown_col;
     ++col;
   }
 }
 
-void VoxelGrid::markVoxelLine(
+template<typename ColT>
+void VoxelGridImpl<ColT>::markVoxelLine(
   double x0, double y0, double z0, double x1, double y1, double z1,
   unsigned int max_length)
 {
@@ -127,7 +132,8 @@ void VoxelGrid::markVoxelLine(
   raytraceLine(mv, x0, y0, z0, x1, y1, z1, max_length);
 }
 
-void VoxelGrid::clearVoxelLine(
+template<typename ColT>
+void VoxelGridImpl<ColT>::clearVoxelLine(
   double x0, double y0, double z0, double x1, double y1, double z1,
   unsigned int max_length, unsigned int min_length)
 {
@@ -146,7 +152,8 @@ void VoxelGrid::clearVoxelLine(
   raytraceLine(cv, x0, y0, z0, x1, y1, z1, max_length, min_length);
 }
 
-void VoxelGrid::clearVoxelLineInMap(
+template<typename ColT>
+void VoxelGridImpl<ColT>::clearVoxelLineInMap(
   double x0, double y0, double z0, double x1, double y1, double z1, unsigned char * map_2d,
   unsigned int unknown_threshold, unsigned int mark_threshold, unsigned char free_cost,
   unsigned char unknown_cost, unsigned int max_length, unsigned int min_length)
@@ -172,14 +179,66 @@ void VoxelGrid::clearVoxelLineInMap(
   raytraceLine(cvm, x0, y0, z0, x1, y1, z1, max_length, min_length);
 }
 
-VoxelStatus VoxelGrid::getVoxel(unsigned int x, unsigned int y, unsigned int z)
+template<typename ColT>
+void VoxelGridImpl<ColT>::accumulateClearLine(
+  ColT * mask_grid,
+  double x0, double y0, double z0, double x1, double y1, double z1,
+  unsigned int max_length, unsigned int min_length)
+{
+  if (x0 >= size_x_ || y0 >= size_y_ || z0 >= size_z_ || x1 >= size_x_ || y1 >= size_y_ ||
+    z1 >= size_z_)
+  {
+    RCLCPP_DEBUG(
+      logger,
+      "Error, line endpoint out of bounds. "
+      "(%.2f, %.2f, %.2f) to (%.2f, %.2f, %.2f),  size: (%d, %d, %d)",
+      x0, y0, z0, x1, y1, z1, size_x_, size_y_, size_z_);
+    return;
+  }
+
+  OrMask om(mask_grid);
+  raytraceLine(om, x0, y0, z0, x1, y1, z1, max_length, min_length);
+}
+
+template<typename ColT>
+void VoxelGridImpl<ColT>::applyClearMasks(
+  const ColT * mask_grid, unsigned int begin_index, unsigned int end_index,
+  unsigned char * map_2d, unsigned int unknown_threshold, unsigned int mark_threshold,
+  unsigned char free_cost, unsigned char unknown_cost)
+{
+  for (unsigned int i = begin_index; i < end_index; ++i) {
+    ColT mask = mask_grid[i];
+    if (!mask) {
+      continue;
+    }
+
+    ColT * col = &data_[i];
+    *col &= ~mask;  // clear unknown and clear cell
+
+    unsigned int unknown_bits = (unsigned int)((HalfT)(*col >> half_bits) ^ (HalfT)(*col));
+    unsigned int marked_bits = (unsigned int)(HalfT)(*col >> half_bits);
+
+    // make sure the number of bits in each is below our thresholds
+    // (same logic as ClearVoxelInMap)
+    if (bitsBelowThreshold(marked_bits, mark_threshold)) {
+      if (bitsBelowThreshold(unknown_bits, unknown_threshold)) {
+        map_2d[i] = free_cost;
+      } else {
+        map_2d[i] = unknown_cost;
+      }
+    }
+  }
+}
+
+template<typename ColT>
+VoxelStatus VoxelGridImpl<ColT>::getVoxel(unsigned int x, unsigned int y, unsigned int z)
 {
   if (x >= size_x_ || y >= size_y_ || z >= size_z_) {
     RCLCPP_DEBUG(logger, "Error, voxel out of bounds. (%d, %d, %d)\n", x, y, z);
     return UNKNOWN;
   }
-  uint32_t full_mask = ((uint32_t)1 << z << 16) | (1 << z);
-  uint32_t result = data_[y * size_x_ + x] & full_mask;
+  ColT full_mask = ((ColT)1 << z << half_bits) | ((ColT)1 << z);
+  ColT result = data_[y * size_x_ + x] & full_mask;
   unsigned int bits = numBits(result);
 
   // known marked: 11 = 2 bits, unknown: 01 = 1 bit, known free: 00 = 0 bits
@@ -194,7 +253,8 @@ VoxelStatus VoxelGrid::getVoxel(unsigned int x, unsigned int y, unsigned int z)
   return MARKED;
 }
 
-VoxelStatus VoxelGrid::getVoxelColumn(
+template<typename ColT>
+VoxelStatus VoxelGridImpl<ColT>::getVoxelColumn(
   unsigned int x, unsigned int y,
   unsigned int unknown_threshold, unsigned int marked_threshold)
 {
@@ -203,10 +263,10 @@ VoxelStatus VoxelGrid::getVoxelColumn(
     return UNKNOWN;
   }
 
-  uint32_t * col = &data_[y * size_x_ + x];
+  ColT * col = &data_[y * size_x_ + x];
 
-  unsigned int unknown_bits = uint16_t(*col >> 16) ^ uint16_t(*col);
-  unsigned int marked_bits = *col >> 16;
+  unsigned int unknown_bits = (unsigned int)((HalfT)(*col >> half_bits) ^ (HalfT)(*col));
+  unsigned int marked_bits = (unsigned int)(HalfT)(*col >> half_bits);
 
   // check if the number of marked bits qualifies the col as marked
   if (!bitsBelowThreshold(marked_bits, marked_threshold)) {
@@ -221,22 +281,26 @@ VoxelStatus VoxelGrid::getVoxelColumn(
   return FREE;
 }
 
-unsigned int VoxelGrid::sizeX()
+template<typename ColT>
+unsigned int VoxelGridImpl<ColT>::sizeX()
 {
   return size_x_;
 }
 
-unsigned int VoxelGrid::sizeY()
+template<typename ColT>
+unsigned int VoxelGridImpl<ColT>::sizeY()
 {
   return size_y_;
 }
 
-unsigned int VoxelGrid::sizeZ()
+template<typename ColT>
+unsigned int VoxelGridImpl<ColT>::sizeZ()
 {
   return size_z_;
 }
 
-void VoxelGrid::printVoxelGrid()
+template<typename ColT>
+void VoxelGridImpl<ColT>::printVoxelGrid()
 {
   for (unsigned int z = 0; z < size_z_; z++) {
     printf("Layer z = %u:\n", z);
@@ -249,14 +313,18 @@ void VoxelGrid::printVoxelGrid()
   }
 }
 
-void VoxelGrid::printColumnGrid()
+template<typename ColT>
+void VoxelGridImpl<ColT>::printColumnGrid()
 {
   printf("Column view:\n");
   for (unsigned int y = 0; y < size_y_; y++) {
     for (unsigned int x = 0; x < size_x_; x++) {
-      printf((getVoxelColumn(x, y, 16, 0) == nav2_voxel_grid::MARKED) ? "#" : " ");
+      printf((getVoxelColumn(x, y, max_z_levels, 0) == nav2_voxel_grid::MARKED) ? "#" : " ");
     }
     printf("|\n");
   }
 }
+
+template class VoxelGridImpl<uint32_t>;
+template class VoxelGridImpl<uint64_t>;
 }  // namespace nav2_voxel_grid
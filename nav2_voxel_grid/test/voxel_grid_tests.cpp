@@ -37,6 +37,10 @@
 #include <nav2_voxel_grid/voxel_grid.hpp>
 #include <gtest/gtest.h>
 
+#include <array>
+#include <cstring>
+#include <vector>
+
 TEST(voxel_grid, basicMarkingAndClearing) {
   int size_x = 50, size_y = 10, size_z = 16;
   nav2_voxel_grid::VoxelGrid vg(size_x, size_y, size_z);
@@ -185,6 +189,80 @@ TEST(voxel_grid, clearVoxelLineInMap) {
   delete[] map_2d;
 }
 
+TEST(voxel_grid, accumulatedClearMatchesPerLineClear) {
+  int size_x = 20, size_y = 20, size_z = 10;
+  nav2_voxel_grid::VoxelGrid direct(size_x, size_y, size_z);
+  nav2_voxel_grid::VoxelGrid deferred(size_x, size_y, size_z);
+
+  // mark the same obstacles in both grids and seed identical costmaps
+  unsigned char * direct_map = new unsigned char[size_x * size_y];
+  unsigned char * deferred_map = new unsigned char[size_x * size_y];
+  memset(direct_map, 255, size_x * size_y);
+  memset(deferred_map, 255, size_x * size_y);
+  for (int x = 2; x < 18; x += 3) {
+    for (int z = 0; z < size_z; z += 2) {
+      direct.markVoxelInMap(x, 10, z, 0);
+      deferred.markVoxelInMap(x, 10, z, 0);
+    }
+  }
+
+  // a fan of clearing beams from a common origin
+  std::vector<std::array<double, 3>> beams;
+  for (int x = 0; x < size_x; ++x) {
+    beams.push_back({static_cast<double>(x), 19.0, 4.0});
+    beams.push_back({static_cast<double>(x), 19.0, 8.0});
+  }
+
+  uint32_t * masks = new uint32_t[size_x * size_y]();
+  for (const auto & beam : beams) {
+    direct.clearVoxelLineInMap(10, 0, 5, beam[0], beam[1], beam[2], direct_map, 16, 0);
+    deferred.accumulateClearLine(masks, 10, 0, 5, beam[0], beam[1], beam[2]);
+  }
+  deferred.applyClearMasks(masks, 0, size_x * size_y, deferred_map, 16, 0);
+
+  for (int x = 0; x < size_x; ++x) {
+    for (int y = 0; y < size_y; ++y) {
+      EXPECT_EQ(direct_map[y * size_x + x], deferred_map[y * size_x + x]);
+      for (int z = 0; z < size_z; ++z) {
+        EXPECT_EQ(direct.getVoxel(x, y, z), deferred.getVoxel(x, y, z));
+      }
+    }
+  }
+
+  delete[] masks;
+  delete[] direct_map;
+  delete[] deferred_map;
+}
+
+TEST(voxel_grid, WideColumnsAboveSixteenLevels) {
+  int size_x = 10, size_y = 10, size_z = 32;
+  nav2_voxel_grid::VoxelGrid64 vg(size_x, size_y, size_z);
+
+  // marking and clearing must work in the upper half of the column word
+  EXPECT_EQ(vg.getVoxel(3, 3, 20), nav2_voxel_grid::UNKNOWN);
+  vg.markVoxel(3, 3, 20);
+  EXPECT_EQ(vg.getVoxel(3, 3, 20), nav2_voxel_grid::MARKED);
+  vg.clearVoxel(3, 3, 20);
+  EXPECT_EQ(vg.getVoxel(3, 3, 20), nav2_voxel_grid::FREE);
+  EXPECT_EQ(vg.getVoxel(3, 3, 21), nav2_voxel_grid::UNKNOWN);
+
+  // a clearing line through a tall marked column frees only its own level
+  unsigned char * map_2d = new unsigned char[size_x * size_y];
+  memset(map_2d, 254, size_x * size_y);
+  for (int z = 0; z < size_z; ++z) {
+    vg.markVoxel(5, 5, z);
+  }
+  vg.clearVoxelLineInMap(0, 5, 18, 9, 5, 18, map_2d, 0, 0);
+  EXPECT_EQ(vg.getVoxel(5, 5, 18), nav2_voxel_grid::FREE);
+  EXPECT_EQ(vg.getVoxel(5, 5, 19), nav2_voxel_grid::MARKED);
+  EXPECT_EQ(map_2d[5 * size_x + 5], 254);
+  delete[] map_2d;
+
+  // sizes beyond 32 levels are clamped, matching the 16-level behavior
+  vg.resize(size_x, size_y, 33);
+  EXPECT_EQ(vg.sizeZ(), 32u);
+}
+
 TEST(voxel_grid, GetVoxelData) {
   uint32_t * data = new uint32_t[9];
   data[4] = 255;
@@ -78,6 +78,13 @@ public:
   bool processAtWaypoint(
     const geometry_msgs::msg::PoseStamped & curr_pose, const int & curr_waypoint_index);
 
+  /**
+   * @brief Image encoding and disk I/O do not need to hold up navigation;
+   * concurrent executions are serialized on the internal mutex
+   * @return false, the task may run in the background
+   */
+  bool isBlocking() override {return false;}
+
   /**
    * @brief
    *
@@ -161,6 +161,16 @@ protected:
    */
   void goalResponseCallback(const rclcpp_action::ClientGoalHandle<ClientT>::SharedPtr & goal);
 
+  /**
+   * @brief Action client feedback callback, tracking the remaining distance
+   * of the current goal for lookahead dispatch
+   * @param goal_handle Handle of the goal the feedback belongs to
+   * @param feedback Feedback of action server updated asynchronously
+   */
+  void feedbackCallback(
+    rclcpp_action::ClientGoalHandle<ClientT>::SharedPtr goal_handle,
+    const std::shared_ptr<const ClientT::Feedback> feedback);
+
   /**
    * @brief given some gps_poses, converts them to map frame using robot_localization's service `fromLL`.
    *        Constructs a vector of stamped poses in map frame and returns them.
@@ -213,6 +223,11 @@ protected:
   int loop_rate_;
   GoalStatus current_goal_status_;
 
+  // Remaining distance to a waypoint at which the next one is dispatched
+  // while still moving, 0 to always come to a full stop first
+  double lookahead_dispatch_distance_;
+  double current_distance_remaining_{-1.0};
+
   // Task Execution At Waypoint Plugin
   pluginlib::ClassLoader<nav2_core::WaypointTaskExecutor>
   waypoint_task_executor_loader_;
@@ -15,6 +15,7 @@
 #include "nav2_waypoint_follower/waypoint_follower.hpp"
 
 #include <fstream>
+#include <future>
 #include <memory>
 #include <streambuf>
 #include <string>
@@ -36,6 +37,7 @@ WaypointFollower::WaypointFollower(const rclcpp::NodeOptions & options)
 
   declare_parameter("stop_on_failure", true);
   declare_parameter("loop_rate", 20);
+  declare_parameter("lookahead_dispatch_distance", 0.0);
 
   declare_parameter("action_server_result_timeout", 900.0);
 
@@ -62,6 +64,7 @@ WaypointFollower::on_configure(const rclcpp_lifecycle::State & /*state*/)
 
   stop_on_failure_ = get_parameter("stop_on_failure").as_bool();
   loop_rate_ = get_parameter("loop_rate").as_int();
+  lookahead_dispatch_distance_ = get_parameter("lookahead_dispatch_distance").as_double();
   waypoint_task_executor_id_ = get_parameter("waypoint_task_executor_plugin").as_string();
   global_frame_id_ = get_parameter("global_frame_id").as_string();
   global_frame_id_ = nav2_util::strip_leading_slash(global_frame_id_);
@@ -246,6 +249,57 @@ void WaypointFollower::followWaypointsHandler(
   uint32_t goal_index = goal->goal_index;
   bool new_goal = true;
 
+  // Tasks of non-blocking executors run in the background so navigation can
+  // proceed; their results are collected as they finish and drained before
+  // the action completes
+  struct PendingTask
+  {
+    int index;
+    geometry_msgs::msg::PoseStamped pose;
+    std::future<bool> is_executed;
+  };
+  std::vector<PendingTask> pending_tasks;
+
+  // Collect finished (or, when draining, all) background tasks, recording
+  // failures as missed waypoints. Returns false when a failure should
+  // terminate the action due to stop_on_failure.
+  auto collectTasks = [&](bool drain) -> bool {
+      for (auto it = pending_tasks.begin(); it != pending_tasks.end(); ) {
+        if (!drain &&
+          it->is_executed.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+          ++it;
+          continue;
+        }
+        bool is_task_executed = it->is_executed.get();
+        RCLCPP_INFO(
+          get_logger(), "Task execution at waypoint %i %s", it->index,
+          is_task_executed ? "succeeded" : "failed!");
+        if (!is_task_executed) {
+          nav2_msgs::msg::MissedWaypoint missedWaypoint;
+          missedWaypoint.index = it->index;
+          missedWaypoint.goal = it->pose;
+          missedWaypoint.error_code =
+            nav2_msgs::action::FollowWaypoints::Result::TASK_EXECUTOR_FAILED;
+          result->missed_waypoints.push_back(missedWaypoint);
+          if (stop_on_failure_) {
+            pending_tasks.erase(it);
+            return false;
+          }
+        }
+        it = pending_tasks.erase(it);
+      }
+      return true;
+    };
+
+  // Blocks until background tasks of a canceled or preempted goal are done
+  auto discardTasks = [&pending_tasks]() {
+      for (auto & task : pending_tasks) {
+        task.is_executed.wait();
+      }
+      pending_tasks.clear();
+    };
+
   while (rclcpp::ok()) {
     // Check if asked to stop processing action
     if (action_server->is_cancel_requested()) {
@@ -253,6 +307,7 @@ void WaypointFollower::followWaypointsHandler(
       callback_group_executor_.spin_until_future_complete(cancel_future);
       // for result callback processing
       callback_group_executor_.spin_some();
+      discardTasks();
       action_server->terminate_all();
       return;
     }
@@ -260,6 +315,7 @@ void WaypointFollower::followWaypointsHandler(
     // Check if asked to process another action
     if (action_server->is_preempt_requested()) {
       RCLCPP_INFO(get_logger(), "Preempting the goal pose.");
+      discardTasks();
       goal = action_server->accept_pending_goal();
       poses = getLatestGoalPoses<T>(action_server);
       if (poses.empty()) {
@@ -288,7 +344,11 @@ void WaypointFollower::followWaypointsHandler(
       send_goal_options.goal_response_callback = std::bind(
         &WaypointFollower::goalResponseCallback,
         this, std::placeholders::_1);
+      send_goal_options.feedback_callback = std::bind(
+        &WaypointFollower::feedbackCallback,
+        this, std::placeholders::_1, std::placeholders::_2);
 
+      current_distance_remaining_ = -1.0;
       future_goal_handle_ =
         nav_to_pose_client_->async_send_goal(client_goal, send_goal_options);
       current_goal_status_.status = ActionStatus::PROCESSING;
@@ -297,6 +357,21 @@ void WaypointFollower::followWaypointsHandler(
     feedback->current_waypoint = goal_index;
     action_server->publish_feedback(feedback);
 
+    // With lookahead dispatch enabled, consider a non-final waypoint reached
+    // once it is within the dispatch distance, so the next goal preempts the
+    // current one and the robot rolls through while the next plan computes
+    if (lookahead_dispatch_distance_ > 0.0 &&
+      current_goal_status_.status == ActionStatus::PROCESSING &&
+      current_distance_remaining_ >= 0.0 &&
+      current_distance_remaining_ <= lookahead_dispatch_distance_ &&
+      (goal_index + 1 < poses.size() || current_loop_no < no_of_loops))
+    {
+      RCLCPP_INFO(
+        get_logger(), "Waypoint %i is within the lookahead dispatch "
+        "distance, dispatching the next waypoint.", goal_index);
+      current_goal_status_.status = ActionStatus::SUCCEEDED;
+    }
+
     if (
       current_goal_status_.status == ActionStatus::FAILED ||
       current_goal_status_.status == ActionStatus::UNKNOWN)
@@ -324,11 +399,27 @@ void WaypointFollower::followWaypointsHandler(
       RCLCPP_INFO(
         get_logger(), "Succeeded processing waypoint %i, processing waypoint task execution",
         goal_index);
-      bool is_task_executed = waypoint_task_executor_->processAtWaypoint(
-        poses[goal_index], goal_index);
-      RCLCPP_INFO(
-        get_logger(), "Task execution at waypoint %i %s", goal_index,
-        is_task_executed ? "succeeded" : "failed!");
+
+      bool is_task_executed = true;
+      if (!waypoint_task_executor_->isBlocking()) {
+        // Hand the task to a background thread and keep navigating; the
+        // result is picked up by collectTasks once it completes
+        PendingTask task;
+        task.index = goal_index;
+        task.pose = poses[goal_index];
+        task.is_executed = std::async(
+          std::launch::async,
+          [this, pose = poses[goal_index], index = goal_index]() {
+            return waypoint_task_executor_->processAtWaypoint(pose, index);
+          });
+        pending_tasks.push_back(std::move(task));
+      } else {
+        is_task_executed = waypoint_task_executor_->processAtWaypoint(
+          poses[goal_index], goal_index);
+        RCLCPP_INFO(
+          get_logger(), "Task execution at waypoint %i %s", goal_index,
+          is_task_executed ? "succeeded" : "failed!");
+      }
 
       if (!is_task_executed) {
         nav2_msgs::msg::MissedWaypoint missedWaypoint;
@@ -361,6 +452,16 @@ void WaypointFollower::followWaypointsHandler(
       new_goal = true;
       if (goal_index >= poses.size()) {
         if (current_loop_no == no_of_loops) {
+          // Outstanding background tasks count towards the result, so they
+          // are drained before the action finishes
+          if (!collectTasks(true)) {
+            RCLCPP_WARN(
+              get_logger(), "Failed to execute task at a waypoint and "
+              "stop on failure is enabled. Terminating action.");
+            action_server->terminate_current(result);
+            current_goal_status_.error_code = 0;
+            return;
+          }
           RCLCPP_INFO(
             get_logger(), "Completed all %zu waypoints requested.",
             poses.size());
@@ -376,6 +477,16 @@ void WaypointFollower::followWaypointsHandler(
       }
     }
 
+    // Pick up results of background tasks that completed while driving
+    if (!collectTasks(false)) {
+      RCLCPP_WARN(
+        get_logger(), "Failed to execute task at a waypoint and "
+        "stop on failure is enabled. Terminating action.");
+      action_server->terminate_current(result);
+      current_goal_status_.error_code = 0;
+      return;
+    }
+
     callback_group_executor_.spin_some();
     r.sleep();
   }
@@ -435,6 +546,24 @@ WaypointFollower::resultCallback(
   }
 }
 
+void
+WaypointFollower::feedbackCallback(
+  rclcpp_action::ClientGoalHandle<ClientT>::SharedPtr goal_handle,
+  const std::shared_ptr<const ClientT::Feedback> feedback)
+{
+  // Ignore feedback of a previous goal, checking the handle without blocking
+  // since feedback and the goal response share a single threaded executor
+  if (!future_goal_handle_.valid() ||
+    future_goal_handle_.wait_for(std::chrono::seconds(0)) != std::future_status::ready ||
+    !future_goal_handle_.get() ||
+    goal_handle->get_goal_id() != future_goal_handle_.get()->get_goal_id())
+  {
+    return;
+  }
+
+  current_distance_remaining_ = feedback->distance_remaining;
+}
+
 void
 WaypointFollower::goalResponseCallback(
   const rclcpp_action::ClientGoalHandle<ClientT>::SharedPtr & goal)
@@ -465,6 +594,10 @@ WaypointFollower::dynamicParametersCallback(std::vector<rclcpp::Parameter> param
       if (name == "stop_on_failure") {
         stop_on_failure_ = parameter.as_bool();
       }
+    } else if (type == ParameterType::PARAMETER_DOUBLE) {
+      if (name == "lookahead_dispatch_distance") {
+        lookahead_dispatch_distance_ = parameter.as_double();
+      }
     }
   }
 
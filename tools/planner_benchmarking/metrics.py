@@ -91,6 +91,22 @@ def getRandomGoal(costmap, start, max_cost, side_buffer, time_stamp, res):
     return goal
 
 
+def getPlannerServerPeakRSS():
+    # Peak RSS (VmHWM) of the planner server process hosting all the plugins
+    for status_path in glob.glob('/proc/[0-9]*/status'):
+        try:
+            with open(os.path.dirname(status_path) + '/comm') as f:
+                if f.read().strip() != 'planner_server':
+                    continue
+            with open(status_path) as f:
+                for line in f:
+                    if line.startswith('VmHWM:'):
+                        return int(line.split()[1])
+        except OSError:
+            continue
+    return None
+
+
 def main():
     rclpy.init()
 
@@ -115,20 +131,29 @@ def main():
 
     random_pairs = 100
     res = costmap_msg.metadata.resolution
-    i = 0
-    while len(results) != random_pairs:
-        print('Cycle: ', i, 'out of: ', random_pairs)
+
+    # Draw the start/goal suite up front, so that the seed fixes the exact
+    # same set of requests for every planner and every run to compare
+    pairs = []
+    for i in range(random_pairs):
         start = getRandomStart(costmap, max_cost, side_buffer, time_stamp, res)
         goal = getRandomGoal(costmap, start, max_cost, side_buffer, time_stamp, res)
+        pairs.append((start, goal))
+
+    for i, (start, goal) in enumerate(pairs):
+        print('Cycle: ', i, 'out of: ', len(pairs))
         print('Start', start)
         print('Goal', goal)
         result = getPlannerResults(navigator, start, goal, planners)
         if len(result) == len(planners):
             results.append(result)
-            i = i + 1
         else:
             print('One of the planners was invalid')
 
+    peak_rss = getPlannerServerPeakRSS()
+    if peak_rss is not None:
+        print('planner_server peak RSS: ', peak_rss, ' kB')
+
     print('Write Results...')
     with open(os.getcwd() + '/results.pickle', 'wb+') as f:
         pickle.dump(results, f, pickle.HIGHEST_PROTOCOL)
@@ -138,6 +163,12 @@ def main():
 
     with open(os.getcwd() + '/planners.pickle', 'wb+') as f:
         pickle.dump(planners, f, pickle.HIGHEST_PROTOCOL)
+
+    with open(os.getcwd() + '/pairs.pickle', 'wb+') as f:
+        pickle.dump(pairs, f, pickle.HIGHEST_PROTOCOL)
+
+    with open(os.getcwd() + '/peak_rss.pickle', 'wb+') as f:
+        pickle.dump(peak_rss, f, pickle.HIGHEST_PROTOCOL)
     print('Write Complete')
     exit(0)
 
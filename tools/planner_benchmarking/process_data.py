@@ -178,8 +178,31 @@ def main():
             ]
         )
 
+    # Latency distribution per planner
+    latency_table = [['Planner', 'p50 (s)', 'p90 (s)', 'p99 (s)', 'Max (s)']]
+    for i in range(0, len(planners)):
+        latency_table.append(
+            [
+                planners[i],
+                np.percentile(times[i], 50),
+                np.percentile(times[i], 90),
+                np.percentile(times[i], 99),
+                np.max(times[i]),
+            ]
+        )
+
     # Visualize results
     print(tabulate(planner_table))
+    print(tabulate(latency_table))
+
+    try:
+        with open(os.getcwd() + '/peak_rss.pickle', 'rb') as f:
+            peak_rss = pickle.load(f)
+        if peak_rss is not None:
+            print('planner_server peak RSS: ', peak_rss, ' kB')
+    except OSError:
+        pass
+
     plotResults(costmap, paths)
 
 